@@ -16,7 +16,7 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
-#include <QCoreApplication>
+#include <QGuiApplication>
 #include <QSysInfo>
 #include <QTimer>
 
@@ -53,7 +53,11 @@ void catchUnixSignals(const std::vector<int>& quitSignals) {
 
 static int runQtApplication(int argc, char* argv[], qtwebapp::LoggerWithFile *logger)
 {
-    QCoreApplication a(argc, argv);
+    if (qgetenv("QT_QPA_PLATFORM").isEmpty() && qgetenv("DISPLAY").isEmpty()) {
+        qputenv("QT_QPA_PLATFORM", "offscreen"); // no display needed except for the OpenGL benchmarks
+    }
+
+    QGuiApplication a(argc, argv);
 
     QCoreApplication::setOrganizationName("f4exb");
     QCoreApplication::setApplicationName("SDRangelBench");
@@ -98,7 +98,7 @@ static int runQtApplication(int argc, char* argv[], qtwebapp::LoggerWithFile *lo
 int main(int argc, char* argv[])
 {
     qtwebapp::LoggerWithFile *logger = new qtwebapp::LoggerWithFile(qApp);
-    logger->installMsgHandler();
+    logger->installAsyncMsgHandler(); // DSP threads do not wait for log outputs
     int res = runQtApplication(argc, argv, logger);
     qWarning("SDRangel quit.");
     return res;
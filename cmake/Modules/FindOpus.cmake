@@ -0,0 +1,31 @@
+# Find Opus
+
+find_path(OPUS_INCLUDE_DIR
+  NAMES opus/opus.h
+  PATHS ${OPUS_DIR}/include
+        /usr/include
+        /usr/local/include
+)
+
+find_library(OPUS_LIBRARY
+  NAMES opus
+  PATHS ${OPUS_DIR}/lib
+        /usr/lib
+        /usr/local/lib
+)
+
+if (OPUS_INCLUDE_DIR AND OPUS_LIBRARY)
+    set(OPUS_FOUND TRUE)
+endif (OPUS_INCLUDE_DIR AND OPUS_LIBRARY)
+
+if (OPUS_FOUND)
+    if (NOT Opus_FIND_QUIETLY)
+        message (STATUS "Found Opus: ${OPUS_INCLUDE_DIR}, ${OPUS_LIBRARY}")
+    endif (NOT Opus_FIND_QUIETLY)
+else (OPUS_FOUND)
+    if (Opus_FIND_REQUIRED)
+        message (FATAL_ERROR "Could not find Opus")
+    endif (Opus_FIND_REQUIRED)
+endif (OPUS_FOUND)
+
+mark_as_advanced(OPUS_INCLUDE_DIR OPUS_LIBRARY)
@@ -234,91 +234,99 @@ void HttpConnectionHandler::read()
         if (currentRequest->getStatus()==HttpRequest::complete)
         {
             readTimer.stop();
-            qDebug("HttpConnectionHandler (%p): received request from %s (%s) %s",
-                    this,
-                    qPrintable(currentRequest->getPeerAddress().toString()),
-                    currentRequest->getMethod().toStdString().c_str(),
-                    currentRequest->getPath().toStdString().c_str());
-
-            // Copy the Connection:close header to the response
-            HttpResponse response(socket);
-            bool closeConnection=QString::compare(currentRequest->getHeader("Connection"),"close",Qt::CaseInsensitive)==0;
+            bool closeConnection=serviceRequest(currentRequest, socket, requestHandler, this);
+
+            // Close the connection or prepare for the next request on the same connection.
             if (closeConnection)
             {
-                response.setHeader("Connection","close");
+                while(socket->bytesToWrite()) socket->waitForBytesWritten();
+                socket->disconnectFromHost();
             }
-
-            // In case of HTTP 1.0 protocol add the Connection:close header.
-            // This ensures that the HttpResponse does not activate chunked mode, which is not spported by HTTP 1.0.
             else
             {
-                bool http1_0=QString::compare(currentRequest->getVersion(),"HTTP/1.0",Qt::CaseInsensitive)==0;
-                if (http1_0)
-                {
-                    closeConnection=true;
-                    response.setHeader("Connection","close");
-                }
+                // Start timer for next request
+                int readTimeout = useQtSettings ? settings->value("readTimeout",10000).toInt() : listenerSettings->readTimeout;
+                readTimer.start(readTimeout);
             }
+            delete currentRequest;
+            currentRequest=0;
+        }
+    }
+}
 
-            // Call the request mapper
-            try
-            {
-                requestHandler->service(*currentRequest, response);
-            }
-            catch (...)
-            {
-                qCritical("HttpConnectionHandler (%p): An uncatched exception occured in the request handler",this);
-            }
 
-            // Finalize sending the response if not already done
-            if (!response.hasSentLastPart())
-            {
-                response.write(QByteArray(),true);
-            }
+bool HttpConnectionHandler::serviceRequest(HttpRequest* request, QTcpSocket* socket, HttpRequestHandler* requestHandler, const void* handler, QByteArray* pendingOutput)
+{
+    qDebug("HttpConnectionHandler (%p): received request from %s (%s) %s",
+            handler,
+            qPrintable(request->getPeerAddress().toString()),
+            request->getMethod().toStdString().c_str(),
+            request->getPath().toStdString().c_str());
+
+    // Copy the Connection:close header to the response
+    HttpResponse response(socket, pendingOutput);
+    bool closeConnection=QString::compare(request->getHeader("Connection"),"close",Qt::CaseInsensitive)==0;
+    if (closeConnection)
+    {
+        response.setHeader("Connection","close");
+    }
+
+    // In case of HTTP 1.0 protocol add the Connection:close header.
+    // This ensures that the HttpResponse does not activate chunked mode, which is not spported by HTTP 1.0.
+    else
+    {
+        bool http1_0=QString::compare(request->getVersion(),"HTTP/1.0",Qt::CaseInsensitive)==0;
+        if (http1_0)
+        {
+            closeConnection=true;
+            response.setHeader("Connection","close");
+        }
+    }
+
+    // Call the request mapper
+    try
+    {
+        requestHandler->service(*request, response);
+    }
+    catch (...)
+    {
+        qCritical("HttpConnectionHandler (%p): An uncatched exception occured in the request handler",handler);
+    }
+
+    // Finalize sending the response if not already done
+    if (!response.hasSentLastPart())
+    {
+        response.write(QByteArray(),true);
+    }
 
 #ifdef SUPERVERBOSE
-            qDebug("HttpConnectionHandler (%p): finished request",this);
+    qDebug("HttpConnectionHandler (%p): finished request",handler);
 #endif
 
-            // Find out whether the connection must be closed
-            if (!closeConnection)
+    // Find out whether the connection must be closed
+    if (!closeConnection)
+    {
+        // Maybe the request handler or mapper added a Connection:close header in the meantime
+        bool closeResponse=QString::compare(response.getHeaders().value("Connection"),"close",Qt::CaseInsensitive)==0;
+        if (closeResponse==true)
+        {
+            closeConnection=true;
+        }
+        else
+        {
+            // If we have no Content-Length header and did not use chunked mode, then we have to close the
+            // connection to tell the HTTP client that the end of the response has been reached.
+            bool hasContentLength=response.getHeaders().contains("Content-Length");
+            if (!hasContentLength)
             {
-                // Maybe the request handler or mapper added a Connection:close header in the meantime
-                bool closeResponse=QString::compare(response.getHeaders().value("Connection"),"close",Qt::CaseInsensitive)==0;
-                if (closeResponse==true)
+                bool hasChunkedMode=QString::compare(response.getHeaders().value("Transfer-Encoding"),"chunked",Qt::CaseInsensitive)==0;
+                if (!hasChunkedMode)
                 {
                     closeConnection=true;
                 }
-                else
-                {
-                    // If we have no Content-Length header and did not use chunked mode, then we have to close the
-                    // connection to tell the HTTP client that the end of the response has been reached.
-                    bool hasContentLength=response.getHeaders().contains("Content-Length");
-                    if (!hasContentLength)
-                    {
-                        bool hasChunkedMode=QString::compare(response.getHeaders().value("Transfer-Encoding"),"chunked",Qt::CaseInsensitive)==0;
-                        if (!hasChunkedMode)
-                        {
-                            closeConnection=true;
-                        }
-                    }
-                }
             }
-
-            // Close the connection or prepare for the next request on the same connection.
-            if (closeConnection)
-            {
-                while(socket->bytesToWrite()) socket->waitForBytesWritten();
-                socket->disconnectFromHost();
-            }
-            else
-            {
-                // Start timer for next request
-                int readTimeout = useQtSettings ? settings->value("readTimeout",10000).toInt() : listenerSettings->readTimeout;
-                readTimer.start(readTimeout);
-            }
-            delete currentRequest;
-            currentRequest=0;
         }
     }
+
+    return closeConnection;
 }
@@ -86,6 +86,18 @@ public:
      */
     const HttpListenerSettings *getListenerSettings() const { return listenerSettings; }
 
+    /**
+      Let the request handler process a complete request and send the response.
+      Also used by the event driven connection handler.
+      @param request The complete request
+      @param socket Socket of the connection
+      @param requestHandler Handler that will process the request
+      @param handler Connection handler for debug messages
+      @param pendingOutput Queue of the output not yet passed to the socket for non blocking writes (event driven handler) or null
+      @return true if the connection must be closed after this request
+    */
+    static bool serviceRequest(HttpRequest* request, QTcpSocket* socket, HttpRequestHandler* requestHandler, const void* handler, QByteArray* pendingOutput=0);
+
 
 private:
 
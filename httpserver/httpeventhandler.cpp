@@ -0,0 +1,254 @@
+/**
+  @file
+  @author Edouard Griffiths, F4EXB
+*/
+
+#include <QDateTime>
+
+#include "httpeventhandler.h"
+
+using namespace qtwebapp;
+
+HttpEventHandler::HttpEventHandler(QSettings* settings, HttpRequestHandler* requestHandler)
+    : QThread(), useQtSettings(true)
+{
+    Q_ASSERT(settings != 0);
+    Q_ASSERT(requestHandler != 0);
+    this->settings = settings;
+    this->listenerSettings = 0;
+    this->requestHandler = requestHandler;
+    readTimeout = settings->value("readTimeout",10000).toInt();
+    init();
+}
+
+HttpEventHandler::HttpEventHandler(const HttpListenerSettings* settings, HttpRequestHandler* requestHandler)
+    : QThread(), useQtSettings(false)
+{
+    Q_ASSERT(settings != 0);
+    Q_ASSERT(requestHandler != 0);
+    this->settings = 0;
+    this->listenerSettings = settings;
+    this->requestHandler = requestHandler;
+    readTimeout = settings->readTimeout;
+    init();
+}
+
+void HttpEventHandler::init()
+{
+    // execute signals in my own thread
+    moveToThread(this);
+    idleTimer.moveToThread(this);
+    connect(&idleTimer, SIGNAL(timeout()), SLOT(checkIdle()));
+
+    qDebug("HttpEventHandler (%p): constructed", this);
+    this->start();
+}
+
+HttpEventHandler::~HttpEventHandler()
+{
+    quit();
+    wait();
+    qDebug("HttpEventHandler (%p): destroyed", this);
+}
+
+void HttpEventHandler::run()
+{
+    idleTimer.start(qMax(readTimeout/10, 100));
+
+    try
+    {
+        exec();
+    }
+    catch (...)
+    {
+        qCritical("HttpEventHandler (%p): an uncatched exception occured in the thread",this);
+    }
+
+    idleTimer.stop();
+
+    foreach(Connection* connection, connections)
+    {
+        connection->socket->disconnect(this);
+        connection->socket->abort();
+        delete connection->socket;
+        delete connection->request;
+        delete connection;
+    }
+
+    connections.clear();
+}
+
+HttpRequest* HttpEventHandler::newRequest()
+{
+    if (useQtSettings) {
+        return new HttpRequest(settings);
+    } else {
+        return new HttpRequest(listenerSettings);
+    }
+}
+
+void HttpEventHandler::handleConnection(tSocketDescriptor socketDescriptor)
+{
+    QTcpSocket* socket=new QTcpSocket();
+
+    if (!socket->setSocketDescriptor(socketDescriptor))
+    {
+        qCritical("HttpEventHandler (%p): cannot initialize socket: %s", this,qPrintable(socket->errorString()));
+        delete socket;
+        connectionCount.deref();
+        return;
+    }
+
+    Connection* connection=new Connection;
+    connection->socket=socket;
+    connection->request=newRequest();
+    connection->lastActivity=QDateTime::currentMSecsSinceEpoch();
+    connection->closing=false;
+    connections.insert(socket, connection);
+
+    connect(socket, SIGNAL(readyRead()), SLOT(read()));
+    connect(socket, SIGNAL(bytesWritten(qint64)), SLOT(written()));
+    connect(socket, SIGNAL(disconnected()), SLOT(disconnected()));
+
+#ifdef SUPERVERBOSE
+    qDebug("HttpEventHandler (%p): new connection, %d connections", this, connections.size());
+#endif
+}
+
+void HttpEventHandler::read()
+{
+    QTcpSocket* socket=qobject_cast<QTcpSocket*>(sender());
+    Connection* connection=connections.value(socket, 0);
+
+    // ignore data received on a connection being closed
+    if (!connection || connection->closing || (socket->state()!=QAbstractSocket::ConnectedState)) {
+        return;
+    }
+
+    connection->lastActivity=QDateTime::currentMSecsSinceEpoch();
+    processRequests(connection);
+}
+
+void HttpEventHandler::processRequests(Connection* connection)
+{
+    QTcpSocket* socket=connection->socket;
+    HttpRequest* request=connection->request;
+
+    // The loop adds support for HTTP pipelining. Next requests wait until the output of the previous ones is passed to the socket.
+    while (socket->bytesAvailable() && connection->pendingOutput.isEmpty())
+    {
+        while (socket->bytesAvailable() && request->getStatus()!=HttpRequest::complete && request->getStatus()!=HttpRequest::abort)
+        {
+            request->readFromSocket(socket);
+        }
+
+        // If the request is aborted, return error message and close the connection
+        if (request->getStatus()==HttpRequest::abort)
+        {
+            socket->write("HTTP/1.1 413 entity too large\r\nConnection: close\r\n\r\n413 Entity too large\r\n");
+            closeConnection(connection);
+            return;
+        }
+
+        // If the request is complete, let the request mapper dispatch it
+        if (request->getStatus()==HttpRequest::complete)
+        {
+            bool close=HttpConnectionHandler::serviceRequest(request, socket, requestHandler, this, &connection->pendingOutput);
+            request->reset();
+
+            if (close)
+            {
+                closeConnection(connection);
+                return;
+            }
+        }
+    }
+}
+
+void HttpEventHandler::closeConnection(Connection* connection)
+{
+    connection->closing=true;
+
+    // data in the socket buffer is written before the socket is closed and disconnected() is emitted
+    if (connection->pendingOutput.isEmpty()) {
+        connection->socket->disconnectFromHost();
+    }
+}
+
+void HttpEventHandler::written()
+{
+    QTcpSocket* socket=qobject_cast<QTcpSocket*>(sender());
+    Connection* connection=connections.value(socket, 0);
+
+    if (!connection || (socket->state()!=QAbstractSocket::ConnectedState)) {
+        return;
+    }
+
+    connection->lastActivity=QDateTime::currentMSecsSinceEpoch();
+
+    if (connection->pendingOutput.isEmpty()) {
+        return;
+    }
+
+    // refill the socket buffer up to the same limit as HttpResponse
+    qint64 room=16384-socket->bytesToWrite();
+
+    if (room>0)
+    {
+        qint64 written=socket->write(connection->pendingOutput.constData(), qMin(room, (qint64) connection->pendingOutput.size()));
+
+        if (written>0) {
+            connection->pendingOutput.remove(0, written);
+        }
+    }
+
+    if (connection->pendingOutput.isEmpty())
+    {
+        if (connection->closing) {
+            socket->disconnectFromHost();
+        } else {
+            processRequests(connection); // requests received in the meantime
+        }
+    }
+}
+
+void HttpEventHandler::disconnected()
+{
+    QTcpSocket* socket=qobject_cast<QTcpSocket*>(sender());
+    Connection* connection=connections.take(socket);
+
+    if (!connection) {
+        return;
+    }
+
+#ifdef SUPERVERBOSE
+    qDebug("HttpEventHandler (%p): disconnected, %d connections", this, connections.size());
+#endif
+
+    socket->deleteLater();
+    delete connection->request;
+    delete connection;
+    connectionCount.deref();
+}
+
+void HttpEventHandler::checkIdle()
+{
+    qint64 now=QDateTime::currentMSecsSinceEpoch();
+
+    foreach(Connection* connection, connections)
+    {
+        if ((now - connection->lastActivity > readTimeout) && (connection->socket->state()==QAbstractSocket::ConnectedState))
+        {
+            if (connection->pendingOutput.isEmpty() && (connection->socket->bytesToWrite()==0))
+            {
+                qDebug("HttpEventHandler (%p): read timeout occured",this);
+                closeConnection(connection);
+            }
+            else // the client does not read its responses
+            {
+                qDebug("HttpEventHandler (%p): write timeout occured",this);
+                connection->socket->abort();
+            }
+        }
+    }
+}
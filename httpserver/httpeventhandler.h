@@ -0,0 +1,147 @@
+/**
+  @file
+  @author Edouard Griffiths, F4EXB
+*/
+
+#ifndef HTTPEVENTHANDLER_H
+#define HTTPEVENTHANDLER_H
+
+#include <QTcpSocket>
+#include <QSettings>
+#include <QTimer>
+#include <QThread>
+#include <QHash>
+#include <QAtomicInt>
+#include "httpglobal.h"
+#include "httpconnectionhandler.h"
+#include "httprequest.h"
+#include "httprequesthandler.h"
+#include "httplistenersettings.h"
+
+#include "export.h"
+
+namespace qtwebapp {
+
+/**
+  Event driven connection handler. Unlike HttpConnectionHandler which serves one connection
+  in its own thread, each instance serves any number of persistent connections from the event
+  loop of a single thread. The listener spreads the connections over a few of these handlers.
+  <p>
+  Requests are read as data arrives, pipelined requests are served in order and each connection
+  keeps a single HttpRequest object that is reset between requests so that its buffers are reused.
+  Idle connections are closed after the readTimeout.
+  <p>
+  Responses are written without blocking: the output that does not fit in the socket buffer is queued
+  and passed to the socket as it gets written. No further request of the connection is read while output
+  is queued. A connection whose output makes no progress during the readTimeout is aborted.
+  <p>
+  SSL is not supported in this mode.
+  @see HttpConnectionHandler for description of the readTimeout
+*/
+class HTTPSERVER_API HttpEventHandler : public QThread {
+    Q_OBJECT
+    Q_DISABLE_COPY(HttpEventHandler)
+
+public:
+
+    /**
+      Constructor.
+      @param settings Configuration settings of the HTTP webserver as Qt settings
+      @param requestHandler Handler that will process each incoming HTTP request
+    */
+    HttpEventHandler(QSettings* settings, HttpRequestHandler* requestHandler);
+
+    /**
+      Constructor.
+      @param settings Configuration settings of the HTTP webserver as a structure
+      @param requestHandler Handler that will process each incoming HTTP request
+    */
+    HttpEventHandler(const HttpListenerSettings* settings, HttpRequestHandler* requestHandler);
+
+    /** Destructor. Closes all connections. */
+    virtual ~HttpEventHandler();
+
+    /** Number of connections served or about to be served by this handler */
+    int getConnectionCount() const { return connectionCount.load(); }
+
+    /** Account for a connection that will be passed with handleConnection() */
+    void addConnection() { connectionCount.ref(); }
+
+private:
+
+    /** State of a connection */
+    struct Connection
+    {
+        QTcpSocket* socket;
+        HttpRequest* request;
+        qint64 lastActivity;
+        QByteArray pendingOutput; //!< output not yet passed to the socket
+        bool closing;             //!< close once the pending output is written
+    };
+
+    /** Configuration settings */
+    QSettings* settings;
+
+    /** Configuration settings */
+    const HttpListenerSettings* listenerSettings;
+
+    /** Dispatches received requests to services */
+    HttpRequestHandler* requestHandler;
+
+    /** Connections by socket */
+    QHash<QTcpSocket*, Connection*> connections;
+
+    /** Number of connections including the ones queued to handleConnection() */
+    QAtomicInt connectionCount;
+
+    /** Timer for idle connection detection */
+    QTimer idleTimer;
+
+    /** Read timeout in milliseconds */
+    int readTimeout;
+
+    /** Settings flag */
+    bool useQtSettings;
+
+    /** Executes the threads own event loop */
+    void run();
+
+    /** Common part of the constructors */
+    void init();
+
+    /** Create a new request object */
+    HttpRequest* newRequest();
+
+    /** Serve the complete requests received on a connection */
+    void processRequests(Connection* connection);
+
+    /** Close the connection once pending data has been written */
+    void closeConnection(Connection* connection);
+
+public slots:
+
+    /**
+      Received from from the listener, when the handler shall start processing a new connection.
+      @param socketDescriptor references the accepted connection.
+    */
+    void handleConnection(tSocketDescriptor socketDescriptor);
+
+private slots:
+
+    /** Received from a socket when incoming data can be read */
+    void read();
+
+    /** Received from a socket when some of its output has been written */
+    void written();
+
+    /** Received from a socket when its connection has been closed */
+    void disconnected();
+
+    /** Received from the timer to close idle connections */
+    void checkIdle();
+
+};
+
+} // end of namespace
+
+#endif // HTTPEVENTHANDLER_H
@@ -49,7 +49,28 @@ HttpListener::~HttpListener()
 
 void HttpListener::listen()
 {
-    if (!pool)
+    int eventThreads = useQtSettings ? settings->value("eventThreads",0).toInt() : listenerSettings.eventThreads;
+    maxConnections = useQtSettings ? settings->value("maxConnections",1000).toInt() : listenerSettings.maxConnections;
+    QString sslKeyFile = useQtSettings ? settings->value("sslKeyFile","").toString() : listenerSettings.sslKeyFile;
+
+    if ((eventThreads > 0) && !sslKeyFile.isEmpty())
+    {
+        qWarning("HttpListener: SSL is not supported in event driven mode. Using one thread per connection");
+        eventThreads = 0;
+    }
+
+    if (eventThreads > 0)
+    {
+        while (eventHandlers.size() < eventThreads)
+        {
+            if (useQtSettings) {
+                eventHandlers.append(new HttpEventHandler(settings, requestHandler));
+            } else {
+                eventHandlers.append(new HttpEventHandler(&listenerSettings, requestHandler));
+            }
+        }
+    }
+    else if (!pool)
     {
         if (useQtSettings) {
             pool = new HttpConnectionHandlerPool(settings, requestHandler);
@@ -77,6 +98,10 @@ void HttpListener::close() {
         delete pool;
         pool=NULL;
     }
+    foreach(HttpEventHandler* eventHandler, eventHandlers) {
+        delete eventHandler;
+    }
+    eventHandlers.clear();
 }
 
 void HttpListener::incomingConnection(tSocketDescriptor socketDescriptor) {
@@ -85,13 +110,34 @@ void HttpListener::incomingConnection(tSocketDescriptor socketDescriptor) {
 #endif
 
     HttpConnectionHandler* freeHandler=NULL;
-    if (pool)
+    HttpEventHandler* eventHandler=NULL;
+    if (eventHandlers.size() > 0)
+    {
+        // Pick the least loaded event handler
+        int nbConnections=0;
+        foreach(HttpEventHandler* handler, eventHandlers)
+        {
+            nbConnections+=handler->getConnectionCount();
+            if (!eventHandler || handler->getConnectionCount() < eventHandler->getConnectionCount()) {
+                eventHandler=handler;
+            }
+        }
+        if (nbConnections >= maxConnections) {
+            eventHandler=NULL;
+        }
+    }
+    else if (pool)
     {
         freeHandler=pool->getConnectionHandler();
     }
 
     // Let the handler process the new connection.
-    if (freeHandler)
+    if (eventHandler)
+    {
+        eventHandler->addConnection();
+        QMetaObject::invokeMethod(eventHandler, "handleConnection", Qt::QueuedConnection, Q_ARG(tSocketDescriptor, socketDescriptor));
+    }
+    else if (freeHandler)
     {
         // The descriptor is passed via event queue because the handler lives in another thread
         QMetaObject::invokeMethod(freeHandler, "handleConnection", Qt::QueuedConnection, Q_ARG(tSocketDescriptor, socketDescriptor));
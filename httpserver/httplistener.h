@@ -12,6 +12,7 @@
 #include "httpglobal.h"
 #include "httpconnectionhandler.h"
 #include "httpconnectionhandlerpool.h"
+#include "httpeventhandler.h"
 #include "httprequesthandler.h"
 #include "httplistenersettings.h"
 
@@ -35,12 +36,18 @@ namespace qtwebapp {
   ;sslCertFile=ssl/my.cert
   maxRequestSize=16000
   maxMultiPartSize=1000000
+  ;eventThreads=2
+  ;maxConnections=1000
   </pre></code>
   The optional host parameter binds the listener to one network interface.
   The listener handles all network interfaces if no host is configured.
   The port number specifies the incoming TCP port that this listener listens to.
+  If eventThreads is greater than 0 the connections are served by this number of
+  event driven handlers instead of one thread per connection and at most maxConnections
+  connections are accepted.
   @see HttpConnectionHandlerPool for description of config settings minThreads, maxThreads, cleanupInterval and ssl settings
   @see HttpConnectionHandler for description of the readTimeout
+  @see HttpEventHandler for the event driven mode
   @see HttpRequest for description of config settings maxRequestSize and maxMultiPartSize
 */
 
@@ -114,6 +121,12 @@ private:
     /** Pool of connection handlers */
     HttpConnectionHandlerPool* pool;
 
+    /** Event driven connection handlers. Used instead of the pool when not empty. */
+    QList<HttpEventHandler*> eventHandlers;
+
+    /** Maximum number of connections in event driven mode */
+    int maxConnections;
+
     /** Settings flag */
     bool useQtSettings;
 
@@ -23,6 +23,8 @@ public:
     QString sslCertFile;
     int maxRequestSize;
     int maxMultiPartSize;
+    int eventThreads;    //!< number of event driven connection handler threads. 0 for one thread per connection.
+    int maxConnections;  //!< maximum number of connections in event driven mode
 
     HttpListenerSettings() {
         resetToDefaults();
@@ -40,6 +42,8 @@ public:
         sslCertFile = "";
         maxRequestSize = 16000;
         maxMultiPartSize = 1000000;
+        eventThreads = 0;
+        maxConnections = 1000;
     }
 };
 
@@ -540,6 +540,30 @@ void HttpRequest::parseMultiPartFile()
 }
 
 HttpRequest::~HttpRequest()
+{
+    deleteFiles();
+}
+
+void HttpRequest::reset()
+{
+    deleteFiles();
+    headers.clear();
+    parameters.clear();
+    cookies.clear();
+    // keep the allocated storage of the buffers
+    bodyData.resize(0);
+    lineBuffer.resize(0);
+    method.clear();
+    path.clear();
+    version.clear();
+    currentHeader.clear();
+    boundary.clear();
+    status=waitForRequest;
+    currentSize=0;
+    expectedBodySize=0;
+}
+
+void HttpRequest::deleteFiles()
 {
     foreach(QByteArray key, uploadedFiles.keys())
     {
@@ -550,6 +574,7 @@ HttpRequest::~HttpRequest()
         }
         delete file;
     }
+    uploadedFiles.clear();
     if (tempFile != NULL)
     {
         if (tempFile->isOpen())
@@ -557,6 +582,7 @@ HttpRequest::~HttpRequest()
             tempFile->close();
         }
         delete tempFile;
+        tempFile=NULL;
     }
 }
 
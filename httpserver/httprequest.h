@@ -72,6 +72,12 @@ public:
     */
     void readFromSocket(QTcpSocket* socket);
 
+    /**
+      Clear the request so that the object and its buffers can be reused
+      for the next request of a persistent connection.
+    */
+    void reset();
+
     /**
       Get the status of this reqeust.
       @see RequestStatus
@@ -238,6 +244,9 @@ private:
     /** Sub-procedure of readFromSocket(), extract cookies from headers */
     void extractCookies();
 
+    /** Close and delete the uploaded files and the multipart temp file */
+    void deleteFiles();
+
     /** Buffer for collecting characters of request and header lines */
     QByteArray lineBuffer;
 
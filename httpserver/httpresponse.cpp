@@ -10,6 +10,18 @@ using namespace qtwebapp;
 HttpResponse::HttpResponse(QTcpSocket* socket)
 {
     this->socket=socket;
+    pendingOutput=0;
+    statusCode=200;
+    statusText="OK";
+    sentHeaders=false;
+    sentLastPart=false;
+    chunkedMode=false;
+}
+
+HttpResponse::HttpResponse(QTcpSocket* socket, QByteArray* pendingOutput)
+{
+    this->socket=socket;
+    this->pendingOutput=pendingOutput;
     statusCode=200;
     statusText="OK";
     sentHeaders=false;
@@ -74,6 +86,27 @@ void HttpResponse::writeHeaders()
 
 bool HttpResponse::writeToSocket(QByteArray data)
 {
+    if (pendingOutput)
+    {
+        // Never wait: fill the socket buffer up to the limit and queue the rest behind it
+        if (!socket->isOpen())
+        {
+            return false;
+        }
+        int room=pendingOutput->isEmpty() ? (int) qMax((qint64) 0, 16384-socket->bytesToWrite()) : 0;
+        int written=0;
+        if (room>0)
+        {
+            written=socket->write(data.constData(),qMin(room,data.size()));
+            if (written==-1)
+            {
+                return false;
+            }
+        }
+        pendingOutput->append(data.constData()+written,data.size()-written);
+        return true;
+    }
+
     int remaining=data.size();
     char* ptr=data.data();
     while (socket->isOpen() && remaining>0)
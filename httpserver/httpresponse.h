@@ -45,6 +45,15 @@ public:
     */
     HttpResponse(QTcpSocket* socket);
 
+    /**
+      Constructor for event driven connections. Writing never blocks: the output that does not fit
+      in the socket buffer is appended to pendingOutput which the connection handler passes to the
+      socket as it gets written.
+      @param socket used to write the response
+      @param pendingOutput output of the connection not yet passed to the socket
+    */
+    HttpResponse(QTcpSocket* socket, QByteArray* pendingOutput);
+
     /**
       Set a HTTP response header.
       You must call this method before the first write().
@@ -130,6 +139,9 @@ private:
     /** Socket for writing output */
     QTcpSocket* socket;
 
+    /** Output queued behind the socket buffer in event driven mode, null in blocking mode */
+    QByteArray* pendingOutput;
+
     /** HTTP status code*/
     int statusCode;
 
@@ -148,7 +160,10 @@ private:
     /** Cookies */
     QMap<QByteArray,HttpCookie> cookies;
 
-    /** Write raw data to the socket. This method blocks until all bytes have been passed to the TCP buffer */
+    /**
+      Write raw data to the socket. In blocking mode this method blocks until all bytes have been passed
+      to the TCP buffer. In event driven mode the bytes that do not fit are queued to pendingOutput.
+    */
     bool writeToSocket(QByteArray data);
 
     /**
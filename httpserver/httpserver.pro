@@ -31,6 +31,7 @@ HEADERS += $$PWD/httpglobal.h \
            $$PWD/httplistener.h \
            $$PWD/httpconnectionhandler.h \
            $$PWD/httpconnectionhandlerpool.h \
+           $$PWD/httpeventhandler.h \
            $$PWD/httprequest.h \
            $$PWD/httpresponse.h \
            $$PWD/httpcookie.h \
@@ -47,6 +48,7 @@ SOURCES += $$PWD/httpglobal.cpp \
            $$PWD/httplistener.cpp \
            $$PWD/httpconnectionhandler.cpp \
            $$PWD/httpconnectionhandlerpool.cpp \
+           $$PWD/httpeventhandler.cpp \
            $$PWD/httprequest.cpp \
            $$PWD/httpresponse.cpp \
            $$PWD/httpcookie.cpp \
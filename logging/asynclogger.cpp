@@ -0,0 +1,215 @@
+/*
+ * asynclogger.cpp
+ *
+ *  Created on: Oct 18, 2018
+ *      Author: f4exb
+ */
+
+#include <QDateTime>
+#include <QThread>
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "logmessage.h"
+#include "asynclogger.h"
+
+using namespace qtwebapp;
+
+std::vector<AsyncLogger::Ring*> AsyncLogger::rings;
+std::mutex AsyncLogger::ringsMutex;
+std::atomic<quint64> AsyncLogger::sequence(0);
+AsyncLogger* AsyncLogger::instance = 0;
+
+AsyncLogger::AsyncLogger(Logger* logger, const int ringSize) :
+    logger(logger),
+    ringSize(ringSize < 16 ? 16 : ringSize),
+    running(false),
+    droppedTotal(0)
+{
+    Q_ASSERT(logger != 0);
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    stop();
+}
+
+void AsyncLogger::installMsgHandler()
+{
+    if (running.exchange(true)) {
+        return;
+    }
+
+    writer = std::thread(&AsyncLogger::run, this);
+    instance = this;
+    qInstallMessageHandler(msgHandler);
+}
+
+void AsyncLogger::stop()
+{
+    if (!running.exchange(false)) {
+        return;
+    }
+
+    logger->installMsgHandler();
+    instance = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wakeCondition.notify_one();
+    }
+
+    writer.join();
+    drain(); // messages posted while stopping
+}
+
+void AsyncLogger::flush()
+{
+    drain();
+}
+
+void AsyncLogger::msgHandler(const QtMsgType type, const QMessageLogContext& context, const QString &message)
+{
+    AsyncLogger* asyncLogger = instance;
+
+    if (!asyncLogger)
+    {
+        fputs(qPrintable(message), stderr);
+        fputs("\n", stderr);
+        return;
+    }
+
+    asyncLogger->post(type, context, message);
+
+    if (type == QtFatalMsg)
+    {
+        asyncLogger->flush();
+        abort();
+    }
+    else if (type == QtCriticalMsg)
+    {
+        asyncLogger->wakeCondition.notify_one(); // do not wait for the next poll
+    }
+}
+
+AsyncLogger::Ring* AsyncLogger::threadRing()
+{
+    static thread_local RingHolder ringHolder;
+
+    if (!ringHolder.ring)
+    {
+        ringHolder.ring = new Ring(ringSize);
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        rings.push_back(ringHolder.ring);
+    }
+
+    return ringHolder.ring;
+}
+
+bool AsyncLogger::post(const QtMsgType type, const QMessageLogContext& context, const QString &message)
+{
+    Ring* ring = threadRing();
+    unsigned int head = ring->head.load(std::memory_order_relaxed);
+    unsigned int tail = ring->tail.load(std::memory_order_acquire);
+
+    if (head - tail >= ring->entries.size())
+    {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Formatting of time, thread and location is left to the background thread
+    Entry& entry = ring->entries[head % ring->entries.size()];
+    entry.sequence = sequence.fetch_add(1, std::memory_order_relaxed);
+    entry.msecs = QDateTime::currentMSecsSinceEpoch();
+    entry.threadId = QThread::currentThreadId();
+    entry.type = type;
+    entry.message = message;
+    entry.file = context.file;
+    entry.function = context.function;
+    entry.line = context.line;
+    ring->head.store(head + 1, std::memory_order_release);
+
+    return true;
+}
+
+void AsyncLogger::run()
+{
+    while (running.load())
+    {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            wakeCondition.wait_for(lock, std::chrono::milliseconds(50));
+        }
+
+        drain();
+    }
+}
+
+void AsyncLogger::drain()
+{
+    std::lock_guard<std::mutex> drainLock(drainMutex);
+    std::vector<Ring*> ringsSnapshot;
+    std::vector<Entry> drained;
+    unsigned int dropped = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        ringsSnapshot = rings;
+    }
+
+    for (std::vector<Ring*>::iterator it = ringsSnapshot.begin(); it != ringsSnapshot.end(); ++it)
+    {
+        Ring* ring = *it;
+        bool closed = ring->closed.load(std::memory_order_acquire); // before reading head so nothing is missed
+        unsigned int head = ring->head.load(std::memory_order_acquire);
+        unsigned int tail = ring->tail.load(std::memory_order_relaxed);
+
+        for (; tail != head; ++tail)
+        {
+            Entry& entry = ring->entries[tail % ring->entries.size()];
+            drained.push_back(std::move(entry)); // the text is released in this thread
+        }
+
+        ring->tail.store(tail, std::memory_order_release);
+        dropped += ring->dropped.exchange(0, std::memory_order_relaxed);
+
+        if (closed)
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            rings.erase(std::remove(rings.begin(), rings.end(), ring), rings.end());
+            delete ring;
+        }
+    }
+
+    // Each ring is in order. Merge them back in the order messages were posted.
+    std::sort(drained.begin(), drained.end(), [](const Entry& a, const Entry& b) {
+        return a.sequence < b.sequence;
+    });
+
+    for (std::vector<Entry>::const_iterator it = drained.begin(); it != drained.end(); ++it)
+    {
+        LogMessage logMessage(it->type,
+            it->message,
+            QString(it->file),
+            QString(it->function),
+            it->line,
+            QDateTime::fromMSecsSinceEpoch(it->msecs),
+            it->threadId);
+        logger->logDeferred(&logMessage);
+    }
+
+    if (dropped > 0)
+    {
+        droppedTotal += dropped;
+        LogMessage logMessage(QtWarningMsg,
+            QString("AsyncLogger: %1 messages dropped").arg(dropped),
+            QString(), QString(), 0,
+            QDateTime::currentDateTime(),
+            QThread::currentThreadId());
+        logger->logDeferred(&logMessage);
+    }
+}
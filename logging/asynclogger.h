@@ -0,0 +1,143 @@
+/*
+ * asynclogger.h
+ *
+ *  Created on: Oct 18, 2018
+ *      Author: f4exb
+ */
+
+#ifndef LOGGING_ASYNCLOGGER_H_
+#define LOGGING_ASYNCLOGGER_H_
+
+#include <QtGlobal>
+#include <QString>
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+#include "logger.h"
+
+#include "export.h"
+
+namespace qtwebapp {
+
+/**
+  Takes over the message handler of a Logger so that threads emitting log messages
+  (e.g. DSP threads) never wait for the log outputs.
+  <p>
+  Each thread posts its messages in its own lock free ring buffer. Only the message
+  text, type, source location, time and thread are recorded. A background thread
+  drains the rings, restores the global order of messages and hands them over to
+  the wrapped logger that does the decoration and writes to its outputs.
+  <p>
+  When a ring is full the message is dropped and the number of dropped messages is
+  logged later. Fatal messages flush all rings synchronously before the program aborts.
+  <p>
+  The wrapped logger keeps its settings (levels, file...) and can be used as before.
+
+  @see Logger::logDeferred() which is called from the background thread.
+*/
+
+class LOGGING_API AsyncLogger {
+    Q_DISABLE_COPY(AsyncLogger)
+public:
+
+    /**
+      Constructor.
+      @param logger Logger that decorates and writes out the messages
+      @param ringSize Number of messages that each thread can post before the background thread drains them
+    */
+    AsyncLogger(Logger* logger, const int ringSize=4096);
+
+    /** Destructor. Stops if running. */
+    ~AsyncLogger();
+
+    /**
+      Starts the background thread and installs this logger as the default message handler
+      in place of the wrapped logger.
+    */
+    void installMsgHandler();
+
+    /**
+      Gives the message handler back to the wrapped logger, stops the background thread
+      and writes out the remaining messages.
+    */
+    void stop();
+
+    /** Write out all posted messages now from the calling thread */
+    void flush();
+
+    /** Total number of messages dropped because a ring was full */
+    quint64 getDropped() const { return droppedTotal; }
+
+private:
+
+    struct Entry
+    {
+        quint64 sequence;
+        qint64 msecs;
+        Qt::HANDLE threadId;
+        QtMsgType type;
+        QString message;
+        const char* file;
+        const char* function;
+        int line;
+    };
+
+    /** Single producer single consumer ring of one thread */
+    struct Ring
+    {
+        std::vector<Entry> entries;
+        std::atomic<unsigned int> head;    //!< next slot written by the producer
+        std::atomic<unsigned int> tail;    //!< next slot read by the consumer
+        std::atomic<unsigned int> dropped; //!< messages dropped since last drain
+        std::atomic<bool> closed;          //!< the thread has exited
+
+        Ring(int size) : entries(size), head(0), tail(0), dropped(0), closed(false) {}
+    };
+
+    /** Marks the ring of a thread closed when the thread exits */
+    struct RingHolder
+    {
+        Ring* ring;
+        RingHolder() : ring(0) {}
+        ~RingHolder() { if (ring) ring->closed.store(true); }
+    };
+
+    Logger* logger;
+    int ringSize;
+    std::thread writer;
+    std::atomic<bool> running;
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    std::mutex drainMutex;
+    std::atomic<quint64> droppedTotal;
+
+    /** The rings of all threads. Guarded by ringsMutex which is taken only when a thread posts its first message. */
+    static std::vector<Ring*> rings;
+    static std::mutex ringsMutex;
+    static std::atomic<quint64> sequence;
+
+    /** The installed instance used by msgHandler() */
+    static AsyncLogger* instance;
+
+    static void msgHandler(const QtMsgType type, const QMessageLogContext& context, const QString &message);
+
+    /** Ring of the calling thread, created and registered on first use */
+    Ring* threadRing();
+
+    /** Post a message in the ring of the calling thread. Returns false if the ring is full. */
+    bool post(const QtMsgType type, const QMessageLogContext& context, const QString &message);
+
+    /** Background thread loop */
+    void run();
+
+    /** Drain all rings and write out their messages in order */
+    void drain();
+};
+
+} // end of namespace
+
+#endif /* LOGGING_ASYNCLOGGER_H_ */
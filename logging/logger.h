@@ -88,6 +88,14 @@ public:
     */
     virtual void log(const QtMsgType type, const QString& message, const QString &file="", const QString &function="", const int line=0);
 
+    /**
+      Log a message recorded earlier, if its type>=minLevel. Used by AsyncLogger.
+      The backtrace buffer does not apply as the message comes from another thread.
+      This method is thread safe.
+      @param logMessage The message with its original timestamp and thread
+    */
+    virtual void logDeferred(const LogMessage* logMessage);
+
     /**
       Installs this logger as the default message handler, so it
       can be used through the global static logging functions (e.g. qDebug()).
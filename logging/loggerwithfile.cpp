@@ -5,18 +5,21 @@
  *      Author: f4exb
  */
 
+#include <QLoggingCategory>
+
 #include "loggerwithfile.h"
 
 using namespace qtwebapp;
 
 LoggerWithFile::LoggerWithFile(QObject* parent)
-    :Logger(parent), fileLogger(0), useFileFlogger(false)
+    :Logger(parent), fileLogger(0), useFileFlogger(false), asyncLogger(0)
 {
      consoleLogger = new Logger(this);
 }
 
 LoggerWithFile::~LoggerWithFile()
 {
+    delete asyncLogger; // writes out pending messages while the outputs still exist
     destroyFileLogger();
     delete consoleLogger;
 }
@@ -30,6 +33,15 @@ void LoggerWithFile::createOrSetFileLogger(const FileLoggerSettings& settings, c
     }
 }
 
+void LoggerWithFile::installAsyncMsgHandler(const int ringSize)
+{
+    if (!asyncLogger)
+    {
+        asyncLogger = new AsyncLogger(this, ringSize);
+        asyncLogger->installMsgHandler();
+    }
+}
+
 void LoggerWithFile::destroyFileLogger()
 {
     if (fileLogger)
@@ -48,6 +60,15 @@ void LoggerWithFile::log(const QtMsgType type, const QString& message, const QSt
     }
 }
 
+void LoggerWithFile::logDeferred(const LogMessage* logMessage)
+{
+    consoleLogger->logDeferred(logMessage);
+
+    if (fileLogger && useFileFlogger) {
+        fileLogger->logDeferred(logMessage);
+    }
+}
+
 void LoggerWithFile::logToFile(const QtMsgType type, const QString& message, const QString &file, const QString &function, const int line)
 {
     if (fileLogger && useFileFlogger) {
@@ -67,6 +88,7 @@ void LoggerWithFile::clear(const bool buffer, const bool variables)
 void LoggerWithFile::setConsoleMinMessageLevel(const QtMsgType& msgLevel)
 {
     consoleLogger->setMinMessageLevel(msgLevel);
+    updateFilterRules();
 }
 
 void LoggerWithFile::setFileMinMessageLevel(const QtMsgType& msgLevel)
@@ -74,6 +96,25 @@ void LoggerWithFile::setFileMinMessageLevel(const QtMsgType& msgLevel)
     if (fileLogger) {
         fileLogger->setMinMessageLevel(msgLevel);
     }
+
+    updateFilterRules();
+}
+
+void LoggerWithFile::setFilterRules(const QString& rules)
+{
+    filterRules = rules;
+    filterRules.replace(';', '\n');
+    updateFilterRules();
+}
+
+void LoggerWithFile::updateFilterRules()
+{
+    // QtDebugMsg is 0 and QtInfoMsg is 4 so debug is the only level below info
+    bool debugUsed = (consoleLogger->getMinMessageLevel() == QtDebugMsg)
+        || (fileLogger && useFileFlogger && (fileLogger->getMinMessageLevel() == QtDebugMsg));
+
+    QString rules = debugUsed ? QString() : QString("*.debug=false\n");
+    QLoggingCategory::setFilterRules(rules + filterRules);
 }
 
 void LoggerWithFile::getConsoleMinMessageLevelStr(QString& levelStr)
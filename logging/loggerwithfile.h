@@ -11,6 +11,7 @@
 #include <QtGlobal>
 #include "logger.h"
 #include "filelogger.h"
+#include "asynclogger.h"
 
 #include "export.h"
 
@@ -31,6 +32,14 @@ public:
     virtual ~LoggerWithFile();
 
     void createOrSetFileLogger(const FileLoggerSettings& settings, const int refreshInterval=10000);
+
+    /**
+      Installs this logger as the default message handler through an AsyncLogger
+      so that the threads emitting messages do not wait for the outputs.
+      The AsyncLogger is stopped when this logger is destroyed.
+      @param ringSize Number of messages each thread can post before they are written out
+    */
+    void installAsyncMsgHandler(const int ringSize=4096);
     void destroyFileLogger();
 
     /**
@@ -45,6 +54,13 @@ public:
     */
     virtual void log(const QtMsgType type, const QString& message, const QString &file="", const QString &function="", const int line=0);
 
+    /**
+      Log a message recorded earlier to console and file, if its type>=minLevel.
+      This method is thread safe.
+      @param logMessage The message with its original timestamp and thread
+    */
+    virtual void logDeferred(const LogMessage* logMessage);
+
     /**
       Clear the thread-local data of the current thread.
       This method is thread safe.
@@ -54,7 +70,7 @@ public:
     virtual void clear(const bool buffer=true, const bool variables=true);
 
     bool getUseFileLogger() const { return useFileFlogger; }
-    void setUseFileLogger(bool use) { useFileFlogger = use; }
+    void setUseFileLogger(bool use) { useFileFlogger = use; updateFilterRules(); }
     bool hasFileLogger() const { return fileLogger != 0; }
 
     /**
@@ -79,6 +95,13 @@ public:
     /** This will log to file only */
     void logToFile(const QtMsgType type, const QString& message, const QString &file="", const QString &function="", const int line=0);
 
+    /**
+      Set logging category filter rules (see QLoggingCategory::setFilterRules).
+      Rules may be separated by ';'. They apply after the debug rule that disables
+      debug messages at the source when no output takes debug messages.
+    */
+    void setFilterRules(const QString& rules);
+
 private:
     /** First console logger */
     Logger* consoleLogger;
@@ -88,6 +111,18 @@ private:
 
     /** Use file logger indicator */
     bool useFileFlogger;
+
+    /** Asynchronous message handler, or 0=synchronous */
+    AsyncLogger* asyncLogger;
+
+    /** Category filter rules set by the user */
+    QString filterRules;
+
+    /**
+      Disable debug messages at the source when neither console nor file takes them
+      so that qCDebug() is not even formatted and qDebug() does not reach the handler.
+    */
+    void updateFilterRules();
 };
 
 } // end of namespace
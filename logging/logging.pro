@@ -33,11 +33,13 @@ HEADERS += $$PWD/logglobal.h \
            $$PWD/logger.h \
            $$PWD/filelogger.h \
            $$PWD/dualfilelogger.h \
-           $$PWD/loggerwithfile.h
+           $$PWD/loggerwithfile.h \
+           $$PWD/asynclogger.h
 
 SOURCES += $$PWD/logmessage.cpp \
            $$PWD/logger.cpp \
            $$PWD/filelogger.cpp \
            $$PWD/dualfilelogger.cpp \
-           $$PWD/loggerwithfile.cpp
+           $$PWD/loggerwithfile.cpp \
+           $$PWD/asynclogger.cpp
            
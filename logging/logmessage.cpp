@@ -26,6 +26,17 @@ LogMessage::LogMessage(const QtMsgType type, const QString& message, QHash<QStri
     }
 }
 
+LogMessage::LogMessage(const QtMsgType type, const QString& message, const QString &file, const QString &function, const int line, const QDateTime& timestamp, Qt::HANDLE threadId)
+{
+    this->type=type;
+    this->message=message;
+    this->file=file;
+    this->function=function;
+    this->line=line;
+    this->timestamp=timestamp;
+    this->threadId=threadId;
+}
+
 QString LogMessage::toString(const QString& msgFormat, const QString& timestampFormat) const
 {
     QString decorated=msgFormat+"\n";
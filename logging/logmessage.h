@@ -52,6 +52,18 @@ public:
     */
     LogMessage(const QtMsgType type, const QString& message, QHash<QString,QString>* logVars, const QString &file, const QString &function, const int line);
 
+    /**
+      Constructor for a message recorded earlier, possibly in another thread.
+      @param type Type of the message
+      @param message Message text
+      @param file Name of the source file where the message was generated
+      @param function Name of the function where the message was generated
+      @param line Line Number of the source file, where the message was generated
+      @param timestamp Date and time when the message was generated
+      @param threadId ID number of the thread that generated the message
+    */
+    LogMessage(const QtMsgType type, const QString& message, const QString &file, const QString &function, const int line, const QDateTime& timestamp, Qt::HANDLE threadId);
+
     /**
       Returns the log message as decorated string.
       @param msgFormat Format of the decoration. May contain variables and static text,
@@ -24,10 +24,8 @@
 #include <unistd.h>
 #include <boost/crc.hpp>
 #include <boost/cstdint.hpp>
+#include <algorithm>
 
-#include <QNetworkAccessManager>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include "SWGChannelSettings.h"
 
@@ -36,6 +34,8 @@
 #include "dsp/downchannelizer.h"
 #include "dsp/dspcommands.h"
 #include "device/devicesourceapi.h"
+#include "webapi/webapireversedispatcher.h"
+#include "channel/sdrdaemoncodec.h"
 #include "daemonsinkthread.h"
 #include "daemonsink.h"
 
@@ -53,13 +53,16 @@ DaemonSink::DaemonSink(DeviceSourceAPI *deviceAPI) :
         m_txBlockIndex(0),
         m_frameCount(0),
         m_sampleIndex(0),
+        m_frameSampleFormat(SDRDaemonSampleRaw),
+        m_samplesPerBlock(SDRDaemonCodec::getSamplesPerBlock(SDRDaemonSampleRaw, sizeof(FixReal))),
         m_dataBlock(0),
         m_centerFrequency(0),
         m_sampleRate(48000),
         m_nbBlocksFEC(0),
         m_txDelay(35),
         m_dataAddress("127.0.0.1"),
-        m_dataPort(9090)
+        m_dataPort(9090),
+        m_sampleFormat(SDRDaemonSampleRaw)
 {
     setObjectName(m_channelId);
 
@@ -67,15 +70,10 @@ DaemonSink::DaemonSink(DeviceSourceAPI *deviceAPI) :
     m_threadedChannelizer = new ThreadedBasebandSampleSink(m_channelizer, this);
     m_deviceAPI->addThreadedSink(m_threadedChannelizer);
     m_deviceAPI->addChannelAPI(this);
-
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 DaemonSink::~DaemonSink()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
     m_dataBlockMutex.lock();
 
     if (m_dataBlock && !m_dataBlock->m_txControlBlock.m_complete) {
@@ -92,7 +90,7 @@ DaemonSink::~DaemonSink()
 void DaemonSink::setTxDelay(int txDelay, int nbBlocksFEC)
 {
     double txDelayRatio = txDelay / 100.0;
-    int samplesPerBlock = SDRDaemonNbBytesPerBlock / sizeof(Sample);
+    int samplesPerBlock = SDRDaemonCodec::getSamplesPerBlock(m_sampleFormat, sizeof(FixReal));
     double delay = m_sampleRate == 0 ? 1.0 : (127*samplesPerBlock*txDelayRatio) / m_sampleRate;
     delay /= 128 + nbBlocksFEC;
     m_txDelay = roundf(delay*1e6); // microseconds
@@ -124,9 +122,14 @@ void DaemonSink::feed(const SampleVector::const_iterator& begin, const SampleVec
             SDRDaemonMetaDataFEC metaData;
             gettimeofday(&tv, 0);
 
+            // the sample format can only change at frame boundaries
+            m_frameSampleFormat = m_sampleFormat;
+            m_samplesPerBlock = SDRDaemonCodec::getSamplesPerBlock(m_frameSampleFormat, sizeof(FixReal));
+            uint8_t sampleBytes = (m_frameSampleFormat << 4) + (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
+
             metaData.m_centerFrequency = m_centerFrequency;
             metaData.m_sampleRate = m_sampleRate;
-            metaData.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
+            metaData.m_sampleBytes = sampleBytes;
             metaData.m_sampleBits = SDR_RX_SAMP_SZ;
             metaData.m_nbOriginalBlocks = SDRDaemonNbOrginalBlocks;
             metaData.m_nbFECBlocks = m_nbBlocksFEC;
@@ -144,7 +147,7 @@ void DaemonSink::feed(const SampleVector::const_iterator& begin, const SampleVec
             superBlock.init();
             superBlock.m_header.m_frameIndex = m_frameCount;
             superBlock.m_header.m_blockIndex = m_txBlockIndex;
-            superBlock.m_header.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
+            superBlock.m_header.m_sampleBytes = sampleBytes;
             superBlock.m_header.m_sampleBits = SDR_RX_SAMP_SZ;
 
             SDRDaemonMetaDataFEC *destMeta = (SDRDaemonMetaDataFEC *) &superBlock.m_protectedBlock;
@@ -158,6 +161,7 @@ void DaemonSink::feed(const SampleVector::const_iterator& begin, const SampleVec
                         << ":" << metaData.m_sampleRate
                         << ":" << (int) (metaData.m_sampleBytes & 0xF)
                         << ":" << (int) metaData.m_sampleBits
+                        << ":" << SDRDaemonCodec::getName(m_frameSampleFormat)
                         << "|" << (int) metaData.m_nbOriginalBlocks
                         << ":" << (int) metaData.m_nbFECBlocks
                         << "|" << metaData.m_tv_sec
@@ -169,27 +173,23 @@ void DaemonSink::feed(const SampleVector::const_iterator& begin, const SampleVec
             m_txBlockIndex = 1; // next Tx block with data
         } // block zero
 
-        // handle different sample sizes...
-        int samplesPerBlock = SDRDaemonNbBytesPerBlock / (SDR_RX_SAMP_SZ <= 16 ? 4 : 8); // two I or Q samples
-        if (m_sampleIndex + inRemainingSamples < samplesPerBlock) // there is still room in the current super block
+        // samples are gathered until the block is full then encoded in the frame sample format
+        if (m_sampleIndex + inRemainingSamples < m_samplesPerBlock) // there is still room in the current super block
         {
-            memcpy((void *) &m_superBlock.m_protectedBlock.buf[m_sampleIndex*sizeof(Sample)],
-                    (const void *) &(*(begin+inSamplesIndex)),
-                    inRemainingSamples * sizeof(Sample));
+            std::copy(begin + inSamplesIndex, end, &m_blockSamples[m_sampleIndex]);
             m_sampleIndex += inRemainingSamples;
             it = end; // all input samples are consumed
         }
         else // complete super block and initiate the next if not end of frame
         {
-            memcpy((void *) &m_superBlock.m_protectedBlock.buf[m_sampleIndex*sizeof(Sample)],
-                    (const void *) &(*(begin+inSamplesIndex)),
-                    (samplesPerBlock - m_sampleIndex) * sizeof(Sample));
-            it += samplesPerBlock - m_sampleIndex;
+            std::copy(begin + inSamplesIndex, begin + inSamplesIndex + (m_samplesPerBlock - m_sampleIndex), &m_blockSamples[m_sampleIndex]);
+            it += m_samplesPerBlock - m_sampleIndex;
             m_sampleIndex = 0;
 
+            SDRDaemonCodec::encode(m_frameSampleFormat, (const FixReal *) m_blockSamples, SDR_RX_SAMP_SZ, m_superBlock.m_protectedBlock);
             m_superBlock.m_header.m_frameIndex = m_frameCount;
             m_superBlock.m_header.m_blockIndex = m_txBlockIndex;
-            m_superBlock.m_header.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
+            m_superBlock.m_header.m_sampleBytes = (m_frameSampleFormat << 4) + (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
             m_superBlock.m_header.m_sampleBits = SDR_RX_SAMP_SZ;
             m_dataBlock->m_superBlocks[m_txBlockIndex] = m_superBlock;
 
@@ -311,20 +311,18 @@ QByteArray DaemonSink::serialize() const
 
 bool DaemonSink::deserialize(const QByteArray& data)
 {
-    (void) data;
-    if (m_settings.deserialize(data))
-    {
-        MsgConfigureDaemonSink *msg = MsgConfigureDaemonSink::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return true;
-    }
-    else
-    {
-        m_settings.resetToDefaults();
-        MsgConfigureDaemonSink *msg = MsgConfigureDaemonSink::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return false;
+    DaemonSinkSettings settings;
+    bool success = settings.deserialize(data);
+
+    if (!success) {
+        settings.resetToDefaults();
     }
+
+    // Applied now so that serialize() and the web API see the new settings.
+    // Only the settings that differ from the running ones are applied to the DSP.
+    applySettings(settings, false);
+
+    return success;
 }
 
 void DaemonSink::applySettings(const DaemonSinkSettings& settings, bool force)
@@ -334,6 +332,7 @@ void DaemonSink::applySettings(const DaemonSinkSettings& settings, bool force)
             << " m_txDelay: " << settings.m_txDelay
             << " m_dataAddress: " << settings.m_dataAddress
             << " m_dataPort: " << settings.m_dataPort
+            << " m_sampleFormat: " << settings.m_sampleFormat
             << " force: " << force;
 
     QList<QString> reverseAPIKeys;
@@ -363,6 +362,12 @@ void DaemonSink::applySettings(const DaemonSinkSettings& settings, bool force)
         m_dataPort = settings.m_dataPort;
     }
 
+    if ((m_settings.m_sampleFormat != settings.m_sampleFormat) || force)
+    {
+        setSampleFormat(settings.m_sampleFormat);
+        setTxDelay(settings.m_txDelay, settings.m_nbFECBlocks);
+    }
+
     if ((settings.m_useReverseAPI) && (reverseAPIKeys.size() != 0))
     {
         bool fullUpdate = ((m_settings.m_useReverseAPI != settings.m_useReverseAPI) && settings.m_useReverseAPI) ||
@@ -533,39 +538,12 @@ void DaemonSink::webapiReverseSendSettings(QList<QString>& channelSettingsKeys,
         swgDaemonSinkSettings->setTitle(new QString(settings.m_title));
     }
 
-    QString channelSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/channel/%4/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString channelSettingsPath = QString("/sdrangel/deviceset/%1/channel/%2/settings")
             .arg(settings.m_reverseAPIDeviceIndex)
             .arg(settings.m_reverseAPIChannelIndex);
-    m_networkRequest.setUrl(QUrl(channelSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgChannelSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, channelSettingsPath, swgChannelSettings->asJson());
 
     delete swgChannelSettings;
 }
-
-void DaemonSink::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "DaemonSink::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
-    }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("DaemonSink::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
-}
@@ -25,15 +25,12 @@
 
 #include <QObject>
 #include <QMutex>
-#include <QNetworkRequest>
 
 #include "dsp/basebandsamplesink.h"
 #include "channel/channelsinkapi.h"
 #include "channel/sdrdaemondatablock.h"
 #include "daemonsinksettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class ThreadedBasebandSampleSink;
 class DownChannelizer;
@@ -121,6 +118,7 @@ public:
     void setTxDelay(int txDelay, int nbBlocksFEC);
     void setDataAddress(const QString& address) { m_dataAddress = address; }
     void setDataPort(uint16_t port) { m_dataPort = port; }
+    void setSampleFormat(int sampleFormat) { m_sampleFormat = sampleFormat; }
 
     static const QString m_channelIdURI;
     static const QString m_channelId;
@@ -140,6 +138,9 @@ private:
     int m_txBlockIndex;                  //!< Current index in blocks to transmit in the Tx row
     uint16_t m_frameCount;               //!< transmission frame count
     int m_sampleIndex;                   //!< Current sample index in protected block data
+    int m_frameSampleFormat;             //!< Sample format of the current frame
+    int m_samplesPerBlock;               //!< Samples per block in the current frame sample format
+    Sample m_blockSamples[SDRDaemonMaxSamplesPerBlock]; //!< Samples of the current block before encoding
     SDRDaemonSuperBlock m_superBlock;
     SDRDaemonMetaDataFEC m_currentMetaFEC;
     SDRDaemonDataBlock *m_dataBlock;
@@ -151,15 +152,11 @@ private:
     int m_txDelay;
     QString m_dataAddress;
     uint16_t m_dataPort;
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
+    int m_sampleFormat;
 
     void applySettings(const DaemonSinkSettings& settings, bool force = false);
     void webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& response, const DaemonSinkSettings& settings);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const DaemonSinkSettings& settings, bool force);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif /* INCLUDE_DAEMONSINK_H_ */
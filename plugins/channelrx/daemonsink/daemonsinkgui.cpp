@@ -18,6 +18,7 @@
 #include "device/deviceuiset.h"
 #include "gui/basicchannelsettingsdialog.h"
 #include "mainwindow.h"
+#include "channel/sdrdaemoncodec.h"
 
 #include "daemonsink.h"
 #include "ui_daemonsinkgui.h"
@@ -182,6 +183,7 @@ void DaemonSinkGUI::displaySettings()
     ui->nominalNbBlocksText->setText(tr("%1/%2").arg(s).arg(s1));
     ui->txDelayText->setText(tr("%1%").arg(m_settings.m_txDelay));
     ui->txDelay->setValue(m_settings.m_txDelay);
+    ui->sampleFormat->setCurrentIndex(m_settings.m_sampleFormat);
     updateTxDelayTime();
     blockApplySettings(false);
 }
@@ -300,10 +302,17 @@ void DaemonSinkGUI::on_nbFECBlocks_valueChanged(int value)
     applySettings();
 }
 
+void DaemonSinkGUI::on_sampleFormat_currentIndexChanged(int index)
+{
+    m_settings.m_sampleFormat = index < 0 ? (int) SDRDaemonSampleRaw : index;
+    updateTxDelayTime();
+    applySettings();
+}
+
 void DaemonSinkGUI::updateTxDelayTime()
 {
     double txDelayRatio = m_settings.m_txDelay / 100.0;
-    int samplesPerBlock = SDRDaemonNbBytesPerBlock / sizeof(Sample);
+    int samplesPerBlock = SDRDaemonCodec::getSamplesPerBlock(m_settings.m_sampleFormat, sizeof(FixReal));
     double delay = m_sampleRate == 0 ? 0.0 : (127*samplesPerBlock*txDelayRatio) / m_sampleRate;
     delay /= 128 + m_settings.m_nbFECBlocks;
     ui->txDelayTime->setText(tr("%1µs").arg(QString::number(delay*1e6, 'f', 0)));
@@ -89,6 +89,7 @@ private slots:
     void on_dataApplyButton_clicked(bool checked);
     void on_nbFECBlocks_valueChanged(int value);
     void on_txDelay_valueChanged(int value);
+    void on_sampleFormat_currentIndexChanged(int index);
     void onWidgetRolled(QWidget* widget, bool rollDown);
     void onMenuDialogCalled(const QPoint& p);
     void tick();
@@ -24,6 +24,7 @@
 
 #include "util/simpleserializer.h"
 #include "settings/serializable.h"
+#include "channel/sdrdaemondatablock.h"
 #include "daemonsinksettings.h"
 
 DaemonSinkSettings::DaemonSinkSettings()
@@ -37,6 +38,7 @@ void DaemonSinkSettings::resetToDefaults()
     m_txDelay = 35;
     m_dataAddress = "127.0.0.1";
     m_dataPort = 9090;
+    m_sampleFormat = SDRDaemonSampleRaw;
     m_rgbColor = QColor(140, 4, 4).rgb();
     m_title = "Daemon sink";
     m_channelMarker = nullptr;
@@ -61,6 +63,7 @@ QByteArray DaemonSinkSettings::serialize() const
     s.writeU32(9, m_reverseAPIPort);
     s.writeU32(10, m_reverseAPIDeviceIndex);
     s.writeU32(11, m_reverseAPIChannelIndex);
+    s.writeS32(12, m_sampleFormat);
 
     return s.final();
 }
@@ -115,6 +118,10 @@ bool DaemonSinkSettings::deserialize(const QByteArray& data)
         d.readU32(11, &tmp, 0);
         m_reverseAPIChannelIndex = tmp > 99 ? 99 : tmp;
 
+        int intval;
+        d.readS32(12, &intval, SDRDaemonSampleRaw);
+        m_sampleFormat = (intval < 0) || (intval >= SDRDaemonSampleNbFormats) ? SDRDaemonSampleRaw : intval;
+
         return true;
     }
     else
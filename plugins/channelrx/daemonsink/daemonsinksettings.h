@@ -33,6 +33,7 @@ struct DaemonSinkSettings
     uint32_t m_txDelay;
     QString  m_dataAddress;
     uint16_t m_dataPort;
+    int m_sampleFormat; //!< SDRDaemonSampleFormat of the transmitted samples
     quint32 m_rgbColor;
     QString m_title;
     bool m_useReverseAPI;
@@ -18,9 +18,6 @@
 
 #include <QTime>
 #include <QDebug>
-#include <QNetworkAccessManager>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include <stdio.h>
 #include <complex.h>
@@ -39,6 +36,7 @@
 #include "device/devicesourceapi.h"
 #include "util/db.h"
 #include "util/stepfunctions.h"
+#include "webapi/webapireversedispatcher.h"
 
 MESSAGE_CLASS_DEFINITION(AMDemod::MsgConfigureAMDemod, Message)
 MESSAGE_CLASS_DEFINITION(AMDemod::MsgConfigureChannelizer, Message)
@@ -55,9 +53,7 @@ AMDemod::AMDemod(DeviceSourceAPI *deviceAPI) :
         m_running(false),
         m_squelchOpen(false),
         m_squelchDelayLine(9600),
-        m_magsqSum(0.0f),
-        m_magsqPeak(0.0f),
-        m_magsqCount(0),
+        m_magsqLevels(16),
         m_volumeAGC(0.003),
         m_syncAMAGC(12000, 0.1, 1e-2),
         m_audioFifo(48000),
@@ -88,15 +84,10 @@ AMDemod::AMDemod(DeviceSourceAPI *deviceAPI) :
     m_pllFilt.create(101, m_audioSampleRate, 200.0);
     m_pll.computeCoefficients(0.05, 0.707, 1000);
     m_syncAMBuffIndex = 0;
-
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 AMDemod::~AMDemod()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
 	DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(&m_audioFifo);
     m_deviceAPI->removeChannelAPI(this);
     m_deviceAPI->removeThreadedSink(m_threadedChannelizer);
@@ -116,6 +107,7 @@ void AMDemod::feed(const SampleVector::const_iterator& begin, const SampleVector
     }
 
 	m_settingsMutex.lock();
+	m_channelSamples.clear();
 
 	for (SampleVector::const_iterator it = begin; it != end; ++it)
 	{
@@ -124,11 +116,11 @@ void AMDemod::feed(const SampleVector::const_iterator& begin, const SampleVector
 
 		if (m_interpolatorDistance < 1.0f) // interpolate
 		{
-            processOneSample(ci);
+            m_channelSamples.push_back(ci);
 
 		    while (m_interpolator.interpolate(&m_interpolatorDistanceRemain, c, &ci))
             {
-                processOneSample(ci);
+                m_channelSamples.push_back(ci);
             }
 
             m_interpolatorDistanceRemain += m_interpolatorDistance;
@@ -137,12 +129,14 @@ void AMDemod::feed(const SampleVector::const_iterator& begin, const SampleVector
 		{
 	        if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
 	        {
-	            processOneSample(ci);
+	            m_channelSamples.push_back(ci);
 	            m_interpolatorDistanceRemain += m_interpolatorDistance;
 	        }
 		}
 	}
 
+	processSamples();
+
 	if (m_audioBufferFill > 0)
 	{
 		uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
@@ -158,21 +152,32 @@ void AMDemod::feed(const SampleVector::const_iterator& begin, const SampleVector
 	m_settingsMutex.unlock();
 }
 
-void AMDemod::processOneSample(Complex &ci)
+void AMDemod::processSamples()
 {
-    Real re = ci.real() / SDR_RX_SCALEF;
-    Real im = ci.imag() / SDR_RX_SCALEF;
-    Real magsq = re*re + im*im;
-    m_movingAverage(magsq);
-    m_magsq = m_movingAverage.asDouble();
-    m_magsqSum += magsq;
+    int nbSamples = m_channelSamples.size();
 
-    if (magsq > m_magsqPeak)
+    if (nbSamples == 0) {
+        return;
+    }
+
+    if ((int) m_magsqBuffer.size() < nbSamples)
     {
-        m_magsqPeak = magsq;
+        m_magsqBuffer.resize(nbSamples);
+        m_magsqAverageBuffer.resize(nbSamples);
     }
 
-    m_magsqCount++;
+    m_magsqLevels.feed(&m_channelSamples[0], &m_magsqBuffer[0], &m_magsqAverageBuffer[0], nbSamples, 1.0f / (SDR_RX_SCALEF*SDR_RX_SCALEF));
+
+    for (int i = 0; i < nbSamples; i++) {
+        processOneSample(m_channelSamples[i], m_magsqBuffer[i], m_magsqAverageBuffer[i]);
+    }
+}
+
+void AMDemod::processOneSample(Complex &ci, Real magsq, Real average)
+{
+    Real re = ci.real() / SDR_RX_SCALEF;
+    Real im = ci.imag() / SDR_RX_SCALEF;
+    m_magsq = average;
 
     m_squelchDelayLine.write(magsq);
 
@@ -215,9 +220,11 @@ void AMDemod::processOneSample(Complex &ci)
                 n_out = SSBFilter->runSSB(cs, &sideband, m_settings.m_syncAMOperation == AMDemodSettings::SyncAMUSB, false);
             }
 
+            m_syncAMAGC.feedAndGetValues(sideband, m_syncAMAGCBuff, n_out);
+
             for (int i = 0; i < n_out; i++)
             {
-                float agcVal = m_syncAMAGC.feedAndGetValue(sideband[i]);
+                float agcVal = m_syncAMAGCBuff[i];
                 fftfilt::cmplx z = sideband[i] * agcVal; // * m_syncAMAGC.getStepValue();
 
                 if (m_settings.m_syncAMOperation == AMDemodSettings::SyncAMDSB) {
@@ -539,19 +546,18 @@ QByteArray AMDemod::serialize() const
 
 bool AMDemod::deserialize(const QByteArray& data)
 {
-    if (m_settings.deserialize(data))
-    {
-        MsgConfigureAMDemod *msg = MsgConfigureAMDemod::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return true;
-    }
-    else
-    {
-        m_settings.resetToDefaults();
-        MsgConfigureAMDemod *msg = MsgConfigureAMDemod::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return false;
+    AMDemodSettings settings;
+    bool success = settings.deserialize(data);
+
+    if (!success) {
+        settings.resetToDefaults();
     }
+
+    // Applied now so that serialize() and the web API see the new settings.
+    // Only the settings that differ from the running ones are applied to the DSP.
+    applySettings(settings, false);
+
+    return success;
 }
 
 int AMDemod::webapiSettingsGet(
@@ -712,6 +718,10 @@ void AMDemod::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response)
     response.getAmDemodReport()->setSquelch(m_squelchOpen ? 1 : 0);
     response.getAmDemodReport()->setAudioSampleRate(m_audioSampleRate);
     response.getAmDemodReport()->setChannelSampleRate(m_inputSampleRate);
+
+    if (m_audioFifo.getLatency() >= 0) {
+        response.getAmDemodReport()->setAudioLatency(m_audioFifo.getLatency());
+    }
 }
 
 void AMDemod::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const AMDemodSettings& settings, bool force)
@@ -758,39 +768,12 @@ void AMDemod::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, con
         swgAMDemodSettings->setSyncAmOperation((int) settings.m_syncAMOperation);
     }
 
-    QString channelSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/channel/%4/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString channelSettingsPath = QString("/sdrangel/deviceset/%1/channel/%2/settings")
             .arg(settings.m_reverseAPIDeviceIndex)
             .arg(settings.m_reverseAPIChannelIndex);
-    m_networkRequest.setUrl(QUrl(channelSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgChannelSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, channelSettingsPath, swgChannelSettings->asJson());
 
     delete swgChannelSettings;
 }
-
-void AMDemod::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "AMDemod::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
-    }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("AMDemod::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
-}
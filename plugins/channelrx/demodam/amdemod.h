@@ -19,15 +19,14 @@
 
 #include <vector>
 
-#include <QNetworkRequest>
 #include <QMutex>
 
 #include "dsp/basebandsamplesink.h"
 #include "channel/channelsinkapi.h"
 #include "dsp/nco.h"
 #include "dsp/interpolator.h"
-#include "util/movingaverage.h"
 #include "dsp/agc.h"
+#include "dsp/blockkernels.h"
 #include "dsp/bandpass.h"
 #include "dsp/lowpass.h"
 #include "dsp/phaselockcomplex.h"
@@ -37,8 +36,6 @@
 
 #include "amdemodsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class DownChannelizer;
 class ThreadedBasebandSampleSink;
@@ -131,36 +128,14 @@ public:
 
     void getMagSqLevels(double& avg, double& peak, int& nbSamples)
     {
-        if (m_magsqCount > 0)
-        {
-            m_magsq = m_magsqSum / m_magsqCount;
-            m_magSqLevelStore.m_magsq = m_magsq;
-            m_magSqLevelStore.m_magsqPeak = m_magsqPeak;
-        }
-
-        avg = m_magSqLevelStore.m_magsq;
-        peak = m_magSqLevelStore.m_magsqPeak;
-        nbSamples = m_magsqCount == 0 ? 1 : m_magsqCount;
-
-        m_magsqSum = 0.0f;
-        m_magsqPeak = 0.0f;
-        m_magsqCount = 0;
+        m_magsqLevels.getLevels(avg, peak, nbSamples);
+        m_magsq = avg;
     }
 
     static const QString m_channelIdURI;
     static const QString m_channelId;
 
 private:
-    struct MagSqLevelsStore
-    {
-        MagSqLevelsStore() :
-            m_magsq(1e-12),
-            m_magsqPeak(1e-12)
-        {}
-        double m_magsq;
-        double m_magsqPeak;
-    };
-
 	enum RateState {
 		RSInitialFill,
 		RSRunning
@@ -186,12 +161,7 @@ private:
 	bool m_squelchOpen;
 	DoubleBufferFIFO<Real> m_squelchDelayLine;
 	double m_magsq;
-	double m_magsqSum;
-	double m_magsqPeak;
-	int  m_magsqCount;
-	MagSqLevelsStore m_magSqLevelStore;
-
-	MovingAverageUtil<Real, double, 16> m_movingAverage;
+	MagSqLevels m_magsqLevels; //!< moving average for the squelch and levels for the channel power report
 	SimpleAGC<4800> m_volumeAGC;
     Bandpass<Real> m_bandpass;
     Lowpass<std::complex<float> > m_pllFilt;
@@ -199,18 +169,20 @@ private:
     fftfilt* DSBFilter;
     fftfilt* SSBFilter;
     Real m_syncAMBuff[2*1024];
+    Real m_syncAMAGCBuff[2*1024];
     uint32_t m_syncAMBuffIndex;
     MagAGC m_syncAMAGC;
 
+	std::vector<Complex> m_channelSamples; //!< channel samples of the current feed
+	std::vector<Real> m_magsqBuffer;
+	std::vector<Real> m_magsqAverageBuffer;
+
 	AudioVector m_audioBuffer;
 	uint32_t m_audioBufferFill;
 	AudioFifo m_audioFifo;
 
     static const int m_udpBlockSize;
 
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
-
 	QMutex m_settingsMutex;
 
 	void applyChannelSettings(int inputSampleRate, int inputFrequencyOffset, bool force = false);
@@ -220,11 +192,8 @@ private:
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const AMDemodSettings& settings, bool force);
 
-    void processOneSample(Complex &ci);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
-
+    void processSamples(); //!< block processing of the channel samples of the current feed
+    void processOneSample(Complex &ci, Real magsq, Real average);
 };
 
 #endif // INCLUDE_AMDEMOD_H
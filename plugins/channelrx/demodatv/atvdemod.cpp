@@ -59,6 +59,12 @@ ATVDemod::ATVDemod(DeviceSourceAPI *deviceAPI) :
         m_intRowIndex(0),
         m_intLineIndex(0),
         m_objAvgColIndex(3),
+        m_intFrameBufferIndex(0),
+        m_intFrameCols(0),
+        m_intFrameRows(0),
+        m_ptrCurrentRow(0),
+        m_intFrameCount(0),
+        m_frameOutput(0),
         m_bfoPLL(200/1000000, 100/1000000, 0.01),
         m_bfoFilter(200.0, 1000000.0, 0.9),
         m_interpolatorDistance(1.0f),
@@ -103,11 +109,46 @@ ATVDemod::~ATVDemod()
     delete m_channelizer;
     delete m_DSBFilter;
     delete m_DSBFilterBuffer;
+
+    if (m_frameOutput) {
+        fclose(m_frameOutput);
+    }
 }
 
 void ATVDemod::setTVScreen(TVScreen *objScreen)
 {
+    m_objSettingsMutex.lock();
     m_registeredTVScreen = objScreen;
+
+    if (m_registeredTVScreen && (m_intFrameCols > 0)) {
+        m_registeredTVScreen->resizeTVScreen(m_intFrameCols, m_intFrameRows);
+    }
+
+    m_objSettingsMutex.unlock();
+}
+
+bool ATVDemod::setFrameOutput(const QString& fileName)
+{
+    m_objSettingsMutex.lock();
+
+    if (m_frameOutput)
+    {
+        fclose(m_frameOutput);
+        m_frameOutput = 0;
+    }
+
+    if (!fileName.isEmpty())
+    {
+        m_frameOutput = fopen(fileName.toStdString().c_str(), "wb");
+
+        if (!m_frameOutput) {
+            qWarning("ATVDemod::setFrameOutput: cannot open %s", qPrintable(fileName));
+        }
+    }
+
+    bool success = fileName.isEmpty() || (m_frameOutput != 0);
+    m_objSettingsMutex.unlock();
+    return success;
 }
 
 void ATVDemod::configure(
@@ -170,11 +211,18 @@ void ATVDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
     float fltI;
     float fltQ;
     Complex ci;
+    int nbSamples = 0;
 
     //********** Let's rock and roll buddy ! **********
 
     m_objSettingsMutex.lock();
 
+    if (m_demodInput.size() < (unsigned int) (end - begin))
+    {
+        m_demodInput.resize(end - begin);
+        m_demodOutput.resize(end - begin);
+    }
+
     //********** Accessing ATV Screen context **********
 
 #ifdef EXTENDED_DIRECT_SAMPLE
@@ -218,16 +266,19 @@ void ATVDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
         {
             if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
             {
-                demod(ci);
+                m_demodInput[nbSamples++] = ci;
                 m_interpolatorDistanceRemain += m_interpolatorDistance;
             }
         }
         else
         {
-            demod(c);
+            m_demodInput[nbSamples++] = c;
         }
     }
 
+    demodBlock(nbSamples);
+    processBlock(nbSamples);
+
     if ((m_running.m_intVideoTabIndex == 1) && (m_scopeSink != 0)) // do only if scope tab is selected and scope is available
     {
         m_scopeSink->feed(m_scopeSampleBuffer.begin(), m_scopeSampleBuffer.end(), false); // m_ssb = positive only
@@ -244,203 +295,284 @@ void ATVDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
     m_objSettingsMutex.unlock();
 }
 
-void ATVDemod::demod(Complex& c)
+/**
+ * Demodulates the channel samples of m_demodInput into video levels in m_demodOutput.
+ * The modulation is tested once per block so that each loop only carries its own state.
+ * AM and SSB levels are raw values normalized in processBlock as the normalization
+ * depends on line boundaries.
+ */
+void ATVDemod::demodBlock(int nbSamples)
 {
-    float fltDivSynchroBlack = 1.0f - m_running.m_fltVoltLevelSynchroBlack;
-    float fltNormI;
-    float fltNormQ;
-    float fltNorm;
-    float fltVal;
-    int intVal;
+    Complex *input = m_demodInput.data();
+    float *output = m_demodOutput.data();
+    double magSq;
 
     //********** FFT filtering **********
 
-    if (m_rfRunning.m_blnFFTFiltering)
+    if (m_rfRunning.m_blnFFTFiltering && (m_rfRunning.m_enmModulation != ATV_FM3)) // FM3 works on the unfiltered signal
     {
-        int n_out;
-        fftfilt::cmplx *filtered;
+        for (int i = 0; i < nbSamples; i++)
+        {
+            int n_out;
+            fftfilt::cmplx *filtered;
 
-        n_out = m_DSBFilter->runAsym(c, &filtered, m_rfRunning.m_enmModulation != ATV_LSB); // all usb except explicitely lsb
+            n_out = m_DSBFilter->runAsym(input[i], &filtered, m_rfRunning.m_enmModulation != ATV_LSB); // all usb except explicitely lsb
 
-        if (n_out > 0)
-        {
-            memcpy((void *) m_DSBFilterBuffer, (const void *) filtered, n_out*sizeof(Complex));
-            m_DSBFilterBufferIndex = 0;
-        }
+            if (n_out > 0)
+            {
+                memcpy((void *) m_DSBFilterBuffer, (const void *) filtered, n_out*sizeof(Complex));
+                m_DSBFilterBufferIndex = 0;
+            }
 
-        m_DSBFilterBufferIndex++;
+            m_DSBFilterBufferIndex++;
+            input[i] = m_DSBFilterBuffer[m_DSBFilterBufferIndex-1];
+        }
     }
 
     //********** demodulation **********
 
-    const float& fltI = m_rfRunning.m_blnFFTFiltering ? m_DSBFilterBuffer[m_DSBFilterBufferIndex-1].real() : c.real();
-    const float& fltQ = m_rfRunning.m_blnFFTFiltering ? m_DSBFilterBuffer[m_DSBFilterBufferIndex-1].imag() : c.imag();
-    double magSq;
-
-    if ((m_rfRunning.m_enmModulation == ATV_FM1) || (m_rfRunning.m_enmModulation == ATV_FM2))
+    switch (m_rfRunning.m_enmModulation)
     {
-        //Amplitude FM
-        magSq = fltI*fltI + fltQ*fltQ;
-        m_objMagSqAverage(magSq);
-        fltNorm = sqrt(magSq);
-        fltNormI= fltI/fltNorm;
-        fltNormQ= fltQ/fltNorm;
-
-        //-2 > 2 : 0 -> 1 volt
-        //0->0.3 synchro  0.3->1 image
+    case ATV_FM1:
+    case ATV_FM2:
+    {
+        bool fm1 = m_rfRunning.m_enmModulation == ATV_FM1;
+        float fmDeviation = m_rfRunning.m_fmDeviation;
 
-        if (m_rfRunning.m_enmModulation == ATV_FM1)
+        for (int i = 0; i < nbSamples; i++)
         {
-            //YDiff Cd
-            fltVal = m_fltBufferI[0]*(fltNormQ - m_fltBufferQ[1]);
-            fltVal -= m_fltBufferQ[0]*(fltNormI - m_fltBufferI[1]);
+            //Amplitude FM
+            float fltI = input[i].real();
+            float fltQ = input[i].imag();
+            float fltVal;
+            magSq = fltI*fltI + fltQ*fltQ;
+            m_objMagSqAverage(magSq);
+            float fltNorm = sqrt(magSq);
+            float fltNormI = fltI/fltNorm;
+            float fltNormQ = fltQ/fltNorm;
+
+            //-2 > 2 : 0 -> 1 volt
+            //0->0.3 synchro  0.3->1 image
+
+            if (fm1)
+            {
+                //YDiff Cd
+                fltVal = m_fltBufferI[0]*(fltNormQ - m_fltBufferQ[1]);
+                fltVal -= m_fltBufferQ[0]*(fltNormI - m_fltBufferI[1]);
 
-            fltVal += 2.0f;
-            fltVal /= 4.0f;
+                fltVal += 2.0f;
+                fltVal /= 4.0f;
+            }
+            else
+            {
+                //YDiff Folded
+                fltVal =  m_fltBufferI[2]*((m_fltBufferQ[5]-fltNormQ)/16.0f + m_fltBufferQ[1] - m_fltBufferQ[3]);
+                fltVal -= m_fltBufferQ[2]*((m_fltBufferI[5]-fltNormI)/16.0f + m_fltBufferI[1] - m_fltBufferI[3]);
 
-        }
-        else
-        {
-            //YDiff Folded
-            fltVal =  m_fltBufferI[2]*((m_fltBufferQ[5]-fltNormQ)/16.0f + m_fltBufferQ[1] - m_fltBufferQ[3]);
-            fltVal -= m_fltBufferQ[2]*((m_fltBufferI[5]-fltNormI)/16.0f + m_fltBufferI[1] - m_fltBufferI[3]);
+                fltVal += 2.125f;
+                fltVal /= 4.25f;
 
-            fltVal += 2.125f;
-            fltVal /= 4.25f;
+                m_fltBufferI[5]=m_fltBufferI[4];
+                m_fltBufferQ[5]=m_fltBufferQ[4];
 
-            m_fltBufferI[5]=m_fltBufferI[4];
-            m_fltBufferQ[5]=m_fltBufferQ[4];
+                m_fltBufferI[4]=m_fltBufferI[3];
+                m_fltBufferQ[4]=m_fltBufferQ[3];
 
-            m_fltBufferI[4]=m_fltBufferI[3];
-            m_fltBufferQ[4]=m_fltBufferQ[3];
+                m_fltBufferI[3]=m_fltBufferI[2];
+                m_fltBufferQ[3]=m_fltBufferQ[2];
 
-            m_fltBufferI[3]=m_fltBufferI[2];
-            m_fltBufferQ[3]=m_fltBufferQ[2];
+                m_fltBufferI[2]=m_fltBufferI[1];
+                m_fltBufferQ[2]=m_fltBufferQ[1];
+            }
 
-            m_fltBufferI[2]=m_fltBufferI[1];
-            m_fltBufferQ[2]=m_fltBufferQ[1];
-        }
+            m_fltBufferI[1]=m_fltBufferI[0];
+            m_fltBufferQ[1]=m_fltBufferQ[0];
+
+            m_fltBufferI[0]=fltNormI;
+            m_fltBufferQ[0]=fltNormQ;
 
-        m_fltBufferI[1]=m_fltBufferI[0];
-        m_fltBufferQ[1]=m_fltBufferQ[0];
+            if (fmDeviation != 1.0f)
+            {
+                fltVal = ((fltVal - 0.5f) / fmDeviation) + 0.5f;
+            }
 
-        m_fltBufferI[0]=fltNormI;
-        m_fltBufferQ[0]=fltNormQ;
+            output[i] = fltVal;
+        }
+        break;
+    }
+    case ATV_AM:
+        // magnitudes first in a loop without dependencies so that it can be vectorized
+        for (int i = 0; i < nbSamples; i++) {
+            output[i] = input[i].real()*input[i].real() + input[i].imag()*input[i].imag();
+        }
 
-        if (m_rfRunning.m_fmDeviation != 1.0f)
+        for (int i = 0; i < nbSamples; i++)
         {
-            fltVal = ((fltVal - 0.5f) / m_rfRunning.m_fmDeviation) + 0.5f;
+            //Amplitude AM
+            m_objMagSqAverage(output[i]);
+            output[i] = sqrt(output[i]) / SDR_RX_SCALEF;
         }
-    }
-    else if (m_rfRunning.m_enmModulation == ATV_AM)
+        break;
+    case ATV_USB:
+    case ATV_LSB:
     {
-        //Amplitude AM
-        magSq = fltI*fltI + fltQ*fltQ;
-        m_objMagSqAverage(magSq);
-        fltNorm = sqrt(magSq);
-        fltVal = fltNorm / SDR_RX_SCALEF;
+        bool usb = m_rfRunning.m_enmModulation == ATV_USB;
+
+        for (int i = 0; i < nbSamples; i++)
+        {
+            float fltI = input[i].real();
+            float fltQ = input[i].imag();
+            magSq = fltI*fltI + fltQ*fltQ;
+            m_objMagSqAverage(magSq);
+
+            Real bfoValues[2];
+            float fltFiltered = m_bfoFilter.run(fltI);
+            m_bfoPLL.process(fltFiltered, bfoValues);
 
-        //********** Mini and Maxi Amplitude tracking **********
+            // do the mix
 
-        if(fltVal<m_fltEffMin)
+            float mixI = fltI * bfoValues[0] - fltQ * bfoValues[1];
+            float mixQ = fltI * bfoValues[1] + fltQ * bfoValues[0];
+
+            output[i] = usb ? mixI + mixQ : mixI - mixQ;
+        }
+        break;
+    }
+    case ATV_FM3:
+        for (int i = 0; i < nbSamples; i++)
         {
-            m_fltEffMin=fltVal;
+            float rawDeviation;
+            output[i] = m_objPhaseDiscri.phaseDiscriminatorDelta(input[i], magSq, rawDeviation) + 0.5f;
+            m_objMagSqAverage(magSq);
         }
-
-        if(fltVal>m_fltEffMax)
+        break;
+    default:
+        for (int i = 0; i < nbSamples; i++)
         {
-            m_fltEffMax=fltVal;
+            magSq = input[i].real()*input[i].real() + input[i].imag()*input[i].imag();
+            m_objMagSqAverage(magSq);
+            output[i] = 0.0f;
         }
-
-        //Normalisation
-        fltVal -= m_fltAmpMin;
-        fltVal /=m_fltAmpDelta;
     }
-    else if ((m_rfRunning.m_enmModulation == ATV_USB) || (m_rfRunning.m_enmModulation == ATV_LSB))
+}
+
+/**
+ * Turns the video levels of m_demodOutput into pixels running the synchronization on each of them
+ */
+void ATVDemod::processBlock(int nbSamples)
+{
+    const float *output = m_demodOutput.data();
+    float fltDivSynchroBlack = 1.0f - m_running.m_fltVoltLevelSynchroBlack;
+    bool ampTracking = (m_rfRunning.m_enmModulation == ATV_AM)
+        || (m_rfRunning.m_enmModulation == ATV_USB)
+        || (m_rfRunning.m_enmModulation == ATV_LSB);
+    bool invert = m_running.m_blnInvertVideo;
+    bool scope = (m_running.m_intVideoTabIndex == 1) && (m_scopeSink != 0); // feed scope buffer only if scope is present and visible
+    bool hSkip = m_running.m_enmATVStandard == ATVStdHSkip;
+    float fltVal;
+    int intVal;
+
+    for (int i = 0; i < nbSamples; i++)
     {
-        magSq = fltI*fltI + fltQ*fltQ;
-        m_objMagSqAverage(magSq);
-        fltNorm = sqrt(magSq);
+        fltVal = output[i];
 
-        Real bfoValues[2];
-        float fltFiltered = m_bfoFilter.run(fltI);
-        m_bfoPLL.process(fltFiltered, bfoValues);
+        if (ampTracking)
+        {
+            //********** Mini and Maxi Amplitude tracking **********
 
-        // do the mix
+            if(fltVal<m_fltEffMin)
+            {
+                m_fltEffMin=fltVal;
+            }
 
-        float mixI = fltI * bfoValues[0] - fltQ * bfoValues[1];
-        float mixQ = fltI * bfoValues[1] + fltQ * bfoValues[0];
+            if(fltVal>m_fltEffMax)
+            {
+                m_fltEffMax=fltVal;
+            }
 
-        if (m_rfRunning.m_enmModulation == ATV_USB) {
-            fltVal = (mixI + mixQ);
-        } else {
-            fltVal = (mixI - mixQ);
+            //Normalisation
+            fltVal -= m_fltAmpMin;
+            fltVal /=m_fltAmpDelta;
         }
 
-        //********** Mini and Maxi Amplitude tracking **********
+        fltVal = invert ? 1.0f - fltVal : fltVal;
+        fltVal = (fltVal < -1.0f) ? -1.0f : (fltVal > 1.0f) ? 1.0f : fltVal;
 
-        if(fltVal<m_fltEffMin)
-        {
-            m_fltEffMin=fltVal;
+        if (scope) {
+            m_scopeSampleBuffer.push_back(Sample(fltVal*SDR_RX_SCALEF, 0.0f));
         }
 
-        if(fltVal>m_fltEffMax)
+        m_fltAmpLineAverage += fltVal;
+
+        //********** gray level **********
+        //-0.3 -> 0.7
+        intVal = (int) 255.0*(fltVal - m_running.m_fltVoltLevelSynchroBlack) / fltDivSynchroBlack;
+
+        //0 -> 255
+        if(intVal<0)
+        {
+            intVal=0;
+        }
+        else if(intVal>255)
         {
-            m_fltEffMax=fltVal;
+            intVal=255;
         }
 
-        //Normalisation
-        fltVal -= m_fltAmpMin;
-        fltVal /=m_fltAmpDelta;
-    }
-    else if (m_rfRunning.m_enmModulation == ATV_FM3)
-    {
-        float rawDeviation;
-        fltVal = m_objPhaseDiscri.phaseDiscriminatorDelta(c, magSq, rawDeviation) + 0.5f;
-        //fltVal = fltVal < 0.0f ? 0.0f : fltVal > 1.0f ? 1.0f : fltVal;
-        m_objMagSqAverage(magSq);
-        fltNorm = sqrt(magSq);
+        //********** process video sample **********
+
+        if (hSkip) {
+            processHSkip(fltVal, intVal);
+        } else {
+            processClassic(fltVal, intVal);
+        }
     }
-    else
-    {
-        magSq = fltI*fltI + fltQ*fltQ;
-        m_objMagSqAverage(magSq);
-        fltNorm = sqrt(magSq);
-        fltVal = 0.0f;
+}
+
+void ATVDemod::resizeFrame(int intCols, int intRows)
+{
+    m_intFrameCols = intCols < 0 ? 0 : intCols;
+    m_intFrameRows = intRows < 0 ? 0 : intRows;
+
+    for (int i = 0; i < 2; i++) {
+        m_frameBuffers[i].assign(m_intFrameCols * m_intFrameRows, 0);
     }
 
-    fltVal = m_running.m_blnInvertVideo ? 1.0f - fltVal : fltVal;
-    fltVal = (fltVal < -1.0f) ? -1.0f : (fltVal > 1.0f) ? 1.0f : fltVal;
+    m_intFrameBufferIndex = 0;
+    m_ptrCurrentRow = 0;
 
-    if ((m_running.m_intVideoTabIndex == 1) && (m_scopeSink != 0)) { // feed scope buffer only if scope is present and visible
-        m_scopeSampleBuffer.push_back(Sample(fltVal*SDR_RX_SCALEF, 0.0f));
+    if (m_registeredTVScreen) {
+        m_registeredTVScreen->resizeTVScreen(m_intFrameCols, m_intFrameRows);
     }
+}
 
-    m_fltAmpLineAverage += fltVal;
+/**
+ * Hands over the frame being written to the screen and/or the frame output then swaps buffers.
+ * The screen copies it under its own lock and uploads the copy in one go on its next paint
+ * while the next frame is written in the other buffer.
+ */
+void ATVDemod::renderFrame()
+{
+    std::vector<unsigned char>& frame = m_frameBuffers[m_intFrameBufferIndex];
 
-    //********** gray level **********
-    //-0.3 -> 0.7
-    intVal = (int) 255.0*(fltVal - m_running.m_fltVoltLevelSynchroBlack) / fltDivSynchroBlack;
+    if (frame.size() == 0) {
+        return;
+    }
 
-    //0 -> 255
-    if(intVal<0)
-    {
-        intVal=0;
+    if (m_registeredTVScreen) {
+        m_registeredTVScreen->renderGreyImage(frame.data(), m_intFrameCols, m_intFrameRows);
     }
-    else if(intVal>255)
+
+    if (m_frameOutput)
     {
-        intVal=255;
+        fprintf(m_frameOutput, "P5\n%d %d\n255\n", m_intFrameCols, m_intFrameRows);
+        fwrite(frame.data(), 1, frame.size(), m_frameOutput);
     }
 
-    //********** process video sample **********
+    m_intFrameCount++;
+    m_intFrameBufferIndex = 1 - m_intFrameBufferIndex;
 
-    if (m_registeredTVScreen) // can process only if the screen is available (set via the GUI)
-    {
-        if (m_running.m_enmATVStandard == ATVStdHSkip) {
-            processHSkip(fltVal, intVal);
-        } else {
-            processClassic(fltVal, intVal);
-        }
+    if (m_ptrCurrentRow) { // keep writing the same row but in the other buffer
+        m_ptrCurrentRow = m_frameBuffers[m_intFrameBufferIndex].data() + (m_ptrCurrentRow - frame.data());
     }
 }
 
@@ -610,13 +742,8 @@ void ATVDemod::applySettings()
         m_configPrivate.m_intNumberSamplePerLine = (int) (m_config.m_fltLineDuration * m_config.m_intSampleRate);
         m_intNumberSamplePerTop = (int) (m_config.m_fltTopDuration * m_config.m_intSampleRate);
 
-        if (m_registeredTVScreen)
-        {
-            //m_registeredTVScreen->setRenderImmediate(!(m_config.m_fltFramePerS > 25.0f));
-            m_registeredTVScreen->resizeTVScreen(
-                    m_configPrivate.m_intNumberSamplePerLine - m_intNumberSamplePerLineSignals,
-                    m_intNumberOfLines - m_intNumberOfBlackLines);
-        }
+        resizeFrame(m_configPrivate.m_intNumberSamplePerLine - m_intNumberSamplePerLineSignals,
+                m_intNumberOfLines - m_intNumberOfBlackLines);
 
         qDebug() << "ATVDemod::applySettings:"
                 << " m_fltLineDuration: " << m_config.m_fltLineDuration
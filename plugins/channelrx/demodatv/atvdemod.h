@@ -21,6 +21,7 @@
 #include <QMutex>
 #include <QElapsedTimer>
 #include <vector>
+#include <stdio.h>
 
 #include "dsp/basebandsamplesink.h"
 #include "channel/channelsinkapi.h"
@@ -233,6 +234,8 @@ public:
     virtual bool deserialize(const QByteArray& data) { (void) data; return false; }
 
     void setTVScreen(TVScreen *objScreen); //!< set by the GUI
+    bool setFrameOutput(const QString& fileName); //!< stream frames as binary PGM images to file (empty name to stop). Works without screen.
+    int getNbFrames() const { return m_intFrameCount; }
     int getSampleRate();
     int getEffectiveSampleRate();
     double getMagSq() const { return m_objMagSqAverage; } //!< Beware this is scaled to 2^30
@@ -456,6 +459,21 @@ private:
 
     SampleVector m_sampleBuffer;
 
+    //*************** BLOCK PROCESSING  ***************
+
+    std::vector<Complex> m_demodInput;  //!< channel samples of the current block after NCO and decimation
+    std::vector<float> m_demodOutput;   //!< video levels of the current block before line processing
+
+    //*************** FRAME  ***************
+
+    std::vector<unsigned char> m_frameBuffers[2]; //!< grey levels frame double buffer: one written while the other is displayed
+    int m_intFrameBufferIndex;          //!< index of the buffer being written
+    int m_intFrameCols;
+    int m_intFrameRows;
+    unsigned char *m_ptrCurrentRow;     //!< row being written or null if out of the frame
+    int m_intFrameCount;                //!< number of frames rendered
+    FILE *m_frameOutput;                //!< headless frame output
+
     //*************** RF  ***************
 
     MovingAverageUtil<double, double, 32> m_objMagSqAverage;
@@ -493,12 +511,32 @@ private:
 
     void applySettings();
     void applyStandard();
-    void demod(Complex& c);
     static float getRFBandwidthDivisor(ATVModulation modulation);
 
+    void demodBlock(int nbSamples);
+    void processBlock(int nbSamples);
+    void resizeFrame(int intCols, int intRows);
+    void renderFrame();
+
+    inline void selectRow(int intRow)
+    {
+        if ((intRow >= 0) && (intRow < m_intFrameRows)) {
+            m_ptrCurrentRow = &m_frameBuffers[m_intFrameBufferIndex][intRow * m_intFrameCols];
+        } else {
+            m_ptrCurrentRow = 0;
+        }
+    }
+
+    inline void setPixel(int intCol, int intVal)
+    {
+        if ((m_ptrCurrentRow != 0) && (intCol >= 0) && (intCol < m_intFrameCols)) {
+            m_ptrCurrentRow[intCol] = (unsigned char) intVal;
+        }
+    }
+
     inline void processHSkip(float& fltVal, int& intVal)
     {
-        m_registeredTVScreen->setDataColor(m_intColIndex - m_intNumberSaplesPerHSync + m_intNumberSamplePerTop, intVal, intVal, intVal);
+        setPixel(m_intColIndex - m_intNumberSaplesPerHSync + m_intNumberSamplePerTop, intVal);
 
         // Horizontal Synchro detection
 
@@ -523,7 +561,7 @@ private:
             {
                 //qDebug("VSync: %d %d %d", m_intColIndex, m_intSampleIndex, m_intLineIndex);
                 m_intAvgColIndex = m_intColIndex;
-                m_registeredTVScreen->renderImage(0);
+                renderFrame();
 
                 m_intImageIndex++;
                 m_intLineIndex = 0;
@@ -571,7 +609,7 @@ private:
                 m_fltEffMax = -2000000.0f;
             }
 
-            m_registeredTVScreen->selectRow(m_intRowIndex);
+            selectRow(m_intRowIndex);
             m_intLineIndex++;
             m_intRowIndex++;
         }
@@ -659,7 +697,7 @@ private:
 
             if (m_intRowIndex < m_intNumberOfLines)
             {
-                m_registeredTVScreen->selectRow(m_intRowIndex - m_intNumberOfSyncLines);
+                selectRow(m_intRowIndex - m_intNumberOfSyncLines);
             }
 
             m_intLineIndex++;
@@ -668,7 +706,7 @@ private:
         // Filling pixels
 
         // +4 is to compensate shift due to hsync amortizing factor of 1/4
-        m_registeredTVScreen->setDataColor(m_intColIndex - m_intNumberSaplesPerHSync + m_intNumberSamplePerTop + 4, intVal, intVal, intVal);
+        setPixel(m_intColIndex - m_intNumberSaplesPerHSync + m_intNumberSamplePerTop + 4, intVal);
         m_intColIndex++;
 
         // Vertical sync and image rendering
@@ -687,7 +725,7 @@ private:
 
                         if ((m_intLineIndex % 2 == 0) || !m_interleaved) // even => odd image
                         {
-                            m_registeredTVScreen->renderImage(0);
+                            renderFrame();
                             m_intRowIndex = 1;
                         }
                         else
@@ -695,7 +733,7 @@ private:
                             m_intRowIndex = 0;
                         }
 
-                        m_registeredTVScreen->selectRow(m_intRowIndex - m_intNumberOfSyncLines);
+                        selectRow(m_intRowIndex - m_intNumberOfSyncLines);
                         m_intLineIndex = 0;
                         m_intImageIndex++;
                     }
@@ -712,7 +750,7 @@ private:
             {
                 if (m_intImageIndex % 2 == 1) // odd image
                 {
-                    m_registeredTVScreen->renderImage(0);
+                    renderFrame();
 
                     if (m_rfRunning.m_enmModulation == ATV_AM)
                     {
@@ -737,7 +775,7 @@ private:
                     m_intRowIndex = 0;
                 }
 
-                m_registeredTVScreen->selectRow(m_intRowIndex - m_intNumberOfSyncLines);
+                selectRow(m_intRowIndex - m_intNumberOfSyncLines);
                 m_intLineIndex = 0;
                 m_intImageIndex++;
             }
@@ -17,13 +17,11 @@
 
 #include "boost/format.hpp"
 #include <stdio.h>
+#include <string.h>
 #include <complex.h>
 
 #include <QTime>
 #include <QDebug>
-#include <QNetworkAccessManager>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include "SWGChannelSettings.h"
 #include "SWGBFMDemodSettings.h"
@@ -38,6 +36,7 @@
 #include "dsp/dspcommands.h"
 #include "device/devicesourceapi.h"
 #include "util/db.h"
+#include "webapi/webapireversedispatcher.h"
 
 #include "rdsparser.h"
 #include "bfmdemod.h"
@@ -50,6 +49,7 @@ const QString BFMDemod::m_channelIdURI = "sdrangel.channel.bfm";
 const QString BFMDemod::m_channelId = "BFMDemod";
 const Real BFMDemod::default_deemphasis = 50.0; // 50 us
 const int BFMDemod::m_udpBlockSize = 512;
+const int BFMDemod::m_rdsSampleRate = 31250; // RDS demod biphase integration rate
 
 BFMDemod::BFMDemod(DeviceSourceAPI *deviceAPI) :
         ChannelSinkAPI(m_channelIdURI),
@@ -81,6 +81,8 @@ BFMDemod::BFMDemod(DeviceSourceAPI *deviceAPI) :
 
     m_interpolatorRDSDistance = 0.0f;
     m_interpolatorRDSDistanceRemain = 0.0f;
+    m_rdsDemod.setSampleRate(m_rdsSampleRate);
+    memset(m_pilotPLLSamples, 0, sizeof(m_pilotPLLSamples));
 
     m_interpolatorStereoDistance = 0.0f;
     m_interpolatorStereoDistanceRemain = 0.0f;
@@ -104,16 +106,10 @@ BFMDemod::BFMDemod(DeviceSourceAPI *deviceAPI) :
     m_threadedChannelizer = new ThreadedBasebandSampleSink(m_channelizer, this);
     m_deviceAPI->addThreadedSink(m_threadedChannelizer);
     m_deviceAPI->addChannelAPI(this);
-
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 BFMDemod::~BFMDemod()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
-
 	DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(&m_audioFifo);
 
 	m_deviceAPI->removeChannelAPI(this);
@@ -126,7 +122,7 @@ BFMDemod::~BFMDemod()
 void BFMDemod::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool firstOfBurst)
 {
     (void) firstOfBurst;
-	Complex ci, cs, cr;
+	Complex ci, cs;
 	fftfilt::cmplx *rf;
 	int rf_out;
 	double msq;
@@ -177,24 +173,12 @@ void BFMDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 				m_sampleBuffer.push_back(Sample(demod * SDR_RX_SCALEF, 0.0));
 			}
 
-			if (m_settings.m_rdsActive)
-			{
-				//Complex r(demod * 2.0 * std::cos(3.0 * m_pilotPLLSamples[3]), 0.0);
-				Complex r(demod * 2.0 * std::cos(3.0 * m_pilotPLLSamples[3]), 0.0);
-
-				if (m_interpolatorRDS.decimate(&m_interpolatorRDSDistanceRemain, r, &cr))
-				{
-					bool bit;
-
-					if (m_rdsDemod.process(cr.real(), bit))
-					{
-						if (m_rdsDecoder.frameSync(bit)) {
-						    m_rdsParser.parseGroup(m_rdsDecoder.getGroup());
-						}
-					}
+			if (m_settings.m_audioStereo || m_settings.m_rdsActive) { // pilot is needed for stereo and RDS subcarriers
+				m_pilotPLL.process(demod, m_pilotPLLSamples);
+			}
 
-					m_interpolatorRDSDistanceRemain += m_interpolatorRDSDistance;
-				}
+			if (m_settings.m_rdsActive) { // mix down with 3f pilot of this sample. RDS is processed on the whole block afterwards
+				m_rdsBuffer.push_back(demod * 2.0 * m_pilotPLLSamples[4]);
 			}
 
 			Real sampleStereo = 0.0f;
@@ -203,8 +187,6 @@ void BFMDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 
 			if (m_settings.m_audioStereo)
 			{
-				m_pilotPLL.process(demod, m_pilotPLLSamples);
-
 				if (m_settings.m_showPilot) {
 					m_sampleBuffer.push_back(Sample(m_pilotPLLSamples[1] * SDR_RX_SCALEF, 0.0)); // debug 38 kHz pilot
 				}
@@ -282,6 +264,10 @@ void BFMDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 		m_audioBufferFill = 0;
 	}
 
+	if (m_rdsBuffer.size() > 0) {
+		processRDS();
+	}
+
 	if (m_sampleSink != 0) {
 		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end(), true);
 	}
@@ -291,6 +277,33 @@ void BFMDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 	m_settingsMutex.unlock();
 }
 
+/**
+ * Decimates the RDS baseband signal of the block down to the RDS demod rate then demodulates and decodes it
+ */
+void BFMDemod::processRDS()
+{
+	Complex cr;
+
+	for (std::vector<Real>::const_iterator it = m_rdsBuffer.begin(); it != m_rdsBuffer.end(); ++it)
+	{
+		if (m_interpolatorRDS.decimate(&m_interpolatorRDSDistanceRemain, Complex(*it, 0.0), &cr))
+		{
+			bool bit;
+
+			if (m_rdsDemod.process(cr.real(), bit))
+			{
+				if (m_rdsDecoder.frameSync(bit)) {
+					m_rdsParser.parseGroup(m_rdsDecoder.getGroup());
+				}
+			}
+
+			m_interpolatorRDSDistanceRemain += m_interpolatorRDSDistance;
+		}
+	}
+
+	m_rdsBuffer.clear();
+}
+
 void BFMDemod::start()
 {
 	m_squelchState = 0;
@@ -430,9 +443,9 @@ void BFMDemod::applyChannelSettings(int inputSampleRate, int inputFrequencyOffse
         m_interpolatorStereoDistanceRemain = (Real) inputSampleRate / m_audioSampleRate;
         m_interpolatorStereoDistance =  (Real) inputSampleRate / (Real) m_audioSampleRate;
 
-        m_interpolatorRDS.create(4, inputSampleRate, 600.0);
-        m_interpolatorRDSDistanceRemain = (Real) inputSampleRate / 250000.0;
-        m_interpolatorRDSDistance =  (Real) inputSampleRate / 250000.0;
+        RDSDemod::createDecimator(m_interpolatorRDS, inputSampleRate, m_rdsSampleRate);
+        m_interpolatorRDSDistanceRemain = (Real) inputSampleRate / m_rdsSampleRate;
+        m_interpolatorRDSDistance =  (Real) inputSampleRate / m_rdsSampleRate;
 
         Real lowCut = -(m_settings.m_rfBandwidth / 2.0) / inputSampleRate;
         Real hiCut  = (m_settings.m_rfBandwidth / 2.0) / inputSampleRate;
@@ -501,9 +514,9 @@ void BFMDemod::applySettings(const BFMDemodSettings& settings, bool force)
         m_interpolatorStereoDistanceRemain = (Real) m_inputSampleRate / m_audioSampleRate;
         m_interpolatorStereoDistance =  (Real) m_inputSampleRate / (Real) m_audioSampleRate;
 
-        m_interpolatorRDS.create(4, m_inputSampleRate, 600.0);
-        m_interpolatorRDSDistanceRemain = (Real) m_inputSampleRate / 250000.0;
-        m_interpolatorRDSDistance =  (Real) m_inputSampleRate / 250000.0;
+        RDSDemod::createDecimator(m_interpolatorRDS, m_inputSampleRate, m_rdsSampleRate);
+        m_interpolatorRDSDistanceRemain = (Real) m_inputSampleRate / m_rdsSampleRate;
+        m_interpolatorRDSDistance =  (Real) m_inputSampleRate / m_rdsSampleRate;
 
         m_lowpass.create(21, m_audioSampleRate, settings.m_afBandwidth);
 
@@ -561,19 +574,18 @@ QByteArray BFMDemod::serialize() const
 
 bool BFMDemod::deserialize(const QByteArray& data)
 {
-    if (m_settings.deserialize(data))
-    {
-        MsgConfigureBFMDemod *msg = MsgConfigureBFMDemod::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return true;
-    }
-    else
-    {
-        m_settings.resetToDefaults();
-        MsgConfigureBFMDemod *msg = MsgConfigureBFMDemod::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return false;
+    BFMDemodSettings settings;
+    bool success = settings.deserialize(data);
+
+    if (!success) {
+        settings.resetToDefaults();
     }
+
+    // Applied now so that serialize() and the web API see the new settings.
+    // Only the settings that differ from the running ones are applied to the DSP.
+    applySettings(settings, false);
+
+    return success;
 }
 
 int BFMDemod::webapiSettingsGet(
@@ -821,39 +833,12 @@ void BFMDemod::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, co
         swgBFMDemodSettings->setAudioDeviceName(new QString(settings.m_audioDeviceName));
     }
 
-    QString channelSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/channel/%4/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString channelSettingsPath = QString("/sdrangel/deviceset/%1/channel/%2/settings")
             .arg(settings.m_reverseAPIDeviceIndex)
             .arg(settings.m_reverseAPIChannelIndex);
-    m_networkRequest.setUrl(QUrl(channelSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgChannelSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, channelSettingsPath, swgChannelSettings->asJson());
 
     delete swgChannelSettings;
 }
-
-void BFMDemod::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "BFMDemod::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
-    }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("BFMDemod::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
-}
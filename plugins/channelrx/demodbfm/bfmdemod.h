@@ -21,7 +21,6 @@
 #include <vector>
 
 #include <QMutex>
-#include <QNetworkRequest>
 
 #include "dsp/basebandsamplesink.h"
 #include "channel/channelsinkapi.h"
@@ -41,8 +40,6 @@
 #include "rdsdemod.h"
 #include "bfmdemodsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class ThreadedBasebandSampleSink;
 class DownChannelizer;
@@ -229,9 +226,11 @@ private:
 	Real m_interpolatorStereoDistance;
 	Real m_interpolatorStereoDistanceRemain;
 
-	Interpolator m_interpolatorRDS; //!< Twin Interpolator for stereo subcarrier
+	Interpolator m_interpolatorRDS; //!< Decimator of RDS subcarrier down to RDS demod rate
 	Real m_interpolatorRDSDistance;
 	Real m_interpolatorRDSDistanceRemain;
+	std::vector<Real> m_rdsBuffer;  //!< RDS subcarrier mixed to baseband for the current block
+	static const int m_rdsSampleRate;
 
 	Lowpass<Real> m_lowpass;
 	fftfilt* m_rfFilter;
@@ -257,7 +256,7 @@ private:
 	QMutex m_settingsMutex;
 
 	RDSPhaseLock m_pilotPLL;
-	Real m_pilotPLLSamples[4];
+	Real m_pilotPLLSamples[5];
 
 	RDSDemod m_rdsDemod;
 	RDSDecoder m_rdsDecoder;
@@ -274,20 +273,15 @@ private:
 
     static const int m_udpBlockSize;
 
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
-
 	void applyAudioSampleRate(int sampleRate);
     void applyChannelSettings(int inputSampleRate, int inputFrequencyOffset, bool force = false);
 	void applySettings(const BFMDemodSettings& settings, bool force = false);
+	void processRDS();
 
     void webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& response, const BFMDemodSettings& settings);
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiFormatRDSReport(SWGSDRangel::SWGRDSReport *report);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const BFMDemodSettings& settings, bool force);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif // INCLUDE_BFMDEMOD_H
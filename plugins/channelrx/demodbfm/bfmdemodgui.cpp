@@ -586,23 +586,23 @@ void BFMDemodGUI::rdsUpdate(bool force)
 	ui->fclkText->setText(QString("%1 Hz").arg(m_bfmDemod->getDemodFclk(), 0, 'f', 2));
 
 	if (m_bfmDemod->getDecoderSynced()) {
-		ui->decoderQLabel->setStyleSheet("QLabel { background-color : green; }");
+		setLabelActive(ui->decoderQLabel, true);
 	} else {
-		ui->decoderQLabel->setStyleSheet("QLabel { background:rgb(79,79,79); }");
+		setLabelActive(ui->decoderQLabel, false);
 	}
 
 	// PI group
 	if (m_bfmDemod->getRDSParser().m_pi_updated || force)
 	{
-		ui->piLabel->setStyleSheet("QLabel { background-color : green; }");
+		setLabelActive(ui->piLabel, true);
 		ui->piCountText->setNum((int) m_bfmDemod->getRDSParser().m_pi_count);
 		QString pistring(str(boost::format("%04X") % m_bfmDemod->getRDSParser().m_pi_program_identification).c_str());
 		ui->piText->setText(pistring);
 
 		if (m_bfmDemod->getRDSParser().m_pi_traffic_program) {
-			ui->piTPIndicator->setStyleSheet("QLabel { background-color : green; }");
+			setLabelActive(ui->piTPIndicator, true);
 		} else {
-			ui->piTPIndicator->setStyleSheet("QLabel { background:rgb(79,79,79); }");
+			setLabelActive(ui->piTPIndicator, false);
 		}
 
 		ui->piType->setText(QString(m_bfmDemod->getRDSParser().pty_table[m_bfmDemod->getRDSParser().m_pi_program_type].c_str()));
@@ -610,13 +610,13 @@ void BFMDemodGUI::rdsUpdate(bool force)
 	}
 	else
 	{
-		ui->piLabel->setStyleSheet("QLabel { background:rgb(79,79,79); }");
+		setLabelActive(ui->piLabel, false);
 	}
 
 	// G0 group
 	if (m_bfmDemod->getRDSParser().m_g0_updated || force)
 	{
-		ui->g00Label->setStyleSheet("QLabel { background-color : green; }");
+		setLabelActive(ui->g00Label, true);
 		ui->g00CountText->setNum((int) m_bfmDemod->getRDSParser().m_g0_count);
 
 		if (m_bfmDemod->getRDSParser().m_g0_psn_bitmap == 0b1111) {
@@ -624,9 +624,9 @@ void BFMDemodGUI::rdsUpdate(bool force)
 		}
 
 		if (m_bfmDemod->getRDSParser().m_g0_traffic_announcement) {
-			ui->g00TrafficAnnouncement->setStyleSheet("QLabel { background-color : green; }");
+			setLabelActive(ui->g00TrafficAnnouncement, true);
 		} else {
-			ui->g00TrafficAnnouncement->setStyleSheet("QLabel { background:rgb(79,79,79); }");
+			setLabelActive(ui->g00TrafficAnnouncement, false);
 		}
 
 		ui->g00MusicSpeech->setText(QString((m_bfmDemod->getRDSParser().m_g0_music_speech ? "Music" : "Speech")));
@@ -651,13 +651,13 @@ void BFMDemodGUI::rdsUpdate(bool force)
 	}
 	else
 	{
-		ui->g00Label->setStyleSheet("QLabel { background:rgb(79,79,79); }");
+		setLabelActive(ui->g00Label, false);
 	}
 
 	// G1 group
 	if (m_bfmDemod->getRDSParser().m_g1_updated || force)
 	{
-		ui->g01Label->setStyleSheet("QLabel { background-color : green; }");
+		setLabelActive(ui->g01Label, true);
 		ui->g01CountText->setNum((int) m_bfmDemod->getRDSParser().m_g1_count);
 
 		if ((m_bfmDemod->getRDSParser().m_g1_country_page_index >= 0) && (m_bfmDemod->getRDSParser().m_g1_country_index >= 0)) {
@@ -672,38 +672,38 @@ void BFMDemodGUI::rdsUpdate(bool force)
 	}
 	else
 	{
-		ui->g01Label->setStyleSheet("QLabel { background:rgb(79,79,79); }");
+		setLabelActive(ui->g01Label, false);
 	}
 
 	// G2 group
 	if (m_bfmDemod->getRDSParser().m_g2_updated || force)
 	{
-		ui->g02Label->setStyleSheet("QLabel { background-color : green; }");
+		setLabelActive(ui->g02Label, true);
 		ui->g02CountText->setNum((int) m_bfmDemod->getRDSParser().m_g2_count);
 		ui->go2Text->setText(QString(m_bfmDemod->getRDSParser().m_g2_radiotext));
 	}
 	else
 	{
-		ui->g02Label->setStyleSheet("QLabel { background:rgb(79,79,79); }");
+		setLabelActive(ui->g02Label, false);
 	}
 
 	// G3 group
 	if (m_bfmDemod->getRDSParser().m_g3_updated || force)
 	{
-		ui->g03Label->setStyleSheet("QLabel { background-color : green; }");
+		setLabelActive(ui->g03Label, true);
 		ui->g03CountText->setNum((int) m_bfmDemod->getRDSParser().m_g3_count);
 		std::string g3str = str(boost::format("%02X%c %04X %04X") % m_bfmDemod->getRDSParser().m_g3_appGroup % (m_bfmDemod->getRDSParser().m_g3_groupB ? 'B' : 'A') % m_bfmDemod->getRDSParser().m_g3_message % m_bfmDemod->getRDSParser().m_g3_aid);
 		ui->g03Data->setText(QString(g3str.c_str()));
 	}
 	else
 	{
-		ui->g03Label->setStyleSheet("QLabel { background:rgb(79,79,79); }");
+		setLabelActive(ui->g03Label, false);
 	}
 
 	// G4 group
 	if (m_bfmDemod->getRDSParser().m_g4_updated || force)
 	{
-		ui->g04Label->setStyleSheet("QLabel { background-color : green; }");
+		setLabelActive(ui->g04Label, true);
 		ui->g04CountText->setNum((int) m_bfmDemod->getRDSParser().m_g4_count);
 		std::string time = str(boost::format("%4i-%02i-%02i %02i:%02i (%+.1fh)")\
 			% (1900 + m_bfmDemod->getRDSParser().m_g4_year) % m_bfmDemod->getRDSParser().m_g4_month % m_bfmDemod->getRDSParser().m_g4_day % m_bfmDemod->getRDSParser().m_g4_hours % m_bfmDemod->getRDSParser().m_g4_minutes % m_bfmDemod->getRDSParser().m_g4_local_time_offset);
@@ -711,7 +711,7 @@ void BFMDemodGUI::rdsUpdate(bool force)
 	}
 	else
 	{
-		ui->g04Label->setStyleSheet("QLabel { background:rgb(79,79,79); }");
+		setLabelActive(ui->g04Label, false);
 	}
 
 	// G5 group
@@ -735,14 +735,13 @@ void BFMDemodGUI::rdsUpdate(bool force)
 	// G8 group
 	if (m_bfmDemod->getRDSParser().m_g8_updated || force)
 	{
-		ui->g08Label->setStyleSheet("QLabel { background-color : green; }");
+		setLabelActive(ui->g08Label, true);
 		ui->g08CountText->setNum((int) m_bfmDemod->getRDSParser().m_g8_count);
 
 		std::ostringstream os;
 		os << (m_bfmDemod->getRDSParser().m_g8_sign ? "-" : "+") << m_bfmDemod->getRDSParser().m_g8_extent + 1;
 		ui->g08Extent->setText(QString(os.str().c_str()));
-		int event_line = RDSTMC::get_tmc_event_code_index(m_bfmDemod->getRDSParser().m_g8_event, 1);
-		ui->g08TMCEvent->setText(QString(RDSTMC::get_tmc_events(event_line, 1).c_str()));
+		ui->g08TMCEvent->setText(QString(RDSTMC::get_tmc_event_text(m_bfmDemod->getRDSParser().m_g8_event)));
 		QString pistring(str(boost::format("%04X") % m_bfmDemod->getRDSParser().m_g8_location).c_str());
 		ui->g08Location->setText(pistring);
 
@@ -754,20 +753,20 @@ void BFMDemodGUI::rdsUpdate(bool force)
 	}
 	else
 	{
-		ui->g08Label->setStyleSheet("QLabel { background:rgb(79,79,79); }");
+		setLabelActive(ui->g08Label, false);
 	}
 
 	// G9 group
 	if (m_bfmDemod->getRDSParser().m_g9_updated || force)
 	{
-		ui->g09Label->setStyleSheet("QLabel { background-color : green; }");
+		setLabelActive(ui->g09Label, true);
 		ui->g09CountText->setNum((int) m_bfmDemod->getRDSParser().m_g9_count);
 		std::string g9str = str(boost::format("%02X %04X %04X %02X %04X") % m_bfmDemod->getRDSParser().m_g9_varA % m_bfmDemod->getRDSParser().m_g9_cA % m_bfmDemod->getRDSParser().m_g9_dA % m_bfmDemod->getRDSParser().m_g9_varB % m_bfmDemod->getRDSParser().m_g9_dB);
 		ui->g09Data->setText(QString(g9str.c_str()));
 	}
 	else
 	{
-		ui->g09Label->setStyleSheet("QLabel { background:rgb(79,79,79); }");
+		setLabelActive(ui->g09Label, false);
 	}
 
 	// G14 group
@@ -777,7 +776,7 @@ void BFMDemodGUI::rdsUpdate(bool force)
 
 		if (m_bfmDemod->getRDSParser().m_g14_data_available)
 		{
-			ui->g14Label->setStyleSheet("QLabel { background-color : green; }");
+			setLabelActive(ui->g14Label, true);
 			m_g14ComboIndex.clear();
 			ui->g14ProgServiceNames->clear();
 
@@ -794,13 +793,31 @@ void BFMDemodGUI::rdsUpdate(bool force)
 		}
 		else
 		{
-			ui->g14Label->setStyleSheet("QLabel { background:rgb(79,79,79); }");
+			setLabelActive(ui->g14Label, false);
 		}
 	}
 
 	m_bfmDemod->getRDSParser().clearUpdateFlags();
 }
 
+/** Style sheets are costly to apply (widget re-polish) so they are set only when the state changes */
+void BFMDemodGUI::setLabelActive(QLabel *label, bool active)
+{
+	QVariant state = label->property("rdsActive");
+
+	if (state.isValid() && (state.toBool() == active)) {
+		return;
+	}
+
+	label->setProperty("rdsActive", active);
+
+	if (active) {
+		label->setStyleSheet("QLabel { background-color : green; }");
+	} else {
+		label->setStyleSheet("QLabel { background:rgb(79,79,79); }");
+	}
+}
+
 void BFMDemodGUI::changeFrequency(qint64 f)
 {
 	qint64 df = m_channelMarker.getCenterFrequency();
@@ -31,6 +31,7 @@ class RDSParser;
 class SpectrumVis;
 class BFMDemod;
 class BasebandSampleSink;
+class QLabel;
 
 namespace Ui {
 	class BFMDemodGUI;
@@ -82,6 +83,7 @@ private:
     void displaySettings();
 	void rdsUpdate(bool force);
 	void rdsUpdateFixedFields();
+	void setLabelActive(QLabel *label, bool active);
 
 	void leaveEvent(QEvent*);
 	void enterEvent(QEvent*);
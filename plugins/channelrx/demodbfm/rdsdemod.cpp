@@ -21,6 +21,9 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <algorithm>
+
+#include "dsp/interpolator.h"
 
 #undef M_PI
 #define M_PI 3.14159265358979323846
@@ -29,11 +32,15 @@
 
 const Real RDSDemod::m_pllBeta = 50;
 const Real RDSDemod::m_fsc = 1187.5;
+const Real RDSDemod::m_lpCutoff = 1200.0;
+const int RDSDemod::m_integrationRate = 31250;
+const Real RDSDemod::m_bandwidth = 2400.0;            // one side bandwidth of the biphase coded RDS signal
+const Real RDSDemod::m_decimatorAttenuation = 60.0;   // dB in the stop band of the decimator
 
 RDSDemod::RDSDemod()
 	// : m_udpDebug(this, 1472, 9995) // UDP debug
 {
-	m_srate = 250000;
+	setSampleRate(250000);
 
 	m_parms.subcarr_phi = 0;
 	memset(m_parms.subcarr_bb, 0, sizeof(m_parms.subcarr_bb));
@@ -66,9 +73,33 @@ RDSDemod::~RDSDemod()
 	//delete m_socket;
 }
 
-void RDSDemod::setSampleRate(int srate) /// FIXME: fix rate for now
+void RDSDemod::setSampleRate(int srate)
 {
-    (void) srate;
+	m_srate = srate;
+	m_integrationDecim = srate < m_integrationRate ? 1 : srate / m_integrationRate;
+	m_subcarrPhiInc = (2 * M_PI * m_fsc) / (Real) m_srate;
+
+	// 2nd order Butterworth lowpass by bilinear transform in mkfilter form
+	// this yields the original mkfilter -Bu -Lp -o 2 -a 4.8e-03 coefficients at 250 kS/s
+	double k = tan(M_PI * m_lpCutoff / m_srate);
+	double norm = 1.0 / (1.0 + sqrt(2.0) * k + k * k);
+	m_lpGain = 1.0 / (k * k * norm);
+	m_lpA0 = -(1.0 - sqrt(2.0) * k + k * k) * norm;
+	m_lpA1 = -2.0 * (k * k - 1.0) * norm;
+}
+
+/**
+ * The RDS signal is kept up to 2.4 kHz and everything from srate/2 is attenuated so that neither the audio
+ * subcarriers nor the image of the 57 kHz mix fold into the RDS band. The filter length follows the
+ * transition width at the input rate. The cutoff is set in the middle of the transition band.
+ */
+void RDSDemod::createDecimator(Interpolator& decimator, int inputSampleRate, int srate)
+{
+	const int phaseSteps = 4;
+	double stopBand = srate / 2.0;
+	double transitionWidth = stopBand - m_bandwidth;
+	double nbTaps = (m_decimatorAttenuation * inputSampleRate) / (22.0 * transitionWidth);
+	decimator.create(phaseSteps, inputSampleRate, (m_bandwidth + stopBand) / 2.0, std::max(nbTaps / phaseSteps, 4.5));
 }
 
 bool RDSDemod::process(Real demod, bool& bit)
@@ -91,8 +122,13 @@ bool RDSDemod::process(Real demod, bool& bit)
 		m_parms.clock_offset = 0;
 	}*/
 
-    m_parms.subcarr_phi += (2 * M_PI * m_fsc) / (Real) m_srate;
-	m_parms.clock_phi = m_parms.subcarr_phi + m_parms.clock_offset;
+	m_parms.subcarr_phi += m_subcarrPhiInc;
+
+	if (m_parms.subcarr_phi >= 2 * M_PI) { // keep phases wrapped so that no fmod is needed per sample
+		m_parms.subcarr_phi -= 2 * M_PI;
+	}
+
+	m_parms.clock_phi = m_parms.subcarr_phi + m_parms.clock_offset; // in [0, 4*pi[
 
 	// Clock phase recovery
 
@@ -106,13 +142,21 @@ bool RDSDemod::process(Real demod, bool& bit)
 		}
 
 		m_parms.clock_offset -= 0.005 * m_parms.d_cphi;
+
+		if (m_parms.clock_offset < 0) {
+			m_parms.clock_offset += 2 * M_PI;
+		} else if (m_parms.clock_offset >= 2 * M_PI) {
+			m_parms.clock_offset -= 2 * M_PI;
+		}
 	}
 
-	m_parms.clock_phi = std::fmod(m_parms.clock_phi, 2 * M_PI);
+	if (m_parms.clock_phi >= 2 * M_PI) {
+		m_parms.clock_phi -= 2 * M_PI;
+	}
 	m_parms.lo_clock = (m_parms.clock_phi < M_PI ? 1 : -1);
 
 	/* Decimate band-limited signal */
-	if (m_parms.numsamples % 8 == 0)
+	if (m_parms.numsamples % m_integrationDecim == 0)
 	{
 		/* biphase symbol integrate & dump */
 		m_parms.acc += m_parms.subcarr_bb[0] * m_parms.lo_clock;
@@ -189,10 +233,10 @@ Real RDSDemod::filter_lp_2400_iq(Real input, int iqIndex)
 	 -a 4.8000000000e-03 0.0000000000e+00 -l */
 
 	m_xv[iqIndex][0] = m_xv[iqIndex][1]; m_xv[iqIndex][1] = m_xv[iqIndex][2];
-	m_xv[iqIndex][2] = input / 4.491730007e+03;
+	m_xv[iqIndex][2] = input / m_lpGain;
 	m_yv[iqIndex][0] = m_yv[iqIndex][1]; m_yv[iqIndex][1] = m_yv[iqIndex][2];
 	m_yv[iqIndex][2] =   (m_xv[iqIndex][0] + m_xv[iqIndex][2]) + 2 * m_xv[iqIndex][1]
-	+ ( -0.9582451124 * m_yv[iqIndex][0]) + (  1.9573545869 * m_yv[iqIndex][1]);
+	+ ( m_lpA0 * m_yv[iqIndex][0]) + ( m_lpA1 * m_yv[iqIndex][1]);
 
 	return m_yv[iqIndex][2];
 }
@@ -24,6 +24,8 @@
 
 #include "dsp/dsptypes.h"
 
+class Interpolator;
+
 class RDSDemod : public QObject
 {
     Q_OBJECT
@@ -33,6 +35,8 @@ public:
 
 	void setSampleRate(int srate);
 	bool process(Real rdsSample, bool &bit);
+	/** Create the decimator of the RDS subcarrier mixed to baseband from the MPX rate down to srate */
+	static void createDecimator(Interpolator& decimator, int inputSampleRate, int srate);
 
 	struct{
 		Real acc;
@@ -74,9 +78,18 @@ private:
 	Real m_prev;
 
 	int m_srate;
+	int m_integrationDecim;  //!< input samples per biphase integration sample
+	double m_subcarrPhiInc;  //!< 1187.5 Hz clock phase increment per sample
+	Real m_lpGain;           //!< 2400 Hz (2*1200 Hz) lowpass coefficients computed for the sample rate
+	Real m_lpA0;
+	Real m_lpA1;
 
 	static const Real m_pllBeta;
 	static const Real m_fsc;
+	static const Real m_lpCutoff;
+	static const int m_integrationRate;
+	static const Real m_bandwidth;
+	static const Real m_decimatorAttenuation;
 };
 
 #endif /* PLUGINS_CHANNEL_BFM_RDSDEMOD_H_ */
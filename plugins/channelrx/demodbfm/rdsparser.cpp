@@ -882,11 +882,19 @@ void RDSParser::decode_type8(unsigned int *group, bool B)
 	}
 	else if (F || D)
 	{ // single-group or 1st of multi-group
+		unsigned int event    =  group[2]        & 0x7ff; // event code, defined in ISO 14819-2
+		unsigned int location =  group[3];                // location code, defined in ISO 14819-3
+		bool changed = (event != m_g8_event) || (location != m_g8_location);
+
 		m_g8_dp_ci            =  group[1]        & 0x7;   // duration & persistence or continuity index
 		m_g8_sign             = (group[2] >> 14) & 0x1;   // event direction, 0 = +, 1 = -
 		m_g8_extent           = (group[2] >> 11) & 0x7;   // number of segments affected
-		m_g8_event            =  group[2]        & 0x7ff; // event code, defined in ISO 14819-2
-		m_g8_location         =  group[3];                // location code, defined in ISO 14819-3
+		m_g8_event            = event;
+		m_g8_location         = location;
+
+		if (!changed) { // messages are repeated many times: log only new ones
+			return;
+		}
 
 		qDebug() << "RDSParser::decode_type8: #user msg# " << (D ? "diversion recommended, " : "");
 
@@ -896,10 +904,8 @@ void RDSParser::decode_type8(unsigned int *group, bool B)
 			qDebug() << "RDSParser::decode_type8: multi-grp, continuity index:" << m_g8_dp_ci;
 		}
 
-		int event_line = RDSTMC::get_tmc_event_code_index(m_g8_event, 1);
-
 		qDebug() << "RDSParser::decode_type8: extent:" << (m_g8_sign ? "-" : "") << m_g8_extent + 1 << " segments"
-			<< ", event" << m_g8_event << ":" << RDSTMC::get_tmc_events(event_line, 1).c_str()
+			<< ", event" << m_g8_event << ":" << RDSTMC::get_tmc_event_text(m_g8_event)
 			<< ", location:" << m_g8_location;
 
 	}
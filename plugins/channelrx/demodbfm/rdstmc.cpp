@@ -27,7 +27,7 @@
  * 2nd column: text (CEN-English)
  * 3rd column: event code (to be transmitted/received)
  * 4th column: quantifier type */
-static const char *tmc_events[TMC_EVENTS][4] = {
+static constexpr const char *tmc_events[TMC_EVENTS][4] = {
 	{"0"," "," "," "},
 	{"1"," "," "," "},
 	{"2"," "," "," "},
@@ -1625,7 +1625,7 @@ static const char *tmc_events[TMC_EVENTS][4] = {
 /* this is like an index key:
  * 1st column: tmc event code
  * 2nd column: row in tmc_events */
-static const int tmc_event_code_index[TMC_EVENT_LIST_LINES][2] = {
+static constexpr int tmc_event_code_index[TMC_EVENT_LIST_LINES][2] = {
 	{0,0},
 	{1,5},
 	{2,48},
@@ -3678,7 +3678,7 @@ static const int tmc_event_code_index[TMC_EVENT_LIST_LINES][2] = {
 
 /* table 1, paragraph 3.1.2, page 4 of ISO 14819-2
  * descriptions of the types of quantifiers */
-static const std::string quantifier_types[13][2] = {
+static constexpr const char *quantifier_types[13][2] = {
 	{"0", "n (small number)"},
 	{"1", "N (number)"},
 	{"2", "less than V metres"},
@@ -3704,4 +3704,14 @@ int RDSTMC::get_tmc_event_code_index(unsigned int i, unsigned int j)
 	return tmc_event_code_index[i][j];
 }
 
+const char *RDSTMC::get_tmc_event_text(unsigned int event_code)
+{
+	if (event_code >= TMC_EVENT_LIST_LINES) {
+		return "";
+	}
+
+	const char *text = tmc_events[tmc_event_code_index[event_code][1]][1];
+	return text ? text : "";
+}
+
 
@@ -25,6 +25,8 @@ class RDSTMC
 public:
 	static std::string get_tmc_events(unsigned int i, unsigned int j);
 	static int get_tmc_event_code_index(unsigned int i, unsigned int j);
+	/** Event description from its 11 bit event code: the code is the index in constant tables hence no search nor allocation */
+	static const char *get_tmc_event_text(unsigned int event_code);
 };
 
 #endif /* PLUGINS_CHANNEL_BFM_RDSTMC_H_ */
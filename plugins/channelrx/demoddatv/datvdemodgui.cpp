@@ -523,6 +523,12 @@ void DATVDemodGUI::tick()
 
     m_intPreviousDecodedData = m_intLastDecodedData;
 
+    ui->screenTV_2->setToolTip(tr("Frames: %1 - Decode: %2 ms - Render: %3 ms - Dropped: %4")
+        .arg(ui->screenTV_2->getDecodedFrames())
+        .arg(ui->screenTV_2->getDecodeLatencyUs() / 1000.0, 0, 'f', 1)
+        .arg(ui->screenTV_2->getRenderLatencyUs() / 1000.0, 0, 'f', 1)
+        .arg(ui->screenTV_2->getDroppedFrames()));
+
     //Try to start video rendering
     m_objDATVDemod->PlayVideo(false);
 
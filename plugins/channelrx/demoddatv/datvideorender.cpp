@@ -36,6 +36,13 @@ DATVideoRender::DATVideoRender(QWidget * parent):
 
     m_objFrame=NULL;
     m_intFrameCount=-1;
+
+    for (int i = 0; i < m_intFramePoolSize; i++) {
+        m_objFramePool[i] = NULL;
+    }
+
+    m_intFramePoolIndex = 0;
+    m_intDecodeLatencyUs = 0;
 }
 
 bool DATVideoRender::eventFilter(QObject *obj, QEvent *event)
@@ -240,19 +247,30 @@ bool DATVideoRender::PreprocessStream()
         return false;
     }
 
-    //Allocate Frame
-    m_objFrame = av_frame_alloc();
-
-    if (!m_objFrame)
+    //Allocate Frames pool
+    for (int i = 0; i < m_intFramePoolSize; i++)
     {
-        avformat_close_input(&m_objFormatCtx);
-        m_objFormatCtx=NULL;
+        m_objFramePool[i] = av_frame_alloc();
 
-        qDebug() << "DATVideoProcess::PreprocessStream cannot allocate frame";
-        return false;
+        if (!m_objFramePool[i])
+        {
+            for (int j = 0; j < i; j++) {
+                av_frame_free(&m_objFramePool[j]);
+            }
+
+            avformat_close_input(&m_objFormatCtx);
+            m_objFormatCtx=NULL;
+
+            qDebug() << "DATVideoProcess::PreprocessStream cannot allocate frame";
+            return false;
+        }
     }
 
+    m_intFramePoolIndex = 0;
+    m_objFrame = m_objFramePool[m_intFramePoolIndex];
     m_intFrameCount=0;
+    m_objDecodeLatency.reset();
+    m_intDecodeLatencyUs = 0;
 
 
     MetaData.Width=m_objDecoderCtx->width;
@@ -415,11 +433,12 @@ bool DATVideoRender::RenderStream()
     //Video channel
     if (objPacket.stream_index == m_intVideoStreamIndex)
     {
-        memset(m_objFrame, 0, sizeof(AVFrame));
         av_frame_unref(m_objFrame);
 
         intGotFrame=0;
 
+        m_objDecodeTimer.start();
+
         if(new_decode( m_objDecoderCtx, m_objFrame, &intGotFrame, &objPacket)<0)
         {
             qDebug() << "DATVideoProcess::RenderStream decoding packet error";
@@ -430,10 +449,16 @@ bool DATVideoRender::RenderStream()
 
         if(intGotFrame)
         {
+            m_objDecodeLatency(m_objDecodeTimer.nsecsElapsed() / 1000);
+            m_intDecodeLatencyUs = m_objDecodeLatency.instantAverage();
+
+            //Planar YUV 4:2:0 goes straight to the GL textures, other formats through RGB conversion
+            bool blnDirectYUV = IsDirectYUV(m_objFrame->format);
+
             //Rendering and RGB Converter setup
 
             blnNeedRenderingSetup=(m_intFrameCount==0);
-            blnNeedRenderingSetup|=(m_objSwsCtx==NULL);
+            blnNeedRenderingSetup|=(!blnDirectYUV && (m_objSwsCtx==NULL));
 
             if((m_intCurrentRenderWidth!=m_objFrame->width) || (m_intCurrentRenderHeight!=m_objFrame->height))
             {
@@ -448,46 +473,49 @@ bool DATVideoRender::RenderStream()
                     m_objSwsCtx=NULL;
                 }
 
-                //Convertisseur YUV -> RGB
-                m_objSwsCtx = sws_alloc_context();
+                if(!blnDirectYUV)
+                {
+                    //Convertisseur YUV -> RGB
+                    m_objSwsCtx = sws_alloc_context();
 
-                av_opt_set_int(m_objSwsCtx,"srcw",m_objFrame->width,0);
-                av_opt_set_int(m_objSwsCtx,"srch",m_objFrame->height,0);
-                av_opt_set_int(m_objSwsCtx,"src_format",m_objFrame->format,0);
+                    av_opt_set_int(m_objSwsCtx,"srcw",m_objFrame->width,0);
+                    av_opt_set_int(m_objSwsCtx,"srch",m_objFrame->height,0);
+                    av_opt_set_int(m_objSwsCtx,"src_format",m_objFrame->format,0);
 
-                av_opt_set_int(m_objSwsCtx,"dstw",m_objFrame->width,0);
-                av_opt_set_int(m_objSwsCtx,"dsth",m_objFrame->height,0);
-                av_opt_set_int(m_objSwsCtx,"dst_format",AV_PIX_FMT_RGB24 ,0);
+                    av_opt_set_int(m_objSwsCtx,"dstw",m_objFrame->width,0);
+                    av_opt_set_int(m_objSwsCtx,"dsth",m_objFrame->height,0);
+                    av_opt_set_int(m_objSwsCtx,"dst_format",AV_PIX_FMT_RGB24 ,0);
 
-                av_opt_set_int(m_objSwsCtx,"sws_flag", SWS_FAST_BILINEAR  /* SWS_BICUBIC*/,0);
+                    av_opt_set_int(m_objSwsCtx,"sws_flag", SWS_FAST_BILINEAR  /* SWS_BICUBIC*/,0);
 
-                if(sws_init_context(m_objSwsCtx, NULL, NULL)<0)
-                {
-                    qDebug() << "DATVideoProcess::RenderStream cannont init video data converter";
+                    if(sws_init_context(m_objSwsCtx, NULL, NULL)<0)
+                    {
+                        qDebug() << "DATVideoProcess::RenderStream cannont init video data converter";
 
-                    m_objSwsCtx=NULL;
+                        m_objSwsCtx=NULL;
 
-                    m_blnRunning=false;
-                    return false;
+                        m_blnRunning=false;
+                        return false;
 
-                }
+                    }
 
-                if((m_intCurrentRenderHeight>0) && (m_intCurrentRenderWidth>0))
-                {
-                    //av_freep(&m_pbytDecodedData[0]);
-                    //av_freep(&m_pintDecodedLineSize[0]);
-                }
+                    if((m_intCurrentRenderHeight>0) && (m_intCurrentRenderWidth>0))
+                    {
+                        //av_freep(&m_pbytDecodedData[0]);
+                        //av_freep(&m_pintDecodedLineSize[0]);
+                    }
 
-                if(av_image_alloc(m_pbytDecodedData, m_pintDecodedLineSize,m_objFrame->width, m_objFrame->height, AV_PIX_FMT_RGB24, 1)<0)
-                {
-                    qDebug() << "DATVideoProcess::RenderStream cannont init video image buffer";
+                    if(av_image_alloc(m_pbytDecodedData, m_pintDecodedLineSize,m_objFrame->width, m_objFrame->height, AV_PIX_FMT_RGB24, 1)<0)
+                    {
+                        qDebug() << "DATVideoProcess::RenderStream cannont init video image buffer";
 
-                    sws_freeContext(m_objSwsCtx);
-                    m_objSwsCtx=NULL;
+                        sws_freeContext(m_objSwsCtx);
+                        m_objSwsCtx=NULL;
 
-                    m_blnRunning=false;
-                    return false;
+                        m_blnRunning=false;
+                        return false;
 
+                    }
                 }
 
                 //Rendering device setup
@@ -507,17 +535,29 @@ bool DATVideoRender::RenderStream()
 
             //Frame rendering
 
-            if(sws_scale(m_objSwsCtx, m_objFrame->data, m_objFrame->linesize, 0, m_objFrame->height, m_pbytDecodedData, m_pintDecodedLineSize)<0)
+            if(blnDirectYUV)
             {
-                qDebug() << "DATVideoProcess::RenderStream error converting video frame to RGB";
+                renderYUVImage(m_objFrame->data, m_objFrame->linesize);
 
-                m_blnRunning=false;
-                return false;
+                //Next decoding recycles the frame displayed before that is no longer referenced by the screen
+                m_intFramePoolIndex = (m_intFramePoolIndex + 1) % m_intFramePoolSize;
+                m_objFrame = m_objFramePool[m_intFramePoolIndex];
+                av_frame_unref(m_objFrame);
             }
+            else
+            {
+                if(sws_scale(m_objSwsCtx, m_objFrame->data, m_objFrame->linesize, 0, m_objFrame->height, m_pbytDecodedData, m_pintDecodedLineSize)<0)
+                {
+                    qDebug() << "DATVideoProcess::RenderStream error converting video frame to RGB";
+
+                    m_blnRunning=false;
+                    return false;
+                }
 
-            renderImage(m_pbytDecodedData[0]);
+                renderImage(m_pbytDecodedData[0]);
 
-            av_frame_unref(m_objFrame);
+                av_frame_unref(m_objFrame);
+            }
 
             m_intFrameCount ++;
         }
@@ -575,12 +615,22 @@ bool DATVideoRender::CloseStream(QIODevice *objDevice)
         m_objDecoderCtx=NULL;
     }
 
-    if(m_objFrame)
+    //Release the planes held by the screen before freeing the frames
+    unsigned char *ptrNoPlanes[3] = {NULL, NULL, NULL};
+    int intNoLinesizes[3] = {0, 0, 0};
+    renderYUVImage(ptrNoPlanes, intNoLinesizes);
+
+    for (int i = 0; i < m_intFramePoolSize; i++)
     {
-        av_frame_unref(m_objFrame);
-        av_frame_free(&m_objFrame);
+        if(m_objFramePool[i])
+        {
+            av_frame_unref(m_objFramePool[i]);
+            av_frame_free(&m_objFramePool[i]);
+        }
     }
 
+    m_objFrame=NULL;
+
     if(m_objSwsCtx!=NULL)
     {
         sws_freeContext(m_objSwsCtx);
@@ -602,6 +652,11 @@ bool DATVideoRender::CloseStream(QIODevice *objDevice)
     return true;
 }
 
+bool DATVideoRender::IsDirectYUV(int intFormat) const
+{
+    return (intFormat == AV_PIX_FMT_YUV420P) || (intFormat == AV_PIX_FMT_YUVJ420P);
+}
+
 /**
  * Replacement of deprecated avcodec_decode_video2 with the same signature
  * https://blogs.gentoo.org/lu_zero/2016/03/29/new-avcodec-api/
@@ -22,8 +22,10 @@
 #include <QEvent>
 #include <QIODevice>
 #include <QThread>
+#include <QElapsedTimer>
 
 #include "gui/tvscreen.h"
+#include "util/movingaverage.h"
 #include "datvideostream.h"
 
 extern "C"
@@ -99,7 +101,11 @@ public:
 
     struct DataTSMetaData2 MetaData;
 
+    qint64 getDecodeLatencyUs() const { return m_intDecodeLatencyUs; }
+    quint32 getDecodedFrames() const { return m_intFrameCount < 0 ? 0 : m_intFrameCount; }
+
 private:
+    static const int m_intFramePoolSize = 2; //!< one frame being decoded, one being displayed
     bool m_blnRunning;
     bool m_blnIsFullScreen;
 
@@ -109,7 +115,9 @@ private:
     SwsContext *m_objSwsCtx;
     AVFormatContext *m_objFormatCtx;
     AVCodecContext *m_objDecoderCtx;
-    AVFrame *m_objFrame;
+    AVFrame *m_objFrame; //!< current frame of the pool being decoded
+    AVFrame *m_objFramePool[m_intFramePoolSize];
+    int m_intFramePoolIndex;
 
     uint8_t *m_pbytDecodedData[4];
     int m_pintDecodedLineSize[4];
@@ -120,8 +128,13 @@ private:
     int m_intCurrentRenderWidth;
     int m_intCurrentRenderHeight;
 
+    QElapsedTimer m_objDecodeTimer;
+    MovingAverageUtil<qint64, qint64, 16> m_objDecodeLatency;
+    qint64 m_intDecodeLatencyUs;
+
     bool InitializeFFMPEG();
     bool PreprocessStream();
+    bool IsDirectYUV(int intFormat) const;
     void ResetMetaData();
 
     int new_decode(AVCodecContext *avctx, AVFrame *frame, int *got_frame, AVPacket *pkt);
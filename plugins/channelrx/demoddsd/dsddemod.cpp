@@ -22,9 +22,6 @@
 
 #include <QTime>
 #include <QDebug>
-#include <QNetworkAccessManager>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include "SWGChannelSettings.h"
 #include "SWGDSDDemodSettings.h"
@@ -39,6 +36,7 @@
 #include "dsp/dspcommands.h"
 #include "device/devicesourceapi.h"
 #include "util/db.h"
+#include "webapi/webapireversedispatcher.h"
 
 #include "dsddemod.h"
 
@@ -63,6 +61,7 @@ DSDDemod::DSDDemod(DeviceSourceAPI *deviceAPI) :
         m_squelchLevel(1e-4),
         m_squelchOpen(false),
         m_squelchDelayLine(24000),
+        m_magsqLevels(16),
         m_audioFifo1(48000),
         m_audioFifo2(48000),
         m_scopeXY(0),
@@ -81,9 +80,6 @@ DSDDemod::DSDDemod(DeviceSourceAPI *deviceAPI) :
 	m_scaleFromShort = SDR_RX_SAMP_SZ < sizeof(short)*8 ? 1 : 1<<(SDR_RX_SAMP_SZ - sizeof(short)*8);
 
 	m_magsq = 0.0f;
-    m_magsqSum = 0.0f;
-    m_magsqPeak = 0.0f;
-    m_magsqCount = 0;
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(&m_audioFifo1, getInputMessageQueue());
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(&m_audioFifo2, getInputMessageQueue());
@@ -96,15 +92,10 @@ DSDDemod::DSDDemod(DeviceSourceAPI *deviceAPI) :
     m_threadedChannelizer = new ThreadedBasebandSampleSink(m_channelizer, this);
     m_deviceAPI->addThreadedSink(m_threadedChannelizer);
     m_deviceAPI->addChannelAPI(this);
-
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 DSDDemod::~DSDDemod()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
     delete[] m_sampleBuffer;
     DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(&m_audioFifo1);
     DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(&m_audioFifo2);
@@ -129,6 +120,7 @@ void DSDDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 
 	m_settingsMutex.lock();
 	m_scopeSampleBuffer.clear();
+	m_channelSamples.clear();
 
 	m_dsdDecoder.enableMbelib(!DSPEngine::instance()->hasDVSerialSupport()); // disable mbelib if DV serial support is present and activated else enable it
 
@@ -139,163 +131,13 @@ void DSDDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 
         if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
         {
-            FixReal sample, delayedSample;
-            qint16 sampleDSD;
-
-            Real re = ci.real() / SDR_RX_SCALED;
-            Real im = ci.imag() / SDR_RX_SCALED;
-            Real magsq = re*re + im*im;
-            m_movingAverage(magsq);
-
-            m_magsqSum += magsq;
-
-            if (magsq > m_magsqPeak)
-            {
-                m_magsqPeak = magsq;
-            }
-
-            m_magsqCount++;
-
-            Real demod = m_phaseDiscri.phaseDiscriminator(ci) * m_settings.m_demodGain; // [-1.0:1.0]
-            m_sampleCount++;
-
-            // AF processing
-
-            if (m_movingAverage.asDouble() > m_squelchLevel)
-            {
-                if (m_squelchGate > 0)
-                {
-
-                    if (m_squelchCount < m_squelchGate*2) {
-                        m_squelchCount++;
-                    }
-
-                    m_squelchDelayLine.write(demod);
-                    m_squelchOpen = m_squelchCount > m_squelchGate;
-                }
-                else
-                {
-                    m_squelchOpen = true;
-                }
-            }
-            else
-            {
-                if (m_squelchGate > 0)
-                {
-                    if (m_squelchCount > 0) {
-                        m_squelchCount--;
-                    }
-
-                    m_squelchDelayLine.write(0);
-                    m_squelchOpen = m_squelchCount > m_squelchGate;
-                }
-                else
-                {
-                    m_squelchOpen = false;
-                }
-            }
-
-            if (m_squelchOpen)
-            {
-                if (m_squelchGate > 0)
-                {
-                    sampleDSD = m_squelchDelayLine.readBack(m_squelchGate) * 32768.0f;   // DSD decoder takes int16 samples
-                    sample = m_squelchDelayLine.readBack(m_squelchGate) * SDR_RX_SCALEF; // scale to sample size
-                }
-                else
-                {
-                    sampleDSD = demod * 32768.0f;   // DSD decoder takes int16 samples
-                    sample = demod * SDR_RX_SCALEF; // scale to sample size
-                }
-            }
-            else
-            {
-                sampleDSD = 0;
-                sample = 0;
-            }
-
-            m_dsdDecoder.pushSample(sampleDSD);
-
-            if (m_settings.m_enableCosineFiltering) { // show actual input to FSK demod
-            	sample = m_dsdDecoder.getFilteredSample() * m_scaleFromShort;
-            }
-
-            if (m_sampleBufferIndex < (1<<17)-1) {
-                m_sampleBufferIndex++;
-            } else {
-                m_sampleBufferIndex = 0;
-            }
-
-            m_sampleBuffer[m_sampleBufferIndex] = sample;
-
-            if (m_sampleBufferIndex < samplesPerSymbol) {
-                delayedSample = m_sampleBuffer[(1<<17) - samplesPerSymbol + m_sampleBufferIndex]; // wrap
-            } else {
-                delayedSample = m_sampleBuffer[m_sampleBufferIndex - samplesPerSymbol];
-            }
-
-            if (m_settings.m_syncOrConstellation)
-            {
-                Sample s(sample, m_dsdDecoder.getSymbolSyncSample() * m_scaleFromShort * 0.84);
-                m_scopeSampleBuffer.push_back(s);
-            }
-            else
-            {
-                Sample s(sample, delayedSample); // I=signal, Q=signal delayed by 20 samples (2400 baud: lowest rate)
-                m_scopeSampleBuffer.push_back(s);
-            }
-
-            if (DSPEngine::instance()->hasDVSerialSupport())
-            {
-                if ((m_settings.m_slot1On) && m_dsdDecoder.mbeDVReady1())
-                {
-                    if (!m_settings.m_audioMute)
-                    {
-                        DSPEngine::instance()->pushMbeFrame(
-                                m_dsdDecoder.getMbeDVFrame1(),
-                                m_dsdDecoder.getMbeRateIndex(),
-                                m_settings.m_volume * 10.0,
-                                m_settings.m_tdmaStereo ? 1 : 3, // left or both channels
-                                m_settings.m_highPassFilter,
-                                m_audioSampleRate/8000, // upsample from native 8k
-                                &m_audioFifo1);
-                    }
-
-                    m_dsdDecoder.resetMbeDV1();
-                }
-
-                if ((m_settings.m_slot2On) && m_dsdDecoder.mbeDVReady2())
-                {
-                    if (!m_settings.m_audioMute)
-                    {
-                        DSPEngine::instance()->pushMbeFrame(
-                                m_dsdDecoder.getMbeDVFrame2(),
-                                m_dsdDecoder.getMbeRateIndex(),
-                                m_settings.m_volume * 10.0,
-                                m_settings.m_tdmaStereo ? 2 : 3, // right or both channels
-                                m_settings.m_highPassFilter,
-                                m_audioSampleRate/8000, // upsample from native 8k
-                                &m_audioFifo2);
-                    }
-
-                    m_dsdDecoder.resetMbeDV2();
-                }
-            }
-
-//            if (DSPEngine::instance()->hasDVSerialSupport() && m_dsdDecoder.mbeDVReady1())
-//            {
-//                if (!m_settings.m_audioMute)
-//                {
-//                    DSPEngine::instance()->pushMbeFrame(m_dsdDecoder.getMbeDVFrame1(), m_dsdDecoder.getMbeRateIndex(), m_settings.m_volume, &m_audioFifo1);
-//                }
-//
-//                m_dsdDecoder.resetMbeDV1();
-//            }
-
+            m_channelSamples.push_back(ci);
             m_interpolatorDistanceRemain += m_interpolatorDistance;
         }
 	}
 
+	processSamples(samplesPerSymbol);
+
 	if (!DSPEngine::instance()->hasDVSerialSupport())
 	{
 	    if (m_settings.m_slot1On)
@@ -349,6 +191,170 @@ void DSDDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 	m_settingsMutex.unlock();
 }
 
+void DSDDemod::processSamples(int samplesPerSymbol)
+{
+    int nbSamples = m_channelSamples.size();
+
+    if (nbSamples == 0) {
+        return;
+    }
+
+    if ((int) m_demodBuffer.size() < nbSamples)
+    {
+        m_demodBuffer.resize(nbSamples);
+        m_magsqBuffer.resize(nbSamples);
+        m_magsqAverageBuffer.resize(nbSamples);
+    }
+
+    m_magsqLevels.feed(&m_channelSamples[0], &m_magsqBuffer[0], &m_magsqAverageBuffer[0], nbSamples, 1.0f / (SDR_RX_SCALEF*SDR_RX_SCALEF));
+    m_phaseDiscri.phaseDiscriminator(&m_channelSamples[0], &m_demodBuffer[0], nbSamples);
+
+    for (int i = 0; i < nbSamples; i++) {
+        processOneSample(m_demodBuffer[i] * m_settings.m_demodGain, m_magsqAverageBuffer[i], samplesPerSymbol); // [-1.0:1.0]
+    }
+}
+
+void DSDDemod::processOneSample(Real demod, Real average, int samplesPerSymbol)
+{
+    FixReal sample, delayedSample;
+    qint16 sampleDSD;
+
+    m_sampleCount++;
+
+    // AF processing
+
+    if (average > m_squelchLevel)
+    {
+        if (m_squelchGate > 0)
+        {
+
+            if (m_squelchCount < m_squelchGate*2) {
+                m_squelchCount++;
+            }
+
+            m_squelchDelayLine.write(demod);
+            m_squelchOpen = m_squelchCount > m_squelchGate;
+        }
+        else
+        {
+            m_squelchOpen = true;
+        }
+    }
+    else
+    {
+        if (m_squelchGate > 0)
+        {
+            if (m_squelchCount > 0) {
+                m_squelchCount--;
+            }
+
+            m_squelchDelayLine.write(0);
+            m_squelchOpen = m_squelchCount > m_squelchGate;
+        }
+        else
+        {
+            m_squelchOpen = false;
+        }
+    }
+
+    if (m_squelchOpen)
+    {
+        if (m_squelchGate > 0)
+        {
+            sampleDSD = m_squelchDelayLine.readBack(m_squelchGate) * 32768.0f;   // DSD decoder takes int16 samples
+            sample = m_squelchDelayLine.readBack(m_squelchGate) * SDR_RX_SCALEF; // scale to sample size
+        }
+        else
+        {
+            sampleDSD = demod * 32768.0f;   // DSD decoder takes int16 samples
+            sample = demod * SDR_RX_SCALEF; // scale to sample size
+        }
+    }
+    else
+    {
+        sampleDSD = 0;
+        sample = 0;
+    }
+
+    m_dsdDecoder.pushSample(sampleDSD);
+
+    if (m_settings.m_enableCosineFiltering) { // show actual input to FSK demod
+    	sample = m_dsdDecoder.getFilteredSample() * m_scaleFromShort;
+    }
+
+    if (m_sampleBufferIndex < (1<<17)-1) {
+        m_sampleBufferIndex++;
+    } else {
+        m_sampleBufferIndex = 0;
+    }
+
+    m_sampleBuffer[m_sampleBufferIndex] = sample;
+
+    if (m_sampleBufferIndex < samplesPerSymbol) {
+        delayedSample = m_sampleBuffer[(1<<17) - samplesPerSymbol + m_sampleBufferIndex]; // wrap
+    } else {
+        delayedSample = m_sampleBuffer[m_sampleBufferIndex - samplesPerSymbol];
+    }
+
+    if (m_settings.m_syncOrConstellation)
+    {
+        Sample s(sample, m_dsdDecoder.getSymbolSyncSample() * m_scaleFromShort * 0.84);
+        m_scopeSampleBuffer.push_back(s);
+    }
+    else
+    {
+        Sample s(sample, delayedSample); // I=signal, Q=signal delayed by 20 samples (2400 baud: lowest rate)
+        m_scopeSampleBuffer.push_back(s);
+    }
+
+    if (DSPEngine::instance()->hasDVSerialSupport())
+    {
+        if ((m_settings.m_slot1On) && m_dsdDecoder.mbeDVReady1())
+        {
+            if (!m_settings.m_audioMute)
+            {
+                DSPEngine::instance()->pushMbeFrame(
+                        m_dsdDecoder.getMbeDVFrame1(),
+                        m_dsdDecoder.getMbeRateIndex(),
+                        m_settings.m_volume * 10.0,
+                        m_settings.m_tdmaStereo ? 1 : 3, // left or both channels
+                        m_settings.m_highPassFilter,
+                        m_audioSampleRate/8000, // upsample from native 8k
+                        &m_audioFifo1);
+            }
+
+            m_dsdDecoder.resetMbeDV1();
+        }
+
+        if ((m_settings.m_slot2On) && m_dsdDecoder.mbeDVReady2())
+        {
+            if (!m_settings.m_audioMute)
+            {
+                DSPEngine::instance()->pushMbeFrame(
+                        m_dsdDecoder.getMbeDVFrame2(),
+                        m_dsdDecoder.getMbeRateIndex(),
+                        m_settings.m_volume * 10.0,
+                        m_settings.m_tdmaStereo ? 2 : 3, // right or both channels
+                        m_settings.m_highPassFilter,
+                        m_audioSampleRate/8000, // upsample from native 8k
+                        &m_audioFifo2);
+            }
+
+            m_dsdDecoder.resetMbeDV2();
+        }
+    }
+
+//            if (DSPEngine::instance()->hasDVSerialSupport() && m_dsdDecoder.mbeDVReady1())
+//            {
+//                if (!m_settings.m_audioMute)
+//                {
+//                    DSPEngine::instance()->pushMbeFrame(m_dsdDecoder.getMbeDVFrame1(), m_dsdDecoder.getMbeRateIndex(), m_settings.m_volume, &m_audioFifo1);
+//                }
+//
+//                m_dsdDecoder.resetMbeDV1();
+//            }
+}
+
 void DSDDemod::start()
 {
 	m_audioFifo1.clear();
@@ -622,19 +628,18 @@ QByteArray DSDDemod::serialize() const
 
 bool DSDDemod::deserialize(const QByteArray& data)
 {
-    if (m_settings.deserialize(data))
-    {
-        MsgConfigureDSDDemod *msg = MsgConfigureDSDDemod::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return true;
-    }
-    else
-    {
-        m_settings.resetToDefaults();
-        MsgConfigureDSDDemod *msg = MsgConfigureDSDDemod::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return false;
+    DSDDemodSettings settings;
+    bool success = settings.deserialize(data);
+
+    if (!success) {
+        settings.resetToDefaults();
     }
+
+    // Applied now so that serialize() and the web API see the new settings.
+    // Only the settings that differ from the running ones are applied to the DSP.
+    applySettings(settings, false);
+
+    return success;
 }
 
 const char *DSDDemod::updateAndGetStatusText()
@@ -1032,6 +1037,12 @@ void DSDDemod::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response
     response.getDsdDemodReport()->setZeroCrossingPosition(getDecoder().getZeroCrossingPos());
     response.getDsdDemodReport()->setSyncRate(getDecoder().getSymbolSyncQuality());
     response.getDsdDemodReport()->setStatusText(new QString(updateAndGetStatusText()));
+
+    float audioLatency = m_audioFifo1.getLatency() >= 0 ? m_audioFifo1.getLatency() : m_audioFifo2.getLatency();
+
+    if (audioLatency >= 0) {
+        response.getDsdDemodReport()->setAudioLatency(audioLatency);
+    }
 }
 
 void DSDDemod::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const DSDDemodSettings& settings, bool force)
@@ -1111,39 +1122,12 @@ void DSDDemod::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, co
         swgDSDDemodSettings->setTraceDecay(settings.m_traceDecay);
     }
 
-    QString channelSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/channel/%4/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString channelSettingsPath = QString("/sdrangel/deviceset/%1/channel/%2/settings")
             .arg(settings.m_reverseAPIDeviceIndex)
             .arg(settings.m_reverseAPIChannelIndex);
-    m_networkRequest.setUrl(QUrl(channelSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgChannelSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, channelSettingsPath, swgChannelSettings->asJson());
 
     delete swgChannelSettings;
 }
-
-void DSDDemod::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "DSDDemod::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
-    }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("DSDDemod::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
-}
@@ -21,7 +21,6 @@
 #include <vector>
 
 #include <QMutex>
-#include <QNetworkRequest>
 
 #include "dsp/basebandsamplesink.h"
 #include "channel/channelsinkapi.h"
@@ -31,7 +30,7 @@
 #include "dsp/lowpass.h"
 #include "dsp/bandpass.h"
 #include "dsp/afsquelch.h"
-#include "util/movingaverage.h"
+#include "dsp/blockkernels.h"
 #include "dsp/afsquelch.h"
 #include "audio/audiofifo.h"
 #include "util/message.h"
@@ -40,8 +39,6 @@
 #include "dsddemodsettings.h"
 #include "dsddecoder.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class ThreadedBasebandSampleSink;
 class DownChannelizer;
@@ -121,20 +118,8 @@ public:
 
     void getMagSqLevels(double& avg, double& peak, int& nbSamples)
     {
-        if (m_magsqCount > 0)
-        {
-            m_magsq = m_magsqSum / m_magsqCount;
-            m_magSqLevelStore.m_magsq = m_magsq;
-            m_magSqLevelStore.m_magsqPeak = m_magsqPeak;
-        }
-
-        avg = m_magSqLevelStore.m_magsq;
-        peak = m_magSqLevelStore.m_magsqPeak;
-        nbSamples = m_magsqCount == 0 ? 1 : m_magsqCount;
-
-        m_magsqSum = 0.0f;
-        m_magsqPeak = 0.0f;
-        m_magsqCount = 0;
+        m_magsqLevels.getLevels(avg, peak, nbSamples);
+        m_magsq = avg;
     }
 
     const char *updateAndGetStatusText();
@@ -157,16 +142,6 @@ public:
     static const QString m_channelId;
 
 private:
-    struct MagSqLevelsStore
-    {
-        MagSqLevelsStore() :
-            m_magsq(1e-12),
-            m_magsqPeak(1e-12)
-        {}
-        double m_magsq;
-        double m_magsqPeak;
-    };
-
     typedef enum
     {
         signalFormatNone,
@@ -224,12 +199,8 @@ private:
 	bool m_squelchOpen;
     DoubleBufferFIFO<Real> m_squelchDelayLine;
 
-    MovingAverageUtil<Real, double, 16> m_movingAverage;
+    MagSqLevels m_magsqLevels; //!< moving average for the squelch and levels for the channel power report
     double m_magsq;
-    double m_magsqSum;
-    double m_magsqPeak;
-    int  m_magsqCount;
-    MagSqLevelsStore m_magSqLevelStore;
 
 	SampleVector m_scopeSampleBuffer;
 	AudioVector m_audioBuffer;
@@ -249,8 +220,10 @@ private:
     SignalFormat m_signalFormat;   //!< Used to keep formatting during successive calls for the same standard type
     PhaseDiscriminators m_phaseDiscri;
 
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
+    std::vector<Complex> m_channelSamples; //!< channel samples of the current feed
+    std::vector<Real> m_demodBuffer;
+    std::vector<Real> m_magsqBuffer;
+    std::vector<Real> m_magsqAverageBuffer;
 
     QMutex m_settingsMutex;
 
@@ -260,14 +233,12 @@ private:
     void applyChannelSettings(int inputSampleRate, int inputFrequencyOffset, bool force = false);
 	void applySettings(const DSDDemodSettings& settings, bool force = false);
 	void formatStatusText();
+    void processSamples(int samplesPerSymbol); //!< block processing of the channel samples of the current feed
+    void processOneSample(Real demod, Real average, int samplesPerSymbol);
 
     void webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& response, const DSDDemodSettings& settings);
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const DSDDemodSettings& settings, bool force);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
-
 };
 
 #endif // INCLUDE_DSDDEMOD_H
@@ -20,6 +20,7 @@
 #include <QTime>
 #include <QDebug>
 #include <stdio.h>
+#include <algorithm>
 
 #include "dsp/downchannelizer.h"
 #include "dsp/threadedbasebandsamplesink.h"
@@ -50,21 +51,7 @@ LoRaDemod::LoRaDemod(DeviceSourceAPI* deviceAPI) :
 	m_interpolator.create(16, m_sampleRate, m_Bandwidth/1.9);
 	m_sampleDistanceRemain = (Real)m_sampleRate / m_Bandwidth;
 
-	m_chirp = 0;
-	m_angle = 0;
-	m_bin = 0;
-	m_result = 0;
-	m_count = 0;
-	m_header = 0;
-	m_time = 0;
-	m_tune = 0;
-
-	loraFilter = new sfft(LORA_SFFT_LEN);
-	negaFilter = new sfft(LORA_SFFT_LEN);
-
-	mov = new float[4*LORA_SFFT_LEN];
-	history = new short[1024];
-	finetune = new short[16];
+	applyChirpSettings(m_settings, true);
 
     m_channelizer = new DownChannelizer(this);
     m_threadedChannelizer = new ThreadedBasebandSampleSink(m_channelizer);
@@ -74,16 +61,9 @@ LoRaDemod::LoRaDemod(DeviceSourceAPI* deviceAPI) :
 
 LoRaDemod::~LoRaDemod()
 {
-	if (loraFilter)
-		delete loraFilter;
-	if (negaFilter)
-		delete negaFilter;
-	if (mov)
-		delete [] mov;
-	if (history)
-		delete [] history;
-	if (finetune)
-		delete [] finetune;
+	for (std::vector<ChirpDemod*>::iterator it = m_chirpDemods.begin(); it != m_chirpDemods.end(); ++it) {
+		delete *it;
+	}
 
 	m_deviceAPI->removeChannelAPI(this);
     m_deviceAPI->removeThreadedSink(m_threadedChannelizer);
@@ -91,22 +71,49 @@ LoRaDemod::~LoRaDemod()
     delete m_channelizer;
 }
 
-void LoRaDemod::dumpRaw()
+void LoRaDemod::applyChirpSettings(const LoRaDemodSettings& settings, bool force)
+{
+	if ((settings.m_spread != m_settings.m_spread)
+	 || (settings.m_nbSpreadFactors != m_settings.m_nbSpreadFactors) || force)
+	{
+		unsigned int nbDemods = std::max(1, settings.m_nbSpreadFactors);
+
+		for (std::vector<ChirpDemod*>::iterator it = m_chirpDemods.begin(); it != m_chirpDemods.end(); ++it) {
+			delete *it;
+		}
+
+		m_chirpDemods.clear();
+		m_bin = 0;
+
+		for (unsigned int i = 0; i < nbDemods; i++)
+		{
+			unsigned int spreadFactor = settings.m_spread + i;
+
+			if (spreadFactor > ChirpDemod::m_maxSpreadFactor) {
+				break;
+			}
+
+			m_chirpDemods.push_back(new ChirpDemod(spreadFactor));
+		}
+	}
+}
+
+void LoRaDemod::dumpRaw(const ChirpDemod::Frame& frame, unsigned int spreadFactor)
 {
 	short bin, j, max;
 	char text[256];
 
-	max = m_time / 4 - 3;
-
-	if (max > 140)
-	{
-		max = 140; // about 2 symbols to each char
+	if (frame.size() < 16) {
+		return;
 	}
 
+	max = frame.size() > 140 ? 140 : frame.size(); // about 2 symbols to each char
+
 	for ( j=0; j < max; j++)
 	{
-		bin = (history[(j + 1)  * 4] + m_tune ) & (LORA_SFFT_LEN - 1);
-		text[j] = toGray(bin >> 1);
+		// Six bits per symbol are used whatever the spread factor
+		bin = frame[j] >> (spreadFactor - 6);
+		text[j] = toGray(bin);
 	}
 
 	prng6(text, max);
@@ -131,152 +138,60 @@ void LoRaDemod::dumpRaw()
 	text[1] = text[0];
 	text[j] = 0;
 
-	printf("%s\n", &text[1]);
+	printf("SF%u: %s\n", spreadFactor, &text[1]);
 }
 
-short LoRaDemod::synch(short bin)
+void LoRaDemod::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool pO)
 {
-	short i, j;
-
-	if (bin < 0)
-	{
-		if (m_time > 70)
-		{
-			dumpRaw();
-		}
+    (void) pO;
+	Complex ci;
 
-		m_time = 0;
-		return -1;
-	}
+	m_sampleBuffer.clear();
+	m_chirpBuffer.clear();
 
-	history[m_time] = bin;
+	m_settingsMutex.lock();
 
-	if (m_time > 12)
+	for(SampleVector::const_iterator it = begin; it < end; ++it)
 	{
-		if (bin == history[m_time - 6])
+		Complex c(it->real() / SDR_RX_SCALEF, it->imag() / SDR_RX_SCALEF);
+		c *= m_nco.nextIQ();
+
+		if(m_interpolator.decimate(&m_sampleDistanceRemain, c, &ci))
 		{
-			if (bin == history[m_time - 12])
-			{
-				m_tune = LORA_SFFT_LEN - bin;
-				j = 0;
-
-				for (i=0; i<12; i++)
-				{
-					j += finetune[15 & (m_time - i)];
-				}
-
-				if (j < 0)
-				{
-					m_tune += 1;
-				}
-
-				m_tune &= (LORA_SFFT_LEN - 1);
-				m_time = 0;
-				return -1;
-			}
+			m_chirpBuffer.push_back(ci);
+			m_sampleDistanceRemain += (Real)m_sampleRate / m_Bandwidth;
 		}
 	}
 
-	m_time++;
-	m_time &= 1023;
-
-	if (m_time & 3)
-	{
-		return -1;
-	}
-
-	return (bin + m_tune) & (LORA_SFFT_LEN - 1);
-}
-
-int LoRaDemod::detect(Complex c, Complex a)
-{
-	int p, q;
-	short i, result, negresult, movpoint;
-	float peak, negpeak, tfloat;
-	float mag[LORA_SFFT_LEN];
-	float rev[LORA_SFFT_LEN];
+	// The scope shows the dechirped symbol of the first decoder as a phasor turning
+	// at the symbol bin rate so that decoder runs one sample at a time
+	ChirpDemod *scopeDemod = m_chirpDemods.size() > 0 ? m_chirpDemods.front() : 0;
 
-	loraFilter->run(c * a);
-	negaFilter->run(c * conj(a));
-
-	// process spectrum twice in FFTLEN
-	if (++m_count & ((1 << DATA_BITS) - 1))
+	if (scopeDemod)
 	{
-		return m_result;
-	}
-
-	movpoint = 3 & (m_count >> DATA_BITS);
-
-	loraFilter->fetch(mag);
-	negaFilter->fetch(rev);
-	peak = negpeak = 0.0f;
-	result = negresult = 0;
-
-	for (i = 0; i < LORA_SFFT_LEN; i++)
-	{
-		if (rev[i] > negpeak)
-		{
-			negpeak = rev[i];
-			negresult = i;
-		}
-
-		tfloat = mov[i] + mov[LORA_SFFT_LEN + i] +mov[2 * LORA_SFFT_LEN + i]
-				+ mov[3 * LORA_SFFT_LEN + i] + mag[i];
+		unsigned int nbBins = scopeDemod->getNbSymbolSamples();
 
-		if (tfloat > peak)
+		for (std::vector<Complex>::const_iterator it = m_chirpBuffer.begin(); it != m_chirpBuffer.end(); ++it)
 		{
-			peak = tfloat;
-			result = i;
+			scopeDemod->process(&(*it), 1);
+			m_bin = (m_bin + scopeDemod->getLastSymbol()) & (nbBins - 1);
+			Complex nangle(cos(M_PI*2*m_bin/nbBins), sin(M_PI*2*m_bin/nbBins));
+			m_sampleBuffer.push_back(Sample(nangle.real() * 100, nangle.imag() * 100));
 		}
-
-		mov[movpoint * LORA_SFFT_LEN + i] = mag[i];
 	}
 
-	p = (result - 1 + LORA_SFFT_LEN) & (LORA_SFFT_LEN -1);
-	q = (result + 1) & (LORA_SFFT_LEN -1);
-	finetune[15 & m_time] = (mag[p] > mag[q]) ? -1 : 1;
-
-	if (peak < negpeak * LORA_SQUELCH)
-	{
-		result = -1;
-	}
-
-	result = synch(result);
-
-	if (result >= 0)
+	// Each spread factor has its own chirp rate and symbol length so each decoder
+	// dechirps the same block of channel samples on its own
+	for (std::vector<ChirpDemod*>::iterator it = m_chirpDemods.begin(); it != m_chirpDemods.end(); ++it)
 	{
-		m_result = result;
-	}
-
-	return m_result;
-}
-
-void LoRaDemod::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool pO)
-{
-    (void) pO;
-	int newangle;
-	Complex ci;
-
-	m_sampleBuffer.clear();
-
-	m_settingsMutex.lock();
-
-	for(SampleVector::const_iterator it = begin; it < end; ++it)
-	{
-		Complex c(it->real() / SDR_RX_SCALEF, it->imag() / SDR_RX_SCALEF);
-		c *= m_nco.nextIQ();
+		if (*it != scopeDemod) {
+			(*it)->process(m_chirpBuffer.data(), m_chirpBuffer.size());
+		}
 
-		if(m_interpolator.decimate(&m_sampleDistanceRemain, c, &ci))
-		{
-			m_chirp = (m_chirp + 1) & (SPREADFACTOR - 1);
-                        m_angle = (m_angle + m_chirp) & (SPREADFACTOR - 1);
-			Complex cangle(cos(M_PI*2*m_angle/SPREADFACTOR),-sin(M_PI*2*m_angle/SPREADFACTOR));
-			newangle = detect(ci, cangle);
+		(*it)->takeFrames(m_frames);
 
-			m_bin = (m_bin + newangle) & (LORA_SFFT_LEN - 1);
-			Complex nangle(cos(M_PI*2*m_bin/LORA_SFFT_LEN),sin(M_PI*2*m_bin/LORA_SFFT_LEN));
-			m_sampleBuffer.push_back(Sample(nangle.real() * 100, nangle.imag() * 100));
-			m_sampleDistanceRemain += (Real)m_sampleRate / m_Bandwidth;
+		for (std::vector<ChirpDemod::Frame>::const_iterator fit = m_frames.begin(); fit != m_frames.end(); ++fit) {
+			dumpRaw(*fit, (*it)->getSpreadFactor());
 		}
 	}
 
@@ -334,18 +249,7 @@ bool LoRaDemod::handleMessage(const Message& cmd)
 	else if (MsgConfigureLoRaDemod::match(cmd))
 	{
 		MsgConfigureLoRaDemod& cfg = (MsgConfigureLoRaDemod&) cmd;
-
-		m_settingsMutex.lock();
-
-		LoRaDemodSettings settings = cfg.getSettings();
-
-		m_Bandwidth = LoRaDemodSettings::bandwidths[settings.m_bandwidthIndex];
-		m_interpolator.create(16, m_sampleRate, m_Bandwidth/1.9);
-
-		m_settingsMutex.unlock();
-
-		m_settings = settings;
-		qDebug() << "LoRaDemod::handleMessage: MsgConfigureLoRaDemod: m_Bandwidth: " << m_Bandwidth;
+		applySettings(cfg.getSettings(), cfg.getForce());
 
 		return true;
 	}
@@ -366,6 +270,22 @@ bool LoRaDemod::handleMessage(const Message& cmd)
 	}
 }
 
+void LoRaDemod::applySettings(const LoRaDemodSettings& settings, bool force)
+{
+	m_settingsMutex.lock();
+
+	m_Bandwidth = LoRaDemodSettings::bandwidths[settings.m_bandwidthIndex];
+	m_interpolator.create(16, m_sampleRate, m_Bandwidth/1.9);
+	applyChirpSettings(settings, force);
+
+	m_settingsMutex.unlock();
+
+	m_settings = settings;
+	qDebug() << "LoRaDemod::applySettings: m_Bandwidth: " << m_Bandwidth
+			<< " m_spread: " << settings.m_spread
+			<< " m_nbSpreadFactors: " << settings.m_nbSpreadFactors;
+}
+
 QByteArray LoRaDemod::serialize() const
 {
     return m_settings.serialize();
@@ -373,18 +293,17 @@ QByteArray LoRaDemod::serialize() const
 
 bool LoRaDemod::deserialize(const QByteArray& data)
 {
-    if (m_settings.deserialize(data))
-    {
-        MsgConfigureLoRaDemod *msg = MsgConfigureLoRaDemod::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return true;
-    }
-    else
-    {
-        m_settings.resetToDefaults();
-        MsgConfigureLoRaDemod *msg = MsgConfigureLoRaDemod::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return false;
+    LoRaDemodSettings settings;
+    bool success = settings.deserialize(data);
+
+    if (!success) {
+        settings.resetToDefaults();
     }
+
+    // Applied now so that serialize() and the web API see the new settings.
+    // Only the settings that differ from the running ones are applied to the DSP.
+    applySettings(settings, false);
+
+    return success;
 }
 
@@ -26,16 +26,10 @@
 #include "dsp/nco.h"
 #include "dsp/interpolator.h"
 #include "util/message.h"
-#include "dsp/fftfilt.h"
+#include "dsp/chirpdemod.h"
 
 #include "lorademodsettings.h"
 
-#define DATA_BITS (6)
-#define SAMPLEBITS (DATA_BITS + 2)
-#define SPREADFACTOR (1 << SAMPLEBITS)
-#define LORA_SFFT_LEN (SPREADFACTOR / 2)
-#define LORA_SQUELCH (3)
-
 class DeviceSourceAPI;
 class ThreadedBasebandSampleSink;
 class DownChannelizer;
@@ -109,9 +103,9 @@ public:
     static const QString m_channelId;
 
 private:
-	int  detect(Complex sample, Complex angle);
-	void dumpRaw(void);
-	short synch (short bin);
+	void applySettings(const LoRaDemodSettings& settings, bool force = false);
+	void applyChirpSettings(const LoRaDemodSettings& settings, bool force = false);
+	void dumpRaw(const ChirpDemod::Frame& frame, unsigned int spreadFactor);
 	short toGray(short bin);
 	void interleave6(char* inout, int size);
 	void hamming6(char* inout, int size);
@@ -125,20 +119,11 @@ private:
 	Real m_Bandwidth;
 	int m_sampleRate;
 	int m_frequency;
-	int m_chirp;
-	int m_angle;
-	int m_bin;
-	int m_result;
-	int m_count;
-	int m_header;
-	int m_time;
-	short m_tune;
-
-	sfft* loraFilter;
-	sfft* negaFilter;
-	float* mov;
-	short* history;
-	short* finetune;
+
+	std::vector<ChirpDemod*> m_chirpDemods; //!< one per spread factor decoded in parallel
+	std::vector<Complex> m_chirpBuffer;     //!< block of samples at one sample per chip
+	std::vector<ChirpDemod::Frame> m_frames;
+	unsigned int m_bin;                     //!< phase of the dechirped symbol phasor sent to the scope
 
 	NCO m_nco;
 	Interpolator m_interpolator;
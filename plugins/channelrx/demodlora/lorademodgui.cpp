@@ -100,7 +100,39 @@ void LoRaDemodGUI::on_BW_valueChanged(int value)
 
 void LoRaDemodGUI::on_Spread_valueChanged(int value)
 {
-    (void) value;
+    m_settings.m_spread = value;
+
+    if (m_settings.m_spread + m_settings.m_nbSpreadFactors > 13) {
+        m_settings.m_nbSpreadFactors = 13 - m_settings.m_spread;
+    }
+
+    displaySpreadText();
+    applySettings();
+}
+
+void LoRaDemodGUI::on_NbSF_valueChanged(int value)
+{
+    m_settings.m_nbSpreadFactors = value;
+
+    if (m_settings.m_spread + m_settings.m_nbSpreadFactors > 13) {
+        m_settings.m_nbSpreadFactors = 13 - m_settings.m_spread;
+    }
+
+    displaySpreadText();
+    applySettings();
+}
+
+void LoRaDemodGUI::displaySpreadText()
+{
+    int lastSF = m_settings.m_spread + m_settings.m_nbSpreadFactors - 1;
+
+    if (lastSF == m_settings.m_spread) {
+        ui->SpreadText->setText(QString("SF%1").arg(m_settings.m_spread));
+    } else {
+        ui->SpreadText->setText(QString("SF%1-%2").arg(m_settings.m_spread).arg(lastSF));
+    }
+
+    ui->NbSFText->setText(QString("%1").arg(m_settings.m_nbSpreadFactors));
 }
 
 void LoRaDemodGUI::onWidgetRolled(QWidget* widget, bool rollDown)
@@ -191,5 +223,8 @@ void LoRaDemodGUI::displaySettings()
     blockApplySettings(true);
     ui->BWText->setText(QString("%1 Hz").arg(thisBW));
     ui->BW->setValue(m_settings.m_bandwidthIndex);
+    ui->Spread->setValue(m_settings.m_spread);
+    ui->NbSF->setValue(m_settings.m_nbSpreadFactors);
+    displaySpreadText();
     blockApplySettings(false);
 }
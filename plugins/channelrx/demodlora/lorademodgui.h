@@ -40,6 +40,7 @@ private slots:
 	void viewChanged();
 	void on_BW_valueChanged(int value);
 	void on_Spread_valueChanged(int value);
+	void on_NbSF_valueChanged(int value);
 	void onWidgetRolled(QWidget* widget, bool rollDown);
 
 private:
@@ -60,6 +61,7 @@ private:
     void blockApplySettings(bool block);
 	void applySettings(bool force = false);
 	void displaySettings();
+	void displaySpreadText();
 };
 
 #endif // INCLUDE_LoRaDEMODGUI_H
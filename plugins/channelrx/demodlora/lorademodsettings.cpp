@@ -21,7 +21,8 @@ LoRaDemodSettings::LoRaDemodSettings() :
 void LoRaDemodSettings::resetToDefaults()
 {
     m_bandwidthIndex = 0;
-    m_spread = 0;
+    m_spread = 8;
+    m_nbSpreadFactors = 1;
     m_rgbColor = QColor(255, 0, 255).rgb();
     m_title = "LoRa Demodulator";
 }
@@ -42,6 +43,7 @@ QByteArray LoRaDemodSettings::serialize() const
     }
 
     s.writeString(6, m_title);
+    s.writeS32(7, m_nbSpreadFactors);
 
     return s.final();
 }
@@ -62,7 +64,11 @@ bool LoRaDemodSettings::deserialize(const QByteArray& data)
 
         d.readS32(1, &m_centerFrequency, 0);
         d.readS32(2, &m_bandwidthIndex, 0);
-        d.readS32(3, &m_spread, 0);
+        d.readS32(3, &m_spread, 8);
+
+        if ((m_spread < 7) || (m_spread > 12)) { // previously unused
+            m_spread = 8;
+        }
 
         if (m_spectrumGUI) {
             d.readBlob(4, &bytetmp);
@@ -75,6 +81,13 @@ bool LoRaDemodSettings::deserialize(const QByteArray& data)
         }
 
         d.readString(6, &m_title, "LoRa Demodulator");
+        d.readS32(7, &m_nbSpreadFactors, 1);
+
+        if (m_nbSpreadFactors < 1) {
+            m_nbSpreadFactors = 1;
+        } else if (m_spread + m_nbSpreadFactors > 13) {
+            m_nbSpreadFactors = 13 - m_spread;
+        }
 
         return true;
     }
@@ -13,7 +13,8 @@ struct LoRaDemodSettings
 {
     int m_centerFrequency;
     int m_bandwidthIndex;
-    int m_spread;
+    int m_spread;            //!< spread factor of the first decoder (7 to 12)
+    int m_nbSpreadFactors;   //!< number of consecutive spread factors decoded in parallel
     uint32_t m_rgbColor;
     QString m_title;
 
@@ -20,9 +20,6 @@
 
 #include <QTime>
 #include <QDebug>
-#include <QNetworkAccessManager>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include "SWGChannelSettings.h"
 #include "SWGNFMDemodSettings.h"
@@ -36,7 +33,9 @@
 #include "dsp/dspengine.h"
 #include "dsp/threadedbasebandsamplesink.h"
 #include "dsp/dspcommands.h"
+#include "dsp/dsplog.h"
 #include "device/devicesourceapi.h"
+#include "webapi/webapireversedispatcher.h"
 
 #include "nfmdemod.h"
 
@@ -65,9 +64,7 @@ NFMDemod::NFMDemod(DeviceSourceAPI *devieAPI) :
         m_squelchOpen(false),
         m_afSquelchOpen(false),
         m_magsq(0.0f),
-        m_magsqSum(0.0f),
-        m_magsqPeak(0.0f),
-        m_magsqCount(0),
+        m_magsqLevels(32),
         m_afSquelch(),
         m_squelchDelayLine(24000),
         m_audioFifo(48000),
@@ -98,15 +95,10 @@ NFMDemod::NFMDemod(DeviceSourceAPI *devieAPI) :
     m_threadedChannelizer = new ThreadedBasebandSampleSink(m_channelizer, this);
     m_deviceAPI->addThreadedSink(m_threadedChannelizer);
     m_deviceAPI->addChannelAPI(this);
-
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 NFMDemod::~NFMDemod()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
 	DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(&m_audioFifo);
 	m_deviceAPI->removeChannelAPI(this);
     m_deviceAPI->removeThreadedSink(m_threadedChannelizer);
@@ -156,6 +148,7 @@ void NFMDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 	}
 
 	m_settingsMutex.lock();
+	m_channelSamples.clear();
 
 	for (SampleVector::const_iterator it = begin; it != end; ++it)
 	{
@@ -164,181 +157,212 @@ void NFMDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 
         if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
         {
+            m_channelSamples.push_back(ci);
+            m_interpolatorDistanceRemain += m_interpolatorDistance;
+        }
+	}
 
-            qint16 sample;
+	processSamples();
 
-            double magsqRaw; // = ci.real()*ci.real() + c.imag()*c.imag();
-            Real deviation;
+	if (m_audioBufferFill > 0)
+	{
+		uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
 
-            Real demod = m_phaseDiscri.phaseDiscriminatorDelta(ci, magsqRaw, deviation);
+		if ((res != m_audioBufferFill) && m_audioFifoLog.occurrence(m_audioBufferFill - res))
+		{
+			qCDebug(dspLog, "NFMDemod::feed: audio FIFO full: %llu samples lost in %u writes",
+				m_audioFifoLog.getAmount(), m_audioFifoLog.getOccurrences());
+		}
 
-            Real magsq = magsqRaw / (SDR_RX_SCALED*SDR_RX_SCALED);
-            m_movingAverage(magsq);
-            m_magsqSum += magsq;
+		m_audioBufferFill = 0;
+	}
 
-            if (magsq > m_magsqPeak)
-            {
-                m_magsqPeak = magsq;
-            }
+	m_settingsMutex.unlock();
+}
 
-            m_magsqCount++;
-            m_sampleCount++;
+void NFMDemod::processSamples()
+{
+    int nbSamples = m_channelSamples.size();
 
-            // AF processing
+    if (nbSamples == 0) {
+        return;
+    }
 
-            if (m_settings.m_deltaSquelch)
-            {
-                if (m_afSquelch.analyze(demod * m_discriCompensation))
-                {
-                    m_afSquelchOpen = m_afSquelch.evaluate(); // ? m_squelchGate + m_squelchDecay : 0;
+    if ((int) m_demodBuffer.size() < nbSamples)
+    {
+        m_demodBuffer.resize(nbSamples);
+        m_magsqBuffer.resize(nbSamples);
+        m_magsqAverageBuffer.resize(nbSamples);
+    }
 
-                    if (!m_afSquelchOpen) {
-                        m_squelchDelayLine.zeroBack(m_audioSampleRate/10); // zero out evaluation period
-                    }
-                }
+    m_phaseDiscri.phaseDiscriminatorDelta(&m_channelSamples[0], &m_demodBuffer[0], nbSamples);
+    m_magsqLevels.feed(&m_channelSamples[0], &m_magsqBuffer[0], &m_magsqAverageBuffer[0], nbSamples, 1.0f / (SDR_RX_SCALEF*SDR_RX_SCALEF));
 
-                if (m_afSquelchOpen)
-                {
-                    m_squelchDelayLine.write(demod * m_discriCompensation);
+    for (int i = 0; i < nbSamples; i++) {
+        m_demodBuffer[i] *= m_discriCompensation;
+    }
 
-                    if (m_squelchCount < 2*m_squelchGate) {
-                        m_squelchCount++;
-                    }
-                }
-                else
-                {
-                    m_squelchDelayLine.write(0);
+    for (int i = 0; i < nbSamples;)
+    {
+        int count = nbSamples - i;
+        bool afSquelchResult = false;
 
-                    if (m_squelchCount > 0) {
-                        m_squelchCount--;
-                    }
-                }
+        if (m_settings.m_deltaSquelch) { // stop at the next AF squelch result
+            count = m_afSquelch.analyze(&m_demodBuffer[i], count, afSquelchResult);
+        }
+
+        for (int j = i; j < i + count; j++) {
+            processOneSample(m_demodBuffer[j], m_magsqAverageBuffer[j], afSquelchResult && (j == i + count - 1));
+        }
+
+        i += count;
+    }
+}
+
+void NFMDemod::processOneSample(Real demod, Real average, bool afSquelchResult)
+{
+    qint16 sample;
+
+    m_sampleCount++;
+
+    // AF processing
+
+    if (m_settings.m_deltaSquelch)
+    {
+        if (afSquelchResult)
+        {
+            m_afSquelchOpen = m_afSquelch.evaluate(); // ? m_squelchGate + m_squelchDecay : 0;
+
+            if (!m_afSquelchOpen) {
+                m_squelchDelayLine.zeroBack(m_audioSampleRate/10); // zero out evaluation period
             }
-            else
-            {
-                if ((Real) m_movingAverage < m_squelchLevel)
-                {
-                    m_squelchDelayLine.write(0);
+        }
 
-                    if (m_squelchCount > 0) {
-                        m_squelchCount--;
-                    }
-                }
-                else
-                {
-                    m_squelchDelayLine.write(demod * m_discriCompensation);
+        if (m_afSquelchOpen)
+        {
+            m_squelchDelayLine.write(demod);
 
-                    if (m_squelchCount < 2*m_squelchGate) {
-                        m_squelchCount++;
-                    }
-                }
+            if (m_squelchCount < 2*m_squelchGate) {
+                m_squelchCount++;
             }
+        }
+        else
+        {
+            m_squelchDelayLine.write(0);
 
-            m_squelchOpen = (m_squelchCount > m_squelchGate);
+            if (m_squelchCount > 0) {
+                m_squelchCount--;
+            }
+        }
+    }
+    else
+    {
+        if (average < m_squelchLevel)
+        {
+            m_squelchDelayLine.write(0);
 
-            if (m_settings.m_audioMute)
-            {
-                sample = 0;
+            if (m_squelchCount > 0) {
+                m_squelchCount--;
             }
-            else
+        }
+        else
+        {
+            m_squelchDelayLine.write(demod);
+
+            if (m_squelchCount < 2*m_squelchGate) {
+                m_squelchCount++;
+            }
+        }
+    }
+
+    m_squelchOpen = (m_squelchCount > m_squelchGate);
+
+    if (m_settings.m_audioMute)
+    {
+        sample = 0;
+    }
+    else
+    {
+        if (m_squelchOpen)
+        {
+            if (m_settings.m_ctcssOn)
             {
-                if (m_squelchOpen)
+                Real ctcss_sample = m_lowpass.filter(demod);
+
+                if ((m_sampleCount & 7) == 7) // decimate 48k -> 6k
                 {
-                    if (m_settings.m_ctcssOn)
+                    if (m_ctcssDetector.analyze(&ctcss_sample))
                     {
-                        Real ctcss_sample = m_lowpass.filter(demod * m_discriCompensation);
+                        int maxToneIndex;
 
-                        if ((m_sampleCount & 7) == 7) // decimate 48k -> 6k
+                        if (m_ctcssDetector.getDetectedTone(maxToneIndex))
                         {
-                            if (m_ctcssDetector.analyze(&ctcss_sample))
+                            if (maxToneIndex+1 != m_ctcssIndex)
                             {
-                                int maxToneIndex;
-
-                                if (m_ctcssDetector.getDetectedTone(maxToneIndex))
-                                {
-                                    if (maxToneIndex+1 != m_ctcssIndex)
-                                    {
-                                        if (getMessageQueueToGUI()) {
-                                            MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(m_ctcssDetector.getToneSet()[maxToneIndex]);
-                                            getMessageQueueToGUI()->push(msg);
-                                        }
-                                        m_ctcssIndex = maxToneIndex+1;
-                                    }
-                                }
-                                else
-                                {
-                                    if (m_ctcssIndex != 0)
-                                    {
-                                        if (getMessageQueueToGUI()) {
-                                            MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(0);
-                                            getMessageQueueToGUI()->push(msg);
-                                        }
-                                        m_ctcssIndex = 0;
-                                    }
+                                if (getMessageQueueToGUI()) {
+                                    MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(m_ctcssDetector.getToneSet()[maxToneIndex]);
+                                    getMessageQueueToGUI()->push(msg);
                                 }
+                                m_ctcssIndex = maxToneIndex+1;
                             }
                         }
-                    }
-
-                    if (m_settings.m_ctcssOn && m_ctcssIndexSelected && (m_ctcssIndexSelected != m_ctcssIndex))
-                    {
-                        sample = 0;
-                    }
-                    else
-                    {
-                        sample = m_bandpass.filter(m_squelchDelayLine.readBack(m_squelchGate)) * m_settings.m_volume;
-                    }
-                }
-                else
-                {
-                    if (m_ctcssIndex != 0)
-                    {
-                        if (getMessageQueueToGUI()) {
-                            MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(0);
-                            getMessageQueueToGUI()->push(msg);
+                        else
+                        {
+                            if (m_ctcssIndex != 0)
+                            {
+                                if (getMessageQueueToGUI()) {
+                                    MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(0);
+                                    getMessageQueueToGUI()->push(msg);
+                                }
+                                m_ctcssIndex = 0;
+                            }
                         }
-
-                        m_ctcssIndex = 0;
                     }
-
-                    sample = 0;
                 }
             }
 
-
-            m_audioBuffer[m_audioBufferFill].l = sample;
-            m_audioBuffer[m_audioBufferFill].r = sample;
-            ++m_audioBufferFill;
-
-            if (m_audioBufferFill >= m_audioBuffer.size())
+            if (m_settings.m_ctcssOn && m_ctcssIndexSelected && (m_ctcssIndexSelected != m_ctcssIndex))
             {
-                uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
-
-                if (res != m_audioBufferFill)
-                {
-                    qDebug("NFMDemod::feed: %u/%u audio samples written", res, m_audioBufferFill);
+                sample = 0;
+            }
+            else
+            {
+                sample = m_bandpass.filter(m_squelchDelayLine.readBack(m_squelchGate)) * m_settings.m_volume;
+            }
+        }
+        else
+        {
+            if (m_ctcssIndex != 0)
+            {
+                if (getMessageQueueToGUI()) {
+                    MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(0);
+                    getMessageQueueToGUI()->push(msg);
                 }
 
-                m_audioBufferFill = 0;
+                m_ctcssIndex = 0;
             }
 
-            m_interpolatorDistanceRemain += m_interpolatorDistance;
+            sample = 0;
         }
-	}
+    }
 
-	if (m_audioBufferFill > 0)
-	{
-		uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
 
-		if (res != m_audioBufferFill)
-		{
-			qDebug("NFMDemod::feed: %u/%u tail samples written", res, m_audioBufferFill);
-		}
+    m_audioBuffer[m_audioBufferFill].l = sample;
+    m_audioBuffer[m_audioBufferFill].r = sample;
+    ++m_audioBufferFill;
 
-		m_audioBufferFill = 0;
-	}
+    if (m_audioBufferFill >= m_audioBuffer.size())
+    {
+        uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
 
-	m_settingsMutex.unlock();
+        if ((res != m_audioBufferFill) && m_audioFifoLog.occurrence(m_audioBufferFill - res))
+        {
+            qCDebug(dspLog, "NFMDemod::processOneSample: audio FIFO full: %llu samples lost in %u writes",
+                m_audioFifoLog.getAmount(), m_audioFifoLog.getOccurrences());
+        }
+
+        m_audioBufferFill = 0;
+    }
 }
 
 void NFMDemod::start()
@@ -574,7 +598,7 @@ void NFMDemod::applySettings(const NFMDemodSettings& settings, bool force)
         else
         { // input is a value in deci-Bels
             m_squelchLevel = std::pow(10.0, settings.m_squelch / 10.0);
-            m_movingAverage.reset();
+            m_magsqLevels.reset();
         }
 
         m_squelchCount = 0; // reset squelch open counter
@@ -620,20 +644,20 @@ QByteArray NFMDemod::serialize() const
 
 bool NFMDemod::deserialize(const QByteArray& data)
 {
-    bool success = true;
+    NFMDemodSettings settings;
+    bool success = settings.deserialize(data);
 
-    if (!m_settings.deserialize(data))
-    {
-        m_settings.resetToDefaults();
-        success = false;
+    if (!success) {
+        settings.resetToDefaults();
     }
 
     NFMDemod::MsgConfigureChannelizer* channelConfigMsg = NFMDemod::MsgConfigureChannelizer::create(
-            m_audioSampleRate, m_settings.m_inputFrequencyOffset);
+            m_audioSampleRate, settings.m_inputFrequencyOffset);
     m_inputMessageQueue.push(channelConfigMsg);
 
-    MsgConfigureNFMDemod *msg = MsgConfigureNFMDemod::create(m_settings, true);
-    m_inputMessageQueue.push(msg);
+    // Applied now so that serialize() and the web API see the new settings.
+    // Only the settings that differ from the running ones are applied to the DSP.
+    applySettings(settings, false);
 
     return success;
 }
@@ -775,6 +799,10 @@ void NFMDemod::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response
     response.getNfmDemodReport()->setSquelch(m_squelchOpen ? 1 : 0);
     response.getNfmDemodReport()->setAudioSampleRate(m_audioSampleRate);
     response.getNfmDemodReport()->setChannelSampleRate(m_inputSampleRate);
+
+    if (m_audioFifo.getLatency() >= 0) {
+        response.getNfmDemodReport()->setAudioLatency(m_audioFifo.getLatency());
+    }
 }
 
 void NFMDemod::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const NFMDemodSettings& settings, bool force)
@@ -830,39 +858,12 @@ void NFMDemod::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, co
         swgNFMDemodSettings->setAudioDeviceName(new QString(settings.m_audioDeviceName));
     }
 
-    QString channelSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/channel/%4/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString channelSettingsPath = QString("/sdrangel/deviceset/%1/channel/%2/settings")
             .arg(settings.m_reverseAPIDeviceIndex)
             .arg(settings.m_reverseAPIChannelIndex);
-    m_networkRequest.setUrl(QUrl(channelSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgChannelSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, channelSettingsPath, swgChannelSettings->asJson());
 
     delete swgChannelSettings;
 }
-
-void NFMDemod::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "NFMDemod::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
-    }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("NFMDemod::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
-}
@@ -21,11 +21,11 @@
 #include <vector>
 
 #include <QMutex>
-#include <QNetworkRequest>
 
 #include "dsp/basebandsamplesink.h"
 #include "channel/channelsinkapi.h"
 #include "dsp/phasediscri.h"
+#include "dsp/blockkernels.h"
 #include "dsp/nco.h"
 #include "dsp/interpolator.h"
 #include "dsp/lowpass.h"
@@ -35,13 +35,11 @@
 #include "dsp/ctcssdetector.h"
 #include "audio/audiofifo.h"
 #include "util/message.h"
-#include "util/movingaverage.h"
 #include "util/doublebufferfifo.h"
+#include "util/loglimiter.h"
 
 #include "nfmdemodsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class ThreadedBasebandSampleSink;
 class DownChannelizer;
@@ -159,36 +157,14 @@ public:
 
     void getMagSqLevels(double& avg, double& peak, int& nbSamples)
     {
-        if (m_magsqCount > 0)
-        {
-            m_magsq = m_magsqSum / m_magsqCount;
-            m_magSqLevelStore.m_magsq = m_magsq;
-            m_magSqLevelStore.m_magsqPeak = m_magsqPeak;
-        }
-
-        avg = m_magSqLevelStore.m_magsq;
-        peak = m_magSqLevelStore.m_magsqPeak;
-        nbSamples = m_magsqCount == 0 ? 1 : m_magsqCount;
-
-        m_magsqSum = 0.0f;
-        m_magsqPeak = 0.0f;
-        m_magsqCount = 0;
+        m_magsqLevels.getLevels(avg, peak, nbSamples);
+        m_magsq = avg;
     }
 
     static const QString m_channelIdURI;
     static const QString m_channelId;
 
 private:
-    struct MagSqLevelsStore
-    {
-        MagSqLevelsStore() :
-            m_magsq(1e-12),
-            m_magsqPeak(1e-12)
-        {}
-        double m_magsq;
-        double m_magsqPeak;
-    };
-
 	enum RateState {
 		RSInitialFill,
 		RSRunning
@@ -222,12 +198,7 @@ private:
 	bool m_squelchOpen;
 	bool m_afSquelchOpen;
 	double m_magsq; //!< displayed averaged value
-	double m_magsqSum;
-	double m_magsqPeak;
-    int  m_magsqCount;
-    MagSqLevelsStore m_magSqLevelStore;
-
-	MovingAverageUtil<Real, double, 32> m_movingAverage;
+	MagSqLevels m_magsqLevels; //!< moving average for the squelch and levels for the channel power report
 	AFSquelch m_afSquelch;
 	Real m_agcLevel; // AGC will aim to  this level
 	DoubleBufferFIFO<Real> m_squelchDelayLine;
@@ -235,26 +206,28 @@ private:
 	AudioVector m_audioBuffer;
 	uint m_audioBufferFill;
 	AudioFifo m_audioFifo;
+	LogLimiter m_audioFifoLog;
 
 	QMutex m_settingsMutex;
 
     PhaseDiscriminators m_phaseDiscri;
 
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
+    std::vector<Complex> m_channelSamples; //!< channel samples of the current feed
+    std::vector<Real> m_demodBuffer;
+    std::vector<Real> m_magsqBuffer;
+    std::vector<Real> m_magsqAverageBuffer;
 
     static const int m_udpBlockSize;
 
 //    void apply(bool force = false);
+    void processSamples(); //!< block processing of the channel samples of the current feed
+    void processOneSample(Real demod, Real average, bool afSquelchResult);
     void applyChannelSettings(int inputSampleRate, int inputFrequencyOffset, bool force = false);
     void applySettings(const NFMDemodSettings& settings, bool force = false);
     void applyAudioSampleRate(int sampleRate);
     void webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& response, const NFMDemodSettings& settings);
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const NFMDemodSettings& settings, bool force);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif // INCLUDE_NFMDEMOD_H
@@ -21,9 +21,6 @@
 
 #include <QTime>
 #include <QDebug>
-#include <QNetworkAccessManager>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include "SWGChannelSettings.h"
 #include "SWGSSBDemodSettings.h"
@@ -37,6 +34,7 @@
 #include "dsp/dspcommands.h"
 #include "device/devicesourceapi.h"
 #include "util/db.h"
+#include "webapi/webapireversedispatcher.h"
 
 #include "ssbdemod.h"
 
@@ -54,6 +52,7 @@ SSBDemod::SSBDemod(DeviceSourceAPI *deviceAPI) :
         m_audioFlipChannels(false),
         m_dsb(false),
         m_audioMute(false),
+        m_magsqLevels(1),
         m_agc(12000, agcTarget, 1e-2),
         m_agcActive(false),
         m_agcClamping(false),
@@ -85,9 +84,6 @@ SSBDemod::SSBDemod(DeviceSourceAPI *deviceAPI) :
 
 	m_usb = true;
 	m_magsq = 0.0f;
-	m_magsqSum = 0.0f;
-	m_magsqPeak = 0.0f;
-	m_magsqCount = 0;
 
 	m_agc.setClampMax(SDR_RX_SCALED/100.0);
 	m_agc.setClamping(m_agcClamping);
@@ -102,15 +98,10 @@ SSBDemod::SSBDemod(DeviceSourceAPI *deviceAPI) :
     m_threadedChannelizer = new ThreadedBasebandSampleSink(m_channelizer, this);
     m_deviceAPI->addThreadedSink(m_threadedChannelizer);
     m_deviceAPI->addChannelAPI(this);
-
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 SSBDemod::~SSBDemod()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
 	DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(&m_audioFifo);
 
 	m_deviceAPI->removeChannelAPI(this);
@@ -188,6 +179,17 @@ void SSBDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 			n_out = 0;
 		}
 
+		if (m_agcActive && (n_out > 0))
+		{
+		    if ((int) m_agcValues.size() < n_out)
+		    {
+		        m_agcValues.resize(n_out);
+		        m_agcStepValues.resize(n_out);
+		    }
+
+		    m_agc.feedAndGetValues(sideband, &m_agcValues[0], n_out, &m_agcStepValues[0]);
+		}
+
 		for (int i = 0; i < n_out; i++)
 		{
 			// Downsample by 2^(m_scaleLog2 - 1) for SSB band spectrum display
@@ -201,14 +203,7 @@ void SSBDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 				Real avgi = m_sum.imag() / decim;
 				m_magsq = (avgr * avgr + avgi * avgi) / (SDR_RX_SCALED*SDR_RX_SCALED);
 
-                m_magsqSum += m_magsq;
-
-                if (m_magsq > m_magsqPeak)
-                {
-                    m_magsqPeak = m_magsq;
-                }
-
-                m_magsqCount++;
+                m_magsqLevels.accumulate(m_magsq);
 
 				if (!m_dsb & !m_usb)
 				{ // invert spectrum for LSB
@@ -223,7 +218,7 @@ void SSBDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
                 m_sum.imag(0.0);
 			}
 
-            float agcVal = m_agcActive ? m_agc.feedAndGetValue(sideband[i]) : 10.0; // 10.0 for 3276.8, 1.0 for 327.68
+            float agcVal = m_agcActive ? m_agcValues[i] : 10.0; // 10.0 for 3276.8, 1.0 for 327.68
             fftfilt::cmplx& delayedSample = m_squelchDelayLine.readBack(m_agc.getStepDownDelay());
             m_audioActive = delayedSample.real() != 0.0;
             m_squelchDelayLine.write(sideband[i]*agcVal);
@@ -235,7 +230,7 @@ void SSBDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 			}
 			else
 			{
-			    fftfilt::cmplx z = delayedSample * m_agc.getStepValue();
+			    fftfilt::cmplx z = delayedSample * (m_agcActive ? m_agcStepValues[i] : m_agc.getStepValue());
 
 				if (m_audioBinaual)
 				{
@@ -634,19 +629,18 @@ QByteArray SSBDemod::serialize() const
 
 bool SSBDemod::deserialize(const QByteArray& data)
 {
-    if (m_settings.deserialize(data))
-    {
-        MsgConfigureSSBDemod *msg = MsgConfigureSSBDemod::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return true;
-    }
-    else
-    {
-        m_settings.resetToDefaults();
-        MsgConfigureSSBDemod *msg = MsgConfigureSSBDemod::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return false;
+    SSBDemodSettings settings;
+    bool success = settings.deserialize(data);
+
+    if (!success) {
+        settings.resetToDefaults();
     }
+
+    // Applied now so that serialize() and the web API see the new settings.
+    // Only the settings that differ from the running ones are applied to the DSP.
+    applySettings(settings, false);
+
+    return success;
 }
 
 int SSBDemod::webapiSettingsGet(
@@ -799,6 +793,10 @@ void SSBDemod::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response
     response.getSsbDemodReport()->setSquelch(m_audioActive ? 1 : 0);
     response.getSsbDemodReport()->setAudioSampleRate(m_audioSampleRate);
     response.getSsbDemodReport()->setChannelSampleRate(m_inputSampleRate);
+
+    if (m_audioFifo.getLatency() >= 0) {
+        response.getSsbDemodReport()->setAudioLatency(m_audioFifo.getLatency());
+    }
 }
 
 void SSBDemod::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const SSBDemodSettings& settings, bool force)
@@ -863,39 +861,12 @@ void SSBDemod::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, co
         swgSSBDemodSettings->setAudioDeviceName(new QString(settings.m_audioDeviceName));
     }
 
-    QString channelSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/channel/%4/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString channelSettingsPath = QString("/sdrangel/deviceset/%1/channel/%2/settings")
             .arg(settings.m_reverseAPIDeviceIndex)
             .arg(settings.m_reverseAPIChannelIndex);
-    m_networkRequest.setUrl(QUrl(channelSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgChannelSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, channelSettingsPath, swgChannelSettings->asJson());
 
     delete swgChannelSettings;
 }
-
-void SSBDemod::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "SSBDemod::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
-    }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("SSBDemod::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
-}
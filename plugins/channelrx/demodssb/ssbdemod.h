@@ -21,7 +21,6 @@
 #include <vector>
 
 #include <QMutex>
-#include <QNetworkRequest>
 
 #include "dsp/basebandsamplesink.h"
 #include "channel/channelsinkapi.h"
@@ -29,6 +28,7 @@
 #include "dsp/interpolator.h"
 #include "dsp/fftfilt.h"
 #include "dsp/agc.h"
+#include "dsp/blockkernels.h"
 #include "audio/audiofifo.h"
 #include "util/message.h"
 #include "util/doublebufferfifo.h"
@@ -38,8 +38,6 @@
 #define ssbFftLen 1024
 #define agcTarget 3276.8 // -10 dB amplitude => -20 dB power: center of normal signal
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class ThreadedBasebandSampleSink;
 class DownChannelizer;
@@ -131,20 +129,8 @@ public:
 
     void getMagSqLevels(double& avg, double& peak, int& nbSamples)
     {
-        if (m_magsqCount > 0)
-        {
-            m_magsq = m_magsqSum / m_magsqCount;
-            m_magSqLevelStore.m_magsq = m_magsq;
-            m_magSqLevelStore.m_magsqPeak = m_magsqPeak;
-        }
-
-        avg = m_magSqLevelStore.m_magsq;
-        peak = m_magSqLevelStore.m_magsqPeak;
-        nbSamples = m_magsqCount == 0 ? 1 : m_magsqCount;
-
-        m_magsqSum = 0.0f;
-        m_magsqPeak = 0.0f;
-        m_magsqCount = 0;
+        m_magsqLevels.getLevels(avg, peak, nbSamples);
+        m_magsq = avg;
     }
 
     virtual int webapiSettingsGet(
@@ -165,16 +151,6 @@ public:
     static const QString m_channelId;
 
 private:
-    struct MagSqLevelsStore
-    {
-        MagSqLevelsStore() :
-            m_magsq(1e-12),
-            m_magsqPeak(1e-12)
-        {}
-        double m_magsq;
-        double m_magsqPeak;
-    };
-
 	class MsgConfigureSSBDemodPrivate : public Message {
 		MESSAGE_CLASS_DECLARATION
 
@@ -287,11 +263,10 @@ private:
 	bool m_dsb;
 	bool m_audioMute;
 	double m_magsq;
-	double m_magsqSum;
-	double m_magsqPeak;
-    int  m_magsqCount;
-    MagSqLevelsStore m_magSqLevelStore;
+    MagSqLevels m_magsqLevels;  //!< levels for the channel power report
     MagAGC m_agc;
+    std::vector<Real> m_agcValues;
+    std::vector<Real> m_agcStepValues;
     bool m_agcActive;
     bool m_agcClamping;
     int m_agcNbSamples;         //!< number of audio (48 kHz) samples for AGC averaging
@@ -315,9 +290,6 @@ private:
 	AudioFifo m_audioFifo;
 	quint32 m_audioSampleRate;
 
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
-
 	QMutex m_settingsMutex;
 
 	void applyChannelSettings(int inputSampleRate, int inputFrequencyOffset, bool force = false);
@@ -326,9 +298,6 @@ private:
     void webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& response, const SSBDemodSettings& settings);
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const SSBDemodSettings& settings, bool force);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif // INCLUDE_SSBDEMOD_H
@@ -21,7 +21,6 @@
 #include <vector>
 
 #include <QMutex>
-#include <QNetworkRequest>
 
 #include "dsp/basebandsamplesink.h"
 #include "channel/channelsinkapi.h"
@@ -38,8 +37,6 @@
 
 #define rfFilterFftLength 1024
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class ThreadedBasebandSampleSink;
 class DownChannelizer;
 class DeviceSourceAPI;
@@ -208,9 +205,6 @@ private:
 
 	PhaseDiscriminators m_phaseDiscri;
 
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
-
     static const int m_udpBlockSize;
 
     void applyAudioSampleRate(int sampleRate);
@@ -220,9 +214,6 @@ private:
     void webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& response, const WFMDemodSettings& settings);
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const WFMDemodSettings& settings, bool force);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif // INCLUDE_WFMDEMOD_H
@@ -17,9 +17,6 @@
 
 #include <QUdpSocket>
 #include <QHostAddress>
-#include <QNetworkAccessManager>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include "SWGChannelSettings.h"
 #include "SWGUDPSinkSettings.h"
@@ -32,11 +29,10 @@
 #include "dsp/threadedbasebandsamplesink.h"
 #include "dsp/dspcommands.h"
 #include "device/devicesourceapi.h"
+#include "webapi/webapireversedispatcher.h"
 
 #include "udpsink.h"
 
-const Real UDPSink::m_agcTarget = 16384.0f;
-
 MESSAGE_CLASS_DEFINITION(UDPSink::MsgConfigureUDPSource, Message)
 MESSAGE_CLASS_DEFINITION(UDPSink::MsgConfigureChannelizer, Message)
 MESSAGE_CLASS_DEFINITION(UDPSink::MsgUDPSinkSpectrum, Message)
@@ -49,18 +45,8 @@ UDPSink::UDPSink(DeviceSourceAPI *deviceAPI) :
         m_deviceAPI(deviceAPI),
         m_inputSampleRate(48000),
         m_inputFrequencyOffset(0),
-        m_outMovingAverage(480, 1e-10),
-        m_inMovingAverage(480, 1e-10),
-        m_amMovingAverage(1200, 1e-10),
         m_audioFifo(24000),
         m_spectrum(0),
-        m_squelch(1e-6),
-        m_squelchOpen(false),
-        m_squelchOpenCount(0),
-        m_squelchCloseCount(0),
-        m_squelchGate(4800),
-        m_squelchRelease(4800),
-        m_agc(9600, m_agcTarget, 1e-6),
         m_settingsMutex(QMutex::Recursive)
 {
 	setObjectName(m_channelId);
@@ -68,29 +54,18 @@ UDPSink::UDPSink(DeviceSourceAPI *deviceAPI) :
 	m_udpBuffer16 = new UDPSinkUtil<Sample16>(this, udpBlockSize, m_settings.m_udpPort);
 	m_udpBufferMono16 = new UDPSinkUtil<int16_t>(this, udpBlockSize, m_settings.m_udpPort);
     m_udpBuffer24 = new UDPSinkUtil<Sample24>(this, udpBlockSize, m_settings.m_udpPort);
+    m_audioNetSink = new AudioNetSink(this);
+    m_useCodec = false;
 	m_audioSocket = new QUdpSocket(this);
 	m_udpAudioBuf = new char[m_udpAudioPayloadSize];
 
 	m_audioBuffer.resize(1<<9);
 	m_audioBufferFill = 0;
 
-	m_nco.setFreq(0, m_inputSampleRate);
-	m_interpolator.create(16, m_inputSampleRate, m_settings.m_rfBandwidth / 2.0);
-	m_sampleDistanceRemain = m_inputSampleRate / m_settings.m_outputSampleRate;
 	m_spectrumEnabled = false;
 	m_nextSSBId = 0;
 	m_nextS16leId = 0;
 
-	m_last = 0;
-	m_this = 0;
-	m_scale = 0;
-	m_magsq = 0;
-	m_inMagsq = 0;
-
-	UDPFilter = new fftfilt(0.0, (m_settings.m_rfBandwidth / 2.0) / m_settings.m_outputSampleRate, udpBlockSize);
-
-	m_phaseDiscri.setFMScaling((float) m_settings. m_outputSampleRate / (2.0f * m_settings.m_fmDeviation));
-
 	if (m_audioSocket->bind(QHostAddress::LocalHost, m_settings.m_audioPort))
 	{
 		qDebug("UDPSink::UDPSink: bind audio socket to port %d", m_settings.m_audioPort);
@@ -101,9 +76,6 @@ UDPSink::UDPSink(DeviceSourceAPI *deviceAPI) :
 		qWarning("UDPSink::UDPSink: cannot bind audio port");
 	}
 
-    m_agc.setClampMax(SDR_RX_SCALED*SDR_RX_SCALED);
-    m_agc.setClamping(true);
-
 	//DSPEngine::instance()->addAudioSink(&m_audioFifo);
 
     applyChannelSettings(m_inputSampleRate, m_inputFrequencyOffset, true);
@@ -113,26 +85,21 @@ UDPSink::UDPSink(DeviceSourceAPI *deviceAPI) :
     m_threadedChannelizer = new ThreadedBasebandSampleSink(m_channelizer, this);
     m_deviceAPI->addThreadedSink(m_threadedChannelizer);
     m_deviceAPI->addChannelAPI(this);
-
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 UDPSink::~UDPSink()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
 	delete m_audioSocket;
 	delete m_udpBuffer24;
     delete m_udpBuffer16;
     delete m_udpBufferMono16;
+    delete m_audioNetSink;
 	delete[] m_udpAudioBuf;
 	DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(&m_audioFifo);
 	m_deviceAPI->removeChannelAPI(this);
     m_deviceAPI->removeThreadedSink(m_threadedChannelizer);
     delete m_threadedChannelizer;
     delete m_channelizer;
-    delete UDPFilter;
 }
 
 void UDPSink::setSpectrum(MessageQueue* messageQueue, bool enabled)
@@ -143,194 +110,65 @@ void UDPSink::setSpectrum(MessageQueue* messageQueue, bool enabled)
 
 void UDPSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
 {
-	Complex ci;
-	fftfilt::cmplx* sideband;
-	double l, r;
-
-	m_sampleBuffer.clear();
 	m_settingsMutex.lock();
 
-	for(SampleVector::const_iterator it = begin; it < end; ++it)
-	{
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
-
-		if(m_interpolator.decimate(&m_sampleDistanceRemain, c, &ci))
-		{
-		    double inMagSq;
-		    double agcFactor = 1.0;
-
-            if ((m_settings.m_agc) &&
-                (m_settings.m_sampleFormat != UDPSinkSettings::FormatNFM) &&
-                (m_settings.m_sampleFormat != UDPSinkSettings::FormatNFMMono) &&
-                (m_settings.m_sampleFormat != UDPSinkSettings::FormatIQ16) &&
-                (m_settings.m_sampleFormat != UDPSinkSettings::FormatIQ24))
-            {
-                agcFactor = m_agc.feedAndGetValue(ci);
-                inMagSq = m_agc.getMagSq();
-            }
-            else
-            {
-                inMagSq = ci.real()*ci.real() + ci.imag()*ci.imag();
-            }
-
-		    m_inMovingAverage.feed(inMagSq / (SDR_RX_SCALED*SDR_RX_SCALED));
-		    m_inMagsq = m_inMovingAverage.average();
-
-			Sample ss(ci.real(), ci.imag());
-			m_sampleBuffer.push_back(ss);
-
-			m_sampleDistanceRemain += m_inputSampleRate / m_settings.m_outputSampleRate;
-
-			calculateSquelch(m_inMagsq);
-
-			if (m_settings.m_sampleFormat == UDPSinkSettings::FormatLSB) // binaural LSB
-			{
-			    ci *= agcFactor;
-				int n_out = UDPFilter->runSSB(ci, &sideband, false);
-
-				if (n_out)
-				{
-					for (int i = 0; i < n_out; i++)
-					{
-						l = m_squelchOpen ? sideband[i].real() * m_settings.m_gain : 0;
-						r = m_squelchOpen ? sideband[i].imag() * m_settings.m_gain : 0;
-						udpWrite(l, r);
-					    m_outMovingAverage.feed((l*l + r*r) / (SDR_RX_SCALED*SDR_RX_SCALED));
-					}
-				}
-			}
-			if (m_settings.m_sampleFormat == UDPSinkSettings::FormatUSB) // binaural USB
-			{
-			    ci *= agcFactor;
-				int n_out = UDPFilter->runSSB(ci, &sideband, true);
-
-				if (n_out)
-				{
-					for (int i = 0; i < n_out; i++)
-					{
-						l = m_squelchOpen ? sideband[i].real() * m_settings.m_gain : 0;
-						r = m_squelchOpen ? sideband[i].imag() * m_settings.m_gain : 0;
-                        udpWrite(l, r);
-						m_outMovingAverage.feed((l*l + r*r) / (SDR_RX_SCALED*SDR_RX_SCALED));
-					}
-				}
-			}
-			else if (m_settings.m_sampleFormat == UDPSinkSettings::FormatNFM)
-			{
-                Real discri = m_squelchOpen ? m_phaseDiscri.phaseDiscriminator(ci) * m_settings.m_gain : 0;
-				udpWriteNorm(discri, discri);
-				m_outMovingAverage.feed(discri*discri);
-			}
-			else if (m_settings.m_sampleFormat == UDPSinkSettings::FormatNFMMono)
-			{
-			    Real discri = m_squelchOpen ? m_phaseDiscri.phaseDiscriminator(ci) * m_settings.m_gain : 0;
-				udpWriteNormMono(discri);
-				m_outMovingAverage.feed(discri*discri);
-			}
-			else if (m_settings.m_sampleFormat == UDPSinkSettings::FormatLSBMono) // Monaural LSB
-			{
-			    ci *= agcFactor;
-				int n_out = UDPFilter->runSSB(ci, &sideband, false);
-
-				if (n_out)
-				{
-					for (int i = 0; i < n_out; i++)
-					{
-						l = m_squelchOpen ? (sideband[i].real() + sideband[i].imag()) * 0.7 * m_settings.m_gain : 0;
-		                udpWriteMono(l);
-						m_outMovingAverage.feed((l * l) / (SDR_RX_SCALED*SDR_RX_SCALED));
-					}
-				}
-			}
-			else if (m_settings.m_sampleFormat == UDPSinkSettings::FormatUSBMono) // Monaural USB
-			{
-			    ci *= agcFactor;
-				int n_out = UDPFilter->runSSB(ci, &sideband, true);
-
-				if (n_out)
-				{
-					for (int i = 0; i < n_out; i++)
-					{
-						l = m_squelchOpen ? (sideband[i].real() + sideband[i].imag()) * 0.7 * m_settings.m_gain : 0;
-                        udpWriteMono(l);
-						m_outMovingAverage.feed((l * l) / (SDR_RX_SCALED*SDR_RX_SCALED));
-					}
-				}
-			}
-			else if (m_settings.m_sampleFormat == UDPSinkSettings::FormatAMMono)
-			{
-			    Real amplitude = m_squelchOpen ? sqrt(inMagSq) * agcFactor * m_settings.m_gain : 0;
-				FixReal demod = (FixReal) amplitude;
-                udpWriteMono(demod);
-				m_outMovingAverage.feed((amplitude/SDR_RX_SCALEF)*(amplitude/SDR_RX_SCALEF));
-			}
-            else if (m_settings.m_sampleFormat == UDPSinkSettings::FormatAMNoDCMono)
-            {
-                if (m_squelchOpen)
-                {
-                    double demodf = sqrt(inMagSq);
-                    m_amMovingAverage.feed(demodf);
-                    Real amplitude = (demodf - m_amMovingAverage.average()) * agcFactor * m_settings.m_gain;
-                    FixReal demod = (FixReal) amplitude;
-                    udpWriteMono(demod);
-                    m_outMovingAverage.feed((amplitude/SDR_RX_SCALEF)*(amplitude/SDR_RX_SCALEF));
-                }
-                else
-                {
-                    udpWriteMono(0);
-                    m_outMovingAverage.feed(0);
-                }
-            }
-            else if (m_settings.m_sampleFormat == UDPSinkSettings::FormatAMBPFMono)
-            {
-                if (m_squelchOpen)
-                {
-                    double demodf = sqrt(inMagSq);
-                    demodf = m_bandpass.filter(demodf);
-                    demodf /= 301.0;
-                    Real amplitude = demodf * agcFactor * m_settings.m_gain;
-                    FixReal demod = (FixReal) amplitude;
-                    udpWriteMono(demod);
-                    m_outMovingAverage.feed((amplitude/SDR_RX_SCALEF)*(amplitude/SDR_RX_SCALEF));
-                }
-                else
-                {
-                    udpWriteMono(0);
-                    m_outMovingAverage.feed(0);
-                }
-            }
-			else // Raw I/Q samples
-			{
-			    if (m_squelchOpen)
-			    {
-	                udpWrite(ci.real() * m_settings.m_gain, ci.imag() * m_settings.m_gain);
-	                m_outMovingAverage.feed((inMagSq*m_settings.m_gain*m_settings.m_gain) / (SDR_RX_SCALED*SDR_RX_SCALED));
-			    }
-			    else
-			    {
-	                udpWrite(0, 0);
-	                m_outMovingAverage.feed(0);
-			    }
-			}
-
-            m_magsq = m_outMovingAverage.average();
-		}
-	}
-
-	//qDebug() << "UDPSink::feed: " << m_sampleBuffer.size() * 4;
+	m_pipeline.process(begin, end);
+	sendOutput();
 
 	if((m_spectrum != 0) && (m_spectrumEnabled))
 	{
-		m_spectrum->feed(m_sampleBuffer.begin(), m_sampleBuffer.end(), positiveOnly);
+		const SampleVector& channelSamples = m_pipeline.getChannelSamples();
+		m_spectrum->feed(channelSamples.begin(), channelSamples.end(), positiveOnly);
 	}
 
 	m_settingsMutex.unlock();
 }
 
+void UDPSink::sendOutput()
+{
+    int nbSamples = m_pipeline.getNbOutputSamples();
+
+    if (nbSamples == 0) {
+        return;
+    }
+
+    switch (m_pipeline.getOutputType())
+    {
+    case UDPSinkPipeline::OutputS24Pairs:
+        m_udpBuffer24->write(m_pipeline.getOutputS24Pairs(), nbSamples);
+        break;
+    case UDPSinkPipeline::OutputS16Mono:
+        if (m_useCodec) {
+            m_audioNetSink->write(m_pipeline.getOutputS16Mono(), nbSamples);
+        } else {
+            m_udpBufferMono16->write(m_pipeline.getOutputS16Mono(), nbSamples);
+        }
+        break;
+    case UDPSinkPipeline::OutputS16Pairs:
+    default:
+        if (m_useCodec) { // stereo audio as interleaved left and right
+            m_audioNetSink->write((const qint16 *) m_pipeline.getOutputS16Pairs(), 2*nbSamples);
+        } else {
+            m_udpBuffer16->write(m_pipeline.getOutputS16Pairs(), nbSamples);
+        }
+        break;
+    }
+}
+
+void UDPSink::getUDPRates(float& packetRate, float& byteRate)
+{
+    float packetRates[4], byteRates[4];
+    m_udpBuffer16->getFanOut().getRates(packetRates[0], byteRates[0]);
+    m_udpBufferMono16->getFanOut().getRates(packetRates[1], byteRates[1]);
+    m_udpBuffer24->getFanOut().getRates(packetRates[2], byteRates[2]);
+    m_audioNetSink->getRates(packetRates[3], byteRates[3]);
+    packetRate = packetRates[0] + packetRates[1] + packetRates[2] + packetRates[3];
+    byteRate = byteRates[0] + byteRates[1] + byteRates[2] + byteRates[3];
+}
+
 void UDPSink::start()
 {
-	m_phaseDiscri.reset();
+	m_pipeline.resetDemodulator();
 	applyChannelSettings(m_inputSampleRate, m_inputFrequencyOffset, true);
 }
 
@@ -476,15 +314,9 @@ void UDPSink::applyChannelSettings(int inputSampleRate, int inputFrequencyOffset
 
     if((inputFrequencyOffset != m_inputFrequencyOffset) ||
         (inputSampleRate != m_inputSampleRate) || force)
-    {
-        m_nco.setFreq(-inputFrequencyOffset, inputSampleRate);
-    }
-
-    if ((inputSampleRate != m_inputSampleRate) || force)
     {
         m_settingsMutex.lock();
-        m_interpolator.create(16, inputSampleRate, m_settings.m_rfBandwidth / 2.0);
-        m_sampleDistanceRemain = inputSampleRate / m_settings.m_outputSampleRate;
+        m_pipeline.setInput(inputSampleRate, inputFrequencyOffset);
         m_settingsMutex.unlock();
     }
 
@@ -511,6 +343,8 @@ void UDPSink::applySettings(const UDPSinkSettings& settings, bool force)
             << " m_udpAddressStr: " << settings.m_udpAddress
             << " m_udpPort: " << settings.m_udpPort
             << " m_audioPort: " << settings.m_audioPort
+            << " m_audioCodec: " << (int) settings.m_audioCodec
+            << " m_audioDTX: " << settings.m_audioDTX
             << " force: " << force;
 
     QList<QString> reverseAPIKeys;
@@ -524,6 +358,12 @@ void UDPSink::applySettings(const UDPSinkSettings& settings, bool force)
     if ((settings.m_audioStereo != m_settings.m_audioStereo) || force) {
         reverseAPIKeys.append("audioStereo");
     }
+    if ((settings.m_audioCodec != m_settings.m_audioCodec) || force) {
+        reverseAPIKeys.append("audioCodec");
+    }
+    if ((settings.m_audioDTX != m_settings.m_audioDTX) || force) {
+        reverseAPIKeys.append("audioDTX");
+    }
     if ((settings.m_gain != m_settings.m_gain) || force) {
         reverseAPIKeys.append("gain");
     }
@@ -566,39 +406,33 @@ void UDPSink::applySettings(const UDPSinkSettings& settings, bool force)
 
     m_settingsMutex.lock();
 
-    if ((settings.m_inputFrequencyOffset != m_settings.m_inputFrequencyOffset) ||
+    if ((settings.m_sampleFormat != m_settings.m_sampleFormat) ||
         (settings.m_rfBandwidth != m_settings.m_rfBandwidth) ||
-        (settings.m_outputSampleRate != m_settings.m_outputSampleRate) || force)
+        (settings.m_outputSampleRate != m_settings.m_outputSampleRate) ||
+        (settings.m_fmDeviation != m_settings.m_fmDeviation) ||
+        (settings.m_squelchGate != m_settings.m_squelchGate) || force)
     {
-        m_interpolator.create(16, m_inputSampleRate, settings.m_rfBandwidth / 2.0);
-        m_sampleDistanceRemain = m_inputSampleRate / settings.m_outputSampleRate;
-
-        if ((settings.m_sampleFormat == UDPSinkSettings::FormatLSB) ||
-            (settings.m_sampleFormat == UDPSinkSettings::FormatLSBMono) ||
-            (settings.m_sampleFormat == UDPSinkSettings::FormatUSB) ||
-            (settings.m_sampleFormat == UDPSinkSettings::FormatUSBMono))
-        {
-            m_squelchGate = settings.m_outputSampleRate * 0.05;
-        }
-        else
-        {
-            m_squelchGate = (settings.m_outputSampleRate * settings.m_squelchGate) / 100;
-        }
-
-        m_squelchRelease = (settings.m_outputSampleRate * settings.m_squelchGate) / 100;
-        initSquelch(m_squelchOpen);
-        m_agc.resize(settings.m_outputSampleRate/5, settings.m_outputSampleRate/20, m_agcTarget); // Fixed 200 ms
-        int stepDownDelay =  (settings.m_outputSampleRate * (settings.m_squelchGate == 0 ? 1 : settings.m_squelchGate))/100;
-        m_agc.setStepDownDelay(stepDownDelay);
-        m_agc.setGate(settings.m_outputSampleRate * 0.05);
-
-        m_bandpass.create(301, settings.m_outputSampleRate, 300.0, settings.m_rfBandwidth / 2.0f);
+        m_pipeline.setFormat((UDPSinkPipeline::Format) settings.m_sampleFormat,
+            settings.m_outputSampleRate,
+            settings.m_rfBandwidth,
+            settings.m_fmDeviation,
+            settings.m_squelchGate);
+    }
 
-        m_inMovingAverage.resize(settings.m_outputSampleRate * 0.01, 1e-10);  // 10 ms
-        m_amMovingAverage.resize(settings.m_outputSampleRate * 0.005, 1e-10); //  5 ms
-        m_outMovingAverage.resize(settings.m_outputSampleRate * 0.01, 1e-10); // 10 ms
+    if ((settings.m_squelchEnabled != m_settings.m_squelchEnabled) ||
+        (settings.m_squelchdB != m_settings.m_squelchdB) || force)
+    {
+        m_pipeline.setSquelch(settings.m_squelchEnabled, settings.m_squelchdB);
     }
 
+    m_pipeline.setGain(settings.m_gain);
+    m_pipeline.setAGC(settings.m_agc &&
+        (settings.m_sampleFormat != UDPSinkSettings::FormatNFM) &&
+        (settings.m_sampleFormat != UDPSinkSettings::FormatNFMMono) &&
+        (settings.m_sampleFormat != UDPSinkSettings::FormatIQ16) &&
+        (settings.m_sampleFormat != UDPSinkSettings::FormatIQ24));
+    m_pipeline.setDTX(settings.m_audioDTX);
+
     if ((settings.m_audioActive != m_settings.m_audioActive) || force)
     {
         if (settings.m_audioActive)
@@ -612,32 +446,6 @@ void UDPSink::applySettings(const UDPSinkSettings& settings, bool force)
         }
     }
 
-    if ((settings.m_squelchGate != m_settings.m_squelchGate) || force)
-    {
-        if ((settings.m_sampleFormat == UDPSinkSettings::FormatLSB) ||
-            (settings.m_sampleFormat == UDPSinkSettings::FormatLSBMono) ||
-            (settings.m_sampleFormat == UDPSinkSettings::FormatUSB) ||
-            (settings.m_sampleFormat == UDPSinkSettings::FormatUSBMono))
-        {
-            m_squelchGate = settings.m_outputSampleRate * 0.05;
-        }
-        else
-        {
-            m_squelchGate = (settings.m_outputSampleRate * settings.m_squelchGate)/100;
-        }
-
-        m_squelchRelease = (settings.m_outputSampleRate * settings.m_squelchGate)/100;
-        initSquelch(m_squelchOpen);
-        int stepDownDelay =  (settings.m_outputSampleRate * (settings.m_squelchGate == 0 ? 1 : settings.m_squelchGate))/100;
-        m_agc.setStepDownDelay(stepDownDelay); // same delay for up and down
-    }
-
-    if ((settings.m_squelchdB != m_settings.m_squelchdB) || force)
-    {
-        m_squelch = CalcDb::powerFromdB(settings.m_squelchdB);
-        m_agc.setThreshold(m_squelch*(1<<23));
-    }
-
     if ((settings.m_udpAddress != m_settings.m_udpAddress) || force)
     {
         m_udpBuffer16->setAddress(const_cast<QString&>(settings.m_udpAddress));
@@ -652,6 +460,25 @@ void UDPSink::applySettings(const UDPSinkSettings& settings, bool force)
         m_udpBuffer24->setPort(settings.m_udpPort);
     }
 
+    if ((settings.m_udpAddress != m_settings.m_udpAddress) ||
+        (settings.m_udpPort != m_settings.m_udpPort) || force)
+    {
+        m_audioNetSink->setDestination(settings.m_udpAddress, settings.m_udpPort);
+    }
+
+    if ((settings.m_audioCodec != m_settings.m_audioCodec) ||
+        (settings.m_sampleFormat != m_settings.m_sampleFormat) ||
+        (settings.m_outputSampleRate != m_settings.m_outputSampleRate) || force)
+    {
+        bool audioFormat = (settings.m_sampleFormat != UDPSinkSettings::FormatIQ16) &&
+            (settings.m_sampleFormat != UDPSinkSettings::FormatIQ24);
+        bool stereo = (settings.m_sampleFormat == UDPSinkSettings::FormatNFM) ||
+            (settings.m_sampleFormat == UDPSinkSettings::FormatLSB) ||
+            (settings.m_sampleFormat == UDPSinkSettings::FormatUSB);
+        m_audioNetSink->setParameters(stereo, settings.m_outputSampleRate);
+        m_useCodec = audioFormat && (settings.m_audioCodec != AudioCodec::CodecL16) && m_audioNetSink->setCodec(settings.m_audioCodec);
+    }
+
     if ((settings.m_audioPort != m_settings.m_audioPort) || force)
     {
         disconnect(m_audioSocket, SIGNAL(readyRead()), this, SLOT(audioReadyRead()));
@@ -669,11 +496,6 @@ void UDPSink::applySettings(const UDPSinkSettings& settings, bool force)
         }
     }
 
-    if ((settings.m_fmDeviation != m_settings.m_fmDeviation) || force)
-    {
-        m_phaseDiscri.setFMScaling((float) settings.m_outputSampleRate / (2.0f * settings.m_fmDeviation));
-    }
-
     m_settingsMutex.unlock();
 
     if (settings.m_useReverseAPI)
@@ -696,19 +518,18 @@ QByteArray UDPSink::serialize() const
 
 bool UDPSink::deserialize(const QByteArray& data)
 {
-    if (m_settings.deserialize(data))
-    {
-        MsgConfigureUDPSource *msg = MsgConfigureUDPSource::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return true;
-    }
-    else
-    {
-        m_settings.resetToDefaults();
-        MsgConfigureUDPSource *msg = MsgConfigureUDPSource::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return false;
+    UDPSinkSettings settings;
+    bool success = settings.deserialize(data);
+
+    if (!success) {
+        settings.resetToDefaults();
     }
+
+    // Applied now so that serialize() and the web API see the new settings.
+    // Only the settings that differ from the running ones are applied to the DSP.
+    applySettings(settings, false);
+
+    return success;
 }
 
 int UDPSink::webapiSettingsGet(
@@ -773,6 +594,15 @@ int UDPSink::webapiSettingsPutPatch(
     if (channelSettingsKeys.contains("audioStereo")) {
         settings.m_audioStereo = response.getUdpSinkSettings()->getAudioStereo() != 0;
     }
+    if (channelSettingsKeys.contains("audioCodec"))
+    {
+        int audioCodec = response.getUdpSinkSettings()->getAudioCodec();
+        settings.m_audioCodec = (audioCodec >= 0) && (audioCodec <= (int) AudioCodec::CodecOpus) ?
+            (AudioCodec::Codec) audioCodec : AudioCodec::CodecL16;
+    }
+    if (channelSettingsKeys.contains("audioDTX")) {
+        settings.m_audioDTX = response.getUdpSinkSettings()->getAudioDtx() != 0;
+    }
     if (channelSettingsKeys.contains("volume")) {
         settings.m_volume = response.getUdpSinkSettings()->getVolume();
     }
@@ -841,6 +671,8 @@ void UDPSink::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& respo
     response.getUdpSinkSettings()->setAgc(settings.m_agc ? 1 : 0);
     response.getUdpSinkSettings()->setAudioActive(settings.m_audioActive ? 1 : 0);
     response.getUdpSinkSettings()->setAudioStereo(settings.m_audioStereo ? 1 : 0);
+    response.getUdpSinkSettings()->setAudioCodec((int) settings.m_audioCodec);
+    response.getUdpSinkSettings()->setAudioDtx(settings.m_audioDTX ? 1 : 0);
     response.getUdpSinkSettings()->setVolume(settings.m_volume);
 
     if (response.getUdpSinkSettings()->getUdpAddress()) {
@@ -864,7 +696,7 @@ void UDPSink::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response)
 {
     response.getUdpSinkReport()->setChannelPowerDb(CalcDb::dbPower(getInMagSq()));
     response.getUdpSinkReport()->setOutputPowerDb(CalcDb::dbPower(getMagSq()));
-    response.getUdpSinkReport()->setSquelch(m_squelchOpen ? 1 : 0);
+    response.getUdpSinkReport()->setSquelch(getSquelchOpen() ? 1 : 0);
     response.getUdpSinkReport()->setInputSampleRate(m_inputSampleRate);
 }
 
@@ -917,6 +749,12 @@ void UDPSink::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, con
     if (channelSettingsKeys.contains("audioStereo") || force) {
         swgUDPSinkSettings->setAudioStereo(settings.m_audioStereo ? 1 : 0);
     }
+    if (channelSettingsKeys.contains("audioCodec") || force) {
+        swgUDPSinkSettings->setAudioCodec((int) settings.m_audioCodec);
+    }
+    if (channelSettingsKeys.contains("audioDTX") || force) {
+        swgUDPSinkSettings->setAudioDtx(settings.m_audioDTX ? 1 : 0);
+    }
     if (channelSettingsKeys.contains("volume") || force) {
         swgUDPSinkSettings->setVolume(settings.m_volume);
     }
@@ -936,39 +774,12 @@ void UDPSink::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, con
         swgUDPSinkSettings->setTitle(new QString(settings.m_title));
     }
 
-    QString channelSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/channel/%4/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString channelSettingsPath = QString("/sdrangel/deviceset/%1/channel/%2/settings")
             .arg(settings.m_reverseAPIDeviceIndex)
             .arg(settings.m_reverseAPIChannelIndex);
-    m_networkRequest.setUrl(QUrl(channelSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgChannelSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, channelSettingsPath, swgChannelSettings->asJson());
 
     delete swgChannelSettings;
 }
-
-void UDPSink::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "UDPSink::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
-    }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("UDPSink::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
-}
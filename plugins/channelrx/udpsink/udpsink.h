@@ -20,25 +20,17 @@
 
 #include <QMutex>
 #include <QHostAddress>
-#include <QNetworkRequest>
 
 #include "dsp/basebandsamplesink.h"
 #include "channel/channelsinkapi.h"
-#include "dsp/nco.h"
-#include "dsp/fftfilt.h"
-#include "dsp/interpolator.h"
-#include "dsp/phasediscri.h"
-#include "dsp/movingaverage.h"
-#include "dsp/agc.h"
-#include "dsp/bandpass.h"
+#include "dsp/udpsinkpipeline.h"
 #include "util/udpsinkutil.h"
+#include "audio/audionetsink.h"
 #include "util/message.h"
 #include "audio/audiofifo.h"
 
 #include "udpsinksettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class QUdpSocket;
 class DeviceSourceAPI;
 class ThreadedBasebandSampleSink;
@@ -101,9 +93,10 @@ public:
 	void setSpectrum(BasebandSampleSink* spectrum) { m_spectrum = spectrum; }
 
 	void setSpectrum(MessageQueue* messageQueue, bool enabled);
-	double getMagSq() const { return m_magsq; }
-	double getInMagSq() const { return m_inMagsq; }
-	bool getSquelchOpen() const { return m_squelchOpen; }
+	double getMagSq() const { return m_pipeline.getMagSq(); }
+	double getInMagSq() const { return m_pipeline.getInMagSq(); }
+	bool getSquelchOpen() const { return m_pipeline.getSquelchOpen(); }
+	void getUDPRates(float& packetRate, float& byteRate); //!< sent since the previous call
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
 	virtual void start();
@@ -139,7 +132,6 @@ public slots:
     void audioReadyRead();
 
 private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 
 protected:
 	class MsgUDPSinkSpectrum : public Message {
@@ -162,21 +154,8 @@ protected:
 		{ }
 	};
 
-	struct Sample16
-	{
-	    Sample16() : m_r(0), m_i(0) {}
-	    Sample16(int16_t r, int16_t i) : m_r(r), m_i(i) {}
-	    int16_t m_r;
-	    int16_t m_i;
-	};
-
-    struct Sample24
-    {
-	    Sample24() : m_r(0), m_i(0) {}
-	    Sample24(int32_t r, int32_t i) : m_r(r), m_i(i) {}
-        int32_t m_r;
-        int32_t m_i;
-    };
+    typedef UDPSinkPipeline::Sample16 Sample16;
+    typedef UDPSinkPipeline::Sample24 Sample24;
 
     DeviceSourceAPI *m_deviceAPI;
     ThreadedBasebandSampleSink* m_threadedChannelizer;
@@ -188,24 +167,13 @@ protected:
 
 	QUdpSocket *m_audioSocket;
 
-	double m_magsq;
-    double m_inMagsq;
-    MovingAverage<double> m_outMovingAverage;
-    MovingAverage<double> m_inMovingAverage;
-    MovingAverage<double> m_amMovingAverage;
-
-	Real m_scale;
-	Complex m_last, m_this;
+    UDPSinkPipeline m_pipeline; //!< channel processing of the selected format
 
-	NCO m_nco;
-	Interpolator m_interpolator;
-	Real m_sampleDistanceRemain;
-	fftfilt* UDPFilter;
-
-	SampleVector m_sampleBuffer;
 	UDPSinkUtil<Sample16> *m_udpBuffer16;
 	UDPSinkUtil<int16_t> *m_udpBufferMono16;
     UDPSinkUtil<Sample24> *m_udpBuffer24;
+    AudioNetSink *m_audioNetSink; //!< compressed audio formats
+    bool m_useCodec;
 
 	AudioVector m_audioBuffer;
 	uint m_audioBufferFill;
@@ -219,22 +187,6 @@ protected:
 
 	char *m_udpAudioBuf;
 	static const int m_udpAudioPayloadSize = 8192; //!< UDP audio samples buffer. No UDP block on Earth is larger than this
-    static const Real m_agcTarget;
-
-    PhaseDiscriminators m_phaseDiscri;
-
-    double m_squelch;
-    bool m_squelchOpen;
-    int  m_squelchOpenCount;
-    int  m_squelchCloseCount;
-    int  m_squelchGate; //!< number of samples computed from given gate
-    int  m_squelchRelease;
-
-    MagAGC m_agc;
-    Bandpass<double> m_bandpass;
-
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
 	QMutex m_settingsMutex;
 
@@ -245,110 +197,7 @@ protected:
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const UDPSinkSettings& settings, bool force);
 
-    inline void calculateSquelch(double value)
-    {
-        if ((!m_settings.m_squelchEnabled) || (value > m_squelch))
-        {
-            if (m_squelchGate == 0)
-            {
-                m_squelchOpen = true;
-            }
-            else
-            {
-                if (m_squelchOpenCount < m_squelchGate)
-                {
-                    m_squelchOpenCount++;
-                }
-                else
-                {
-                    m_squelchCloseCount = m_squelchRelease;
-                    m_squelchOpen = true;
-                }
-            }
-        }
-        else
-        {
-            if (m_squelchGate == 0)
-            {
-                m_squelchOpen = false;
-            }
-            else
-            {
-                if (m_squelchCloseCount > 0)
-                {
-                    m_squelchCloseCount--;
-                }
-                else
-                {
-                    m_squelchOpenCount = 0;
-                    m_squelchOpen = false;
-                }
-            }
-        }
-    }
-
-    inline void initSquelch(bool open)
-    {
-        if (open)
-        {
-            m_squelchOpen = true;
-            m_squelchOpenCount = m_squelchGate;
-            m_squelchCloseCount = m_squelchRelease;
-        }
-        else
-        {
-            m_squelchOpen = false;
-            m_squelchOpenCount = 0;
-            m_squelchCloseCount = 0;
-        }
-    }
-
-    void udpWrite(FixReal real, FixReal imag)
-    {
-        if (SDR_RX_SAMP_SZ == 16)
-        {
-            if (m_settings.m_sampleFormat == UDPSinkSettings::FormatIQ16) {
-                m_udpBuffer16->write(Sample16(real, imag));
-            } else if (m_settings.m_sampleFormat == UDPSinkSettings::FormatIQ24) {
-                m_udpBuffer24->write(Sample24(real<<8, imag<<8));
-            } else {
-                m_udpBuffer16->write(Sample16(real, imag));
-            }
-        }
-        else if (SDR_RX_SAMP_SZ == 24)
-        {
-            if (m_settings.m_sampleFormat == UDPSinkSettings::FormatIQ16) {
-                m_udpBuffer16->write(Sample16(real>>8, imag>>8));
-            } else if (m_settings.m_sampleFormat == UDPSinkSettings::FormatIQ24) {
-                m_udpBuffer24->write(Sample24(real, imag));
-            } else {
-                m_udpBuffer16->write(Sample16(real>>8, imag>>8));
-            }
-        }
-    }
-
-    void udpWriteMono(FixReal sample)
-    {
-        if (SDR_RX_SAMP_SZ == 16)
-        {
-            m_udpBufferMono16->write(sample);
-        }
-        else if (SDR_RX_SAMP_SZ == 24)
-        {
-            m_udpBufferMono16->write(sample>>8);
-        }
-    }
-
-    void udpWriteNorm(Real real, Real imag)
-    {
-        m_udpBuffer16->write(Sample16(real*32768.0, imag*32768.0));
-    }
-
-    void udpWriteNormMono(Real sample)
-    {
-        m_udpBufferMono16->write(sample*32768.0);
-    }
-
+    void sendOutput();
 };
 
 #endif // INCLUDE_UDPSRC_H
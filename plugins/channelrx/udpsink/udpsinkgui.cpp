@@ -141,6 +141,11 @@ void UDPSinkGUI::tick()
         m_inPowerAvg.feed(m_udpSink->getInMagSq());
         double inPowDb = CalcDb::dbPower(m_inPowerAvg.average());
         ui->inputPower->setText(QString::number(inPowDb, 'f', 1));
+        float packetRate, byteRate;
+        m_udpSink->getUDPRates(packetRate, byteRate);
+        ui->channelPower->setToolTip(tr("Channel output power (dB)\nUDP: %1 packets/s %2 kB/s")
+                .arg(packetRate, 0, 'f', 0)
+                .arg(byteRate / 1000.0f, 0, 'f', 1));
     }
 
     if (m_udpSink->getSquelchOpen()) {
@@ -272,6 +277,8 @@ void UDPSinkGUI::displaySettings()
     ui->fmDeviation->setText(QString("%1").arg(m_settings.m_fmDeviation, 0));
 
     ui->agc->setChecked(m_settings.m_agc);
+    ui->audioCodec->setCurrentIndex((int) m_settings.m_audioCodec);
+    ui->audioDTX->setChecked(m_settings.m_audioDTX);
     ui->audioActive->setChecked(m_settings.m_audioActive);
     ui->audioStereo->setChecked(m_settings.m_audioStereo);
 
@@ -565,6 +572,18 @@ void UDPSinkGUI::on_agc_toggled(bool agc)
     applySettingsImmediate();
 }
 
+void UDPSinkGUI::on_audioCodec_currentIndexChanged(int index)
+{
+    m_settings.m_audioCodec = (AudioCodec::Codec) index;
+    applySettingsImmediate();
+}
+
+void UDPSinkGUI::on_audioDTX_toggled(bool checked)
+{
+    m_settings.m_audioDTX = checked;
+    applySettingsImmediate();
+}
+
 void UDPSinkGUI::on_gain_valueChanged(int value)
 {
     m_settings.m_gain = value / 10.0;
@@ -111,6 +111,8 @@ private slots:
 	void on_squelch_valueChanged(int value);
     void on_squelchGate_valueChanged(int value);
 	void on_agc_toggled(bool agc);
+	void on_audioCodec_currentIndexChanged(int index);
+	void on_audioDTX_toggled(bool checked);
 	void tick();
 };
 
@@ -47,6 +47,8 @@ void UDPSinkSettings::resetToDefaults()
     m_udpAddress = "127.0.0.1";
     m_udpPort = 9998;
     m_audioPort = 9997;
+    m_audioCodec = AudioCodec::CodecL16;
+    m_audioDTX = false;
     m_rgbColor = QColor(225, 25, 99).rgb();
     m_title = "UDP Sample Sink";
     m_useReverseAPI = false;
@@ -90,6 +92,8 @@ QByteArray UDPSinkSettings::serialize() const
     s.writeU32(25, m_reverseAPIPort);
     s.writeU32(26, m_reverseAPIDeviceIndex);
     s.writeU32(27, m_reverseAPIChannelIndex);
+    s.writeS32(28, (int) m_audioCodec);
+    s.writeBool(29, m_audioDTX);
 
     return s.final();
 
@@ -180,6 +184,16 @@ bool UDPSinkSettings::deserialize(const QByteArray& data)
         d.readU32(27, &u32tmp, 0);
         m_reverseAPIChannelIndex = u32tmp > 99 ? 99 : u32tmp;
 
+        d.readS32(28, &s32tmp, (int) AudioCodec::CodecL16);
+
+        if ((s32tmp >= 0) && (s32tmp <= (int) AudioCodec::CodecOpus)) {
+            m_audioCodec = (AudioCodec::Codec) s32tmp;
+        } else {
+            m_audioCodec = AudioCodec::CodecL16;
+        }
+
+        d.readBool(29, &m_audioDTX, false);
+
         return true;
     }
     else
@@ -21,6 +21,8 @@
 #include <QString>
 #include <stdint.h>
 
+#include "audio/audiocodec.h"
+
 class Serializable;
 
 struct UDPSinkSettings
@@ -59,6 +61,8 @@ struct UDPSinkSettings
     QString m_udpAddress;
     uint16_t m_udpPort;
     uint16_t m_audioPort;
+    AudioCodec::Codec m_audioCodec; //!< for audio formats
+    bool m_audioDTX; //!< nothing is sent while the squelch is closed
 
     QString m_title;
 
@@ -20,9 +20,6 @@
 #include <boost/cstdint.hpp>
 
 #include <QDebug>
-#include <QNetworkAccessManager>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include "SWGChannelSettings.h"
 #include "SWGChannelReport.h"
@@ -32,6 +29,8 @@
 #include "device/devicesinkapi.h"
 #include "dsp/upchannelizer.h"
 #include "dsp/threadedbasebandsamplesource.h"
+#include "webapi/webapireversedispatcher.h"
+#include "channel/sdrdaemoncodec.h"
 
 #include "daemonsourcethread.h"
 #include "daemonsource.h"
@@ -62,15 +61,10 @@ DaemonSource::DaemonSource(DeviceSinkAPI *deviceAPI) :
     m_threadedChannelizer = new ThreadedBasebandSampleSource(m_channelizer, this);
     m_deviceAPI->addThreadedSource(m_threadedChannelizer);
     m_deviceAPI->addChannelAPI(this);
-
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 DaemonSource::~DaemonSource()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
     m_deviceAPI->removeChannelAPI(this);
     m_deviceAPI->removeThreadedSource(m_threadedChannelizer);
     delete m_threadedChannelizer;
@@ -185,20 +179,18 @@ QByteArray DaemonSource::serialize() const
 
 bool DaemonSource::deserialize(const QByteArray& data)
 {
-    (void) data;
-    if (m_settings.deserialize(data))
-    {
-        MsgConfigureDaemonSource *msg = MsgConfigureDaemonSource::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return true;
-    }
-    else
-    {
-        m_settings.resetToDefaults();
-        MsgConfigureDaemonSource *msg = MsgConfigureDaemonSource::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return false;
+    DaemonSourceSettings settings;
+    bool success = settings.deserialize(data);
+
+    if (!success) {
+        settings.resetToDefaults();
     }
+
+    // Applied now so that serialize() and the web API see the new settings.
+    // Only the settings that differ from the running ones are applied to the DSP.
+    applySettings(settings, false);
+
+    return success;
 }
 
 void DaemonSource::applySettings(const DaemonSourceSettings& settings, bool force)
@@ -292,6 +284,8 @@ void DaemonSource::handleDataBlock(SDRDaemonDataBlock* dataBlock)
                 m_nbCorrectableErrors += dataBlock->m_rxControlBlock.m_recoveryCount;
             }
 
+            int refBlockIndex = m_cm256DescriptorBlocks[0].Index; // received block with a valid header
+
             if (m_cm256.cm256_decode(paramsCM256, m_cm256DescriptorBlocks)) // CM256 decode
             {
                 qWarning() << "DaemonSource::handleDataBlock: decode CM256 error:"
@@ -307,6 +301,8 @@ void DaemonSource::handleDataBlock(SDRDaemonDataBlock* dataBlock)
                     SDRDaemonProtectedBlock *recoveredBlock =
                             (SDRDaemonProtectedBlock *) m_cm256DescriptorBlocks[recoveryIndex].Block;
                     memcpy((void *) &(dataBlock->m_superBlocks[blockIndex].m_protectedBlock), recoveredBlock, sizeof(SDRDaemonProtectedBlock));
+                    dataBlock->m_superBlocks[blockIndex].m_header = dataBlock->m_superBlocks[refBlockIndex].m_header; // samples format and size
+                    dataBlock->m_superBlocks[blockIndex].m_header.m_blockIndex = blockIndex;
                     if ((blockIndex == 0) && !dataBlock->m_rxControlBlock.m_metaRetrieved) {
                         dataBlock->m_rxControlBlock.m_metaRetrieved = true;
                     }
@@ -362,6 +358,7 @@ void DaemonSource::printMeta(const QString& header, SDRDaemonMetaDataFEC *metaDa
             << ":" << metaData->m_sampleRate
             << ":" << (int) (metaData->m_sampleBytes & 0xF)
             << ":" << (int) metaData->m_sampleBits
+            << ":" << SDRDaemonCodec::getName(metaData->m_sampleBytes >> 4)
             << ":" << (int) metaData->m_nbOriginalBlocks
             << ":" << (int) metaData->m_nbFECBlocks
             << "|" << metaData->m_tv_sec
@@ -532,39 +529,12 @@ void DaemonSource::webapiReverseSendSettings(QList<QString>& channelSettingsKeys
         swgDaemonSourceSettings->setTitle(new QString(settings.m_title));
     }
 
-    QString channelSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/channel/%4/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString channelSettingsPath = QString("/sdrangel/deviceset/%1/channel/%2/settings")
             .arg(settings.m_reverseAPIDeviceIndex)
             .arg(settings.m_reverseAPIChannelIndex);
-    m_networkRequest.setUrl(QUrl(channelSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgChannelSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, channelSettingsPath, swgChannelSettings->asJson());
 
     delete swgChannelSettings;
 }
-
-void DaemonSource::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "DaemonSource::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
-    }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("DaemonSource::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
-}
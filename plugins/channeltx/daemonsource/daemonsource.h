@@ -18,7 +18,6 @@
 #define PLUGINS_CHANNELTX_DAEMONSRC_DAEMONSRC_H_
 
 #include <QObject>
-#include <QNetworkRequest>
 
 #include "cm256.h"
 
@@ -36,8 +35,6 @@ class UpChannelizer;
 class DeviceSinkAPI;
 class DaemonSourceThread;
 class SDRDaemonDataBlock;
-class QNetworkAccessManager;
-class QNetworkReply;
 
 class DaemonSource : public BasebandSampleSource, public ChannelSourceAPI {
     Q_OBJECT
@@ -236,9 +233,6 @@ private:
     uint32_t m_nbCorrectableErrors;   //!< count of correctable errors in number of blocks
     uint32_t m_nbUncorrectableErrors; //!< count of uncorrectable errors in number of blocks
 
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
-
     void applySettings(const DaemonSourceSettings& settings, bool force = false);
     void handleDataBlock(SDRDaemonDataBlock *dataBlock);
     void printMeta(const QString& header, SDRDaemonMetaDataFEC *metaData);
@@ -248,7 +242,6 @@ private:
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const DaemonSourceSettings& settings, bool force);
 
 private slots:
-    void networkManagerFinished(QNetworkReply *reply);
     void handleData();
 };
 
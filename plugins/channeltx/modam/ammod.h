@@ -22,7 +22,6 @@
 #include <fstream>
 
 #include <QMutex>
-#include <QNetworkRequest>
 
 #include "dsp/basebandsamplesource.h"
 #include "channel/channelsourceapi.h"
@@ -37,8 +36,6 @@
 
 #include "ammodsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class ThreadedBasebandSampleSource;
 class UpChannelizer;
 class DeviceSinkAPI;
@@ -295,9 +292,6 @@ private:
 
     static const int m_levelNbSamples;
 
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
-
     void applyAudioSampleRate(int sampleRate);
     void applyChannelSettings(int basebandSampleRate, int outputSampleRate, int inputFrequencyOffset, bool force = false);
     void applySettings(const AMModSettings& settings, bool force = false);
@@ -310,9 +304,6 @@ private:
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const AMModSettings& settings, bool force);
     void webapiReverseSendCWSettings(const CWKeyerSettings& settings);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 
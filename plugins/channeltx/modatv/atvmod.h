@@ -21,7 +21,6 @@
 
 #include <QObject>
 #include <QMutex>
-#include <QNetworkRequest>
 
 #include <opencv2/core/core.hpp>
 #include <opencv2/highgui/highgui.hpp>
@@ -38,8 +37,6 @@
 
 #include "atvmodsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSinkAPI;
 class ThreadedBasebandSampleSource;
 class UpChannelizer;
@@ -404,7 +401,6 @@ signals:
     void levelChanged(qreal rmsLevel, qreal peakLevel, int numSamples);
 
 private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 
 private:
     struct ATVCamera
@@ -530,9 +526,6 @@ private:
     Complex* m_DSBFilterBuffer;
     int m_DSBFilterBufferIndex;
 
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
-
     static const int m_ssbFftLen;
     static const float m_blackLevel;
     static const float m_spanLevel;
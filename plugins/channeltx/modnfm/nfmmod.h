@@ -22,7 +22,6 @@
 #include <fstream>
 
 #include <QMutex>
-#include <QNetworkRequest>
 
 #include "dsp/basebandsamplesource.h"
 #include "channel/channelsourceapi.h"
@@ -42,8 +41,6 @@
 class DeviceSinkAPI;
 class ThreadedBasebandSampleSource;
 class UpChannelizer;
-class QNetworkAccessManager;
-class QNetworkReply;
 
 class NFMMod : public BasebandSampleSource, public ChannelSourceAPI {
     Q_OBJECT
@@ -300,9 +297,6 @@ private:
     Real m_levelSum;
     CWKeyer m_cwKeyer;
 
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
-
     static const int m_levelNbSamples;
 
     void applyAudioSampleRate(int sampleRate);
@@ -317,9 +311,6 @@ private:
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const NFMModSettings& settings, bool force);
     void webapiReverseSendCWSettings(const CWKeyerSettings& settings);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 
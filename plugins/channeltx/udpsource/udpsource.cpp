@@ -15,9 +15,6 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <QDebug>
-#include <QNetworkAccessManager>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include "SWGChannelSettings.h"
 #include "SWGChannelReport.h"
@@ -28,6 +25,7 @@
 #include "dsp/threadedbasebandsamplesource.h"
 #include "dsp/dspcommands.h"
 #include "util/db.h"
+#include "webapi/webapireversedispatcher.h"
 
 #include "udpsource.h"
 #include "udpsourcemsg.h"
@@ -81,15 +79,10 @@ UDPSource::UDPSource(DeviceSinkAPI *deviceAPI) :
     m_threadedChannelizer = new ThreadedBasebandSampleSource(m_channelizer, this);
     m_deviceAPI->addThreadedSource(m_threadedChannelizer);
     m_deviceAPI->addChannelAPI(this);
-
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 UDPSource::~UDPSource()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
     m_deviceAPI->removeChannelAPI(this);
     m_deviceAPI->removeThreadedSource(m_threadedChannelizer);
     delete m_threadedChannelizer;
@@ -508,6 +501,7 @@ void UDPSource::applySettings(const UDPSourceSettings& settings, bool force)
             << " m_squelchEnabled: " << settings.m_squelchEnabled
             << " m_autoRWBalance: " << settings.m_autoRWBalance
             << " m_stereoInput: " << settings.m_stereoInput
+            << " m_audioCodec: " << (int) settings.m_audioCodec
             << " force: " << force;
 
     QList<QString> reverseAPIKeys;
@@ -563,6 +557,9 @@ void UDPSource::applySettings(const UDPSourceSettings& settings, bool force)
     if ((settings.m_stereoInput != m_settings.m_stereoInput) || force) {
         reverseAPIKeys.append("stereoInput");
     }
+    if ((settings.m_audioCodec != m_settings.m_audioCodec) || force) {
+        reverseAPIKeys.append("audioCodec");
+    }
 
     if((settings.m_rfBandwidth != m_settings.m_rfBandwidth) ||
        (settings.m_lowCutoff != m_settings.m_lowCutoff) ||
@@ -610,6 +607,15 @@ void UDPSource::applySettings(const UDPSourceSettings& settings, bool force)
         m_settingsMutex.unlock();
     }
 
+    if ((settings.m_audioCodec != m_settings.m_audioCodec) ||
+        (settings.m_sampleFormat != m_settings.m_sampleFormat) ||
+        (settings.m_inputSampleRate != m_settings.m_inputSampleRate) ||
+        (settings.m_stereoInput != m_settings.m_stereoInput) || force)
+    {
+        AudioCodec::Codec codec = settings.m_sampleFormat == UDPSourceSettings::FormatSnLE ? AudioCodec::CodecL16 : settings.m_audioCodec;
+        m_udpHandler.configureCodec(codec, settings.m_inputSampleRate, settings.m_stereoInput ? 2 : 1);
+    }
+
     if ((settings.m_channelMute != m_settings.m_channelMute) || force)
     {
         if (!settings.m_channelMute) {
@@ -655,19 +661,18 @@ QByteArray UDPSource::serialize() const
 
 bool UDPSource::deserialize(const QByteArray& data)
 {
-    if (m_settings.deserialize(data))
-    {
-        MsgConfigureUDPSource *msg = MsgConfigureUDPSource::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return true;
-    }
-    else
-    {
-        m_settings.resetToDefaults();
-        MsgConfigureUDPSource *msg = MsgConfigureUDPSource::create(m_settings, true);
-        m_inputMessageQueue.push(msg);
-        return false;
+    UDPSourceSettings settings;
+    bool success = settings.deserialize(data);
+
+    if (!success) {
+        settings.resetToDefaults();
     }
+
+    // Applied now so that serialize() and the web API see the new settings.
+    // Only the settings that differ from the running ones are applied to the DSP.
+    applySettings(settings, false);
+
+    return success;
 }
 
 int UDPSource::webapiSettingsGet(
@@ -738,6 +743,12 @@ int UDPSource::webapiSettingsPutPatch(
     if (channelSettingsKeys.contains("stereoInput")) {
         settings.m_stereoInput = response.getUdpSourceSettings()->getStereoInput() != 0;
     }
+    if (channelSettingsKeys.contains("audioCodec"))
+    {
+        int audioCodec = response.getUdpSourceSettings()->getAudioCodec();
+        settings.m_audioCodec = (audioCodec >= 0) && (audioCodec <= (int) AudioCodec::CodecOpus) ?
+            (AudioCodec::Codec) audioCodec : AudioCodec::CodecL16;
+    }
     if (channelSettingsKeys.contains("rgbColor")) {
         settings.m_rgbColor = response.getUdpSourceSettings()->getRgbColor();
     }
@@ -816,6 +827,7 @@ void UDPSource::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& res
     response.getUdpSourceSettings()->setSquelchEnabled(settings.m_squelchEnabled ? 1 : 0);
     response.getUdpSourceSettings()->setAutoRwBalance(settings.m_autoRWBalance ? 1 : 0);
     response.getUdpSourceSettings()->setStereoInput(settings.m_stereoInput ? 1 : 0);
+    response.getUdpSourceSettings()->setAudioCodec((int) settings.m_audioCodec);
     response.getUdpSourceSettings()->setRgbColor(settings.m_rgbColor);
 
     if (response.getUdpSourceSettings()->getUdpAddress()) {
@@ -909,6 +921,9 @@ void UDPSource::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, c
     if (channelSettingsKeys.contains("stereoInput") || force) {
         swgUDPSourceSettings->setStereoInput(settings.m_stereoInput ? 1 : 0);
     }
+    if (channelSettingsKeys.contains("audioCodec") || force) {
+        swgUDPSourceSettings->setAudioCodec((int) settings.m_audioCodec);
+    }
     if (channelSettingsKeys.contains("rgbColor") || force) {
         swgUDPSourceSettings->setRgbColor(settings.m_rgbColor);
     }
@@ -922,39 +937,12 @@ void UDPSource::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, c
         swgUDPSourceSettings->setTitle(new QString(settings.m_title));
     }
 
-    QString channelSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/channel/%4/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString channelSettingsPath = QString("/sdrangel/deviceset/%1/channel/%2/settings")
             .arg(settings.m_reverseAPIDeviceIndex)
             .arg(settings.m_reverseAPIChannelIndex);
-    m_networkRequest.setUrl(QUrl(channelSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgChannelSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, channelSettingsPath, swgChannelSettings->asJson());
 
     delete swgChannelSettings;
 }
-
-void UDPSource::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "UDPSource::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
-    }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("UDPSource::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
-}
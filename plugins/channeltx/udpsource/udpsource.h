@@ -18,7 +18,6 @@
 #define PLUGINS_CHANNELTX_UDPSINK_UDPSOURCE_H_
 
 #include <QObject>
-#include <QNetworkRequest>
 
 #include "dsp/basebandsamplesource.h"
 #include "channel/channelsourceapi.h"
@@ -32,8 +31,6 @@
 #include "udpsourcesettings.h"
 #include "udpsourceudphandler.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSinkAPI;
 class ThreadedBasebandSampleSource;
 class UpChannelizer;
@@ -142,7 +139,6 @@ signals:
     void levelChanged(qreal rmsLevel, qreal peakLevel, int numSamples);
 
 private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 
 private:
     class MsgUDPSourceSpectrum : public Message {
@@ -232,9 +228,6 @@ private:
     Complex* m_SSBFilterBuffer;
     int m_SSBFilterBufferIndex;
 
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
-
     QMutex m_settingsMutex;
 
     static const int m_sampleRateAverageItems = 17;
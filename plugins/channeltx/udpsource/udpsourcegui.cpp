@@ -232,6 +232,7 @@ void UDPSourceGUI::displaySettings()
     ui->channelMute->setChecked(m_settings.m_channelMute);
     ui->autoRWBalance->setChecked(m_settings.m_autoRWBalance);
     ui->stereoInput->setChecked(m_settings.m_stereoInput);
+    ui->audioCodec->setCurrentIndex((int) m_settings.m_audioCodec);
 
     ui->gainInText->setText(tr("%1").arg(m_settings.m_gainIn, 0, 'f', 1));
     ui->gainIn->setValue(roundf(m_settings.m_gainIn * 10.0));
@@ -461,6 +462,12 @@ void UDPSourceGUI::on_stereoInput_toggled(bool checked)
     applySettings();
 }
 
+void UDPSourceGUI::on_audioCodec_currentIndexChanged(int index)
+{
+    m_settings.m_audioCodec = (AudioCodec::Codec) index;
+    applySettings();
+}
+
 void UDPSourceGUI::onWidgetRolled(QWidget* widget, bool rollDown)
 {
     if ((widget == ui->spectrumBox) && (m_udpSource != 0))
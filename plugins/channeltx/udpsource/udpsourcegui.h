@@ -107,6 +107,7 @@ private slots:
     void on_resetUDPReadIndex_clicked();
     void on_autoRWBalance_toggled(bool checked);
     void on_stereoInput_toggled(bool checked);
+    void on_audioCodec_currentIndexChanged(int index);
     void tick();
 };
 
@@ -45,6 +45,7 @@ void UDPSourceSettings::resetToDefaults()
     m_squelchGate = 0.05;
     m_autoRWBalance = true;
     m_stereoInput = false;
+    m_audioCodec = AudioCodec::CodecL16;
     m_squelchEnabled = true;
     m_udpAddress = "127.0.0.1";
     m_udpPort = 9998;
@@ -89,6 +90,7 @@ QByteArray UDPSourceSettings::serialize() const
     s.writeU32(23, m_reverseAPIPort);
     s.writeU32(24, m_reverseAPIDeviceIndex);
     s.writeU32(25, m_reverseAPIChannelIndex);
+    s.writeS32(26, (int) m_audioCodec);
 
     return s.final();
 }
@@ -181,6 +183,14 @@ bool UDPSourceSettings::deserialize(const QByteArray& data)
         d.readU32(25, &u32tmp, 0);
         m_reverseAPIChannelIndex = u32tmp > 99 ? 99 : u32tmp;
 
+        d.readS32(26, &s32tmp, (int) AudioCodec::CodecL16);
+
+        if ((s32tmp >= 0) && (s32tmp <= (int) AudioCodec::CodecOpus)) {
+            m_audioCodec = (AudioCodec::Codec) s32tmp;
+        } else {
+            m_audioCodec = AudioCodec::CodecL16;
+        }
+
         return true;
     }
     else
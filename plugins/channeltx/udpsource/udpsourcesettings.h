@@ -22,6 +22,7 @@
 #include <stdint.h>
 
 #include "dsp/dsptypes.h"
+#include "audio/audiocodec.h"
 
 class Serializable;
 
@@ -51,6 +52,7 @@ struct UDPSourceSettings
     bool m_squelchEnabled;
     bool m_autoRWBalance;
     bool m_stereoInput;
+    AudioCodec::Codec m_audioCodec; //!< for audio formats
     quint32 m_rgbColor;
 
     QString m_udpAddress;
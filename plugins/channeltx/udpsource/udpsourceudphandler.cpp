@@ -23,6 +23,7 @@
 #include "udpsourcemsg.h"
 
 MESSAGE_CLASS_DEFINITION(UDPSourceUDPHandler::MsgUDPAddressAndPort, Message)
+MESSAGE_CLASS_DEFINITION(UDPSourceUDPHandler::MsgAudioCodec, Message)
 
 UDPSourceUDPHandler::UDPSourceUDPHandler() :
     m_dataSocket(0),
@@ -97,6 +98,12 @@ void UDPSourceUDPHandler::stop()
 
 void UDPSourceUDPHandler::dataReadyRead()
 {
+    if (m_codec.getCodec() != AudioCodec::CodecL16)
+    {
+        readCodecDatagrams();
+        return;
+    }
+
     while (m_dataSocket->hasPendingDatagrams() && m_dataConnected)
     {
         qint64 pendingDataSize = m_dataSocket->pendingDatagramSize();
@@ -128,6 +135,42 @@ void UDPSourceUDPHandler::dataReadyRead()
     }
 }
 
+void UDPSourceUDPHandler::readCodecDatagrams()
+{
+    while (m_dataSocket->hasPendingDatagrams() && m_dataConnected)
+    {
+        qint64 bytesRead = m_dataSocket->readDatagram((char *) m_codecPacket, AudioCodec::m_maxPacketSize, &m_remoteAddress, &m_remotePort);
+
+        if (bytesRead < 0)
+        {
+            qWarning("UDPSourceUDPHandler::readCodecDatagrams: UDP read error");
+        }
+        else
+        {
+            int nbFrames = m_codec.decode(m_codecPacket, bytesRead, m_codecSamples.data());
+            writeData((const char *) m_codecSamples.data(), nbFrames * m_codec.getNbChannels() * sizeof(int16_t));
+        }
+    }
+}
+
+void UDPSourceUDPHandler::writeData(const char *data, int size)
+{
+    while (size > 0)
+    {
+        int chunkSize = std::min(size, m_udpBlockSize - m_udpDumpIndex);
+        memcpy(&m_udpDump[m_udpDumpIndex], data, chunkSize);
+        m_udpDumpIndex += chunkSize;
+        data += chunkSize;
+        size -= chunkSize;
+
+        if (m_udpDumpIndex == m_udpBlockSize)
+        {
+            moveData(m_udpDump);
+            m_udpDumpIndex = 0;
+        }
+    }
+}
+
 void UDPSourceUDPHandler::moveData(char *blk)
 {
     memcpy(m_udpBuf[m_writeFrameIndex], blk, m_udpBlockSize);
@@ -229,6 +272,12 @@ void UDPSourceUDPHandler::configureUDPLink(const QString& address, quint16 port)
     m_inputMessageQueue.push(msg);
 }
 
+void UDPSourceUDPHandler::configureCodec(AudioCodec::Codec codec, int sampleRate, int nbChannels)
+{
+    Message* msg = MsgAudioCodec::create(codec, sampleRate, nbChannels);
+    m_inputMessageQueue.push(msg);
+}
+
 void UDPSourceUDPHandler::applyUDPLink(const QString& address, quint16 port)
 {
     qDebug("UDPSourceUDPHandler::configureUDPLink: %s:%d", address.toStdString().c_str(), port);
@@ -293,6 +342,20 @@ bool UDPSourceUDPHandler::handleMessage(const Message& cmd)
         applyUDPLink(notif.getAddress(), notif.getPort());
         return true;
     }
+    else if (UDPSourceUDPHandler::MsgAudioCodec::match(cmd))
+    {
+        UDPSourceUDPHandler::MsgAudioCodec& notif = (UDPSourceUDPHandler::MsgAudioCodec&) cmd;
+        qDebug("UDPSourceUDPHandler::handleMessage: MsgAudioCodec: codec: %d sampleRate: %d nbChannels: %d",
+            (int) notif.getCodec(), notif.getSampleRate(), notif.getNbChannels());
+
+        if (!m_codec.setCodec(notif.getCodec(), notif.getSampleRate(), notif.getNbChannels())) {
+            qWarning("UDPSourceUDPHandler::handleMessage: codec %d not available: using L16", (int) notif.getCodec());
+        }
+
+        m_codecSamples.resize(m_codec.getFrameSize() * m_codec.getNbChannels());
+        m_udpDumpIndex = 0;
+        return true;
+    }
     else
     {
         return false;
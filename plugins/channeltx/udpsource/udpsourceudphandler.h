@@ -22,8 +22,10 @@
 #include <QHostAddress>
 #include <QMutex>
 #include <stdint.h>
+#include <vector>
 
 #include "dsp/dsptypes.h"
+#include "audio/audiocodec.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -37,6 +39,8 @@ public:
     void start();
     void stop();
     void configureUDPLink(const QString& address, quint16 port);
+    /** Datagrams are decoded when the codec is not L16. nbChannels is 2 for interleaved stereo */
+    void configureCodec(AudioCodec::Codec codec, int sampleRate, int nbChannels);
     void resetReadIndex();
     void resizeBuffer(float sampleRate);
 
@@ -87,9 +91,37 @@ private:
         { }
     };
 
+    class MsgAudioCodec : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        AudioCodec::Codec getCodec() const { return m_codec; }
+        int getSampleRate() const { return m_sampleRate; }
+        int getNbChannels() const { return m_nbChannels; }
+
+        static MsgAudioCodec* create(AudioCodec::Codec codec, int sampleRate, int nbChannels)
+        {
+            return new MsgAudioCodec(codec, sampleRate, nbChannels);
+        }
+
+    private:
+        AudioCodec::Codec m_codec;
+        int m_sampleRate;
+        int m_nbChannels;
+
+        MsgAudioCodec(AudioCodec::Codec codec, int sampleRate, int nbChannels) :
+            Message(),
+            m_codec(codec),
+            m_sampleRate(sampleRate),
+            m_nbChannels(nbChannels)
+        { }
+    };
+
     typedef char (udpBlk_t)[m_udpBlockSize];
 
     void moveData(char *blk);
+    void writeData(const char *data, int size); //!< decoded audio into blocks
+    void readCodecDatagrams();
     void advanceReadPointer(int nbBytes);
     void applyUDPLink(const QString& address, quint16 port);
     bool handleMessage(const Message& message);
@@ -112,6 +144,9 @@ private:
     float m_d;
     bool m_autoRWBalance;
     MessageQueue *m_feedbackMessageQueue;
+    AudioCodec m_codec;
+    uint8_t m_codecPacket[AudioCodec::m_maxPacketSize];
+    std::vector<int16_t> m_codecSamples;
     MessageQueue m_inputMessageQueue;
 
 private slots:
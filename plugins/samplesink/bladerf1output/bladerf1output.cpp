@@ -18,8 +18,6 @@
 #include <errno.h>
 
 #include <QDebug>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include "SWGDeviceSettings.h"
 #include "SWGDeviceState.h"
@@ -29,6 +27,7 @@
 #include "device/devicesinkapi.h"
 #include "device/devicesourceapi.h"
 #include "bladerf1/devicebladerf1shared.h"
+#include "webapi/webapireversedispatcher.h"
 #include "bladerf1outputthread.h"
 #include "bladerf1output.h"
 
@@ -47,15 +46,10 @@ Bladerf1Output::Bladerf1Output(DeviceSinkAPI *deviceAPI) :
     m_sampleSourceFifo.resize(16*BLADERFOUTPUT_BLOCKSIZE);
     openDevice();
     m_deviceAPI->setBuddySharedPtr(&m_sharedParams);
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 Bladerf1Output::~Bladerf1Output()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
-
     if (m_running) {
         stop();
     }
@@ -707,53 +701,23 @@ void Bladerf1Output::webapiReverseSendSettings(QList<QString>& deviceSettingsKey
         swgBladeRF1OutputSettings->setXb200Filter((int) settings.m_xb200Filter);
     }
 
-    QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString deviceSettingsPath = QString("/sdrangel/deviceset/%1/device/settings")
             .arg(settings.m_reverseAPIDeviceIndex);
-    m_networkRequest.setUrl(QUrl(deviceSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgDeviceSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, deviceSettingsPath, swgDeviceSettings->asJson());
 
     delete swgDeviceSettings;
 }
 
 void Bladerf1Output::webapiReverseSendStartStop(bool start)
 {
-    QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/run")
-            .arg(m_settings.m_reverseAPIAddress)
-            .arg(m_settings.m_reverseAPIPort)
+    QString deviceSettingsPath = QString("/sdrangel/deviceset/%1/device/run")
             .arg(m_settings.m_reverseAPIDeviceIndex);
-    m_networkRequest.setUrl(QUrl(deviceSettingsURL));
 
     if (start) {
-        m_networkManager->sendCustomRequest(m_networkRequest, "POST");
+        WebAPIReverseDispatcher::instance()->send(m_settings.m_reverseAPIAddress, m_settings.m_reverseAPIPort, "POST", deviceSettingsPath);
     } else {
-        m_networkManager->sendCustomRequest(m_networkRequest, "DELETE");
-    }
-}
-
-void Bladerf1Output::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "Bladerf1Output::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
+        WebAPIReverseDispatcher::instance()->send(m_settings.m_reverseAPIAddress, m_settings.m_reverseAPIPort, "DELETE", deviceSettingsPath);
     }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("Bladerf1Output::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
 }
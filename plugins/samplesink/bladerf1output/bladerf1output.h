@@ -18,7 +18,6 @@
 #define INCLUDE_BLADERFOUTPUT_H
 
 #include <QString>
-#include <QNetworkRequest>
 
 #include "libbladeRF.h"
 #include "dsp/devicesamplesink.h"
@@ -26,8 +25,6 @@
 #include "bladerf1/devicebladerf1param.h"
 #include "bladerf1outputsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSinkAPI;
 class Bladerf1OutputThread;
 
@@ -140,8 +137,6 @@ private:
 	QString m_deviceDescription;
     DeviceBladeRF1Params m_sharedParams;
     bool m_running;
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     bool openDevice();
     void closeDevice();
@@ -149,9 +144,6 @@ private:
     void webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& response, const BladeRF1OutputSettings& settings);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const BladeRF1OutputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif // INCLUDE_BLADERFOUTPUT_H
@@ -19,8 +19,6 @@
 #include <errno.h>
 
 #include <QDebug>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include "SWGDeviceState.h"
 #include "SWGDeviceSettings.h"
@@ -34,6 +32,7 @@
 #include "device/devicesourceapi.h"
 #include "bladerf2/devicebladerf2shared.h"
 #include "bladerf2/devicebladerf2.h"
+#include "webapi/webapireversedispatcher.h"
 
 #include "bladerf2outputthread.h"
 #include "bladerf2output.h"
@@ -51,15 +50,10 @@ BladeRF2Output::BladeRF2Output(DeviceSinkAPI *deviceAPI) :
     m_running(false)
 {
     openDevice();
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 BladeRF2Output::~BladeRF2Output()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
-
     if (m_running) {
         stop();
     }
@@ -1157,53 +1151,23 @@ void BladeRF2Output::webapiReverseSendSettings(QList<QString>& deviceSettingsKey
         swgBladeRF2OutputSettings->setTransverterMode(settings.m_transverterMode ? 1 : 0);
     }
 
-    QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString deviceSettingsPath = QString("/sdrangel/deviceset/%1/device/settings")
             .arg(settings.m_reverseAPIDeviceIndex);
-    m_networkRequest.setUrl(QUrl(deviceSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgDeviceSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, deviceSettingsPath, swgDeviceSettings->asJson());
 
     delete swgDeviceSettings;
 }
 
 void BladeRF2Output::webapiReverseSendStartStop(bool start)
 {
-    QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/run")
-            .arg(m_settings.m_reverseAPIAddress)
-            .arg(m_settings.m_reverseAPIPort)
+    QString deviceSettingsPath = QString("/sdrangel/deviceset/%1/device/run")
             .arg(m_settings.m_reverseAPIDeviceIndex);
-    m_networkRequest.setUrl(QUrl(deviceSettingsURL));
 
     if (start) {
-        m_networkManager->sendCustomRequest(m_networkRequest, "POST");
+        WebAPIReverseDispatcher::instance()->send(m_settings.m_reverseAPIAddress, m_settings.m_reverseAPIPort, "POST", deviceSettingsPath);
     } else {
-        m_networkManager->sendCustomRequest(m_networkRequest, "DELETE");
-    }
-}
-
-void BladeRF2Output::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "BladeRF2Output::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
+        WebAPIReverseDispatcher::instance()->send(m_settings.m_reverseAPIAddress, m_settings.m_reverseAPIPort, "DELETE", deviceSettingsPath);
     }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("BladeRF2Output::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
 }
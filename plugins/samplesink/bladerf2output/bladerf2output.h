@@ -18,7 +18,6 @@
 #define PLUGINS_SAMPLESINK_BLADERF2OUTPUT_BLADERF2OUTPUT_H_
 
 #include <QString>
-#include <QNetworkRequest>
 
 #include <libbladeRF.h>
 
@@ -26,8 +25,6 @@
 #include "bladerf2/devicebladerf2shared.h"
 #include "bladerf2outputsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSinkAPI;
 class BladeRF2OutputThread;
 struct bladerf_gain_modes;
@@ -160,8 +157,6 @@ private:
     QString m_deviceDescription;
     DeviceBladeRF2Shared m_deviceShared;
     bool m_running;
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     bool openDevice();
     void closeDevice();
@@ -174,9 +169,6 @@ private:
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const BladeRF2OutputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif /* PLUGINS_SAMPLESINK_BLADERF2OUTPUT_BLADERF2OUTPUT_H_ */
@@ -48,6 +48,7 @@ FileSinkOutput::FileSinkOutput(DeviceSinkAPI *deviceAPI) :
 	m_startingTimeStamp(0),
 	m_masterTimer(deviceAPI->getMasterTimer())
 {
+    m_fileWriter.setRotation(0, 0); // the generated file is played back as a whole
 }
 
 FileSinkOutput::~FileSinkOutput()
@@ -62,12 +63,10 @@ void FileSinkOutput::destroy()
 
 void FileSinkOutput::openFileStream()
 {
-	if (m_ofstream.is_open()) {
-		m_ofstream.close();
+	if (!m_fileWriter.isRunning()) {
+		m_fileWriter.startWriter();
 	}
 
-	m_ofstream.open(m_fileName.toStdString().c_str(), std::ios::binary);
-
     FileRecord::Header header;
 	int actualSampleRate = m_settings.m_sampleRate * (1<<m_settings.m_log2Interp);
     header.sampleRate = actualSampleRate;
@@ -75,8 +74,9 @@ void FileSinkOutput::openFileStream()
     m_startingTimeStamp = time(0);
     header.startTimeStamp = m_startingTimeStamp;
     header.sampleSize = SDR_RX_SAMP_SZ;
+    header.filler = 0;
 
-    FileRecord::writeHeader(m_ofstream, header);
+    m_fileWriter.openFile(m_fileName, header); // the previous file if any is closed by the writer
 
 	qDebug() << "FileSinkOutput::openFileStream: " << m_fileName.toStdString().c_str();
 }
@@ -93,7 +93,7 @@ bool FileSinkOutput::start()
 
 	openFileStream();
 
-	m_fileSinkThread = new FileSinkThread(&m_ofstream, &m_sampleSourceFifo);
+	m_fileSinkThread = new FileSinkThread(&m_fileWriter, &m_sampleSourceFifo);
 	m_fileSinkThread->setSamplerate(m_settings.m_sampleRate);
 	m_fileSinkThread->setLog2Interpolation(m_settings.m_log2Interp);
 	m_fileSinkThread->connectTimer(m_masterTimer);
@@ -124,9 +124,7 @@ void FileSinkOutput::stop()
 		m_fileSinkThread = 0;
 	}
 
-    if (m_ofstream.is_open()) {
-        m_ofstream.close();
-    }
+    m_fileWriter.stopWriter();
 
     if (getMessageQueueToGUI())
     {
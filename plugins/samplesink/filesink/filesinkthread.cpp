@@ -21,12 +21,13 @@
 #include <QDebug>
 
 #include "dsp/samplesourcefifo.h"
+#include "dsp/filerecordwriter.h"
 #include "filesinkthread.h"
 
-FileSinkThread::FileSinkThread(std::ofstream *samplesStream, SampleSourceFifo* sampleFifo, QObject* parent) :
+FileSinkThread::FileSinkThread(FileRecordWriter *fileWriter, SampleSourceFifo* sampleFifo, QObject* parent) :
 	QThread(parent),
 	m_running(false),
-	m_ofstream(samplesStream),
+	m_fileWriter(fileWriter),
 	m_bufsize(0),
 	m_samplesChunkSize(0),
 	m_sampleFifo(sampleFifo),
@@ -38,7 +39,7 @@ FileSinkThread::FileSinkThread(std::ofstream *samplesStream, SampleSourceFifo* s
     m_throttleToggle(false),
     m_buf(0)
 {
-    assert(m_ofstream != 0);
+    assert(m_fileWriter != 0);
 }
 
 FileSinkThread::~FileSinkThread()
@@ -54,7 +55,7 @@ void FileSinkThread::startWork()
 {
 	qDebug() << "FileSinkThread::startWork: ";
 
-    if (m_ofstream->is_open())
+    if (m_fileWriter->isRunning())
     {
         qDebug() << "FileSinkThread::startWork: file stream open, starting...";
         m_maxThrottlems = 0;
@@ -191,7 +192,7 @@ void FileSinkThread::tick()
 
         if (m_log2Interpolation == 0)
         {
-            m_ofstream->write(reinterpret_cast<char*>(&(*beginRead)), m_samplesChunkSize*sizeof(Sample));
+            m_fileWriter->write(reinterpret_cast<char*>(&(*beginRead)), m_samplesChunkSize*sizeof(Sample));
         }
         else
         {
@@ -221,7 +222,7 @@ void FileSinkThread::tick()
                 break;
             }
 
-            m_ofstream->write(reinterpret_cast<char*>(m_buf), m_samplesChunkSize*(1<<m_log2Interpolation)*2*sizeof(int16_t));
+            m_fileWriter->write(reinterpret_cast<char*>(m_buf), m_samplesChunkSize*(1<<m_log2Interpolation)*2*sizeof(int16_t));
         }
 
 	}
@@ -22,8 +22,6 @@
 #include <QWaitCondition>
 #include <QTimer>
 #include <QElapsedTimer>
-#include <iostream>
-#include <fstream>
 #include <cstdlib>
 #include <stdint.h>
 
@@ -33,12 +31,13 @@
 #define FILESINK_THROTTLE_MS 50
 
 class SampleSourceFifo;
+class FileRecordWriter;
 
 class FileSinkThread : public QThread {
 	Q_OBJECT
 
 public:
-	FileSinkThread(std::ofstream *samplesStream, SampleSourceFifo* sampleFifo, QObject* parent = 0);
+	FileSinkThread(FileRecordWriter *fileWriter, SampleSourceFifo* sampleFifo, QObject* parent = 0);
 	~FileSinkThread();
 
 	void startWork();
@@ -57,7 +56,7 @@ private:
 	QWaitCondition m_startWaiter;
 	volatile bool m_running;
 
-	std::ofstream* m_ofstream;
+	FileRecordWriter* m_fileWriter;
 	std::size_t m_bufsize;
 	unsigned int m_samplesChunkSize;
 	SampleSourceFifo* m_sampleFifo;
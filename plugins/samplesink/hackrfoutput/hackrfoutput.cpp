@@ -18,8 +18,6 @@
 #include <errno.h>
 
 #include <QDebug>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include "SWGDeviceSettings.h"
 #include "SWGDeviceState.h"
@@ -30,6 +28,7 @@
 #include "device/devicesourceapi.h"
 #include "device/devicesinkapi.h"
 #include "hackrf/devicehackrfshared.h"
+#include "webapi/webapireversedispatcher.h"
 #include "hackrfoutputthread.h"
 #include "hackrfoutput.h"
 
@@ -47,15 +46,10 @@ HackRFOutput::HackRFOutput(DeviceSinkAPI *deviceAPI) :
 {
     openDevice();
     m_deviceAPI->setBuddySharedPtr(&m_sharedParams);
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 HackRFOutput::~HackRFOutput()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
-
     if (m_running) {
         stop();
     }
@@ -655,53 +649,23 @@ void HackRFOutput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys,
         swgHackRFOutputSettings->setLnaExt(settings.m_lnaExt ? 1 : 0);
     }
 
-    QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString deviceSettingsPath = QString("/sdrangel/deviceset/%1/device/settings")
             .arg(settings.m_reverseAPIDeviceIndex);
-    m_networkRequest.setUrl(QUrl(deviceSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgDeviceSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, deviceSettingsPath, swgDeviceSettings->asJson());
 
     delete swgDeviceSettings;
 }
 
 void HackRFOutput::webapiReverseSendStartStop(bool start)
 {
-    QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/run")
-            .arg(m_settings.m_reverseAPIAddress)
-            .arg(m_settings.m_reverseAPIPort)
+    QString deviceSettingsPath = QString("/sdrangel/deviceset/%1/device/run")
             .arg(m_settings.m_reverseAPIDeviceIndex);
-    m_networkRequest.setUrl(QUrl(deviceSettingsURL));
 
     if (start) {
-        m_networkManager->sendCustomRequest(m_networkRequest, "POST");
+        WebAPIReverseDispatcher::instance()->send(m_settings.m_reverseAPIAddress, m_settings.m_reverseAPIPort, "POST", deviceSettingsPath);
     } else {
-        m_networkManager->sendCustomRequest(m_networkRequest, "DELETE");
+        WebAPIReverseDispatcher::instance()->send(m_settings.m_reverseAPIAddress, m_settings.m_reverseAPIPort, "DELETE", deviceSettingsPath);
     }
 }
-
-void HackRFOutput::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "HackRFOutput::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
-    }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("HackRFOutput::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
-}
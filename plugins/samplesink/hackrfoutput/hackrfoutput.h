@@ -18,7 +18,6 @@
 #define INCLUDE_HACKRFOUTPUT_H
 
 #include <QString>
-#include <QNetworkRequest>
 
 #include "dsp/devicesamplesink.h"
 #include "libhackrf/hackrf.h"
@@ -26,8 +25,6 @@
 #include "hackrf/devicehackrfparam.h"
 #include "hackrfoutputsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSinkAPI;
 class HackRFOutputThread;
 
@@ -140,8 +137,6 @@ private:
 	HackRFOutputThread* m_hackRFThread;
 	QString m_deviceDescription;
 	DeviceHackRFParams m_sharedParams;
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
 	bool m_running;
     bool openDevice();
@@ -152,9 +147,6 @@ private:
     void webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& response, const HackRFOutputSettings& settings);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const HackRFOutputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif // INCLUDE_HACKRFINPUT_H
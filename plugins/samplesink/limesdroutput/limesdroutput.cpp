@@ -19,8 +19,6 @@
 
 #include <QMutexLocker>
 #include <QDebug>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include "lime/LimeSuite.h"
 
@@ -37,6 +35,7 @@
 #include "limesdroutputthread.h"
 #include "limesdr/devicelimesdrparam.h"
 #include "limesdr/devicelimesdr.h"
+#include "webapi/webapireversedispatcher.h"
 #include "limesdroutput.h"
 
 MESSAGE_CLASS_DEFINITION(LimeSDROutput::MsgConfigureLimeSDR, Message)
@@ -61,15 +60,10 @@ LimeSDROutput::LimeSDROutput(DeviceSinkAPI *deviceAPI) :
     openDevice();
     resumeTxBuddies();
     resumeRxBuddies();
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 LimeSDROutput::~LimeSDROutput()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
-
     if (m_running) {
         stop();
     }
@@ -1493,53 +1487,23 @@ void LimeSDROutput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys
         swgLimeSdrOutputSettings->setGpioPins(settings.m_gpioPins & 0xFF);
     }
 
-    QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString deviceSettingsPath = QString("/sdrangel/deviceset/%1/device/settings")
             .arg(settings.m_reverseAPIDeviceIndex);
-    m_networkRequest.setUrl(QUrl(deviceSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgDeviceSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, deviceSettingsPath, swgDeviceSettings->asJson());
 
     delete swgDeviceSettings;
 }
 
 void LimeSDROutput::webapiReverseSendStartStop(bool start)
 {
-    QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/run")
-            .arg(m_settings.m_reverseAPIAddress)
-            .arg(m_settings.m_reverseAPIPort)
+    QString deviceSettingsPath = QString("/sdrangel/deviceset/%1/device/run")
             .arg(m_settings.m_reverseAPIDeviceIndex);
-    m_networkRequest.setUrl(QUrl(deviceSettingsURL));
 
     if (start) {
-        m_networkManager->sendCustomRequest(m_networkRequest, "POST");
+        WebAPIReverseDispatcher::instance()->send(m_settings.m_reverseAPIAddress, m_settings.m_reverseAPIPort, "POST", deviceSettingsPath);
     } else {
-        m_networkManager->sendCustomRequest(m_networkRequest, "DELETE");
-    }
-}
-
-void LimeSDROutput::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "LimeSDROutput::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
+        WebAPIReverseDispatcher::instance()->send(m_settings.m_reverseAPIAddress, m_settings.m_reverseAPIPort, "DELETE", deviceSettingsPath);
     }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("LimeSDROutput::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
 }
@@ -20,14 +20,11 @@
 #include <stdint.h>
 
 #include <QString>
-#include <QNetworkRequest>
 
 #include "dsp/devicesamplesink.h"
 #include "limesdr/devicelimesdrshared.h"
 #include "limesdroutputsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSinkAPI;
 class LimeSDROutputThread;
 struct DeviceLimeSDRParams;
@@ -241,8 +238,6 @@ private:
     DeviceLimeSDRShared m_deviceShared;
     bool m_channelAcquired;
     lms_stream_t m_streamId;
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     bool openDevice();
     void closeDevice();
@@ -257,9 +252,6 @@ private:
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const LimeSDROutputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif /* PLUGINS_SAMPLESOURCE_LIMESDROUTPUT_LIMESDROUTPUT_H_ */
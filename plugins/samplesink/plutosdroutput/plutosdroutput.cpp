@@ -15,8 +15,6 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <QDebug>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include "SWGDeviceSettings.h"
 #include "SWGDeviceState.h"
@@ -29,6 +27,7 @@
 #include "device/devicesinkapi.h"
 #include "plutosdr/deviceplutosdrparams.h"
 #include "plutosdr/deviceplutosdrbox.h"
+#include "webapi/webapireversedispatcher.h"
 
 #include "plutosdroutput.h"
 #include "plutosdroutputthread.h"
@@ -56,16 +55,10 @@ PlutoSDROutput::PlutoSDROutput(DeviceSinkAPI *deviceAPI) :
     suspendBuddies();
     openDevice();
     resumeBuddies();
-
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 PlutoSDROutput::~PlutoSDROutput()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
-
     suspendBuddies();
     closeDevice();
     resumeBuddies();
@@ -825,53 +818,23 @@ void PlutoSDROutput::webapiReverseSendSettings(QList<QString>& deviceSettingsKey
         swgPlutoSdrOutputSettings->setTransverterMode(settings.m_transverterMode ? 1 : 0);
     }
 
-    QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString deviceSettingsPath = QString("/sdrangel/deviceset/%1/device/settings")
             .arg(settings.m_reverseAPIDeviceIndex);
-    m_networkRequest.setUrl(QUrl(deviceSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgDeviceSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, deviceSettingsPath, swgDeviceSettings->asJson());
 
     delete swgDeviceSettings;
 }
 
 void PlutoSDROutput::webapiReverseSendStartStop(bool start)
 {
-    QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/run")
-            .arg(m_settings.m_reverseAPIAddress)
-            .arg(m_settings.m_reverseAPIPort)
+    QString deviceSettingsPath = QString("/sdrangel/deviceset/%1/device/run")
             .arg(m_settings.m_reverseAPIDeviceIndex);
-    m_networkRequest.setUrl(QUrl(deviceSettingsURL));
 
     if (start) {
-        m_networkManager->sendCustomRequest(m_networkRequest, "POST");
+        WebAPIReverseDispatcher::instance()->send(m_settings.m_reverseAPIAddress, m_settings.m_reverseAPIPort, "POST", deviceSettingsPath);
     } else {
-        m_networkManager->sendCustomRequest(m_networkRequest, "DELETE");
+        WebAPIReverseDispatcher::instance()->send(m_settings.m_reverseAPIAddress, m_settings.m_reverseAPIPort, "DELETE", deviceSettingsPath);
     }
 }
-
-void PlutoSDROutput::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "PlutoSDROutput::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
-    }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("PlutoSDROutput::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
-}
@@ -18,7 +18,6 @@
 #define PLUGINS_SAMPLESOURCE_PLUTOSDROUTPUT_PLUTOSDRINPUT_H_
 
 #include <QString>
-#include <QNetworkRequest>
 
 #include "iio.h"
 #include "dsp/devicesamplesink.h"
@@ -27,8 +26,6 @@
 #include "plutosdr/deviceplutosdrbox.h"
 #include "plutosdroutputsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSinkAPI;
 class PlutoSDROutputThread;
 
@@ -136,8 +133,6 @@ public:
     PlutoSDROutputThread *m_plutoSDROutputThread;
     DevicePlutoSDRBox::SampleRates m_deviceSampleRates;
     QMutex m_mutex;
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     bool openDevice();
     void closeDevice();
@@ -148,9 +143,6 @@ public:
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const PlutoSDROutputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 
@@ -40,6 +40,7 @@
 #include "device/devicesinkapi.h"
 #include "device/deviceuiset.h"
 #include "channel/sdrdaemondatablock.h"
+#include "channel/sdrdaemoncodec.h"
 #include "udpsinkfec.h"
 #include "sdrdaemonsinkgui.h"
 
@@ -220,7 +221,7 @@ void SDRdaemonSinkGui::updateSampleRate()
 
 void SDRdaemonSinkGui::updateTxDelayTooltip()
 {
-    int samplesPerBlock = SDRDaemonNbBytesPerBlock / (SDR_RX_SAMP_SZ <= 16 ? 4 : 8);
+    int samplesPerBlock = SDRDaemonCodec::getSamplesPerBlock(m_settings.m_sampleFormat, sizeof(FixReal));
     double delay = ((127*samplesPerBlock*m_settings.m_txDelay) / m_settings.m_sampleRate)/(128 + m_settings.m_nbFECBlocks);
     ui->txDelayText->setToolTip(tr("%1 us").arg(QString::number(delay*1e6, 'f', 0)));
 }
@@ -233,6 +234,7 @@ void SDRdaemonSinkGui::displaySettings()
     ui->txDelay->setValue(m_settings.m_txDelay*100);
     ui->txDelayText->setText(tr("%1").arg(m_settings.m_txDelay*100));
     ui->nbFECBlocks->setValue(m_settings.m_nbFECBlocks);
+    ui->sampleFormat->setCurrentIndex(m_settings.m_sampleFormat);
 
     QString s0 = QString::number(128 + m_settings.m_nbFECBlocks, 'f', 0);
     QString s1 = QString::number(m_settings.m_nbFECBlocks, 'f', 0);
@@ -307,6 +309,13 @@ void SDRdaemonSinkGui::on_txDelay_valueChanged(int value)
     sendSettings();
 }
 
+void SDRdaemonSinkGui::on_sampleFormat_currentIndexChanged(int index)
+{
+    m_settings.m_sampleFormat = index < 0 ? (int) SDRDaemonSampleRaw : index;
+    updateTxDelayTooltip();
+    sendSettings();
+}
+
 void SDRdaemonSinkGui::on_nbFECBlocks_valueChanged(int value)
 {
     m_settings.m_nbFECBlocks = value;
@@ -139,6 +139,7 @@ private slots:
     void handleInputMessages();
     void on_sampleRate_changed(quint64 value);
     void on_txDelay_valueChanged(int value);
+    void on_sampleFormat_currentIndexChanged(int index);
     void on_nbFECBlocks_valueChanged(int value);
     void on_deviceIndex_returnPressed();
     void on_channelIndex_returnPressed();
@@ -15,6 +15,7 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include "util/simpleserializer.h"
+#include "channel/sdrdaemondatablock.h"
 #include "sdrdaemonsinksettings.h"
 
 SDRdaemonSinkSettings::SDRdaemonSinkSettings()
@@ -28,6 +29,7 @@ void SDRdaemonSinkSettings::resetToDefaults()
     m_sampleRate = 48000;
     m_txDelay = 0.35;
     m_nbFECBlocks = 0;
+    m_sampleFormat = SDRDaemonSampleRaw;
     m_apiAddress = "127.0.0.1";
     m_apiPort = 9091;
     m_dataAddress = "127.0.0.1";
@@ -58,6 +60,7 @@ QByteArray SDRdaemonSinkSettings::serialize() const
     s.writeString(13, m_reverseAPIAddress);
     s.writeU32(14, m_reverseAPIPort);
     s.writeU32(15, m_reverseAPIDeviceIndex);
+    s.writeS32(16, m_sampleFormat);
 
     return s.final();
 }
@@ -101,6 +104,12 @@ bool SDRdaemonSinkSettings::deserialize(const QByteArray& data)
         d.readU32(15, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
 
+        d.readS32(16, &m_sampleFormat, SDRDaemonSampleRaw);
+
+        if ((m_sampleFormat < 0) || (m_sampleFormat >= SDRDaemonSampleNbFormats)) {
+            m_sampleFormat = SDRDaemonSampleRaw;
+        }
+
         return true;
     }
     else
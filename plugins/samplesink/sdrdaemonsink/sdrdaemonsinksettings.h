@@ -24,6 +24,7 @@ struct SDRdaemonSinkSettings {
     quint32 m_sampleRate;
     float   m_txDelay;
     quint32 m_nbFECBlocks;
+    qint32  m_sampleFormat; //!< SDRDaemonSampleFormat of the transmitted samples
     QString m_apiAddress;
     quint16 m_apiPort;
     QString m_dataAddress;
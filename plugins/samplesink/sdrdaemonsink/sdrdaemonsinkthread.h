@@ -51,6 +51,7 @@ public:
 	void setSamplerate(int samplerate);
     void setNbBlocksFEC(uint32_t nbBlocksFEC) { m_udpSinkFEC.setNbBlocksFEC(nbBlocksFEC); };
     void setTxDelay(float txDelay) { m_udpSinkFEC.setTxDelay(txDelay); };
+    void setSampleFormat(int sampleFormat) { m_udpSinkFEC.setSampleFormat(sampleFormat); }
     void setDataAddress(const QString& address, uint16_t port) { m_udpSinkFEC.setRemoteAddress(address, port); }
 
     bool isRunning() const { return m_running; }
@@ -16,6 +16,8 @@
 
 #include <QDebug>
 
+#include <algorithm>
+
 #include <boost/crc.hpp>
 #include <boost/cstdint.hpp>
 
@@ -34,6 +36,9 @@ UDPSinkFEC::UDPSinkFEC() :
     m_txBlocksIndex(0),
     m_frameCount(0),
     m_sampleIndex(0),
+    m_sampleFormat(SDRDaemonSampleRaw),
+    m_frameSampleFormat(SDRDaemonSampleRaw),
+    m_samplesPerBlock(SDRDaemonCodec::getSamplesPerBlock(SDRDaemonSampleRaw, sizeof(FixReal))),
     m_udpWorker(0),
     m_remoteAddress("127.0.0.1"),
     m_remotePort(9090)
@@ -71,11 +76,11 @@ void UDPSinkFEC::stop()
 void UDPSinkFEC::setTxDelay(float txDelayRatio)
 {
     // delay is calculated from the fraction of the nominal UDP block process time
-    // frame size: 127 * (126 or 63 samples depending on I or Q sample bytes of 2 or 4 bytes respectively)
+    // frame size: 127 * (number of samples per block in the samples format)
     // divided by sample rate gives the frame process time
     // divided by the number of actual blocks including FEC blocks gives the block (i.e. UDP block) process time
     m_txDelayRatio = txDelayRatio;
-    int samplesPerBlock = SDRDaemonNbBytesPerBlock / (SDR_RX_SAMP_SZ <= 16 ? 4 : 8);
+    int samplesPerBlock = SDRDaemonCodec::getSamplesPerBlock(m_sampleFormat, sizeof(FixReal));
     double delay = ((127*samplesPerBlock*txDelayRatio) / m_sampleRate)/(128 + m_nbBlocksFEC);
     m_txDelay = delay * 1e6;
     qDebug() << "UDPSinkFEC::setTxDelay: txDelay: " << txDelayRatio << " m_txDelay: " << m_txDelay << " us";
@@ -88,6 +93,13 @@ void UDPSinkFEC::setNbBlocksFEC(uint32_t nbBlocksFEC)
     setTxDelay(m_txDelayRatio);
 }
 
+void UDPSinkFEC::setSampleFormat(int sampleFormat)
+{
+    qDebug() << "UDPSinkFEC::setSampleFormat: sampleFormat: " << SDRDaemonCodec::getName(sampleFormat);
+    m_sampleFormat = sampleFormat;
+    setTxDelay(m_txDelayRatio);
+}
+
 void UDPSinkFEC::setSampleRate(uint32_t sampleRate)
 {
     qDebug() << "UDPSinkFEC::setSampleRate: sampleRate: " << sampleRate;
@@ -121,9 +133,14 @@ void UDPSinkFEC::write(const SampleVector::iterator& begin, uint32_t sampleChunk
 
             uint64_t ts_usecs = TimeUtil::nowus();
 
+            // the samples format can only change at frame boundaries
+            m_frameSampleFormat = m_sampleFormat;
+            m_samplesPerBlock = SDRDaemonCodec::getSamplesPerBlock(m_frameSampleFormat, sizeof(FixReal));
+            uint8_t sampleBytes = (m_frameSampleFormat << 4) + (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
+
             metaData.m_centerFrequency = 0; // frequency not set by stream
             metaData.m_sampleRate = m_sampleRate;
-            metaData.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
+            metaData.m_sampleBytes = sampleBytes;
             metaData.m_sampleBits = SDR_RX_SAMP_SZ;
             metaData.m_nbOriginalBlocks = m_nbOriginalBlocks;
             metaData.m_nbFECBlocks = m_nbBlocksFEC;
@@ -139,7 +156,7 @@ void UDPSinkFEC::write(const SampleVector::iterator& begin, uint32_t sampleChunk
 
             m_superBlock.m_header.m_frameIndex = m_frameCount;
             m_superBlock.m_header.m_blockIndex = m_txBlockIndex;
-            m_superBlock.m_header.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
+            m_superBlock.m_header.m_sampleBytes = sampleBytes;
             m_superBlock.m_header.m_sampleBits = SDR_RX_SAMP_SZ;
 
             SDRDaemonMetaDataFEC *destMeta = (SDRDaemonMetaDataFEC *) &m_superBlock.m_protectedBlock;
@@ -153,6 +170,7 @@ void UDPSinkFEC::write(const SampleVector::iterator& begin, uint32_t sampleChunk
                         << ":" << metaData.m_sampleRate
                         << ":" << (int) (metaData.m_sampleBytes & 0xF)
                         << ":" << (int) metaData.m_sampleBits
+                        << ":" << SDRDaemonCodec::getName(m_frameSampleFormat)
                         << "|" << (int) metaData.m_nbOriginalBlocks
                         << ":" << (int) metaData.m_nbFECBlocks
                         << "|" << metaData.m_tv_sec
@@ -166,27 +184,22 @@ void UDPSinkFEC::write(const SampleVector::iterator& begin, uint32_t sampleChunk
             m_txBlockIndex = 1; // next Tx block with data
         }
 
-        int samplesPerBlock = SDRDaemonNbBytesPerBlock / (SDR_RX_SAMP_SZ <= 16 ? 4 : 8); // two I or Q samples
-
-        if (m_sampleIndex + inRemainingSamples < samplesPerBlock) // there is still room in the current super block
+        if (m_sampleIndex + inRemainingSamples < m_samplesPerBlock) // there is still room in the current super block
         {
-            memcpy((char *) &m_superBlock.m_protectedBlock.buf[m_sampleIndex*sizeof(Sample)],
-                    (const char *) &(*it),
-                    inRemainingSamples * sizeof(Sample));
+            std::copy(it, end, &m_blockSamples[m_sampleIndex]);
             m_sampleIndex += inRemainingSamples;
             it = end; // all input samples are consumed
         }
         else // complete super block and initiate the next if not end of frame
         {
-            memcpy((char *) &m_superBlock.m_protectedBlock.buf[m_sampleIndex*sizeof(Sample)],
-                    (const char *) &(*it),
-                    (samplesPerBlock - m_sampleIndex) * sizeof(Sample));
-            it += samplesPerBlock - m_sampleIndex;
+            std::copy(it, it + (m_samplesPerBlock - m_sampleIndex), &m_blockSamples[m_sampleIndex]);
+            it += m_samplesPerBlock - m_sampleIndex;
             m_sampleIndex = 0;
 
+            SDRDaemonCodec::encode(m_frameSampleFormat, (const FixReal *) m_blockSamples, SDR_RX_SAMP_SZ, m_superBlock.m_protectedBlock);
             m_superBlock.m_header.m_frameIndex = m_frameCount;
             m_superBlock.m_header.m_blockIndex = m_txBlockIndex;
-            m_superBlock.m_header.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
+            m_superBlock.m_header.m_sampleBytes = (m_frameSampleFormat << 4) + (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
             m_superBlock.m_header.m_sampleBits = SDR_RX_SAMP_SZ;
             m_txBlocks[m_txBlocksIndex][m_txBlockIndex] =  m_superBlock;
 
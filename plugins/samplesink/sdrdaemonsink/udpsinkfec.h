@@ -27,6 +27,7 @@
 #include "dsp/dsptypes.h"
 #include "util/CRC64.h"
 #include "channel/sdrdaemondatablock.h"
+#include "channel/sdrdaemoncodec.h"
 
 class UDPSinkFECWorker;
 
@@ -66,6 +67,8 @@ public:
 
     void setNbBlocksFEC(uint32_t nbBlocksFEC);
     void setTxDelay(float txDelayRatio);
+    /** Set the samples format (SDRDaemonSampleFormat). Effective at the next frame. */
+    void setSampleFormat(int sampleFormat);
     void setRemoteAddress(const QString& address, uint16_t port);
 
     /** Return true if the stream is OK, return false if there is an error. */
@@ -96,6 +99,10 @@ private:
     int m_txBlocksIndex;                    //!< Current index of Tx blocks row
     uint16_t m_frameCount;                  //!< transmission frame count
     int m_sampleIndex;                      //!< Current sample index in protected block data
+    int m_sampleFormat;                     //!< Samples format requested
+    int m_frameSampleFormat;                //!< Samples format of the current frame
+    int m_samplesPerBlock;                  //!< Samples per block in the current frame samples format
+    Sample m_blockSamples[SDRDaemonMaxSamplesPerBlock]; //!< Samples of the current block before encoding
 
     UDPSinkFECWorker *m_udpWorker;
     QString m_remoteAddress;
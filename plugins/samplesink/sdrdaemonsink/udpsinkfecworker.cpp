@@ -155,6 +155,8 @@ void UDPSinkFECWorker::encodeAndTransmit(SDRDaemonSuperBlock *txBlockx, uint16_t
         cm256Params.RecoveryCount = nbBlocksFEC;
 
 
+        uint8_t sampleBytes = txBlockx[0].m_header.m_sampleBytes; // samples format and size of the frame
+
         // Fill pointers to data
         for (int i = 0; i < cm256Params.OriginalCount + cm256Params.RecoveryCount; ++i)
         {
@@ -164,7 +166,7 @@ void UDPSinkFECWorker::encodeAndTransmit(SDRDaemonSuperBlock *txBlockx, uint16_t
 
             txBlockx[i].m_header.m_frameIndex = frameIndex;
             txBlockx[i].m_header.m_blockIndex = i;
-            txBlockx[i].m_header.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
+            txBlockx[i].m_header.m_sampleBytes = sampleBytes;
             txBlockx[i].m_header.m_sampleBits = SDR_RX_SAMP_SZ;
             descriptorBlocks[i].Block = (void *) &(txBlockx[i].m_protectedBlock);
             descriptorBlocks[i].Index = txBlockx[i].m_header.m_blockIndex;
@@ -21,15 +21,12 @@
 
 #include <QString>
 #include <QByteArray>
-#include <QNetworkRequest>
 
 #include "dsp/devicesamplesink.h"
 #include "soapysdr/devicesoapysdrshared.h"
 
 #include "soapysdroutputsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSinkAPI;
 class SoapySDROutputThread;
 
@@ -187,8 +184,6 @@ private:
     bool m_running;
     SoapySDROutputThread *m_thread;
     DeviceSoapySDRShared m_deviceShared;
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     bool openDevice();
     void closeDevice();
@@ -205,9 +200,6 @@ private:
     void webapiFormatArgInfo(const SoapySDR::ArgInfo& arg, SWGSDRangel::SWGArgInfo *argInfo);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const SoapySDROutputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 
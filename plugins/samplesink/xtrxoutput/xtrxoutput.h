@@ -20,14 +20,11 @@
 
 #include <QString>
 #include <QByteArray>
-#include <QNetworkRequest>
 
 #include "dsp/devicesamplesink.h"
 #include "xtrx/devicextrxshared.h"
 #include "xtrxoutputsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSinkAPI;
 class XTRXOutputThread;
 struct DeviceXTRXParams;
@@ -229,8 +226,6 @@ private:
     QString m_deviceDescription;
     bool m_running;
     DeviceXTRXShared m_deviceShared;
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     bool openDevice();
     void closeDevice();
@@ -244,9 +239,6 @@ private:
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const XTRXOutputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif /* PLUGINS_SAMPLESINK_XTRXOUTPUT_XTRXOUTPUT_H_ */
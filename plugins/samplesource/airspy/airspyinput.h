@@ -19,14 +19,11 @@
 
 #include <QString>
 #include <QByteArray>
-#include <QNetworkRequest>
 
 #include <libairspy/airspy.h>
 #include <dsp/devicesamplesource.h>
 #include "airspysettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class AirspyThread;
 class FileRecord;
@@ -151,8 +148,6 @@ private:
 	std::vector<uint32_t> m_sampleRates;
 	bool m_running;
     FileRecord *m_fileSink; //!< File sink to record device I/Q output
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
 	bool openDevice();
 	void closeDevice();
@@ -163,9 +158,6 @@ private:
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const AirspySettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif // INCLUDE_AIRSPYINPUT_H
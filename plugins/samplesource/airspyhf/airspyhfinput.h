@@ -19,15 +19,12 @@
 
 #include <QString>
 #include <QByteArray>
-#include <QNetworkRequest>
 
 #include <libairspyhf/airspyhf.h>
 #include <dsp/devicesamplesource.h>
 
 #include "airspyhfsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class AirspyHFThread;
 class FileRecord;
@@ -154,8 +151,6 @@ private:
 	std::vector<uint32_t> m_sampleRates;
 	bool m_running;
     FileRecord *m_fileSink; //!< File sink to record device I/Q output
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
 	bool openDevice();
 	void closeDevice();
@@ -166,9 +161,6 @@ private:
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const AirspyHFSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif // INCLUDE_AIRSPYHFINPUT_H
@@ -19,7 +19,6 @@
 
 #include <QString>
 #include <QByteArray>
-#include <QNetworkRequest>
 
 #include <libbladeRF.h>
 #include <dsp/devicesamplesource.h>
@@ -28,8 +27,6 @@
 #include "../../../devices/bladerf1/devicebladerf1param.h"
 #include "bladerf1inputsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class Bladerf1InputThread;
 class FileRecord;
@@ -146,8 +143,6 @@ private:
 	DeviceBladeRF1Params m_sharedParams;
 	bool m_running;
     FileRecord *m_fileSink; //!< File sink to record device I/Q output
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     bool openDevice();
     void closeDevice();
@@ -156,9 +151,6 @@ private:
     void webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& response, const BladeRF1InputSettings& settings);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const BladeRF1InputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif // INCLUDE_BLADERFINPUT_H
@@ -21,14 +21,11 @@
 
 #include <QString>
 #include <QByteArray>
-#include <QNetworkRequest>
 
 #include "dsp/devicesamplesource.h"
 #include "bladerf2/devicebladerf2shared.h"
 #include "bladerf2inputsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class BladeRF2InputThread;
 class FileRecord;
@@ -190,8 +187,6 @@ private:
     BladeRF2InputThread *m_thread;
     FileRecord *m_fileSink; //!< File sink to record device I/Q output
     std::vector<GainMode> m_gainModes;
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     bool openDevice();
     void closeDevice();
@@ -203,9 +198,6 @@ private:
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const BladeRF2InputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif /* PLUGINS_SAMPLESOURCE_BLADERF2INPUT_BLADERF2INPUT_H_ */
@@ -21,7 +21,6 @@
 
 #include <QString>
 #include <QByteArray>
-#include <QNetworkRequest>
 
 #include "dsp/devicesamplesource.h"
 #include "audio/audioinput.h"
@@ -35,8 +34,6 @@ struct fcd_buffer {
 	std::size_t length;
 };
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class FCDProPlusThread;
 class FileRecord;
@@ -162,8 +159,6 @@ private:
 	QString m_deviceDescription;
 	bool m_running;
     FileRecord *m_fileSink; //!< File sink to record device I/Q output
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     bool openDevice();
     void closeDevice();
@@ -173,9 +168,6 @@ private:
     void webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& response, const FCDProPlusSettings& settings);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const FCDProPlusSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif // INCLUDE_FCD_H
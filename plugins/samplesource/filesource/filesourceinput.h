@@ -24,13 +24,10 @@
 #include <QString>
 #include <QByteArray>
 #include <QTimer>
-#include <QNetworkRequest>
 
 #include "dsp/devicesamplesource.h"
 #include "filesourcesettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class FileSourceThread;
 class DeviceSourceAPI;
 
@@ -331,8 +328,6 @@ public:
     quint64 m_recordLength; //!< record length in seconds computed from file size
     quint64 m_startingTimeStamp;
 	const QTimer& m_masterTimer;
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
 	void openFileStream();
 	void seekFileStream(int seekMillis);
@@ -341,9 +336,6 @@ public:
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const FileSourceSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif // INCLUDE_FILESOURCEINPUT_H
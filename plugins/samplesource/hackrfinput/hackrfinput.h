@@ -19,7 +19,6 @@
 
 #include <QString>
 #include <QByteArray>
-#include <QNetworkRequest>
 
 #include "libhackrf/hackrf.h"
 #include "dsp/devicesamplesource.h"
@@ -27,8 +26,6 @@
 #include "hackrf/devicehackrfparam.h"
 #include "hackrfinputsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class HackRFInputThread;
 class FileRecord;
@@ -164,8 +161,6 @@ private:
 	DeviceHackRFParams m_sharedParams;
 	bool m_running;
     FileRecord *m_fileSink; //!< File sink to record device I/Q output
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     bool openDevice();
     void closeDevice();
@@ -174,9 +169,6 @@ private:
     void webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& response, const HackRFInputSettings& settings);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const HackRFInputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif // INCLUDE_HACKRFINPUT_H
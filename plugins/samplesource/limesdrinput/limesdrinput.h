@@ -21,7 +21,6 @@
 
 #include <QString>
 #include <QByteArray>
-#include <QNetworkRequest>
 
 #include "dsp/devicesamplesource.h"
 #include "limesdr/devicelimesdrshared.h"
@@ -30,8 +29,6 @@
 class DeviceSourceAPI;
 class LimeSDRInputThread;
 class FileRecord;
-class QNetworkAccessManager;
-class QNetworkReply;
 
 class LimeSDRInput : public DeviceSampleSource
 {
@@ -262,8 +259,6 @@ private:
     bool m_channelAcquired;
     lms_stream_t m_streamId;
     FileRecord *m_fileSink; //!< File sink to record device I/Q output
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     bool openDevice();
     void closeDevice();
@@ -278,9 +273,6 @@ private:
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const LimeSDRInputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif /* PLUGINS_SAMPLESOURCE_LIMESDRINPUT_LIMESDRINPUT_H_ */
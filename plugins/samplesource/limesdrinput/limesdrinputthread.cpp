@@ -102,7 +102,11 @@ void LimeSDRInputThread::run()
 //  Decimate according to specified log2 (ex: log2=4 => decim=16)
 void LimeSDRInputThread::callback(const qint16* buf, qint32 len)
 {
-    SampleVector::iterator it = m_convertBuffer.begin();
+    SampleVector::iterator it;
+    unsigned int nbOut = ((len/2) >> m_log2Decim) + 1; // upper bound of decimators output
+    bool inPlace = m_sampleFifo->writeBegin(nbOut, &it) == nbOut; // decimate directly into the FIFO if possible
+    SampleVector::iterator begin = inPlace ? it : m_convertBuffer.begin();
+    it = begin;
 
     switch (m_log2Decim)
     {
@@ -131,6 +135,10 @@ void LimeSDRInputThread::callback(const qint16* buf, qint32 len)
         break;
     }
 
-    m_sampleFifo->write(m_convertBuffer.begin(), it);
+    if (inPlace) {
+        m_sampleFifo->writeCommit(it - begin);
+    } else {
+        m_sampleFifo->write(begin, it);
+    }
 }
 
@@ -19,7 +19,6 @@
 
 #include <QString>
 #include <QByteArray>
-#include <QNetworkRequest>
 
 #include "iio.h"
 #include "dsp/devicesamplesource.h"
@@ -28,8 +27,6 @@
 #include "plutosdr/deviceplutosdrbox.h"
 #include "plutosdrinputsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class FileRecord;
 class PlutoSDRInputThread;
@@ -159,8 +156,6 @@ public:
     PlutoSDRInputThread *m_plutoSDRInputThread;
     DevicePlutoSDRBox::SampleRates m_deviceSampleRates;
     QMutex m_mutex;
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     bool openDevice();
     void closeDevice();
@@ -171,9 +166,6 @@ public:
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const PlutoSDRInputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 
@@ -20,7 +20,6 @@
 
 #include <QString>
 #include <QByteArray>
-#include <QNetworkRequest>
 
 #include <dsp/devicesamplesource.h>
 #include "rtlsdrsettings.h"
@@ -29,8 +28,6 @@
 class DeviceSourceAPI;
 class RTLSDRThread;
 class FileRecord;
-class QNetworkAccessManager;
-class QNetworkReply;
 
 class RTLSDRInput : public DeviceSampleSource {
     Q_OBJECT
@@ -160,8 +157,6 @@ private:
 	QString m_deviceDescription;
 	std::vector<int> m_gains;
 	bool m_running;
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
 	bool openDevice();
 	void closeDevice();
@@ -170,9 +165,6 @@ private:
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const RTLSDRSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif // INCLUDE_RTLSDRINPUT_H
@@ -90,7 +90,11 @@ void RTLSDRThread::run()
 //  Decimate according to specified log2 (ex: log2=4 => decim=16)
 void RTLSDRThread::callback(const quint8* buf, qint32 len)
 {
-	SampleVector::iterator it = m_convertBuffer.begin();
+	SampleVector::iterator it;
+	unsigned int nbOut = ((len/2) >> m_log2Decim) + 1; // upper bound of decimators output
+	bool inPlace = m_sampleFifo->writeBegin(nbOut, &it) == nbOut; // decimate directly into the FIFO if possible
+	SampleVector::iterator begin = inPlace ? it : m_convertBuffer.begin();
+	it = begin;
 
 	if (m_log2Decim == 0)
 	{
@@ -178,7 +182,11 @@ void RTLSDRThread::callback(const quint8* buf, qint32 len)
 		}
 	}
 
-	m_sampleFifo->write(m_convertBuffer.begin(), it);
+	if (inPlace) {
+		m_sampleFifo->writeCommit(it - begin);
+	} else {
+		m_sampleFifo->write(begin, it);
+	}
 
 	if(!m_running)
 		rtlsdr_cancel_async(m_dev);
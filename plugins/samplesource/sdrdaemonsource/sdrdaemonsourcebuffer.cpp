@@ -23,11 +23,24 @@
 #include <boost/cstdint.hpp>
 #include "sdrdaemonsourcebuffer.h"
 
+const int SDRdaemonSourceBuffer::Histogram::m_boundsMs[SDRdaemonSourceBuffer::Histogram::nbBuckets - 1] = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000
+};
 
+void SDRdaemonSourceBuffer::Histogram::add(float valueMs)
+{
+    int i = 0;
+
+    while ((i < nbBuckets - 1) && (valueMs > m_boundsMs[i])) {
+        i++;
+    }
+
+    m_counts[i]++;
+}
 
 SDRdaemonSourceBuffer::SDRdaemonSourceBuffer() :
         m_decoderIndexHead(nbDecoderSlots/2),
-        m_frameHead(0),
+        m_frameHead(-1),
         m_curNbBlocks(0),
         m_minNbBlocks(256),
         m_curOriginalBlocks(0),
@@ -36,20 +49,39 @@ SDRdaemonSourceBuffer::SDRdaemonSourceBuffer() :
         m_maxNbRecovery(0),
         m_framesDecoded(true),
         m_readIndex(0),
+        m_writeIndex(0),
         m_readBuffer(0),
         m_readSize(0),
         m_bufferLenSec(0.0f),
-        m_nbReads(0),
-        m_nbWrites(0),
-        m_balCorrection(0),
-	    m_balCorrLimit(0)
+        m_lowLatency(false),
+        m_lastArrivalUs(-1),
+        m_lastArrivalFrame(0),
+        m_jitterUs(0.0f),
+        m_jitterPeakUs(0.0f),
+        m_targetJitterUs(0.0f),
+        m_targetDelayBytes(0),
+        m_delaySumBytes(0),
+        m_nbDelays(0),
+        m_avgDelayBytes(0),
+        m_lastCorrectionUs(0),
+        m_driftCorrection(0.0),
+        m_driftIntegral(0.0),
+        m_lateFrames(0)
 {
 	m_currentMeta.init();
-	m_framesNbBytes = nbDecoderSlots * sizeof(BufferFrame);
+	m_frames = new uint8_t[framesSize];
+	m_sampleBytes = (SDRDaemonSampleRaw << 4) + 2;
+	m_sampleBits = 16;
+	m_blockNbBytes = SDRDaemonCodec::getSamplesPerBlock(SDRDaemonSampleRaw, 2) * 2 * 2;
+	m_frameNbBytes = (SDRDaemonNbOrginalBlocks - 1) * m_blockNbBytes;
+	m_framesNbBytes = nbDecoderSlots * m_frameNbBytes;
 	m_wrDeltaEstimate = m_framesNbBytes / 2;
+	m_targetDelayBytes = 2 * m_frameNbBytes;
+	m_avgDelayBytes = m_targetDelayBytes;
 	m_tvOut_sec = 0;
 	m_tvOut_usec = 0;
-	m_readNbBytes = 1;
+	m_readNbBytes = 0;
+	m_clock.start();
     m_paramsCM256.BlockBytes = sizeof(SDRDaemonProtectedBlock); // never changes
     m_paramsCM256.OriginalCount = SDRDaemonNbOrginalBlocks;  // never changes
 
@@ -61,7 +93,7 @@ SDRdaemonSourceBuffer::SDRdaemonSourceBuffer() :
     }
 
     std::fill(m_decoderSlots, m_decoderSlots + nbDecoderSlots, DecoderSlot());
-    std::fill(m_frames, m_frames + nbDecoderSlots, BufferFrame());
+    std::fill(m_frames, m_frames + framesSize, 0);
 }
 
 SDRdaemonSourceBuffer::~SDRdaemonSourceBuffer()
@@ -69,6 +101,36 @@ SDRdaemonSourceBuffer::~SDRdaemonSourceBuffer()
 	if (m_readBuffer) {
 		delete[] m_readBuffer;
 	}
+
+	delete[] m_frames;
+}
+
+void SDRdaemonSourceBuffer::setFramesFormat(uint8_t sampleBytes, uint8_t sampleBits)
+{
+    if ((sampleBytes == m_sampleBytes) && (sampleBits == m_sampleBits)) {
+        return;
+    }
+
+    int format = sampleBytes >> 4;
+
+    if ((format >= SDRDaemonSampleNbFormats) || (((sampleBytes & 0xF) != 2) && ((sampleBytes & 0xF) != 4)))
+    {
+        qWarning("SDRdaemonSourceBuffer::setFramesFormat: invalid sample format %d or size %d", format, sampleBytes & 0xF);
+        return;
+    }
+
+    // the decoded frames size changes so the samples buffer restarts from scratch
+    m_sampleBytes = sampleBytes;
+    m_sampleBits = sampleBits;
+    m_blockNbBytes = SDRDaemonCodec::getSamplesPerBlock(format, sampleBytes & 0xF) * 2 * (sampleBytes & 0xF);
+    m_frameNbBytes = (SDRDaemonNbOrginalBlocks - 1) * m_blockNbBytes;
+    m_framesNbBytes = nbDecoderSlots * m_frameNbBytes;
+    std::fill(m_frames, m_frames + framesSize, 0);
+    updateTargetDelay();
+    initReadIndex();
+
+    qDebug("SDRdaemonSourceBuffer::setFramesFormat: %s %d bytes %d bits: %d bytes per frame",
+            SDRDaemonCodec::getName(format), sampleBytes & 0xF, sampleBits, m_frameNbBytes);
 }
 
 void SDRdaemonSourceBuffer::initDecodeAllSlots()
@@ -80,6 +142,7 @@ void SDRdaemonSourceBuffer::initDecodeAllSlots()
         m_decoderSlots[i].m_recoveryCount = 0;
         m_decoderSlots[i].m_decoded = false;
         m_decoderSlots[i].m_metaRetrieved = false;
+        m_decoderSlots[i].m_late = false;
         resetOriginalBlocks(i);
         memset((void *) m_decoderSlots[i].m_recoveryBlocks, 0, SDRDaemonNbOrginalBlocks * sizeof(SDRDaemonProtectedBlock));
     }
@@ -116,65 +179,150 @@ void SDRdaemonSourceBuffer::initDecodeSlot(int slotIndex)
     m_decoderSlots[slotIndex].m_recoveryCount = 0;
     m_decoderSlots[slotIndex].m_decoded = false;
     m_decoderSlots[slotIndex].m_metaRetrieved = false;
+    m_decoderSlots[slotIndex].m_late = false;
 
     resetOriginalBlocks(slotIndex);
     memset((void *) m_decoderSlots[slotIndex].m_recoveryBlocks, 0, SDRDaemonNbOrginalBlocks * sizeof(SDRDaemonProtectedBlock));
 }
 
+void SDRdaemonSourceBuffer::setLowLatency(bool lowLatency)
+{
+    if (lowLatency == m_lowLatency) {
+        return;
+    }
+
+    m_lowLatency = lowLatency;
+    updateTargetDelay();
+    initReadIndex();
+}
+
+void SDRdaemonSourceBuffer::getHistograms(Histogram& latency, Histogram& jitter, Histogram& late)
+{
+    QMutexLocker mutexLocker(&m_histogramsMutex);
+    latency = m_latencyHistogram;
+    jitter = m_jitterHistogram;
+    late = m_lateHistogram;
+}
+
 void SDRdaemonSourceBuffer::initReadIndex()
 {
-    m_readIndex = ((m_decoderIndexHead + (nbDecoderSlots/2)) % nbDecoderSlots) * sizeof(BufferFrame);
+    // read index at target distance behind the start of the head frame
+    m_writeIndex = m_decoderIndexHead * m_frameNbBytes;
+    m_readIndex = (m_writeIndex + m_framesNbBytes - m_targetDelayBytes) % m_framesNbBytes;
     m_wrDeltaEstimate = m_framesNbBytes / 2;
-    m_nbReads = 0;
-    m_nbWrites = 0;
+    m_avgDelayBytes = m_targetDelayBytes;
+    m_delaySumBytes = 0;
+    m_nbDelays = 0;
+    m_driftCorrection = m_driftIntegral; // keep the clock drift estimate
+}
+
+void SDRdaemonSourceBuffer::updateTargetDelay()
+{
+    // Delay needed to absorb the bursts of frames (whole frames in normal mode so that FEC can complete or
+    // half a frame in low latency mode), the arrival jitter with a 4 sigma like margin and the read chunks.
+    int bytesPerSample = 2 * (m_sampleBytes & 0xF);
+    int64_t delay = (m_lowLatency ? m_frameNbBytes / 2 : (3 * m_frameNbBytes) / 2) + m_readNbBytes;
+    delay += (int64_t) (4.0f * m_targetJitterUs * getBytesPerSecond()) / 1000000LL;
+    int64_t maxDelay = (nbDecoderSlots / 2 - 1) * m_frameNbBytes; // late blocks detection needs less than half the buffer
+    delay = delay > maxDelay ? maxDelay : delay;
+    m_targetDelayBytes = delay - (delay % bytesPerSample);
 }
 
-void SDRdaemonSourceBuffer::rwCorrectionEstimate(int slotIndex)
+void SDRdaemonSourceBuffer::estimateJitter(uint16_t frameIndex)
 {
-	if (m_nbReads >= 40) // check every ~1s as tick is ~50ms
-	{
-		int targetPivotSlot = (slotIndex + (nbDecoderSlots/2))  % nbDecoderSlots; // slot at half buffer opposite of current write slot
-		int targetPivotIndex = targetPivotSlot * sizeof(BufferFrame);             // buffer index corresponding to start of above slot
-		int normalizedReadIndex = (m_readIndex < targetPivotIndex ? m_readIndex + nbDecoderSlots * sizeof(BufferFrame) :  m_readIndex)
-				- (targetPivotSlot * sizeof(BufferFrame)); // normalize read index so it is positive and zero at start of pivot slot
-		int dBytes;
-        int rwDelta = (m_nbReads * m_readNbBytes) - (m_nbWrites * sizeof(BufferFrame));
-
-		if (normalizedReadIndex < (nbDecoderSlots/ 2) * (int) sizeof(BufferFrame)) // read leads
-		{
-			dBytes = - normalizedReadIndex - rwDelta;
-		}
-		else // read lags
-		{
-			dBytes = (nbDecoderSlots * sizeof(BufferFrame)) - normalizedReadIndex - rwDelta;
-		}
-
-        m_balCorrection = (m_balCorrection / 4) + (dBytes / (int) (m_currentMeta.m_sampleBytes * 2 * m_nbReads)); // correction is in number of samples. Alpha = 0.25
-
-        if (m_balCorrection < -m_balCorrLimit) {
-            m_balCorrection = -m_balCorrLimit;
-        } else if (m_balCorrection > m_balCorrLimit) {
-            m_balCorrection = m_balCorrLimit;
+    qint64 nowUs = m_clock.nsecsElapsed() / 1000;
+    int bytesPerSecond = getBytesPerSecond();
+
+    if ((m_lastArrivalUs >= 0) && (bytesPerSecond != 0))
+    {
+        uint16_t nbFrames = frameIndex - m_lastArrivalFrame;
+
+        if (nbFrames < nbDecoderSlots) // else stream restarted or too many frames lost to make sense
+        {
+            qint64 expectedUs = (nbFrames * (qint64) m_frameNbBytes * 1000000LL) / bytesPerSecond;
+            float deviationUs = std::abs((float) (nowUs - m_lastArrivalUs - expectedUs));
+            m_jitterUs += (deviationUs - m_jitterUs) / 16.0f;
+            m_jitterPeakUs = m_jitterUs > m_jitterPeakUs ? m_jitterUs : m_jitterPeakUs;
+            QMutexLocker mutexLocker(&m_histogramsMutex);
+            m_jitterHistogram.add(deviationUs / 1000.0f);
         }
+    }
 
-	    m_nbReads = 0;
-	    m_nbWrites = 0;
-	}
+    m_lastArrivalUs = nowUs;
+    m_lastArrivalFrame = frameIndex;
+}
+
+void SDRdaemonSourceBuffer::rwCorrectionEstimate()
+{
+    qint64 nowUs = m_clock.nsecsElapsed() / 1000;
+    int bytesPerSecond = getBytesPerSecond();
+
+    if ((nowUs - m_lastCorrectionUs < 1000000LL) || (m_nbDelays == 0) || (bytesPerSecond == 0)) { // every ~1s
+        return;
+    }
+
+    // The average over the period smoothes out the saw tooth of the frames bursts.
+    double periodS = (nowUs - m_lastCorrectionUs) / 1e6;
+    double timeConstantS = m_lowLatency ? 5.0 : 20.0;
+    m_avgDelayBytes = m_delaySumBytes / m_nbDelays;
+    int errorBytes = m_avgDelayBytes - m_targetDelayBytes; // positive: read lags
+    m_delaySumBytes = 0;
+    m_nbDelays = 0;
+    m_lastCorrectionUs = nowUs;
+
+    // jitter used for the target: follows the peaks at once and decays slowly so that the target remains steady
+    m_targetJitterUs = m_jitterPeakUs > 0.9f * m_targetJitterUs ? m_jitterPeakUs : 0.9f * m_targetJitterUs;
+    m_jitterPeakUs = m_jitterUs;
+    updateTargetDelay();
+
+    if (std::abs(errorBytes) > std::max(m_frameNbBytes, m_targetDelayBytes / 2)) // too far to be corrected smoothly (start or stream disruption): move the read index
+    {
+        int bytesPerSample = 2 * (m_sampleBytes & 0xF);
+        errorBytes -= errorBytes % bytesPerSample;
+        m_readIndex = (m_readIndex + errorBytes + m_framesNbBytes) % m_framesNbBytes;
+        m_avgDelayBytes -= errorBytes;
+        qDebug("SDRdaemonSourceBuffer::rwCorrectionEstimate: resync read index by %d bytes", errorBytes);
+        return;
+    }
+
+    // Critically damped PI loop on the delay error. The integral part tracks the clock drift.
+    double errorS = (double) errorBytes / bytesPerSecond;
+    m_driftIntegral += (errorS * periodS) / (timeConstantS * timeConstantS);
+    m_driftIntegral = m_driftIntegral > 5e-4 ? 5e-4 : m_driftIntegral < -5e-4 ? -5e-4 : m_driftIntegral;
+    m_driftCorrection = m_driftIntegral + (2.0 * errorS) / timeConstantS;
+    m_driftCorrection = m_driftCorrection > 1e-3 ? 1e-3 : m_driftCorrection < -1e-3 ? -1e-3 : m_driftCorrection;
+}
+
+void SDRdaemonSourceBuffer::checkLateBlock(int slotIndex, int blockIndex)
+{
+    if (m_decoderSlots[slotIndex].m_late) { // one count per frame
+        return;
+    }
+
+    int blockStart = slotIndex * m_frameNbBytes + (blockIndex - 1) * m_blockNbBytes;
+    int readAhead = (m_readIndex + m_framesNbBytes - blockStart) % m_framesNbBytes; // distance of read index past the block start
+
+    if (readAhead < m_framesNbBytes / 2) // read index already passed the block start
+    {
+        m_decoderSlots[slotIndex].m_late = true;
+        m_lateFrames++;
+        QMutexLocker mutexLocker(&m_histogramsMutex);
+        m_lateHistogram.add(getDelayMs(readAhead));
+    }
 }
 
 void SDRdaemonSourceBuffer::checkSlotData(int slotIndex)
 {
-    int pseudoWriteIndex = slotIndex * sizeof(BufferFrame);
+    int pseudoWriteIndex = slotIndex * m_frameNbBytes;
     m_wrDeltaEstimate = pseudoWriteIndex - m_readIndex;
-    m_nbWrites++;
 
-    int rwDelayBytes = (m_wrDeltaEstimate > 0 ? m_wrDeltaEstimate : sizeof(BufferFrame) * nbDecoderSlots + m_wrDeltaEstimate);
+    int rwDelayBytes = (m_wrDeltaEstimate > 0 ? m_wrDeltaEstimate : m_frameNbBytes * nbDecoderSlots + m_wrDeltaEstimate);
     int sampleRate = m_currentMeta.m_sampleRate;
 
     if (sampleRate > 0)
     {
         int64_t ts = m_currentMeta.m_tv_sec * 1000000LL + m_currentMeta.m_tv_usec;
-        ts -= (rwDelayBytes * 1000000LL) / (sampleRate * 2 * m_currentMeta.m_sampleBytes);
+        ts -= (rwDelayBytes * 1000000LL) / (sampleRate * 2 * (m_currentMeta.m_sampleBytes & 0xF));
         m_tvOut_sec = ts / 1000000LL;
         m_tvOut_usec = ts - (m_tvOut_sec * 1000000LL);
     }
@@ -194,6 +342,9 @@ void SDRdaemonSourceBuffer::writeData(char *array)
     int frameIndex = superBlock->m_header.m_frameIndex;
     int decoderIndex = frameIndex % nbDecoderSlots;
 
+    // samples format of the stream is in each block header
+    setFramesFormat(superBlock->m_header.m_sampleBytes, superBlock->m_header.m_sampleBits);
+
     // frame break
 
     if (m_frameHead == -1) // initial state
@@ -208,8 +359,10 @@ void SDRdaemonSourceBuffer::writeData(char *array)
         m_decoderIndexHead = decoderIndex; // new decoder slot head
         m_frameHead = frameIndex;          // new frame head
         checkSlotData(decoderIndex);       // check slot before re-init
-        rwCorrectionEstimate(decoderIndex);
+        estimateJitter(frameIndex);
+        updateTargetDelay();
         initDecodeSlot(decoderIndex);      // collect stats and re-initialize current slot
+        m_writeIndex = decoderIndex * m_frameNbBytes;
     }
 
     // Block processing
@@ -230,6 +383,10 @@ void SDRdaemonSourceBuffer::writeData(char *array)
         {
             m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks[blockCount].Block = (void *) storeOriginalBlock(decoderIndex, blockIndex, superBlock->m_protectedBlock);
             m_decoderSlots[decoderIndex].m_originalCount++;
+
+            if ((decoderIndex == m_decoderIndexHead) && (decoderIndex * m_frameNbBytes + blockIndex * m_blockNbBytes > m_writeIndex)) {
+                m_writeIndex = decoderIndex * m_frameNbBytes + blockIndex * m_blockNbBytes; // blocks may arrive out of order
+            }
         }
         else // recovery data
         {
@@ -245,6 +402,10 @@ void SDRdaemonSourceBuffer::writeData(char *array)
     {
         m_decoderSlots[decoderIndex].m_decoded = true;
 
+        if (decoderIndex == m_decoderIndexHead) {
+            m_writeIndex = (decoderIndex + 1) * m_frameNbBytes; // whole frame available
+        }
+
         if (m_cm256_OK && (m_decoderSlots[decoderIndex].m_recoveryCount > 0)) // recovery data used => need to decode FEC
         {
             m_paramsCM256.BlockBytes = sizeof(SDRDaemonProtectedBlock); // never changes
@@ -311,11 +472,8 @@ void SDRdaemonSourceBuffer::writeData(char *array)
             {
                 uint32_t sampleRate =  metaData->m_sampleRate;
 
-                if (sampleRate != 0)
-                {
-                    m_bufferLenSec = (float) m_framesNbBytes / (float) (sampleRate * metaData->m_sampleBytes * 2);
-                    m_balCorrLimit = sampleRate / 1000; // +/- 1 ms correction max per read
-                    m_readNbBytes = (sampleRate * metaData->m_sampleBytes * 2) / 20;
+                if (sampleRate != 0) {
+                    m_bufferLenSec = (float) m_framesNbBytes / (float) (sampleRate * (metaData->m_sampleBytes & 0xF) * 2);
                 }
 
                 printMeta("SDRdaemonSourceBuffer::writeData: new meta", metaData); // print for change other than timestamp
@@ -328,16 +486,36 @@ void SDRdaemonSourceBuffer::writeData(char *array)
 
 uint8_t *SDRdaemonSourceBuffer::readData(int32_t length)
 {
-    uint8_t *buffer = (uint8_t *) m_frames;
+    uint8_t *buffer = m_frames;
     uint32_t readIndex = m_readIndex;
 
-    m_nbReads++;
-
     // SEGFAULT FIX: arbitratily truncate so that it does not exceed buffer length
-    if (length > framesSize) {
-        length = framesSize;
+    if (length > m_framesNbBytes) {
+        length = m_framesNbBytes;
+    }
+
+    // write to read distance at the end of this read
+    int delay = (m_writeIndex + 2 * m_framesNbBytes - m_readIndex - length) % m_framesNbBytes;
+    m_readNbBytes = length;
+
+    if (delay > m_framesNbBytes - m_frameNbBytes) // read overtakes write: restart at target distance
+    {
+        qDebug("SDRdaemonSourceBuffer::readData: read index overtakes write index: resync");
+        m_readIndex = (m_writeIndex + 2 * m_framesNbBytes - m_targetDelayBytes - length) % m_framesNbBytes;
+        readIndex = m_readIndex;
+        delay = m_targetDelayBytes;
+    }
+
+    m_delaySumBytes += delay;
+    m_nbDelays++;
+
+    {
+        QMutexLocker mutexLocker(&m_histogramsMutex);
+        m_latencyHistogram.add(getDelayMs(delay));
     }
 
+    rwCorrectionEstimate();
+
     if (m_readIndex + length < m_framesNbBytes) // ends before buffer bound
     {
         m_readIndex += length;
@@ -375,6 +553,7 @@ void SDRdaemonSourceBuffer::printMeta(const QString& header, SDRDaemonMetaDataFE
             << ":" << metaData->m_sampleRate
             << ":" << (int) (metaData->m_sampleBytes & 0xF)
             << ":" << (int) metaData->m_sampleBits
+            << ":" << SDRDaemonCodec::getName(metaData->m_sampleBytes >> 4)
             << ":" << (int) metaData->m_nbOriginalBlocks
             << ":" << (int) metaData->m_nbFECBlocks
             << "|" << metaData->m_tv_sec
@@ -19,10 +19,14 @@
 
 #include <QString>
 #include <QDebug>
+#include <QMutex>
+#include <QElapsedTimer>
 #include <cstdlib>
+#include <algorithm>
 #include "cm256.h"
 #include "util/movingaverage.h"
 #include "channel/sdrdaemondatablock.h"
+#include "channel/sdrdaemoncodec.h"
 
 
 #define SDRDAEMONSOURCE_UDPSIZE 512               // UDP payload size
@@ -32,6 +36,18 @@
 class SDRdaemonSourceBuffer
 {
 public:
+    /** Counts of values in milliseconds by buckets of increasing upper bounds. The last bucket is open ended. */
+    struct Histogram
+    {
+        static const int nbBuckets = 12;
+        static const int m_boundsMs[nbBuckets - 1];
+        uint32_t m_counts[nbBuckets];
+
+        Histogram() { reset(); }
+        void reset() { std::fill(m_counts, m_counts + nbBuckets, 0); }
+        void add(float valueMs);
+    };
+
 	SDRdaemonSourceBuffer();
 	~SDRdaemonSourceBuffer();
 
@@ -39,6 +55,10 @@ public:
 	void writeData(char *array); //!< Write data into buffer.
 	uint8_t *readData(int32_t length);            //!< Read data from buffer
 
+	/** In low latency mode the read index follows the last block received instead of whole frames. Blocks recovered by FEC may arrive too late. */
+	void setLowLatency(bool lowLatency);
+	bool getLowLatency() const { return m_lowLatency; }
+
 	// meta data
 	const SDRDaemonMetaDataFEC& getCurrentMeta() const { return m_currentMeta; }
 
@@ -85,9 +105,17 @@ public:
     }
 
     float getBufferLengthInSecs() const { return m_bufferLenSec; }
-    int32_t getRWBalanceCorrection() const { return m_balCorrection; }
-
-    /** Get buffer gauge value in % of buffer size ([-50:50])
+    /** Relative read rate correction to apply to the samples read so that the buffer delay converges to its target (positive: read faster) */
+    double getDriftCorrection() const { return m_driftCorrection; }
+    /** Estimated clock drift of the sender relative to the receiver in parts per million */
+    float getDriftPpm() const { return m_driftIntegral * 1e6; }
+    float getJitterMs() const { return m_jitterUs / 1000.0f; }
+    float getBufferLatencyMs() const { return getDelayMs(m_avgDelayBytes); }
+    float getTargetLatencyMs() const { return getDelayMs(m_targetDelayBytes); }
+    uint32_t getLateFrames() const { return m_lateFrames; }
+    void getHistograms(Histogram& latency, Histogram& jitter, Histogram& late);
+
+    /** Get buffer gauge value in % of buffer size ([-50:50]) off the target distance between write and read
      *  [-50:0] : write leads or read lags
      *  [0:50]  : read leads or write lags
      */
@@ -95,9 +123,9 @@ public:
     {
         if (m_framesNbBytes)
         {
-            int32_t val = (m_wrDeltaEstimate * 100) / (int32_t) m_framesNbBytes;
-            int32_t ret = val < 0 ? -val - 50 : 50 -val;
-            return ret;
+            int32_t delay = m_wrDeltaEstimate > 0 ? m_wrDeltaEstimate : m_framesNbBytes + m_wrDeltaEstimate;
+            int32_t ret = ((m_targetDelayBytes - delay) * 100) / (int32_t) m_framesNbBytes;
+            return ret < -50 ? -50 : ret > 50 ? 50 : ret;
         }
         else
         {
@@ -105,18 +133,12 @@ public:
         }
     }
 
-    static const int framesSize = SDRDAEMONSOURCE_NBDECODERSLOTS * (SDRDaemonNbOrginalBlocks - 1) * SDRDaemonNbBytesPerBlock;
+    /** Samples buffer size for the largest decoded blocks. The actual size depends on the samples format. */
+    static const int framesSize = SDRDAEMONSOURCE_NBDECODERSLOTS * (SDRDaemonNbOrginalBlocks - 1) * SDRDaemonMaxDecodedBlockBytes;
 
 private:
     static const int nbDecoderSlots = SDRDAEMONSOURCE_NBDECODERSLOTS;
 
-#pragma pack(push, 1)
-    struct BufferFrame
-    {
-        SDRDaemonProtectedBlock  m_blocks[SDRDaemonNbOrginalBlocks - 1];
-    };
-#pragma pack(pop)
-
     struct DecoderSlot
     {
         SDRDaemonProtectedBlock m_blockZero;                                       //!< First block of a frame. Has meta data.
@@ -128,13 +150,18 @@ private:
         int                     m_recoveryCount;      //!< number of recovery blocks received
         bool                    m_decoded;            //!< true if decoded
         bool                    m_metaRetrieved;      //!< true if meta data (block zero) was retrieved
+        bool                    m_late;               //!< true if a block was stored after the read index passed it
     };
 
     SDRDaemonMetaDataFEC m_currentMeta;          //!< Stored current meta data
     CM256::cm256_encoder_params m_paramsCM256;          //!< CM256 decoder parameters block
     DecoderSlot          m_decoderSlots[nbDecoderSlots]; //!< CM256 decoding control/buffer slots
-    BufferFrame          m_frames[nbDecoderSlots];       //!< Samples buffer
+    uint8_t             *m_frames;                       //!< Samples buffer of decoded blocks (framesSize bytes)
     int                  m_framesNbBytes;                //!< Number of bytes in samples buffer
+    int                  m_frameNbBytes;                 //!< Number of bytes of one decoded frame
+    int                  m_blockNbBytes;                 //!< Number of bytes of one decoded block
+    uint8_t              m_sampleBytes;                  //!< Samples format and size of the blocks in the samples buffer
+    uint8_t              m_sampleBits;                   //!< Samples bits of the blocks in the samples buffer
     int                  m_decoderIndexHead;     //!< index of the current head frame slot in decoding slots
     int                  m_frameHead;            //!< index of the current head frame sent
     int                  m_curNbBlocks;          //!< (stats) instantaneous number of blocks received
@@ -148,6 +175,7 @@ private:
     MovingAverageUtil<int, int, 10> m_avgNbRecovery; //!< (stats) average number of recovery blocks used
     bool                 m_framesDecoded;        //!< [stats] true if all frames were decoded since last poll
     int                  m_readIndex;            //!< current byte read index in frames buffer
+    int                  m_writeIndex;           //!< byte index past the last original block of the head frame written in frames buffer
     int                  m_wrDeltaEstimate;      //!< Sampled estimate of write to read indexes difference
     uint32_t             m_tvOut_sec;            //!< Estimated returned samples timestamp (seconds)
     uint32_t             m_tvOut_usec;           //!< Estimated returned samples timestamp (microseconds)
@@ -158,37 +186,52 @@ private:
 
     float    m_bufferLenSec;
 
-    int      m_nbReads;       //!< Number of buffer reads since start of auto R/W balance correction period
-    int      m_nbWrites;      //!< Number of buffer writes since start of auto R/W balance correction period
-    int      m_balCorrection; //!< R/W balance correction in number of samples
-    int      m_balCorrLimit;  //!< Correction absolute value limit in number of samples
+    bool          m_lowLatency;       //!< Target delay of a fraction of frame instead of more than one frame
+    QElapsedTimer m_clock;            //!< Time base of frames arrival and of drift correction
+    qint64        m_lastArrivalUs;    //!< Arrival time of the previous frame head (-1 if none yet)
+    uint16_t      m_lastArrivalFrame; //!< Index of the previous frame head
+    float         m_jitterUs;         //!< Smoothed frame arrival jitter (RFC 3550 interarrival jitter estimator)
+    float         m_jitterPeakUs;     //!< Peak of smoothed jitter since start of the correction period
+    float         m_targetJitterUs;   //!< Jitter used for the target delay with fast attack and slow release
+    int           m_targetDelayBytes; //!< Adaptive target distance between write and read indexes
+    qint64        m_delaySumBytes;    //!< Sum of write to read distances since start of the correction period
+    int           m_nbDelays;         //!< Number of write to read distances since start of the correction period
+    int           m_avgDelayBytes;    //!< Average write to read distance of the last correction period
+    qint64        m_lastCorrectionUs; //!< Start of the correction period
+    double        m_driftCorrection;  //!< Relative read rate correction
+    double        m_driftIntegral;    //!< Integral part of the read rate correction i.e. the clock drift
+    uint32_t      m_lateFrames;       //!< Number of frames with blocks stored after they were read
+    QMutex        m_histogramsMutex;
+    Histogram     m_latencyHistogram; //!< Write to read distance at each read (ms)
+    Histogram     m_jitterHistogram;  //!< Frame arrival time deviations (ms)
+    Histogram     m_lateHistogram;    //!< Lateness of the first late block of late frames (ms)
     CM256    m_cm256;         //!< CM256 library
     bool     m_cm256_OK;      //!< CM256 library initialized OK
 
+    /** Keep the block as received for FEC and decode its samples in the frame slot */
     inline SDRDaemonProtectedBlock* storeOriginalBlock(int slotIndex, int blockIndex, const SDRDaemonProtectedBlock& protectedBlock)
     {
         if (blockIndex == 0) {
-            // m_decoderSlots[slotIndex].m_originalBlocks[0] = protectedBlock;
-            // return &m_decoderSlots[slotIndex].m_originalBlocks[0];
             m_decoderSlots[slotIndex].m_blockZero = protectedBlock;
             return &m_decoderSlots[slotIndex].m_blockZero;
         } else {
-            // m_decoderSlots[slotIndex].m_originalBlocks[blockIndex] = protectedBlock;
-            // return &m_decoderSlots[slotIndex].m_originalBlocks[blockIndex];
-            m_frames[slotIndex].m_blocks[blockIndex - 1] = protectedBlock;
-            return &m_frames[slotIndex].m_blocks[blockIndex - 1];
+            m_decoderSlots[slotIndex].m_originalBlocks[blockIndex] = protectedBlock;
+            SDRDaemonCodec::decode(m_sampleBytes >> 4, protectedBlock, m_sampleBits, m_sampleBytes & 0xF,
+                    &m_frames[slotIndex * m_frameNbBytes + (blockIndex - 1) * m_blockNbBytes]);
+            checkLateBlock(slotIndex, blockIndex);
+            return &m_decoderSlots[slotIndex].m_originalBlocks[blockIndex];
         }
     }
 
-    inline SDRDaemonProtectedBlock& getOriginalBlock(int slotIndex, int blockIndex)
+    /** Number of bytes of decoded samples per second of stream */
+    inline int getBytesPerSecond() const {
+        return m_currentMeta.m_sampleRate * 2 * (m_sampleBytes & 0xF);
+    }
+
+    inline float getDelayMs(int delayBytes) const
     {
-        if (blockIndex == 0) {
-            // return m_decoderSlots[slotIndex].m_originalBlocks[0];
-            return m_decoderSlots[slotIndex].m_blockZero;
-        } else {
-            // return m_decoderSlots[slotIndex].m_originalBlocks[blockIndex];
-            return m_frames[slotIndex].m_blocks[blockIndex - 1];
-        }
+        int bytesPerSecond = getBytesPerSecond();
+        return bytesPerSecond == 0 ? 0.0f : (delayBytes * 1000.0f) / bytesPerSecond;
     }
 
     inline SDRDaemonMetaDataFEC *getMetaData(int slotIndex)
@@ -201,14 +244,18 @@ private:
     {
         // memset((void *) m_decoderSlots[slotIndex].m_originalBlocks, 0, m_nbOriginalBlocks * sizeof(ProtectedBlock));
         memset((void *) &m_decoderSlots[slotIndex].m_blockZero, 0, sizeof(SDRDaemonProtectedBlock));
-        memset((void *) m_frames[slotIndex].m_blocks, 0, (SDRDaemonNbOrginalBlocks - 1) * sizeof(SDRDaemonProtectedBlock));
+        memset((void *) &m_frames[slotIndex * m_frameNbBytes], 0, m_frameNbBytes);
     }
 
     void initDecodeAllSlots();
     void initReadIndex();
-    void rwCorrectionEstimate(int slotIndex);
+    void rwCorrectionEstimate();
     void checkSlotData(int slotIndex);
+    void checkLateBlock(int slotIndex, int blockIndex);
+    void estimateJitter(uint16_t frameIndex);
+    void updateTargetDelay();
     void initDecodeSlot(int slotIndex);
+    void setFramesFormat(uint8_t sampleBytes, uint8_t sampleBits);
 
     static void printMeta(const QString& header, SDRDaemonMetaDataFEC *metaData);
 };
@@ -300,6 +300,7 @@ void SDRdaemonSourceGui::displaySettings()
 
 	ui->dcOffset->setChecked(m_settings.m_dcBlock);
 	ui->iqImbalance->setChecked(m_settings.m_iqCorrection);
+	ui->lowLatency->setChecked(m_settings.m_lowLatency);
 
 	blockApplySettings(false);
 }
@@ -410,6 +411,12 @@ void SDRdaemonSourceGui::on_iqImbalance_toggled(bool checked)
     sendSettings();
 }
 
+void SDRdaemonSourceGui::on_lowLatency_toggled(bool checked)
+{
+    m_settings.m_lowLatency = checked;
+    sendSettings();
+}
+
 void SDRdaemonSourceGui::on_startStop_toggled(bool checked)
 {
     if (m_doApplySettings)
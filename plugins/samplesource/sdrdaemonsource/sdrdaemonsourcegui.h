@@ -123,6 +123,7 @@ private slots:
     void on_dataApplyButton_clicked(bool checked);
 	void on_dcOffset_toggled(bool checked);
 	void on_iqImbalance_toggled(bool checked);
+	void on_lowLatency_toggled(bool checked);
 	void on_apiAddress_returnPressed();
 	void on_apiPort_returnPressed();
     void on_dataAddress_returnPressed();
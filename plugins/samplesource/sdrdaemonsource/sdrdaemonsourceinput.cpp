@@ -18,8 +18,6 @@
 #include <errno.h>
 
 #include <QDebug>
-#include <QNetworkReply>
-#include <QBuffer>
 
 #include "SWGDeviceSettings.h"
 #include "SWGDeviceState.h"
@@ -31,6 +29,7 @@
 #include "dsp/dspengine.h"
 #include "device/devicesourceapi.h"
 #include "dsp/filerecord.h"
+#include "webapi/webapireversedispatcher.h"
 
 #include "sdrdaemonsourceinput.h"
 #include "sdrdaemonsourceudphandler.h"
@@ -55,15 +54,10 @@ SDRdaemonSourceInput::SDRdaemonSourceInput(DeviceSourceAPI *deviceAPI) :
 
     m_fileSink = new FileRecord(QString("test_%1.sdriq").arg(m_deviceAPI->getDeviceUID()));
     m_deviceAPI->addSink(m_fileSink);
-
-    m_networkManager = new QNetworkAccessManager();
-    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
 }
 
 SDRdaemonSourceInput::~SDRdaemonSourceInput()
 {
-    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
-    delete m_networkManager;
 	stop();
     m_deviceAPI->removeSink(m_fileSink);
     delete m_fileSink;
@@ -250,6 +244,9 @@ void SDRdaemonSourceInput::applySettings(const SDRdaemonSourceSettings& settings
     if ((m_settings.m_fileRecordName != settings.m_fileRecordName) || force) {
         reverseAPIKeys.append("fileRecordName");
     }
+    if ((m_settings.m_lowLatency != settings.m_lowLatency) || force) {
+        reverseAPIKeys.append("lowLatency");
+    }
 
     if ((m_settings.m_dcBlock != settings.m_dcBlock) || (m_settings.m_iqCorrection != settings.m_iqCorrection) || force)
     {
@@ -259,6 +256,10 @@ void SDRdaemonSourceInput::applySettings(const SDRdaemonSourceSettings& settings
                 settings.m_iqCorrection ? "true" : "false");
     }
 
+    if ((m_settings.m_lowLatency != settings.m_lowLatency) || force) {
+        m_SDRdaemonUDPHandler->setLowLatency(settings.m_lowLatency);
+    }
+
     m_SDRdaemonUDPHandler->configureUDPLink(settings.m_dataAddress, settings.m_dataPort);
     m_SDRdaemonUDPHandler->getRemoteAddress(remoteAddress);
 
@@ -353,6 +354,9 @@ int SDRdaemonSourceInput::webapiSettingsPutPatch(
     if (deviceSettingsKeys.contains("fileRecordName")) {
         settings.m_fileRecordName = *response.getSdrDaemonSourceSettings()->getFileRecordName();
     }
+    if (deviceSettingsKeys.contains("lowLatency")) {
+        settings.m_lowLatency = response.getSdrDaemonSourceSettings()->getLowLatency() != 0;
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getSdrDaemonSourceSettings()->getUseReverseApi() != 0;
     }
@@ -387,6 +391,7 @@ void SDRdaemonSourceInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSett
     response.getSdrDaemonSourceSettings()->setDataPort(settings.m_dataPort);
     response.getSdrDaemonSourceSettings()->setDcBlock(settings.m_dcBlock ? 1 : 0);
     response.getSdrDaemonSourceSettings()->setIqCorrection(settings.m_iqCorrection);
+    response.getSdrDaemonSourceSettings()->setLowLatency(settings.m_lowLatency ? 1 : 0);
 
     if (response.getSdrDaemonSourceSettings()->getFileRecordName()) {
         *response.getSdrDaemonSourceSettings()->getFileRecordName() = settings.m_fileRecordName;
@@ -428,6 +433,24 @@ void SDRdaemonSourceInput::webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport
 
     response.getSdrDaemonSourceReport()->setMinNbBlocks(m_SDRdaemonUDPHandler->getMinNbBlocks());
     response.getSdrDaemonSourceReport()->setMaxNbRecovery(m_SDRdaemonUDPHandler->getMaxNbRecovery());
+    response.getSdrDaemonSourceReport()->setBufferLatencyMs(m_SDRdaemonUDPHandler->getBufferLatencyMs());
+    response.getSdrDaemonSourceReport()->setTargetLatencyMs(m_SDRdaemonUDPHandler->getTargetLatencyMs());
+    response.getSdrDaemonSourceReport()->setJitterMs(m_SDRdaemonUDPHandler->getJitterMs());
+    response.getSdrDaemonSourceReport()->setDriftPpm(m_SDRdaemonUDPHandler->getDriftPpm());
+    response.getSdrDaemonSourceReport()->setLateFrames(m_SDRdaemonUDPHandler->getLateFrames());
+
+    SDRdaemonSourceBuffer::Histogram latency, jitter, late;
+    m_SDRdaemonUDPHandler->getHistograms(latency, jitter, late);
+    response.getSdrDaemonSourceReport()->getLatencyHistogram()->clear();
+    response.getSdrDaemonSourceReport()->getJitterHistogram()->clear();
+    response.getSdrDaemonSourceReport()->getLateHistogram()->clear();
+
+    for (int i = 0; i < SDRdaemonSourceBuffer::Histogram::nbBuckets; i++)
+    {
+        response.getSdrDaemonSourceReport()->getLatencyHistogram()->append(latency.m_counts[i]);
+        response.getSdrDaemonSourceReport()->getJitterHistogram()->append(jitter.m_counts[i]);
+        response.getSdrDaemonSourceReport()->getLateHistogram()->append(late.m_counts[i]);
+    }
 }
 
 void SDRdaemonSourceInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const SDRdaemonSourceSettings& settings, bool force)
@@ -461,54 +484,27 @@ void SDRdaemonSourceInput::webapiReverseSendSettings(QList<QString>& deviceSetti
     if (deviceSettingsKeys.contains("fileRecordName") || force) {
         swgSDRDaemonSourceSettings->setFileRecordName(new QString(settings.m_fileRecordName));
     }
+    if (deviceSettingsKeys.contains("lowLatency") || force) {
+        swgSDRDaemonSourceSettings->setLowLatency(settings.m_lowLatency ? 1 : 0);
+    }
 
-    QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
-            .arg(settings.m_reverseAPIAddress)
-            .arg(settings.m_reverseAPIPort)
+    QString deviceSettingsPath = QString("/sdrangel/deviceset/%1/device/settings")
             .arg(settings.m_reverseAPIDeviceIndex);
-    m_networkRequest.setUrl(QUrl(deviceSettingsURL));
-    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-
-    QBuffer *buffer=new QBuffer();
-    buffer->open((QBuffer::ReadWrite));
-    buffer->write(swgDeviceSettings->asJson().toUtf8());
-    buffer->seek(0);
 
     // Always use PATCH to avoid passing reverse API settings
-    m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    WebAPIReverseDispatcher::instance()->sendPatch(settings.m_reverseAPIAddress, settings.m_reverseAPIPort, deviceSettingsPath, swgDeviceSettings->asJson());
 
     delete swgDeviceSettings;
 }
 
 void SDRdaemonSourceInput::webapiReverseSendStartStop(bool start)
 {
-    QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/run")
-            .arg(m_settings.m_reverseAPIAddress)
-            .arg(m_settings.m_reverseAPIPort)
+    QString deviceSettingsPath = QString("/sdrangel/deviceset/%1/device/run")
             .arg(m_settings.m_reverseAPIDeviceIndex);
-    m_networkRequest.setUrl(QUrl(deviceSettingsURL));
 
     if (start) {
-        m_networkManager->sendCustomRequest(m_networkRequest, "POST");
+        WebAPIReverseDispatcher::instance()->send(m_settings.m_reverseAPIAddress, m_settings.m_reverseAPIPort, "POST", deviceSettingsPath);
     } else {
-        m_networkManager->sendCustomRequest(m_networkRequest, "DELETE");
-    }
-}
-
-void SDRdaemonSourceInput::networkManagerFinished(QNetworkReply *reply)
-{
-    QNetworkReply::NetworkError replyError = reply->error();
-
-    if (replyError)
-    {
-        qWarning() << "SDRdaemonSourceInput::networkManagerFinished:"
-                << " error(" << (int) replyError
-                << "): " << replyError
-                << ": " << reply->errorString();
-        return;
+        WebAPIReverseDispatcher::instance()->send(m_settings.m_reverseAPIAddress, m_settings.m_reverseAPIPort, "DELETE", deviceSettingsPath);
     }
-
-    QString answer = reply->readAll();
-    answer.chop(1); // remove last \n
-    qDebug("SDRdaemonSourceInput::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
 }
@@ -30,6 +30,7 @@ void SDRdaemonSourceSettings::resetToDefaults()
     m_dataPort = 9090;
     m_dcBlock = false;
     m_iqCorrection = false;
+    m_lowLatency = false;
     m_fileRecordName = "";
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
@@ -51,6 +52,7 @@ QByteArray SDRdaemonSourceSettings::serialize() const
     s.writeString(12, m_reverseAPIAddress);
     s.writeU32(13, m_reverseAPIPort);
     s.writeU32(14, m_reverseAPIDeviceIndex);
+    s.writeBool(15, m_lowLatency);
 
     return s.final();
 }
@@ -89,6 +91,7 @@ bool SDRdaemonSourceSettings::deserialize(const QByteArray& data)
 
         d.readU32(14, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readBool(15, &m_lowLatency, false);
         return true;
     }
     else
@@ -27,6 +27,7 @@ struct SDRdaemonSourceSettings {
     quint16 m_dataPort;
     bool    m_dcBlock;
     bool    m_iqCorrection;
+    bool    m_lowLatency;
     QString m_fileRecordName;
     bool     m_useReverseAPI;
     QString  m_reverseAPIAddress;
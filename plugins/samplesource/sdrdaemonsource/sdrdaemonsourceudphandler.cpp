@@ -18,6 +18,8 @@
 #include <QDebug>
 #include <QTimer>
 
+#include <algorithm>
+
 #include "dsp/dspcommands.h"
 #include "dsp/dspengine.h"
 #include <device/devicesourceapi.h>
@@ -46,15 +48,18 @@ SDRdaemonSourceUDPHandler::SDRdaemonSourceUDPHandler(SampleSinkFifo *sampleFifo,
 	m_tickCount(0),
 	m_samplesCount(0),
 	m_timer(0),
+	m_lowLatencyTimer(0),
+	m_lowLatency(false),
     m_throttlems(SDRDAEMONSOURCE_THROTTLE_MS),
     m_readLengthSamples(0),
+    m_readLengthRemainder(0.0),
     m_readLength(0),
-    m_converterBuffer(0),
-    m_converterBufferNbSamples(0),
-    m_throttleToggle(false),
+    m_resamplerPhase(0.0),
 	m_autoCorrBuffer(true)
 {
     m_udpBuf = new char[SDRDaemonUdpSize];
+    m_lowLatencyTimer = new QTimer();
+    m_lowLatencyTimer->setTimerType(Qt::PreciseTimer);
 
 #ifdef USE_INTERNAL_TIMER
 #warning "Uses internal timer"
@@ -71,7 +76,7 @@ SDRdaemonSourceUDPHandler::~SDRdaemonSourceUDPHandler()
 {
 	stop();
 	delete[] m_udpBuf;
-	if (m_converterBuffer) { delete[] m_converterBuffer; }
+	delete m_lowLatencyTimer;
 #ifdef USE_INTERNAL_TIMER
     if (m_timer) {
         delete m_timer;
@@ -156,6 +161,41 @@ void SDRdaemonSourceUDPHandler::configureUDPLink(const QString& address, quint16
 	start();
 }
 
+void SDRdaemonSourceUDPHandler::setLowLatency(bool lowLatency)
+{
+    if (lowLatency == m_lowLatency) {
+        return;
+    }
+
+    qDebug("SDRdaemonSourceUDPHandler::setLowLatency: %s", lowLatency ? "true" : "false");
+    bool timerConnected = m_masterTimerConnected;
+    disconnectTimer();
+    m_lowLatency = lowLatency;
+
+    if (m_lowLatency)
+    {
+        m_lowLatencyTimer->start(SDRDAEMONSOURCE_LOWLATENCY_THROTTLE_MS);
+        m_throttlems = m_lowLatencyTimer->interval();
+    }
+    else
+    {
+        m_lowLatencyTimer->stop();
+#ifdef USE_INTERNAL_TIMER
+        m_throttlems = m_timer->interval();
+#else
+        m_throttlems = m_masterTimer.interval();
+#endif
+    }
+
+    m_rateDivider = 1000 / m_throttlems;
+    m_tickCount = 0;
+    m_sdrDaemonBuffer.setLowLatency(lowLatency);
+
+    if (timerConnected) {
+        connectTimer();
+    }
+}
+
 void SDRdaemonSourceUDPHandler::dataReadyRead()
 {
     m_udpReadBytes = 0;
@@ -218,12 +258,19 @@ void SDRdaemonSourceUDPHandler::connectTimer()
     if (!m_masterTimerConnected)
     {
         qDebug() << "SDRdaemonSourceUDPHandler::connectTimer";
+
+        if (m_lowLatency) {
+            connect(m_lowLatencyTimer, SIGNAL(timeout()), this, SLOT(tick()));
+        } else {
 #ifdef USE_INTERNAL_TIMER
 #warning "Uses internal timer"
-        connect(m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+            connect(m_timer, SIGNAL(timeout()), this, SLOT(tick()));
 #else
-        connect(&m_masterTimer, SIGNAL(timeout()), this, SLOT(tick()));
+            connect(&m_masterTimer, SIGNAL(timeout()), this, SLOT(tick()));
 #endif
+        }
+
+        m_elapsedTimer.restart();
         m_masterTimerConnected = true;
     }
 }
@@ -233,78 +280,49 @@ void SDRdaemonSourceUDPHandler::disconnectTimer()
     if (m_masterTimerConnected)
     {
         qDebug() << "SDRdaemonSourceUDPHandler::disconnectTimer";
+
+        if (m_lowLatency) {
+            disconnect(m_lowLatencyTimer, SIGNAL(timeout()), this, SLOT(tick()));
+        } else {
 #ifdef USE_INTERNAL_TIMER
 #warning "Uses internal timer"
-        disconnect(m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+            disconnect(m_timer, SIGNAL(timeout()), this, SLOT(tick()));
 #else
-        disconnect(&m_masterTimer, SIGNAL(timeout()), this, SLOT(tick()));
+            disconnect(&m_masterTimer, SIGNAL(timeout()), this, SLOT(tick()));
 #endif
+        }
+
         m_masterTimerConnected = false;
     }
 }
 
 void SDRdaemonSourceUDPHandler::tick()
 {
-    // auto throttling
-    int throttlems = m_elapsedTimer.restart();
-
-    if (throttlems != m_throttlems)
-    {
-        m_throttlems = throttlems;
-        m_readLengthSamples = (m_sdrDaemonBuffer.getCurrentMeta().m_sampleRate * (m_throttlems+(m_throttleToggle ? 1 : 0))) / 1000;
-        m_throttleToggle = !m_throttleToggle;
-    }
-
-    if (m_autoCorrBuffer) {
-        m_readLengthSamples += m_sdrDaemonBuffer.getRWBalanceCorrection();
-    }
+    // auto throttling: number of samples elapsed since last tick with the fractional part carried over
+    qint64 elapsedNs = m_elapsedTimer.nsecsElapsed();
+    m_elapsedTimer.restart();
+    m_throttlems = elapsedNs / 1000000LL;
+    elapsedNs = elapsedNs > SDRDAEMONSOURCE_MAX_READ_MS * 1000000LL ? SDRDAEMONSOURCE_MAX_READ_MS * 1000000LL : elapsedNs;
 
     const SDRDaemonMetaDataFEC& metaData =  m_sdrDaemonBuffer.getCurrentMeta();
-    m_readLength = m_readLengthSamples * (metaData.m_sampleBytes & 0xF) * 2;
-
-    if ((metaData.m_sampleBits == 16) && (SDR_RX_SAMP_SZ == 24)) // 16 -> 24 bits
-    {
-        if (m_readLengthSamples > m_converterBufferNbSamples)
-        {
-            if (m_converterBuffer) { delete[] m_converterBuffer; }
-            m_converterBuffer = new int32_t[m_readLengthSamples*2];
-        }
-
-        uint8_t *buf = m_sdrDaemonBuffer.readData(m_readLength);
+    double nbSamples = (metaData.m_sampleRate * (double) elapsedNs) / 1e9 + m_readLengthRemainder;
+    m_readLengthSamples = (uint32_t) nbSamples;
+    m_readLengthRemainder = nbSamples - m_readLengthSamples;
 
-        for (unsigned int is = 0; is < m_readLengthSamples; is++)
-        {
-            m_converterBuffer[2*is] = ((int16_t*)buf)[2*is]; // I
-            m_converterBuffer[2*is]<<=8;
-            m_converterBuffer[2*is+1] = ((int16_t*)buf)[2*is+1]; // Q
-            m_converterBuffer[2*is+1]<<=8;
-        }
-
-        m_sampleFifo->write(reinterpret_cast<quint8*>(m_converterBuffer), m_readLengthSamples*sizeof(Sample));
-    }
-    else if ((metaData.m_sampleBits == 24) && (SDR_RX_SAMP_SZ == 16)) // 24 -> 16 bits
+    if (m_readLengthSamples == 0)
     {
-        if (m_readLengthSamples > m_converterBufferNbSamples)
-        {
-            if (m_converterBuffer) { delete[] m_converterBuffer; }
-            m_converterBuffer = new int32_t[m_readLengthSamples];
-        }
-
-        uint8_t *buf = m_sdrDaemonBuffer.readData(m_readLength);
-
-        for (unsigned int is = 0; is < m_readLengthSamples; is++)
-        {
-            m_converterBuffer[is] =  ((int32_t *)buf)[2*is+1]>>8; // Q -> MSB
-            m_converterBuffer[is] <<=16;
-            m_converterBuffer[is] += ((int32_t *)buf)[2*is]>>8; // I -> LSB
-        }
-
-        m_sampleFifo->write(reinterpret_cast<quint8*>(m_converterBuffer), m_readLengthSamples*sizeof(Sample));
+        // nothing to deliver yet
     }
-    else if ((metaData.m_sampleBits == 16) || (metaData.m_sampleBits == 24)) // same sample size and valid size
+    else if ((metaData.m_sampleBits == 16) || (metaData.m_sampleBits == 24)) // valid size
     {
-        // read samples directly feeding the SampleFifo (no callback)
-        m_sampleFifo->write(reinterpret_cast<quint8*>(m_sdrDaemonBuffer.readData(m_readLength)), m_readLength);
+        // read slightly more or less samples than delivered to absorb the clock drift between the sender and this receiver
+        double ratio = m_autoCorrBuffer ? 1.0 + m_sdrDaemonBuffer.getDriftCorrection() : 1.0;
+        uint32_t nbReadSamples = (uint32_t) (m_resamplerPhase + (m_readLengthSamples - 1) * ratio) + 1;
+        m_readLength = nbReadSamples * (metaData.m_sampleBytes & 0xF) * 2;
+
+        convertSamples(m_sdrDaemonBuffer.readData(m_readLength), metaData.m_sampleBits, nbReadSamples);
+        resample(nbReadSamples, ratio);
+        m_sampleFifo->write(m_resamplerBuffer.begin(), m_resamplerBuffer.begin() + m_readLengthSamples);
         m_samplesCount += m_readLengthSamples;
     }
     else // invalid size
@@ -328,7 +346,7 @@ void SDRdaemonSourceUDPHandler::tick()
 	        int nbOriginalBlocks = m_sdrDaemonBuffer.getCurrentMeta().m_nbOriginalBlocks;
 	        int nbFECblocks = m_sdrDaemonBuffer.getCurrentMeta().m_nbFECBlocks;
 	        int sampleBits = m_sdrDaemonBuffer.getCurrentMeta().m_sampleBits;
-	        int sampleBytes = m_sdrDaemonBuffer.getCurrentMeta().m_sampleBytes;
+	        int sampleBytes = m_sdrDaemonBuffer.getCurrentMeta().m_sampleBytes & 0xF;
 
 	        //framesDecodingStatus = (minNbOriginalBlocks == nbOriginalBlocks ? 2 : (minNbOriginalBlocks < nbOriginalBlocks - nbFECblocks ? 0 : 1));
 	        if (minNbBlocks < nbOriginalBlocks) {
@@ -360,3 +378,56 @@ void SDRdaemonSourceUDPHandler::tick()
 		}
 	}
 }
+
+void SDRdaemonSourceUDPHandler::convertSamples(const uint8_t *buf, int sampleBits, uint32_t nbSamples)
+{
+    if (m_converterBuffer.size() < nbSamples) {
+        m_converterBuffer.resize(nbSamples);
+    }
+
+    if ((sampleBits == 16) && (SDR_RX_SAMP_SZ == 24)) // 16 -> 24 bits
+    {
+        for (unsigned int is = 0; is < nbSamples; is++)
+        {
+            m_converterBuffer[is].m_real = ((int16_t*)buf)[2*is] << 8;   // I
+            m_converterBuffer[is].m_imag = ((int16_t*)buf)[2*is+1] << 8; // Q
+        }
+    }
+    else if ((sampleBits == 24) && (SDR_RX_SAMP_SZ == 16)) // 24 -> 16 bits
+    {
+        for (unsigned int is = 0; is < nbSamples; is++)
+        {
+            m_converterBuffer[is].m_real = ((int32_t*)buf)[2*is] >> 8;   // I
+            m_converterBuffer[is].m_imag = ((int32_t*)buf)[2*is+1] >> 8; // Q
+        }
+    }
+    else // same sample size
+    {
+        std::copy((const Sample *) buf, (const Sample *) buf + nbSamples, m_converterBuffer.begin());
+    }
+}
+
+void SDRdaemonSourceUDPHandler::resample(uint32_t nbReadSamples, double ratio)
+{
+    // Linear interpolation. Position 0 is the last sample of the previous read and
+    // position i the i-th sample of this read. Output k is at position phase + k * ratio.
+    if (m_resamplerBuffer.size() < m_readLengthSamples) {
+        m_resamplerBuffer.resize(m_readLengthSamples);
+    }
+
+    double position = m_resamplerPhase;
+
+    for (unsigned int k = 0; k < m_readLengthSamples; k++, position += ratio)
+    {
+        unsigned int i = (unsigned int) position;
+        float mu = position - i;
+        const Sample& a = i == 0 ? m_resamplerLast : m_converterBuffer[i-1];
+        const Sample& b = m_converterBuffer[i < nbReadSamples ? i : nbReadSamples - 1];
+        m_resamplerBuffer[k].m_real = a.m_real + (FixReal) (mu * (b.m_real - a.m_real));
+        m_resamplerBuffer[k].m_imag = a.m_imag + (FixReal) (mu * (b.m_imag - a.m_imag));
+    }
+
+    m_resamplerPhase = position - nbReadSamples;
+    m_resamplerPhase = m_resamplerPhase < 0.0 ? 0.0 : m_resamplerPhase; // rounding when ratio < 1
+    m_resamplerLast = m_converterBuffer[nbReadSamples - 1];
+}
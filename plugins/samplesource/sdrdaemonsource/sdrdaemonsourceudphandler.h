@@ -23,9 +23,12 @@
 #include <QMutex>
 #include <QElapsedTimer>
 
+#include "dsp/dsptypes.h"
 #include "sdrdaemonsourcebuffer.h"
 
 #define SDRDAEMONSOURCE_THROTTLE_MS 50
+#define SDRDAEMONSOURCE_LOWLATENCY_THROTTLE_MS 10
+#define SDRDAEMONSOURCE_MAX_READ_MS 200
 
 class SampleSinkFifo;
 class MessageQueue;
@@ -42,6 +45,7 @@ public:
 	void start();
 	void stop();
 	void configureUDPLink(const QString& address, quint16 port);
+	void setLowLatency(bool lowLatency);
 	void getRemoteAddress(QString& s) const { s = m_remoteAddress.toString(); }
     int getNbOriginalBlocks() const { return SDRDaemonNbOrginalBlocks; }
     bool isStreaming() const { return m_masterTimerConnected; }
@@ -51,6 +55,16 @@ public:
     uint64_t getTVmSec() const { return m_tv_msec; }
     int getMinNbBlocks() { return m_sdrDaemonBuffer.getMinNbBlocks(); }
     int getMaxNbRecovery() { return m_sdrDaemonBuffer.getMaxNbRecovery(); }
+    float getBufferLatencyMs() const { return m_sdrDaemonBuffer.getBufferLatencyMs(); }
+    float getTargetLatencyMs() const { return m_sdrDaemonBuffer.getTargetLatencyMs(); }
+    float getJitterMs() const { return m_sdrDaemonBuffer.getJitterMs(); }
+    float getDriftPpm() const { return m_sdrDaemonBuffer.getDriftPpm(); }
+    uint32_t getLateFrames() const { return m_sdrDaemonBuffer.getLateFrames(); }
+
+    void getHistograms(SDRdaemonSourceBuffer::Histogram& latency, SDRdaemonSourceBuffer::Histogram& jitter, SDRdaemonSourceBuffer::Histogram& late) {
+        m_sdrDaemonBuffer.getHistograms(latency, jitter, late);
+    }
+
 public slots:
 	void dataReadyRead();
 
@@ -76,19 +90,25 @@ private:
 	uint32_t m_tickCount;
 	std::size_t m_samplesCount;
     QTimer *m_timer;
+    QTimer *m_lowLatencyTimer;
+    bool m_lowLatency;
 
 	QElapsedTimer m_elapsedTimer;
 	int m_throttlems;
-    uint32_t m_readLengthSamples;
+    uint32_t m_readLengthSamples;  //!< number of samples delivered to the FIFO at this tick
+    double m_readLengthRemainder;  //!< fractional number of samples carried to the next tick
     uint32_t m_readLength;
-    int32_t *m_converterBuffer;
-    uint32_t m_converterBufferNbSamples;
-    bool m_throttleToggle;
+    SampleVector m_converterBuffer; //!< samples read from the buffer converted to the FIFO samples size
+    SampleVector m_resamplerBuffer; //!< samples delivered to the FIFO
+    Sample m_resamplerLast;         //!< last sample read at previous tick
+    double m_resamplerPhase;        //!< position of the next output sample from the last sample read
     bool m_autoCorrBuffer;
 
 	void connectTimer();
     void disconnectTimer();
 	void processData();
+	void convertSamples(const uint8_t *buf, int sampleBits, uint32_t nbSamples);
+	void resample(uint32_t nbReadSamples, double ratio);
 
 private slots:
 	void tick();
@@ -21,14 +21,11 @@
 
 #include <QString>
 #include <QByteArray>
-#include <QNetworkRequest>
 
 #include <mirisdr.h>
 #include "dsp/devicesamplesource.h"
 #include "sdrplaysettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class SDRPlayThread;
 class FileRecord;
@@ -189,8 +186,6 @@ private:
     int m_devNumber;
     bool m_running;
     FileRecord *m_fileSink; //!< File sink to record device I/Q output
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     bool openDevice();
     void closeDevice();
@@ -200,9 +195,6 @@ private:
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const SDRPlaySettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 // ====================================================================
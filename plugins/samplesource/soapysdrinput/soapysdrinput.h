@@ -21,15 +21,12 @@
 
 #include <QString>
 #include <QByteArray>
-#include <QNetworkRequest>
 
 #include "soapysdr/devicesoapysdrshared.h"
 #include "dsp/devicesamplesource.h"
 
 #include "soapysdrinputsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class SoapySDRInputThread;
 class FileRecord;
@@ -210,8 +207,6 @@ private:
     SoapySDRInputThread *m_thread;
     DeviceSoapySDRShared m_deviceShared;
     FileRecord *m_fileSink; //!< File sink to record device I/Q output
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     bool openDevice();
     void closeDevice();
@@ -228,9 +223,6 @@ private:
     void webapiFormatArgInfo(const SoapySDR::ArgInfo& arg, SWGSDRangel::SWGArgInfo *argInfo);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const SoapySDRInputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 
@@ -276,7 +276,11 @@ void SoapySDRInputThread::callbackMI(std::vector<void *>& buffs, qint32 samplesP
 
 void SoapySDRInputThread::callbackSI8(const qint8* buf, qint32 len, unsigned int channel)
 {
-    SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
+    SampleVector::iterator it;
+    unsigned int nbOut = ((len/2) >> m_channels[channel].m_log2Decim) + 1; // upper bound of decimators output
+    bool inPlace = m_channels[channel].m_sampleFifo->writeBegin(nbOut, &it) == nbOut; // decimate directly into the FIFO if possible
+    SampleVector::iterator begin = inPlace ? it : m_channels[channel].m_convertBuffer.begin();
+    it = begin;
 
     if (m_channels[channel].m_log2Decim == 0)
     {
@@ -364,12 +368,20 @@ void SoapySDRInputThread::callbackSI8(const qint8* buf, qint32 len, unsigned int
         }
     }
 
-    m_channels[channel].m_sampleFifo->write(m_channels[channel].m_convertBuffer.begin(), it);
+    if (inPlace) {
+        m_channels[channel].m_sampleFifo->writeCommit(it - begin);
+    } else {
+        m_channels[channel].m_sampleFifo->write(begin, it);
+    }
 }
 
 void SoapySDRInputThread::callbackSI12(const qint16* buf, qint32 len, unsigned int channel)
 {
-    SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
+    SampleVector::iterator it;
+    unsigned int nbOut = ((len/2) >> m_channels[channel].m_log2Decim) + 1; // upper bound of decimators output
+    bool inPlace = m_channels[channel].m_sampleFifo->writeBegin(nbOut, &it) == nbOut; // decimate directly into the FIFO if possible
+    SampleVector::iterator begin = inPlace ? it : m_channels[channel].m_convertBuffer.begin();
+    it = begin;
 
     if (m_channels[channel].m_log2Decim == 0)
     {
@@ -457,12 +469,20 @@ void SoapySDRInputThread::callbackSI12(const qint16* buf, qint32 len, unsigned i
         }
     }
 
-    m_channels[channel].m_sampleFifo->write(m_channels[channel].m_convertBuffer.begin(), it);
+    if (inPlace) {
+        m_channels[channel].m_sampleFifo->writeCommit(it - begin);
+    } else {
+        m_channels[channel].m_sampleFifo->write(begin, it);
+    }
 }
 
 void SoapySDRInputThread::callbackSI16(const qint16* buf, qint32 len, unsigned int channel)
 {
-    SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
+    SampleVector::iterator it;
+    unsigned int nbOut = ((len/2) >> m_channels[channel].m_log2Decim) + 1; // upper bound of decimators output
+    bool inPlace = m_channels[channel].m_sampleFifo->writeBegin(nbOut, &it) == nbOut; // decimate directly into the FIFO if possible
+    SampleVector::iterator begin = inPlace ? it : m_channels[channel].m_convertBuffer.begin();
+    it = begin;
 
     if (m_channels[channel].m_log2Decim == 0)
     {
@@ -550,12 +570,20 @@ void SoapySDRInputThread::callbackSI16(const qint16* buf, qint32 len, unsigned i
         }
     }
 
-    m_channels[channel].m_sampleFifo->write(m_channels[channel].m_convertBuffer.begin(), it);
+    if (inPlace) {
+        m_channels[channel].m_sampleFifo->writeCommit(it - begin);
+    } else {
+        m_channels[channel].m_sampleFifo->write(begin, it);
+    }
 }
 
 void SoapySDRInputThread::callbackSIF(const float* buf, qint32 len, unsigned int channel)
 {
-    SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
+    SampleVector::iterator it;
+    unsigned int nbOut = ((len/2) >> m_channels[channel].m_log2Decim) + 1; // upper bound of decimators output
+    bool inPlace = m_channels[channel].m_sampleFifo->writeBegin(nbOut, &it) == nbOut; // decimate directly into the FIFO if possible
+    SampleVector::iterator begin = inPlace ? it : m_channels[channel].m_convertBuffer.begin();
+    it = begin;
 
     if (m_channels[channel].m_log2Decim == 0)
     {
@@ -643,5 +671,9 @@ void SoapySDRInputThread::callbackSIF(const float* buf, qint32 len, unsigned int
         }
     }
 
-    m_channels[channel].m_sampleFifo->write(m_channels[channel].m_convertBuffer.begin(), it);
+    if (inPlace) {
+        m_channels[channel].m_sampleFifo->writeCommit(it - begin);
+    } else {
+        m_channels[channel].m_sampleFifo->write(begin, it);
+    }
 }
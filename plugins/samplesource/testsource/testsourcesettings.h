@@ -40,6 +40,7 @@ struct TestSourceSettings {
         ModulationPattern0,
         ModulationPattern1,
         ModulationPattern2,
+        ModulationLatency,
         ModulationLast
     } Modulation;
 
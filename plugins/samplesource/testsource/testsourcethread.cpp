@@ -21,6 +21,8 @@
 #include "testsourcethread.h"
 
 #include "dsp/samplesinkfifo.h"
+#include "audio/audiolatencyprobe.h"
+#include "util/timeutil.h"
 
 #define TESTSOURCE_BLOCKSIZE 16384
 
@@ -45,6 +47,7 @@ TestSourceThread::TestSourceThread(SampleSinkFifo* sampleFifo, QObject* parent)
     m_pulsePatternCount(0),
     m_pulsePatternCycle(8),
     m_pulsePatternPlaces(3),
+    m_burstStart(false),
 	m_samplerate(48000),
 	m_log2Decim(4),
 	m_fcPos(0),
@@ -240,6 +243,17 @@ void TestSourceThread::generate(quint32 chunksize)
     int n = chunksize / 2;
     setBuffers(chunksize);
 
+    if (m_modulation == TestSourceSettings::ModulationLatency)
+    {
+        // bursts start on a chunk boundary so that the write timestamp is the burst onset
+        uint32_t burstPeriod = (m_samplerate / 1000) * AudioLatencyProbe::m_burstPeriodMs;
+        m_burstStart = m_pulseSampleCount >= burstPeriod;
+
+        if (m_burstStart) {
+            m_pulseSampleCount = 0;
+        }
+    }
+
     for (int i = 0; i < n-1;)
     {
         switch (m_modulation)
@@ -344,6 +358,20 @@ void TestSourceThread::generate(quint32 chunksize)
             }
         }
         break;
+        case TestSourceSettings::ModulationLatency: // AM tone bursts over a steady carrier
+        {
+            Complex c = m_nco.nextIQ();
+            Real t, re, im;
+            pullAF(t);
+            t = m_pulseSampleCount < (m_samplerate / 1000) * AudioLatencyProbe::m_burstDurationMs ? t*m_amModulation : 0.0f;
+            t = (t + 1.0f)*0.5f;
+            re = c.real()*t;
+            im = c.imag()*t + m_phaseImbalance*re;
+            m_buf[i++] = (int16_t) (re * (float) m_amplitudeBitsI) + m_amplitudeBitsDC;
+            m_buf[i++] = (int16_t) (im * (float) m_amplitudeBitsQ);
+            m_pulseSampleCount++;
+        }
+        break;
         case TestSourceSettings::ModulationNone:
         default:
         {
@@ -355,6 +383,12 @@ void TestSourceThread::generate(quint32 chunksize)
         }
     }
 
+    if (m_burstStart) // armed before the write so that the demodulated burst cannot be missed
+    {
+        AudioLatencyProbe::instance()->burstEmitted(TimeUtil::steadyus());
+        m_burstStart = false;
+    }
+
     callback(m_buf, n);
 }
 
@@ -400,6 +434,12 @@ void TestSourceThread::tick()
         }
 
         generate(m_chunksize);
+
+        float latency;
+
+        if ((m_modulation == TestSourceSettings::ModulationLatency) && AudioLatencyProbe::instance()->getLatency(latency)) {
+            qInfo("TestSourceThread::tick: loopback latency: %.1f ms", latency);
+        }
     }
 }
 
@@ -445,3 +485,8 @@ void TestSourceThread::setPattern2()
     m_pulseWidth = 1000;
     m_pulseSampleCount = 0;
 }
+
+void TestSourceThread::setLatencyBurst()
+{
+    m_pulseSampleCount = 0;
+}
@@ -78,6 +78,7 @@ public:
     void setPattern0();
     void setPattern1();
     void setPattern2();
+    void setLatencyBurst();
 
 private:
 	QMutex m_startWaitMutex;
@@ -102,6 +103,7 @@ private:
     uint32_t m_pulsePatternCount;
     uint32_t m_pulsePatternCycle;
     uint32_t m_pulsePatternPlaces;
+    bool m_burstStart; //!< latency burst starts in the current chunk
 
 	int m_samplerate;
     unsigned int m_log2Decim;
@@ -21,14 +21,11 @@
 
 #include <QString>
 #include <QByteArray>
-#include <QNetworkRequest>
 
 #include "dsp/devicesamplesource.h"
 #include "xtrx/devicextrxshared.h"
 #include "xtrxinputsettings.h"
 
-class QNetworkAccessManager;
-class QNetworkReply;
 class DeviceSourceAPI;
 class XTRXInputThread;
 struct DeviceXTRXParams;
@@ -254,8 +251,6 @@ private:
     QString m_deviceDescription;
     bool m_running;
     DeviceXTRXShared m_deviceShared;
-    QNetworkAccessManager *m_networkManager;
-    QNetworkRequest m_networkRequest;
 
     FileRecord *m_fileSink; //!< File sink to record device I/Q output
 
@@ -271,9 +266,6 @@ private:
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const XTRXInputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
-
-private slots:
-    void networkManagerFinished(QNetworkReply *reply);
 };
 
 #endif /* PLUGINS_SAMPLESOURCE_XTRXINPUT_XTRXINPUT_H_ */
@@ -224,7 +224,11 @@ SampleSinkFifo *XTRXInputThread::getFifo(unsigned int channel)
 
 void XTRXInputThread::callbackSI(const qint16* buf, qint32 len)
 {
-    SampleVector::iterator it = m_channels[m_uniqueChannelIndex].m_convertBuffer.begin();
+    SampleVector::iterator it;
+    unsigned int nbOut = ((len/2) >> m_channels[m_uniqueChannelIndex].m_log2Decim) + 1; // upper bound of decimators output
+    bool inPlace = m_channels[m_uniqueChannelIndex].m_sampleFifo->writeBegin(nbOut, &it) == nbOut; // decimate directly into the FIFO if possible
+    SampleVector::iterator begin = inPlace ? it : m_channels[m_uniqueChannelIndex].m_convertBuffer.begin();
+    it = begin;
 
     if (m_channels[m_uniqueChannelIndex].m_log2Decim == 0)
     {
@@ -257,7 +261,11 @@ void XTRXInputThread::callbackSI(const qint16* buf, qint32 len)
         }
     }
 
-    m_channels[m_uniqueChannelIndex].m_sampleFifo->write(m_channels[m_uniqueChannelIndex].m_convertBuffer.begin(), it);
+    if (inPlace) {
+        m_channels[m_uniqueChannelIndex].m_sampleFifo->writeCommit(it - begin);
+    } else {
+        m_channels[m_uniqueChannelIndex].m_sampleFifo->write(begin, it);
+    }
 }
 
 void XTRXInputThread::callbackMI(const qint16* buf0, const qint16* buf1, qint32 len)
@@ -0,0 +1,300 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <QDebug>
+
+#ifdef HAS_OPUS
+#include <opus/opus.h>
+#endif
+
+#include "audiocodec.h"
+
+const int16_t AudioCodec::m_adpcmStepTable[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+const int8_t AudioCodec::m_adpcmIndexTable[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+AudioCodec::AudioCodec() :
+    m_codec(CodecL16),
+    m_sampleRate(48000),
+    m_nbChannels(1),
+    m_frameSize(960),
+    m_opusEncoder(0),
+    m_opusDecoder(0)
+{
+}
+
+AudioCodec::~AudioCodec()
+{
+    destroyOpus();
+}
+
+bool AudioCodec::isAvailable(Codec codec)
+{
+#ifdef HAS_OPUS
+    (void) codec;
+    return true;
+#else
+    return codec != CodecOpus;
+#endif
+}
+
+bool AudioCodec::setCodec(Codec codec, int sampleRate, int nbChannels)
+{
+    destroyOpus();
+    m_codec = codec;
+    m_sampleRate = sampleRate;
+    m_nbChannels = nbChannels < 2 ? 1 : 2;
+    m_frameSize = sampleRate / 50; // 20 ms
+
+    int maxFrameSize = codec == CodecADPCM ?
+        (2 * (m_maxPacketSize - 4*m_nbChannels)) / m_nbChannels :
+        m_maxPacketSize / (m_nbChannels * 2);
+
+    if ((codec != CodecOpus) && (m_frameSize > maxFrameSize)) // Opus rates are 48 kS/s at most
+    {
+        qWarning("AudioCodec::setCodec: %d S/s is too fast: packets are shorter than 20 ms", sampleRate);
+        m_frameSize = maxFrameSize;
+    }
+
+    ADPCMState initialState = {0, 0};
+    m_adpcmStates.assign(m_nbChannels, initialState);
+
+    if (codec == CodecOpus)
+    {
+#ifdef HAS_OPUS
+        int error;
+        m_opusEncoder = opus_encoder_create(sampleRate, m_nbChannels, OPUS_APPLICATION_VOIP, &error);
+
+        if (error == OPUS_OK) {
+            m_opusDecoder = opus_decoder_create(sampleRate, m_nbChannels, &error);
+        }
+
+        if (error != OPUS_OK)
+        {
+            qWarning("AudioCodec::setCodec: Opus cannot handle %d S/s: %s", sampleRate, opus_strerror(error));
+            destroyOpus();
+            m_codec = CodecL16;
+            return false;
+        }
+#else
+        qWarning("AudioCodec::setCodec: compiled without Opus");
+        m_codec = CodecL16;
+        return false;
+#endif
+    }
+
+    return true;
+}
+
+void AudioCodec::destroyOpus()
+{
+#ifdef HAS_OPUS
+    if (m_opusEncoder) {
+        opus_encoder_destroy((OpusEncoder *) m_opusEncoder);
+    }
+
+    if (m_opusDecoder) {
+        opus_decoder_destroy((OpusDecoder *) m_opusDecoder);
+    }
+#endif
+    m_opusEncoder = 0;
+    m_opusDecoder = 0;
+}
+
+bool AudioCodec::isSilent(const int16_t *samples, int nbValues)
+{
+    int16_t acc = 0;
+
+    for (int i = 0; i < nbValues; i++) {
+        acc |= samples[i];
+    }
+
+    return acc == 0;
+}
+
+int AudioCodec::encode(const int16_t *samples, uint8_t *packet)
+{
+    switch (m_codec)
+    {
+    case CodecADPCM:
+        return encodeADPCM(samples, packet);
+#ifdef HAS_OPUS
+    case CodecOpus:
+    {
+        int size = opus_encode((OpusEncoder *) m_opusEncoder, samples, m_frameSize, packet, m_maxPacketSize);
+        return size < 0 ? 0 : size;
+    }
+#endif
+    case CodecL16:
+    default:
+        memcpy(packet, samples, m_frameSize * m_nbChannels * sizeof(int16_t));
+        return m_frameSize * m_nbChannels * sizeof(int16_t);
+    }
+}
+
+int AudioCodec::decode(const uint8_t *packet, int size, int16_t *samples)
+{
+    switch (m_codec)
+    {
+    case CodecADPCM:
+        return decodeADPCM(packet, size, samples);
+#ifdef HAS_OPUS
+    case CodecOpus:
+    {
+        int nbFrames = opus_decode((OpusDecoder *) m_opusDecoder, packet, size, samples, m_frameSize, 0);
+        return nbFrames < 0 ? 0 : nbFrames;
+    }
+#endif
+    case CodecL16:
+    default:
+    {
+        int nbFrames = size / (m_nbChannels * sizeof(int16_t));
+        nbFrames = nbFrames > m_frameSize ? m_frameSize : nbFrames;
+        memcpy(samples, packet, nbFrames * m_nbChannels * sizeof(int16_t));
+        return nbFrames;
+    }
+    }
+}
+
+int AudioCodec::encodeADPCM(const int16_t *samples, uint8_t *packet)
+{
+    uint8_t *p = packet;
+
+    for (int c = 0; c < m_nbChannels; c++)
+    {
+        *p++ = ((uint16_t) m_adpcmStates[c].m_predictor) >> 8;
+        *p++ = ((uint16_t) m_adpcmStates[c].m_predictor) & 0xff;
+        *p++ = m_adpcmStates[c].m_index;
+        *p++ = 0;
+    }
+
+    int nbValues = m_frameSize * m_nbChannels;
+
+    for (int i = 0; i < nbValues; i += 2)
+    {
+        uint8_t hi = encodeADPCMSample(m_adpcmStates[i % m_nbChannels], samples[i]);
+        uint8_t lo = i + 1 < nbValues ? encodeADPCMSample(m_adpcmStates[(i+1) % m_nbChannels], samples[i+1]) : 0;
+        *p++ = (hi << 4) | lo;
+    }
+
+    return p - packet;
+}
+
+int AudioCodec::decodeADPCM(const uint8_t *packet, int size, int16_t *samples)
+{
+    int headerSize = 4 * m_nbChannels;
+
+    if (size <= headerSize) {
+        return 0;
+    }
+
+    ADPCMState states[2];
+    const uint8_t *p = packet;
+
+    for (int c = 0; c < m_nbChannels; c++)
+    {
+        states[c].m_predictor = (int16_t) ((p[0] << 8) | p[1]);
+        states[c].m_index = p[2] > 88 ? 88 : p[2];
+        p += 4;
+    }
+
+    int nbValues = 2 * (size - headerSize);
+    int maxValues = m_frameSize * m_nbChannels;
+    nbValues = nbValues > maxValues ? maxValues : nbValues;
+    nbValues -= nbValues % m_nbChannels;
+
+    for (int i = 0; i < nbValues; i++)
+    {
+        uint8_t code = (i % 2) == 0 ? p[i/2] >> 4 : p[i/2] & 0x0f;
+        samples[i] = decodeADPCMSample(states[i % m_nbChannels], code);
+    }
+
+    return nbValues / m_nbChannels;
+}
+
+uint8_t AudioCodec::encodeADPCMSample(ADPCMState& state, int16_t sample)
+{
+    int step = m_adpcmStepTable[state.m_index];
+    int diff = sample - state.m_predictor;
+    uint8_t code = 0;
+
+    if (diff < 0)
+    {
+        code = 8;
+        diff = -diff;
+    }
+
+    if (diff >= step)
+    {
+        code |= 4;
+        diff -= step;
+    }
+
+    step >>= 1;
+
+    if (diff >= step)
+    {
+        code |= 2;
+        diff -= step;
+    }
+
+    step >>= 1;
+
+    if (diff >= step) {
+        code |= 1;
+    }
+
+    decodeADPCMSample(state, code); // track the decoder
+    return code;
+}
+
+int16_t AudioCodec::decodeADPCMSample(ADPCMState& state, uint8_t code)
+{
+    int step = m_adpcmStepTable[state.m_index];
+    int delta = step >> 3;
+
+    if (code & 4) {
+        delta += step;
+    }
+    if (code & 2) {
+        delta += step >> 1;
+    }
+    if (code & 1) {
+        delta += step >> 2;
+    }
+
+    int predictor = state.m_predictor + ((code & 8) ? -delta : delta);
+    state.m_predictor = predictor > 32767 ? 32767 : predictor < -32768 ? -32768 : predictor;
+    int index = state.m_index + m_adpcmIndexTable[code];
+    state.m_index = index < 0 ? 0 : index > 88 ? 88 : index;
+
+    return state.m_predictor;
+}
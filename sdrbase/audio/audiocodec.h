@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Packet audio codecs for the network audio sinks and sources                   //
+//                                                                               //
+// A packet holds 20 ms of 16 bit audio (mono or interleaved stereo):            //
+// - L16: raw samples in host order (as the plain UDP audio)                     //
+// - ADPCM: IMA-ADPCM (DVI4 as in RFC 3551) 4:1. Each packet starts with the     //
+//   predictor (16 bit big endian), the step index and a reserved byte for each  //
+//   channel so that it can be decoded on its own. Nibbles follow most           //
+//   significant first, interleaved by channel.                                  //
+// - Opus: one Opus frame when the library is available (HAS_OPUS)               //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_AUDIO_AUDIOCODEC_H_
+#define SDRBASE_AUDIO_AUDIOCODEC_H_
+
+#include <stdint.h>
+#include <vector>
+
+#include "export.h"
+
+class SDRBASE_API AudioCodec
+{
+public:
+    typedef enum
+    {
+        CodecL16,
+        CodecADPCM,
+        CodecOpus
+    } Codec;
+
+    AudioCodec();
+    ~AudioCodec();
+
+    /** Returns false and falls back to L16 if the codec cannot handle this format */
+    bool setCodec(Codec codec, int sampleRate, int nbChannels);
+    Codec getCodec() const { return m_codec; }
+    int getNbChannels() const { return m_nbChannels; }
+    int getFrameSize() const { return m_frameSize; } //!< frames (samples per channel) per packet
+    static bool isAvailable(Codec codec);
+    static bool isSilent(const int16_t *samples, int nbValues); //!< digital silence
+
+    /** Encode getFrameSize() frames. Returns the packet size in bytes */
+    int encode(const int16_t *samples, uint8_t *packet);
+    /** Decode a packet. Returns the number of frames written to samples (room for getFrameSize() frames) */
+    int decode(const uint8_t *packet, int size, int16_t *samples);
+
+    static const int m_maxPacketSize = 4000; //!< larger than 20 ms of 48 kS/s stereo L16
+
+private:
+    struct ADPCMState
+    {
+        int16_t m_predictor;
+        uint8_t m_index;
+    };
+
+    Codec m_codec;
+    int m_sampleRate;
+    int m_nbChannels;
+    int m_frameSize;
+    std::vector<ADPCMState> m_adpcmStates; //!< encoder state per channel
+    void *m_opusEncoder;
+    void *m_opusDecoder;
+
+    void destroyOpus();
+    int encodeADPCM(const int16_t *samples, uint8_t *packet);
+    int decodeADPCM(const uint8_t *packet, int size, int16_t *samples);
+    static uint8_t encodeADPCMSample(ADPCMState& state, int16_t sample);
+    static int16_t decodeADPCMSample(ADPCMState& state, uint8_t code);
+
+    static const int16_t m_adpcmStepTable[89];
+    static const int8_t m_adpcmIndexTable[16];
+};
+
+#endif /* SDRBASE_AUDIO_AUDIOCODEC_H_ */
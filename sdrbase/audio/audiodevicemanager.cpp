@@ -166,6 +166,10 @@ QByteArray AudioDeviceManager::serialize() const
     s.writeBlob(1, data);
     serializeOutputMap(data);
     s.writeBlob(2, data);
+    serializeOutputCodecMap(data);
+    s.writeBlob(3, data);
+    serializeOutputLatencyMap(data);
+    s.writeBlob(4, data);
 
     return s.final();
 }
@@ -203,6 +207,10 @@ bool AudioDeviceManager::deserialize(const QByteArray& data)
         deserializeInputMap(data);
         d.readBlob(2, &data);
         deserializeOutputMap(data);
+        d.readBlob(3, &data);
+        deserializeOutputCodecMap(data);
+        d.readBlob(4, &data);
+        deserializeOutputLatencyMap(data);
 
         debugAudioInputInfos();
         debugAudioOutputInfos();
@@ -228,6 +236,66 @@ void AudioDeviceManager::deserializeOutputMap(QByteArray& data)
     readStream >> m_audioOutputInfos;
 }
 
+void AudioDeviceManager::serializeOutputCodecMap(QByteArray& data) const
+{
+    QMap<QString, int> codecMap;
+    QMap<QString, OutputDeviceInfo>::const_iterator it = m_audioOutputInfos.begin();
+
+    for (; it != m_audioOutputInfos.end(); ++it) {
+        codecMap[it.key()] = ((int) it.value().udpCodec) | (it.value().udpDTX ? 0x100 : 0);
+    }
+
+    QDataStream *stream = new QDataStream(&data, QIODevice::WriteOnly);
+    *stream << codecMap;
+    delete stream;
+}
+
+void AudioDeviceManager::deserializeOutputCodecMap(QByteArray& data)
+{
+    QMap<QString, int> codecMap;
+    QDataStream readStream(&data, QIODevice::ReadOnly);
+    readStream >> codecMap;
+    QMap<QString, int>::const_iterator it = codecMap.begin();
+
+    for (; it != codecMap.end(); ++it)
+    {
+        if (m_audioOutputInfos.find(it.key()) != m_audioOutputInfos.end())
+        {
+            m_audioOutputInfos[it.key()].udpCodec = (AudioCodec::Codec) (it.value() & 0xff);
+            m_audioOutputInfos[it.key()].udpDTX = (it.value() & 0x100) != 0;
+        }
+    }
+}
+
+void AudioDeviceManager::serializeOutputLatencyMap(QByteArray& data) const
+{
+    QMap<QString, int> latencyMap;
+    QMap<QString, OutputDeviceInfo>::const_iterator it = m_audioOutputInfos.begin();
+
+    for (; it != m_audioOutputInfos.end(); ++it) {
+        latencyMap[it.key()] = it.value().latency;
+    }
+
+    QDataStream *stream = new QDataStream(&data, QIODevice::WriteOnly);
+    *stream << latencyMap;
+    delete stream;
+}
+
+void AudioDeviceManager::deserializeOutputLatencyMap(QByteArray& data)
+{
+    QMap<QString, int> latencyMap;
+    QDataStream readStream(&data, QIODevice::ReadOnly);
+    readStream >> latencyMap;
+    QMap<QString, int>::const_iterator it = latencyMap.begin();
+
+    for (; it != latencyMap.end(); ++it)
+    {
+        if (m_audioOutputInfos.find(it.key()) != m_audioOutputInfos.end()) {
+            m_audioOutputInfos[it.key()].latency = it.value();
+        }
+    }
+}
+
 void AudioDeviceManager::addAudioSink(AudioFifo* audioFifo, MessageQueue *sampleSinkMessageQueue, int outputDeviceIndex)
 {
     qDebug("AudioDeviceManager::addAudioSink: %d: %p", outputDeviceIndex, audioFifo);
@@ -346,6 +414,9 @@ void AudioDeviceManager::startAudioOutput(int outputDeviceIndex)
     bool copyAudioToUDP;
     bool udpUseRTP;
     AudioOutput::UDPChannelMode udpChannelMode;
+    AudioCodec::Codec udpCodec;
+    bool udpDTX;
+    int latency;
     QString deviceName;
 
     if (getOutputDeviceName(outputDeviceIndex, deviceName))
@@ -358,6 +429,9 @@ void AudioDeviceManager::startAudioOutput(int outputDeviceIndex)
             copyAudioToUDP = false;
             udpUseRTP = false;
             udpChannelMode = AudioOutput::UDPChannelLeft;
+            udpCodec = AudioCodec::CodecL16;
+            udpDTX = false;
+            latency = 0;
         }
         else
         {
@@ -367,8 +441,12 @@ void AudioDeviceManager::startAudioOutput(int outputDeviceIndex)
             copyAudioToUDP = m_audioOutputInfos[deviceName].copyToUDP;
             udpUseRTP = m_audioOutputInfos[deviceName].udpUseRTP;
             udpChannelMode = m_audioOutputInfos[deviceName].udpChannelMode;
+            udpCodec = m_audioOutputInfos[deviceName].udpCodec;
+            udpDTX = m_audioOutputInfos[deviceName].udpDTX;
+            latency = m_audioOutputInfos[deviceName].latency;
         }
 
+        m_audioOutputs[outputDeviceIndex]->setLatency(latency);
         m_audioOutputs[outputDeviceIndex]->start(outputDeviceIndex, sampleRate);
         m_audioOutputInfos[deviceName].sampleRate = m_audioOutputs[outputDeviceIndex]->getRate(); // update with actual rate
         m_audioOutputInfos[deviceName].udpAddress = udpAddress;
@@ -376,6 +454,9 @@ void AudioDeviceManager::startAudioOutput(int outputDeviceIndex)
         m_audioOutputInfos[deviceName].copyToUDP = copyAudioToUDP;
         m_audioOutputInfos[deviceName].udpUseRTP = udpUseRTP;
         m_audioOutputInfos[deviceName].udpChannelMode = udpChannelMode;
+        m_audioOutputInfos[deviceName].udpCodec = udpCodec;
+        m_audioOutputInfos[deviceName].udpDTX = udpDTX;
+        m_audioOutputInfos[deviceName].latency = latency;
     }
     else
     {
@@ -568,6 +649,17 @@ void AudioDeviceManager::setOutputDeviceInfo(int outputDeviceIndex, const Output
 
     AudioOutput *audioOutput = m_audioOutputs[outputDeviceIndex];
 
+    if (oldDeviceInfo.latency != deviceInfo.latency)
+    {
+        audioOutput->setLatency(deviceInfo.latency);
+
+        if (oldDeviceInfo.sampleRate == deviceInfo.sampleRate) // restart to resize the device buffer
+        {
+            audioOutput->stop();
+            audioOutput->start(outputDeviceIndex, deviceInfo.sampleRate);
+        }
+    }
+
     if (oldDeviceInfo.sampleRate != deviceInfo.sampleRate)
     {
         audioOutput->stop();
@@ -589,6 +681,8 @@ void AudioDeviceManager::setOutputDeviceInfo(int outputDeviceIndex, const Output
     audioOutput->setUdpUseRTP(deviceInfo.udpUseRTP);
     audioOutput->setUdpChannelMode(deviceInfo.udpChannelMode);
     audioOutput->setUdpChannelFormat(deviceInfo.udpChannelMode == AudioOutput::UDPChannelStereo, deviceInfo.sampleRate);
+    audioOutput->setUdpCodec(deviceInfo.udpCodec);
+    audioOutput->setUdpDTX(deviceInfo.udpDTX);
 
     qDebug("AudioDeviceManager::setOutputDeviceInfo: index: %d device: %s updated",
             outputDeviceIndex, qPrintable(deviceName));
@@ -756,6 +850,9 @@ void AudioDeviceManager::debugAudioOutputInfos() const
                 << " udpPort: " << it.value().udpPort
                 << " copyToUDP: " << it.value().copyToUDP
                 << " udpUseRTP: " << it.value().udpUseRTP
-                << " udpChannelMode: " << (int) it.value().udpChannelMode;
+                << " udpChannelMode: " << (int) it.value().udpChannelMode
+                << " udpCodec: " << (int) it.value().udpCodec
+                << " udpDTX: " << it.value().udpDTX
+                << " latency: " << it.value().latency;
     }
 }
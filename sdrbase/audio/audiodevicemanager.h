@@ -59,7 +59,10 @@ public:
             udpPort(m_defaultUDPPort),
             copyToUDP(false),
             udpUseRTP(false),
-            udpChannelMode(AudioOutput::UDPChannelLeft)
+            udpChannelMode(AudioOutput::UDPChannelLeft),
+            udpCodec(AudioCodec::CodecL16),
+            udpDTX(false),
+            latency(0)
         {}
         void resetToDefaults() {
             sampleRate = m_defaultAudioSampleRate;
@@ -68,6 +71,9 @@ public:
             copyToUDP = false;
             udpUseRTP = false;
             udpChannelMode = AudioOutput::UDPChannelLeft;
+            udpCodec = AudioCodec::CodecL16;
+            udpDTX = false;
+            latency = 0;
         }
         unsigned int sampleRate;
         QString udpAddress;
@@ -75,6 +81,9 @@ public:
         bool copyToUDP;
         bool udpUseRTP;
         AudioOutput::UDPChannelMode udpChannelMode;
+        AudioCodec::Codec udpCodec; //!< not in the data stream (stored separately for compatibility)
+        bool udpDTX;
+        int latency; //!< target in ms. 0 for device default. Not in the data stream
         friend QDataStream& operator<<(QDataStream& ds, const OutputDeviceInfo& info);
         friend QDataStream& operator>>(QDataStream& ds, OutputDeviceInfo& info);
     };
@@ -144,6 +153,10 @@ private:
 
     void serializeOutputMap(QByteArray& data) const;
     void deserializeOutputMap(QByteArray& data);
+    void serializeOutputCodecMap(QByteArray& data) const;
+    void deserializeOutputCodecMap(QByteArray& data);
+    void serializeOutputLatencyMap(QByteArray& data) const;
+    void deserializeOutputLatencyMap(QByteArray& data);
     void debugAudioOutputInfos() const;
 
 	friend class MainSettings;
@@ -16,8 +16,10 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <string.h>
+#include <stdint.h>
 #include <QTime>
 #include "dsp/dsptypes.h"
+#include "dsp/basebandsamplesink.h"
 #include "audio/audiofifo.h"
 #include "audio/audionetsink.h"
 
@@ -25,17 +27,30 @@
 
 AudioFifo::AudioFifo() :
 	m_fifo(0),
-	m_sampleSize(sizeof(AudioSample))
+	m_sampleSize(sizeof(AudioSample)),
+	m_latency(-1.0f),
+	m_fillTarget(0),
+	m_fillWindow(0),
+	m_windowCount(0),
+	m_minFill(0),
+	m_dropBudget(0)
 {
 	m_size = 0;
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	resetCounts();
 }
 
 AudioFifo::AudioFifo(uint32_t numSamples) :
 	m_fifo(0),
-    m_sampleSize(sizeof(AudioSample))
+    m_sampleSize(sizeof(AudioSample)),
+	m_latency(-1.0f),
+	m_fillTarget(0),
+	m_fillWindow(0),
+	m_windowCount(0),
+	m_minFill(0),
+	m_dropBudget(0)
 {
 	QMutexLocker mutexLocker(&m_mutex);
 
@@ -79,10 +94,8 @@ uint AudioFifo::write(const quint8* data, uint32_t numSamples)
 
 	while (remaining != 0)
 	{
-		if (isFull())
-		{
-			m_mutex.unlock();
-			return total - remaining; // written so far
+		if (isFull()) {
+			break;
 		}
 
 		copyLen = MIN(remaining, m_size - m_fill);
@@ -95,6 +108,14 @@ uint AudioFifo::write(const quint8* data, uint32_t numSamples)
 		remaining -= copyLen;
 	}
 
+	total -= remaining; // written
+	m_writeCount += total;
+	uint64_t timestamp = BasebandSampleSink::getFeedTimestamp();
+
+	if ((total > 0) && (timestamp != 0)) {
+		addMarker(timestamp);
+	}
+
 	m_mutex.unlock();
 	return total;
 }
@@ -116,10 +137,8 @@ uint AudioFifo::read(quint8* data, uint32_t numSamples)
 
 	while (remaining != 0)
 	{
-		if (isEmpty())
-		{
-			m_mutex.unlock();
-			return total - remaining; // read so far
+		if (isEmpty()) {
+			break;
 		}
 
 		copyLen = MIN(remaining, m_fill);
@@ -133,6 +152,11 @@ uint AudioFifo::read(quint8* data, uint32_t numSamples)
 		remaining -= copyLen;
 	}
 
+	total -= remaining; // read
+	uint64_t readStart = m_readCount;
+	m_readCount += total;
+	passMarkers(readStart);
+
 	m_mutex.unlock();
 	return total;
 }
@@ -146,8 +170,7 @@ uint AudioFifo::drain(uint32_t numSamples)
 		numSamples = m_fill;
 	}
 
-	m_head = (m_head + numSamples) % m_size;
-	m_fill -= numSamples;
+	dropSamples(numSamples);
 
 	return numSamples;
 }
@@ -159,6 +182,136 @@ void AudioFifo::clear()
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	resetCounts();
+}
+
+void AudioFifo::setFillTarget(uint32_t numSamples, uint32_t windowSamples)
+{
+	QMutexLocker mutexLocker(&m_mutex);
+
+	m_fillTarget = numSamples;
+	m_fillWindow = windowSamples;
+	m_windowCount = 0;
+	m_minFill = UINT32_MAX;
+	m_dropBudget = 0;
+}
+
+uint32_t AudioFifo::getNbExtraSamples(uint32_t numSamples)
+{
+	QMutexLocker mutexLocker(&m_mutex);
+
+	if (m_fillTarget == 0) {
+		return 0;
+	}
+
+	uint32_t fillAfterRead = m_fill > numSamples ? m_fill - numSamples : 0;
+	m_minFill = fillAfterRead < m_minFill ? fillAfterRead : m_minFill;
+	m_windowCount += numSamples;
+
+	if (m_windowCount >= m_fillWindow) // standing fill of the window is known
+	{
+		if (m_minFill > 2*m_fillTarget) // e.g. the reader has stalled: do not take seconds to recover
+		{
+			dropSamples(m_minFill - m_fillTarget);
+			m_dropBudget = 0;
+		}
+		else
+		{
+			m_dropBudget = m_minFill > m_fillTarget ? m_minFill - m_fillTarget : 0;
+		}
+
+		m_windowCount = 0;
+		m_minFill = UINT32_MAX;
+	}
+
+	uint32_t nbExtra = MIN(m_dropBudget, numSamples / 128); // less than 1% faster
+	nbExtra = MIN(nbExtra, m_fill > numSamples ? m_fill - numSamples : 0);
+	m_dropBudget -= nbExtra;
+
+	return nbExtra;
+}
+
+bool AudioFifo::getReadMarker(uint32_t& index, uint64_t& timestamp) const
+{
+	if (m_readMarker)
+	{
+		index = m_readMarkerIndex;
+		timestamp = m_readMarkerTimestamp;
+	}
+
+	return m_readMarker;
+}
+
+void AudioFifo::setLatency(float latency)
+{
+	m_latency = m_latency < 0.0f ? latency : 0.9f*m_latency + 0.1f*latency;
+}
+
+void AudioFifo::resetCounts()
+{
+	m_writeCount = 0;
+	m_readCount = 0;
+	m_markerHead = 0;
+	m_nbMarkers = 0;
+	m_readMarker = false;
+}
+
+void AudioFifo::addMarker(uint64_t timestamp)
+{
+	if (m_nbMarkers > 0)
+	{
+		Marker& lastMarker = m_markers[(m_markerHead + m_nbMarkers - 1) % m_maxMarkers];
+
+		if (lastMarker.m_timestamp == timestamp) // same baseband block written in several parts: mark the last one
+		{
+			lastMarker.m_position = m_writeCount;
+			return;
+		}
+	}
+
+	if (m_nbMarkers == m_maxMarkers) // forget the oldest
+	{
+		m_markerHead = (m_markerHead + 1) % m_maxMarkers;
+		m_nbMarkers--;
+	}
+
+	Marker& marker = m_markers[(m_markerHead + m_nbMarkers) % m_maxMarkers];
+	marker.m_position = m_writeCount;
+	marker.m_timestamp = timestamp;
+	m_nbMarkers++;
+}
+
+void AudioFifo::passMarkers(uint64_t readStart)
+{
+	m_readMarker = false;
+
+	while ((m_nbMarkers > 0) && (m_markers[m_markerHead].m_position <= m_readCount))
+	{
+		const Marker& marker = m_markers[m_markerHead];
+
+		if (marker.m_position > readStart) // keep the latest
+		{
+			m_readMarker = true;
+			m_readMarkerIndex = marker.m_position - 1 - readStart;
+			m_readMarkerTimestamp = marker.m_timestamp;
+		}
+
+		m_markerHead = (m_markerHead + 1) % m_maxMarkers;
+		m_nbMarkers--;
+	}
+}
+
+void AudioFifo::dropSamples(uint32_t numSamples)
+{
+	m_head = (m_head + numSamples) % m_size;
+	m_fill -= numSamples;
+	m_readCount += numSamples;
+
+	while ((m_nbMarkers > 0) && (m_markers[m_markerHead].m_position <= m_readCount))
+	{
+		m_markerHead = (m_markerHead + 1) % m_maxMarkers;
+		m_nbMarkers--;
+	}
 }
 
 bool AudioFifo::create(uint32_t numSamples)
@@ -172,6 +325,7 @@ bool AudioFifo::create(uint32_t numSamples)
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	resetCounts();
 
 	m_fifo = new qint8[numSamples * m_sampleSize];
 	m_size = numSamples;
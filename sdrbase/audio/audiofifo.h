@@ -46,7 +46,29 @@ public:
 	inline bool isFull() const { return m_fill == m_size; }
 	inline uint32_t size() const { return m_size; }
 
+	/** Latency control: the standing fill (the lowest fill after reads over a window of reads) is brought
+	 *  back to the target by reading a few extra samples per read. 0 target for no control */
+	void setFillTarget(uint32_t numSamples, uint32_t windowSamples);
+	/** Number of extra samples to read with the next read of numSamples to bring the fill down to the target.
+	 *  A fill far above the target is drained at once */
+	uint32_t getNbExtraSamples(uint32_t numSamples);
+
+	/** Audio written from dated baseband samples (see BasebandSampleSink::getFeedTimestamp) is marked with
+	 *  the arrival time of these samples. Returns true if the last read passed a marker. Then index is the
+	 *  marked sample in the read block and timestamp its arrival time */
+	bool getReadMarker(uint32_t& index, uint64_t& timestamp) const;
+	void setLatency(float latency); //!< measured by the reader in ms. Averaged.
+	float getLatency() const { return m_latency; } //!< ms. Negative if not measured
+
 private:
+	struct Marker
+	{
+		uint64_t m_position;  //!< write count after the marked sample
+		uint64_t m_timestamp;
+	};
+
+	static const uint32_t m_maxMarkers = 16;
+
 	QMutex m_mutex;
 
 	qint8* m_fifo;
@@ -58,7 +80,27 @@ private:
 	uint32_t m_head;
 	uint32_t m_tail;
 
+	uint64_t m_writeCount;
+	uint64_t m_readCount;
+	Marker m_markers[m_maxMarkers];
+	uint32_t m_markerHead;
+	uint32_t m_nbMarkers;
+	bool m_readMarker;
+	uint32_t m_readMarkerIndex;
+	uint64_t m_readMarkerTimestamp;
+	float m_latency;
+
+	uint32_t m_fillTarget;
+	uint32_t m_fillWindow;
+	uint32_t m_windowCount;
+	uint32_t m_minFill;
+	uint32_t m_dropBudget;
+
 	bool create(uint32_t numSamples);
+	void resetCounts();
+	void addMarker(uint64_t timestamp);
+	void passMarkers(uint64_t readStart);
+	void dropSamples(uint32_t numSamples);
 };
 
 #endif // INCLUDE_AUDIOFIFO_H
@@ -0,0 +1,73 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <QGlobalStatic>
+#include <QMutexLocker>
+
+#include "audiolatencyprobe.h"
+
+Q_GLOBAL_STATIC(AudioLatencyProbe, audioLatencyProbe)
+
+AudioLatencyProbe *AudioLatencyProbe::instance()
+{
+    return audioLatencyProbe;
+}
+
+AudioLatencyProbe::AudioLatencyProbe() :
+    m_armed(0),
+    m_emissionTimestamp(0),
+    m_latency(0.0f),
+    m_newLatency(false)
+{
+}
+
+void AudioLatencyProbe::burstEmitted(uint64_t timestamp)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_emissionTimestamp = timestamp;
+    m_armed.storeRelease(1);
+}
+
+void AudioLatencyProbe::scan(const qint16 *samples, unsigned int nbSamples, uint64_t playoutTimestamp, unsigned int sampleRate)
+{
+    for (unsigned int i = 0; i < nbSamples; i++)
+    {
+        if (abs(samples[2*i]) + abs(samples[2*i+1]) > m_threshold)
+        {
+            QMutexLocker mutexLocker(&m_mutex);
+            uint64_t onsetTimestamp = playoutTimestamp + (i * 1000000ULL) / sampleRate;
+            m_latency = (((int64_t) onsetTimestamp) - ((int64_t) m_emissionTimestamp)) / 1000.0f;
+            m_newLatency = true;
+            m_armed.storeRelease(0);
+            return;
+        }
+    }
+}
+
+bool AudioLatencyProbe::getLatency(float& latency)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_newLatency) {
+        return false;
+    }
+
+    latency = m_latency;
+    m_newLatency = false;
+    return true;
+}
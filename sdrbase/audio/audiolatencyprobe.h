@@ -0,0 +1,62 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Synthetic loopback audio latency test                                         //
+//                                                                               //
+// A test source emits a tone burst on a carrier and dates it with the time its  //
+// baseband samples are written. Once demodulated the audio output dates the     //
+// onset of the burst with the time it will be played. The difference is the    //
+// latency of the whole chain. Valid for latencies shorter than the period of    //
+// the bursts.                                                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_AUDIO_AUDIOLATENCYPROBE_H_
+#define SDRBASE_AUDIO_AUDIOLATENCYPROBE_H_
+
+#include <stdint.h>
+#include <QMutex>
+#include <QAtomicInt>
+
+#include "export.h"
+
+class SDRBASE_API AudioLatencyProbe
+{
+public:
+    AudioLatencyProbe();
+    static AudioLatencyProbe *instance();
+
+    /** Burst written at timestamp (TimeUtil::steadyus). Arms the detection */
+    void burstEmitted(uint64_t timestamp);
+    bool isArmed() const { return m_armed.loadAcquire() != 0; }
+    /** Looks for the burst onset in interleaved stereo samples whose first one is played at playoutTimestamp */
+    void scan(const qint16 *samples, unsigned int nbSamples, uint64_t playoutTimestamp, unsigned int sampleRate);
+    /** Returns true if a new measurement in ms is available since the previous call */
+    bool getLatency(float& latency);
+
+    static const int m_burstPeriodMs = 2000;
+    static const int m_burstDurationMs = 200;
+
+private:
+    QMutex m_mutex;
+    QAtomicInt m_armed;
+    uint64_t m_emissionTimestamp;
+    float m_latency;
+    bool m_newLatency;
+
+    static const int m_threshold = 4096; //!< on the sum of absolute left and right values
+};
+
+#endif /* SDRBASE_AUDIO_AUDIOLATENCYPROBE_H_ */
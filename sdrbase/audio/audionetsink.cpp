@@ -19,28 +19,46 @@
 #include "util/rtpsink.h"
 
 #include <QUdpSocket>
+#include <algorithm>
+#include <QMutexLocker>
 
 const int AudioNetSink::m_udpBlockSize = 512;
 
 AudioNetSink::AudioNetSink(QObject *parent) :
     m_type(SinkUDP),
+    m_fanOut(parent),
     m_rtpBufferAudio(0),
     m_bufferIndex(0),
-    m_port(9998)
+    m_stereo(false),
+    m_sampleRate(48000),
+    m_codecType(AudioCodec::CodecL16),
+    m_codecBufferIndex(0),
+    m_dtx(false),
+    m_ratePacketCount(0),
+    m_rateByteCount(0)
 {
     memset(m_data, 0, 65536);
-    m_udpSocket = new QUdpSocket(parent);
+    applyCodec();
+    m_rateTimer.start();
 }
 
 AudioNetSink::AudioNetSink(QObject *parent, int sampleRate, bool stereo) :
     m_type(SinkUDP),
+    m_fanOut(parent),
     m_rtpBufferAudio(0),
     m_bufferIndex(0),
-    m_port(9998)
+    m_stereo(stereo),
+    m_sampleRate(sampleRate),
+    m_codecType(AudioCodec::CodecL16),
+    m_codecBufferIndex(0),
+    m_dtx(false),
+    m_ratePacketCount(0),
+    m_rateByteCount(0)
 {
     memset(m_data, 0, 65536);
-    m_udpSocket = new QUdpSocket(parent);
-    m_rtpBufferAudio = new RTPSink(m_udpSocket, sampleRate, stereo);
+    applyCodec();
+    m_rtpBufferAudio = new RTPSink(m_fanOut.getSocket(), sampleRate, stereo);
+    m_rateTimer.start();
 }
 
 AudioNetSink::~AudioNetSink()
@@ -48,8 +66,6 @@ AudioNetSink::~AudioNetSink()
     if (m_rtpBufferAudio) {
         delete m_rtpBufferAudio;
     }
-
-    m_udpSocket->deleteLater(); // this thread is not the owner thread (was moved)
 }
 
 bool AudioNetSink::isRTPCapable() const
@@ -71,10 +87,42 @@ bool AudioNetSink::selectType(SinkType type)
     return true;
 }
 
+bool AudioNetSink::setCodec(AudioCodec::Codec codec)
+{
+    m_codecType = codec;
+    applyCodec();
+
+    if (m_rtpBufferAudio) {
+        m_rtpBufferAudio->setCodec(codec);
+    }
+
+    return m_codec.getCodec() == codec;
+}
+
+void AudioNetSink::setDTX(bool dtx)
+{
+    m_dtx = dtx;
+
+    if (m_rtpBufferAudio) {
+        m_rtpBufferAudio->setDTX(dtx);
+    }
+}
+
+void AudioNetSink::applyCodec()
+{
+    QMutexLocker mutexLocker(&m_codecMutex);
+
+    if (!m_codec.setCodec(m_codecType, m_sampleRate, m_stereo ? 2 : 1)) {
+        qWarning("AudioNetSink::applyCodec: codec %d not available: using L16", (int) m_codecType);
+    }
+
+    m_codecBuffer.resize(m_codec.getFrameSize() * m_codec.getNbChannels());
+    m_codecBufferIndex = 0;
+}
+
 void AudioNetSink::setDestination(const QString& address, uint16_t port)
 {
-    m_address.setAddress(const_cast<QString&>(address));
-    m_port = port;
+    m_fanOut.setDestination(address, port);
 
     if (m_rtpBufferAudio) {
         m_rtpBufferAudio->setDestination(address, port);
@@ -83,6 +131,8 @@ void AudioNetSink::setDestination(const QString& address, uint16_t port)
 
 void AudioNetSink::addDestination(const QString& address, uint16_t port)
 {
+    m_fanOut.addDestination(address, port);
+
     if (m_rtpBufferAudio) {
         m_rtpBufferAudio->addDestination(address, port);
     }
@@ -90,6 +140,8 @@ void AudioNetSink::addDestination(const QString& address, uint16_t port)
 
 void AudioNetSink::deleteDestination(const QString& address, uint16_t port)
 {
+    m_fanOut.deleteDestination(address, port);
+
     if (m_rtpBufferAudio) {
         m_rtpBufferAudio->deleteDestination(address, port);
     }
@@ -97,6 +149,10 @@ void AudioNetSink::deleteDestination(const QString& address, uint16_t port)
 
 void AudioNetSink::setParameters(bool stereo, int sampleRate)
 {
+    m_stereo = stereo;
+    m_sampleRate = sampleRate;
+    applyCodec();
+
     if (m_rtpBufferAudio) {
         m_rtpBufferAudio->setPayloadInformation(stereo ? RTPSink::PayloadL16Stereo : RTPSink::PayloadL16Mono, sampleRate);
     }
@@ -104,19 +160,21 @@ void AudioNetSink::setParameters(bool stereo, int sampleRate)
 
 void AudioNetSink::write(qint16 sample)
 {
-    if (m_type == SinkUDP)
+    if ((m_type == SinkUDP) && (m_codec.getCodec() != AudioCodec::CodecL16))
+    {
+        writeCodec(&sample, 1);
+    }
+    else if (m_type == SinkUDP)
     {
         if (m_bufferIndex >= m_udpBlockSize)
         {
-            m_udpSocket->writeDatagram((const char*)m_data, (qint64 ) m_udpBlockSize, m_address, m_port);
+            sendUDP(m_data, 1);
             m_bufferIndex = 0;
         }
-        else
-        {
-            qint16 *p = (qint16*) &m_data[m_bufferIndex];
-            *p = sample;
-            m_bufferIndex += sizeof(qint16);
-        }
+
+        qint16 *p = (qint16*) &m_data[m_bufferIndex];
+        *p = sample;
+        m_bufferIndex += sizeof(qint16);
     }
     else if (m_type == SinkRTP)
     {
@@ -126,22 +184,25 @@ void AudioNetSink::write(qint16 sample)
 
 void AudioNetSink::write(qint16 lSample, qint16 rSample)
 {
-    if (m_type == SinkUDP)
+    if ((m_type == SinkUDP) && (m_codec.getCodec() != AudioCodec::CodecL16))
+    {
+        qint16 samples[2] = {lSample, rSample};
+        writeCodec(samples, 2);
+    }
+    else if (m_type == SinkUDP)
     {
         if (m_bufferIndex >= m_udpBlockSize)
         {
-            m_udpSocket->writeDatagram((const char*)m_data, (qint64 ) m_udpBlockSize, m_address, m_port);
+            sendUDP(m_data, 1);
             m_bufferIndex = 0;
         }
-        else
-        {
-            qint16 *p = (qint16*) &m_data[m_bufferIndex];
-            *p = lSample;
-            m_bufferIndex += sizeof(qint16);
-            p = (qint16*) &m_data[m_bufferIndex];
-            *p = rSample;
-            m_bufferIndex += sizeof(qint16);
-        }
+
+        qint16 *p = (qint16*) &m_data[m_bufferIndex];
+        *p = lSample;
+        m_bufferIndex += sizeof(qint16);
+        p = (qint16*) &m_data[m_bufferIndex];
+        *p = rSample;
+        m_bufferIndex += sizeof(qint16);
     }
     else if (m_type == SinkRTP)
     {
@@ -151,36 +212,129 @@ void AudioNetSink::write(qint16 lSample, qint16 rSample)
 
 void AudioNetSink::write(AudioSample* samples, uint32_t numSamples)
 {
-    if (m_type == SinkUDP)
+    write((const qint16 *) samples, 2*numSamples); // 2 x 16 bit sample
+}
+
+void AudioNetSink::write(const qint16 *samples, int nbValues)
+{
+    if ((m_type == SinkUDP) && (m_codec.getCodec() != AudioCodec::CodecL16))
+    {
+        writeCodec(samples, nbValues);
+    }
+    else if (m_type == SinkUDP)
     {
-        int samplesIndex = 0;
+        const char *bytes = (const char *) samples;
+        unsigned int nbBytes = nbValues * sizeof(qint16);
 
-        if (m_bufferIndex + numSamples*sizeof(AudioSample) >= m_udpBlockSize) // fill remainder of buffer and send it
+        if (m_bufferIndex + nbBytes > (unsigned int) m_udpBlockSize) // fill remainder of buffer and send it
         {
-            memcpy(&m_data[m_bufferIndex], &samples[samplesIndex], m_udpBlockSize - m_bufferIndex); // fill remainder of buffer
-            m_udpSocket->writeDatagram((const char*)m_data, (qint64 ) m_udpBlockSize, m_address, m_port);
+            unsigned int fill = m_udpBlockSize - m_bufferIndex;
+            memcpy(&m_data[m_bufferIndex], bytes, fill);
+            sendUDP(m_data, 1);
+            bytes += fill;
+            nbBytes -= fill;
             m_bufferIndex = 0;
-            samplesIndex += (m_udpBlockSize - m_bufferIndex) / sizeof(AudioSample);
-            numSamples -= (m_udpBlockSize - m_bufferIndex) / sizeof(AudioSample);
+            int nbDatagrams = nbBytes / m_udpBlockSize;
+
+            if (nbDatagrams > 0) // send directly from input without buffering
+            {
+                sendUDP(bytes, nbDatagrams);
+                bytes += nbDatagrams * m_udpBlockSize;
+                nbBytes -= nbDatagrams * m_udpBlockSize;
+            }
         }
 
-        while (numSamples > m_udpBlockSize/sizeof(AudioSample)) // send directly from input without buffering
+        memcpy(&m_data[m_bufferIndex], bytes, nbBytes);
+        m_bufferIndex += nbBytes;
+    }
+    else if (m_type == SinkRTP)
+    {
+        m_rtpBufferAudio->write((const uint8_t *) samples, m_stereo ? nbValues/2 : nbValues);
+    }
+}
+
+void AudioNetSink::sendUDP(const char *data, int nbDatagrams)
+{
+    if (!m_dtx)
+    {
+        m_fanOut.send(data, m_udpBlockSize, nbDatagrams);
+        return;
+    }
+
+    int start = 0; // first datagram of the current run of non silent datagrams
+
+    for (int i = 0; i <= nbDatagrams; i++)
+    {
+        if ((i == nbDatagrams) || AudioCodec::isSilent((const int16_t *) &data[i*m_udpBlockSize], m_udpBlockSize/2))
+        {
+            if (i > start) {
+                m_fanOut.send(&data[start*m_udpBlockSize], m_udpBlockSize, i - start);
+            }
+
+            start = i + 1;
+        }
+    }
+}
+
+void AudioNetSink::writeCodec(const qint16 *samples, int nbValues)
+{
+    QMutexLocker mutexLocker(&m_codecMutex);
+    int packetValues = m_codecBuffer.size();
+
+    while (nbValues > 0)
+    {
+        int n = std::min(nbValues, packetValues - m_codecBufferIndex);
+        memcpy(&m_codecBuffer[m_codecBufferIndex], samples, n * sizeof(qint16));
+        m_codecBufferIndex += n;
+        samples += n;
+        nbValues -= n;
+
+        if (m_codecBufferIndex == packetValues)
         {
-            m_udpSocket->writeDatagram((const char*)&samples[samplesIndex], (qint64 ) m_udpBlockSize, m_address, m_port);
-            samplesIndex += m_udpBlockSize/sizeof(AudioSample);
-            numSamples -= m_udpBlockSize/sizeof(AudioSample);
+            if (!m_dtx || !AudioCodec::isSilent(&m_codecBuffer[0], packetValues))
+            {
+                int size = m_codec.encode(&m_codecBuffer[0], m_codecPacket);
+                m_fanOut.send((const char *) m_codecPacket, size);
+            }
+
+            m_codecBufferIndex = 0;
         }
+    }
+}
+
+quint64 AudioNetSink::getPacketCount() const
+{
+    return m_fanOut.getPacketCount() + (m_rtpBufferAudio ? m_rtpBufferAudio->getPacketCount() : 0);
+}
 
-        memcpy(&m_data[m_bufferIndex], &samples[samplesIndex], numSamples*sizeof(AudioSample));
+quint64 AudioNetSink::getByteCount() const
+{
+    return m_fanOut.getByteCount() + (m_rtpBufferAudio ? m_rtpBufferAudio->getByteCount() : 0);
+}
+
+void AudioNetSink::getRates(float& packetRate, float& byteRate)
+{
+    qint64 ns = m_rateTimer.nsecsElapsed();
+    m_rateTimer.restart();
+    quint64 packetCount = getPacketCount();
+    quint64 byteCount = getByteCount();
+
+    if (ns > 0)
+    {
+        packetRate = ((packetCount - m_ratePacketCount) * 1e9) / ns;
+        byteRate = ((byteCount - m_rateByteCount) * 1e9) / ns;
     }
-    else if (m_type == SinkRTP)
+    else
     {
-        m_rtpBufferAudio->write((uint8_t *) samples, numSamples*2); // 2 x 16 bit sample
+        packetRate = 0.0f;
+        byteRate = 0.0f;
     }
+
+    m_ratePacketCount = packetCount;
+    m_rateByteCount = byteCount;
 }
 
 void AudioNetSink::moveToThread(QThread *thread)
 {
-    m_udpSocket->moveToThread(thread);
+    m_fanOut.moveToThread(thread);
 }
-
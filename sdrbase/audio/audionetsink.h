@@ -23,9 +23,14 @@
 
 #include <QObject>
 #include <QHostAddress>
+#include <QElapsedTimer>
+#include <QMutex>
 #include <stdint.h>
+#include <vector>
+
+#include "util/udpfanout.h"
+#include "audio/audiocodec.h"
 
-class QUdpSocket;
 class RTPSink;
 class QThread;
 
@@ -49,9 +54,17 @@ public:
     void write(qint16 sample);
     void write(qint16 lSample, qint16 rSample);
     void write(AudioSample* samples, uint32_t numSamples);
+    void write(const qint16 *samples, int nbValues); //!< interleaved L/R values when stereo
+
+    /** Packets and bytes per second sent to all destinations since the previous call */
+    void getRates(float& packetRate, float& byteRate);
 
     bool isRTPCapable() const;
     bool selectType(SinkType type);
+    /** Compressed packets of 20 ms. Returns false if the codec is not available (then L16 is used) */
+    bool setCodec(AudioCodec::Codec codec);
+    /** Discontinuous transmission: packets of digital silence (closed squelch) are not sent */
+    void setDTX(bool dtx);
 
     void moveToThread(QThread *thread);
 
@@ -59,12 +72,28 @@ public:
 
 protected:
     SinkType m_type;
-    QUdpSocket *m_udpSocket;
+    UDPFanOut m_fanOut;
     RTPSink *m_rtpBufferAudio;
     char m_data[65536];
     unsigned int m_bufferIndex;
-    QHostAddress m_address;
-    unsigned int m_port;
+    bool m_stereo;
+    int m_sampleRate;
+    AudioCodec::Codec m_codecType; //!< requested codec
+    AudioCodec m_codec;
+    std::vector<qint16> m_codecBuffer; //!< samples of the packet being filled
+    int m_codecBufferIndex;
+    uint8_t m_codecPacket[AudioCodec::m_maxPacketSize];
+    bool m_dtx;
+    QMutex m_codecMutex;
+    quint64 m_ratePacketCount;
+    quint64 m_rateByteCount;
+    QElapsedTimer m_rateTimer;
+
+    quint64 getPacketCount() const;
+    quint64 getByteCount() const;
+    void applyCodec();
+    void sendUDP(const char *data, int nbDatagrams); //!< L16 datagrams of m_udpBlockSize
+    void writeCodec(const qint16 *samples, int nbValues);
 };
 
 
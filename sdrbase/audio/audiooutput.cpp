@@ -19,9 +19,11 @@
 #include <QAudioFormat>
 #include <QAudioDeviceInfo>
 #include <QAudioOutput>
+#include "util/timeutil.h"
 #include "audiooutput.h"
 #include "audiofifo.h"
 #include "audionetsink.h"
+#include "audiolatencyprobe.h"
 
 AudioOutput::AudioOutput() :
 	m_mutex(QMutex::Recursive),
@@ -31,6 +33,7 @@ AudioOutput::AudioOutput() :
 	m_udpChannelMode(UDPChannelLeft),
 	m_audioUsageCount(0),
 	m_onExit(false),
+	m_latency(0),
 	m_audioFifos()
 {
 }
@@ -113,6 +116,16 @@ bool AudioOutput::start(int device, int rate)
         m_audioOutput = new QAudioOutput(devInfo, m_audioFormat);
         m_audioNetSink = new AudioNetSink(0, m_audioFormat.sampleRate(), false);
 
+        if (m_latency > 0) // half of the target in the device buffer
+        {
+            m_audioOutput->setBufferSize((m_audioFormat.sampleRate() * m_latency * 4) / 2000);
+            qInfo("AudioOutput::start: latency target %d ms: buffer size %d bytes", m_latency, m_audioOutput->bufferSize());
+        }
+
+        for (std::list<AudioFifo*>::iterator it = m_audioFifos.begin(); it != m_audioFifos.end(); ++it) {
+            applyFillTarget(*it);
+        }
+
         QIODevice::open(QIODevice::ReadOnly);
 
         m_audioOutput->start(this);
@@ -160,6 +173,7 @@ void AudioOutput::addFifo(AudioFifo* audioFifo)
 	QMutexLocker mutexLocker(&m_mutex);
 
 	m_audioFifos.push_back(audioFifo);
+	applyFillTarget(audioFifo);
 }
 
 void AudioOutput::removeFifo(AudioFifo* audioFifo)
@@ -167,6 +181,25 @@ void AudioOutput::removeFifo(AudioFifo* audioFifo)
 	QMutexLocker mutexLocker(&m_mutex);
 
 	m_audioFifos.remove(audioFifo);
+	audioFifo->setFillTarget(0, 0);
+}
+
+void AudioOutput::setLatency(int latency)
+{
+	QMutexLocker mutexLocker(&m_mutex);
+
+	m_latency = latency < 0 ? 0 : latency;
+
+	for (std::list<AudioFifo*>::iterator it = m_audioFifos.begin(); it != m_audioFifos.end(); ++it) {
+		applyFillTarget(*it);
+	}
+}
+
+void AudioOutput::applyFillTarget(AudioFifo *audioFifo)
+{
+	int sampleRate = m_audioFormat.sampleRate();
+	// the other half of the latency target is in the device buffer. Standing fill taken over one second.
+	audioFifo->setFillTarget(m_latency > 0 ? (sampleRate * m_latency) / 2000 : 0, sampleRate);
 }
 
 /*
@@ -183,6 +216,33 @@ void AudioOutput::setUdpDestination(const QString& address, uint16_t port)
     }
 }
 
+void AudioOutput::addUdpDestination(const QString& address, uint16_t port)
+{
+    if (m_audioNetSink) {
+        m_audioNetSink->addDestination(address, port);
+    }
+}
+
+void AudioOutput::deleteUdpDestination(const QString& address, uint16_t port)
+{
+    if (m_audioNetSink) {
+        m_audioNetSink->deleteDestination(address, port);
+    }
+}
+
+void AudioOutput::getUdpRates(float& packetRate, float& byteRate)
+{
+    if (m_audioNetSink)
+    {
+        m_audioNetSink->getRates(packetRate, byteRate);
+    }
+    else
+    {
+        packetRate = 0.0f;
+        byteRate = 0.0f;
+    }
+}
+
 void AudioOutput::setUdpCopyToUDP(bool copyToUDP)
 {
     m_copyAudioToUdp = copyToUDP;
@@ -207,6 +267,20 @@ void AudioOutput::setUdpChannelFormat(bool stereo, int sampleRate)
     }
 }
 
+void AudioOutput::setUdpCodec(AudioCodec::Codec codec)
+{
+    if (m_audioNetSink) {
+        m_audioNetSink->setCodec(codec);
+    }
+}
+
+void AudioOutput::setUdpDTX(bool dtx)
+{
+    if (m_audioNetSink) {
+        m_audioNetSink->setDTX(dtx);
+    }
+}
+
 qint64 AudioOutput::readData(char* data, qint64 maxLen)
 {
     //qDebug("AudioOutput::readData: %lld", maxLen);
@@ -236,30 +310,26 @@ qint64 AudioOutput::readData(char* data, qint64 maxLen)
 
 	memset(&m_mixBuffer[0], 0x00, 2 * samplesPerBuffer * sizeof(m_mixBuffer[0])); // start with silence
 
-	// sum up a block from all fifos
+	if (m_udpBuffer.size() < samplesPerBuffer) {
+	    m_udpBuffer.resize(samplesPerBuffer);
+	}
 
-	for (std::list<AudioFifo*>::iterator it = m_audioFifos.begin(); it != m_audioFifos.end(); ++it)
+	bool copyToUdp = m_copyAudioToUdp && m_audioNetSink;
+
+	// time at which the first sample of this buffer will be played: after what is queued in the device
+	uint64_t playoutTimestamp = TimeUtil::steadyus();
+
+	if (m_audioOutput && (m_audioFormat.sampleRate() > 0))
 	{
-		// use outputBuffer as temp - yes, one memcpy could be saved
-		unsigned int samples = (*it)->read((quint8*) data, samplesPerBuffer);
-		const qint16* src = (const qint16*) data;
-		std::vector<qint32>::iterator dst = m_mixBuffer.begin();
+		qint64 queuedSamples = (m_audioOutput->bufferSize() - m_audioOutput->bytesFree()) / 4;
+		playoutTimestamp += queuedSamples > 0 ? (queuedSamples * 1000000LL) / m_audioFormat.sampleRate() : 0;
+	}
 
-//		if (samples != framesPerBuffer)
-//		{
-//            qDebug("AudioOutput::readData: read %d samples vs %d requested", samples, framesPerBuffer);
-//		}
+	// sum up a block from all fifos
 
-		for (unsigned int i = 0; i < samples; i++)
-		{
-			*dst += *src;
-			++src;
-			++dst;
-			*dst += *src;
-			++src;
-			++dst;
-		}
-    }
+	for (std::list<AudioFifo*>::iterator it = m_audioFifos.begin(); it != m_audioFifos.end(); ++it) {
+		mixFifo(*it, samplesPerBuffer, playoutTimestamp);
+	}
 	// convert to int16
 
 	//std::vector<qint32>::const_iterator src = m_mixBuffer.begin(); // Valgrind optim
@@ -300,30 +370,97 @@ qint64 AudioOutput::readData(char* data, qint64 maxLen)
 
 		*dst++ = sr;
 
-		if ((m_copyAudioToUdp) && (m_audioNetSink))
+		if (copyToUdp)
 		{
 	        switch (m_udpChannelMode)
 	        {
-            case UDPChannelStereo:
-                m_audioNetSink->write(sl, sr);
+            case UDPChannelStereo: // sent from the output buffer
                 break;
             case UDPChannelMixed:
-                m_audioNetSink->write((sl+sr)/2);
+                m_udpBuffer[i] = (sl+sr)/2;
                 break;
             case UDPChannelRight:
-                m_audioNetSink->write(sr);
+                m_udpBuffer[i] = sr;
                 break;
 	        case UDPChannelLeft:
 	        default:
-	            m_audioNetSink->write(sl);
+	            m_udpBuffer[i] = sl;
 	            break;
 	        }
 		}
 	}
 
+	if (AudioLatencyProbe::instance()->isArmed()) {
+		AudioLatencyProbe::instance()->scan((const qint16*) data, samplesPerBuffer, playoutTimestamp, m_audioFormat.sampleRate());
+	}
+
+	if (copyToUdp) // one block write per buffer
+	{
+	    if (m_udpChannelMode == UDPChannelStereo) {
+	        m_audioNetSink->write((const qint16*) data, 2*samplesPerBuffer);
+	    } else {
+	        m_audioNetSink->write(&m_udpBuffer[0], samplesPerBuffer);
+	    }
+	}
+
 	return samplesPerBuffer * 4;
 }
 
+void AudioOutput::mixFifo(AudioFifo *audioFifo, unsigned int samplesPerBuffer, uint64_t playoutTimestamp)
+{
+	unsigned int nbToRead = samplesPerBuffer + audioFifo->getNbExtraSamples(samplesPerBuffer);
+
+	if (m_fifoBuffer.size() < 2*nbToRead) {
+		m_fifoBuffer.resize(2*nbToRead);
+	}
+
+	unsigned int samples = audioFifo->read((quint8*) &m_fifoBuffer[0], nbToRead);
+	const qint16* src = &m_fifoBuffer[0];
+	std::vector<qint32>::iterator dst = m_mixBuffer.begin();
+
+	if (samples > samplesPerBuffer) // bringing the latency down: squeeze the extra samples in by linear interpolation
+	{
+		float step = (samples - 1) / (float) (samplesPerBuffer - 1);
+
+		for (unsigned int i = 0; i < samplesPerBuffer; i++)
+		{
+			float x = i * step;
+			unsigned int k = (unsigned int) x;
+			unsigned int k1 = k + 1 < samples ? k + 1 : k;
+			float f = x - k;
+			*dst += src[2*k] + f * (src[2*k1] - src[2*k]);
+			++dst;
+			*dst += src[2*k+1] + f * (src[2*k1+1] - src[2*k+1]);
+			++dst;
+		}
+	}
+	else
+	{
+		for (unsigned int i = 0; i < samples; i++)
+		{
+			*dst += *src;
+			++src;
+			++dst;
+			*dst += *src;
+			++src;
+			++dst;
+		}
+	}
+
+	uint32_t markerIndex;
+	uint64_t markerTimestamp;
+
+	if (audioFifo->getReadMarker(markerIndex, markerTimestamp) && (m_audioFormat.sampleRate() > 0))
+	{
+		if (samples > samplesPerBuffer) {
+			markerIndex = (markerIndex * samplesPerBuffer) / samples;
+		}
+
+		int64_t markerPlayout = playoutTimestamp + (markerIndex * 1000000LL) / m_audioFormat.sampleRate();
+		audioFifo->setLatency((markerPlayout - (int64_t) markerTimestamp) / 1000.0f);
+	}
+}
+
 qint64 AudioOutput::writeData(const char* data, qint64 len)
 {
 	Q_UNUSED(data);
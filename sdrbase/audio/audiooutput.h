@@ -24,6 +24,7 @@
 #include <list>
 #include <vector>
 #include <stdint.h>
+#include "audio/audiocodec.h"
 #include "export.h"
 
 class QAudioOutput;
@@ -55,10 +56,18 @@ public:
 	void setOnExit(bool onExit) { m_onExit = onExit; }
 
 	void setUdpDestination(const QString& address, uint16_t port);
+	void addUdpDestination(const QString& address, uint16_t port);
+	void deleteUdpDestination(const QString& address, uint16_t port);
+	void getUdpRates(float& packetRate, float& byteRate); //!< since the previous call
 	void setUdpCopyToUDP(bool copyToUDP);
 	void setUdpUseRTP(bool useRTP);
 	void setUdpChannelMode(UDPChannelMode udpChannelMode);
 	void setUdpChannelFormat(bool stereo, int sampleRate);
+	void setUdpCodec(AudioCodec::Codec codec);
+	void setUdpDTX(bool dtx);
+	/** Latency target in ms shared between the device buffer (applied at start) and the FIFOs. 0 for device default */
+	void setLatency(int latency);
+	int getLatency() const { return m_latency; }
 
 private:
 	QMutex m_mutex;
@@ -68,9 +77,15 @@ private:
 	UDPChannelMode m_udpChannelMode;
 	uint m_audioUsageCount;
 	bool m_onExit;
+	int m_latency; //!< target in ms
 
 	std::list<AudioFifo*> m_audioFifos;
 	std::vector<qint32> m_mixBuffer;
+	std::vector<qint16> m_udpBuffer; //!< mono copy to UDP
+	std::vector<qint16> m_fifoBuffer; //!< samples read from one FIFO
+
+	void applyFillTarget(AudioFifo *audioFifo);
+	void mixFifo(AudioFifo *audioFifo, unsigned int samplesPerBuffer, uint64_t playoutTimestamp);
 
 	QAudioFormat m_audioFormat;
 
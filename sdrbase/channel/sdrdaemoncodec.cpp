@@ -0,0 +1,262 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#if defined(USE_SSE4_1)
+#include <smmintrin.h>
+#endif
+
+#include "sdrdaemoncodec.h"
+
+int SDRDaemonCodec::getSamplesPerBlock(int format, int sampleBytes)
+{
+    switch (format)
+    {
+    case SDRDaemonSample16:
+        return SDRDaemonNbBytesPerBlock / 4;
+    case SDRDaemonSample12:
+        return SDRDaemonNbBytesPerBlock / 3;
+    case SDRDaemonSample8:
+        return SDRDaemonNbBytesPerBlock / 2;
+    case SDRDaemonSampleBFP16:
+        return (SDRDaemonNbBytesPerBlock - 1) / 4; // first byte is the exponent
+    case SDRDaemonSampleBFP12:
+        return (SDRDaemonNbBytesPerBlock - 1) / 3;
+    case SDRDaemonSampleBFP8:
+        return (SDRDaemonNbBytesPerBlock - 1) / 2;
+    default:
+        return SDRDaemonNbBytesPerBlock / (sampleBytes <= 2 ? 4 : 8);
+    }
+}
+
+int SDRDaemonCodec::getBits(int format)
+{
+    switch (format)
+    {
+    case SDRDaemonSample16:
+    case SDRDaemonSampleBFP16:
+        return 16;
+    case SDRDaemonSample12:
+    case SDRDaemonSampleBFP12:
+        return 12;
+    case SDRDaemonSample8:
+    case SDRDaemonSampleBFP8:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+const char *SDRDaemonCodec::getName(int format)
+{
+    switch (format)
+    {
+    case SDRDaemonSample16:
+        return "S16";
+    case SDRDaemonSample12:
+        return "S12";
+    case SDRDaemonSample8:
+        return "S8";
+    case SDRDaemonSampleBFP16:
+        return "BFP16";
+    case SDRDaemonSampleBFP12:
+        return "BFP12";
+    case SDRDaemonSampleBFP8:
+        return "BFP8";
+    default:
+        return "Raw";
+    }
+}
+
+void SDRDaemonCodec::encode(int format, const FixReal *iq, int sampleBits, SDRDaemonProtectedBlock& block)
+{
+    int nbValues = 2 * getSamplesPerBlock(format, sizeof(FixReal));
+    int bits = getBits(format);
+    uint8_t *out = block.buf;
+    int shift;
+
+    if (bits == 0)
+    {
+        memcpy((void *) out, (const void *) iq, nbValues * sizeof(FixReal));
+        return;
+    }
+
+    int32_t maxValue = (1 << (bits - 1)) - 1;
+
+    if (isBlockFloatingPoint(format))
+    {
+        // smallest exponent that fits the largest magnitude of the block in the mantissa (clamping to one LSB)
+        int32_t maxAbs = getMaxAbs(iq, nbValues);
+        int maxShift = sampleBits > bits ? sampleBits - bits : 0;
+        shift = 0;
+
+        while (((maxAbs >> shift) > maxValue + 1) && (shift < maxShift)) {
+            shift++;
+        }
+
+        *out++ = shift;
+    }
+    else
+    {
+        shift = sampleBits > bits ? sampleBits - bits : 0;
+    }
+
+    int32_t round = shift > 0 ? 1 << (shift - 1) : 0;
+
+    for (int i = 0; i < nbValues; i += 2)
+    {
+        int32_t vi = (iq[i] + round) >> shift;
+        int32_t vq = (iq[i+1] + round) >> shift;
+        vi = vi > maxValue ? maxValue : vi < -maxValue - 1 ? -maxValue - 1 : vi;
+        vq = vq > maxValue ? maxValue : vq < -maxValue - 1 ? -maxValue - 1 : vq;
+
+        if (bits == 16)
+        {
+            out[0] = vi & 0xFF;
+            out[1] = (vi >> 8) & 0xFF;
+            out[2] = vq & 0xFF;
+            out[3] = (vq >> 8) & 0xFF;
+            out += 4;
+        }
+        else if (bits == 12) // I/Q pair in 3 bytes
+        {
+            out[0] = vi & 0xFF;
+            out[1] = ((vi >> 8) & 0x0F) | ((vq & 0x0F) << 4);
+            out[2] = (vq >> 4) & 0xFF;
+            out += 3;
+        }
+        else
+        {
+            out[0] = vi & 0xFF;
+            out[1] = vq & 0xFF;
+            out += 2;
+        }
+    }
+}
+
+void SDRDaemonCodec::decode(int format, const SDRDaemonProtectedBlock& block, int sampleBits, int sampleBytes, void *iq)
+{
+    int nbValues = 2 * getSamplesPerBlock(format, sampleBytes);
+    int bits = getBits(format);
+    const uint8_t *in = block.buf;
+    int shift;
+
+    if (bits == 0)
+    {
+        memcpy(iq, (const void *) in, nbValues * (sampleBytes <= 2 ? 2 : 4));
+        return;
+    }
+
+    if (isBlockFloatingPoint(format))
+    {
+        shift = *in++;
+        shift = shift > sampleBits - bits ? sampleBits - bits : shift; // corrupt exponent
+        shift = shift < 0 ? 0 : shift;
+    }
+    else
+    {
+        shift = sampleBits > bits ? sampleBits - bits : 0;
+    }
+
+    if (sampleBytes <= 2) {
+        decodeValues(bits, shift, in, (int16_t *) iq, nbValues);
+    } else {
+        decodeValues(bits, shift, in, (int32_t *) iq, nbValues);
+    }
+}
+
+template<typename T>
+void SDRDaemonCodec::decodeValues(int bits, int shift, const uint8_t *in, T *out, int nbValues)
+{
+    // shifts on unsigned values then sign extension by the arithmetic right shift
+    if (bits == 16)
+    {
+        for (int i = 0; i < nbValues; i++, in += 2) {
+            out[i] = (T) (((int32_t) (int16_t) (in[0] | (in[1] << 8))) * (1 << shift));
+        }
+    }
+    else if (bits == 12)
+    {
+        for (int i = 0; i < nbValues; i += 2, in += 3)
+        {
+            int32_t vi = ((int32_t) ((uint32_t) (in[0] | ((in[1] & 0x0F) << 8)) << 20)) >> 20;
+            int32_t vq = ((int32_t) ((uint32_t) ((in[1] >> 4) | (in[2] << 4)) << 20)) >> 20;
+            out[i] = (T) (vi * (1 << shift));
+            out[i+1] = (T) (vq * (1 << shift));
+        }
+    }
+    else
+    {
+        for (int i = 0; i < nbValues; i++, in++) {
+            out[i] = (T) (((int32_t) (int8_t) in[0]) * (1 << shift));
+        }
+    }
+}
+
+int32_t SDRDaemonCodec::getMaxAbs(const int16_t *values, int nbValues)
+{
+    int32_t maxAbs = 0;
+    int i = 0;
+#if defined(USE_SSE4_1)
+    __m128i vmax = _mm_setzero_si128();
+
+    for (; i + 8 <= nbValues; i += 8) {
+        vmax = _mm_max_epu16(vmax, _mm_abs_epi16(_mm_loadu_si128((const __m128i *) &values[i]))); // unsigned so that abs(-32768) is 32768
+    }
+
+    uint16_t lanes[8];
+    _mm_storeu_si128((__m128i *) lanes, vmax);
+
+    for (int j = 0; j < 8; j++) {
+        maxAbs = lanes[j] > maxAbs ? lanes[j] : maxAbs;
+    }
+#endif
+    for (; i < nbValues; i++)
+    {
+        int32_t v = values[i] < 0 ? -values[i] : values[i];
+        maxAbs = v > maxAbs ? v : maxAbs;
+    }
+
+    return maxAbs;
+}
+
+int32_t SDRDaemonCodec::getMaxAbs(const int32_t *values, int nbValues)
+{
+    int32_t maxAbs = 0;
+    int i = 0;
+#if defined(USE_SSE4_1)
+    __m128i vmax = _mm_setzero_si128();
+
+    for (; i + 4 <= nbValues; i += 4) {
+        vmax = _mm_max_epi32(vmax, _mm_abs_epi32(_mm_loadu_si128((const __m128i *) &values[i])));
+    }
+
+    int32_t lanes[4];
+    _mm_storeu_si128((__m128i *) lanes, vmax);
+
+    for (int j = 0; j < 4; j++) {
+        maxAbs = lanes[j] > maxAbs ? lanes[j] : maxAbs;
+    }
+#endif
+    for (; i < nbValues; i++)
+    {
+        int32_t v = values[i] < 0 ? -values[i] : values[i];
+        maxAbs = v > maxAbs ? v : maxAbs;
+    }
+
+    return maxAbs;
+}
@@ -0,0 +1,62 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// SDRdaemon samples encoding and decoding                                       //
+//                                                                               //
+// Encodes the samples of one protected block in one of the sample formats       //
+// (SDRDaemonSampleFormat) and decodes them back to 16 or 32 bits samples. Each  //
+// format has a fixed number of samples per block so that frames keep a constant //
+// duration and FEC protects whole blocks as before.                             //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_CHANNEL_SDRDAEMONCODEC_H_
+#define SDRBASE_CHANNEL_SDRDAEMONCODEC_H_
+
+#include <stdint.h>
+
+#include "channel/sdrdaemondatablock.h"
+#include "export.h"
+
+class SDRBASE_API SDRDaemonCodec
+{
+public:
+    /** Number of I/Q samples carried by one block in this format. For raw format depends on the size of I or Q in bytes. */
+    static int getSamplesPerBlock(int format, int sampleBytes);
+    /** Number of bits of each I or Q value in this format. 0 for raw format. */
+    static int getBits(int format);
+    static bool isBlockFloatingPoint(int format) { return (format >= SDRDaemonSampleBFP16) && (format <= SDRDaemonSampleBFP8); }
+    static const char *getName(int format);
+
+    /**
+     * Encode the samples of a full block. Samples are interleaved I and Q of sampleBits bits
+     * and there must be getSamplesPerBlock(format, sizeof(FixReal)) of them.
+     */
+    static void encode(int format, const FixReal *iq, int sampleBits, SDRDaemonProtectedBlock& block);
+
+    /**
+     * Decode a full block into interleaved I and Q values of sampleBytes bytes (2 or 4) scaled to
+     * sampleBits bits. The output must hold getSamplesPerBlock(format, sampleBytes) I/Q samples.
+     */
+    static void decode(int format, const SDRDaemonProtectedBlock& block, int sampleBits, int sampleBytes, void *iq);
+
+private:
+    static int32_t getMaxAbs(const int16_t *values, int nbValues);
+    static int32_t getMaxAbs(const int32_t *values, int nbValues);
+
+    template<typename T>
+    static void decodeValues(int bits, int shift, const uint8_t *in, T *out, int nbValues);
+};
+
+#endif /* SDRBASE_CHANNEL_SDRDAEMONCODEC_H_ */
@@ -33,12 +33,28 @@
 #define UDPSINKFEC_NBORIGINALBLOCKS 128
 //#define UDPSINKFEC_NBTXBLOCKS 8
 
+/** Encoding of the samples in the protected blocks. The format is carried in the 4 MSB of the
+ *  sample bytes field of the meta data and of each block header so that the receiving end
+ *  adapts to whatever the sending end is configured with. Samples are decoded to their
+ *  original size given by the 4 LSB (2 or 4 bytes) and number of bits. */
+enum SDRDaemonSampleFormat
+{
+    SDRDaemonSampleRaw = 0, //!< samples as in memory: 2 bytes (16 bits) or 4 bytes (24 bits) per I or Q
+    SDRDaemonSample16,      //!< 16 bits
+    SDRDaemonSample12,      //!< 12 bits packed in 3 bytes per I/Q pair
+    SDRDaemonSample8,       //!< 8 bits
+    SDRDaemonSampleBFP16,   //!< block floating point: one exponent byte per block then 16 bits mantissas
+    SDRDaemonSampleBFP12,   //!< block floating point: one exponent byte per block then 12 bits mantissas
+    SDRDaemonSampleBFP8,    //!< block floating point: one exponent byte per block then 8 bits mantissas
+    SDRDaemonSampleNbFormats
+};
+
 #pragma pack(push, 1)
 struct SDRDaemonMetaDataFEC
 {
     uint32_t m_centerFrequency;   //!<  4 center frequency in kHz
     uint32_t m_sampleRate;        //!<  8 sample rate in Hz
-    uint8_t  m_sampleBytes;       //!<  9 4 LSB: number of bytes per sample (2 or 4)
+    uint8_t  m_sampleBytes;       //!<  9 4 LSB: number of bytes per sample (2 or 4) 4 MSB: sample format (SDRDaemonSampleFormat)
     uint8_t  m_sampleBits;        //!< 10 number of effective bits per sample (deprecated)
     uint8_t  m_nbOriginalBlocks;  //!< 11 number of blocks with original (protected) data
     uint8_t  m_nbFECBlocks;       //!< 12 number of blocks carrying FEC
@@ -76,7 +92,7 @@ struct SDRDaemonHeader
 {
     uint16_t m_frameIndex;
     uint8_t  m_blockIndex;
-    uint8_t  m_sampleBytes; //!<  number of bytes per sample (2 or 4) for this block
+    uint8_t  m_sampleBytes; //!<  4 LSB: number of bytes per sample (2 or 4) 4 MSB: sample format for this block
     uint8_t  m_sampleBits;  //!<  number of bits per sample
     uint8_t  m_filler;
     uint16_t m_filler2;
@@ -95,6 +111,8 @@ struct SDRDaemonHeader
 static const int SDRDaemonUdpSize = UDPSINKFEC_UDPSIZE;
 static const int SDRDaemonNbOrginalBlocks = UDPSINKFEC_NBORIGINALBLOCKS;
 static const int SDRDaemonNbBytesPerBlock = UDPSINKFEC_UDPSIZE - sizeof(SDRDaemonHeader);
+static const int SDRDaemonMaxSamplesPerBlock = SDRDaemonNbBytesPerBlock / 2;  //!< I/Q samples with 8 bits format
+static const int SDRDaemonMaxDecodedBlockBytes = SDRDaemonMaxSamplesPerBlock * 8; //!< decoded to 4 bytes per I or Q
 
 struct SDRDaemonProtectedBlock
 {
@@ -31,7 +31,8 @@ SDRDaemonDataReadQueue::SDRDaemonDataReadQueue() :
         m_blockIndex(1),
         m_sampleIndex(0),
         m_sampleCount(0),
-        m_full(false)
+        m_full(false),
+        m_decodedBlockIndex(0)
 {}
 
 SDRDaemonDataReadQueue::~SDRDaemonDataReadQueue()
@@ -96,6 +97,7 @@ void SDRDaemonDataReadQueue::readSample(Sample& s, bool scaleForTx)
             qDebug("SDRDaemonDataReadQueue::readSample: initial pop new block: queue size: %u", length());
             m_blockIndex = 1;
             m_dataBlock = m_dataReadQueue.takeFirst();
+            m_decodedBlockIndex = 0;
             convertDataToSample(s, m_blockIndex, m_sampleIndex, scaleForTx);
             m_sampleIndex++;
             m_sampleCount++;
@@ -108,8 +110,8 @@ void SDRDaemonDataReadQueue::readSample(Sample& s, bool scaleForTx)
         return;
     }
 
-    int sampleSize = m_dataBlock->m_superBlocks[m_blockIndex].m_header.m_sampleBytes * 2;
-    uint32_t samplesPerBlock = SDRDaemonNbBytesPerBlock / sampleSize;
+    uint8_t sampleBytes = m_dataBlock->m_superBlocks[m_blockIndex].m_header.m_sampleBytes;
+    uint32_t samplesPerBlock = SDRDaemonCodec::getSamplesPerBlock(sampleBytes >> 4, sampleBytes & 0xF);
 
     if (m_sampleIndex < samplesPerBlock)
     {
@@ -142,6 +144,7 @@ void SDRDaemonDataReadQueue::readSample(Sample& s, bool scaleForTx)
                 //qDebug("SDRDaemonDataReadQueue::readSample: pop new block: queue size: %u", length());
                 m_blockIndex = 1;
                 m_dataBlock = m_dataReadQueue.takeFirst();
+                m_decodedBlockIndex = 0;
                 convertDataToSample(s, m_blockIndex, m_sampleIndex, scaleForTx);
                 m_sampleIndex++;
                 m_sampleCount++;
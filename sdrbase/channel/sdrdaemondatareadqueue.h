@@ -25,8 +25,8 @@
 
 #include <QQueue>
 
-class SDRDaemonDataBlock;
-class Sample;
+#include "channel/sdrdaemondatablock.h"
+#include "channel/sdrdaemoncodec.h"
 
 class SDRDaemonDataReadQueue
 {
@@ -52,17 +52,40 @@ private:
     uint32_t m_sampleIndex;
     uint32_t m_sampleCount; //!< use a counter capped below 2^31 as it is going to be converted to an int in the web interface
     bool m_full; //!< full condition was hit
+    uint32_t m_decodedBlockIndex; //!< index of the block in m_decodedBlock or 0 if none
+    uint8_t m_decodedBlock[SDRDaemonMaxDecodedBlockBytes]; //!< samples of a block not in raw format
+
+    /** Samples of the block as sent i.e. decoded if not in raw format */
+    inline const uint8_t *getBlockSamples(uint32_t blockIndex)
+    {
+        const SDRDaemonSuperBlock& superBlock = m_dataBlock->m_superBlocks[blockIndex];
+        int format = superBlock.m_header.m_sampleBytes >> 4;
+
+        if (format == SDRDaemonSampleRaw) {
+            return superBlock.m_protectedBlock.buf;
+        }
+
+        if (blockIndex != m_decodedBlockIndex) // decode the whole block on first sample
+        {
+            SDRDaemonCodec::decode(format, superBlock.m_protectedBlock, superBlock.m_header.m_sampleBits,
+                    superBlock.m_header.m_sampleBytes & 0xF, m_decodedBlock);
+            m_decodedBlockIndex = blockIndex;
+        }
+
+        return m_decodedBlock;
+    }
 
     inline void convertDataToSample(Sample& s, uint32_t blockIndex, uint32_t sampleIndex, bool scaleForTx)
     {
-        int sampleSize = m_dataBlock->m_superBlocks[blockIndex].m_header.m_sampleBytes * 2; // I/Q sample size in data block
+        int sampleSize = (m_dataBlock->m_superBlocks[blockIndex].m_header.m_sampleBytes & 0xF) * 2; // I/Q sample size in data block
         int samplebits = m_dataBlock->m_superBlocks[blockIndex].m_header.m_sampleBits;      // I or Q sample size in bits
+        const uint8_t *buf = getBlockSamples(blockIndex);
         int32_t iconv, qconv;
 
         if ((sizeof(Sample) == 4) && (sampleSize == 8)) // generally 24->16 bits
         {
-            iconv = ((int32_t*) &(m_dataBlock->m_superBlocks[blockIndex].m_protectedBlock.buf[sampleIndex*sampleSize]))[0];
-            qconv = ((int32_t*) &(m_dataBlock->m_superBlocks[blockIndex].m_protectedBlock.buf[sampleIndex*sampleSize+4]))[0];
+            iconv = ((int32_t*) &(buf[sampleIndex*sampleSize]))[0];
+            qconv = ((int32_t*) &(buf[sampleIndex*sampleSize+4]))[0];
             iconv >>= scaleForTx ? (SDR_TX_SAMP_SZ-SDR_RX_SAMP_SZ) : (samplebits-SDR_RX_SAMP_SZ);
             qconv >>= scaleForTx ? (SDR_TX_SAMP_SZ-SDR_RX_SAMP_SZ) : (samplebits-SDR_RX_SAMP_SZ);
             s.setReal(iconv);
@@ -70,8 +93,8 @@ private:
         }
         else if ((sizeof(Sample) == 8) && (sampleSize == 4)) // generally 16->24 bits
         {
-            iconv = ((int16_t*) &(m_dataBlock->m_superBlocks[blockIndex].m_protectedBlock.buf[sampleIndex*sampleSize]))[0];
-            qconv = ((int16_t*) &(m_dataBlock->m_superBlocks[blockIndex].m_protectedBlock.buf[sampleIndex*sampleSize+2]))[0];
+            iconv = ((int16_t*) &(buf[sampleIndex*sampleSize]))[0];
+            qconv = ((int16_t*) &(buf[sampleIndex*sampleSize+2]))[0];
             iconv <<= scaleForTx ? (SDR_TX_SAMP_SZ-samplebits) : (SDR_RX_SAMP_SZ-samplebits);
             qconv <<= scaleForTx ? (SDR_TX_SAMP_SZ-samplebits) : (SDR_RX_SAMP_SZ-samplebits);
             s.setReal(iconv);
@@ -79,7 +102,7 @@ private:
         }
         else if ((sampleSize == 4) || (sampleSize == 8)) // generally 16->16 or 24->24 bits
         {
-            s = *((Sample*) &(m_dataBlock->m_superBlocks[blockIndex].m_protectedBlock.buf[sampleIndex*sampleSize]));
+            s = *((Sample*) &(buf[sampleIndex*sampleSize]));
         }
         else // invalid size
         {
@@ -16,6 +16,9 @@
 
 #include <QGlobalStatic>
 
+#include <QSettings>
+#include <QElapsedTimer>
+
 #include "plugin/pluginmanager.h"
 #include "deviceenumerator.h"
 
@@ -25,28 +28,46 @@ DeviceEnumerator *DeviceEnumerator::instance()
     return deviceEnumerator;
 }
 
-DeviceEnumerator::DeviceEnumerator()
+DeviceEnumerator::DeviceEnumerator() :
+    m_refresh(0)
 {}
 
 DeviceEnumerator::~DeviceEnumerator()
-{}
+{
+    if (m_refresh)
+    {
+        m_refresh->wait();
+        delete m_refresh;
+    }
+}
 
 void DeviceEnumerator::enumerateRxDevices(PluginManager *pluginManager)
 {
-    m_rxEnumeration.clear();
-    PluginAPI::SamplingDeviceRegistrations& rxDeviceRegistrations = pluginManager->getSourceDeviceRegistrations();
+    enumerate(pluginManager->getSourceDeviceRegistrations(), true, m_rxEnumeration);
+}
+
+void DeviceEnumerator::enumerateTxDevices(PluginManager *pluginManager)
+{
+    enumerate(pluginManager->getSinkDeviceRegistrations(), false, m_txEnumeration);
+}
+
+void DeviceEnumerator::enumerate(const PluginAPI::SamplingDeviceRegistrations& registrations, bool rx, DevicesEnumeration& enumeration)
+{
+    enumeration.clear();
     int index = 0;
 
-    for (int i = 0; i < rxDeviceRegistrations.count(); i++)
+    for (int i = 0; i < registrations.count(); i++)
     {
-        PluginInterface::SamplingDevices samplingDevices = rxDeviceRegistrations[i].m_plugin->enumSampleSources();
+        PluginInterface::SamplingDevices samplingDevices = rx ?
+                registrations[i].m_plugin->enumSampleSources() :
+                registrations[i].m_plugin->enumSampleSinks();
 
         for (int j = 0; j < samplingDevices.count(); j++)
         {
-            m_rxEnumeration.push_back(
+            enumeration.push_back(
                 DeviceEnumeration(
                     samplingDevices[j],
-                    rxDeviceRegistrations[i].m_plugin,
+                    registrations[i].m_plugin,
                     index
                 )
             );
@@ -55,26 +76,177 @@ void DeviceEnumerator::enumerateRxDevices(PluginManager *pluginManager)
     }
 }
 
-void DeviceEnumerator::enumerateTxDevices(PluginManager *pluginManager)
+bool DeviceEnumerator::loadCache(PluginManager *pluginManager)
 {
-    m_txEnumeration.clear();
-    PluginAPI::SamplingDeviceRegistrations& txDeviceRegistrations = pluginManager->getSinkDeviceRegistrations();
-    int index = 0;
+    DevicesEnumeration rxEnumeration, txEnumeration;
 
-    for (int i = 0; i < txDeviceRegistrations.count(); i++)
+    if (!loadEnumeration(pluginManager->getSourceDeviceRegistrations(), "rx", rxEnumeration)
+     || !loadEnumeration(pluginManager->getSinkDeviceRegistrations(), "tx", txEnumeration))
     {
-        PluginInterface::SamplingDevices samplingDevices = txDeviceRegistrations[i].m_plugin->enumSampleSinks();
+        return false;
+    }
 
-        for (int j = 0; j < samplingDevices.count(); j++)
+    m_rxEnumeration = rxEnumeration;
+    m_txEnumeration = txEnumeration;
+    qDebug("DeviceEnumerator::loadCache: %d Rx and %d Tx devices", (int) m_rxEnumeration.size(), (int) m_txEnumeration.size());
+    return true;
+}
+
+void DeviceEnumerator::saveCache() const
+{
+    saveEnumeration(m_rxEnumeration, "rx");
+    saveEnumeration(m_txEnumeration, "tx");
+}
+
+void DeviceEnumerator::saveEnumeration(const DevicesEnumeration& enumeration, const QString& key)
+{
+    QSettings s;
+    s.beginGroup("devicecache");
+    s.remove(key);
+    s.beginWriteArray(key, enumeration.size());
+
+    for (unsigned int i = 0; i < enumeration.size(); i++)
+    {
+        const PluginInterface::SamplingDevice& samplingDevice = enumeration[i].m_samplingDevice;
+        s.setArrayIndex(i);
+        s.setValue("displayedName", samplingDevice.displayedName);
+        s.setValue("hardwareId", samplingDevice.hardwareId);
+        s.setValue("id", samplingDevice.id);
+        s.setValue("serial", samplingDevice.serial);
+        s.setValue("sequence", samplingDevice.sequence);
+        s.setValue("type", (int) samplingDevice.type);
+        s.setValue("rxElseTx", samplingDevice.rxElseTx);
+        s.setValue("deviceNbItems", samplingDevice.deviceNbItems);
+        s.setValue("deviceItemIndex", samplingDevice.deviceItemIndex);
+    }
+
+    s.endArray();
+    s.endGroup();
+}
+
+bool DeviceEnumerator::loadEnumeration(const PluginAPI::SamplingDeviceRegistrations& registrations, const QString& key, DevicesEnumeration& enumeration)
+{
+    QSettings s;
+    s.beginGroup("devicecache");
+
+    if (!s.childGroups().contains(key)) {
+        return false;
+    }
+
+    int size = s.beginReadArray(key);
+    enumeration.clear();
+
+    for (int i = 0; i < size; i++)
+    {
+        s.setArrayIndex(i);
+        QString id = s.value("id").toString();
+        PluginInterface *plugin = 0;
+
+        // devices of plugins no longer loaded are dropped
+        for (int j = 0; j < registrations.count(); j++)
         {
-            m_txEnumeration.push_back(
-                DeviceEnumeration(
-                    samplingDevices[j],
-                    txDeviceRegistrations[i].m_plugin,
-                    index
-                )
-            );
-            index++;
+            if (registrations[j].m_deviceId == id)
+            {
+                plugin = registrations[j].m_plugin;
+                break;
+            }
+        }
+
+        if (!plugin) {
+            continue;
+        }
+
+        PluginInterface::SamplingDevice samplingDevice(
+                s.value("displayedName").toString(),
+                s.value("hardwareId").toString(),
+                id,
+                s.value("serial").toString(),
+                s.value("sequence").toInt(),
+                (PluginInterface::SamplingDevice::SamplingDeviceType) s.value("type").toInt(),
+                s.value("rxElseTx").toBool(),
+                s.value("deviceNbItems").toInt(),
+                s.value("deviceItemIndex").toInt());
+        enumeration.push_back(DeviceEnumeration(samplingDevice, plugin, enumeration.size()));
+    }
+
+    s.endArray();
+    s.endGroup();
+    return true;
+}
+
+void DeviceEnumerator::startRefresh(PluginManager *pluginManager)
+{
+    if (m_refresh) {
+        return;
+    }
+
+    m_refresh = new Refresh();
+    m_refresh->m_rxRegistrations = pluginManager->getSourceDeviceRegistrations();
+    m_refresh->m_txRegistrations = pluginManager->getSinkDeviceRegistrations();
+    connect(m_refresh, SIGNAL(finished()), this, SLOT(refreshFinished()));
+    m_refresh->start();
+}
+
+void DeviceEnumerator::Refresh::run()
+{
+    QElapsedTimer timer;
+    timer.start();
+    enumerate(m_rxRegistrations, true, m_rxEnumeration);
+    enumerate(m_txRegistrations, false, m_txEnumeration);
+    m_elapsedMs = timer.elapsed();
+}
+
+void DeviceEnumerator::refreshFinished()
+{
+    keepClaims(m_rxEnumeration, m_refresh->m_rxEnumeration);
+    keepClaims(m_txEnumeration, m_refresh->m_txEnumeration);
+    m_rxEnumeration = m_refresh->m_rxEnumeration;
+    m_txEnumeration = m_refresh->m_txEnumeration;
+    qInfo("DeviceEnumerator::refreshFinished: %d Rx and %d Tx devices enumerated in background in %lld ms",
+        (int) m_rxEnumeration.size(), (int) m_txEnumeration.size(), m_refresh->m_elapsedMs);
+    saveCache();
+    m_refresh->deleteLater();
+    m_refresh = 0;
+    emit devicesChanged();
+}
+
+int DeviceEnumerator::findDevice(const DevicesEnumeration& enumeration, const QString& deviceId, const QString& serial, int sequence, int itemIndex)
+{
+    for (DevicesEnumeration::const_iterator it = enumeration.begin(); it != enumeration.end(); ++it)
+    {
+        if ((it->m_samplingDevice.id == deviceId)
+         && (it->m_samplingDevice.serial == serial)
+         && (it->m_samplingDevice.sequence == sequence)
+         && (it->m_samplingDevice.deviceItemIndex == itemIndex))
+        {
+            return it->m_index;
+        }
+    }
+
+    return -1;
+}
+
+void DeviceEnumerator::keepClaims(const DevicesEnumeration& previous, DevicesEnumeration& enumeration)
+{
+    for (DevicesEnumeration::const_iterator pit = previous.begin(); pit != previous.end(); ++pit)
+    {
+        if (pit->m_samplingDevice.claimed < 0) {
+            continue;
+        }
+
+        int index = findDevice(enumeration,
+                pit->m_samplingDevice.id,
+                pit->m_samplingDevice.serial,
+                pit->m_samplingDevice.sequence,
+                pit->m_samplingDevice.deviceItemIndex);
+
+        if (index < 0) // a device in use may not be enumerated again: keep it listed
+        {
+            enumeration.push_back(DeviceEnumeration(pit->m_samplingDevice, pit->m_pluginInterface, enumeration.size()));
+        }
+        else
+        {
+            enumeration[index].m_samplingDevice.claimed = pit->m_samplingDevice.claimed;
         }
     }
 }
@@ -197,3 +369,13 @@ int DeviceEnumerator::getTxSamplingDeviceIndex(const QString& deviceId, int sequ
     return -1;
 }
 
+int DeviceEnumerator::getRxSamplingDeviceIndex(const QString& deviceId, const QString& serial, int sequence, int itemIndex) const
+{
+    return findDevice(m_rxEnumeration, deviceId, serial, sequence, itemIndex);
+}
+
+int DeviceEnumerator::getTxSamplingDeviceIndex(const QString& deviceId, const QString& serial, int sequence, int itemIndex) const
+{
+    return findDevice(m_txEnumeration, deviceId, serial, sequence, itemIndex);
+}
+
@@ -19,13 +19,18 @@
 
 #include <vector>
 
+#include <QObject>
+#include <QThread>
+
 #include "plugin/plugininterface.h"
+#include "plugin/pluginapi.h"
 #include "export.h"
 
 class PluginManager;
 
-class SDRBASE_API DeviceEnumerator
+class SDRBASE_API DeviceEnumerator : public QObject
 {
+    Q_OBJECT
 public:
     DeviceEnumerator();
     ~DeviceEnumerator();
@@ -34,6 +39,14 @@ public:
 
     void enumerateRxDevices(PluginManager *pluginManager);
     void enumerateTxDevices(PluginManager *pluginManager);
+    /** Enumerate from the devices saved at the previous run. Returns false if there are none. */
+    bool loadCache(PluginManager *pluginManager);
+    /** Save the devices for the next run */
+    void saveCache() const;
+    /** Enumerate the devices again in a background thread. The enumeration is replaced when done and saved.
+     *  Claimed devices keep their claim and devices may change index: devicesChanged() is emitted then. */
+    void startRefresh(PluginManager *pluginManager);
+    bool isRefreshing() const { return m_refresh != 0; }
     void listRxDeviceNames(QList<QString>& list, std::vector<int>& indexes) const;
     void listTxDeviceNames(QList<QString>& list, std::vector<int>& indexes) const;
     void changeRxSelection(int tabIndex, int deviceIndex);
@@ -50,6 +63,11 @@ public:
     int getFileSinkDeviceIndex() const;
     int getRxSamplingDeviceIndex(const QString& deviceId, int sequence);
     int getTxSamplingDeviceIndex(const QString& deviceId, int sequence);
+    int getRxSamplingDeviceIndex(const QString& deviceId, const QString& serial, int sequence, int itemIndex) const;
+    int getTxSamplingDeviceIndex(const QString& deviceId, const QString& serial, int sequence, int itemIndex) const;
+
+signals:
+    void devicesChanged(); //!< The enumeration was replaced. Device indexes must be looked up again.
 
 private:
     struct DeviceEnumeration
@@ -67,8 +85,30 @@ private:
 
     typedef std::vector<DeviceEnumeration> DevicesEnumeration;
 
+    class Refresh : public QThread
+    {
+    public:
+        PluginAPI::SamplingDeviceRegistrations m_rxRegistrations;
+        PluginAPI::SamplingDeviceRegistrations m_txRegistrations;
+        DevicesEnumeration m_rxEnumeration;
+        DevicesEnumeration m_txEnumeration;
+        qint64 m_elapsedMs;
+    protected:
+        void run();
+    };
+
     DevicesEnumeration m_rxEnumeration;
     DevicesEnumeration m_txEnumeration;
+    Refresh *m_refresh;
+
+    static void enumerate(const PluginAPI::SamplingDeviceRegistrations& registrations, bool rx, DevicesEnumeration& enumeration);
+    static int findDevice(const DevicesEnumeration& enumeration, const QString& deviceId, const QString& serial, int sequence, int itemIndex);
+    static void keepClaims(const DevicesEnumeration& previous, DevicesEnumeration& enumeration);
+    static void saveEnumeration(const DevicesEnumeration& enumeration, const QString& key);
+    static bool loadEnumeration(const PluginAPI::SamplingDeviceRegistrations& registrations, const QString& key, DevicesEnumeration& enumeration);
+
+private slots:
+    void refreshFinished();
 };
 
 #endif /* SDRBASE_DEVICE_DEVICEENUMERATOR_H_ */
@@ -264,14 +264,21 @@ void DeviceSinkAPI::loadSinkSettings(const Preset* preset)
         {
             qDebug("DeviceSinkAPI::loadSinkSettings: deserializing sink %s[%d]: %s", qPrintable(m_sampleSinkId), m_sampleSinkSequence, qPrintable(m_sampleSinkSerial));
 
+            // a device already in the preset state is not reconfigured
             if (m_sampleSinkPluginInstanceUI != 0) // GUI flavor
             {
-                m_sampleSinkPluginInstanceUI->deserialize(*sinkConfig);
+                if (m_sampleSinkPluginInstanceUI->serialize() != *sinkConfig) {
+                    m_sampleSinkPluginInstanceUI->deserialize(*sinkConfig);
+                }
+
                 m_sampleSinkPluginInstanceUI->setCenterFrequency(centerFrequency);
             }
             else if (m_deviceSinkEngine->getSink() != 0) // Server flavor
             {
-                m_deviceSinkEngine->getSink()->deserialize(*sinkConfig);
+                if (m_deviceSinkEngine->getSink()->serialize() != *sinkConfig) {
+                    m_deviceSinkEngine->getSink()->deserialize(*sinkConfig);
+                }
+
                 m_deviceSinkEngine->getSink()->setCenterFrequency(centerFrequency);
             }
             else
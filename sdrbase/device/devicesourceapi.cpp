@@ -251,13 +251,18 @@ void DeviceSourceAPI::loadSourceSettings(const Preset* preset)
         {
             qDebug("DeviceSourceAPI::loadSourceSettings: deserializing source %s[%d]: %s", qPrintable(m_sampleSourceId), m_sampleSourceSequence, qPrintable(m_sampleSourceSerial));
 
+            // a device already in the preset state is not reconfigured
             if (m_sampleSourcePluginInstanceUI != 0) // GUI flavor
             {
-                m_sampleSourcePluginInstanceUI->deserialize(*sourceConfig);
+                if (m_sampleSourcePluginInstanceUI->serialize() != *sourceConfig) {
+                    m_sampleSourcePluginInstanceUI->deserialize(*sourceConfig);
+                }
             }
             else if (m_deviceSourceEngine->getSource() != 0) // Server flavor
             {
-                m_deviceSourceEngine->getSource()->deserialize(*sourceConfig);
+                if (m_deviceSourceEngine->getSource()->serialize() != *sourceConfig) {
+                    m_deviceSourceEngine->getSource()->deserialize(*sourceConfig);
+                }
             }
             else
             {
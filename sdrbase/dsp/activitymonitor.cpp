@@ -0,0 +1,454 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <algorithm>
+
+#include <QDebug>
+#include <QMutexLocker>
+#include <QDateTime>
+#include <QElapsedTimer>
+
+#include "dsp/dspcommands.h"
+#include "dsp/fftengine.h"
+#include "util/messagequeue.h"
+#include "activitymonitor.h"
+
+MESSAGE_CLASS_DEFINITION(ActivityMonitor::MsgActivity, Message)
+
+const Real ActivityMonitor::m_mult = (10.0f / log2f(10.0f));
+
+ActivityMonitor::Settings::Settings()
+{
+    resetToDefaults();
+}
+
+void ActivityMonitor::Settings::resetToDefaults()
+{
+    m_rasterOrigin = 0;
+    m_channelSpacing = 12500;
+    m_channelBandwidth = 10000;
+    m_nbChannels = 0;
+    m_usableBandwidth = 0.9f;
+    m_fftSize = 1024;
+    m_nbAverages = 4;
+    m_threshold = 10.0f;
+    m_hysteresis = 3.0f;
+    m_attackTime = 10;
+    m_holdTime = 500;
+    m_window = FFTWindow::BlackmanHarris;
+}
+
+ActivityMonitor::ActivityMonitor() :
+    m_monitoring(false),
+    m_sampleRate(0),
+    m_centerFrequency(0),
+    m_fft(0),
+    m_sampleIndex(0),
+    m_averageIndex(0),
+    m_attackDetections(1),
+    m_holdDetections(1),
+    m_noiseFloor(0.0f),
+    m_nbDetections(0),
+    m_processNsecs(0),
+    m_processedSamples(0),
+    m_sequence(0)
+{
+    setObjectName("ActivityMonitor");
+}
+
+ActivityMonitor::~ActivityMonitor()
+{
+    delete m_fft;
+}
+
+bool ActivityMonitor::validate(const Settings& s)
+{
+    return (s.m_fftSize >= 16) && (s.m_fftSize <= 65536) && ((s.m_fftSize & (s.m_fftSize - 1)) == 0)
+        && (s.m_nbAverages >= 1) && (s.m_channelSpacing > 0) && (s.m_channelBandwidth > 0) && (s.m_nbChannels >= 0)
+        && (s.m_usableBandwidth > 0.0f) && (s.m_usableBandwidth <= 1.0f) && (s.m_hysteresis >= 0.0f)
+        && (s.m_attackTime >= 0) && (s.m_holdTime >= 0);
+}
+
+bool ActivityMonitor::startMonitor(const Settings& settings)
+{
+    if (!validate(settings))
+    {
+        qWarning("ActivityMonitor::startMonitor: invalid settings");
+        return false;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+    qint64 now = QDateTime::currentMSecsSinceEpoch();
+
+    if (m_monitoring) {
+        endActivities(now);
+    }
+
+    if ((m_fft == 0) || (settings.m_fftSize != m_settings.m_fftSize))
+    {
+        if (m_fft == 0) {
+            m_fft = FFTEngine::create();
+        }
+
+        m_fft->configure(settings.m_fftSize, false);
+    }
+
+    m_settings = settings;
+    m_window.create(m_settings.m_window, m_settings.m_fftSize);
+    m_nbDetections = 0;
+    m_processNsecs = 0;
+    m_processedSamples = 0;
+    plan();
+    m_monitoring = true;
+
+    qDebug("ActivityMonitor::startMonitor: %u slots of %d Hz every %d Hz",
+        (unsigned int) m_slots.size(), m_settings.m_channelBandwidth, m_settings.m_channelSpacing);
+
+    return true;
+}
+
+void ActivityMonitor::stopMonitor()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_monitoring)
+    {
+        endActivities(QDateTime::currentMSecsSinceEpoch());
+        m_monitoring = false;
+    }
+}
+
+ActivityMonitor::Settings ActivityMonitor::getSettings()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_settings;
+}
+
+void ActivityMonitor::getReport(Report& report)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    report.m_sampleRate = m_sampleRate;
+    report.m_centerFrequency = m_centerFrequency;
+    report.m_nbSlots = m_slots.size();
+    report.m_nbActive = 0;
+
+    for (std::vector<Slot>::const_iterator it = m_slots.begin(); it != m_slots.end(); ++it) {
+        report.m_nbActive += it->m_active ? 1 : 0;
+    }
+
+    report.m_noiseFloor = m_noiseFloor;
+    report.m_nbDetections = m_nbDetections;
+    report.m_detectionTime = m_nbDetections == 0 ? 0.0 : m_processNsecs / (m_nbDetections * 1000.0);
+    report.m_load = (m_processedSamples == 0) || (m_sampleRate == 0) ?
+        0.0 : (m_processNsecs / 1e9) / (m_processedSamples / (double) m_sampleRate);
+}
+
+void ActivityMonitor::getSlots(std::vector<Slot>& slots)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    slots = m_slots;
+}
+
+quint64 ActivityMonitor::getEvents(quint64 sequence, std::vector<Event>& events, unsigned int maxEvents)
+{
+    QMutexLocker mutexLocker(&m_eventMutex);
+    events.clear();
+
+    for (std::deque<Event>::const_iterator it = m_events.begin(); (it != m_events.end()) && (events.size() < maxEvents); ++it)
+    {
+        if (it->m_sequence > sequence) {
+            events.push_back(*it);
+        }
+    }
+
+    return m_sequence;
+}
+
+void ActivityMonitor::start()
+{
+}
+
+void ActivityMonitor::stop()
+{
+}
+
+void ActivityMonitor::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+    (void) positiveOnly;
+
+    if (!m_monitoring) {
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_monitoring || m_slots.empty()) {
+        return;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    qint64 now = QDateTime::currentMSecsSinceEpoch(); // arrival of the last sample of the block
+    int fftSize = m_settings.m_fftSize;
+    int halfSize = fftSize / 2;
+    Complex *samples = &m_samples[0];
+
+    for (SampleVector::const_iterator it = begin; it < end; ++it)
+    {
+        samples[m_sampleIndex++] = Complex(it->real() / SDR_RX_SCALEF, it->imag() / SDR_RX_SCALEF);
+
+        if (m_sampleIndex < fftSize) {
+            continue;
+        }
+
+        m_sampleIndex = 0;
+        m_window.apply(samples, m_fft->in());
+        m_fft->transform();
+        const Complex *fftOut = m_fft->out();
+        Real *power = &m_power[0];
+
+        for (int i = 0; i < fftSize; i++) // negative frequencies first
+        {
+            const Complex& c = fftOut[i];
+            power[i < halfSize ? i + halfSize : i - halfSize] += c.real() * c.real() + c.imag() * c.imag();
+        }
+
+        if (++m_averageIndex == m_settings.m_nbAverages)
+        {
+            detect(now - ((end - it - 1) * 1000LL) / m_sampleRate);
+            m_averageIndex = 0;
+            std::fill(m_power.begin(), m_power.end(), 0.0f);
+        }
+    }
+
+    m_processNsecs += timer.nsecsElapsed();
+    m_processedSamples += end - begin;
+}
+
+bool ActivityMonitor::handleMessage(const Message& message)
+{
+    if (DSPSignalNotification::match(message))
+    {
+        DSPSignalNotification& notif = (DSPSignalNotification&) message;
+        QMutexLocker mutexLocker(&m_mutex);
+
+        if ((notif.getSampleRate() != m_sampleRate) || (notif.getCenterFrequency() != m_centerFrequency))
+        {
+            if (m_monitoring) { // the slots move with the baseband
+                endActivities(QDateTime::currentMSecsSinceEpoch());
+            }
+
+            m_sampleRate = notif.getSampleRate();
+            m_centerFrequency = notif.getCenterFrequency();
+            plan();
+        }
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void ActivityMonitor::plan()
+{
+    const Settings& s = m_settings;
+    int fftSize = s.m_fftSize;
+    m_slots.clear();
+    m_samples.resize(fftSize);
+    m_power.assign(fftSize, 0.0f);
+    m_prefix.resize(fftSize + 1);
+    m_sampleIndex = 0;
+    m_averageIndex = 0;
+
+    if (m_sampleRate <= 0) {
+        return; // waiting for the baseband
+    }
+
+    double binWidth = m_sampleRate / (double) fftSize;
+    double halfUsable = m_sampleRate * s.m_usableBandwidth / 2.0;
+    double lowest = m_centerFrequency - halfUsable + s.m_channelBandwidth / 2.0;
+    double highest = m_centerFrequency + halfUsable - s.m_channelBandwidth / 2.0;
+    qint64 firstChannel = s.m_nbChannels > 0 ? 0 : (qint64) ceil((lowest - s.m_rasterOrigin) / s.m_channelSpacing);
+    qint64 lastChannel = s.m_nbChannels > 0 ? s.m_nbChannels - 1 : (qint64) floor((highest - s.m_rasterOrigin) / s.m_channelSpacing);
+
+    if (lastChannel - firstChannel >= 65536)
+    {
+        qWarning("ActivityMonitor::plan: too many channels: %lld", lastChannel - firstChannel + 1);
+        return;
+    }
+
+    double halfBins = s.m_channelBandwidth / (2.0 * binWidth);
+
+    for (qint64 k = firstChannel; k <= lastChannel; k++)
+    {
+        qint64 frequency = s.m_rasterOrigin + k * s.m_channelSpacing;
+
+        if ((frequency < lowest) || (frequency > highest)) {
+            continue;
+        }
+
+        Slot slot;
+        double centerBin = (frequency - m_centerFrequency) / binWidth + fftSize / 2;
+        slot.m_frequency = frequency;
+        slot.m_channel = k;
+        slot.m_firstBin = (int) ceil(centerBin - halfBins);
+        slot.m_lastBin = (int) floor(centerBin + halfBins);
+
+        if (slot.m_lastBin < slot.m_firstBin) { // narrower than a bin
+            slot.m_firstBin = slot.m_lastBin = (int) round(centerBin);
+        }
+
+        slot.m_firstBin = std::max(0, slot.m_firstBin);
+        slot.m_lastBin = std::min(fftSize - 1, slot.m_lastBin);
+        slot.m_active = false;
+        slot.m_count = 0;
+        slot.m_changeTime = 0;
+        slot.m_startTime = 0;
+        slot.m_power = 0.0f;
+        slot.m_peakPower = 0.0f;
+        m_slots.push_back(slot);
+    }
+
+    qint64 detectionSamples = (qint64) fftSize * s.m_nbAverages;
+    m_attackDetections = std::max((qint64) 1, ((qint64) s.m_attackTime * m_sampleRate + 1000 * detectionSamples - 1) / (1000 * detectionSamples));
+    m_holdDetections = std::max((qint64) 1, ((qint64) s.m_holdTime * m_sampleRate + 1000 * detectionSamples - 1) / (1000 * detectionSamples));
+}
+
+void ActivityMonitor::detect(qint64 timestamp)
+{
+    int fftSize = m_settings.m_fftSize;
+    double scale = 1.0 / ((double) fftSize * fftSize * m_settings.m_nbAverages);
+    qint64 detectionStart = timestamp - ((qint64) fftSize * m_settings.m_nbAverages * 1000) / m_sampleRate;
+
+    // noise floor is the median of the usable bins
+    int usableBins = std::max(1, (int) (fftSize * m_settings.m_usableBandwidth));
+    std::vector<Real>::iterator usableBegin = m_power.begin() + (fftSize - usableBins) / 2;
+    m_sorted.assign(usableBegin, usableBegin + usableBins);
+    std::nth_element(m_sorted.begin(), m_sorted.begin() + usableBins / 2, m_sorted.end());
+    double noiseFloor = std::max(m_sorted[usableBins / 2] * scale, 1e-20);
+    m_noiseFloor = m_mult * log2f(noiseFloor);
+
+    m_prefix[0] = 0.0;
+
+    for (int i = 0; i < fftSize; i++) {
+        m_prefix[i + 1] = m_prefix[i] + m_power[i];
+    }
+
+    float startLevel = m_noiseFloor + m_settings.m_threshold;
+    float stopLevel = startLevel - m_settings.m_hysteresis;
+
+    for (std::vector<Slot>::iterator slot = m_slots.begin(); slot != m_slots.end(); ++slot)
+    {
+        double power = (m_prefix[slot->m_lastBin + 1] - m_prefix[slot->m_firstBin]) * scale / (slot->m_lastBin - slot->m_firstBin + 1);
+        slot->m_power = m_mult * log2f(std::max(power, 1e-20));
+
+        if (slot->m_active)
+        {
+            slot->m_peakPower = std::max(slot->m_peakPower, slot->m_power);
+
+            if (slot->m_power < stopLevel)
+            {
+                if (slot->m_count++ == 0) {
+                    slot->m_changeTime = detectionStart;
+                }
+
+                if (slot->m_count >= m_holdDetections)
+                {
+                    issueEvent(*slot, false, slot->m_changeTime);
+                    slot->m_active = false;
+                    slot->m_count = 0;
+                }
+            }
+            else
+            {
+                slot->m_count = 0;
+            }
+        }
+        else
+        {
+            if (slot->m_power > startLevel)
+            {
+                if (slot->m_count++ == 0)
+                {
+                    slot->m_changeTime = detectionStart;
+                    slot->m_peakPower = slot->m_power;
+                }
+                else
+                {
+                    slot->m_peakPower = std::max(slot->m_peakPower, slot->m_power);
+                }
+
+                if (slot->m_count >= m_attackDetections)
+                {
+                    slot->m_active = true;
+                    slot->m_count = 0;
+                    slot->m_startTime = slot->m_changeTime;
+                    issueEvent(*slot, true, slot->m_startTime);
+                }
+            }
+            else
+            {
+                slot->m_count = 0;
+            }
+        }
+    }
+
+    m_nbDetections++;
+}
+
+void ActivityMonitor::endActivities(qint64 timestamp)
+{
+    for (std::vector<Slot>::iterator slot = m_slots.begin(); slot != m_slots.end(); ++slot)
+    {
+        if (slot->m_active)
+        {
+            issueEvent(*slot, false, timestamp);
+            slot->m_active = false;
+        }
+
+        slot->m_count = 0;
+    }
+}
+
+void ActivityMonitor::issueEvent(const Slot& slot, bool start, qint64 timestamp)
+{
+    Event event;
+    event.m_timestamp = timestamp;
+    event.m_frequency = slot.m_frequency;
+    event.m_channel = slot.m_channel;
+    event.m_start = start;
+    event.m_power = start ? slot.m_power : slot.m_peakPower;
+    event.m_noiseFloor = m_noiseFloor;
+    event.m_duration = start ? 0 : timestamp - slot.m_startTime;
+
+    {
+        QMutexLocker mutexLocker(&m_eventMutex);
+        event.m_sequence = ++m_sequence;
+        m_events.push_back(event);
+
+        if (m_events.size() > m_maxEvents) {
+            m_events.pop_front();
+        }
+    }
+
+    if (m_guiMessageQueue) {
+        m_guiMessageQueue->push(MsgActivity::create(event));
+    }
+}
@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Channel activity monitor                                                      //
+//                                                                               //
+// Energy detection of the channels of a raster across the whole baseband so     //
+// that demodulators can be started only on the active channels. One FFT per     //
+// block of samples is shared by all the channel slots: the power of each slot   //
+// is the difference of two prefix sums of the bin powers thus the cost does     //
+// not depend on the number of slots. A slot becomes active when it stays above  //
+// the threshold over the noise floor for the attack time and inactive when it   //
+// stays below the threshold minus the hysteresis for the hold time. Start and   //
+// stop events are timestamped, posted to the message queue to the GUI and kept  //
+// in a ring for the web API.                                                    //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_ACTIVITYMONITOR_H_
+#define SDRBASE_DSP_ACTIVITYMONITOR_H_
+
+#include <vector>
+#include <deque>
+
+#include <QMutex>
+
+#include "dsp/basebandsamplesink.h"
+#include "dsp/fftwindow.h"
+#include "util/message.h"
+#include "export.h"
+
+class FFTEngine;
+
+class SDRBASE_API ActivityMonitor : public BasebandSampleSink {
+public:
+    struct Settings
+    {
+        qint64 m_rasterOrigin;    //!< Hz. The slots are centered on m_rasterOrigin + k * m_channelSpacing
+        int m_channelSpacing;     //!< Hz
+        int m_channelBandwidth;   //!< Hz integrated in the slot power
+        int m_nbChannels;         //!< k from 0 to m_nbChannels - 1. 0 for all the slots in the usable band
+        float m_usableBandwidth;  //!< central fraction of the sample rate where slots are placed (filter roll off)
+        int m_fftSize;            //!< power of two
+        int m_nbAverages;         //!< FFTs averaged per detection
+        float m_threshold;        //!< dB over the noise floor to start
+        float m_hysteresis;       //!< dB under the threshold to stop
+        int m_attackTime;         //!< ms over the threshold before the start event
+        int m_holdTime;           //!< ms under the stop level before the stop event
+        FFTWindow::Function m_window;
+
+        Settings();
+        void resetToDefaults();
+    };
+
+    struct Event
+    {
+        quint64 m_sequence;       //!< from 1
+        qint64 m_timestamp;       //!< ms since epoch of the start or stop of the activity
+        qint64 m_frequency;       //!< Hz. Slot center
+        int m_channel;            //!< k of the raster
+        bool m_start;
+        float m_power;            //!< dB. Start level or peak of the activity for stop events
+        float m_noiseFloor;       //!< dB
+        qint64 m_duration;        //!< ms of the activity for stop events
+    };
+
+    struct Slot
+    {
+        qint64 m_frequency;
+        int m_channel;
+        int m_firstBin;
+        int m_lastBin;            //!< included
+        bool m_active;
+        int m_count;              //!< consecutive detections against the current state
+        qint64 m_changeTime;      //!< ms since epoch of the first of these detections
+        qint64 m_startTime;
+        float m_power;            //!< dB of the last detection
+        float m_peakPower;
+    };
+
+    struct Report
+    {
+        int m_sampleRate;
+        qint64 m_centerFrequency;
+        unsigned int m_nbSlots;
+        unsigned int m_nbActive;
+        float m_noiseFloor;       //!< dB per bin of the last detection
+        quint64 m_nbDetections;
+        double m_detectionTime;   //!< average us of processing per detection
+        double m_load;            //!< processing time over the signal time
+    };
+
+    /** Posted to the message queue to the GUI for each start or stop */
+    class SDRBASE_API MsgActivity : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        const Event& getEvent() const { return m_event; }
+
+        static MsgActivity* create(const Event& event)
+        {
+            return new MsgActivity(event);
+        }
+
+    private:
+        Event m_event;
+
+        MsgActivity(const Event& event) :
+            Message(),
+            m_event(event)
+        { }
+    };
+
+    ActivityMonitor();
+    virtual ~ActivityMonitor();
+
+    /** Starts monitoring. Fails if the settings are wrong */
+    bool startMonitor(const Settings& settings);
+    /** Stops monitoring. Stop events are issued for the active slots */
+    void stopMonitor();
+    bool isMonitoring() const { return m_monitoring; }
+    Settings getSettings();
+    void getReport(Report& report);
+    /** Slots of the current baseband with their state */
+    void getSlots(std::vector<Slot>& slots);
+
+    /** Events after sequence (at most maxEvents). Never blocks. Returns the sequence of the last event issued */
+    quint64 getEvents(quint64 sequence, std::vector<Event>& events, unsigned int maxEvents);
+
+    virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+    virtual void start();
+    virtual void stop();
+    virtual bool handleMessage(const Message& message);
+
+private:
+    // processing side. Guarded by m_mutex
+    QMutex m_mutex;
+    volatile bool m_monitoring;
+    Settings m_settings;
+    int m_sampleRate;
+    qint64 m_centerFrequency;
+    FFTEngine *m_fft;
+    FFTWindow m_window;
+    std::vector<Complex> m_samples;
+    int m_sampleIndex;
+    int m_averageIndex;
+    std::vector<Real> m_power;      //!< negative frequencies first
+    std::vector<double> m_prefix;   //!< m_prefix[i] sum of m_power up to i excluded
+    std::vector<Real> m_sorted;     //!< scratch of the noise floor median
+    std::vector<Slot> m_slots;
+    int m_attackDetections;
+    int m_holdDetections;
+    float m_noiseFloor;
+    quint64 m_nbDetections;
+    qint64 m_processNsecs;
+    quint64 m_processedSamples;
+
+    // events. Guarded by m_eventMutex
+    QMutex m_eventMutex;
+    std::deque<Event> m_events;
+    quint64 m_sequence;
+
+    static const unsigned int m_maxEvents = 4096;
+    static const Real m_mult;
+
+    static bool validate(const Settings& settings);
+    void plan();
+    void endActivities(qint64 timestamp);
+    void detect(qint64 timestamp);
+    void issueEvent(const Slot& slot, bool start, qint64 timestamp);
+};
+
+#endif /* SDRBASE_DSP_ACTIVITYMONITOR_H_ */
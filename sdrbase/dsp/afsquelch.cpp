@@ -15,6 +15,11 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>
+
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+#include <emmintrin.h>
+#endif
+
 #include "dsp/afsquelch.h"
 
 #undef M_PI
@@ -140,12 +145,42 @@ bool AFSquelch::analyze(double sample)
 }
 
 
+int AFSquelch::analyze(const Real *samples, int nbSamples, bool& result)
+{
+    result = false;
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        if (analyze(samples[i]))
+        {
+            result = true;
+            return i + 1;
+        }
+    }
+
+    return nbSamples;
+}
+
+
 void AFSquelch::feedback(double in)
 {
 	double t;
+    unsigned int j = 0;
 
-	// feedback for each tone
-    for (unsigned int j = 0; j < m_nTones; ++j)
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+    // feedback for 2 tones at once
+    __m128d vin = _mm_set1_pd(in);
+
+    for (; j + 1 < m_nTones; j += 2)
+    {
+        __m128d vu0 = _mm_loadu_pd(&m_u0[j]);
+        _mm_storeu_pd(&m_u0[j], _mm_sub_pd(_mm_add_pd(vin, _mm_mul_pd(_mm_loadu_pd(&m_coef[j]), vu0)), _mm_loadu_pd(&m_u1[j])));
+        _mm_storeu_pd(&m_u1[j], vu0);
+    }
+#endif
+
+	// feedback for each remaining tone
+    for (; j < m_nTones; ++j)
 	{
 		t = m_u0[j];
 		m_u0[j] = in + (m_coef[j] * m_u0[j]) - m_u1[j];
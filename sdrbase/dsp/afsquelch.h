@@ -45,6 +45,9 @@ public:
     // analyze a sample set and optionally filter
     // the tone frequencies.
     bool analyze(double sample); // input signal sample
+    // analyze a span of samples up to the next result.
+    // returns the number of samples consumed and sets result if the last one gave a result
+    int analyze(const Real *samples, int nbSamples, bool& result);
     bool evaluate(); // evaluate result
 
     // get the tone set
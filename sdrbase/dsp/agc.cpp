@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include "dsp/agc.h"
+#include "dsp/blockkernels.h"
 
 #include "util/stepfunctions.h"
 
@@ -97,7 +98,38 @@ void MagAGC::feed(Complex& ci)
 
 double MagAGC::feedAndGetValue(const Complex& ci)
 {
-    m_magsq = ci.real()*ci.real() + ci.imag()*ci.imag();
+    return feedMagSq(ci.real()*ci.real() + ci.imag()*ci.imag());
+}
+
+void MagAGC::feed(Complex *samples, int nbSamples)
+{
+    Real values[BlockKernels::m_chunkSize];
+
+    for (int start = 0; start < nbSamples; start += BlockKernels::m_chunkSize)
+    {
+        int n = std::min(nbSamples - start, (int) BlockKernels::m_chunkSize);
+        feedAndGetValues(&samples[start], values, n);
+        BlockKernels::multiply(&samples[start], values, n);
+    }
+}
+
+void MagAGC::feedAndGetValues(const Complex *samples, Real *values, int nbSamples, Real *stepValues)
+{
+    BlockKernels::magSq(samples, values, nbSamples); // magnitudes squared are replaced by the values
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        values[i] = feedMagSq(values[i]);
+
+        if (stepValues) {
+            stepValues[i] = getStepValue();
+        }
+    }
+}
+
+double MagAGC::feedMagSq(double magsq)
+{
+    m_magsq = magsq;
     m_moving_average.feed(m_magsq);
 
     if (m_clamping)
@@ -43,6 +43,8 @@ public:
 	void setOrder(double R);
 	virtual void feed(Complex& ci);
     double feedAndGetValue(const Complex& ci);
+    void feed(Complex *samples, int nbSamples); //!< apply the AGC to a span of samples
+    void feedAndGetValues(const Complex *samples, Real *values, int nbSamples, Real *stepValues = 0); //!< AGC values (and optionally step values) of a span of samples
     double getMagSq() const { return m_magsq; }
     void setThreshold(double threshold) { m_threshold = threshold; }
     void setThresholdEnable(bool enable);
@@ -69,6 +71,8 @@ private:
     bool m_clamping;       //!< clamping active
     double m_R2;           //!< square of ordered magnitude
     double m_clampMax;     //!< maximum to clamp to as power value
+
+    double feedMagSq(double magsq);
 };
 
 template<uint32_t AvgSize>
@@ -2,6 +2,8 @@
 
 MESSAGE_CLASS_DEFINITION(BasebandSampleSink::MsgThreadedSink, Message)
 
+static thread_local uint64_t feedTimestamp = 0;
+
 BasebandSampleSink::BasebandSampleSink() :
     m_guiMessageQueue(0)
 {
@@ -12,6 +14,16 @@ BasebandSampleSink::~BasebandSampleSink()
 {
 }
 
+uint64_t BasebandSampleSink::getFeedTimestamp()
+{
+    return feedTimestamp;
+}
+
+void BasebandSampleSink::setFeedTimestamp(uint64_t timestamp)
+{
+    feedTimestamp = timestamp;
+}
+
 void BasebandSampleSink::handleInputMessages()
 {
 	Message* message;
@@ -62,6 +62,23 @@ public:
     virtual void setMessageQueueToGUI(MessageQueue *queue) { m_guiMessageQueue = queue; }
     MessageQueue *getMessageQueueToGUI() { return m_guiMessageQueue; }
 
+    /** Arrival time (TimeUtil::steadyus) of the latest samples of the block being fed in the calling thread.
+     *  It follows the samples through the sample FIFOs so that the channels can date their audio. 0 if unknown */
+    static uint64_t getFeedTimestamp();
+    static void setFeedTimestamp(uint64_t timestamp);
+
+    /** Sets the feed timestamp of the calling thread for its lifetime and clears it on exit
+     *  so that samples written outside of a feed are not dated with a stale arrival time */
+    class FeedTimestampGuard
+    {
+    public:
+        explicit FeedTimestampGuard(uint64_t timestamp) { setFeedTimestamp(timestamp); }
+        ~FeedTimestampGuard() { setFeedTimestamp(0); }
+    private:
+        FeedTimestampGuard(const FeedTimestampGuard&);
+        FeedTimestampGuard& operator=(const FeedTimestampGuard&);
+    };
+
 protected:
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     MessageQueue *m_guiMessageQueue;  //!< Input message queue to the GUI
@@ -0,0 +1,234 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <algorithm>
+
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+#include <emmintrin.h>
+#endif
+
+#include "dsp/blockprojector.h"
+#include "blockkernels.h"
+
+void BlockKernels::magSq(const Complex *samples, Real *magsq, int nbSamples, Real scale)
+{
+    const Real *iq = reinterpret_cast<const Real*>(samples);
+    int i = 0;
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+    const __m128 vscale = _mm_set1_ps(scale);
+
+    for (; i < nbSamples - 3; i += 4)
+    {
+        __m128 lo = _mm_loadu_ps(&iq[2*i]);   // re0 im0 re1 im1
+        __m128 hi = _mm_loadu_ps(&iq[2*i+4]); // re2 im2 re3 im3
+        lo = _mm_mul_ps(lo, lo);
+        hi = _mm_mul_ps(hi, hi);
+        __m128 sum = _mm_add_ps(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)));
+        _mm_storeu_ps(&magsq[i], _mm_mul_ps(sum, vscale));
+    }
+#endif
+    for (; i < nbSamples; i++) {
+        magsq[i] = (iq[2*i]*iq[2*i] + iq[2*i+1]*iq[2*i+1]) * scale;
+    }
+}
+
+void BlockKernels::sumPeak(const Real *values, int nbSamples, double& sum, Real& peak)
+{
+    int i = 0;
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+    if (nbSamples >= 4)
+    {
+        __m128 vsum = _mm_setzero_ps();
+        __m128 vpeak = _mm_set1_ps(peak);
+
+        for (; i < nbSamples - 3; i += 4)
+        {
+            __m128 v = _mm_loadu_ps(&values[i]);
+            vsum = _mm_add_ps(vsum, v);
+            vpeak = _mm_max_ps(vpeak, v);
+        }
+
+        float s[4], p[4];
+        _mm_storeu_ps(s, vsum);
+        _mm_storeu_ps(p, vpeak);
+        sum += (double) s[0] + s[1] + s[2] + s[3];
+        peak = std::max(std::max(p[0], p[1]), std::max(p[2], p[3]));
+    }
+#endif
+    for (; i < nbSamples; i++)
+    {
+        sum += values[i];
+        peak = values[i] > peak ? values[i] : peak;
+    }
+}
+
+void BlockKernels::multiply(Complex *samples, const Real *gains, int nbSamples)
+{
+    int i = 0;
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+    Real *iq = reinterpret_cast<Real*>(samples);
+
+    for (; i < nbSamples - 1; i += 2)
+    {
+        __m128 g = _mm_set_ps(gains[i+1], gains[i+1], gains[i], gains[i]);
+        _mm_storeu_ps(&iq[2*i], _mm_mul_ps(_mm_loadu_ps(&iq[2*i]), g));
+    }
+#endif
+    for (; i < nbSamples; i++) {
+        samples[i] *= gains[i];
+    }
+}
+
+void BlockKernels::deinterleave(const Complex *samples, Real *re, Real *im, int nbSamples)
+{
+    const Real *iq = reinterpret_cast<const Real*>(samples);
+    int i = 0;
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+    for (; i < nbSamples - 3; i += 4)
+    {
+        __m128 lo = _mm_loadu_ps(&iq[2*i]);
+        __m128 hi = _mm_loadu_ps(&iq[2*i+4]);
+        _mm_storeu_ps(&re[i], _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(&im[i], _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+#endif
+    for (; i < nbSamples; i++)
+    {
+        re[i] = iq[2*i];
+        im[i] = iq[2*i+1];
+    }
+}
+
+void BlockKernels::fmDiscriminator(const Complex *samples, Real *demod, int nbSamples, Real& prevArg, Real fmScaling)
+{
+    Real re[m_chunkSize], im[m_chunkSize], arg[m_chunkSize];
+
+    for (int start = 0; start < nbSamples; start += m_chunkSize)
+    {
+        int n = std::min(nbSamples - start, (int) m_chunkSize);
+        deinterleave(&samples[start], re, im, n);
+        BlockProjector::atan2(im, re, arg, n);
+        Real *out = &demod[start];
+
+        out[0] = (arg[0] - prevArg) * (Real) M_1_PI;
+
+        for (int i = 1; i < n; i++) {
+            out[i] = (arg[i] - arg[i-1]) * (Real) M_1_PI;
+        }
+
+        for (int i = 0; i < n; i++)
+        {
+            Real fmDev = out[i] + (out[i] < -1.0f ? 2.0f : out[i] > 1.0f ? -2.0f : 0.0f);
+            out[i] = fmDev * fmScaling;
+        }
+
+        prevArg = arg[n-1];
+    }
+}
+
+void BlockKernels::phaseDiscriminator(const Complex *samples, Real *demod, int nbSamples, Complex& prevSample, Real fmScaling)
+{
+    Real re[m_chunkSize], im[m_chunkSize], dRe[m_chunkSize], dIm[m_chunkSize];
+
+    for (int start = 0; start < nbSamples; start += m_chunkSize)
+    {
+        int n = std::min(nbSamples - start, (int) m_chunkSize);
+        deinterleave(&samples[start], re, im, n);
+        Real pRe = prevSample.real();
+        Real pIm = prevSample.imag();
+
+        for (int i = 0; i < n; i++) // conj(previous) * current
+        {
+            dRe[i] = pRe*re[i] + pIm*im[i];
+            dIm[i] = pRe*im[i] - pIm*re[i];
+            pRe = re[i];
+            pIm = im[i];
+        }
+
+        BlockProjector::atan2(dIm, dRe, &demod[start], n);
+        Real scale = fmScaling * (Real) M_1_PI;
+
+        for (int i = 0; i < n; i++) {
+            demod[start + i] *= scale;
+        }
+
+        prevSample = samples[start + n - 1];
+    }
+}
+
+MagSqLevels::MagSqLevels(int averageSize) :
+    m_index(0),
+    m_sum(0.0),
+    m_levelSum(0.0),
+    m_levelPeak(0.0f),
+    m_levelCount(0),
+    m_storedAvg(1e-12),
+    m_storedPeak(1e-12)
+{
+    resize(averageSize);
+}
+
+void MagSqLevels::resize(int averageSize)
+{
+    m_history.assign(averageSize < 1 ? 1 : averageSize, 0.0f);
+    m_index = 0;
+    m_sum = 0.0;
+}
+
+void MagSqLevels::feed(const Complex *samples, Real *magsq, Real *average, int nbSamples, Real scale)
+{
+    BlockKernels::magSq(samples, magsq, nbSamples, scale);
+    accumulate(magsq, nbSamples);
+    double size = m_history.size();
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        Real& oldest = m_history[m_index];
+        m_sum += magsq[i] - oldest;
+        oldest = magsq[i];
+        m_index = m_index < m_history.size() - 1 ? m_index + 1 : 0;
+
+        if (average) {
+            average[i] = m_sum / size;
+        }
+    }
+}
+
+void MagSqLevels::accumulate(const Real *magsq, int nbSamples)
+{
+    BlockKernels::sumPeak(magsq, nbSamples, m_levelSum, m_levelPeak);
+    m_levelCount += nbSamples;
+}
+
+void MagSqLevels::getLevels(double& avg, double& peak, int& nbSamples)
+{
+    if (m_levelCount > 0)
+    {
+        m_storedAvg = m_levelSum / m_levelCount;
+        m_storedPeak = m_levelPeak;
+    }
+
+    avg = m_storedAvg;
+    peak = m_storedPeak;
+    nbSamples = m_levelCount == 0 ? 1 : m_levelCount;
+
+    m_levelSum = 0.0;
+    m_levelPeak = 0.0f;
+    m_levelCount = 0;
+}
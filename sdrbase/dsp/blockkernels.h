@@ -0,0 +1,98 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Block kernels shared by the demodulators                                      //
+//                                                                               //
+// They process a span of channel samples at once in float using SSE2 when       //
+// available so that the demodulators per sample loops are reduced to the parts  //
+// that depend on the previous sample (squelch gates, delay lines, audio).       //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_BLOCKKERNELS_H_
+#define SDRBASE_DSP_BLOCKKERNELS_H_
+
+#include <vector>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+class SDRBASE_API BlockKernels
+{
+public:
+    /** magsq[i] = |samples[i]|^2 * scale */
+    static void magSq(const Complex *samples, Real *magsq, int nbSamples, Real scale = 1.0f);
+    /** Add the values to sum and raise peak to the largest value */
+    static void sumPeak(const Real *values, int nbSamples, double& sum, Real& peak);
+    /** samples[i] *= gains[i] */
+    static void multiply(Complex *samples, const Real *gains, int nbSamples);
+    /** Split complex samples in real and imaginary parts */
+    static void deinterleave(const Complex *samples, Real *re, Real *im, int nbSamples);
+
+    /**
+     * Frequency by derivation of the phase (phaseDiscriminatorDelta) over a span of samples.
+     * prevArg is the phase of the sample before the span and is updated with the last one.
+     */
+    static void fmDiscriminator(const Complex *samples, Real *demod, int nbSamples, Real& prevArg, Real fmScaling);
+    /**
+     * Phase of the product of each sample by the conjugate of the previous one (phaseDiscriminator) over a span of samples.
+     * prevSample is the sample before the span and is updated with the last one.
+     */
+    static void phaseDiscriminator(const Complex *samples, Real *demod, int nbSamples, Complex& prevSample, Real fmScaling);
+
+    static const int m_chunkSize = 256; //!< size of the scratch arrays on the stack
+};
+
+/**
+ * Magnitude squared of channel samples with its moving average for the squelch
+ * and its average and peak for the channel power report.
+ */
+class SDRBASE_API MagSqLevels
+{
+public:
+    MagSqLevels(int averageSize);
+
+    void resize(int averageSize);
+    void reset() { resize(m_history.size()); } //!< clear the moving average
+    /**
+     * Scaled magnitude squared of a span of samples in magsq and its moving average in average (may be null).
+     * Both are accumulated for the power report.
+     */
+    void feed(const Complex *samples, Real *magsq, Real *average, int nbSamples, Real scale);
+    /** Accumulate magnitude squared values for the power report only */
+    void accumulate(const Real *magsq, int nbSamples);
+    void accumulate(Real magsq)
+    {
+        m_levelSum += magsq;
+        m_levelPeak = magsq > m_levelPeak ? magsq : m_levelPeak;
+        m_levelCount++;
+    }
+
+    Real getAverage() const { return m_sum / m_history.size(); } //!< moving average at the last sample
+    /** Average and peak since the last call. Levels of the previous call are kept if there was no sample */
+    void getLevels(double& avg, double& peak, int& nbSamples);
+
+private:
+    std::vector<Real> m_history;
+    unsigned int m_index;
+    double m_sum;        //!< sum of the moving average history
+    double m_levelSum;
+    Real m_levelPeak;
+    int m_levelCount;
+    double m_storedAvg;
+    double m_storedPeak;
+};
+
+#endif /* SDRBASE_DSP_BLOCKKERNELS_H_ */
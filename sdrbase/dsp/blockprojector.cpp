@@ -0,0 +1,354 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <string.h>
+#include <float.h>
+
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+#include <emmintrin.h>
+#endif
+
+#include "blockprojector.h"
+
+// atan(a) for a in [0..1] (Abramowitz and Stegun 4.4.49 kind of polynomial, max error 1e-5 rad)
+#define BLOCKPROJECTOR_ATAN_C1   0.99997726f
+#define BLOCKPROJECTOR_ATAN_C3  -0.33262347f
+#define BLOCKPROJECTOR_ATAN_C5   0.19354346f
+#define BLOCKPROJECTOR_ATAN_C7  -0.11643287f
+#define BLOCKPROJECTOR_ATAN_C9   0.05265332f
+#define BLOCKPROJECTOR_ATAN_C11 -0.01172120f
+
+// log(1+f) for f in [sqrt(1/2)-1..sqrt(2)-1] (Cephes logf polynomial)
+#define BLOCKPROJECTOR_LOG_P0  7.0376836292E-2f
+#define BLOCKPROJECTOR_LOG_P1 -1.1514610310E-1f
+#define BLOCKPROJECTOR_LOG_P2  1.1676998740E-1f
+#define BLOCKPROJECTOR_LOG_P3 -1.2420140846E-1f
+#define BLOCKPROJECTOR_LOG_P4  1.4249322787E-1f
+#define BLOCKPROJECTOR_LOG_P5 -1.6668057665E-1f
+#define BLOCKPROJECTOR_LOG_P6  2.0000714765E-1f
+#define BLOCKPROJECTOR_LOG_P7 -2.4999993993E-1f
+#define BLOCKPROJECTOR_LOG_P8  3.3333331174E-1f
+
+static inline Real fastAtan2(Real y, Real x)
+{
+    Real ax = fabsf(x);
+    Real ay = fabsf(y);
+    Real mx = ax > ay ? ax : ay;
+    Real a = (ax > ay ? ay : ax) / (mx > FLT_MIN ? mx : FLT_MIN);
+    Real s = a*a;
+    Real r = (((((BLOCKPROJECTOR_ATAN_C11*s + BLOCKPROJECTOR_ATAN_C9)*s + BLOCKPROJECTOR_ATAN_C7)*s
+        + BLOCKPROJECTOR_ATAN_C5)*s + BLOCKPROJECTOR_ATAN_C3)*s + BLOCKPROJECTOR_ATAN_C1)*a;
+
+    if (ay > ax) {
+        r = (Real) M_PI_2 - r;
+    }
+    if (x < 0) {
+        r = (Real) M_PI - r;
+    }
+
+    return y < 0 ? -r : r;
+}
+
+static inline Real fastLog10(Real x)
+{
+    quint32 bits;
+    x = x > FLT_MIN ? x : FLT_MIN;
+    memcpy(&bits, &x, sizeof(bits));
+    int e = (int) (bits >> 23) - 127;
+    bits = (bits & 0x007fffff) | 0x3f800000; // mantissa in [1..2[
+    Real m;
+    memcpy(&m, &bits, sizeof(m));
+
+    if (m > (Real) M_SQRT2)
+    {
+        m *= 0.5f;
+        e++;
+    }
+
+    Real f = m - 1.0f;
+    Real z = f*f;
+    Real p = ((((((((BLOCKPROJECTOR_LOG_P0*f + BLOCKPROJECTOR_LOG_P1)*f + BLOCKPROJECTOR_LOG_P2)*f + BLOCKPROJECTOR_LOG_P3)*f
+        + BLOCKPROJECTOR_LOG_P4)*f + BLOCKPROJECTOR_LOG_P5)*f + BLOCKPROJECTOR_LOG_P6)*f + BLOCKPROJECTOR_LOG_P7)*f + BLOCKPROJECTOR_LOG_P8);
+    Real ln = f + f*z*p - 0.5f*z + e * (Real) M_LN2;
+    return ln * (Real) M_LOG10E;
+}
+
+BlockProjector::BlockProjector() :
+    m_prevArg(0.0f)
+{
+    clearProjections();
+}
+
+BlockProjector::~BlockProjector()
+{
+}
+
+void BlockProjector::clearProjections()
+{
+    for (int i = 0; i < (int) Projector::nbProjectionTypes; i++) {
+        m_needed[i] = false;
+    }
+}
+
+void BlockProjector::addProjection(Projector::ProjectionType projectionType)
+{
+    if ((projectionType < 0) || (projectionType >= Projector::nbProjectionTypes)) {
+        return;
+    }
+
+    m_needed[(int) projectionType] = true;
+
+    if (projectionType == Projector::ProjectionMagDB) { // power statistics are linear
+        m_needed[(int) Projector::ProjectionMagSq] = true;
+    }
+}
+
+const Real *BlockProjector::getProjection(Projector::ProjectionType projectionType) const
+{
+    if (projectionType == Projector::ProjectionReal) {
+        return m_re.data();
+    } else if (projectionType == Projector::ProjectionImag) {
+        return m_im.data();
+    } else {
+        return m_projections[(int) projectionType].data();
+    }
+}
+
+void BlockProjector::run(const Sample *samples, int nbSamples)
+{
+    if (nbSamples <= 0) {
+        return;
+    }
+
+    if ((int) m_re.size() < nbSamples)
+    {
+        m_re.resize(nbSamples);
+        m_im.resize(nbSamples);
+    }
+
+    for (int i = 0; i < (int) Projector::nbProjectionTypes; i++)
+    {
+        if (m_needed[i] && ((int) m_projections[i].size() < nbSamples)) {
+            m_projections[i].resize(nbSamples);
+        }
+    }
+
+    deinterleave(samples, nbSamples);
+    const Real *re = m_re.data();
+    const Real *im = m_im.data();
+
+    if (m_needed[(int) Projector::ProjectionMagSq] || m_needed[(int) Projector::ProjectionMagLin])
+    {
+        Real *magsq = m_projections[(int) Projector::ProjectionMagSq].data();
+
+        if (!m_needed[(int) Projector::ProjectionMagSq]) { // MagLin only
+            magsq = m_projections[(int) Projector::ProjectionMagLin].data();
+        }
+
+        for (int i = 0; i < nbSamples; i++) {
+            magsq[i] = re[i]*re[i] + im[i]*im[i];
+        }
+
+        if (m_needed[(int) Projector::ProjectionMagLin])
+        {
+            Real *magLin = m_projections[(int) Projector::ProjectionMagLin].data();
+            int i = 0;
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+            for (; i < nbSamples - 3; i += 4) {
+                _mm_storeu_ps(&magLin[i], _mm_sqrt_ps(_mm_loadu_ps(&magsq[i])));
+            }
+#endif
+            for (; i < nbSamples; i++) {
+                magLin[i] = sqrtf(magsq[i]);
+            }
+        }
+
+        if (m_needed[(int) Projector::ProjectionMagDB])
+        {
+            Real *magDB = m_projections[(int) Projector::ProjectionMagDB].data();
+            log10(magsq, magDB, nbSamples);
+
+            for (int i = 0; i < nbSamples; i++) {
+                magDB[i] *= 10.0f;
+            }
+        }
+    }
+
+    bool needArg = false;
+
+    for (int i = (int) Projector::ProjectionPhase; i <= (int) Projector::Projection16PSK; i++) {
+        needArg = needArg || m_needed[i];
+    }
+
+    if (!needArg) {
+        return;
+    }
+
+    if ((int) m_arg.size() < nbSamples) {
+        m_arg.resize(nbSamples);
+    }
+
+    Real *arg = m_arg.data();
+    atan2(im, re, arg, nbSamples);
+
+    if (m_needed[(int) Projector::ProjectionPhase])
+    {
+        Real *phase = m_projections[(int) Projector::ProjectionPhase].data();
+
+        for (int i = 0; i < nbSamples; i++) {
+            phase[i] = arg[i] * (Real) M_1_PI;
+        }
+    }
+
+    if (m_needed[(int) Projector::ProjectionDPhase])
+    {
+        Real *dPhase = m_projections[(int) Projector::ProjectionDPhase].data();
+        dPhase[0] = (arg[0] - m_prevArg) * (Real) M_1_PI;
+
+        for (int i = 1; i < nbSamples; i++) {
+            dPhase[i] = (arg[i] - arg[i-1]) * (Real) M_1_PI;
+        }
+
+        for (int i = 0; i < nbSamples; i++) {
+            dPhase[i] += dPhase[i] < -1.0f ? 2.0f : dPhase[i] > 1.0f ? -2.0f : 0.0f;
+        }
+
+        m_prevArg = arg[nbSamples-1];
+    }
+
+    for (int t = (int) Projector::ProjectionBPSK; t <= (int) Projector::Projection16PSK; t++)
+    {
+        if (m_needed[t])
+        {
+            Real *psk = m_projections[t].data();
+
+            for (int i = 0; i < nbSamples; i++) {
+                psk[i] = Projector::estimatePSK((Projector::ProjectionType) t, arg[i]);
+            }
+        }
+    }
+}
+
+void BlockProjector::deinterleave(const Sample *samples, int nbSamples)
+{
+    Real *re = m_re.data();
+    Real *im = m_im.data();
+    int i = 0;
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+    const __m128 scale = _mm_set1_ps(1.0f / SDR_RX_SCALEF);
+
+    for (; i < nbSamples - 3; i += 4) // 4 samples
+    {
+#ifdef SDR_RX_SAMPLE_24BIT
+        __m128 lo = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*) &samples[i]));
+        __m128 hi = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*) &samples[i+2]));
+#else
+        __m128i v = _mm_loadu_si128((const __m128i*) &samples[i]);
+        __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16)); // sign extend
+        __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16));
+#endif
+        _mm_storeu_ps(&re[i], _mm_mul_ps(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)), scale));
+        _mm_storeu_ps(&im[i], _mm_mul_ps(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)), scale));
+    }
+#endif
+    for (; i < nbSamples; i++)
+    {
+        re[i] = samples[i].m_real / SDR_RX_SCALEF;
+        im[i] = samples[i].m_imag / SDR_RX_SCALEF;
+    }
+}
+
+void BlockProjector::atan2(const Real *y, const Real *x, Real *out, int n)
+{
+    int i = 0;
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 minMax = _mm_set1_ps(FLT_MIN);
+    const __m128 pi = _mm_set1_ps((Real) M_PI);
+    const __m128 pi2 = _mm_set1_ps((Real) M_PI_2);
+
+    for (; i < n - 3; i += 4)
+    {
+        __m128 vy = _mm_loadu_ps(&y[i]);
+        __m128 vx = _mm_loadu_ps(&x[i]);
+        __m128 ax = _mm_and_ps(vx, absMask);
+        __m128 ay = _mm_and_ps(vy, absMask);
+        __m128 a = _mm_div_ps(_mm_min_ps(ax, ay), _mm_max_ps(_mm_max_ps(ax, ay), minMax));
+        __m128 s = _mm_mul_ps(a, a);
+        __m128 r = _mm_set1_ps(BLOCKPROJECTOR_ATAN_C11);
+        r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(BLOCKPROJECTOR_ATAN_C9));
+        r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(BLOCKPROJECTOR_ATAN_C7));
+        r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(BLOCKPROJECTOR_ATAN_C5));
+        r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(BLOCKPROJECTOR_ATAN_C3));
+        r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(BLOCKPROJECTOR_ATAN_C1));
+        r = _mm_mul_ps(r, a);
+        __m128 swap = _mm_cmpgt_ps(ay, ax);
+        r = _mm_or_ps(_mm_and_ps(swap, _mm_sub_ps(pi2, r)), _mm_andnot_ps(swap, r));
+        __m128 negx = _mm_cmplt_ps(vx, zero);
+        r = _mm_or_ps(_mm_and_ps(negx, _mm_sub_ps(pi, r)), _mm_andnot_ps(negx, r));
+        r = _mm_xor_ps(r, _mm_and_ps(_mm_cmplt_ps(vy, zero), signMask));
+        _mm_storeu_ps(&out[i], r);
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = fastAtan2(y[i], x[i]);
+    }
+}
+
+void BlockProjector::log10(const Real *x, Real *out, int n)
+{
+    int i = 0;
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+    const __m128 minNormal = _mm_set1_ps(FLT_MIN);
+    const __m128i mantissaMask = _mm_set1_epi32(0x007fffff);
+    const __m128i one = _mm_set1_epi32(0x3f800000);
+    const __m128 sqrt2 = _mm_set1_ps((Real) M_SQRT2);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 fone = _mm_set1_ps(1.0f);
+
+    for (; i < n - 3; i += 4)
+    {
+        __m128i xi = _mm_castps_si128(_mm_max_ps(_mm_loadu_ps(&x[i]), minNormal));
+        __m128i e = _mm_sub_epi32(_mm_srli_epi32(xi, 23), _mm_set1_epi32(127));
+        __m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(xi, mantissaMask), one)); // [1..2[
+        __m128 big = _mm_cmpgt_ps(m, sqrt2);
+        m = _mm_or_ps(_mm_and_ps(big, _mm_mul_ps(m, half)), _mm_andnot_ps(big, m));
+        e = _mm_add_epi32(e, _mm_srli_epi32(_mm_castps_si128(big), 31));
+        __m128 f = _mm_sub_ps(m, fone);
+        __m128 z = _mm_mul_ps(f, f);
+        __m128 p = _mm_set1_ps(BLOCKPROJECTOR_LOG_P0);
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(BLOCKPROJECTOR_LOG_P1));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(BLOCKPROJECTOR_LOG_P2));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(BLOCKPROJECTOR_LOG_P3));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(BLOCKPROJECTOR_LOG_P4));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(BLOCKPROJECTOR_LOG_P5));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(BLOCKPROJECTOR_LOG_P6));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(BLOCKPROJECTOR_LOG_P7));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(BLOCKPROJECTOR_LOG_P8));
+        __m128 ln = _mm_add_ps(f, _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(f, z), p), _mm_mul_ps(half, z)));
+        ln = _mm_add_ps(ln, _mm_mul_ps(_mm_cvtepi32_ps(e), _mm_set1_ps((Real) M_LN2)));
+        _mm_storeu_ps(&out[i], _mm_mul_ps(ln, _mm_set1_ps((Real) M_LOG10E)));
+    }
+#endif
+    for (; i < n; i++) {
+        out[i] = fastLog10(x[i]);
+    }
+}
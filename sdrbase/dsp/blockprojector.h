@@ -0,0 +1,65 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Projections of a block of samples                                             //
+//                                                                               //
+// The samples are split once in normalized real and imaginary arrays then each  //
+// projection needed by the scope traces and triggers is computed once for the   //
+// whole block in its own array. Magnitudes, arguments and logarithms use SSE2   //
+// when available. Arguments and logarithms are fast approximations (1e-5 rad    //
+// and 1e-4 dB) that are plenty for display and triggering.                      //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_BLOCKPROJECTOR_H_
+#define SDRBASE_DSP_BLOCKPROJECTOR_H_
+
+#include <vector>
+
+#include "dsp/dsptypes.h"
+#include "dsp/projector.h"
+#include "export.h"
+
+class SDRBASE_API BlockProjector
+{
+public:
+    BlockProjector();
+    ~BlockProjector();
+
+    void clearProjections(); //!< no projection is needed
+    void addProjection(Projector::ProjectionType projectionType);
+    bool hasProjection(Projector::ProjectionType projectionType) const { return m_needed[(int) projectionType]; }
+    void resetPhase() { m_prevArg = 0.0f; } //!< restart the phase derivative
+
+    /** Compute the needed projections of a block of samples */
+    void run(const Sample *samples, int nbSamples);
+    /** Projection of the last block. Valid until the next run */
+    const Real *getProjection(Projector::ProjectionType projectionType) const;
+
+    static void atan2(const Real *y, const Real *x, Real *out, int n); //!< out in radians
+    static void log10(const Real *x, Real *out, int n);
+
+private:
+    bool m_needed[(int) Projector::nbProjectionTypes];
+    std::vector<Real> m_re;
+    std::vector<Real> m_im;
+    std::vector<Real> m_arg;
+    std::vector<Real> m_projections[(int) Projector::nbProjectionTypes];
+    Real m_prevArg;
+
+    void deinterleave(const Sample *samples, int nbSamples);
+};
+
+#endif /* SDRBASE_DSP_BLOCKPROJECTOR_H_ */
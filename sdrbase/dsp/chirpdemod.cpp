@@ -0,0 +1,239 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <math.h>
+
+#include "dsp/fftengine.h"
+#include "chirpdemod.h"
+
+const unsigned int ChirpDemod::m_minSpreadFactor = 7;
+const unsigned int ChirpDemod::m_maxSpreadFactor = 12;
+const unsigned int ChirpDemod::m_minPreambleSymbols = 4;
+const unsigned int ChirpDemod::m_maxFrameSymbols = 1024;
+
+ChirpDemod::ChirpDemod(unsigned int spreadFactor) :
+    m_spreadFactor(0),
+    m_nbSymbolSamples(0),
+    m_fft(FFTEngine::create()),
+    m_squelch(10.0f),
+    m_nbSymbols(0)
+{
+    setSpreadFactor(spreadFactor);
+}
+
+ChirpDemod::~ChirpDemod()
+{
+    delete m_fft;
+}
+
+void ChirpDemod::setSpreadFactor(unsigned int spreadFactor)
+{
+    spreadFactor = std::min(std::max(spreadFactor, m_minSpreadFactor), m_maxSpreadFactor);
+
+    if (spreadFactor != m_spreadFactor)
+    {
+        m_spreadFactor = spreadFactor;
+        m_nbSymbolSamples = 1 << spreadFactor;
+        modulate(m_spreadFactor, 0, false, m_upChirp);
+        m_downChirp.resize(m_nbSymbolSamples);
+
+        for (unsigned int i = 0; i < m_nbSymbolSamples; i++) {
+            m_downChirp[i] = std::conj(m_upChirp[i]);
+        }
+
+        m_window.resize(m_nbSymbolSamples);
+        m_dechirped.assign(m_nbSymbolSamples, Complex{0.0f, 0.0f});
+        m_magsq.resize(m_nbSymbolSamples);
+        m_fft->configure(m_nbSymbolSamples, false);
+    }
+
+    reset();
+}
+
+void ChirpDemod::reset()
+{
+    m_state = StateSearch;
+    m_fill = 0;
+    m_skip = 0;
+    m_preambleBin = 0;
+    m_preambleCount = 0;
+    m_misses = 0;
+    m_lastSymbol = 0;
+    m_lastSNR = 0.0f;
+    m_frame.clear();
+}
+
+void ChirpDemod::modulate(unsigned int spreadFactor, unsigned int symbol, bool down, std::vector<Complex>& samples)
+{
+    unsigned int nbSymbolSamples = 1 << spreadFactor;
+    samples.resize(nbSymbolSamples);
+
+    // Instantaneous frequency of the base up chirp goes from -B/2 to +B/2 over the symbol.
+    // The symbol value is a cyclic shift of the base chirp i.e. a frequency offset once dechirped.
+    for (unsigned int i = 0; i < nbSymbolSamples; i++)
+    {
+        double n = (i + symbol) % nbSymbolSamples;
+        double phi = M_PI * ((n * n) / nbSymbolSamples - n);
+        samples[i] = Complex(cos(phi), down ? -sin(phi) : sin(phi));
+    }
+}
+
+void ChirpDemod::process(const Complex *samples, unsigned int nbSamples)
+{
+    unsigned int i = 0;
+
+    while (i < nbSamples)
+    {
+        if (m_skip > 0)
+        {
+            unsigned int n = std::min(m_skip, nbSamples - i);
+            m_skip -= n;
+            i += n;
+            continue;
+        }
+
+        unsigned int n = std::min(m_nbSymbolSamples - m_fill, nbSamples - i);
+        std::copy(samples + i, samples + i + n, m_window.begin() + m_fill);
+        m_fill += n;
+        i += n;
+
+        if (m_fill == m_nbSymbolSamples)
+        {
+            processSymbol();
+            m_fill = 0;
+        }
+    }
+}
+
+void ChirpDemod::takeFrames(std::vector<Frame>& frames)
+{
+    frames.clear();
+    frames.swap(m_frames);
+}
+
+unsigned int ChirpDemod::dechirp(const std::vector<Complex>& chirp, float& snr)
+{
+    Complex *in = m_fft->in();
+
+    for (unsigned int i = 0; i < m_nbSymbolSamples; i++) {
+        in[i] = m_window[i] * chirp[i];
+    }
+
+    std::copy(in, in + m_nbSymbolSamples, m_dechirped.begin());
+    m_fft->transform();
+    const Complex *out = m_fft->out();
+    Real total = 0.0f;
+
+    for (unsigned int i = 0; i < m_nbSymbolSamples; i++)
+    {
+        m_magsq[i] = out[i].real()*out[i].real() + out[i].imag()*out[i].imag();
+        total += m_magsq[i];
+    }
+
+    unsigned int bin = std::max_element(m_magsq.begin(), m_magsq.end()) - m_magsq.begin();
+    Real noise = (total - m_magsq[bin]) / (m_nbSymbolSamples - 1);
+    snr = noise == 0.0f ? 1e9f : m_magsq[bin] / noise;
+
+    return bin;
+}
+
+unsigned int ChirpDemod::binDistance(unsigned int binA, unsigned int binB) const
+{
+    unsigned int d = (binA - binB) & (m_nbSymbolSamples - 1);
+    return std::min(d, m_nbSymbolSamples - d);
+}
+
+void ChirpDemod::processSymbol()
+{
+    float snr;
+    unsigned int bin = dechirp(m_downChirp, snr);
+    m_nbSymbols++;
+    m_lastSymbol = bin;
+    m_lastSNR = snr;
+
+    switch (m_state)
+    {
+    case StateSearch:
+        if (snr < m_squelch)
+        {
+            m_preambleCount = 0;
+        }
+        else if ((m_preambleCount > 0) && (binDistance(bin, m_preambleBin) <= 1))
+        {
+            if (++m_preambleCount == m_minPreambleSymbols)
+            {
+                // A window starting k samples late sees the preamble up chirps in bin k.
+                // Drop N-k samples so that the next window starts on a chirp boundary.
+                m_skip = (m_nbSymbolSamples - bin) & (m_nbSymbolSamples - 1);
+                m_misses = 0;
+                m_state = StatePreamble;
+            }
+        }
+        else
+        {
+            m_preambleCount = 1;
+            m_preambleBin = bin;
+        }
+        break;
+    case StatePreamble:
+        if ((snr >= m_squelch) && (binDistance(bin, 0) <= 1))
+        {
+            m_misses = 0;
+        }
+        else
+        {
+            float sfdSNR;
+            dechirp(m_upChirp, sfdSNR);
+
+            if (sfdSNR >= m_squelch) {
+                m_state = StateSFD;
+            } else if (++m_misses > 1) {
+                reset();
+            }
+        }
+        break;
+    case StateSFD:
+        // second down chirp then quarter down chirp before data
+        m_skip = m_nbSymbolSamples / 4;
+        m_frame.clear();
+        m_state = StateData;
+        break;
+    case StateData:
+        if (snr < m_squelch)
+        {
+            endFrame();
+        }
+        else
+        {
+            m_frame.push_back(bin);
+
+            if (m_frame.size() >= m_maxFrameSymbols) {
+                endFrame();
+            }
+        }
+        break;
+    }
+}
+
+void ChirpDemod::endFrame()
+{
+    if (m_frame.size() > 0) {
+        m_frames.push_back(m_frame);
+    }
+
+    reset();
+}
@@ -0,0 +1,112 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Chirp spread spectrum (LoRa like) symbol demodulator.                         //
+//                                                                               //
+// Input is at one sample per chip i.e. at the chirp bandwidth rate. Samples are //
+// cut in symbol windows of 2^SF samples that are dechirped with a precomputed   //
+// chirp table and transformed with one FFT per symbol. The symbol is the index  //
+// of the FFT magnitude peak.                                                    //
+//                                                                               //
+// Frame synchronization:                                                        //
+// - search: wait for a few consecutive identical symbols (preamble up chirps)   //
+//   then shift the window so that preamble symbols fall in bin 0                //
+// - preamble: wait for the first down chirp (start frame delimiter)             //
+// - SFD: skip the second down chirp and the extra quarter symbol                //
+// - data: collect symbols until the peak to noise ratio drops below squelch     //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_CHIRPDEMOD_H_
+#define SDRBASE_DSP_CHIRPDEMOD_H_
+
+#include <vector>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+class FFTEngine;
+
+class SDRBASE_API ChirpDemod
+{
+public:
+    typedef std::vector<unsigned short> Frame;
+
+    enum State
+    {
+        StateSearch,
+        StatePreamble,
+        StateSFD,
+        StateData
+    };
+
+    ChirpDemod(unsigned int spreadFactor = 8);
+    ~ChirpDemod();
+
+    void setSpreadFactor(unsigned int spreadFactor); //!< 7 to 12. Resets the demodulator.
+    void setSquelch(float squelch) { m_squelch = squelch; } //!< minimum peak to average noise power ratio
+    void reset();
+
+    /** Process samples at one sample per chip. Completed frames are queued. */
+    void process(const Complex *samples, unsigned int nbSamples);
+    /** Move the frames completed so far into frames */
+    void takeFrames(std::vector<Frame>& frames);
+
+    /** Upchirp of symbol value at one sample per chip. Used to generate test signals. */
+    static void modulate(unsigned int spreadFactor, unsigned int symbol, bool down, std::vector<Complex>& samples);
+
+    unsigned int getSpreadFactor() const { return m_spreadFactor; }
+    unsigned int getNbSymbolSamples() const { return m_nbSymbolSamples; }
+    State getState() const { return m_state; }
+    unsigned int getLastSymbol() const { return m_lastSymbol; }
+    float getLastSNR() const { return m_lastSNR; }
+    quint64 getNbSymbols() const { return m_nbSymbols; }   //!< number of FFT windows processed
+    const Complex *getDechirped() const { return m_dechirped.data(); } //!< last dechirped window
+
+    static const unsigned int m_minSpreadFactor;
+    static const unsigned int m_maxSpreadFactor;
+
+private:
+    void processSymbol();
+    unsigned int dechirp(const std::vector<Complex>& chirp, float& snr);
+    unsigned int binDistance(unsigned int binA, unsigned int binB) const;
+    void endFrame();
+
+    unsigned int m_spreadFactor;
+    unsigned int m_nbSymbolSamples;
+    std::vector<Complex> m_downChirp;  //!< conjugate of base up chirp: dechirps up chirps
+    std::vector<Complex> m_upChirp;    //!< base up chirp: dechirps down chirps (SFD)
+    std::vector<Complex> m_window;     //!< current symbol window
+    std::vector<Complex> m_dechirped;  //!< last dechirped window
+    std::vector<Real> m_magsq;
+    FFTEngine *m_fft;
+
+    State m_state;
+    unsigned int m_fill;      //!< samples in current window
+    unsigned int m_skip;      //!< samples to drop before next window (alignment)
+    unsigned int m_preambleBin;
+    unsigned int m_preambleCount;
+    unsigned int m_misses;
+    unsigned int m_lastSymbol;
+    float m_lastSNR;
+    float m_squelch;
+    quint64 m_nbSymbols;
+    Frame m_frame;
+    std::vector<Frame> m_frames;
+
+    static const unsigned int m_minPreambleSymbols;
+    static const unsigned int m_maxFrameSymbols;
+};
+
+#endif /* SDRBASE_DSP_CHIRPDEMOD_H_ */
@@ -5,6 +5,11 @@
  *      Author: f4exb
  */
 #include <math.h>
+
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+#include <emmintrin.h>
+#endif
+
 #include "dsp/ctcssdetector.h"
 
 #undef M_PI
@@ -138,9 +143,22 @@ bool CTCSSDetector::analyze(Real *sample)
 void CTCSSDetector::feedback(Real in)
 {
 	Real t;
+	int j = 0;
 
-	// feedback for each tone
-	for (int j = 0; j < nTones; ++j)
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+	// feedback for 4 tones at once
+	__m128 vin = _mm_set1_ps(in);
+
+	for (; j < nTones - 3; j += 4)
+	{
+		__m128 vu0 = _mm_loadu_ps(&u0[j]);
+		_mm_storeu_ps(&u0[j], _mm_sub_ps(_mm_add_ps(vin, _mm_mul_ps(_mm_loadu_ps(&coef[j]), vu0)), _mm_loadu_ps(&u1[j])));
+		_mm_storeu_ps(&u1[j], vu0);
+	}
+#endif
+
+	// feedback for each remaining tone
+	for (; j < nTones; ++j)
 	{
 		t = u0[j];
 		u0[j] = in + (coef[j] * u0[j]) - u1[j];
@@ -19,6 +19,7 @@
 
 #include "dsp/dsptypes.h"
 #include "dsp/inthalfbandfiltereo.h"
+#include "dsp/decimatorsconv.h"
 
 #define DECIMATORS_HB_FILTER_ORDER 64
 
@@ -455,16 +456,7 @@ private:
 template<typename StorageType, typename T, uint SdrBits, uint InputBits>
 void Decimators<StorageType, T, SdrBits, InputBits>::decimate1(SampleVector::iterator* it, const T* buf, qint32 len)
 {
-	qint32 xreal, yimag;
-
-	for (int pos = 0; pos < len - 1; pos += 2)
-	{
-		xreal = buf[pos+0];
-		yimag = buf[pos+1];
-		(**it).setReal(xreal << decimation_shifts<SdrBits, InputBits>::pre1); // Valgrind optim (2 - comment not repeated)
-		(**it).setImag(yimag << decimation_shifts<SdrBits, InputBits>::pre1);
-		++(*it); // Valgrind optim (comment not repeated)
-	}
+    DecimatorsConv<T, decimation_shifts<SdrBits, InputBits>::pre1>::convert(it, buf, len);
 }
 
 template<typename StorageType, typename T, uint SdrBits, uint InputBits>
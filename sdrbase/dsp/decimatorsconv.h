@@ -0,0 +1,163 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Bulk conversion of interleaved I/Q device samples to the internal Sample      //
+// format. This is what the decimators run when no decimation is required        //
+// (decimate1). SSE2 kernels are provided for the most common device formats:    //
+// - 8 bit unsigned with offset (RTL-SDR)                                        //
+// - 12 or 16 bit signed in 16 bit words (Airspy, LimeSDR, XTRX, SoapySDR)       //
+// - 32 bit float (SoapySDR)                                                     //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_DECIMATORSCONV_H_
+#define SDRBASE_DSP_DECIMATORSCONV_H_
+
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+#include <emmintrin.h>
+#endif
+
+#include "dsp/dsptypes.h"
+
+/** Generic (scalar) conversion. PreShift is the left shift to bring input bits to SDR bits */
+template<typename T, uint PreShift, int Shift = 0>
+struct DecimatorsConv
+{
+    static void convert(SampleVector::iterator* it, const T* buf, qint32 len)
+    {
+        qint32 xreal, yimag;
+
+        for (int pos = 0; pos < len - 1; pos += 2)
+        {
+            xreal = buf[pos+0] - Shift;
+            yimag = buf[pos+1] - Shift;
+            (**it).setReal(xreal << PreShift);
+            (**it).setImag(yimag << PreShift);
+            ++(*it);
+        }
+    }
+};
+
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+
+/** Store 8 signed 16 bit values (4 I/Q pairs) into Samples */
+template<uint PreShift>
+inline void decimatorsConvStore4(Sample *out, __m128i v)
+{
+#ifdef SDR_RX_SAMPLE_24BIT
+    __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16); // sign extend to 32 bits
+    __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+    _mm_storeu_si128((__m128i*) &out[0], _mm_slli_epi32(lo, PreShift));
+    _mm_storeu_si128((__m128i*) &out[2], _mm_slli_epi32(hi, PreShift));
+#else
+    _mm_storeu_si128((__m128i*) out, _mm_slli_epi16(v, PreShift));
+#endif
+}
+
+/** 8 bit unsigned input with offset (RTL-SDR): 16 bytes (8 I/Q pairs) per iteration */
+template<uint PreShift, int Shift>
+struct DecimatorsConv<quint8, PreShift, Shift>
+{
+    static void convert(SampleVector::iterator* it, const quint8* buf, qint32 len)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i shift = _mm_set1_epi16(Shift);
+        int pos = 0;
+
+        for (; pos < len - 15; pos += 16)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*) &buf[pos]);
+            Sample *out = &(**it);
+            decimatorsConvStore4<PreShift>(&out[0], _mm_sub_epi16(_mm_unpacklo_epi8(v, zero), shift));
+            decimatorsConvStore4<PreShift>(&out[4], _mm_sub_epi16(_mm_unpackhi_epi8(v, zero), shift));
+            (*it) += 8;
+        }
+
+        qint32 xreal, yimag;
+
+        for (; pos < len - 1; pos += 2)
+        {
+            xreal = buf[pos+0] - Shift;
+            yimag = buf[pos+1] - Shift;
+            (**it).setReal(xreal << PreShift);
+            (**it).setImag(yimag << PreShift);
+            ++(*it);
+        }
+    }
+};
+
+/** 12 or 16 bit signed input in 16 bit words: 8 words (4 I/Q pairs) per iteration */
+template<uint PreShift, int Shift>
+struct DecimatorsConv<qint16, PreShift, Shift>
+{
+    static void convert(SampleVector::iterator* it, const qint16* buf, qint32 len)
+    {
+        const __m128i shift = _mm_set1_epi16(Shift);
+        int pos = 0;
+
+        for (; pos < len - 7; pos += 8)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*) &buf[pos]);
+            decimatorsConvStore4<PreShift>(&(**it), _mm_sub_epi16(v, shift));
+            (*it) += 4;
+        }
+
+        qint32 xreal, yimag;
+
+        for (; pos < len - 1; pos += 2)
+        {
+            xreal = buf[pos+0] - Shift;
+            yimag = buf[pos+1] - Shift;
+            (**it).setReal(xreal << PreShift);
+            (**it).setImag(yimag << PreShift);
+            ++(*it);
+        }
+    }
+};
+
+#endif // USE_SSE2
+
+/** 32 bit float input in [-1.0, 1.0] range. Output saturates instead of wrapping. */
+struct DecimatorsConvF
+{
+    static void convert(SampleVector::iterator* it, const float* buf, qint32 len)
+    {
+        int pos = 0;
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+        const __m128 scale = _mm_set1_ps(SDR_RX_SCALEF);
+
+        for (; pos < len - 7; pos += 8)
+        {
+            __m128i a = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(&buf[pos]), scale));
+            __m128i b = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(&buf[pos+4]), scale));
+            Sample *out = &(**it);
+#ifdef SDR_RX_SAMPLE_24BIT
+            _mm_storeu_si128((__m128i*) &out[0], a);
+            _mm_storeu_si128((__m128i*) &out[2], b);
+#else
+            _mm_storeu_si128((__m128i*) out, _mm_packs_epi32(a, b));
+#endif
+            (*it) += 4;
+        }
+#endif
+        for (; pos < len - 1; pos += 2)
+        {
+            (**it).setReal(buf[pos+0] * SDR_RX_SCALEF);
+            (**it).setImag(buf[pos+1] * SDR_RX_SCALEF);
+            ++(*it);
+        }
+    }
+};
+
+#endif /* SDRBASE_DSP_DECIMATORSCONV_H_ */
@@ -15,19 +15,11 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include "decimatorsfi.h"
+#include "decimatorsconv.h"
 
 void DecimatorsFI::decimate1(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
 {
-    float xreal, yimag;
-
-    for (int pos = 0; pos < nbIAndQ - 1; pos += 2)
-    {
-        xreal = buf[pos+0];
-        yimag = buf[pos+1];
-        (**it).setReal(xreal * SDR_RX_SCALEF);
-        (**it).setImag(yimag * SDR_RX_SCALEF);
-        ++(*it); // Valgrind optim (comment not repeated)
-    }
+    DecimatorsConvF::convert(it, buf, nbIAndQ);
 }
 
 void DecimatorsFI::decimate2_cen(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
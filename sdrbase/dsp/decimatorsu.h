@@ -24,153 +24,8 @@
 #define INCLUDE_GPL_DSP_DECIMATORSU_H_
 
 #include "dsp/dsptypes.h"
-#include "dsp/inthalfbandfiltereo.h"
-
-#define DECIMATORS_HB_FILTER_ORDER 64
-
-template<uint SdrBits, uint InputBits>
-struct decimation_shifts
-{
-    static const uint pre1   = 0;
-    static const uint pre2   = 0;
-    static const uint post2  = 0;
-    static const uint pre4   = 0;
-    static const uint post4  = 0;
-    static const uint pre8   = 0;
-    static const uint post8  = 0;
-    static const uint pre16  = 0;
-    static const uint post16 = 0;
-    static const uint pre32  = 0;
-    static const uint post32 = 0;
-    static const uint pre64  = 0;
-    static const uint post64 = 0;
-};
-
-template<>
-struct decimation_shifts<24, 24>
-{
-    static const uint pre1   = 0;
-    static const uint pre2   = 0;
-    static const uint post2  = 1;
-    static const uint pre4   = 0;
-    static const uint post4  = 2;
-    static const uint pre8   = 0;
-    static const uint post8  = 3;
-    static const uint pre16  = 0;
-    static const uint post16 = 4;
-    static const uint pre32  = 0;
-    static const uint post32 = 5;
-    static const uint pre64  = 0;
-    static const uint post64 = 6;
-};
-
-template<>
-struct decimation_shifts<16, 16>
-{
-    static const uint pre1   = 0;
-    static const uint pre2   = 0;
-    static const uint post2  = 1;
-    static const uint pre4   = 0;
-    static const uint post4  = 2;
-    static const uint pre8   = 0;
-    static const uint post8  = 3;
-    static const uint pre16  = 0;
-    static const uint post16 = 4;
-    static const uint pre32  = 0;
-    static const uint post32 = 5;
-    static const uint pre64  = 0;
-    static const uint post64 = 6;
-};
-
-template<>
-struct decimation_shifts<24, 16>
-{
-    static const uint pre1   = 8;
-    static const uint pre2   = 7;
-    static const uint post2  = 0;
-    static const uint pre4   = 6;
-    static const uint post4  = 0;
-    static const uint pre8   = 5;
-    static const uint post8  = 0;
-    static const uint pre16  = 4;
-    static const uint post16 = 0;
-    static const uint pre32  = 3;
-    static const uint post32 = 0;
-    static const uint pre64  = 2;
-    static const uint post64 = 0;
-};
-
-template<>
-struct decimation_shifts<16, 12>
-{
-    static const uint pre1   = 4;
-    static const uint pre2   = 3;
-    static const uint post2  = 0;
-    static const uint pre4   = 2;
-    static const uint post4  = 0;
-    static const uint pre8   = 1;
-    static const uint post8  = 0;
-    static const uint pre16  = 0;
-    static const uint post16 = 0;
-    static const uint pre32  = 0;
-    static const uint post32 = 1;
-    static const uint pre64  = 0;
-    static const uint post64 = 2;
-};
-
-template<>
-struct decimation_shifts<24, 12>
-{
-    static const uint pre1   = 12;
-    static const uint pre2   = 11;
-    static const uint post2  = 0;
-    static const uint pre4   = 10;
-    static const uint post4  = 0;
-    static const uint pre8   = 9;
-    static const uint post8  = 0;
-    static const uint pre16  = 8;
-    static const uint post16 = 0;
-    static const uint pre32  = 7;
-    static const uint post32 = 0;
-    static const uint pre64  = 6;
-    static const uint post64 = 0;
-};
-
-template<>
-struct decimation_shifts<16, 8>
-{
-    static const uint pre1   = 8;
-    static const uint pre2   = 7;
-    static const uint post2  = 0;
-    static const uint pre4   = 6;
-    static const uint post4  = 0;
-    static const uint pre8   = 5;
-    static const uint post8  = 0;
-    static const uint pre16  = 4;
-    static const uint post16 = 0;
-    static const uint pre32  = 3;
-    static const uint post32 = 0;
-    static const uint pre64  = 2;
-    static const uint post64 = 0;
-};
-
-template<>
-struct decimation_shifts<24, 8>
-{
-    static const uint pre1   = 16;
-    static const uint pre2   = 15;
-    static const uint post2  = 0;
-    static const uint pre4   = 14;
-    static const uint post4  = 0;
-    static const uint pre8   = 13;
-    static const uint post8  = 0;
-    static const uint pre16  = 12;
-    static const uint post16 = 0;
-    static const uint pre32  = 11;
-    static const uint post32 = 0;
-    static const uint pre64  = 10;
-    static const uint post64 = 0;
-};
+#include "dsp/decimators.h" // decimation_shifts
+#include "dsp/decimatorsconv.h"
 
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift>
 class DecimatorsU
@@ -218,16 +73,7 @@ private:
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift>
 void DecimatorsU<StorageType, T, SdrBits, InputBits, Shift>::decimate1(SampleVector::iterator* it, const T* buf, qint32 len)
 {
-	qint32 xreal, yimag;
-
-	for (int pos = 0; pos < len - 1; pos += 2)
-	{
-		xreal = buf[pos+0] - Shift;
-		yimag = buf[pos+1] - Shift;
-		(**it).setReal(xreal << decimation_shifts<SdrBits, InputBits>::pre1); // Valgrind optim (2 - comment not repeated)
-		(**it).setImag(yimag << decimation_shifts<SdrBits, InputBits>::pre1);
-		++(*it); // Valgrind optim (comment not repeated)
-	}
+    DecimatorsConv<T, decimation_shifts<SdrBits, InputBits>::pre1, Shift>::convert(it, buf, len);
 }
 
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, int Shift>
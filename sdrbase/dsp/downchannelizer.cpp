@@ -18,11 +18,13 @@
 #include <dsp/downchannelizer.h>
 #include "dsp/inthalfbandfilter.h"
 #include "dsp/dspcommands.h"
+#include "dsp/dsplog.h"
 
 #include <QString>
 #include <QDebug>
 
 MESSAGE_CLASS_DEFINITION(DownChannelizer::MsgChannelizerNotification, Message)
+MESSAGE_CLASS_DEFINITION(DownChannelizer::MsgApplyConfiguration, Message)
 
 DownChannelizer::DownChannelizer(BasebandSampleSink* sampleSink) :
 	m_sampleSink(sampleSink),
@@ -30,7 +32,9 @@ DownChannelizer::DownChannelizer(BasebandSampleSink* sampleSink) :
 	m_requestedOutputSampleRate(0),
 	m_requestedCenterFrequency(0),
 	m_currentOutputSampleRate(0),
-	m_currentCenterFrequency(0)
+	m_currentCenterFrequency(0),
+	m_held(false),
+	m_dirty(false)
 {
 	QString name = "DownChannelizer(" + m_sampleSink->objectName() + ")";
 	setObjectName(name);
@@ -41,6 +45,18 @@ DownChannelizer::~DownChannelizer()
 	freeFilterChain();
 }
 
+bool DownChannelizer::holdConfiguration()
+{
+	QMutexLocker mutexLocker(&m_holdMutex);
+
+	if (!m_held) {
+		return false;
+	}
+
+	m_dirty = true;
+	return true;
+}
+
 void DownChannelizer::configure(MessageQueue* messageQueue, int sampleRate, int centerFrequency)
 {
 	Message* cmd = new DSPConfigureChannelizer(sampleRate, centerFrequency);
@@ -94,7 +110,7 @@ void DownChannelizer::start()
 {
 	if (m_sampleSink != 0)
 	{
-		qDebug() << "DownChannelizer::start: thread: " << thread()
+		qCDebug(dspLog) << "DownChannelizer::start: thread: " << thread()
 				<< " m_inputSampleRate: " << m_inputSampleRate
 				<< " m_requestedOutputSampleRate: " << m_requestedOutputSampleRate
 				<< " m_requestedCenterFrequency: " << m_requestedCenterFrequency;
@@ -116,8 +132,11 @@ bool DownChannelizer::handleMessage(const Message& cmd)
 	{
 		DSPSignalNotification& notif = (DSPSignalNotification&) cmd;
 		m_inputSampleRate = notif.getSampleRate();
-		qDebug() << "DownChannelizer::handleMessage: DSPSignalNotification: m_inputSampleRate: " << m_inputSampleRate;
-		applyConfiguration();
+		qCDebug(dspLog) << "DownChannelizer::handleMessage: DSPSignalNotification: m_inputSampleRate: " << m_inputSampleRate;
+
+		if (!holdConfiguration()) {
+			applyConfiguration();
+		}
 
 		if (m_sampleSink != 0)
 		{
@@ -134,22 +153,51 @@ bool DownChannelizer::handleMessage(const Message& cmd)
 		m_requestedOutputSampleRate = chan.getSampleRate();
 		m_requestedCenterFrequency = chan.getCenterFrequency();
 
-		qDebug() << "DownChannelizer::handleMessage: DSPConfigureChannelizer:"
+		qCDebug(dspLog) << "DownChannelizer::handleMessage: DSPConfigureChannelizer:"
 				<< " m_requestedOutputSampleRate: " << m_requestedOutputSampleRate
 				<< " m_requestedCenterFrequency: " << m_requestedCenterFrequency;
 
-		applyConfiguration();
+		if (!holdConfiguration()) {
+			applyConfiguration();
+		}
+
+		return true;
+	}
+	else if (DSPHoldChannelizers::match(cmd))
+	{
+		DSPHoldChannelizers& hold = (DSPHoldChannelizers&) cmd;
+		QMutexLocker mutexLocker(&m_holdMutex);
+		m_held = hold.getHold();
+
+		qCDebug(dspLog) << "DownChannelizer::handleMessage: DSPHoldChannelizers:"
+				<< " m_held: " << m_held
+				<< " m_dirty: " << m_dirty;
+
+		if (!m_held && m_dirty)
+		{
+			// applied in the channelizer thread after the configurations already queued so that the latest one is used
+			m_dirty = false;
+			getInputMessageQueue()->push(MsgApplyConfiguration::create());
+		}
+
+		return true;
+	}
+	else if (MsgApplyConfiguration::match(cmd))
+	{
+		if (!holdConfiguration()) {
+			applyConfiguration();
+		}
 
 		return true;
 	}
     else if (BasebandSampleSink::MsgThreadedSink::match(cmd))
     {
-        qDebug() << "DownChannelizer::handleMessage: MsgThreadedSink: forwarded to demod";
+        qCDebug(dspLog) << "DownChannelizer::handleMessage: MsgThreadedSink: forwarded to demod";
         return m_sampleSink->handleMessage(cmd); // this message is passed to the demod
     }
 	else
 	{
-        qDebug() << "DownChannelizer::handleMessage: " << cmd.getIdentifier() << " unhandled";
+        qCDebug(dspLog) << "DownChannelizer::handleMessage: " << cmd.getIdentifier() << " unhandled";
 	    return false;
 	}
 }
@@ -158,7 +206,7 @@ void DownChannelizer::applyConfiguration()
 {
 	if (m_inputSampleRate == 0)
 	{
-		qDebug() << "DownChannelizer::applyConfiguration: m_inputSampleRate=0 aborting";
+		qCDebug(dspLog) << "DownChannelizer::applyConfiguration: m_inputSampleRate=0 aborting";
 		return;
 	}
 
@@ -176,7 +224,7 @@ void DownChannelizer::applyConfiguration()
 
 	m_currentOutputSampleRate = m_inputSampleRate / (1 << m_filterStages.size());
 
-	qDebug() << "DownChannelizer::applyConfiguration in=" << m_inputSampleRate
+	qCDebug(dspLog) << "DownChannelizer::applyConfiguration in=" << m_inputSampleRate
 			<< ", req=" << m_requestedOutputSampleRate
 			<< ", out=" << m_currentOutputSampleRate
 			<< ", fc=" << m_currentCenterFrequency;
@@ -239,7 +287,7 @@ DownChannelizer::FilterStage::~FilterStage()
 
 bool DownChannelizer::signalContainsChannel(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd) const
 {
-	//qDebug("   testing signal [%f, %f], channel [%f, %f]", sigStart, sigEnd, chanStart, chanEnd);
+	//qCDebug(dspLog, "   testing signal [%f, %f], channel [%f, %f]", sigStart, sigEnd, chanStart, chanEnd);
 	if(sigEnd <= sigStart)
 		return false;
 	if(chanEnd <= chanStart)
@@ -295,23 +343,23 @@ void DownChannelizer::freeFilterChain()
 
 void DownChannelizer::debugFilterChain()
 {
-    qDebug("DownChannelizer::debugFilterChain: %lu stages", m_filterStages.size());
+    qCDebug(dspLog, "DownChannelizer::debugFilterChain: %lu stages", m_filterStages.size());
 
     for(FilterStages::iterator it = m_filterStages.begin(); it != m_filterStages.end(); ++it)
     {
         switch ((*it)->m_mode)
         {
         case FilterStage::ModeCenter:
-            qDebug("DownChannelizer::debugFilterChain: center %s", (*it)->m_sse ? "sse" : "no_sse");
+            qCDebug(dspLog, "DownChannelizer::debugFilterChain: center %s", (*it)->m_sse ? "sse" : "no_sse");
             break;
         case FilterStage::ModeLowerHalf:
-            qDebug("DownChannelizer::debugFilterChain: lower %s", (*it)->m_sse ? "sse" : "no_sse");
+            qCDebug(dspLog, "DownChannelizer::debugFilterChain: lower %s", (*it)->m_sse ? "sse" : "no_sse");
             break;
         case FilterStage::ModeUpperHalf:
-            qDebug("DownChannelizer::debugFilterChain: upper %s", (*it)->m_sse ? "sse" : "no_sse");
+            qCDebug(dspLog, "DownChannelizer::debugFilterChain: upper %s", (*it)->m_sse ? "sse" : "no_sse");
             break;
         default:
-            qDebug("DownChannelizer::debugFilterChain: none %s", (*it)->m_sse ? "sse" : "no_sse");
+            qCDebug(dspLog, "DownChannelizer::debugFilterChain: none %s", (*it)->m_sse ? "sse" : "no_sse");
             break;
         }
     }
@@ -68,6 +68,19 @@ public:
 	virtual bool handleMessage(const Message& cmd);
 
 protected:
+    class MsgApplyConfiguration : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        static MsgApplyConfiguration* create()
+        {
+            return new MsgApplyConfiguration();
+        }
+
+    private:
+        MsgApplyConfiguration() : Message() { }
+    };
+
 	struct FilterStage {
 		enum Mode {
 			ModeCenter,
@@ -106,6 +119,11 @@ protected:
 	SampleVector m_sampleBuffer;
 	QMutex m_mutex;
 
+	QMutex m_holdMutex;
+	bool m_held;  //!< reconfigurations are deferred (see DSPHoldChannelizers)
+	bool m_dirty; //!< a reconfiguration was deferred
+
+	bool holdConfiguration();
 	void applyConfiguration();
 	bool signalContainsChannel(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd) const;
 	Real createFilterChain(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd);
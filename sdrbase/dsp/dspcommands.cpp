@@ -45,4 +45,5 @@ MESSAGE_CLASS_DEFINITION(DSPEngineReport, Message)
 MESSAGE_CLASS_DEFINITION(DSPConfigureScopeVis, Message)
 MESSAGE_CLASS_DEFINITION(DSPSignalNotification, Message)
 MESSAGE_CLASS_DEFINITION(DSPConfigureChannelizer, Message)
+MESSAGE_CLASS_DEFINITION(DSPHoldChannelizers, Message)
 MESSAGE_CLASS_DEFINITION(DSPConfigureAudio, Message)
@@ -350,6 +350,21 @@ private:
 	int m_centerFrequency;
 };
 
+class SDRBASE_API DSPHoldChannelizers : public Message {
+	MESSAGE_CLASS_DECLARATION
+
+public:
+	DSPHoldChannelizers(bool hold) :
+		Message(),
+		m_hold(hold)
+	{ }
+
+	bool getHold() const { return m_hold; }
+
+private:
+	bool m_hold; //!< true: defer reconfigurations, false: apply the deferred configuration
+};
+
 class SDRBASE_API DSPConfigureAudio : public Message {
     MESSAGE_CLASS_DECLARATION
 
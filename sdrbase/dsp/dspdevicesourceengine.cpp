@@ -23,6 +23,7 @@
 #include <stdio.h>
 #include <QDebug>
 #include "dsp/dspcommands.h"
+#include "dsp/dsplog.h"
 #include "util/fixed.h"
 #include "samplesinkfifo.h"
 #include "threadedbasebandsamplesink.h"
@@ -34,6 +35,7 @@ DSPDeviceSourceEngine::DSPDeviceSourceEngine(uint uid, QObject* parent) :
 	m_deviceSampleSource(0),
 	m_sampleSourceSequence(0),
 	m_basebandSampleSinks(),
+	m_channelizersHold(0),
 	m_sampleRate(0),
 	m_centerFrequency(0),
 	m_dcOffsetCorrection(false),
@@ -58,20 +60,20 @@ DSPDeviceSourceEngine::~DSPDeviceSourceEngine()
 
 void DSPDeviceSourceEngine::run()
 {
-	qDebug() << "DSPDeviceSourceEngine::run";
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::run";
 	m_state = StIdle;
     exec();
 }
 
 void DSPDeviceSourceEngine::start()
 {
-	qDebug() << "DSPDeviceSourceEngine::start";
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::start";
 	QThread::start();
 }
 
 void DSPDeviceSourceEngine::stop()
 {
-	qDebug() << "DSPDeviceSourceEngine::stop";
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::stop";
     gotoIdle();
     m_state = StNotStarted;
 	QThread::exit();
@@ -81,7 +83,7 @@ void DSPDeviceSourceEngine::stop()
 
 bool DSPDeviceSourceEngine::initAcquisition()
 {
-	qDebug() << "DSPDeviceSourceEngine::initAcquisition";
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::initAcquisition";
 	DSPAcquisitionInit cmd;
 
 	return m_syncMessenger.sendWait(cmd) == StReady;
@@ -89,7 +91,7 @@ bool DSPDeviceSourceEngine::initAcquisition()
 
 bool DSPDeviceSourceEngine::startAcquisition()
 {
-	qDebug() << "DSPDeviceSourceEngine::startAcquisition";
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::startAcquisition";
 	DSPAcquisitionStart cmd;
 
 	return m_syncMessenger.sendWait(cmd) == StRunning;
@@ -97,68 +99,87 @@ bool DSPDeviceSourceEngine::startAcquisition()
 
 void DSPDeviceSourceEngine::stopAcquistion()
 {
-	qDebug() << "DSPDeviceSourceEngine::stopAcquistion";
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::stopAcquistion";
 	DSPAcquisitionStop cmd;
 	m_syncMessenger.storeMessage(cmd);
 	handleSynchronousMessages();
 
 	if(m_dcOffsetCorrection)
 	{
-		qDebug("DC offset:%f,%f", m_iOffset, m_qOffset);
+		qCDebug(dspLog, "DC offset:%f,%f", m_iOffset, m_qOffset);
 	}
 }
 
 void DSPDeviceSourceEngine::setSource(DeviceSampleSource* source)
 {
-	qDebug() << "DSPDeviceSourceEngine::setSource";
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::setSource";
 	DSPSetSource cmd(source);
 	m_syncMessenger.sendWait(cmd);
 }
 
+bool DSPDeviceSourceEngine::setSourceCenterFrequency(qint64 centerFrequency)
+{
+	QMutexLocker mutexLocker(&m_sourceMutex);
+
+	if (m_deviceSampleSource == 0) {
+		return false;
+	}
+
+	m_deviceSampleSource->setCenterFrequency(centerFrequency);
+	return true;
+}
+
 void DSPDeviceSourceEngine::setSourceSequence(int sequence)
 {
-	qDebug("DSPDeviceSourceEngine::setSourceSequence: seq: %d", sequence);
+	qCDebug(dspLog, "DSPDeviceSourceEngine::setSourceSequence: seq: %d", sequence);
 	m_sampleSourceSequence = sequence;
 }
 
 void DSPDeviceSourceEngine::addSink(BasebandSampleSink* sink)
 {
-	qDebug() << "DSPDeviceSourceEngine::addSink: " << sink->objectName().toStdString().c_str();
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::addSink: " << sink->objectName().toStdString().c_str();
 	DSPAddBasebandSampleSink cmd(sink);
 	m_syncMessenger.sendWait(cmd);
 }
 
 void DSPDeviceSourceEngine::removeSink(BasebandSampleSink* sink)
 {
-	qDebug() << "DSPDeviceSourceEngine::removeSink: " << sink->objectName().toStdString().c_str();
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::removeSink: " << sink->objectName().toStdString().c_str();
 	DSPRemoveBasebandSampleSink cmd(sink);
 	m_syncMessenger.sendWait(cmd);
 }
 
 void DSPDeviceSourceEngine::addThreadedSink(ThreadedBasebandSampleSink* sink)
 {
-	qDebug() << "DSPDeviceSourceEngine::addThreadedSink: " << sink->objectName().toStdString().c_str();
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::addThreadedSink: " << sink->objectName().toStdString().c_str();
 	DSPAddThreadedBasebandSampleSink cmd(sink);
 	m_syncMessenger.sendWait(cmd);
 }
 
 void DSPDeviceSourceEngine::removeThreadedSink(ThreadedBasebandSampleSink* sink)
 {
-	qDebug() << "DSPDeviceSourceEngine::removeThreadedSink: " << sink->objectName().toStdString().c_str();
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::removeThreadedSink: " << sink->objectName().toStdString().c_str();
 	DSPRemoveThreadedBasebandSampleSink cmd(sink);
 	m_syncMessenger.sendWait(cmd);
 }
 
+void DSPDeviceSourceEngine::holdChannelizers(bool hold)
+{
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::holdChannelizers: " << hold;
+	DSPHoldChannelizers cmd(hold);
+	m_syncMessenger.sendWait(cmd);
+}
+
 void DSPDeviceSourceEngine::configureCorrections(bool dcOffsetCorrection, bool iqImbalanceCorrection)
 {
-	qDebug() << "DSPDeviceSourceEngine::configureCorrections";
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::configureCorrections";
 	DSPConfigureCorrection* cmd = new DSPConfigureCorrection(dcOffsetCorrection, iqImbalanceCorrection);
 	m_inputMessageQueue.push(cmd);
 }
 
 QString DSPDeviceSourceEngine::errorMessage()
 {
-	qDebug() << "DSPDeviceSourceEngine::errorMessage";
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::errorMessage";
 	DSPGetErrorMessage cmd;
 	m_syncMessenger.sendWait(cmd);
 	return cmd.getErrorMessage();
@@ -166,7 +187,7 @@ QString DSPDeviceSourceEngine::errorMessage()
 
 QString DSPDeviceSourceEngine::sourceDeviceDescription()
 {
-	qDebug() << "DSPDeviceSourceEngine::sourceDeviceDescription";
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::sourceDeviceDescription";
 	DSPGetSourceDeviceDescription cmd;
 	m_syncMessenger.sendWait(cmd);
 	return cmd.getDeviceDescription();
@@ -335,6 +356,7 @@ void DSPDeviceSourceEngine::work()
 		SampleVector::iterator part2begin;
 		SampleVector::iterator part2end;
 
+		BasebandSampleSink::FeedTimestampGuard feedTimestamp(sampleFifo->getWriteTimestamp()); // dates the samples passed to the sinks
 		std::size_t count = sampleFifo->readBegin(sampleFifo->fill(), &part1begin, &part1end, &part2begin, &part2end);
 
 		// first part of FIFO data
@@ -413,7 +435,7 @@ void DSPDeviceSourceEngine::work()
 
 DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoIdle()
 {
-	qDebug() << "DSPDeviceSourceEngine::gotoIdle";
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::gotoIdle";
 
 	switch(m_state) {
 		case StNotStarted:
@@ -485,7 +507,7 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoInit()
 	m_centerFrequency = m_deviceSampleSource->getCenterFrequency();
 	m_sampleRate = m_deviceSampleSource->getSampleRate();
 
-	qDebug() << "DSPDeviceSourceEngine::gotoInit: "
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::gotoInit: "
 	        << " m_deviceDescription: " << m_deviceDescription.toStdString().c_str()
 			<< " sampleRate: " << m_sampleRate
 			<< " centerFrequency: " << m_centerFrequency;
@@ -494,13 +516,13 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoInit()
 
 	for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
 	{
-		qDebug() << "DSPDeviceSourceEngine::gotoInit: initializing " << (*it)->objectName().toStdString().c_str();
+		qCDebug(dspLog) << "DSPDeviceSourceEngine::gotoInit: initializing " << (*it)->objectName().toStdString().c_str();
 		(*it)->handleMessage(notif);
 	}
 
 	for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it)
 	{
-		qDebug() << "DSPDeviceSourceEngine::gotoInit: initializing ThreadedSampleSink(" << (*it)->getSampleSinkObjectName().toStdString().c_str() << ")";
+		qCDebug(dspLog) << "DSPDeviceSourceEngine::gotoInit: initializing ThreadedSampleSink(" << (*it)->getSampleSinkObjectName().toStdString().c_str() << ")";
 		(*it)->handleSinkMessage(notif);
 	}
 
@@ -516,7 +538,7 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoInit()
 
 DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoRunning()
 {
-	qDebug() << "DSPDeviceSourceEngine::gotoRunning";
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::gotoRunning";
 
 	switch(m_state)
     {
@@ -538,7 +560,7 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoRunning()
 		return gotoError("DSPDeviceSourceEngine::gotoRunning: No sample source configured");
 	}
 
-	qDebug() << "DSPDeviceSourceEngine::gotoRunning: " << m_deviceDescription.toStdString().c_str() << " started";
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::gotoRunning: " << m_deviceDescription.toStdString().c_str() << " started";
 
 	// Start everything
 
@@ -549,24 +571,24 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoRunning()
 
 	for(BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++)
 	{
-        qDebug() << "DSPDeviceSourceEngine::gotoRunning: starting " << (*it)->objectName().toStdString().c_str();
+        qCDebug(dspLog) << "DSPDeviceSourceEngine::gotoRunning: starting " << (*it)->objectName().toStdString().c_str();
 		(*it)->start();
 	}
 
 	for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it)
 	{
-		qDebug() << "DSPDeviceSourceEngine::gotoRunning: starting ThreadedSampleSink(" << (*it)->getSampleSinkObjectName().toStdString().c_str() << ")";
+		qCDebug(dspLog) << "DSPDeviceSourceEngine::gotoRunning: starting ThreadedSampleSink(" << (*it)->getSampleSinkObjectName().toStdString().c_str() << ")";
 		(*it)->start();
 	}
 
-	qDebug() << "DSPDeviceSourceEngine::gotoRunning:input message queue pending: " << m_inputMessageQueue.size();
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::gotoRunning:input message queue pending: " << m_inputMessageQueue.size();
 
 	return StRunning;
 }
 
 DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoError(const QString& errorMessage)
 {
-	qDebug() << "DSPDeviceSourceEngine::gotoError: " << errorMessage;
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::gotoError: " << errorMessage;
 
 	m_errorMessage = errorMessage;
 	m_deviceDescription.clear();
@@ -583,16 +605,19 @@ void DSPDeviceSourceEngine::handleSetSource(DeviceSampleSource* source)
 //		disconnect(m_sampleSource->getSampleFifo(), SIGNAL(dataReady()), this, SLOT(handleData()));
 //	}
 
-	m_deviceSampleSource = source;
+	{
+		QMutexLocker mutexLocker(&m_sourceMutex);
+		m_deviceSampleSource = source;
+	}
 
 	if(m_deviceSampleSource != 0)
 	{
-		qDebug("DSPDeviceSourceEngine::handleSetSource: set %s", qPrintable(source->getDeviceDescription()));
+		qCDebug(dspLog, "DSPDeviceSourceEngine::handleSetSource: set %s", qPrintable(source->getDeviceDescription()));
 		connect(m_deviceSampleSource->getSampleFifo(), SIGNAL(dataReady()), this, SLOT(handleData()), Qt::QueuedConnection);
 	}
 	else
 	{
-		qDebug("DSPDeviceSourceEngine::handleSetSource: set none");
+		qCDebug(dspLog, "DSPDeviceSourceEngine::handleSetSource: set none");
 	}
 }
 
@@ -607,7 +632,7 @@ void DSPDeviceSourceEngine::handleData()
 void DSPDeviceSourceEngine::handleSynchronousMessages()
 {
     Message *message = m_syncMessenger.getMessage();
-	qDebug() << "DSPDeviceSourceEngine::handleSynchronousMessages: " << message->getIdentifier();
+	qCDebug(dspLog) << "DSPDeviceSourceEngine::handleSynchronousMessages: " << message->getIdentifier();
 
 	if (DSPAcquisitionInit::match(*message))
 	{
@@ -664,6 +689,12 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 	{
 		ThreadedBasebandSampleSink *threadedSink = ((DSPAddThreadedBasebandSampleSink*) message)->getThreadedSampleSink();
 		m_threadedBasebandSampleSinks.push_back(threadedSink);
+		// a sink added while the channelizers are held is held before its first configuration:
+		if (m_channelizersHold > 0)
+		{
+			DSPHoldChannelizers hold(true);
+			threadedSink->handleSinkMessage(hold);
+		}
 		// initialize sample rate and center frequency in the sink:
 		DSPSignalNotification msg(m_sampleRate, m_centerFrequency);
 		threadedSink->handleSinkMessage(msg);
@@ -678,6 +709,24 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 		threadedSink->stop();
 		m_threadedBasebandSampleSinks.remove(threadedSink);
 	}
+	else if (DSPHoldChannelizers::match(*message))
+	{
+		bool forward;
+
+		// only the first hold and the last release are passed to the sinks
+		if (((DSPHoldChannelizers*) message)->getHold()) {
+			forward = (m_channelizersHold++ == 0);
+		} else {
+			forward = (m_channelizersHold > 0) && (--m_channelizersHold == 0);
+		}
+
+		if (forward)
+		{
+			for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it) {
+				(*it)->handleSinkMessage(*message);
+			}
+		}
+	}
 
 	m_syncMessenger.done(m_state);
 }
@@ -688,7 +737,7 @@ void DSPDeviceSourceEngine::handleInputMessages()
 
 	while ((message = m_inputMessageQueue.pop()) != 0)
 	{
-		qDebug("DSPDeviceSourceEngine::handleInputMessages: message: %s", message->getIdentifier());
+		qCDebug(dspLog, "DSPDeviceSourceEngine::handleInputMessages: message: %s", message->getIdentifier());
 
 		if (DSPConfigureCorrection::match(*message))
 		{
@@ -730,7 +779,7 @@ void DSPDeviceSourceEngine::handleInputMessages()
 			m_sampleRate = notif->getSampleRate();
 			m_centerFrequency = notif->getCenterFrequency();
 
-			qDebug() << "DSPDeviceSourceEngine::handleInputMessages: DSPSignalNotification:"
+			qCDebug(dspLog) << "DSPDeviceSourceEngine::handleInputMessages: DSPSignalNotification:"
 				<< " m_sampleRate: " << m_sampleRate
 				<< " m_centerFrequency: " << m_centerFrequency;
 
@@ -738,20 +787,20 @@ void DSPDeviceSourceEngine::handleInputMessages()
 
 			for(BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++)
 			{
-				qDebug() << "DSPDeviceSourceEngine::handleInputMessages: forward message to " << (*it)->objectName().toStdString().c_str();
+				qCDebug(dspLog) << "DSPDeviceSourceEngine::handleInputMessages: forward message to " << (*it)->objectName().toStdString().c_str();
 				(*it)->handleMessage(*message);
 			}
 
 			for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it)
 			{
-				qDebug() << "DSPDeviceSourceEngine::handleSourceMessages: forward message to ThreadedSampleSink(" << (*it)->getSampleSinkObjectName().toStdString().c_str() << ")";
+				qCDebug(dspLog) << "DSPDeviceSourceEngine::handleSourceMessages: forward message to ThreadedSampleSink(" << (*it)->getSampleSinkObjectName().toStdString().c_str() << ")";
 				(*it)->handleSinkMessage(*message);
 			}
 
 			// forward changes to source GUI input queue
 
 			MessageQueue *guiMessageQueue = m_deviceSampleSource->getMessageQueueToGUI();
-			qDebug("DSPDeviceSourceEngine::handleInputMessages: DSPSignalNotification: guiMessageQueue: %p", guiMessageQueue);
+			qCDebug(dspLog, "DSPDeviceSourceEngine::handleInputMessages: DSPSignalNotification: guiMessageQueue: %p", guiMessageQueue);
 
 			if (guiMessageQueue) {
 			    DSPSignalNotification* rep = new DSPSignalNotification(*notif); // make a copy for the source GUI
@@ -62,12 +62,14 @@ public:
 	void setSource(DeviceSampleSource* source); //!< Set the sample source type
 	void setSourceSequence(int sequence); //!< Set the sample source sequence in type
 	DeviceSampleSource *getSource() { return m_deviceSampleSource; }
+	bool setSourceCenterFrequency(qint64 centerFrequency); //!< Retune the current source from any thread. Returns false if there is none
 
 	void addSink(BasebandSampleSink* sink); //!< Add a sample sink
 	void removeSink(BasebandSampleSink* sink); //!< Remove a sample sink
 
 	void addThreadedSink(ThreadedBasebandSampleSink* sink); //!< Add a sample sink that will run on its own thread
 	void removeThreadedSink(ThreadedBasebandSampleSink* sink); //!< Remove a sample sink that runs on its own thread
+	void holdChannelizers(bool hold); //!< Defer the channelizer reconfigurations of this device set until released
 
 	void configureCorrections(bool dcOffsetCorrection, bool iqImbalanceCorrection); //!< Configure DSP corrections
 
@@ -88,6 +90,7 @@ private:
 	QString m_deviceDescription;
 
 	DeviceSampleSource* m_deviceSampleSource;
+	QMutex m_sourceMutex; //!< guards the source change against the retunes from other threads
 	int m_sampleSourceSequence;
 
 	typedef std::list<BasebandSampleSink*> BasebandSampleSinks;
@@ -95,6 +98,7 @@ private:
 
 	typedef std::list<ThreadedBasebandSampleSink*> ThreadedBasebandSampleSinks;
 	ThreadedBasebandSampleSinks m_threadedBasebandSampleSinks; //!< sample sinks on their own threads (usually channels)
+	int m_channelizersHold; //!< number of pending holds of the channelizers reconfigurations
 
 	uint m_sampleRate;
 	quint64 m_centerFrequency;
@@ -0,0 +1,33 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_DSPLOG_H_
+#define SDRBASE_DSP_DSPLOG_H_
+
+#include <QLoggingCategory>
+
+#include "export.h"
+
+/**
+ * Logging category "sdrangel.dsp" of messages emitted from DSP threads. With qCDebug(dspLog)
+ * a disabled debug message costs only the test of a flag as it is not even formatted.
+ * Debug messages are disabled at the source when no log output takes them and rules
+ * like "sdrangel.dsp.debug=false" can be given with the --log-filter option.
+ */
+SDRBASE_API const QLoggingCategory& dspLog();
+
+#endif /* SDRBASE_DSP_DSPLOG_H_ */
@@ -25,6 +25,7 @@
 #include "util/message.h"
 
 #include "filerecord.h"
+#include "filerecordwriter.h"
 
 FileRecord::FileRecord() :
 	BasebandSampleSink(),
@@ -33,6 +34,7 @@ FileRecord::FileRecord() :
     m_centerFrequency(0),
 	m_recordOn(false),
     m_recordStart(false),
+    m_writer(new FileRecordWriter()),
     m_byteCount(0)
 {
 	setObjectName("FileSink");
@@ -45,6 +47,7 @@ FileRecord::FileRecord(const QString& filename) :
     m_centerFrequency(0),
     m_recordOn(false),
     m_recordStart(false),
+    m_writer(new FileRecordWriter()),
     m_byteCount(0)
 {
     setObjectName("FileRecord");
@@ -53,6 +56,17 @@ FileRecord::FileRecord(const QString& filename) :
 FileRecord::~FileRecord()
 {
     stopRecording();
+    delete m_writer;
+}
+
+quint64 FileRecord::getDroppedBytes() const
+{
+    return m_writer->getDroppedBytes();
+}
+
+float FileRecord::getWriteRate() const
+{
+    return m_writer->getWriteRate();
 }
 
 void FileRecord::setFileName(const QString& filename)
@@ -83,7 +97,7 @@ void FileRecord::feed(const SampleVector::const_iterator& begin, const SampleVec
             m_recordStart = false;
         }
 
-        m_sampleFile.write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample));
+        m_writer->write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample)); // does not wait for the disk
         m_byteCount += end - begin;
     }
 }
@@ -99,24 +113,25 @@ void FileRecord::stop()
 
 void FileRecord::startRecording()
 {
-    if (!m_sampleFile.is_open())
+    if (!m_recordOn)
     {
     	qDebug() << "FileRecord::startRecording";
-        m_sampleFile.open(m_fileName.toStdString().c_str(), std::ios::binary);
-        m_recordOn = true;
+        m_writer->startWriter(); // the file is opened with the first samples
         m_recordStart = true;
         m_byteCount = 0;
+        m_recordOn = true;
     }
 }
 
 void FileRecord::stopRecording()
 {
-    if (m_sampleFile.is_open())
+    if (m_recordOn)
     {
-    	qDebug() << "FileRecord::stopRecording";
-        m_sampleFile.close();
         m_recordOn = false;
         m_recordStart = false;
+        m_writer->stopWriter();
+        qDebug("FileRecord::stopRecording: %s: %.1f MB/s %llu bytes dropped",
+            qPrintable(m_fileName), m_writer->getWriteRate(), m_writer->getDroppedBytes());
     }
 }
 
@@ -157,7 +172,7 @@ void FileRecord::writeHeader()
     header.sampleSize = SDR_RX_SAMP_SZ;
     header.filler = 0;
 
-    writeHeader(m_sampleFile, header);
+    m_writer->openFile(m_fileName, header);
 }
 
 bool FileRecord::readHeader(std::ifstream& sampleFile, Header& header)
@@ -169,9 +184,14 @@ bool FileRecord::readHeader(std::ifstream& sampleFile, Header& header)
 }
 
 void FileRecord::writeHeader(std::ofstream& sampleFile, Header& header)
+{
+    setHeaderCRC(header);
+    sampleFile.write((const char *) &header, sizeof(Header));
+}
+
+void FileRecord::setHeaderCRC(Header& header)
 {
     boost::crc_32_type crc32;
     crc32.process_bytes(&header, 28);
     header.crc32 = crc32.checksum();
-    sampleFile.write((const char *) &header, sizeof(Header));
 }
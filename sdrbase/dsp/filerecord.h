@@ -26,6 +26,7 @@
 #include "export.h"
 
 class Message;
+class FileRecordWriter;
 
 class SDRBASE_API FileRecord : public BasebandSampleSink {
 public:
@@ -47,6 +48,8 @@ public:
 	virtual ~FileRecord();
 
     quint64 getByteCount() const { return m_byteCount; }
+    quint64 getDroppedBytes() const; //!< samples bytes dropped because the disk could not keep up
+    float getWriteRate() const;      //!< sustained write rate in MB/s
 
     void setFileName(const QString& filename);
     void genUniqueFileName(uint deviceUID);
@@ -59,6 +62,7 @@ public:
     void stopRecording();
     static bool readHeader(std::ifstream& samplefile, Header& header); //!< returns true if CRC checksum is correct else false
     static void writeHeader(std::ofstream& samplefile, Header& header);
+    static void setHeaderCRC(Header& header);
 
 private:
 	QString m_fileName;
@@ -66,7 +70,7 @@ private:
 	quint64 m_centerFrequency;
 	bool m_recordOn;
     bool m_recordStart;
-    std::ofstream m_sampleFile;
+    FileRecordWriter *m_writer;
     quint64 m_byteCount;
 
 	void handleConfigure(const QString& fileName);
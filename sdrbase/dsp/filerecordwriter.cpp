@@ -0,0 +1,477 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <ctime>
+#include <algorithm>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+#include <QDebug>
+#include <QMutexLocker>
+
+#include "filerecordwriter.h"
+
+#define FILERECORDWRITER_ALIGN 4096
+#define FILERECORDWRITER_PREALLOC ((qint64) 256*1024*1024)
+
+bool FileRecordWriter::m_defaultDirectIO = true;
+quint64 FileRecordWriter::m_defaultRotateBytes = 0;
+int FileRecordWriter::m_defaultRotateSeconds = 0;
+
+FileRecordWriter::FileRecordWriter(int bufferSize, int nbBuffers) :
+    m_bufferSize(((bufferSize + FILERECORDWRITER_ALIGN - 1) / FILERECORDWRITER_ALIGN) * FILERECORDWRITER_ALIGN),
+    m_stopping(false),
+    m_current(-1),
+    m_fileOpen(false),
+    m_pendingHeader(false),
+    m_fileIndex(0),
+    m_fileBytes(0),
+    m_rotateBytes(m_defaultRotateBytes),
+    m_rotateSeconds(m_defaultRotateSeconds),
+    m_droppedBytes(0),
+    m_directIO(m_defaultDirectIO),
+#if defined(Q_OS_LINUX)
+    m_fd(-1),
+    m_fdDirect(false),
+    m_allocated(0),
+#endif
+    m_fileOffset(0),
+    m_bytesWritten(0),
+    m_failedBytes(0),
+    m_writeNs(0),
+    m_writeRate(0.0f),
+    m_diskRate(0.0f)
+{
+    memset(&m_header, 0, sizeof(FileRecord::Header));
+    // the memory is allocated only while the writer runs
+    m_buffers.resize(nbBuffers < 2 ? 2 : nbBuffers);
+
+    for (int i = 0; i < m_buffers.size(); i++)
+    {
+        m_buffers[i].m_data = 0;
+        m_buffers[i].m_size = 0;
+        m_buffers[i].m_newFile = false;
+    }
+}
+
+FileRecordWriter::~FileRecordWriter()
+{
+    stopWriter();
+}
+
+void FileRecordWriter::setDefaults(bool directIO, quint64 rotateBytes, int rotateSeconds)
+{
+    m_defaultDirectIO = directIO;
+    m_defaultRotateBytes = rotateBytes;
+    m_defaultRotateSeconds = rotateSeconds < 0 ? 0 : rotateSeconds;
+}
+
+void FileRecordWriter::setRotation(quint64 rotateBytes, int rotateSeconds)
+{
+    QMutexLocker mutexLocker(&m_producerMutex);
+    m_rotateBytes = rotateBytes;
+    m_rotateSeconds = rotateSeconds < 0 ? 0 : rotateSeconds;
+}
+
+void FileRecordWriter::startWriter()
+{
+    if (isRunning()) {
+        return;
+    }
+
+    m_freeBuffers.clear();
+    m_fullBuffers.clear();
+
+    for (int i = 0; i < m_buffers.size(); i++)
+    {
+        m_buffers[i].m_data = (char *) qMallocAligned(m_bufferSize, FILERECORDWRITER_ALIGN);
+        m_buffers[i].m_size = 0;
+        m_buffers[i].m_newFile = false;
+        m_freeBuffers.enqueue(i);
+    }
+
+    m_current = -1;
+    m_fileOpen = false;
+    m_pendingHeader = false;
+    m_fileIndex = 0;
+    m_droppedBytes = 0;
+    m_bytesWritten = 0;
+    m_failedBytes = 0;
+    m_writeNs = 0;
+    m_writeRate = 0.0f;
+    m_diskRate = 0.0f;
+    m_stopping = false;
+    start();
+}
+
+void FileRecordWriter::stopWriter()
+{
+    if (!isRunning()) {
+        return;
+    }
+
+    m_producerMutex.lock();
+    queueCurrent();
+    m_fileOpen = false;
+    m_pendingHeader = false;
+    m_producerMutex.unlock();
+
+    m_mutex.lock();
+    m_stopping = true;
+    m_fullCondition.wakeAll();
+    m_mutex.unlock();
+    wait();
+
+    for (int i = 0; i < m_buffers.size(); i++)
+    {
+        qFreeAligned(m_buffers[i].m_data);
+        m_buffers[i].m_data = 0;
+    }
+
+    qDebug("FileRecordWriter::stopWriter: %llu bytes written in %d file(s) at %.1f MB/s (disk %.1f MB/s) %llu bytes dropped",
+        m_bytesWritten, m_fileIndex + 1, m_writeRate, m_diskRate, getDroppedBytes());
+}
+
+void FileRecordWriter::openFile(const QString& fileName, const FileRecord::Header& header)
+{
+    QMutexLocker mutexLocker(&m_producerMutex);
+
+    if (!isRunning()) {
+        return;
+    }
+
+    queueCurrent(); // the previous file is closed when the writer gets to the new one
+    m_baseFileName = fileName;
+    m_header = header;
+    m_fileIndex = 0;
+    m_fileOpen = true;
+    m_pendingHeader = true;
+    m_fileBytes = 0;
+    m_fileTimer.start();
+}
+
+bool FileRecordWriter::write(const char *data, qint64 size)
+{
+    QMutexLocker mutexLocker(&m_producerMutex);
+
+    if (!m_fileOpen) {
+        return false;
+    }
+
+    if ((m_fileBytes > 0)
+        && (((m_rotateBytes > 0) && (m_fileBytes >= m_rotateBytes))
+            || ((m_rotateSeconds > 0) && (m_fileTimer.elapsed() >= m_rotateSeconds*1000LL))))
+    {
+        queueCurrent();
+        m_fileIndex++;
+        m_pendingHeader = true;
+        m_fileBytes = 0;
+        m_fileTimer.start();
+    }
+
+    while (size > 0)
+    {
+        if (m_current < 0)
+        {
+            if (!takeBuffer())
+            {
+                m_droppedBytes += size;
+                return false;
+            }
+
+            if (m_pendingHeader) {
+                startFile();
+            }
+        }
+
+        Buffer& buffer = m_buffers[m_current];
+        qint64 chunk = std::min(size, m_bufferSize - buffer.m_size);
+        memcpy(buffer.m_data + buffer.m_size, data, chunk);
+        buffer.m_size += chunk;
+        m_fileBytes += chunk;
+        data += chunk;
+        size -= chunk;
+
+        if (buffer.m_size == m_bufferSize) {
+            queueCurrent();
+        }
+    }
+
+    return true;
+}
+
+bool FileRecordWriter::takeBuffer()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_freeBuffers.isEmpty()) {
+        return false;
+    }
+
+    m_current = m_freeBuffers.dequeue();
+    m_buffers[m_current].m_size = 0;
+    m_buffers[m_current].m_newFile = false;
+    return true;
+}
+
+void FileRecordWriter::queueCurrent()
+{
+    if (m_current < 0) {
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+    m_fullBuffers.enqueue(m_current);
+    m_fullCondition.wakeAll();
+    m_current = -1;
+}
+
+void FileRecordWriter::startFile()
+{
+    Buffer& buffer = m_buffers[m_current];
+    FileRecord::Header header = m_header;
+
+    if (m_fileIndex > 0) {
+        header.startTimeStamp = std::time(0);
+    }
+
+    FileRecord::setHeaderCRC(header);
+    memcpy(buffer.m_data, &header, sizeof(FileRecord::Header));
+    buffer.m_size = sizeof(FileRecord::Header);
+    buffer.m_newFile = true;
+    buffer.m_fileName = m_fileIndex > 0 ? getRotatedFileName() : m_baseFileName;
+    m_fileBytes = sizeof(FileRecord::Header);
+    m_pendingHeader = false;
+}
+
+QString FileRecordWriter::getRotatedFileName() const
+{
+    // rec0_xxx.sdriq -> rec0_xxx_001.sdriq
+    int dot = m_baseFileName.lastIndexOf('.');
+
+    if (dot <= m_baseFileName.lastIndexOf('/')) {
+        return QString("%1_%2").arg(m_baseFileName).arg(m_fileIndex, 3, 10, QChar('0'));
+    } else {
+        return QString("%1_%2%3").arg(m_baseFileName.left(dot)).arg(m_fileIndex, 3, 10, QChar('0')).arg(m_baseFileName.mid(dot));
+    }
+}
+
+void FileRecordWriter::run()
+{
+    m_recordTimer.start();
+
+    while (true)
+    {
+        m_mutex.lock();
+
+        while (m_fullBuffers.isEmpty() && !m_stopping) {
+            m_fullCondition.wait(&m_mutex);
+        }
+
+        if (m_fullBuffers.isEmpty()) // stopping and all written
+        {
+            m_mutex.unlock();
+            break;
+        }
+
+        int index = m_fullBuffers.dequeue();
+        Buffer& buffer = m_buffers[index];
+        m_mutex.unlock();
+
+        if (buffer.m_newFile)
+        {
+            closeFileDisk();
+            openFileDisk(buffer.m_fileName);
+        }
+
+        writeDisk(buffer.m_data, buffer.m_size);
+
+        m_mutex.lock();
+        m_freeBuffers.enqueue(index);
+        m_mutex.unlock();
+    }
+
+    closeFileDisk();
+}
+
+#if defined(Q_OS_LINUX)
+
+void FileRecordWriter::openFileDisk(const QString& fileName)
+{
+    QByteArray name = fileName.toLocal8Bit();
+    int flags = O_WRONLY | O_CREAT | O_TRUNC;
+    m_fd = -1;
+    m_fdDirect = false;
+
+    if (m_directIO)
+    {
+        m_fd = ::open(name.constData(), flags | O_DIRECT, 0644);
+        m_fdDirect = m_fd >= 0;
+    }
+
+    if (m_fd < 0) { // file systems like tmpfs do not support O_DIRECT
+        m_fd = ::open(name.constData(), flags, 0644);
+    }
+
+    if (m_fd < 0) {
+        qWarning("FileRecordWriter::openFileDisk: cannot open %s: %s", name.constData(), strerror(errno));
+    } else {
+        qDebug("FileRecordWriter::openFileDisk: %s%s", name.constData(), m_fdDirect ? " (direct I/O)" : "");
+    }
+
+    m_fileOffset = 0;
+    m_allocated = 0;
+}
+
+void FileRecordWriter::writeDisk(const char *data, qint64 size)
+{
+    if (size <= 0) {
+        return;
+    }
+
+    if (m_fd < 0)
+    {
+        m_failedBytes += size;
+        return;
+    }
+
+    QElapsedTimer writeTimer;
+    writeTimer.start();
+
+    // reserve the space ahead so that the file system does not allocate blocks on each write
+    if ((m_allocated >= 0) && (m_fileOffset + size > m_allocated))
+    {
+        qint64 length = std::max(size, (m_rotateBytes > 0) ? std::min((qint64) m_rotateBytes, FILERECORDWRITER_PREALLOC) : FILERECORDWRITER_PREALLOC);
+
+        if (fallocate(m_fd, FALLOC_FL_KEEP_SIZE, m_allocated, length) == 0) {
+            m_allocated += length;
+        } else {
+            m_allocated = -1; // not supported: do not try again on this file
+        }
+    }
+
+    // the tail of the last buffer of a file is not a multiple of the block size and cannot be written directly
+    qint64 directSize = m_fdDirect ? size & ~((qint64) FILERECORDWRITER_ALIGN - 1) : 0;
+    qint64 done = 0;
+
+    while (done < size)
+    {
+        if (m_fdDirect && (done == directSize))
+        {
+            fcntl(m_fd, F_SETFL, fcntl(m_fd, F_GETFL) & ~O_DIRECT);
+            m_fdDirect = false;
+        }
+
+        qint64 end = m_fdDirect ? directSize : size;
+        ssize_t written = ::write(m_fd, data + done, end - done);
+
+        if (written < 0)
+        {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            qWarning("FileRecordWriter::writeDisk: %s", strerror(errno));
+            m_failedBytes += size - done;
+            break;
+        }
+
+        done += written;
+    }
+
+    m_fileOffset += done;
+    m_bytesWritten += done;
+    m_writeNs += writeTimer.nsecsElapsed();
+    qint64 recordNs = m_recordTimer.nsecsElapsed();
+    m_writeRate = recordNs > 0 ? (m_bytesWritten * 1000.0f) / recordNs : 0.0f;
+    m_diskRate = m_writeNs > 0 ? (m_bytesWritten * 1000.0f) / m_writeNs : 0.0f;
+}
+
+void FileRecordWriter::closeFileDisk()
+{
+    if (m_fd < 0) {
+        return;
+    }
+
+    if (m_allocated > m_fileOffset) { // release the space reserved beyond the end
+        if (ftruncate(m_fd, m_fileOffset) != 0) {
+            qWarning("FileRecordWriter::closeFileDisk: %s", strerror(errno));
+        }
+    }
+
+    ::close(m_fd);
+    m_fd = -1;
+}
+
+#else
+
+void FileRecordWriter::openFileDisk(const QString& fileName)
+{
+    m_file.setFileName(fileName);
+
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Unbuffered)) {
+        qWarning() << "FileRecordWriter::openFileDisk: cannot open " << fileName << ": " << m_file.errorString();
+    } else {
+        qDebug() << "FileRecordWriter::openFileDisk: " << fileName;
+    }
+
+    m_fileOffset = 0;
+}
+
+void FileRecordWriter::writeDisk(const char *data, qint64 size)
+{
+    if (size <= 0) {
+        return;
+    }
+
+    if (!m_file.isOpen())
+    {
+        m_failedBytes += size;
+        return;
+    }
+
+    QElapsedTimer writeTimer;
+    writeTimer.start();
+    qint64 written = m_file.write(data, size);
+
+    if (written < size)
+    {
+        qWarning() << "FileRecordWriter::writeDisk: " << m_file.errorString();
+        m_failedBytes += size - (written < 0 ? 0 : written);
+        written = written < 0 ? 0 : written;
+    }
+
+    m_fileOffset += written;
+    m_bytesWritten += written;
+    m_writeNs += writeTimer.nsecsElapsed();
+    qint64 recordNs = m_recordTimer.nsecsElapsed();
+    m_writeRate = recordNs > 0 ? (m_bytesWritten * 1000.0f) / recordNs : 0.0f;
+    m_diskRate = m_writeNs > 0 ? (m_bytesWritten * 1000.0f) / m_writeNs : 0.0f;
+}
+
+void FileRecordWriter::closeFileDisk()
+{
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+}
+
+#endif
@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Asynchronous writer of .sdriq files                                           //
+//                                                                               //
+// The producer (DSP thread) copies the samples into large aligned buffers and   //
+// never waits for the disk. Full buffers are written by a dedicated thread with //
+// O_DIRECT and preallocation on Linux. When no free buffer is available the     //
+// samples are dropped and counted. The recording can be split in several files  //
+// by size or time each starting with its own header.                            //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_FILERECORDWRITER_H_
+#define SDRBASE_DSP_FILERECORDWRITER_H_
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+#include <QQueue>
+#include <QVector>
+#include <QString>
+#include <QFile>
+
+#include "dsp/filerecord.h"
+#include "export.h"
+
+class SDRBASE_API FileRecordWriter : public QThread
+{
+    Q_OBJECT
+
+public:
+    FileRecordWriter(int bufferSize = 8*1024*1024, int nbBuffers = 4);
+    ~FileRecordWriter();
+
+    /** Defaults applied to new writers. Sizes in bytes and times in seconds. 0 disables rotation. */
+    static void setDefaults(bool directIO, quint64 rotateBytes, int rotateSeconds);
+    void setDirectIO(bool directIO) { m_directIO = directIO; } //!< applied on the next file
+    void setRotation(quint64 rotateBytes, int rotateSeconds);
+
+    void startWriter();  //!< start the writer thread
+    void stopWriter();   //!< write the pending samples, close the file and stop the thread
+    /** Start a new file with this header (CRC and timestamp are filled). Producer side. */
+    void openFile(const QString& fileName, const FileRecord::Header& header);
+    /** Queue samples for writing. Never waits for the disk. Returns false if some bytes were dropped. Producer side. */
+    bool write(const char *data, qint64 size);
+
+    quint64 getBytesWritten() const { return m_bytesWritten; }
+    quint64 getDroppedBytes() const { return m_droppedBytes + m_failedBytes; } //!< not queued for lack of buffers or lost on write errors
+    int getFileIndex() const { return m_fileIndex; } //!< 0 for the first file of the recording then incremented at each rotation
+    float getWriteRate() const { return m_writeRate; } //!< sustained rate in MB/s since the start of the recording
+    float getDiskRate() const { return m_diskRate; }   //!< rate in MB/s of the write calls alone i.e. what the disk can take
+
+private:
+    struct Buffer
+    {
+        char *m_data;
+        qint64 m_size;
+        bool m_newFile; //!< a new file is opened before writing this buffer
+        QString m_fileName;
+    };
+
+    QVector<Buffer> m_buffers;
+    qint64 m_bufferSize;
+    QMutex m_mutex; //!< protects the queues
+    QWaitCondition m_fullCondition;
+    QQueue<int> m_freeBuffers;
+    QQueue<int> m_fullBuffers;
+    bool m_stopping;
+
+    // producer side
+    QMutex m_producerMutex; //!< serializes the producer calls. Never held while writing to disk
+    int m_current;  //!< buffer being filled or -1
+    bool m_fileOpen;
+    bool m_pendingHeader; //!< the next buffer starts a new file
+    QString m_baseFileName;
+    FileRecord::Header m_header;
+    int m_fileIndex;
+    quint64 m_fileBytes;
+    QElapsedTimer m_fileTimer;
+    quint64 m_rotateBytes;
+    int m_rotateSeconds;
+    volatile quint64 m_droppedBytes;
+
+    // writer side
+    bool m_directIO;
+#if defined(Q_OS_LINUX)
+    int m_fd;
+    bool m_fdDirect;
+    qint64 m_allocated;
+#else
+    QFile m_file;
+#endif
+    qint64 m_fileOffset;
+    volatile quint64 m_bytesWritten;
+    volatile quint64 m_failedBytes; //!< lost on write errors
+    qint64 m_writeNs;
+    QElapsedTimer m_recordTimer;
+    volatile float m_writeRate;
+    volatile float m_diskRate;
+
+    static bool m_defaultDirectIO;
+    static quint64 m_defaultRotateBytes;
+    static int m_defaultRotateSeconds;
+
+    void run();
+    bool takeBuffer(); //!< producer side. Returns false if no buffer is free
+    void queueCurrent();
+    void startFile(); //!< puts the header of the next file at the start of the current buffer
+    QString getRotatedFileName() const;
+    void openFileDisk(const QString& fileName);
+    void writeDisk(const char *data, qint64 size);
+    void closeFileDisk();
+};
+
+#endif /* SDRBASE_DSP_FILERECORDWRITER_H_ */
@@ -19,6 +19,7 @@
 #define INCLUDE_DSP_PHASEDISCRI_H_
 
 #include "dsp/dsptypes.h"
+#include "dsp/blockkernels.h"
 
 #undef M_PI
 #define M_PI 3.14159265358979323846
@@ -77,6 +78,22 @@ public:
         return fmDev * m_fmScaling;
     }
 
+    /**
+     * Block version of phaseDiscriminatorDelta over a span of samples. magsq is not computed.
+     */
+    void phaseDiscriminatorDelta(const Complex *samples, Real *demod, int nbSamples)
+    {
+        BlockKernels::fmDiscriminator(samples, demod, nbSamples, m_prevArg, m_fmScaling);
+    }
+
+    /**
+     * Block version of phaseDiscriminator over a span of samples
+     */
+    void phaseDiscriminator(const Complex *samples, Real *demod, int nbSamples)
+    {
+        BlockKernels::phaseDiscriminator(samples, demod, nbSamples, m_m1Sample, m_fmScaling);
+    }
+
 	/**
 	 * Alternative without atan at the expense of a slight distorsion on very wideband signals
 	 * http://www.embedded.com/design/configurable-systems/4212086/DSP-Tricks--Frequency-demodulation-algorithms-
@@ -177,5 +177,7 @@ protected:
         // cos(2*x) = 2 * cos(x) * cos(x) - 1
     	samples_out[2] = (2.0 * m_pcos * m_pcos) - 1.0; // 2f Pilot cos
         samples_out[3] = m_phase; // Pilot phase
+        // cos(3*x) = cos(2*x) * cos(x) - sin(2*x) * sin(x)
+        samples_out[4] = samples_out[2] * m_pcos - samples_out[1] * m_psin; // 3f Pilot cos (RDS subcarrier)
     }
 };
@@ -87,104 +87,10 @@ Real Projector::run(const Sample& s)
         }
             break;
         case ProjectionBPSK:
-        {
-            Real arg = std::atan2((float) s.m_imag, (float) s.m_real);
-            v = normalizeAngle(2*arg) / (2.0*M_PI); // generic estimation around 0
-            // mapping on 2 symbols
-            if (arg < -M_PI/2) {
-                v -= 1.0/2;
-            } else if (arg < M_PI/2) {
-                v += 1.0/2;
-            } else if (arg < M_PI) {
-                v -= 1.0/2;
-            }
-        }
-            break;
         case ProjectionQPSK:
-        {
-            Real arg = std::atan2((float) s.m_imag, (float) s.m_real);
-            v = normalizeAngle(4*arg) / (4.0*M_PI); // generic estimation around 0
-            // mapping on 4 symbols
-            if (arg < -3*M_PI/4) {
-                v -= 3.0/4;
-            } else if (arg < -M_PI/4) {
-                v -= 1.0/4;
-            } else if (arg < M_PI/4) {
-                v += 1.0/4;
-            } else if (arg < 3*M_PI/4) {
-                v += 3.0/4;
-            } else if (arg < M_PI) {
-                v -= 3.0/4;
-            }
-        }
-            break;
         case Projection8PSK:
-        {
-            Real arg = std::atan2((float) s.m_imag, (float) s.m_real);
-            v = normalizeAngle(8*arg) / (8.0*M_PI); // generic estimation around 0
-            // mapping on 8 symbols
-            if (arg < -7*M_PI/8) {
-               v -= 7.0/8;
-            } else if (arg < -5*M_PI/8) {
-                v -= 5.0/8;
-            } else if (arg < -3*M_PI/8) {
-                v -= 3.0/8;
-            } else if (arg < -M_PI/8) {
-                v -= 1.0/8;
-            } else if (arg < M_PI/8) {
-                v += 1.0/8;
-            } else if (arg < 3*M_PI/8) {
-                v += 3.0/8;
-            } else if (arg < 5*M_PI/8) {
-                v += 5.0/8;
-            } else if (arg < 7*M_PI/8) {
-                v += 7.0/8;
-            } else if (arg < M_PI) {
-                v -= 7.0/8;
-            }
-        }
-            break;
         case Projection16PSK:
-        {
-            Real arg = std::atan2((float) s.m_imag, (float) s.m_real);
-            v = normalizeAngle(16*arg) / (16.0*M_PI); // generic estimation around 0
-            // mapping on 16 symbols
-            if (arg < -15*M_PI/16) {
-               v -= 15.0/16;
-            } else if (arg < -13*M_PI/16) {
-                v -= 13.0/6;
-            } else if (arg < -11*M_PI/16) {
-                v -= 11.0/16;
-            } else if (arg < -9*M_PI/16) {
-                v -= 9.0/16;
-            } else if (arg < -7*M_PI/16) {
-                v -= 7.0/16;
-            } else if (arg < -5*M_PI/16) {
-                v -= 5.0/16;
-            } else if (arg < -3*M_PI/16) {
-                v -= 3.0/16;
-            } else if (arg < -M_PI/16) {
-                v -= 1.0/16;
-            } else if (arg < M_PI/16) {
-                v += 1.0/16;
-            } else if (arg < 3.0*M_PI/16) {
-                v += 3.0/16;
-            } else if (arg < 5.0*M_PI/16) {
-                v += 5.0/16;
-            } else if (arg < 7.0*M_PI/16) {
-                v += 7.0/16;
-            } else if (arg < 9.0*M_PI/16) {
-                v += 9.0/16;
-            } else if (arg < 11.0*M_PI/16) {
-                v += 11.0/16;
-            } else if (arg < 13.0*M_PI/16) {
-                v += 13.0/16;
-            } else if (arg < 15.0*M_PI/16) {
-                v += 15.0/16;
-            } else if (arg < M_PI) {
-                v -= 15.0/16;
-            }
-        }
+            v = estimatePSK(m_projectionType, std::atan2((float) s.m_imag, (float) s.m_real));
             break;
         case ProjectionReal:
         default:
@@ -200,6 +106,116 @@ Real Projector::run(const Sample& s)
     }
 }
 
+Real Projector::estimatePSK(ProjectionType projectionType, Real arg)
+{
+    Real v;
+
+    switch (projectionType)
+    {
+    case ProjectionBPSK:
+    {
+        v = normalizeAngle(2*arg) / (2.0*M_PI); // generic estimation around 0
+        // mapping on 2 symbols
+        if (arg < -M_PI/2) {
+            v -= 1.0/2;
+        } else if (arg < M_PI/2) {
+            v += 1.0/2;
+        } else if (arg < M_PI) {
+            v -= 1.0/2;
+        }
+    }
+        break;
+    case ProjectionQPSK:
+    {
+        v = normalizeAngle(4*arg) / (4.0*M_PI); // generic estimation around 0
+        // mapping on 4 symbols
+        if (arg < -3*M_PI/4) {
+            v -= 3.0/4;
+        } else if (arg < -M_PI/4) {
+            v -= 1.0/4;
+        } else if (arg < M_PI/4) {
+            v += 1.0/4;
+        } else if (arg < 3*M_PI/4) {
+            v += 3.0/4;
+        } else if (arg < M_PI) {
+            v -= 3.0/4;
+        }
+    }
+        break;
+    case Projection8PSK:
+    {
+        v = normalizeAngle(8*arg) / (8.0*M_PI); // generic estimation around 0
+        // mapping on 8 symbols
+        if (arg < -7*M_PI/8) {
+           v -= 7.0/8;
+        } else if (arg < -5*M_PI/8) {
+            v -= 5.0/8;
+        } else if (arg < -3*M_PI/8) {
+            v -= 3.0/8;
+        } else if (arg < -M_PI/8) {
+            v -= 1.0/8;
+        } else if (arg < M_PI/8) {
+            v += 1.0/8;
+        } else if (arg < 3*M_PI/8) {
+            v += 3.0/8;
+        } else if (arg < 5*M_PI/8) {
+            v += 5.0/8;
+        } else if (arg < 7*M_PI/8) {
+            v += 7.0/8;
+        } else if (arg < M_PI) {
+            v -= 7.0/8;
+        }
+    }
+        break;
+    case Projection16PSK:
+    {
+        v = normalizeAngle(16*arg) / (16.0*M_PI); // generic estimation around 0
+        // mapping on 16 symbols
+        if (arg < -15*M_PI/16) {
+           v -= 15.0/16;
+        } else if (arg < -13*M_PI/16) {
+            v -= 13.0/6;
+        } else if (arg < -11*M_PI/16) {
+            v -= 11.0/16;
+        } else if (arg < -9*M_PI/16) {
+            v -= 9.0/16;
+        } else if (arg < -7*M_PI/16) {
+            v -= 7.0/16;
+        } else if (arg < -5*M_PI/16) {
+            v -= 5.0/16;
+        } else if (arg < -3*M_PI/16) {
+            v -= 3.0/16;
+        } else if (arg < -M_PI/16) {
+            v -= 1.0/16;
+        } else if (arg < M_PI/16) {
+            v += 1.0/16;
+        } else if (arg < 3.0*M_PI/16) {
+            v += 3.0/16;
+        } else if (arg < 5.0*M_PI/16) {
+            v += 5.0/16;
+        } else if (arg < 7.0*M_PI/16) {
+            v += 7.0/16;
+        } else if (arg < 9.0*M_PI/16) {
+            v += 9.0/16;
+        } else if (arg < 11.0*M_PI/16) {
+            v += 11.0/16;
+        } else if (arg < 13.0*M_PI/16) {
+            v += 13.0/16;
+        } else if (arg < 15.0*M_PI/16) {
+            v += 15.0/16;
+        } else if (arg < M_PI) {
+            v -= 15.0/16;
+        }
+    }
+        break;
+    default:
+        v = arg / M_PI;
+        break;
+    }
+
+    return v;
+}
+
 Real Projector::normalizeAngle(Real angle)
 {
     while (angle <= -M_PI) {
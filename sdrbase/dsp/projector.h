@@ -15,6 +15,9 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#ifndef SDRBASE_DSP_PROJECTOR_H_
+#define SDRBASE_DSP_PROJECTOR_H_
+
 #include "export.h"
 #include "dsptypes.h"
 
@@ -46,6 +49,7 @@ public:
     void setCacheMaster(bool cacheMaster) { m_cacheMaster = cacheMaster; }
 
     Real run(const Sample& s);
+    static Real estimatePSK(ProjectionType projectionType, Real arg); //!< phase comparator estimation of PSK types from the argument in radians
 
 private:
     static Real normalizeAngle(Real angle);
@@ -54,3 +58,5 @@ private:
     Real *m_cache;
     bool m_cacheMaster;
 };
+
+#endif /* SDRBASE_DSP_PROJECTOR_H_ */
@@ -15,6 +15,8 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include "dsp/basebandsamplesink.h"
+#include "util/timeutil.h"
 #include "samplesinkfifo.h"
 
 #define MIN(x, y) (((x) < (y)) ? (x) : (y))
@@ -25,6 +27,7 @@ void SampleSinkFifo::create(uint s)
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	m_writeTimestamp = 0;
 
 	m_data.resize(s);
 	m_size = m_data.size();
@@ -37,19 +40,17 @@ SampleSinkFifo::SampleSinkFifo(QObject* parent) :
 	QObject(parent),
 	m_data()
 {
-	m_suppressed = -1;
 	m_size = 0;
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	m_writeTimestamp = 0;
 }
 
 SampleSinkFifo::SampleSinkFifo(int size, QObject* parent) :
 	QObject(parent),
 	m_data()
 {
-	m_suppressed = -1;
-
 	create(size);
 }
 
@@ -67,6 +68,12 @@ bool SampleSinkFifo::setSize(int size)
 	return m_data.size() == (uint)size;
 }
 
+void SampleSinkFifo::stampWrite()
+{
+	uint64_t timestamp = BasebandSampleSink::getFeedTimestamp();
+	m_writeTimestamp = timestamp == 0 ? TimeUtil::steadyus() : timestamp;
+}
+
 uint SampleSinkFifo::write(const quint8* data, uint count)
 {
 	QMutexLocker mutexLocker(&m_mutex);
@@ -78,18 +85,9 @@ uint SampleSinkFifo::write(const quint8* data, uint count)
 
 	total = MIN(count, m_size - m_fill);
 	if(total < count) {
-		if(m_suppressed < 0) {
-			m_suppressed = 0;
-			m_msgRateTimer.start();
-			qCritical("SampleSinkFifo: overflow - dropping %u samples", count - total);
-		} else {
-			if(m_msgRateTimer.elapsed() > 2500) {
-				qCritical("SampleSinkFifo: %u messages dropped", m_suppressed);
-				qCritical("SampleSinkFifo: overflow - dropping %u samples", count - total);
-				m_suppressed = -1;
-			} else {
-				m_suppressed++;
-			}
+		if(m_overflowLog.occurrence(count - total)) {
+			qCritical("SampleSinkFifo: overflow - dropped %llu samples in %u writes",
+				m_overflowLog.getAmount(), m_overflowLog.getOccurrences());
 		}
 	}
 
@@ -104,6 +102,8 @@ uint SampleSinkFifo::write(const quint8* data, uint count)
 		remaining -= len;
 	}
 
+	stampWrite();
+
 	if(m_fill > 0)
 		emit dataReady();
 
@@ -120,18 +120,9 @@ uint SampleSinkFifo::write(SampleVector::const_iterator begin, SampleVector::con
 
 	total = MIN(count, m_size - m_fill);
 	if(total < count) {
-		if(m_suppressed < 0) {
-			m_suppressed = 0;
-			m_msgRateTimer.start();
-			qCritical("SampleSinkFifo: overflow - dropping %u samples", count - total);
-		} else {
-			if(m_msgRateTimer.elapsed() > 2500) {
-				qCritical("SampleSinkFifo: %u messages dropped", m_suppressed);
-				qCritical("SampleSinkFifo: overflow - dropping %u samples", count - total);
-				m_suppressed = -1;
-			} else {
-				m_suppressed++;
-			}
+		if(m_overflowLog.occurrence(count - total)) {
+			qCritical("SampleSinkFifo: overflow - dropped %llu samples in %u writes",
+				m_overflowLog.getAmount(), m_overflowLog.getOccurrences());
 		}
 	}
 
@@ -146,12 +137,52 @@ uint SampleSinkFifo::write(SampleVector::const_iterator begin, SampleVector::con
 		remaining -= len;
 	}
 
+	stampWrite();
+
 	if(m_fill > 0)
 		emit dataReady();
 
 	return total;
 }
 
+uint SampleSinkFifo::writeBegin(uint count, SampleVector::iterator* writeAt)
+{
+	QMutexLocker mutexLocker(&m_mutex);
+
+	if (m_size == 0)
+	{
+		*writeAt = m_data.end();
+		return 0;
+	}
+
+	*writeAt = m_data.begin() + m_tail;
+
+	// only the free region can be handed out and it must not wrap
+	return MIN(count, MIN(m_size - m_fill, m_size - m_tail));
+}
+
+uint SampleSinkFifo::writeCommit(uint count)
+{
+	QMutexLocker mutexLocker(&m_mutex);
+	uint space = MIN(m_size - m_fill, m_size - m_tail);
+
+	if(count > space) {
+		qCritical("SampleSinkFifo: cannot commit more than available space");
+		count = space;
+	}
+	if(count == 0)
+		return 0;
+
+	m_tail = (m_tail + count) % m_size;
+	m_fill += count;
+	stampWrite();
+
+	if(m_fill > 0)
+		emit dataReady();
+
+	return count;
+}
+
 uint SampleSinkFifo::read(SampleVector::iterator begin, SampleVector::iterator end)
 {
 	QMutexLocker mutexLocker(&m_mutex);
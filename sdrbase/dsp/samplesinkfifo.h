@@ -20,8 +20,8 @@
 
 #include <QObject>
 #include <QMutex>
-#include <QTime>
 #include "dsp/dsptypes.h"
+#include "util/loglimiter.h"
 #include "export.h"
 
 class SDRBASE_API SampleSinkFifo : public QObject {
@@ -29,8 +29,7 @@ class SDRBASE_API SampleSinkFifo : public QObject {
 
 private:
 	QMutex m_mutex;
-	QTime m_msgRateTimer;
-	int m_suppressed;
+	LogLimiter m_overflowLog;
 
 	SampleVector m_data;
 
@@ -38,8 +37,10 @@ private:
 	uint m_fill;
 	uint m_head;
 	uint m_tail;
+	uint64_t m_writeTimestamp; //!< arrival time of the latest samples
 
 	void create(uint s);
+	void stampWrite();
 
 public:
 	SampleSinkFifo(QObject* parent = NULL);
@@ -49,10 +50,18 @@ public:
 	bool setSize(int size);
 	inline uint size() const { return m_size; }
 	inline uint fill() { QMutexLocker mutexLocker(&m_mutex); uint fill = m_fill; return fill; }
+	/** Arrival time (TimeUtil::steadyus) of the latest samples written. Kept from the feed timestamp of the writing thread if any */
+	inline uint64_t getWriteTimestamp() { QMutexLocker mutexLocker(&m_mutex); return m_writeTimestamp; }
 
 	uint write(const quint8* data, uint count);
 	uint write(SampleVector::const_iterator begin, SampleVector::const_iterator end);
 
+	/** In place write: get at most count contiguous free samples at the tail so that the producer
+	 *  (typically the device decimators) can write directly into the FIFO. Returns the number of
+	 *  contiguous samples available at writeAt. Data is published with writeCommit. */
+	uint writeBegin(uint count, SampleVector::iterator* writeAt);
+	uint writeCommit(uint count);
+
 	uint read(SampleVector::iterator begin, SampleVector::iterator end);
 
 	uint readBegin(uint count,
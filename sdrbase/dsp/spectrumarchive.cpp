@@ -0,0 +1,673 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <math.h>
+#include <limits>
+#include <algorithm>
+
+#include <QDir>
+#include <QDataStream>
+#include <QDateTime>
+#include <QMutexLocker>
+#include <QDebug>
+
+#include "spectrumarchive.h"
+
+const float SpectrumArchive::m_dbStep = 0.5f;
+
+SpectrumArchive::SpectrumArchive() :
+    m_open(false),
+    m_rowPeriod(500),
+    m_centerFrequency(0),
+    m_sampleRate(0),
+    m_pendingBins(0),
+    m_pendingTime(0),
+    m_writer(0),
+    m_fileNumber(0),
+    m_stopping(false)
+{
+    m_chunk.m_nbRows = 0;
+}
+
+SpectrumArchive::~SpectrumArchive()
+{
+    close();
+}
+
+bool SpectrumArchive::open(const QString& directory, int rowPeriod)
+{
+    close();
+
+    QMutexLocker writeLocker(&m_writeMutex);
+
+    if (!QDir().mkpath(directory))
+    {
+        qWarning("SpectrumArchive::open: cannot create %s", qPrintable(directory));
+        return false;
+    }
+
+    m_directory = directory;
+    m_rowPeriod = rowPeriod < 10 ? 10 : rowPeriod;
+    m_pendingTime = 0;
+    m_chunk.m_nbRows = 0;
+
+    QVector<ChunkInfo> index;
+    quint64 nbRows, dataSize;
+    bool loaded = loadIndex(index, nbRows, dataSize);
+
+    {
+        QMutexLocker snapshotLocker(&m_snapshotMutex);
+        m_snapshot.m_generation++;
+        m_snapshot.m_directory = m_directory;
+        m_snapshot.m_index = index;
+        m_snapshot.m_queued.clear();
+        m_snapshot.m_current = PendingChunk();
+        m_snapshot.m_nbRows = nbRows;
+        m_snapshot.m_dataSize = dataSize;
+        m_stopping = false;
+    }
+
+    {
+        QMutexLocker cacheLocker(&m_cacheMutex);
+        m_cache.clear();
+    }
+
+    if (!loaded || !openDataFile())
+    {
+        m_indexFile.close();
+        return false;
+    }
+
+    qDebug("SpectrumArchive::open: %s: %u chunks %llu rows row period %d ms",
+            qPrintable(m_directory), (unsigned int) index.size(), nbRows, m_rowPeriod);
+    m_writer = new Writer(this);
+    m_writer->start();
+    m_open = true;
+    return true;
+}
+
+void SpectrumArchive::close()
+{
+    QMutexLocker writeLocker(&m_writeMutex);
+
+    if (!m_open) {
+        return;
+    }
+
+    pushRow();
+    flushChunk();
+
+    {
+        QMutexLocker snapshotLocker(&m_snapshotMutex);
+        m_stopping = true; // the writer drains the queue first
+        m_queueCondition.wakeAll();
+    }
+
+    m_writer->wait();
+    delete m_writer;
+    m_writer = 0;
+    m_dataFile.close();
+    m_indexFile.close();
+    m_open = false; // the archive can still be queried
+}
+
+void SpectrumArchive::getExtent(qint64& startTime, qint64& endTime, quint64& nbRows, quint64& dataSize)
+{
+    Snapshot snapshot = getSnapshot();
+    startTime = 0;
+    endTime = 0;
+    nbRows = snapshot.m_nbRows;
+    dataSize = snapshot.m_dataSize;
+
+    if (snapshot.m_index.size() > 0)
+    {
+        startTime = snapshot.m_index.front().m_startTime;
+        endTime = snapshot.m_index.back().m_endTime;
+    }
+
+    for (int i = 0; i <= snapshot.m_queued.size(); i++) // queued then current
+    {
+        const ChunkInfo& chunk = i < snapshot.m_queued.size() ? snapshot.m_queued[i].m_info : snapshot.m_current.m_info;
+
+        if (chunk.m_nbRows == 0) {
+            continue;
+        }
+
+        startTime = startTime == 0 ? chunk.m_startTime : startTime;
+        endTime = chunk.m_endTime;
+        nbRows += chunk.m_nbRows;
+    }
+}
+
+void SpectrumArchive::setSignal(qint64 centerFrequency, int sampleRate)
+{
+    QMutexLocker writeLocker(&m_writeMutex);
+
+    if ((centerFrequency != m_centerFrequency) || (sampleRate != m_sampleRate))
+    {
+        pushRow(); // the row belongs to the previous signal
+        m_centerFrequency = centerFrequency;
+        m_sampleRate = sampleRate;
+    }
+}
+
+void SpectrumArchive::write(const std::vector<Real>& powers, int nbBins, bool linear)
+{
+    if (!m_open) {
+        return;
+    }
+
+    QMutexLocker writeLocker(&m_writeMutex);
+
+    if (!m_open) {
+        return;
+    }
+
+    qint64 now = QDateTime::currentMSecsSinceEpoch();
+
+    if ((m_pendingTime != 0) && (nbBins != m_pendingBins)) {
+        pushRow();
+    }
+
+    if (m_pendingTime == 0)
+    {
+        m_pending.assign(nbBins, -std::numeric_limits<float>::infinity());
+        m_pendingBins = nbBins;
+        m_pendingTime = now;
+    }
+
+    for (int i = 0; i < nbBins; i++)
+    {
+        float v = linear ? 10.0f * log10f(powers[i] > 1e-20f ? powers[i] : 1e-20f) : powers[i];
+        m_pending[i] = v > m_pending[i] ? v : m_pending[i];
+    }
+
+    if (now - m_pendingTime >= m_rowPeriod) {
+        pushRow();
+    }
+}
+
+void SpectrumArchive::pushRow()
+{
+    if (m_pendingTime == 0) {
+        return;
+    }
+
+    if (m_sampleRate <= 0) // frequency unknown
+    {
+        m_pendingTime = 0;
+        return;
+    }
+
+    if ((m_chunk.m_nbRows > 0)
+        && ((m_chunk.m_centerFrequency != m_centerFrequency)
+         || (m_chunk.m_sampleRate != m_sampleRate)
+         || (m_chunk.m_nbBins != m_pendingBins)
+         || (m_chunk.m_nbRows >= m_maxChunkRows)
+         || (m_pendingTime - m_chunk.m_startTime >= m_maxChunkDuration)))
+    {
+        flushChunk();
+    }
+
+    if (m_chunk.m_nbRows == 0)
+    {
+        m_chunk.m_startTime = m_pendingTime;
+        m_chunk.m_centerFrequency = m_centerFrequency;
+        m_chunk.m_sampleRate = m_sampleRate;
+        m_chunk.m_nbBins = m_pendingBins;
+    }
+
+    float peak = *std::max_element(m_pending.begin(), m_pending.end());
+    QByteArray rowData(m_rowHeaderSize + m_pendingBins, 0);
+    char *row = rowData.data();
+    memcpy(row, &m_pendingTime, sizeof(qint64)); // host order
+    memcpy(row + sizeof(qint64), &peak, sizeof(float));
+    uint8_t *values = (uint8_t *) (row + m_rowHeaderSize);
+
+    for (int i = 0; i < m_pendingBins; i++)
+    {
+        float q = (peak - m_pending[i]) / m_dbStep + 0.5f;
+        values[i] = q < 254.0f ? (uint8_t) q : 254;
+    }
+
+    m_chunk.m_endTime = m_pendingTime + 1;
+    m_chunk.m_nbRows++;
+    m_pendingTime = 0;
+
+    QMutexLocker snapshotLocker(&m_snapshotMutex);
+    m_snapshot.m_current.m_info = m_chunk;
+    m_snapshot.m_current.m_rows.append(rowData);
+}
+
+void SpectrumArchive::flushChunk()
+{
+    if (m_chunk.m_nbRows == 0) {
+        return;
+    }
+
+    QMutexLocker snapshotLocker(&m_snapshotMutex);
+    m_snapshot.m_queued.append(m_snapshot.m_current);
+    m_snapshot.m_current = PendingChunk();
+    m_queueCondition.wakeAll();
+    m_chunk.m_nbRows = 0;
+}
+
+void SpectrumArchive::writeChunks()
+{
+    QMutexLocker snapshotLocker(&m_snapshotMutex);
+
+    while (true)
+    {
+        while (!m_stopping && m_snapshot.m_queued.isEmpty()) {
+            m_queueCondition.wait(&m_snapshotMutex);
+        }
+
+        if (m_snapshot.m_queued.isEmpty()) { // stopping with nothing left to write
+            return;
+        }
+
+        PendingChunk pending = m_snapshot.m_queued.front();
+        snapshotLocker.unlock();
+
+        // compression and disk I/O without any lock. The chunk stays queued so that queries still see it
+        bool written = writeChunk(pending.m_info, joinRows(pending.m_rows));
+
+        snapshotLocker.relock();
+        m_snapshot.m_queued.remove(0);
+
+        if (written)
+        {
+            m_snapshot.m_index.append(pending.m_info);
+            m_snapshot.m_nbRows += pending.m_info.m_nbRows;
+            m_snapshot.m_dataSize += pending.m_info.m_size;
+        }
+    }
+}
+
+bool SpectrumArchive::writeChunk(ChunkInfo& chunk, const QByteArray& data)
+{
+    QByteArray compressed = qCompress(data);
+
+    if (m_dataFile.isOpen() && (m_dataFile.size() + compressed.size() > m_maxDataFileSize))
+    {
+        m_dataFile.close();
+        m_fileNumber++;
+        openDataFile();
+    }
+
+    chunk.m_fileNumber = m_fileNumber;
+    chunk.m_offset = m_dataFile.size();
+    chunk.m_size = compressed.size();
+
+    if (!m_dataFile.isOpen() || (m_dataFile.write(compressed) != compressed.size()))
+    {
+        qWarning("SpectrumArchive::writeChunk: cannot write %s: %d rows lost",
+                qPrintable(m_dataFile.fileName()), chunk.m_nbRows);
+        return false;
+    }
+
+    m_dataFile.flush();
+
+    // the index is written after the data so that an indexed chunk is always complete
+    QDataStream out(&m_indexFile);
+    out << chunk.m_startTime << chunk.m_endTime << chunk.m_centerFrequency
+        << chunk.m_sampleRate << chunk.m_nbBins << chunk.m_nbRows
+        << chunk.m_fileNumber << chunk.m_offset << chunk.m_size;
+    m_indexFile.flush();
+    return true;
+}
+
+QByteArray SpectrumArchive::joinRows(const QVector<QByteArray>& rows)
+{
+    QByteArray data;
+
+    if (rows.size() > 0) {
+        data.reserve(rows.size() * rows.front().size());
+    }
+
+    for (QVector<QByteArray>::const_iterator it = rows.begin(); it != rows.end(); ++it) {
+        data.append(*it);
+    }
+
+    return data;
+}
+
+bool SpectrumArchive::loadIndex(QVector<ChunkInfo>& index, quint64& nbRows, quint64& dataSize)
+{
+    static const qint64 headerSize = 8;
+    static const qint64 recordSize = 52;
+
+    index.clear();
+    nbRows = 0;
+    dataSize = 0;
+    m_fileNumber = 0;
+    m_indexFile.setFileName(m_directory + "/spectrum.idx");
+
+    if (m_indexFile.exists() && (m_indexFile.size() > 0))
+    {
+        if (!m_indexFile.open(QIODevice::ReadOnly))
+        {
+            qWarning("SpectrumArchive::loadIndex: cannot read %s", qPrintable(m_indexFile.fileName()));
+            return false;
+        }
+
+        QDataStream in(&m_indexFile);
+        quint32 magic;
+        qint32 version;
+        in >> magic >> version;
+
+        if ((magic != m_indexMagic) || (version != m_indexVersion))
+        {
+            qWarning("SpectrumArchive::loadIndex: %s is not a spectrum archive index", qPrintable(m_indexFile.fileName()));
+            m_indexFile.close();
+            return false;
+        }
+
+        while (!in.atEnd())
+        {
+            ChunkInfo chunk;
+            in >> chunk.m_startTime >> chunk.m_endTime >> chunk.m_centerFrequency
+               >> chunk.m_sampleRate >> chunk.m_nbBins >> chunk.m_nbRows
+               >> chunk.m_fileNumber >> chunk.m_offset >> chunk.m_size;
+
+            if (in.status() != QDataStream::Ok) { // record cut short
+                break;
+            }
+
+            index.push_back(chunk);
+            nbRows += chunk.m_nbRows;
+            dataSize += chunk.m_size;
+            m_fileNumber = chunk.m_fileNumber >= m_fileNumber ? chunk.m_fileNumber + 1 : m_fileNumber;
+        }
+
+        m_indexFile.close();
+
+        if (!m_indexFile.open(QIODevice::WriteOnly | QIODevice::Append)) {
+            return false;
+        }
+
+        m_indexFile.resize(headerSize + recordSize * index.size()); // drop a partial record
+    }
+    else
+    {
+        if (!m_indexFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            return false;
+        }
+
+        QDataStream out(&m_indexFile);
+        out << m_indexMagic << m_indexVersion;
+        m_indexFile.flush();
+    }
+
+    return true;
+}
+
+bool SpectrumArchive::openDataFile()
+{
+    // a new data file per session so that a data file is never appended after a crash
+    m_dataFile.setFileName(dataFileName(m_directory, m_fileNumber));
+
+    if (!m_dataFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning("SpectrumArchive::openDataFile: cannot open %s", qPrintable(m_dataFile.fileName()));
+        return false;
+    }
+
+    return true;
+}
+
+QString SpectrumArchive::dataFileName(const QString& directory, int fileNumber)
+{
+    return QString("%1/spectrum-%2.dat").arg(directory).arg(fileNumber, 4, 10, QChar('0'));
+}
+
+SpectrumArchive::Snapshot SpectrumArchive::getSnapshot()
+{
+    QMutexLocker snapshotLocker(&m_snapshotMutex);
+    return m_snapshot;
+}
+
+bool SpectrumArchive::getChunkData(const Snapshot& snapshot, int index, QByteArray& data)
+{
+    const ChunkInfo& chunk = snapshot.m_index[index];
+
+    {
+        QMutexLocker cacheLocker(&m_cacheMutex);
+
+        for (std::list<CachedChunk>::iterator it = m_cache.begin(); it != m_cache.end(); ++it)
+        {
+            if ((it->m_generation == snapshot.m_generation) && (it->m_index == index))
+            {
+                data = it->m_data;
+                m_cache.splice(m_cache.begin(), m_cache, it);
+                return true;
+            }
+        }
+    }
+
+    QFile file(dataFileName(snapshot.m_directory, chunk.m_fileNumber));
+
+    if (!file.open(QIODevice::ReadOnly) || !file.seek(chunk.m_offset)) {
+        return false;
+    }
+
+    data = qUncompress(file.read(chunk.m_size));
+
+    if (data.size() != chunk.m_nbRows * (m_rowHeaderSize + chunk.m_nbBins)) {
+        return false;
+    }
+
+    QMutexLocker cacheLocker(&m_cacheMutex);
+    CachedChunk cached;
+    cached.m_generation = snapshot.m_generation;
+    cached.m_index = index;
+    cached.m_data = data;
+    m_cache.push_front(cached);
+
+    if (m_cache.size() > m_cacheSize) {
+        m_cache.pop_back();
+    }
+
+    return true;
+}
+
+bool SpectrumArchive::query(Window& window)
+{
+    if ((window.m_nbRows <= 0) || (window.m_nbColumns <= 0) || (window.m_endTime <= window.m_startTime)) {
+        return false;
+    }
+
+    // a chunk is either in the index, queued or current in a given snapshot thus never counted twice
+    Snapshot snapshot = getSnapshot();
+    QVector<PendingChunk> pendingChunks = snapshot.m_queued;
+
+    if (snapshot.m_current.m_info.m_nbRows > 0) {
+        pendingChunks.append(snapshot.m_current);
+    }
+
+    if ((snapshot.m_index.size() == 0) && (pendingChunks.size() == 0)) {
+        return false;
+    }
+
+    std::vector<int> chunkIndexes;
+    std::vector<int> pendingIndexes;
+    bool allFrequencies = (window.m_startFrequency == 0) && (window.m_endFrequency == 0);
+    qint64 minFrequency = std::numeric_limits<qint64>::max();
+    qint64 maxFrequency = std::numeric_limits<qint64>::min();
+
+    for (int i = 0; i < snapshot.m_index.size(); i++)
+    {
+        const ChunkInfo& chunk = snapshot.m_index[i];
+
+        if ((chunk.m_startTime < window.m_endTime) && (chunk.m_endTime > window.m_startTime))
+        {
+            chunkIndexes.push_back(i);
+            minFrequency = std::min(minFrequency, chunk.getStartFrequency());
+            maxFrequency = std::max(maxFrequency, chunk.getEndFrequency());
+        }
+    }
+
+    for (int i = 0; i < pendingChunks.size(); i++)
+    {
+        const ChunkInfo& chunk = pendingChunks[i].m_info;
+
+        if ((chunk.m_startTime < window.m_endTime) && (chunk.m_endTime > window.m_startTime))
+        {
+            pendingIndexes.push_back(i);
+            minFrequency = std::min(minFrequency, chunk.getStartFrequency());
+            maxFrequency = std::max(maxFrequency, chunk.getEndFrequency());
+        }
+    }
+
+    if (allFrequencies && (minFrequency < maxFrequency))
+    {
+        window.m_startFrequency = minFrequency;
+        window.m_endFrequency = maxFrequency;
+    }
+
+    std::vector<float> grid(window.m_nbRows * window.m_nbColumns, -std::numeric_limits<float>::infinity());
+    window.m_nbArchiveRows = 0;
+
+    if (window.m_endFrequency > window.m_startFrequency)
+    {
+        QByteArray data;
+
+        for (std::vector<int>::const_iterator it = chunkIndexes.begin(); it != chunkIndexes.end(); ++it)
+        {
+            const ChunkInfo& chunk = snapshot.m_index[*it];
+
+            if ((chunk.getStartFrequency() >= window.m_endFrequency) || (chunk.getEndFrequency() <= window.m_startFrequency)) {
+                continue;
+            }
+
+            if (getChunkData(snapshot, *it, data)) {
+                accumulateChunk(chunk, data, window, grid, window.m_nbArchiveRows);
+            } else {
+                qWarning("SpectrumArchive::query: cannot read chunk %d", *it);
+            }
+        }
+
+        for (std::vector<int>::const_iterator it = pendingIndexes.begin(); it != pendingIndexes.end(); ++it)
+        {
+            const PendingChunk& pending = pendingChunks[*it];
+
+            if ((pending.m_info.getStartFrequency() < window.m_endFrequency) && (pending.m_info.getEndFrequency() > window.m_startFrequency)) {
+                accumulateChunk(pending.m_info, joinRows(pending.m_rows), window, grid, window.m_nbArchiveRows);
+            }
+        }
+    }
+
+    // quantise the window below its peak
+    float peak = -std::numeric_limits<float>::infinity();
+
+    for (std::vector<float>::const_iterator it = grid.begin(); it != grid.end(); ++it) {
+        peak = *it > peak ? *it : peak;
+    }
+
+    window.m_dbMax = std::isinf(peak) ? 0.0f : peak;
+    window.m_values.resize(grid.size());
+
+    for (unsigned int i = 0; i < grid.size(); i++)
+    {
+        if (std::isinf(grid[i]))
+        {
+            window.m_values[i] = m_noData;
+        }
+        else
+        {
+            float q = (window.m_dbMax - grid[i]) / m_dbStep + 0.5f;
+            window.m_values[i] = q < 254.0f ? (uint8_t) q : 254;
+        }
+    }
+
+    return true;
+}
+
+void SpectrumArchive::accumulateChunk(const ChunkInfo& chunk, const QByteArray& data, const Window& window, std::vector<float>& grid, unsigned int& nbRows)
+{
+    int rowSize = m_rowHeaderSize + chunk.m_nbBins;
+    int nbChunkRows = data.size() / rowSize;
+    double binWidth = chunk.m_sampleRate / (double) chunk.m_nbBins;
+    double columnWidth = (window.m_endFrequency - window.m_startFrequency) / (double) window.m_nbColumns;
+    double binOffset = chunk.getStartFrequency() - window.m_startFrequency; // first bin start in the window
+    qint64 duration = window.m_endTime - window.m_startTime;
+
+    // when bins are denser than columns each bin is max held in its column
+    // otherwise each column takes the bin at its center
+    bool binsToColumns = binWidth < columnWidth;
+    std::vector<int> map(binsToColumns ? chunk.m_nbBins : window.m_nbColumns);
+
+    for (unsigned int i = 0; i < map.size(); i++)
+    {
+        if (binsToColumns)
+        {
+            double c = floor((binOffset + (i + 0.5) * binWidth) / columnWidth);
+            map[i] = (c >= 0) && (c < window.m_nbColumns) ? (int) c : -1;
+        }
+        else
+        {
+            double b = floor(((i + 0.5) * columnWidth - binOffset) / binWidth);
+            map[i] = (b >= 0) && (b < chunk.m_nbBins) ? (int) b : -1;
+        }
+    }
+
+    const char *row = data.constData();
+
+    for (int r = 0; r < nbChunkRows; r++, row += rowSize)
+    {
+        qint64 timestamp;
+        float peak;
+        memcpy(&timestamp, row, sizeof(qint64));
+        memcpy(&peak, row + sizeof(qint64), sizeof(float));
+
+        if ((timestamp < window.m_startTime) || (timestamp >= window.m_endTime)) {
+            continue;
+        }
+
+        float *gridRow = &grid[((timestamp - window.m_startTime) * window.m_nbRows / duration) * window.m_nbColumns];
+        const uint8_t *values = (const uint8_t *) (row + m_rowHeaderSize);
+
+        if (binsToColumns)
+        {
+            for (int b = 0; b < chunk.m_nbBins; b++)
+            {
+                int c = map[b];
+                float v = peak - values[b] * m_dbStep;
+
+                if ((c >= 0) && (v > gridRow[c])) {
+                    gridRow[c] = v;
+                }
+            }
+        }
+        else
+        {
+            for (int c = 0; c < window.m_nbColumns; c++)
+            {
+                int b = map[c];
+
+                if (b >= 0)
+                {
+                    float v = peak - values[b] * m_dbStep;
+                    gridRow[c] = v > gridRow[c] ? v : gridRow[c];
+                }
+            }
+        }
+
+        nbRows++;
+    }
+}
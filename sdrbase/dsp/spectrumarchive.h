@@ -0,0 +1,203 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Spectrum history archive                                                      //
+//                                                                               //
+// The spectrum engine output is kept on disk for hours of scroll back. Frames   //
+// are max held over a row period then the row is quantised in 0.5 dB steps      //
+// below its peak (one byte per bin). Rows are grouped in chunks of constant     //
+// center frequency, sample rate and FFT size that are compressed and appended   //
+// to data files by a writer thread so that the spectrum engine never waits for  //
+// the disk. Each chunk is indexed by time and frequency range in an index file  //
+// that is loaded when the archive is opened again.                              //
+//                                                                               //
+// A query returns a time x frequency window of any size decimated by max hold.  //
+// It works on a snapshot of the index and of the chunks not written yet so that //
+// it never waits for the writer. Only the chunks overlapping the window are     //
+// read and the last decompressed chunks are cached so that zooming is fast.     //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SPECTRUMARCHIVE_H_
+#define SDRBASE_DSP_SPECTRUMARCHIVE_H_
+
+#include <stdint.h>
+#include <vector>
+#include <list>
+
+#include <QString>
+#include <QByteArray>
+#include <QVector>
+#include <QFile>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QThread>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+class SDRBASE_API SpectrumArchive
+{
+public:
+    /** Query window. Set the range and size then the archive fills in the values */
+    struct Window
+    {
+        Window() :
+            m_startTime(0),
+            m_endTime(0),
+            m_startFrequency(0),
+            m_endFrequency(0),
+            m_nbRows(0),
+            m_nbColumns(0),
+            m_dbMax(0.0f),
+            m_nbArchiveRows(0)
+        {}
+
+        qint64 m_startTime;      //!< ms since epoch
+        qint64 m_endTime;        //!< ms since epoch. Excluded
+        qint64 m_startFrequency; //!< Hz. 0 with m_endFrequency 0 for the whole archived range
+        qint64 m_endFrequency;   //!< Hz
+        int m_nbRows;            //!< time buckets. The first row is the oldest
+        int m_nbColumns;         //!< frequency buckets
+        float m_dbMax;           //!< power (dB) of value 0
+        std::vector<uint8_t> m_values; //!< rows of columns. Power is m_dbMax - value*m_dbStep or m_noData
+        unsigned int m_nbArchiveRows;  //!< number of archived rows in the window
+    };
+
+    SpectrumArchive();
+    ~SpectrumArchive();
+
+    /** Starts recording in directory appending to its existing archive. A row is archived every rowPeriod ms */
+    bool open(const QString& directory, int rowPeriod);
+    void close();
+    bool isOpen() const { return m_open; }
+    QString getDirectory() const { return m_directory; }
+    int getRowPeriod() const { return m_rowPeriod; }
+    /** Time range, number of rows and data files size of the archive */
+    void getExtent(qint64& startTime, qint64& endTime, quint64& nbRows, quint64& dataSize);
+
+    /** Called from the spectrum engine thread */
+    void setSignal(qint64 centerFrequency, int sampleRate);
+    void write(const std::vector<Real>& powers, int nbBins, bool linear);
+
+    /** Called from any thread. Returns false if nothing is archived */
+    bool query(Window& window);
+
+    static const float m_dbStep;
+    static const uint8_t m_noData = 255;
+
+private:
+    struct ChunkInfo
+    {
+        qint64 m_startTime;
+        qint64 m_endTime;
+        qint64 m_centerFrequency;
+        qint32 m_sampleRate;
+        qint32 m_nbBins;
+        qint32 m_nbRows;
+        qint32 m_fileNumber;
+        qint64 m_offset;
+        qint32 m_size;   //!< compressed size
+        qint64 getStartFrequency() const { return m_centerFrequency - m_sampleRate/2; }
+        qint64 getEndFrequency() const { return m_centerFrequency + m_sampleRate/2; }
+    };
+
+    /** Chunk not written to disk yet */
+    struct PendingChunk
+    {
+        PendingChunk() { m_info.m_nbRows = 0; }
+
+        ChunkInfo m_info;
+        QVector<QByteArray> m_rows; //!< one array per row
+    };
+
+    /** What the readers see. The containers are implicitly shared so that a copy is cheap and never changes */
+    struct Snapshot
+    {
+        Snapshot() : m_generation(0), m_nbRows(0), m_dataSize(0) {}
+
+        int m_generation;               //!< incremented at each open
+        QString m_directory;
+        QVector<ChunkInfo> m_index;     //!< chunks written to disk
+        QVector<PendingChunk> m_queued; //!< chunks waiting for the writer thread. Oldest first
+        PendingChunk m_current;         //!< chunk being filled
+        quint64 m_nbRows;               //!< of the chunks written to disk
+        quint64 m_dataSize;
+    };
+
+    struct CachedChunk
+    {
+        int m_generation;
+        int m_index;
+        QByteArray m_data;
+    };
+
+    class Writer : public QThread
+    {
+    public:
+        Writer(SpectrumArchive *archive) : m_archive(archive) {}
+    private:
+        SpectrumArchive *m_archive;
+        void run() { m_archive->writeChunks(); }
+    };
+
+    // spectrum engine thread side. Guarded by m_writeMutex
+    QMutex m_writeMutex;
+    volatile bool m_open;
+    QString m_directory;
+    int m_rowPeriod;
+    qint64 m_centerFrequency;
+    int m_sampleRate;
+    std::vector<float> m_pending;  //!< max held row (dB)
+    int m_pendingBins;
+    qint64 m_pendingTime;
+    ChunkInfo m_chunk;             //!< chunk being filled
+    Writer *m_writer;
+
+    // writer thread side. Touched by open and close only when the writer is stopped
+    QFile m_dataFile;
+    QFile m_indexFile;
+    int m_fileNumber;
+
+    // shared state. m_snapshotMutex is only held to copy or update m_snapshot
+    QMutex m_snapshotMutex;
+    QWaitCondition m_queueCondition; //!< wakes the writer thread
+    bool m_stopping;
+    Snapshot m_snapshot;
+    QMutex m_cacheMutex;
+    std::list<CachedChunk> m_cache; //!< most recent first
+
+    static const int m_maxChunkRows = 256;
+    static const qint64 m_maxChunkDuration = 60000; //!< ms
+    static const qint64 m_maxDataFileSize = 64*1024*1024;
+    static const unsigned int m_cacheSize = 32;
+    static const int m_rowHeaderSize = 12; //!< timestamp (qint64) and peak (float)
+    static const quint32 m_indexMagic = 0x53504543; //!< SPEC
+    static const qint32 m_indexVersion = 1;
+
+    bool loadIndex(QVector<ChunkInfo>& index, quint64& nbRows, quint64& dataSize);
+    bool openDataFile();
+    void pushRow();
+    void flushChunk();
+    void writeChunks();             //!< writer thread loop
+    bool writeChunk(ChunkInfo& chunk, const QByteArray& data);
+    Snapshot getSnapshot();
+    bool getChunkData(const Snapshot& snapshot, int index, QByteArray& data);
+    void accumulateChunk(const ChunkInfo& chunk, const QByteArray& data, const Window& window, std::vector<float>& grid, unsigned int& nbRows);
+    static QByteArray joinRows(const QVector<QByteArray>& rows);
+    static QString dataFileName(const QString& directory, int fileNumber);
+};
+
+#endif /* SDRBASE_DSP_SPECTRUMARCHIVE_H_ */
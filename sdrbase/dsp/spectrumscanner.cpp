@@ -0,0 +1,701 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <algorithm>
+
+#include <QDebug>
+#include <QMutexLocker>
+
+#include "dsp/dspdevicesourceengine.h"
+#include "dsp/dspcommands.h"
+#include "dsp/fftengine.h"
+#include "spectrumscanner.h"
+
+const Real SpectrumScanner::m_noData = -200.0f;
+const Real SpectrumScanner::m_mult = (10.0f / log2f(10.0f));
+
+SpectrumScanner::Settings::Settings()
+{
+    resetToDefaults();
+}
+
+void SpectrumScanner::Settings::resetToDefaults()
+{
+    m_startFrequency = 0;
+    m_endFrequency = 0;
+    m_fftSize = 1024;
+    m_nbAverages = 8;
+    m_usableBandwidth = 0.8f;
+    m_overlap = 0.1f;
+    m_settlingTime = 5000;
+    m_retuneTimeout = 500;
+    m_window = FFTWindow::BlackmanHarris;
+    m_nbWorkers = 0;
+    m_continuous = false;
+}
+
+void SpectrumScanner::Report::reset()
+{
+    m_nbSteps = 0;
+    m_sweepTime = 0.0;
+    m_stepsPerSecond = 0.0;
+    m_retuneTime = 0.0;
+    m_fftTime = 0.0;
+    m_acquiredSamples = 0;
+    m_discardedSamples = 0;
+    m_nbTimeouts = 0;
+    m_maxPendingJobs = 0;
+}
+
+SpectrumScanner::SpectrumScanner() :
+    m_scanning(false),
+    m_state(StIdle),
+    m_engine(0),
+    m_sampleRate(0),
+    m_centerFrequency(0),
+    m_initialFrequency(0),
+    m_nbGridBins(0),
+    m_usableBins(0),
+    m_stepBins(0),
+    m_nbSteps(0),
+    m_step(0),
+    m_stepFrequency(0),
+    m_waitSamples(0),
+    m_settlingSamples(0),
+    m_timeoutSamples(1),
+    m_sweep(0),
+    m_job(0),
+    m_workersRunning(false),
+    m_fftSize(0),
+    m_spectrumStartFrequency(0),
+    m_spectrumBinWidth(0.0),
+    m_sweepCount(0)
+{
+    setObjectName("SpectrumScanner");
+}
+
+SpectrumScanner::~SpectrumScanner()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    abortSweep();
+    m_scanning = false;
+    stopWorkers();
+    delete m_job;
+}
+
+void SpectrumScanner::setEngine(DSPDeviceSourceEngine *engine)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_scanning)
+    {
+        abortSweep();
+        m_scanning = false;
+        m_state = StIdle;
+    }
+
+    m_engine = engine;
+}
+
+bool SpectrumScanner::startScan(const Settings& settings)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_engine == 0) {
+        return false;
+    }
+
+    Settings previousSettings = m_settings;
+    m_settings = settings;
+
+    if (!plan())
+    {
+        qWarning("SpectrumScanner::startScan: cannot scan %lld to %lld Hz with FFT size %d at %d S/s",
+            settings.m_startFrequency, settings.m_endFrequency, settings.m_fftSize, m_sampleRate);
+        m_settings = previousSettings;
+
+        if (m_scanning) {
+            plan(); // carry on with the current scan
+        }
+
+        return false;
+    }
+
+    if (m_scanning) {
+        abortSweep();
+    } else {
+        m_initialFrequency = m_centerFrequency;
+    }
+
+    int nbWorkers = settings.m_nbWorkers > 0 ? settings.m_nbWorkers : std::max(1, QThread::idealThreadCount() - 1);
+
+    // the workers share the FFT window
+    if ((nbWorkers != (int) m_workers.size()) || (settings.m_fftSize != m_fftSize) || (settings.m_window != previousSettings.m_window))
+    {
+        stopWorkers();
+        m_window.create(settings.m_window, settings.m_fftSize);
+        m_fftSize = settings.m_fftSize;
+        startWorkers(nbWorkers);
+    }
+
+    qDebug() << "SpectrumScanner::startScan:"
+        << " startFrequency: " << settings.m_startFrequency
+        << " endFrequency: " << settings.m_endFrequency
+        << " sampleRate: " << m_sampleRate
+        << " fftSize: " << settings.m_fftSize
+        << " nbSteps: " << m_nbSteps
+        << " nbWorkers: " << nbWorkers;
+
+    m_scanning = true;
+    startSweep();
+    return m_scanning; // false if the source could not be tuned
+}
+
+void SpectrumScanner::stopScan(bool restore)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_scanning) {
+        return;
+    }
+
+    abortSweep();
+    m_scanning = false;
+    m_state = StIdle;
+
+    if (restore) {
+        m_engine->setSourceCenterFrequency(m_initialFrequency);
+    }
+}
+
+SpectrumScanner::Settings SpectrumScanner::getSettings()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_settings;
+}
+
+bool SpectrumScanner::getSpectrum(std::vector<Real>& spectrum, qint64& startFrequency, double& binWidth, Report& report)
+{
+    QMutexLocker mutexLocker(&m_resultMutex);
+
+    if (m_spectrum.size() == 0) {
+        return false;
+    }
+
+    spectrum = m_spectrum;
+    startFrequency = m_spectrumStartFrequency;
+    binWidth = m_spectrumBinWidth;
+    report = m_report;
+    return true;
+}
+
+bool SpectrumScanner::getReport(Report& report)
+{
+    QMutexLocker mutexLocker(&m_resultMutex);
+    report = m_report;
+    return m_spectrum.size() != 0;
+}
+
+bool SpectrumScanner::waitSweep(unsigned int sweepCount, unsigned long timeoutMs)
+{
+    QMutexLocker mutexLocker(&m_resultMutex);
+    QElapsedTimer timer;
+    timer.start();
+
+    while (m_sweepCount <= sweepCount)
+    {
+        qint64 remaining = (qint64) timeoutMs - timer.elapsed();
+
+        if (remaining <= 0) {
+            return false;
+        }
+
+        m_sweepCondition.wait(&m_resultMutex, remaining);
+    }
+
+    return true;
+}
+
+void SpectrumScanner::start()
+{
+}
+
+void SpectrumScanner::stop()
+{
+}
+
+void SpectrumScanner::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+    (void) positiveOnly;
+
+    if (!m_scanning) {
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+    SampleVector::const_iterator it = begin;
+
+    while ((it < end) && m_scanning)
+    {
+        int todo = end - it;
+
+        switch (m_state)
+        {
+        case StTuning:
+        {
+            int count = std::min(todo, m_timeoutSamples - m_waitSamples);
+            it += count;
+            m_waitSamples += count;
+            m_sweep->m_report.m_discardedSamples += count;
+
+            if (m_waitSamples >= m_timeoutSamples) {
+                startSettling(false);
+            }
+
+            break;
+        }
+        case StSettling:
+        {
+            int count = std::min(todo, m_settlingSamples - m_waitSamples);
+            it += count;
+            m_waitSamples += count;
+            m_sweep->m_report.m_discardedSamples += count;
+
+            if (m_waitSamples >= m_settlingSamples)
+            {
+                m_sweep->m_report.m_retuneTime += m_retuneTimer.nsecsElapsed() / 1e6;
+                m_waitSamples = 0;
+                m_state = StAcquiring;
+            }
+
+            break;
+        }
+        case StAcquiring:
+        {
+            int count = std::min(todo, (int) m_job->m_samples.size() - m_waitSamples);
+            Complex *p = &m_job->m_samples[m_waitSamples];
+
+            for (int i = 0; i < count; i++, ++it) {
+                p[i] = Complex(it->real() / SDR_RX_SCALEF, it->imag() / SDR_RX_SCALEF);
+            }
+
+            m_waitSamples += count;
+            m_sweep->m_report.m_acquiredSamples += count;
+
+            if (m_waitSamples == (int) m_job->m_samples.size())
+            {
+                dispatchJob();
+
+                if (++m_step < m_nbSteps)
+                {
+                    tuneStep();
+                }
+                else
+                {
+                    {
+                        QMutexLocker resultLocker(&m_resultMutex);
+                        m_sweep->m_complete = true;
+
+                        if (m_sweep->m_nbDone == m_sweep->m_nbDispatched) {
+                            finishSweep(m_sweep);
+                        }
+
+                        m_sweep = 0;
+                    }
+
+                    if (m_settings.m_continuous)
+                    {
+                        startSweep();
+                    }
+                    else
+                    {
+                        m_scanning = false;
+                        m_state = StIdle;
+                        m_engine->setSourceCenterFrequency(m_initialFrequency);
+                    }
+                }
+            }
+
+            break;
+        }
+        case StIdle:
+        default:
+            it = end;
+            break;
+        }
+    }
+}
+
+bool SpectrumScanner::handleMessage(const Message& message)
+{
+    if (DSPSignalNotification::match(message))
+    {
+        DSPSignalNotification& notif = (DSPSignalNotification&) message;
+        QMutexLocker mutexLocker(&m_mutex);
+        m_centerFrequency = notif.getCenterFrequency();
+
+        if (notif.getSampleRate() != m_sampleRate)
+        {
+            m_sampleRate = notif.getSampleRate();
+
+            if (m_scanning) // the steps change with the sample rate
+            {
+                abortSweep();
+
+                if (plan())
+                {
+                    startSweep();
+                }
+                else
+                {
+                    qWarning("SpectrumScanner::handleMessage: cannot scan at %d S/s", m_sampleRate);
+                    m_scanning = false;
+                    m_state = StIdle;
+                }
+            }
+        }
+        else if (m_scanning && (m_state == StTuning)
+            && (fabs((double) (m_centerFrequency - m_stepFrequency)) < m_sampleRate / (double) m_settings.m_fftSize))
+        {
+            startSettling(true);
+        }
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+bool SpectrumScanner::plan()
+{
+    const Settings& s = m_settings;
+
+    if ((m_sampleRate <= 0) || (s.m_fftSize < 16) || (s.m_fftSize > 65536) || ((s.m_fftSize & (s.m_fftSize - 1)) != 0)
+        || (s.m_nbAverages < 1) || (s.m_endFrequency <= s.m_startFrequency) || (s.m_startFrequency < 0)
+        || (s.m_usableBandwidth <= 0.0f) || (s.m_usableBandwidth > 1.0f) || (s.m_overlap < 0.0f) || (s.m_overlap >= 1.0f))
+    {
+        return false;
+    }
+
+    double binWidth = m_sampleRate / (double) s.m_fftSize;
+    qint64 nbGridBins = (qint64) ((s.m_endFrequency - s.m_startFrequency) / binWidth) + 1;
+
+    if (nbGridBins > (1<<24)) {
+        return false;
+    }
+
+    m_nbGridBins = nbGridBins;
+    m_usableBins = std::max(2, ((int) (s.m_fftSize * s.m_usableBandwidth)) & ~1);
+    int overlapBins = std::min(m_usableBins - 1, (int) roundf(m_usableBins * s.m_overlap));
+    m_stepBins = m_usableBins - overlapBins;
+    m_nbSteps = m_nbGridBins <= m_usableBins ? 1 : 1 + (m_nbGridBins - m_usableBins + m_stepBins - 1) / m_stepBins;
+    m_settlingSamples = ((qint64) s.m_settlingTime * m_sampleRate) / 1000000;
+    m_timeoutSamples = std::max((qint64) 1, ((qint64) s.m_retuneTimeout * m_sampleRate) / 1000);
+    return true;
+}
+
+void SpectrumScanner::startSweep()
+{
+    m_sweep = new Sweep();
+    m_sweep->m_startFrequency = m_settings.m_startFrequency;
+    m_sweep->m_binWidth = m_sampleRate / (double) m_settings.m_fftSize;
+    m_sweep->m_fftSize = m_settings.m_fftSize;
+    m_sweep->m_nbAverages = m_settings.m_nbAverages;
+    m_sweep->m_usableBins = m_usableBins;
+    m_sweep->m_overlapBins = m_usableBins - m_stepBins;
+    m_sweep->m_power.assign(m_nbGridBins, 0.0);
+    m_sweep->m_weight.assign(m_nbGridBins, 0.0);
+    m_sweep->m_nbDispatched = 0;
+    m_sweep->m_nbDone = 0;
+    m_sweep->m_complete = false;
+    m_sweep->m_aborted = false;
+    m_sweep->m_report.m_nbSteps = m_nbSteps;
+    m_sweep->m_timer.start();
+
+    {
+        QMutexLocker resultLocker(&m_resultMutex);
+        m_sweeps.push_back(m_sweep);
+    }
+
+    if (m_job == 0) {
+        m_job = new Job();
+    }
+
+    m_job->m_samples.resize(m_settings.m_fftSize * m_settings.m_nbAverages);
+    m_step = 0;
+    tuneStep();
+}
+
+void SpectrumScanner::tuneStep()
+{
+    double binWidth = m_sweep->m_binWidth;
+
+    if (m_nbSteps == 1) { // center the range
+        m_stepFrequency = m_settings.m_startFrequency + llround((m_nbGridBins / 2) * binWidth);
+    } else {
+        m_stepFrequency = m_settings.m_startFrequency + llround((m_step * m_stepBins + m_usableBins / 2) * binWidth);
+    }
+
+    m_retuneTimer.start();
+    m_waitSamples = 0;
+
+    if (m_stepFrequency == m_centerFrequency) // no retune no settling
+    {
+        m_job->m_sweep = m_sweep;
+        m_job->m_firstBin = llround((m_centerFrequency - m_sweep->m_startFrequency) / binWidth) - m_sweep->m_fftSize / 2;
+        m_state = StAcquiring;
+    }
+    else if (m_engine->setSourceCenterFrequency(m_stepFrequency))
+    {
+        m_state = StTuning;
+    }
+    else // the source is gone
+    {
+        qWarning("SpectrumScanner::tuneStep: no source to tune");
+        abortSweep();
+        m_scanning = false;
+        m_state = StIdle;
+    }
+}
+
+void SpectrumScanner::startSettling(bool notified)
+{
+    // the source may have rounded the frequency: place the step where it actually is
+    qint64 frequency = notified ? m_centerFrequency : m_stepFrequency;
+
+    if (!notified)
+    {
+        qDebug("SpectrumScanner::startSettling: no report of %lld Hz from the source", m_stepFrequency);
+        m_sweep->m_report.m_nbTimeouts++;
+    }
+
+    m_job->m_sweep = m_sweep;
+    m_job->m_firstBin = llround((frequency - m_sweep->m_startFrequency) / m_sweep->m_binWidth) - m_sweep->m_fftSize / 2;
+    m_waitSamples = 0;
+    m_state = StSettling;
+}
+
+void SpectrumScanner::dispatchJob()
+{
+    {
+        QMutexLocker resultLocker(&m_resultMutex);
+        m_sweep->m_nbDispatched++;
+    }
+
+    QMutexLocker jobLocker(&m_jobMutex);
+    m_jobs.enqueue(m_job);
+    m_sweep->m_report.m_maxPendingJobs = std::max(m_sweep->m_report.m_maxPendingJobs, (unsigned int) m_jobs.size());
+    m_jobCondition.wakeOne();
+
+    if (m_freeJobs.size() > 0)
+    {
+        m_job = m_freeJobs.back();
+        m_freeJobs.pop_back();
+    }
+    else
+    {
+        m_job = new Job();
+    }
+
+    m_job->m_samples.resize(m_settings.m_fftSize * m_settings.m_nbAverages);
+}
+
+void SpectrumScanner::abortSweep()
+{
+    if (m_sweep == 0) {
+        return;
+    }
+
+    QMutexLocker resultLocker(&m_resultMutex);
+    m_sweep->m_aborted = true;
+
+    if (m_sweep->m_nbDone == m_sweep->m_nbDispatched) {
+        finishSweep(m_sweep);
+    }
+
+    m_sweep = 0;
+}
+
+void SpectrumScanner::finishSweep(Sweep *sweep)
+{
+    if (!sweep->m_aborted)
+    {
+        double scale = 1.0 / ((double) sweep->m_fftSize * sweep->m_fftSize * sweep->m_nbAverages);
+        m_spectrum.resize(sweep->m_power.size());
+
+        for (unsigned int i = 0; i < m_spectrum.size(); i++)
+        {
+            if (sweep->m_weight[i] > 0.0)
+            {
+                double v = (sweep->m_power[i] / sweep->m_weight[i]) * scale;
+                m_spectrum[i] = v > 0.0 ? m_mult * log2f(v) : m_noData;
+            }
+            else
+            {
+                m_spectrum[i] = m_noData;
+            }
+        }
+
+        m_spectrumStartFrequency = sweep->m_startFrequency;
+        m_spectrumBinWidth = sweep->m_binWidth;
+        m_report = sweep->m_report;
+        m_report.m_sweepTime = sweep->m_timer.nsecsElapsed() / 1e6;
+        m_report.m_stepsPerSecond = m_report.m_sweepTime > 0.0 ? (m_report.m_nbSteps * 1000.0) / m_report.m_sweepTime : 0.0;
+        m_report.m_retuneTime /= m_report.m_nbSteps;
+        m_report.m_fftTime /= m_report.m_nbSteps;
+        m_sweepCount++;
+        m_sweepCondition.wakeAll();
+    }
+
+    m_sweeps.remove(sweep);
+    delete sweep;
+}
+
+void SpectrumScanner::startWorkers(int nbWorkers)
+{
+    m_workersRunning = true;
+
+    for (int i = 0; i < nbWorkers; i++)
+    {
+        m_workers.push_back(new Worker(this));
+        m_workers.back()->start();
+    }
+}
+
+void SpectrumScanner::stopWorkers()
+{
+    {
+        QMutexLocker jobLocker(&m_jobMutex);
+        m_workersRunning = false;
+        m_jobCondition.wakeAll();
+    }
+
+    for (unsigned int i = 0; i < m_workers.size(); i++)
+    {
+        m_workers[i]->wait();
+        delete m_workers[i];
+    }
+
+    m_workers.clear();
+
+    // the jobs left belong to aborted sweeps
+    while (!m_jobs.isEmpty()) {
+        delete m_jobs.dequeue();
+    }
+
+    for (unsigned int i = 0; i < m_freeJobs.size(); i++) {
+        delete m_freeJobs[i];
+    }
+
+    m_freeJobs.clear();
+    QMutexLocker resultLocker(&m_resultMutex);
+
+    for (std::list<Sweep*>::iterator it = m_sweeps.begin(); it != m_sweeps.end(); ++it) {
+        delete *it;
+    }
+
+    m_sweeps.clear();
+}
+
+void SpectrumScanner::work()
+{
+    FFTEngine *fft = FFTEngine::create();
+    std::vector<double> power;
+    int fftSize = 0;
+
+    while (true)
+    {
+        Job *job;
+
+        {
+            QMutexLocker jobLocker(&m_jobMutex);
+
+            while (m_workersRunning && m_jobs.isEmpty()) {
+                m_jobCondition.wait(&m_jobMutex);
+            }
+
+            if (!m_workersRunning) {
+                break;
+            }
+
+            job = m_jobs.dequeue();
+        }
+
+        if (job->m_sweep->m_fftSize != fftSize)
+        {
+            fftSize = job->m_sweep->m_fftSize;
+            fft->configure(fftSize, false);
+        }
+
+        processJob(*job, fft, power);
+        QMutexLocker jobLocker(&m_jobMutex);
+        m_freeJobs.push_back(job);
+    }
+
+    delete fft;
+}
+
+void SpectrumScanner::processJob(Job& job, FFTEngine *fft, std::vector<double>& power)
+{
+    QElapsedTimer timer;
+    timer.start();
+    Sweep *sweep = job.m_sweep;
+    int fftSize = sweep->m_fftSize;
+    int halfSize = fftSize / 2;
+    power.assign(fftSize, 0.0);
+
+    for (int a = 0; a < sweep->m_nbAverages; a++)
+    {
+        m_window.apply(&job.m_samples[a * fftSize], fft->in());
+        fft->transform();
+        const Complex *fftOut = fft->out();
+
+        for (int i = 0; i < fftSize; i++) // negative frequencies first
+        {
+            const Complex& c = fftOut[i];
+            power[i < halfSize ? i + halfSize : i - halfSize] += c.real() * c.real() + c.imag() * c.imag();
+        }
+    }
+
+    // usable bins. The weight ramps up over the overlap so that neighbour steps cross fade
+    int begin = halfSize - sweep->m_usableBins / 2;
+    int end = halfSize + sweep->m_usableBins / 2;
+    int nbGridBins = sweep->m_power.size();
+    QMutexLocker resultLocker(&m_resultMutex);
+
+    for (int i = begin; i < end; i++)
+    {
+        int g = job.m_firstBin + i;
+
+        if ((g >= 0) && (g < nbGridBins))
+        {
+            double weight = std::min(std::min(i - begin, end - 1 - i), sweep->m_overlapBins) + 1;
+            sweep->m_power[g] += weight * power[i];
+            sweep->m_weight[g] += weight;
+        }
+    }
+
+    sweep->m_nbDone++;
+    sweep->m_report.m_fftTime += timer.nsecsElapsed() / 1e6;
+
+    if ((sweep->m_complete || sweep->m_aborted) && (sweep->m_nbDone == sweep->m_nbDispatched)) {
+        finishSweep(sweep);
+    }
+}
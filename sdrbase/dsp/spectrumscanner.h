@@ -0,0 +1,212 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Wideband spectrum scanner                                                     //
+//                                                                               //
+// Steps the sample source of a device set across a frequency range wider than   //
+// its bandwidth. The source is retuned through the device engine so that it     //
+// is never reached after the engine dropped it. It is fed with the baseband samples like the other sinks of    //
+// the device engine. After each retune it waits for the source to report the    //
+// new frequency (or for a timeout with sources that cannot retune), discards    //
+// the settling samples then collects the samples of the averaged FFTs of the    //
+// step. The FFTs run on a pool of worker threads so that the source is retuned  //
+// to the next step at once. The central part of each step is stitched in one    //
+// wide spectrum and the steps overlap by a few bins that are cross faded.       //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SPECTRUMSCANNER_H_
+#define SDRBASE_DSP_SPECTRUMSCANNER_H_
+
+#include <vector>
+#include <list>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+#include <QQueue>
+
+#include "dsp/basebandsamplesink.h"
+#include "dsp/fftwindow.h"
+#include "export.h"
+
+class DSPDeviceSourceEngine;
+class FFTEngine;
+
+class SDRBASE_API SpectrumScanner : public BasebandSampleSink {
+public:
+    struct Settings
+    {
+        qint64 m_startFrequency;  //!< Hz
+        qint64 m_endFrequency;    //!< Hz
+        int m_fftSize;            //!< power of two. The bin width is the sample rate divided by the FFT size
+        int m_nbAverages;         //!< FFTs averaged per step
+        float m_usableBandwidth;  //!< central fraction of the sample rate kept in each step (filter roll off)
+        float m_overlap;          //!< fraction of the usable bandwidth shared with the next step
+        int m_settlingTime;       //!< us of samples discarded after the source reported the new frequency
+        int m_retuneTimeout;      //!< ms of samples after which a step starts without the new frequency report
+        FFTWindow::Function m_window;
+        int m_nbWorkers;          //!< FFT threads. 0 for one less than the cores
+        bool m_continuous;        //!< restart at the first step after the last one
+
+        Settings();
+        void resetToDefaults();
+    };
+
+    struct Report
+    {
+        Report() { reset(); }
+        void reset();
+
+        unsigned int m_nbSteps;
+        double m_sweepTime;         //!< ms from the first retune to the last FFT
+        double m_stepsPerSecond;
+        double m_retuneTime;        //!< average ms per step from the retune to the first acquired sample
+        double m_fftTime;           //!< average ms of worker time per step
+        quint64 m_acquiredSamples;
+        quint64 m_discardedSamples; //!< waiting for the frequency report and settling
+        unsigned int m_nbTimeouts;  //!< steps started without the new frequency report
+        unsigned int m_maxPendingJobs;
+    };
+
+    SpectrumScanner();
+    virtual ~SpectrumScanner();
+
+    /** Engine of the swept source. Setting it stops the scan without restoring the frequency */
+    void setEngine(DSPDeviceSourceEngine *engine);
+    /** Starts sweeping the source. Fails if the settings are wrong, there is no engine or the sample rate is not known yet */
+    bool startScan(const Settings& settings);
+    /** Stops sweeping. The source goes back to its frequency before the scan if restore is set */
+    void stopScan(bool restore = true);
+    bool isScanning() const { return m_scanning; } //!< steps are being acquired
+    Settings getSettings();
+
+    /** Last completed sweep in dB. Returns false if there is none */
+    bool getSpectrum(std::vector<Real>& spectrum, qint64& startFrequency, double& binWidth, Report& report);
+    bool getReport(Report& report);
+    unsigned int getSweepCount() const { return m_sweepCount; }
+    /** Waits until the sweep count goes past sweepCount. Returns false on timeout */
+    bool waitSweep(unsigned int sweepCount, unsigned long timeoutMs);
+
+    virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+    virtual void start();
+    virtual void stop();
+    virtual bool handleMessage(const Message& message);
+
+    static const Real m_noData; //!< dB of the bins that no step covered
+
+private:
+    enum State
+    {
+        StIdle,
+        StTuning,    //!< waiting for the new frequency report
+        StSettling,
+        StAcquiring
+    };
+
+    /** Accumulation of the steps of one sweep */
+    struct Sweep
+    {
+        qint64 m_startFrequency;
+        double m_binWidth;
+        int m_fftSize;
+        int m_nbAverages;
+        int m_usableBins;
+        int m_overlapBins;
+        std::vector<double> m_power;  //!< weighted sums of the linear power
+        std::vector<double> m_weight;
+        unsigned int m_nbDispatched;
+        unsigned int m_nbDone;
+        bool m_complete;              //!< all steps dispatched
+        bool m_aborted;
+        QElapsedTimer m_timer;
+        Report m_report;
+    };
+
+    struct Job
+    {
+        Sweep *m_sweep;
+        int m_firstBin;               //!< grid bin of the first FFT bin
+        std::vector<Complex> m_samples;
+    };
+
+    class Worker : public QThread
+    {
+    public:
+        Worker(SpectrumScanner *scanner) : m_scanner(scanner) {}
+    private:
+        SpectrumScanner *m_scanner;
+        void run() { m_scanner->work(); }
+    };
+
+    // feeding side. Guarded by m_mutex
+    QMutex m_mutex;
+    volatile bool m_scanning;
+    State m_state;
+    Settings m_settings;
+    DSPDeviceSourceEngine *m_engine;
+    int m_sampleRate;
+    qint64 m_centerFrequency;     //!< last reported by the source
+    qint64 m_initialFrequency;    //!< before the scan
+    int m_nbGridBins;
+    int m_usableBins;
+    int m_stepBins;
+    int m_nbSteps;
+    int m_step;
+    qint64 m_stepFrequency;
+    int m_waitSamples;            //!< samples counted against the current state limit
+    int m_settlingSamples;
+    int m_timeoutSamples;
+    QElapsedTimer m_retuneTimer;
+    Sweep *m_sweep;
+    Job *m_job;
+
+    // worker side. Guarded by m_jobMutex
+    QMutex m_jobMutex;
+    QWaitCondition m_jobCondition;
+    QQueue<Job*> m_jobs;
+    std::vector<Job*> m_freeJobs;
+    std::vector<Worker*> m_workers;
+    bool m_workersRunning;
+    FFTWindow m_window;
+    int m_fftSize;
+
+    // results. Guarded by m_resultMutex
+    QMutex m_resultMutex;
+    QWaitCondition m_sweepCondition;
+    std::list<Sweep*> m_sweeps;   //!< sweeps with steps in flight
+    std::vector<Real> m_spectrum;
+    qint64 m_spectrumStartFrequency;
+    double m_spectrumBinWidth;
+    Report m_report;
+    volatile unsigned int m_sweepCount;
+
+    static const Real m_mult;
+
+    void startWorkers(int nbWorkers);
+    void stopWorkers();
+    void work();
+    void processJob(Job& job, FFTEngine *fft, std::vector<double>& power);
+    void finishSweep(Sweep *sweep);  //!< called with m_resultMutex held
+    void abortSweep();
+    bool plan();
+    void startSweep();
+    void tuneStep();
+    void startSettling(bool notified);
+    void dispatchJob();
+};
+
+#endif /* SDRBASE_DSP_SPECTRUMSCANNER_H_ */
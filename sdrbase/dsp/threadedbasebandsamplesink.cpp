@@ -33,6 +33,7 @@ void ThreadedBasebandSampleSinkFifo::handleFifoData() // FIXME: Fixed? Move it t
 		SampleVector::iterator part2begin;
 		SampleVector::iterator part2end;
 
+		BasebandSampleSink::FeedTimestampGuard feedTimestamp(m_sampleFifo.getWriteTimestamp()); // arrival time kept by the engine
 		std::size_t count = m_sampleFifo.readBegin(m_sampleFifo.fill(), &part1begin, &part1end, &part2begin, &part2end);
 
 		// first part of FIFO data
@@ -0,0 +1,433 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+
+#include "dsp/fftfilt.h"
+#include "util/db.h"
+
+#include "udpsinkpipeline.h"
+
+const Real UDPSinkPipeline::m_agcTarget = 16384.0f;
+
+UDPSinkPipeline::UDPSinkPipeline() :
+    m_format(FormatIQ16),
+    m_outputType(OutputS16Pairs),
+    m_inputSampleRate(48000),
+    m_outputSampleRate(48000),
+    m_rfBandwidth(12500),
+    m_gain(1.0f),
+    m_agcEnabled(false),
+    m_dtx(false),
+    m_sampleDistanceRemain(1.0f),
+    m_agc(9600, m_agcTarget, 1e-6),
+    m_inLevels(480),
+    m_outMovingAverage(480, 1e-10),
+    m_amMovingAverage(1200, 1e-10),
+    m_squelchEnabled(true),
+    m_squelch(1e-6),
+    m_squelchOpen(false),
+    m_squelchOpenCount(0),
+    m_squelchCloseCount(0),
+    m_squelchGate(4800),
+    m_squelchRelease(4800),
+    m_inMagsq(0),
+    m_magsq(0),
+    m_nbOutput(0)
+{
+    m_ssbFilter = new fftfilt(0.0, (m_rfBandwidth / 2.0) / m_outputSampleRate, m_ssbFftLen);
+    m_agc.setClampMax(SDR_RX_SCALED*SDR_RX_SCALED);
+    m_agc.setClamping(true);
+    m_nco.setFreq(0, m_inputSampleRate);
+    m_interpolator.create(16, m_inputSampleRate, m_rfBandwidth / 2.0);
+}
+
+UDPSinkPipeline::~UDPSinkPipeline()
+{
+    delete m_ssbFilter;
+}
+
+void UDPSinkPipeline::setInput(int inputSampleRate, int inputFrequencyOffset)
+{
+    m_nco.setFreq(-inputFrequencyOffset, inputSampleRate);
+
+    if (inputSampleRate != m_inputSampleRate)
+    {
+        m_interpolator.create(16, inputSampleRate, m_rfBandwidth / 2.0);
+        m_sampleDistanceRemain = inputSampleRate / m_outputSampleRate;
+    }
+
+    m_inputSampleRate = inputSampleRate;
+}
+
+void UDPSinkPipeline::setFormat(Format format, Real outputSampleRate, Real rfBandwidth, int fmDeviation, int squelchGate)
+{
+    m_format = format;
+    m_outputSampleRate = outputSampleRate;
+    m_rfBandwidth = rfBandwidth;
+
+    switch (format)
+    {
+    case FormatIQ24:
+        m_outputType = OutputS24Pairs;
+        break;
+    case FormatIQ16:
+    case FormatNFM:
+    case FormatLSB:
+    case FormatUSB:
+        m_outputType = OutputS16Pairs;
+        break;
+    default:
+        m_outputType = OutputS16Mono;
+        break;
+    }
+
+    m_interpolator.create(16, m_inputSampleRate, rfBandwidth / 2.0);
+    m_sampleDistanceRemain = m_inputSampleRate / outputSampleRate;
+    m_ssbFilter->create_filter(0.0, (rfBandwidth / 2.0) / outputSampleRate);
+    m_phaseDiscri.setFMScaling(outputSampleRate / (2.0f * fmDeviation));
+
+    if ((format == FormatLSB) || (format == FormatLSBMono) || (format == FormatUSB) || (format == FormatUSBMono)) {
+        m_squelchGate = outputSampleRate * 0.05;
+    } else {
+        m_squelchGate = (outputSampleRate * squelchGate) / 100;
+    }
+
+    m_squelchRelease = (outputSampleRate * squelchGate) / 100;
+    initSquelch(m_squelchOpen);
+
+    m_agc.resize(outputSampleRate/5, outputSampleRate/20, m_agcTarget); // Fixed 200 ms
+    m_agc.setStepDownDelay((outputSampleRate * (squelchGate == 0 ? 1 : squelchGate)) / 100);
+    m_agc.setGate(outputSampleRate * 0.05);
+    m_bandpass.create(301, outputSampleRate, 300.0, rfBandwidth / 2.0f);
+
+    m_inLevels.resize(outputSampleRate * 0.01);                // 10 ms
+    m_amMovingAverage.resize(outputSampleRate * 0.005, 1e-10); //  5 ms
+    m_outMovingAverage.resize(outputSampleRate * 0.01, 1e-10); // 10 ms
+}
+
+void UDPSinkPipeline::setSquelch(bool enabled, Real squelchdB)
+{
+    m_squelchEnabled = enabled;
+    m_squelch = CalcDb::powerFromdB(squelchdB);
+    m_agc.setThreshold(m_squelch*(1<<23));
+}
+
+void UDPSinkPipeline::initSquelch(bool open)
+{
+    if (open)
+    {
+        m_squelchOpen = true;
+        m_squelchOpenCount = m_squelchGate;
+        m_squelchCloseCount = m_squelchRelease;
+    }
+    else
+    {
+        m_squelchOpen = false;
+        m_squelchOpenCount = 0;
+        m_squelchCloseCount = 0;
+    }
+}
+
+void UDPSinkPipeline::process(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    int nbInput = end - begin;
+    m_nbOutput = 0;
+    m_spectrumSamples.clear();
+    m_channel.clear();
+
+    if ((int) m_mixed.size() < nbInput) {
+        m_mixed.resize(nbInput);
+    }
+
+    // mix then resample the whole block
+
+    SampleVector::const_iterator it = begin;
+
+    for (int i = 0; i < nbInput; ++i, ++it) {
+        m_mixed[i] = Complex(it->real(), it->imag()) * m_nco.nextIQ();
+    }
+
+    Real sampleDistance = m_inputSampleRate / m_outputSampleRate;
+    Complex ci;
+
+    for (int i = 0; i < nbInput; i++)
+    {
+        if (m_interpolator.decimate(&m_sampleDistanceRemain, m_mixed[i], &ci))
+        {
+            m_channel.push_back(ci);
+            m_spectrumSamples.push_back(Sample(ci.real(), ci.imag()));
+            m_sampleDistanceRemain += sampleDistance;
+        }
+    }
+
+    int nbSamples = m_channel.size();
+
+    if (nbSamples == 0) {
+        return;
+    }
+
+    // input level and squelch
+
+    if ((int) m_magsqBuffer.size() < nbSamples)
+    {
+        m_magsqBuffer.resize(nbSamples);
+        m_averageBuffer.resize(nbSamples);
+        m_agcBuffer.resize(nbSamples);
+        m_demodBuffer.resize(nbSamples);
+        m_squelchBuffer.resize(nbSamples);
+    }
+
+    m_inLevels.feed(&m_channel[0], &m_magsqBuffer[0], &m_averageBuffer[0], nbSamples, 1.0f / (SDR_RX_SCALEF*SDR_RX_SCALEF));
+    double levelAvg, levelPeak;
+    int levelNbSamples;
+    m_inLevels.getLevels(levelAvg, levelPeak, levelNbSamples); // not reported
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        calculateSquelch(m_averageBuffer[i]);
+        m_squelchBuffer[i] = m_squelchOpen ? 1 : 0;
+    }
+
+    m_inMagsq = m_averageBuffer[nbSamples - 1];
+
+    // demodulation and packing stage of the format
+
+    reserveOutput(nbSamples + m_ssbFftLen); // SSB filter delivers up to a FFT half length at once
+
+    switch (m_format)
+    {
+    case FormatNFM:
+        processNFM(nbSamples, true);
+        break;
+    case FormatNFMMono:
+        processNFM(nbSamples, false);
+        break;
+    case FormatLSB:
+        processSSB(nbSamples, false, true);
+        break;
+    case FormatUSB:
+        processSSB(nbSamples, true, true);
+        break;
+    case FormatLSBMono:
+        processSSB(nbSamples, false, false);
+        break;
+    case FormatUSBMono:
+        processSSB(nbSamples, true, false);
+        break;
+    case FormatAMMono:
+        processAM(nbSamples);
+        break;
+    case FormatAMNoDCMono:
+        processAMNoDC(nbSamples);
+        break;
+    case FormatAMBPFMono:
+        processAMBPF(nbSamples);
+        break;
+    case FormatIQ16:
+    case FormatIQ24:
+    default:
+        processIQ(nbSamples);
+        break;
+    }
+
+    m_magsq = m_outMovingAverage.average();
+}
+
+void UDPSinkPipeline::reserveOutput(int nbSamples)
+{
+    switch (m_outputType)
+    {
+    case OutputS24Pairs:
+        if ((int) m_outputS24Pairs.size() < nbSamples) {
+            m_outputS24Pairs.resize(nbSamples);
+        }
+        break;
+    case OutputS16Mono:
+        if ((int) m_outputS16Mono.size() < nbSamples) {
+            m_outputS16Mono.resize(nbSamples);
+        }
+        break;
+    case OutputS16Pairs:
+    default:
+        if ((int) m_outputS16Pairs.size() < nbSamples) {
+            m_outputS16Pairs.resize(nbSamples);
+        }
+        break;
+    }
+}
+
+void UDPSinkPipeline::processIQ(int nbSamples)
+{
+    Real gain2 = m_gain * m_gain;
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        bool open = m_squelchBuffer[i];
+        Real re = open ? m_channel[i].real() * m_gain : 0;
+        Real im = open ? m_channel[i].imag() * m_gain : 0;
+        m_outMovingAverage.feed(open ? m_magsqBuffer[i] * gain2 : 0);
+
+        if (!open && m_dtx) {
+            continue;
+        }
+
+        if (m_format == FormatIQ24)
+        {
+            FixReal fixRe = (FixReal) re;
+            FixReal fixIm = (FixReal) im;
+            m_outputS24Pairs[m_nbOutput++] = SDR_RX_SAMP_SZ == 16 ?
+                Sample24(fixRe<<8, fixIm<<8) :
+                Sample24(fixRe, fixIm);
+        }
+        else
+        {
+            m_outputS16Pairs[m_nbOutput++] = Sample16(toS16(re), toS16(im));
+        }
+    }
+}
+
+void UDPSinkPipeline::processNFM(int nbSamples, bool stereo)
+{
+    m_phaseDiscri.phaseDiscriminator(&m_channel[0], &m_demodBuffer[0], nbSamples);
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        bool open = m_squelchBuffer[i];
+        Real discri = open ? m_demodBuffer[i] * m_gain : 0;
+        m_outMovingAverage.feed(discri*discri);
+
+        if (!open && m_dtx) {
+            continue;
+        }
+
+        int16_t sample = discri * 32768.0;
+
+        if (stereo) {
+            m_outputS16Pairs[m_nbOutput++] = Sample16(sample, sample);
+        } else {
+            m_outputS16Mono[m_nbOutput++] = sample;
+        }
+    }
+}
+
+void UDPSinkPipeline::processSSB(int nbSamples, bool usb, bool stereo)
+{
+    fftfilt::cmplx *sideband;
+
+    if (m_agcEnabled)
+    {
+        m_agc.feedAndGetValues(&m_channel[0], &m_agcBuffer[0], nbSamples);
+        BlockKernels::multiply(&m_channel[0], &m_agcBuffer[0], nbSamples);
+    }
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        int n_out = m_ssbFilter->runSSB(m_channel[i], &sideband, usb);
+        bool open = m_squelchBuffer[i];
+
+        for (int j = 0; j < n_out; j++)
+        {
+            if (stereo)
+            {
+                Real l = open ? sideband[j].real() * m_gain : 0;
+                Real r = open ? sideband[j].imag() * m_gain : 0;
+                m_outMovingAverage.feed((l*l + r*r) / (SDR_RX_SCALED*SDR_RX_SCALED));
+
+                if (open || !m_dtx) {
+                    m_outputS16Pairs[m_nbOutput++] = Sample16(toS16(l), toS16(r));
+                }
+            }
+            else
+            {
+                Real l = open ? (sideband[j].real() + sideband[j].imag()) * 0.7 * m_gain : 0;
+                m_outMovingAverage.feed((l * l) / (SDR_RX_SCALED*SDR_RX_SCALED));
+                outputMono(l, open);
+            }
+        }
+    }
+}
+
+void UDPSinkPipeline::processAM(int nbSamples)
+{
+    if (m_agcEnabled) {
+        m_agc.feedAndGetValues(&m_channel[0], &m_agcBuffer[0], nbSamples);
+    }
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        bool open = m_squelchBuffer[i];
+        Real agcFactor = m_agcEnabled ? m_agcBuffer[i] : 1.0f;
+        Real amplitude = open ? sqrt(m_magsqBuffer[i]) * SDR_RX_SCALEF * agcFactor * m_gain : 0;
+        m_outMovingAverage.feed((amplitude/SDR_RX_SCALEF)*(amplitude/SDR_RX_SCALEF));
+        outputMono(amplitude, open);
+    }
+}
+
+void UDPSinkPipeline::processAMNoDC(int nbSamples)
+{
+    if (m_agcEnabled) {
+        m_agc.feedAndGetValues(&m_channel[0], &m_agcBuffer[0], nbSamples);
+    }
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        bool open = m_squelchBuffer[i];
+
+        if (open)
+        {
+            Real agcFactor = m_agcEnabled ? m_agcBuffer[i] : 1.0f;
+            double demodf = sqrt(m_magsqBuffer[i]) * SDR_RX_SCALED;
+            m_amMovingAverage.feed(demodf);
+            Real amplitude = (demodf - m_amMovingAverage.average()) * agcFactor * m_gain;
+            m_outMovingAverage.feed((amplitude/SDR_RX_SCALEF)*(amplitude/SDR_RX_SCALEF));
+            outputMono(amplitude, open);
+        }
+        else
+        {
+            m_outMovingAverage.feed(0);
+            outputMono(0, open);
+        }
+    }
+}
+
+void UDPSinkPipeline::processAMBPF(int nbSamples)
+{
+    if (m_agcEnabled) {
+        m_agc.feedAndGetValues(&m_channel[0], &m_agcBuffer[0], nbSamples);
+    }
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        bool open = m_squelchBuffer[i];
+
+        if (open)
+        {
+            Real agcFactor = m_agcEnabled ? m_agcBuffer[i] : 1.0f;
+            double demodf = sqrt(m_magsqBuffer[i]) * SDR_RX_SCALED;
+            demodf = m_bandpass.filter(demodf) / 301.0;
+            Real amplitude = demodf * agcFactor * m_gain;
+            m_outMovingAverage.feed((amplitude/SDR_RX_SCALEF)*(amplitude/SDR_RX_SCALEF));
+            outputMono(amplitude, open);
+        }
+        else
+        {
+            m_outMovingAverage.feed(0);
+            outputMono(0, open);
+        }
+    }
+}
@@ -0,0 +1,229 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// UDP sink channel processing                                                   //
+//                                                                               //
+// Mixes and resamples a block of baseband samples to the output rate then runs  //
+// the demodulation and packing stage of the selected output format over the     //
+// whole block. The stage is chosen when the format is set so the per sample     //
+// loops do not test the format. The result is a buffer of 16 bit I/Q or stereo  //
+// pairs, 24 bit I/Q pairs or 16 bit mono samples ready for the UDP buffers.     //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_UDPSINKPIPELINE_H_
+#define SDRBASE_DSP_UDPSINKPIPELINE_H_
+
+#include <stdint.h>
+#include <vector>
+
+#include "dsp/dsptypes.h"
+#include "dsp/nco.h"
+#include "dsp/interpolator.h"
+#include "dsp/phasediscri.h"
+#include "dsp/movingaverage.h"
+#include "dsp/agc.h"
+#include "dsp/bandpass.h"
+#include "dsp/blockkernels.h"
+#include "export.h"
+
+class fftfilt;
+
+class SDRBASE_API UDPSinkPipeline
+{
+public:
+    typedef enum
+    {
+        FormatIQ16,
+        FormatIQ24,
+        FormatNFM,
+        FormatNFMMono,
+        FormatLSB,
+        FormatUSB,
+        FormatLSBMono,
+        FormatUSBMono,
+        FormatAMMono,
+        FormatAMNoDCMono,
+        FormatAMBPFMono,
+        FormatNone
+    } Format; //!< same order as the UDP sink settings
+
+    typedef enum
+    {
+        OutputS16Pairs, //!< I/Q or left/right
+        OutputS24Pairs, //!< I/Q in 32 bit words
+        OutputS16Mono
+    } OutputType;
+
+    struct Sample16
+    {
+        Sample16() : m_r(0), m_i(0) {}
+        Sample16(int16_t r, int16_t i) : m_r(r), m_i(i) {}
+        int16_t m_r;
+        int16_t m_i;
+    };
+
+    struct Sample24
+    {
+        Sample24() : m_r(0), m_i(0) {}
+        Sample24(int32_t r, int32_t i) : m_r(r), m_i(i) {}
+        int32_t m_r;
+        int32_t m_i;
+    };
+
+    UDPSinkPipeline();
+    ~UDPSinkPipeline();
+
+    void setInput(int inputSampleRate, int inputFrequencyOffset);
+    /** squelchGate is in 100ths of seconds */
+    void setFormat(Format format, Real outputSampleRate, Real rfBandwidth, int fmDeviation, int squelchGate);
+    void setSquelch(bool enabled, Real squelchdB);
+    void setGain(Real gain) { m_gain = gain; }
+    void setAGC(bool agc) { m_agcEnabled = agc; }
+    void setDTX(bool dtx) { m_dtx = dtx; } //!< no output while the squelch is closed
+    void resetDemodulator() { m_phaseDiscri.reset(); }
+
+    /** Mix, resample, demodulate and pack a block of baseband samples */
+    void process(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+
+    Format getFormat() const { return m_format; }
+    OutputType getOutputType() const { return m_outputType; }
+    int getNbOutputSamples() const { return m_nbOutput; } //!< pairs or mono samples of the last block
+    const Sample16 *getOutputS16Pairs() const { return m_outputS16Pairs.data(); }
+    const Sample24 *getOutputS24Pairs() const { return m_outputS24Pairs.data(); }
+    const int16_t *getOutputS16Mono() const { return m_outputS16Mono.data(); }
+    const SampleVector& getChannelSamples() const { return m_spectrumSamples; } //!< resampled channel of the last block
+
+    double getInMagSq() const { return m_inMagsq; }
+    double getMagSq() const { return m_magsq; }
+    bool getSquelchOpen() const { return m_squelchOpen; }
+
+private:
+    Format m_format;
+    OutputType m_outputType;
+    int m_inputSampleRate;
+    Real m_outputSampleRate;
+    Real m_rfBandwidth;
+    Real m_gain;
+    bool m_agcEnabled;
+    bool m_dtx;
+
+    NCO m_nco;
+    Interpolator m_interpolator;
+    Real m_sampleDistanceRemain;
+    fftfilt *m_ssbFilter;
+    PhaseDiscriminators m_phaseDiscri;
+    MagAGC m_agc;
+    Bandpass<double> m_bandpass;
+    MagSqLevels m_inLevels;
+    MovingAverage<double> m_outMovingAverage;
+    MovingAverage<double> m_amMovingAverage;
+
+    bool m_squelchEnabled;
+    double m_squelch;
+    bool m_squelchOpen;
+    int m_squelchOpenCount;
+    int m_squelchCloseCount;
+    int m_squelchGate; //!< number of samples computed from given gate
+    int m_squelchRelease;
+
+    double m_inMagsq;
+    double m_magsq;
+
+    std::vector<Complex> m_mixed;
+    std::vector<Complex> m_channel;
+    SampleVector m_spectrumSamples;
+    std::vector<Real> m_magsqBuffer;
+    std::vector<Real> m_averageBuffer;
+    std::vector<Real> m_agcBuffer;
+    std::vector<Real> m_demodBuffer;
+    std::vector<uint8_t> m_squelchBuffer;
+
+    int m_nbOutput;
+    std::vector<Sample16> m_outputS16Pairs;
+    std::vector<Sample24> m_outputS24Pairs;
+    std::vector<int16_t> m_outputS16Mono;
+
+    static const int m_ssbFftLen = 512;
+    static const Real m_agcTarget;
+
+    void initSquelch(bool open);
+    void reserveOutput(int nbSamples);
+
+    void processIQ(int nbSamples);
+    void processNFM(int nbSamples, bool stereo);
+    void processSSB(int nbSamples, bool usb, bool stereo);
+    void processAM(int nbSamples);
+    void processAMNoDC(int nbSamples);
+    void processAMBPF(int nbSamples);
+
+    void outputMono(Real value, bool open)
+    {
+        if (open || !m_dtx) {
+            m_outputS16Mono[m_nbOutput++] = toS16(value);
+        }
+    }
+
+    /** Sample scaled as the channel samples to 16 bits (truncated as FixReal) */
+    static int16_t toS16(Real value)
+    {
+        FixReal fix = (FixReal) value;
+        return SDR_RX_SAMP_SZ == 24 ? fix >> 8 : fix;
+    }
+
+    inline void calculateSquelch(double value)
+    {
+        if ((!m_squelchEnabled) || (value > m_squelch))
+        {
+            if (m_squelchGate == 0)
+            {
+                m_squelchOpen = true;
+            }
+            else
+            {
+                if (m_squelchOpenCount < m_squelchGate)
+                {
+                    m_squelchOpenCount++;
+                }
+                else
+                {
+                    m_squelchCloseCount = m_squelchRelease;
+                    m_squelchOpen = true;
+                }
+            }
+        }
+        else
+        {
+            if (m_squelchGate == 0)
+            {
+                m_squelchOpen = false;
+            }
+            else
+            {
+                if (m_squelchCloseCount > 0)
+                {
+                    m_squelchCloseCount--;
+                }
+                else
+                {
+                    m_squelchOpenCount = 0;
+                    m_squelchOpen = false;
+                }
+            }
+        }
+    }
+};
+
+#endif /* SDRBASE_DSP_UDPSINKPIPELINE_H_ */
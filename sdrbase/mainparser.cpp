@@ -29,10 +29,53 @@ MainParser::MainParser() :
     m_serverPortOption(QStringList() << "p" << "api-port",
         "Web API server port.",
         "port",
-        "8091")
+        "8091"),
+    m_streamPortOption(QStringList() << "s" << "stream-port",
+        "Web API reports streaming (WebSocket) port. 0 to disable.",
+        "port",
+        "0"),
+    m_apiThreadsOption(QStringList() << "t" << "api-threads",
+        "Web API server event driven threads serving all connections. 0 for one thread per connection.",
+        "threads",
+        "0"),
+    m_pluginsOption(QStringList() << "plugins",
+        "Comma separated list of plugins to load matched on plugin file name e.g. rtlsdr,nfmdemod. File source and sink are always loaded. Default all.",
+        "plugins"),
+    m_deviceCacheOption(QStringList() << "device-cache",
+        "Start with the devices found at the previous run and enumerate devices again in the background."),
+    m_logFilterOption(QStringList() << "log-filter",
+        "Logging category rules separated by ';' e.g. \"sdrangel.dsp.debug=false\".",
+        "rules"),
+    m_reverseAPIWindowOption(QStringList() << "reverse-api-window",
+        "Reverse API requests posted within this time are coalesced and sent together (ms).",
+        "ms",
+        "50"),
+    m_reverseAPIBatchOption(QStringList() << "reverse-api-batch",
+        "Send the reverse API requests to a same target in one batch request. The target must support the /sdrangel/batch endpoint."),
+    m_recordRotateSizeOption(QStringList() << "record-rotate-size",
+        "Start a new I/Q recording file when the current one reaches this size (MiB). 0 to disable.",
+        "MiB",
+        "0"),
+    m_recordRotateTimeOption(QStringList() << "record-rotate-time",
+        "Start a new I/Q recording file when the current one has been recorded for this time (s). 0 to disable.",
+        "seconds",
+        "0"),
+    m_recordBufferedIOOption(QStringList() << "record-buffered-io",
+        "Write I/Q recordings through the system cache instead of direct I/O."),
+    m_spectrumCPUOption(QStringList() << "spectrum-cpu",
+        "Render the spectrum waterfall and histogram on the CPU even when the GPU can do it (GUI only).")
 {
     m_serverAddress = "127.0.0.1";
     m_serverPort = 8091;
+    m_streamPort = 0;
+    m_apiThreads = 0;
+    m_deviceCache = false;
+    m_reverseAPIWindow = 50;
+    m_reverseAPIBatch = false;
+    m_recordRotateSize = 0;
+    m_recordRotateTime = 0;
+    m_recordBufferedIO = false;
+    m_spectrumCPU = false;
 
     m_parser.setApplicationDescription("Software Defined Radio application");
     m_parser.addHelpOption();
@@ -40,6 +83,17 @@ MainParser::MainParser() :
 
     m_parser.addOption(m_serverAddressOption);
     m_parser.addOption(m_serverPortOption);
+    m_parser.addOption(m_streamPortOption);
+    m_parser.addOption(m_apiThreadsOption);
+    m_parser.addOption(m_pluginsOption);
+    m_parser.addOption(m_deviceCacheOption);
+    m_parser.addOption(m_logFilterOption);
+    m_parser.addOption(m_reverseAPIWindowOption);
+    m_parser.addOption(m_reverseAPIBatchOption);
+    m_parser.addOption(m_recordRotateSizeOption);
+    m_parser.addOption(m_recordRotateTimeOption);
+    m_parser.addOption(m_recordBufferedIOOption);
+    m_parser.addOption(m_spectrumCPUOption);
 }
 
 MainParser::~MainParser()
@@ -79,4 +133,80 @@ void MainParser::parse(const QCoreApplication& app)
     } else {
         qWarning() << "MainParser::parse: server port invalid. Defaulting to " << m_serverPort;
     }
+
+    // reports streaming port
+
+    QString streamPortStr = m_parser.value(m_streamPortOption);
+    int streamPort = streamPortStr.toInt(&ok);
+
+    if (ok && ((streamPort == 0) || ((streamPort > 1023) && (streamPort < 65536)) && (streamPort != m_serverPort))) {
+        m_streamPort = streamPort;
+    } else {
+        qWarning() << "MainParser::parse: stream port invalid. Defaulting to " << m_streamPort;
+    }
+
+    // Web API server threads
+
+    QString apiThreadsStr = m_parser.value(m_apiThreadsOption);
+    int apiThreads = apiThreadsStr.toInt(&ok);
+
+    if (ok && (apiThreads >= 0) && (apiThreads <= 16)) {
+        m_apiThreads = apiThreads;
+    } else {
+        qWarning() << "MainParser::parse: Web API threads invalid. Defaulting to " << m_apiThreads;
+    }
+
+    // plugins allow list
+
+    QStringList plugins = m_parser.value(m_pluginsOption).split(",", QString::SkipEmptyParts);
+    m_plugins.clear();
+
+    foreach (const QString& plugin, plugins)
+    {
+        if (plugin.trimmed().size() > 0) {
+            m_plugins.append(plugin.trimmed());
+        }
+    }
+
+    m_deviceCache = m_parser.isSet(m_deviceCacheOption);
+
+    // logging category rules
+
+    m_logFilter = m_parser.value(m_logFilterOption);
+
+    // reverse API coalescing window
+
+    QString reverseAPIWindowStr = m_parser.value(m_reverseAPIWindowOption);
+    int reverseAPIWindow = reverseAPIWindowStr.toInt(&ok);
+
+    if (ok && (reverseAPIWindow >= 0) && (reverseAPIWindow <= 10000)) {
+        m_reverseAPIWindow = reverseAPIWindow;
+    } else {
+        qWarning() << "MainParser::parse: reverse API window invalid. Defaulting to " << m_reverseAPIWindow;
+    }
+
+    m_reverseAPIBatch = m_parser.isSet(m_reverseAPIBatchOption);
+
+    // I/Q recordings
+
+    QString recordRotateSizeStr = m_parser.value(m_recordRotateSizeOption);
+    int recordRotateSize = recordRotateSizeStr.toInt(&ok);
+
+    if (ok && (recordRotateSize >= 0)) {
+        m_recordRotateSize = recordRotateSize;
+    } else {
+        qWarning() << "MainParser::parse: record rotation size invalid. Defaulting to " << m_recordRotateSize;
+    }
+
+    QString recordRotateTimeStr = m_parser.value(m_recordRotateTimeOption);
+    int recordRotateTime = recordRotateTimeStr.toInt(&ok);
+
+    if (ok && (recordRotateTime >= 0)) {
+        m_recordRotateTime = recordRotateTime;
+    } else {
+        qWarning() << "MainParser::parse: record rotation time invalid. Defaulting to " << m_recordRotateTime;
+    }
+
+    m_recordBufferedIO = m_parser.isSet(m_recordBufferedIOOption);
+    m_spectrumCPU = m_parser.isSet(m_spectrumCPUOption);
 }
@@ -19,6 +19,7 @@
 #define SDRBASE_MAINPARSER_H_
 
 #include <QCommandLineParser>
+#include <QStringList>
 #include <stdint.h>
 
 #include "export.h"
@@ -33,14 +34,47 @@ public:
 
     const QString& getServerAddress() const { return m_serverAddress; }
     uint16_t getServerPort() const { return m_serverPort; }
+    uint16_t getStreamPort() const { return m_streamPort; } //!< 0 if reports streaming is disabled
+    int getAPIThreads() const { return m_apiThreads; } //!< 0 for one thread per connection
+    const QStringList& getPlugins() const { return m_plugins; } //!< empty to load all plugins
+    bool getDeviceCache() const { return m_deviceCache; }
+    const QString& getLogFilter() const { return m_logFilter; } //!< logging category rules separated by ';'
+    int getReverseAPIWindow() const { return m_reverseAPIWindow; } //!< reverse API coalescing window in ms
+    bool getReverseAPIBatch() const { return m_reverseAPIBatch; }
+    int getRecordRotateSize() const { return m_recordRotateSize; } //!< MiB. 0 if disabled
+    int getRecordRotateTime() const { return m_recordRotateTime; } //!< seconds. 0 if disabled
+    bool getRecordBufferedIO() const { return m_recordBufferedIO; }
+    bool getSpectrumCPU() const { return m_spectrumCPU; }
 
 private:
     QString  m_serverAddress;
     uint16_t m_serverPort;
+    uint16_t m_streamPort;
+    int      m_apiThreads;
+    QStringList m_plugins;
+    bool     m_deviceCache;
+    QString  m_logFilter;
+    int      m_reverseAPIWindow;
+    bool     m_reverseAPIBatch;
+    int      m_recordRotateSize;
+    int      m_recordRotateTime;
+    bool     m_recordBufferedIO;
+    bool     m_spectrumCPU;
 
     QCommandLineParser m_parser;
     QCommandLineOption m_serverAddressOption;
     QCommandLineOption m_serverPortOption;
+    QCommandLineOption m_streamPortOption;
+    QCommandLineOption m_apiThreadsOption;
+    QCommandLineOption m_pluginsOption;
+    QCommandLineOption m_deviceCacheOption;
+    QCommandLineOption m_logFilterOption;
+    QCommandLineOption m_reverseAPIWindowOption;
+    QCommandLineOption m_reverseAPIBatchOption;
+    QCommandLineOption m_recordRotateSizeOption;
+    QCommandLineOption m_recordRotateTimeOption;
+    QCommandLineOption m_recordBufferedIOOption;
+    QCommandLineOption m_spectrumCPUOption;
 };
 
 
@@ -16,10 +16,16 @@
 
 #include <QCoreApplication>
 #include <QPluginLoader>
+#include <QFileInfo>
+#include <QThread>
+#include <QAtomicInt>
 //#include <QComboBox>
 #include <QDebug>
 
 #include <cstdio>
+#include <vector>
+#include <thread>
+#include <algorithm>
 
 #include <plugin/plugininstancegui.h>
 #include "device/devicesourceapi.h"
@@ -44,7 +50,10 @@ const QString PluginManager::m_fileSinkDeviceTypeID = "sdrangel.samplesink.files
 
 PluginManager::PluginManager(QObject* parent) :
 	QObject(parent),
-    m_pluginAPI(this)
+    m_pluginAPI(this),
+    m_loadThreads(QThread::idealThreadCount() < 1 ? 1 : QThread::idealThreadCount()),
+    m_useDeviceCache(false),
+    m_loadMs(0)
 {
 }
 
@@ -73,12 +82,23 @@ void PluginManager::loadPluginsPart(const QString& pluginsSubDir)
     QDir pluginsLibDir = QDir(applicationLibPath);
     QDir pluginsBuildDir = QDir(applicationBuildPath);
 
-    loadPluginsDir(pluginsLibDir);
-    loadPluginsDir(pluginsBuildDir);
+    if (!m_loadTimer.isValid()) {
+        m_loadTimer.start();
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    QStringList fileNames;
+    listPluginsDir(pluginsLibDir, fileNames);
+    listPluginsDir(pluginsBuildDir, fileNames);
+    loadPluginFiles(fileNames);
+    m_loadMs += timer.elapsed();
 }
 
 void PluginManager::loadPluginsFinal()
 {
+    QElapsedTimer timer;
+    timer.start();
     qSort(m_plugins);
 
     for (Plugins::const_iterator it = m_plugins.begin(); it != m_plugins.end(); ++it)
@@ -86,8 +106,33 @@ void PluginManager::loadPluginsFinal()
         it->pluginInterface->initPlugin(&m_pluginAPI);
     }
 
-    DeviceEnumerator::instance()->enumerateRxDevices(this);
-    DeviceEnumerator::instance()->enumerateTxDevices(this);
+    qint64 initMs = timer.restart();
+    DeviceEnumerator *deviceEnumerator = DeviceEnumerator::instance();
+    bool cached = m_useDeviceCache && deviceEnumerator->loadCache(this);
+
+    if (cached)
+    {
+        deviceEnumerator->startRefresh(this);
+    }
+    else
+    {
+        deviceEnumerator->enumerateRxDevices(this);
+        deviceEnumerator->enumerateTxDevices(this);
+
+        if (m_useDeviceCache) {
+            deviceEnumerator->saveCache();
+        }
+    }
+
+    qint64 enumerateMs = timer.elapsed();
+    qInfo("PluginManager::loadPluginsFinal: %d plugins with %d threads: load: %lld ms init: %lld ms enumerate%s: %lld ms total: %lld ms",
+        m_plugins.size(),
+        m_loadThreads,
+        m_loadMs,
+        initMs,
+        cached ? " (cached)" : "",
+        enumerateMs,
+        m_loadTimer.elapsed());
 }
 
 void PluginManager::registerRxChannel(const QString& channelIdURI, const QString& channelId, PluginInterface* plugin)
@@ -126,7 +171,7 @@ void PluginManager::registerSampleSink(const QString& sinkName, PluginInterface*
 	m_sampleSinkRegistrations.append(PluginAPI::SamplingDeviceRegistration(sinkName, plugin));
 }
 
-void PluginManager::loadPluginsDir(const QDir& dir)
+void PluginManager::listPluginsDir(const QDir& dir, QStringList& fileNames)
 {
 	QDir pluginsDir(dir);
 
@@ -134,30 +179,11 @@ void PluginManager::loadPluginsDir(const QDir& dir)
 	{
         if (fileName.endsWith(".so") || fileName.endsWith(".dll") || fileName.endsWith(".dylib"))
 		{
-			qDebug() << "PluginManager::loadPluginsDir: fileName: " << qPrintable(fileName);
-
-			QPluginLoader* loader = new QPluginLoader(pluginsDir.absoluteFilePath(fileName));
-			PluginInterface* plugin = qobject_cast<PluginInterface*>(loader->instance());
-
-			if (loader->isLoaded())
-			{
-				qInfo("PluginManager::loadPluginsDir: loaded plugin %s", qPrintable(fileName));
-			}
-			else
-			{
-				qWarning() << "PluginManager::loadPluginsDir: " << qPrintable(loader->errorString());
-			}
-
-			if (plugin != 0)
-			{
-				m_plugins.append(Plugin(fileName, loader, plugin));
-			}
-			else
-			{
-				loader->unload();
-			}
-
-			delete loader; // Valgrind memcheck
+            if (isAllowed(fileName)) {
+                fileNames.append(pluginsDir.absoluteFilePath(fileName));
+            } else {
+                qDebug() << "PluginManager::listPluginsDir: not in allow list: " << qPrintable(fileName);
+            }
 		}
 	}
 
@@ -165,10 +191,104 @@ void PluginManager::loadPluginsDir(const QDir& dir)
 
 	foreach (QString dirName, pluginsDir.entryList(QDir::Dirs | QDir::NoDotAndDotDot))
 	{
-		loadPluginsDir(pluginsDir.absoluteFilePath(dirName));
+		listPluginsDir(pluginsDir.absoluteFilePath(dirName), fileNames);
 	}
 }
 
+bool PluginManager::isAllowed(const QString& fileName) const
+{
+    if (m_allowList.size() == 0) {
+        return true;
+    }
+
+    // file input and output are always available as a fallback device
+    if (fileName.contains("filesource", Qt::CaseInsensitive) || fileName.contains("filesink", Qt::CaseInsensitive)) {
+        return true;
+    }
+
+    foreach (const QString& allowed, m_allowList)
+    {
+        if (fileName.contains(allowed, Qt::CaseInsensitive)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void PluginManager::loadPluginFiles(const QStringList& fileNames)
+{
+    std::vector<PluginInterface*> plugins(fileNames.size(), (PluginInterface*) 0);
+    int nbThreads = std::min(m_loadThreads, fileNames.size());
+
+    if (nbThreads <= 1)
+    {
+        for (int i = 0; i < fileNames.size(); i++) {
+            plugins[i] = loadPluginFile(fileNames[i], thread());
+        }
+    }
+    else
+    {
+        QAtomicInt next(0);
+        QThread *mainThread = thread();
+        std::vector<std::thread> workers;
+
+        for (int t = 0; t < nbThreads; t++)
+        {
+            workers.push_back(std::thread([&fileNames, &plugins, &next, mainThread]()
+            {
+                int i;
+
+                while ((i = next.fetchAndAddOrdered(1)) < fileNames.size())
+                {
+                    plugins[i] = loadPluginFile(fileNames[i], mainThread);
+                }
+            }));
+        }
+
+        for (unsigned int t = 0; t < workers.size(); t++) {
+            workers[t].join();
+        }
+    }
+
+    // keep the directory order whatever the order of completion
+    for (int i = 0; i < fileNames.size(); i++)
+    {
+        if (plugins[i]) {
+            m_plugins.append(Plugin(QFileInfo(fileNames[i]).fileName(), 0, plugins[i]));
+        }
+    }
+}
+
+PluginInterface *PluginManager::loadPluginFile(const QString& fileName, QThread *thread)
+{
+    qDebug() << "PluginManager::loadPluginFile: fileName: " << qPrintable(fileName);
+
+    QPluginLoader* loader = new QPluginLoader(fileName);
+    QObject *instance = loader->instance();
+    PluginInterface* plugin = qobject_cast<PluginInterface*>(instance);
+
+    if (instance && (instance->thread() != thread)) { // the plugin object is used from the main thread
+        instance->moveToThread(thread);
+    }
+
+    if (loader->isLoaded())
+    {
+        qInfo("PluginManager::loadPluginFile: loaded plugin %s", qPrintable(QFileInfo(fileName).fileName()));
+    }
+    else
+    {
+        qWarning() << "PluginManager::loadPluginFile: " << qPrintable(loader->errorString());
+    }
+
+    if (plugin == 0) {
+        loader->unload();
+    }
+
+    delete loader; // Valgrind memcheck
+    return plugin;
+}
+
 void PluginManager::listTxChannels(QList<QString>& list)
 {
     list.clear();
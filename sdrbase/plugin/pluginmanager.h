@@ -6,6 +6,8 @@
 #include <QDir>
 #include <QList>
 #include <QString>
+#include <QStringList>
+#include <QElapsedTimer>
 
 #include "plugin/plugininterface.h"
 #include "plugin/pluginapi.h"
@@ -13,6 +15,7 @@
 
 class QComboBox;
 class QPluginLoader;
+class QThread;
 class Preset;
 class Message;
 class MessageQueue;
@@ -46,6 +49,12 @@ public:
 	void loadPluginsPart(const QString& pluginsSubDir);
 	void loadPluginsFinal();
 	const Plugins& getPlugins() const { return m_plugins; }
+	/** Load only the plugins whose file name contains one of these strings (case insensitive). Empty to load all. */
+	void setAllowList(const QStringList& allowList) { m_allowList = allowList; }
+	/** Number of threads loading the plugin libraries. 1 to load sequentially. */
+	void setLoadThreads(int loadThreads) { m_loadThreads = loadThreads < 1 ? 1 : loadThreads; }
+	/** Start with the devices enumerated at the previous run and enumerate again in the background */
+	void setUseDeviceCache(bool useDeviceCache) { m_useDeviceCache = useDeviceCache; }
 
 	// Callbacks from the plugins
 	void registerRxChannel(const QString& channelIdURI, const QString& channelId, PluginInterface* plugin);
@@ -95,6 +104,11 @@ private:
 
 	PluginAPI m_pluginAPI;
 	Plugins m_plugins;
+	QStringList m_allowList;
+	int m_loadThreads;
+	bool m_useDeviceCache;
+	QElapsedTimer m_loadTimer;
+	qint64 m_loadMs;
 
 	PluginAPI::ChannelRegistrations m_rxChannelRegistrations;           //!< Channel plugins register here
 	PluginAPI::SamplingDeviceRegistrations m_sampleSourceRegistrations; //!< Input source plugins (one per device kind) register here
@@ -114,7 +128,10 @@ private:
     static const QString m_fileSinkHardwareID;        //!< FileSource source hardware ID
     static const QString m_fileSinkDeviceTypeID;      //!< FileSink sink plugin ID
 
-	void loadPluginsDir(const QDir& dir);
+	void listPluginsDir(const QDir& dir, QStringList& fileNames);
+	bool isAllowed(const QString& fileName) const;
+	void loadPluginFiles(const QStringList& fileNames);
+	static PluginInterface *loadPluginFile(const QString& fileName, QThread *thread);
 };
 
 static inline bool operator<(const PluginManager::Plugin& a, const PluginManager::Plugin& b)
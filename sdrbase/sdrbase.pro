@@ -4,7 +4,7 @@
 #
 #--------------------------------------------------------
 
-QT += core multimedia
+QT += core multimedia network
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
 TEMPLATE = lib
@@ -54,8 +54,10 @@ MINGW32 || MINGW64 || MSVC {
 }
 
 SOURCES += audio/audiodevicemanager.cpp\
+        audio/audiocodec.cpp\
         audio/audiocompressor.cpp\
         audio/audiofifo.cpp\
+        audio/audiolatencyprobe.cpp\
         audio/audiooutput.cpp\
         audio/audioinput.cpp\
         audio/audionetsink.cpp\
@@ -63,6 +65,7 @@ SOURCES += audio/audiodevicemanager.cpp\
         channel/channelsourceapi.cpp\
         channel/sdrdaemondataqueue.cpp\
         channel/sdrdaemondatareadqueue.cpp\
+        channel/sdrdaemoncodec.cpp\
         commands/command.cpp\
         device/devicesourceapi.cpp\
         device/devicesinkapi.cpp\
@@ -72,11 +75,13 @@ SOURCES += audio/audiodevicemanager.cpp\
         dsp/downchannelizer.cpp\
         dsp/upchannelizer.cpp\
         dsp/channelmarker.cpp\
+        dsp/chirpdemod.cpp\
         dsp/ctcssdetector.cpp\
         dsp/cwkeyer.cpp\
         dsp/cwkeyersettings.cpp\
         dsp/decimatorsfi.cpp\
         dsp/dspcommands.cpp\
+        dsp/dsplog.cpp\
         dsp/dspengine.cpp\
         dsp/dspdevicesourceengine.cpp\
         dsp/dspdevicesinkengine.cpp\
@@ -88,6 +93,7 @@ SOURCES += audio/audiodevicemanager.cpp\
         dsp/filterrc.cpp\
         dsp/filtermbe.cpp\
         dsp/filerecord.cpp\
+        dsp/filerecordwriter.cpp\
         dsp/freqlockcomplex.cpp\
         dsp/interpolator.cpp\
         dsp/hbfiltertraits.cpp\
@@ -97,8 +103,13 @@ SOURCES += audio/audiodevicemanager.cpp\
         dsp/phaselock.cpp\
         dsp/phaselockcomplex.cpp\
         dsp/projector.cpp\
+        dsp/blockkernels.cpp\
+        dsp/blockprojector.cpp\
         dsp/recursivefilters.cpp\
         dsp/samplesinkfifo.cpp\
+        dsp/spectrumarchive.cpp\
+        dsp/spectrumscanner.cpp\
+        dsp/activitymonitor.cpp\
         dsp/samplesourcefifo.cpp\
         dsp/samplesinkfifodoublebuffered.cpp\
         dsp/basebandsamplesink.cpp\
@@ -106,6 +117,7 @@ SOURCES += audio/audiodevicemanager.cpp\
         dsp/nullsink.cpp\
         dsp/threadedbasebandsamplesink.cpp\
         dsp/threadedbasebandsamplesource.cpp\
+        dsp/udpsinkpipeline.cpp\
         dsp/wfir.cpp\
         dsp/devicesamplesource.cpp\
         dsp/devicesamplesink.cpp\
@@ -113,11 +125,14 @@ SOURCES += audio/audiodevicemanager.cpp\
         settings/preset.cpp\
         settings/mainsettings.cpp\
         util/CRC64.cpp\
+        util/cborencoder.cpp\
         util/db.cpp\
         util/message.cpp\
         util/messagequeue.cpp\
+        util/loglimiter.cpp\
         util/prettyprint.cpp\
         util/rtpsink.cpp\
+        util/udpfanout.cpp\
         util/syncmessenger.cpp\
         util/samplesourceserializer.cpp\
         util/simpleserializer.cpp\
@@ -127,13 +142,18 @@ SOURCES += audio/audiodevicemanager.cpp\
         plugin/pluginapi.cpp\
         plugin/pluginmanager.cpp\
         webapi/webapiadapterinterface.cpp\
+        webapi/webapireportstreamer.cpp\
         webapi/webapirequestmapper.cpp\
+        webapi/webapireversedispatcher.cpp\
+        webapi/webapiroutetrie.cpp\
         webapi/webapiserver.cpp\
         mainparser.cpp
 
 HEADERS  += audio/audiodevicemanager.h\
+        audio/audiocodec.h\
         audio/audiocompressor.h\
         audio/audiofifo.h\
+        audio/audiolatencyprobe.h\
         audio/audiooutput.h\
         audio/audioinput.h\
         audio/audionetsink.h\
@@ -141,6 +161,7 @@ HEADERS  += audio/audiodevicemanager.h\
         channel/channelsourceapi.h\
         channel/sdrdaemondataqueue.h\
         channel/sdrdaemondatareadqueue.h\
+        channel/sdrdaemoncodec.h\
         channel/sdrdaemondatablock.h\
         commands/command.h\
         device/devicesourceapi.h\
@@ -151,12 +172,15 @@ HEADERS  += audio/audiodevicemanager.h\
         dsp/downchannelizer.h\
         dsp/upchannelizer.h\
         dsp/channelmarker.h\
+        dsp/chirpdemod.h\
         dsp/cwkeyer.h\
         dsp/cwkeyersettings.h\
         dsp/complex.h\
         dsp/decimators.h\
+        dsp/decimatorsconv.h\
         dsp/interpolators.h\
         dsp/dspcommands.h\
+        dsp/dsplog.h\
         dsp/dspengine.h\
         dsp/dspdevicesourceengine.h\
         dsp/dspdevicesinkengine.h\
@@ -169,6 +193,7 @@ HEADERS  += audio/audiodevicemanager.h\
         dsp/filterrc.h\
         dsp/filtermbe.h\
         dsp/filerecord.h\
+        dsp/filerecordwriter.h\
         dsp/freqlockcomplex.h\
         dsp/gfft.h\
         dsp/hbfiltertraits.h\
@@ -191,8 +216,13 @@ HEADERS  += audio/audiodevicemanager.h\
         dsp/phaselock.h\
         dsp/phaselockcomplex.h\
         dsp/projector.h\
+        dsp/blockkernels.h\
+        dsp/blockprojector.h\
         dsp/recursivefilters.h\
         dsp/samplesinkfifo.h\
+        dsp/spectrumarchive.h\
+        dsp/spectrumscanner.h\
+        dsp/activitymonitor.h\
         dsp/samplesourcefifo.h\
         dsp/samplesinkfifodoublebuffered.h\
         dsp/samplesinkfifodecimator.h\
@@ -201,6 +231,7 @@ HEADERS  += audio/audiodevicemanager.h\
         dsp/nullsink.h\
         dsp/threadedbasebandsamplesink.h\
         dsp/threadedbasebandsamplesource.h\
+        dsp/udpsinkpipeline.h\
         dsp/wfir.h\
         dsp/devicesamplesource.h\
         dsp/devicesamplesink.h\
@@ -212,18 +243,24 @@ HEADERS  += audio/audiodevicemanager.h\
         settings/preset.h\
         settings/mainsettings.h\
         util/CRC64.h\
+        util/cborencoder.h\
         util/db.h\
         util/message.h\
         util/messagequeue.h\
+        util/loglimiter.h\
         util/prettyprint.h\
         util/rtpsink.h\
+        util/udpfanout.h\
         util/syncmessenger.h\
         util/samplesourceserializer.h\
         util/simpleserializer.h\
         util/uid.h\
         util/timeutil.h\
         webapi/webapiadapterinterface.h\
+        webapi/webapireportstreamer.h\
         webapi/webapirequestmapper.h\
+        webapi/webapireversedispatcher.h\
+        webapi/webapiroutetrie.h\
         webapi/webapiserver.h\
         mainparser.h
 
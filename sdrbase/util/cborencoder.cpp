@@ -0,0 +1,146 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <math.h>
+
+#include "cborencoder.h"
+
+QByteArray CBOREncoder::encode(const QJsonObject& object)
+{
+    QByteArray out;
+    encode(QJsonValue(object), out);
+    return out;
+}
+
+void CBOREncoder::encode(const QJsonValue& value, QByteArray& out)
+{
+    switch (value.type())
+    {
+    case QJsonValue::Null:
+    case QJsonValue::Undefined:
+        out.append((char) 0xf6);
+        break;
+    case QJsonValue::Bool:
+        out.append((char) (value.toBool() ? 0xf5 : 0xf4));
+        break;
+    case QJsonValue::Double:
+    {
+        double d = value.toDouble();
+
+        if ((d == floor(d)) && (fabs(d) < 9007199254740992.0)) // integral and exact in a double
+        {
+            if (d >= 0) {
+                encodeHead(0, (quint64) d, out);
+            } else {
+                encodeHead(1, (quint64) (-1.0 - d), out);
+            }
+        }
+        else if (((double) (float) d == d) || (d != d)) // lossless as float or NaN
+        {
+            float f = d;
+            quint32 bits;
+            memcpy(&bits, &f, 4);
+            out.append((char) 0xfa);
+
+            for (int i = 3; i >= 0; i--) {
+                out.append((char) (bits >> (8*i)));
+            }
+        }
+        else
+        {
+            quint64 bits;
+            memcpy(&bits, &d, 8);
+            out.append((char) 0xfb);
+
+            for (int i = 7; i >= 0; i--) {
+                out.append((char) (bits >> (8*i)));
+            }
+        }
+        break;
+    }
+    case QJsonValue::String:
+        encodeString(value.toString(), out);
+        break;
+    case QJsonValue::Array:
+    {
+        QJsonArray array = value.toArray();
+        encodeHead(4, array.size(), out);
+
+        for (QJsonArray::const_iterator it = array.begin(); it != array.end(); ++it) {
+            encode(*it, out);
+        }
+        break;
+    }
+    case QJsonValue::Object:
+    {
+        QJsonObject object = value.toObject();
+        encodeHead(5, object.size(), out);
+
+        for (QJsonObject::const_iterator it = object.begin(); it != object.end(); ++it)
+        {
+            encodeString(it.key(), out);
+            encode(it.value(), out);
+        }
+        break;
+    }
+    }
+}
+
+void CBOREncoder::encodeHead(quint8 majorType, quint64 value, QByteArray& out)
+{
+    quint8 type = majorType << 5;
+
+    if (value < 24)
+    {
+        out.append((char) (type | value));
+    }
+    else if (value < (1ULL<<8))
+    {
+        out.append((char) (type | 24));
+        out.append((char) value);
+    }
+    else if (value < (1ULL<<16))
+    {
+        out.append((char) (type | 25));
+        out.append((char) (value >> 8));
+        out.append((char) value);
+    }
+    else if (value < (1ULL<<32))
+    {
+        out.append((char) (type | 26));
+
+        for (int i = 3; i >= 0; i--) {
+            out.append((char) (value >> (8*i)));
+        }
+    }
+    else
+    {
+        out.append((char) (type | 27));
+
+        for (int i = 7; i >= 0; i--) {
+            out.append((char) (value >> (8*i)));
+        }
+    }
+}
+
+void CBOREncoder::encodeString(const QString& string, QByteArray& out)
+{
+    QByteArray utf8 = string.toUtf8();
+    encodeHead(3, utf8.size(), out);
+    out.append(utf8);
+}
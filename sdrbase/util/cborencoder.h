@@ -0,0 +1,43 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Minimal CBOR (RFC 7049) encoder of JSON values. Used where a compact binary   //
+// form of Web API data is needed. Integral numbers are encoded as integers and  //
+// other numbers as single precision floats when this is lossless.               //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_UTIL_CBORENCODER_H_
+#define SDRBASE_UTIL_CBORENCODER_H_
+
+#include <QByteArray>
+#include <QJsonValue>
+#include <QJsonObject>
+#include <QJsonArray>
+
+#include "export.h"
+
+class SDRBASE_API CBOREncoder
+{
+public:
+    static QByteArray encode(const QJsonObject& object);
+    static void encode(const QJsonValue& value, QByteArray& out);
+
+private:
+    static void encodeHead(quint8 majorType, quint64 value, QByteArray& out);
+    static void encodeString(const QString& string, QByteArray& out);
+};
+
+#endif /* SDRBASE_UTIL_CBORENCODER_H_ */
@@ -0,0 +1,47 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "loglimiter.h"
+
+LogLimiter::LogLimiter(int periodMs) :
+    m_periodMs(periodMs),
+    m_occurrences(0),
+    m_amount(0),
+    m_due(false)
+{
+}
+
+bool LogLimiter::occurrence(quint64 amount)
+{
+    if (m_due) // counts were reported by the previous message
+    {
+        m_occurrences = 0;
+        m_amount = 0;
+        m_due = false;
+    }
+
+    m_occurrences++;
+    m_amount += amount;
+
+    if (!m_timer.isValid() || m_timer.hasExpired(m_periodMs))
+    {
+        m_timer.start();
+        m_due = true;
+    }
+
+    return m_due;
+}
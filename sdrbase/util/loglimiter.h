@@ -0,0 +1,50 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_UTIL_LOGLIMITER_H_
+#define SDRBASE_UTIL_LOGLIMITER_H_
+
+#include <QElapsedTimer>
+
+#include "export.h"
+
+/**
+ * Aggregates a message repeated in a hot path (FIFO overflow...). The first occurrence
+ * is logged right away then occurrences are only counted until the period has elapsed.
+ * When a message is due the number of occurrences and the sum of their amounts since
+ * the previous message are available to build it.
+ * Not thread safe: use one per thread or under the lock of the caller.
+ */
+class SDRBASE_API LogLimiter
+{
+public:
+    LogLimiter(int periodMs = 2500);
+
+    /** Count an occurrence with an amount (e.g. dropped samples). Returns true if a message is due. */
+    bool occurrence(quint64 amount = 1);
+    unsigned int getOccurrences() const { return m_occurrences; } //!< occurrences covered by the due message
+    quint64 getAmount() const { return m_amount; }                //!< sum of amounts covered by the due message
+
+private:
+    QElapsedTimer m_timer;
+    int m_periodMs;
+    unsigned int m_occurrences;
+    quint64 m_amount;
+    bool m_due;
+};
+
+#endif /* SDRBASE_UTIL_LOGLIMITER_H_ */
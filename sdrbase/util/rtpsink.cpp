@@ -28,6 +28,14 @@ RTPSink::RTPSink(QUdpSocket *udpSocket, int sampleRate, bool stereo) :
     m_sampleBufferIndex(0),
     m_byteBuffer(0),
     m_destport(9998),
+    m_codecType(AudioCodec::CodecL16),
+    m_rtpPayloadType(96),
+    m_timestampIncrement(0),
+    m_dtx(false),
+    m_talkspurt(false),
+    m_nbDestinations(0),
+    m_packetCount(0),
+    m_byteCount(0),
     m_mutex(QMutex::Recursive)
 {
 	m_rtpSessionParams.SetOwnTimestampUnit(1.0 / (double) m_sampleRate);
@@ -53,12 +61,12 @@ RTPSink::RTPSink(QUdpSocket *udpSocket, int sampleRate, bool stereo) :
         qDebug("RTPSink::RTPSink: created session: %s", qrtplib::RTPGetErrorString(status).c_str());
     }
 
-    setPayloadInformation(m_payloadType, m_sampleRate);
-    m_valid = true;
-
     uint32_t endianTest32 = 1;
     uint8_t *ptr = (uint8_t*) &endianTest32;
     m_endianReverse = (*ptr == 1);
+
+    setPayloadInformation(m_payloadType, m_sampleRate);
+    m_valid = true;
 }
 
 RTPSink::~RTPSink()
@@ -73,28 +81,49 @@ RTPSink::~RTPSink()
 
 void RTPSink::setPayloadInformation(PayloadType payloadType, int sampleRate)
 {
-    uint32_t timestampinc;
     QMutexLocker locker(&m_mutex);
 
-    qDebug("RTPSink::setPayloadInformation: %d sampleRate: %d", payloadType, sampleRate);
+    qDebug("RTPSink::setPayloadInformation: %d sampleRate: %d codec: %d", payloadType, sampleRate, (int) m_codecType);
+
+    m_sampleRate = sampleRate;
 
     switch (payloadType)
     {
     case PayloadL16Stereo:
         m_sampleBytes = 4;
-        m_rtpSession.SetDefaultPayloadType(96);
-        timestampinc = m_sampleRate / 100;
         break;
     case PayloadL16Mono:
     default:
         m_sampleBytes = 2;
-        m_rtpSession.SetDefaultPayloadType(96);
-        timestampinc = m_sampleRate / 50;
         break;
     }
 
     m_packetSamples = m_sampleRate/50; // 20ms packet samples
     m_bufferSize = m_packetSamples * m_sampleBytes;
+    double timestampUnit = 1.0 / (double) m_sampleRate;
+    m_timestampIncrement = m_packetSamples;
+
+    if ((m_codecType != AudioCodec::CodecL16) && m_codec.setCodec(m_codecType, m_sampleRate, m_sampleBytes / 2))
+    {
+        if (m_codecType == AudioCodec::CodecADPCM) // DVI4 static payload types
+        {
+            m_rtpPayloadType = m_sampleRate == 8000 ? 5 : m_sampleRate == 16000 ? 6 : 97;
+        }
+        else // Opus has a 48 kHz clock whatever the sample rate (RFC 7587)
+        {
+            m_rtpPayloadType = 98;
+            timestampUnit = 1.0 / 48000.0;
+            m_timestampIncrement = 960;
+        }
+    }
+    else
+    {
+        m_codec.setCodec(AudioCodec::CodecL16, m_sampleRate, m_sampleBytes / 2);
+        m_rtpPayloadType = 96;
+    }
+
+    m_rtpSession.SetDefaultPayloadType(m_rtpPayloadType);
+    uint32_t timestampinc = m_timestampIncrement;
 
     if (m_byteBuffer) {
         delete[] m_byteBuffer;
@@ -104,13 +133,13 @@ void RTPSink::setPayloadInformation(PayloadType payloadType, int sampleRate)
     m_sampleBufferIndex = 0;
     m_payloadType = payloadType;
 
-    int status = m_rtpSession.SetTimestampUnit(1.0 / (double) m_sampleRate);
+    int status = m_rtpSession.SetTimestampUnit(timestampUnit);
 
     if (status < 0) {
         qCritical("RTPSink::setPayloadInformation: cannot set timestamp unit: %s", qrtplib::RTPGetErrorString(status).c_str());
     } else {
         qDebug("RTPSink::setPayloadInformation: timestamp unit set to %f: %s",
-               1.0 / (double) m_sampleRate,
+               timestampUnit,
                qrtplib::RTPGetErrorString(status).c_str());
     }
 
@@ -145,6 +174,13 @@ void RTPSink::setPayloadInformation(PayloadType payloadType, int sampleRate)
     }
 }
 
+void RTPSink::setCodec(AudioCodec::Codec codec)
+{
+    QMutexLocker locker(&m_mutex);
+    m_codecType = codec;
+    setPayloadInformation(m_payloadType, m_sampleRate);
+}
+
 void RTPSink::setDestination(const QString& address, uint16_t port)
 {
     m_rtpSession.ClearDestinations();
@@ -157,6 +193,8 @@ void RTPSink::setDestination(const QString& address, uint16_t port)
     if (status < 0) {
         qCritical("RTPSink::setDestination: cannot set destination address: %s", qrtplib::RTPGetErrorString(status).c_str());
     }
+
+    m_nbDestinations = status < 0 ? 0 : 1;
 }
 
 void RTPSink::deleteDestination(const QString& address, uint16_t port)
@@ -167,6 +205,8 @@ void RTPSink::deleteDestination(const QString& address, uint16_t port)
 
     if (status < 0) {
         qCritical("RTPSink::deleteDestination: cannot delete destination address: %s", qrtplib::RTPGetErrorString(status).c_str());
+    } else if (m_nbDestinations > 0) {
+        m_nbDestinations--;
     }
 }
 
@@ -179,6 +219,7 @@ void RTPSink::addDestination(const QString& address, uint16_t port)
     if (status < 0) {
         qCritical("RTPSink::addDestination: cannot add destination address: %s", qrtplib::RTPGetErrorString(status).c_str());
     } else {
+        m_nbDestinations++;
         qDebug("RTPSink::addDestination: destination address set to %s:%d: %s",
                 address.toStdString().c_str(),
                 port,
@@ -196,18 +237,13 @@ void RTPSink::write(const uint8_t *sampleByte)
                 sampleByte,
                 elemLength(m_payloadType),
                 m_sampleBytes,
-                m_endianReverse);
+                swapBytes());
         m_sampleBufferIndex++;
     }
     else
     {
-        int status = m_rtpSession.SendPacket((const void *) m_byteBuffer, (std::size_t) m_bufferSize);
-
-        if (status < 0) {
-            qCritical("RTPSink::write: cannot write packet: %s", qrtplib::RTPGetErrorString(status).c_str());
-        }
-
-        writeNetBuf(&m_byteBuffer[0], sampleByte,  elemLength(m_payloadType), m_sampleBytes, m_endianReverse);
+        sendPacket();
+        writeNetBuf(&m_byteBuffer[0], sampleByte,  elemLength(m_payloadType), m_sampleBytes, swapBytes());
         m_sampleBufferIndex = 1;
     }
 }
@@ -215,34 +251,17 @@ void RTPSink::write(const uint8_t *sampleByte)
 void RTPSink::write(const uint8_t *sampleByteL, const uint8_t *sampleByteR)
 {
     QMutexLocker locker(&m_mutex);
+    unsigned int elemLen = elemLength(m_payloadType);
 
-    if (m_sampleBufferIndex < m_packetSamples)
+    if (m_sampleBufferIndex >= m_packetSamples)
     {
-        writeNetBuf(&m_byteBuffer[m_sampleBufferIndex*m_sampleBytes],
-                sampleByteL,
-                elemLength(m_payloadType),
-                m_sampleBytes,
-                m_endianReverse);
-        writeNetBuf(&m_byteBuffer[m_sampleBufferIndex*m_sampleBytes + elemLength(m_payloadType)],
-                sampleByteR,
-                elemLength(m_payloadType),
-                m_sampleBytes,
-                m_endianReverse);
-        m_sampleBufferIndex++;
-    }
-    else
-    {
-        int status = m_rtpSession.SendPacket((const void *) m_byteBuffer, (std::size_t) m_bufferSize);
-
-        if (status < 0) {
-            qCritical("RTPSink::write: cannot write packet: %s", qrtplib::RTPGetErrorString(status).c_str());
-        }
-
-        writeNetBuf(&m_byteBuffer[0], sampleByteL,  elemLength(m_payloadType), m_sampleBytes, m_endianReverse);
-        writeNetBuf(&m_byteBuffer[2], sampleByteR,  elemLength(m_payloadType), m_sampleBytes, m_endianReverse);
-        m_sampleBufferIndex = 1;
+        sendPacket();
+        m_sampleBufferIndex = 0;
     }
 
+    writeNetBuf(&m_byteBuffer[m_sampleBufferIndex*m_sampleBytes], sampleByteL, elemLen, elemLen, swapBytes());
+    writeNetBuf(&m_byteBuffer[m_sampleBufferIndex*m_sampleBytes + elemLen], sampleByteR, elemLen, elemLen, swapBytes());
+    m_sampleBufferIndex++;
 }
 
 void RTPSink::write(const uint8_t *samples, int nbSamples)
@@ -253,43 +272,93 @@ void RTPSink::write(const uint8_t *samples, int nbSamples)
     // fill remainder of buffer and send it
     if (m_sampleBufferIndex + nbSamples > m_packetSamples)
     {
+        int fill = m_packetSamples - m_sampleBufferIndex;
         writeNetBuf(&m_byteBuffer[m_sampleBufferIndex*m_sampleBytes],
                 &samples[samplesIndex*m_sampleBytes],
                 elemLength(m_payloadType),
-                (m_packetSamples - m_sampleBufferIndex)*m_sampleBytes,
-                m_endianReverse);
-        m_rtpSession.SendPacket((const void *) m_byteBuffer, (std::size_t) m_bufferSize);
-        nbSamples -= (m_packetSamples - m_sampleBufferIndex);
+                fill*m_sampleBytes,
+                swapBytes());
+        sendPacket();
+        samplesIndex += fill;
+        nbSamples -= fill;
         m_sampleBufferIndex = 0;
-    }
 
-    // send complete packets
-    while (nbSamples > m_packetSamples)
-    {
-        writeNetBuf(m_byteBuffer,
-                samples,
-                elemLength(m_payloadType),
-                m_bufferSize,
-                m_endianReverse);
-        m_rtpSession.SendPacket((const void *) m_byteBuffer, (std::size_t) m_bufferSize);
-        samplesIndex += m_packetSamples;
-        nbSamples -= m_packetSamples;
+        // send complete packets keeping at least one sample for the buffer as in single sample write
+        while (nbSamples > m_packetSamples)
+        {
+            writeNetBuf(m_byteBuffer,
+                    &samples[samplesIndex*m_sampleBytes],
+                    elemLength(m_payloadType),
+                    m_bufferSize,
+                    swapBytes());
+            sendPacket();
+            samplesIndex += m_packetSamples;
+            nbSamples -= m_packetSamples;
+        }
     }
 
     // copy remainder of input to buffer
     writeNetBuf(&m_byteBuffer[m_sampleBufferIndex*m_sampleBytes],
             &samples[samplesIndex*m_sampleBytes],
             elemLength(m_payloadType),
-            nbSamples*m_sampleBytes,m_endianReverse);
+            nbSamples*m_sampleBytes,swapBytes());
+    m_sampleBufferIndex += nbSamples;
 }
 
-void RTPSink::writeNetBuf(uint8_t *dest, const uint8_t *src, unsigned int elemLen, unsigned int bytesLen, bool endianReverse)
+void RTPSink::sendPacket()
 {
-    for (unsigned int i = 0; i < bytesLen; i += elemLen)
+    if (m_dtx && AudioCodec::isSilent((const int16_t *) m_byteBuffer, m_bufferSize / 2))
+    {
+        m_rtpSession.IncrementTimestamp(m_timestampIncrement); // keep the clock running over the silence
+        m_talkspurt = false;
+        return;
+    }
+
+    const uint8_t *payload = m_byteBuffer;
+    int payloadSize = m_bufferSize;
+
+    if (m_codec.getCodec() != AudioCodec::CodecL16)
     {
-        memcpy(&dest[i], &src[i], elemLen);
+        payload = m_codecPacket;
+        payloadSize = m_codec.encode((const int16_t *) m_byteBuffer, m_codecPacket);
+    }
+
+    // the marker flags the first packet of a talkspurt (RFC 3551)
+    int status = m_rtpSession.SendPacket((const void *) payload, (std::size_t) payloadSize, m_rtpPayloadType, !m_talkspurt, m_timestampIncrement);
 
-        if (endianReverse) {
+    if (status < 0)
+    {
+        qCritical("RTPSink::sendPacket: cannot write packet: %s", qrtplib::RTPGetErrorString(status).c_str());
+    }
+    else
+    {
+        m_talkspurt = true;
+        m_packetCount += m_nbDestinations;
+        m_byteCount += m_nbDestinations * (payloadSize + 12); // 12 bytes RTP header
+    }
+}
+
+void RTPSink::writeNetBuf(uint8_t *dest, const uint8_t *src, unsigned int elemLen, unsigned int bytesLen, bool endianReverse)
+{
+    if (!endianReverse)
+    {
+        memcpy(dest, src, bytesLen);
+    }
+    else if (elemLen == 2) // L16: swap the whole span in one loop the compiler can vectorize
+    {
+        for (unsigned int i = 0; i < bytesLen; i += 2)
+        {
+            uint16_t v;
+            memcpy(&v, &src[i], 2);
+            v = (uint16_t) ((v >> 8) | (v << 8));
+            memcpy(&dest[i], &v, 2);
+        }
+    }
+    else
+    {
+        for (unsigned int i = 0; i < bytesLen; i += elemLen)
+        {
+            memcpy(&dest[i], &src[i], elemLen);
             std::reverse(&dest[i], &dest[i+elemLen]);
         }
     }
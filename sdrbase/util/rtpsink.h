@@ -31,6 +31,7 @@
 #include "rtpsessionparams.h"
 #include "rtperrors.h"
 
+#include "audio/audiocodec.h"
 #include "export.h"
 
 class QUdpSocket;
@@ -49,6 +50,9 @@ public:
 
     bool isValid() const { return m_valid; }
     void setPayloadInformation(PayloadType payloadType, int sampleRate);
+    /** L16, DVI4 (ADPCM) or Opus. Falls back to L16 if the codec cannot handle the sample rate */
+    void setCodec(AudioCodec::Codec codec);
+    void setDTX(bool dtx) { m_dtx = dtx; } //!< silent packets are not sent
 
     void setDestination(const QString& address, uint16_t port);
     void deleteDestination(const QString& address, uint16_t port);
@@ -56,12 +60,17 @@ public:
 
     void write(const uint8_t *sampleByte);
     void write(const uint8_t *sampleByteL, const uint8_t *sampleByteR);
-    void write(const uint8_t *sampleByte, int nbSamples);
+    void write(const uint8_t *sampleByte, int nbSamples); //!< nbSamples of the payload size (one channel or a stereo pair)
+
+    quint64 getPacketCount() const { return m_packetCount; } //!< packets sent on the wire (all destinations)
+    quint64 getByteCount() const { return m_byteCount; }
 
 protected:
     /** Reverse endianess in destination buffer */
     static void writeNetBuf(uint8_t *dest, const uint8_t *src, unsigned int elemLen, unsigned int bytesLen, bool endianReverse);
     static unsigned int elemLength(PayloadType payloadType);
+    void sendPacket();
+    bool swapBytes() const { return m_endianReverse && (m_codec.getCodec() == AudioCodec::CodecL16); } //!< only L16 is sent in network order
 
     bool m_valid;
     PayloadType m_payloadType;
@@ -78,6 +87,16 @@ protected:
     qrtplib::RTPUDPTransmissionParams m_rtpTransmissionParams;
     qrtplib::RTPUDPTransmitter m_rtpTransmitter;
     bool m_endianReverse;
+    AudioCodec::Codec m_codecType; //!< requested codec
+    AudioCodec m_codec;
+    uint8_t m_codecPacket[AudioCodec::m_maxPacketSize];
+    uint8_t m_rtpPayloadType;
+    uint32_t m_timestampIncrement;
+    bool m_dtx;
+    bool m_talkspurt; //!< a packet was sent after the last silence
+    int m_nbDestinations;
+    volatile quint64 m_packetCount;
+    volatile quint64 m_byteCount;
     QMutex m_mutex;
 };
 
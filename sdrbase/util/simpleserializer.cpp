@@ -593,7 +593,11 @@ void SimpleDeserializer::dump() const
 		qDebug("SimpleDeserializer dump: version %u", m_version);
 	}
 
-	for(Elements::const_iterator it = m_elements.constBegin(); it != m_elements.constEnd(); ++it) {
+	QList<quint32> ids = m_elements.keys();
+	qSort(ids);
+
+	for(QList<quint32>::const_iterator idIt = ids.constBegin(); idIt != ids.constEnd(); ++idIt) {
+		Elements::const_iterator it = m_elements.constFind(*idIt);
 		switch(it->type) {
 			case TSigned32: {
 				qint32 tmp;
@@ -682,13 +686,14 @@ bool SimpleDeserializer::parseAll()
 
 		//qDebug("-- id %d, TYPE 0x%02x, len %d", id, type, length);
 
-		if(m_elements.contains(id)) {
+		int count = m_elements.size();
+		m_elements.insert(id, Element(type, readOfs, length));
+
+		if(m_elements.size() == count) {
 			qDebug("SimpleDeserializer: same ID found twice (id %u)", id);
 			return false;
 		}
 
-		m_elements.insert(id, Element(type, readOfs, length));
-
 		readOfs += length;
 
 		if(readOfs == (uint)m_data.size())
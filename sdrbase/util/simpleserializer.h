@@ -2,7 +2,7 @@
 #define INCLUDE_SIMPLESERIALIZER_H
 
 #include <QString>
-#include <QMap>
+#include <QHash>
 #include "dsp/dsptypes.h"
 #include "export.h"
 
@@ -92,7 +92,7 @@ private:
 			length(_length)
 		{ }
 	};
-	typedef QMap<quint32, Element> Elements;
+	typedef QHash<quint32, Element> Elements; //!< tags indexed once by parseAll for constant time lookup
 
 	QByteArray m_data;
 	bool m_valid;
@@ -35,3 +35,11 @@ uint64_t TimeUtil::nowus()
 
     return value.count();
 }
+
+uint64_t TimeUtil::steadyus()
+{
+    auto now = std::chrono::steady_clock::now();
+    auto value = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch());
+
+    return value.count();
+}
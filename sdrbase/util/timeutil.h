@@ -24,4 +24,5 @@ class SDRBASE_API TimeUtil
 public:
     static uint64_t nowms(); //!< returns the current epoch in milliseconds
     static uint64_t nowus(); //!< returns the current epoch in microseconds
+    static uint64_t steadyus(); //!< returns a monotonic time in microseconds (arbitrary origin) for time differences
 };
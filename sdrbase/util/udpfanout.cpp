@@ -0,0 +1,294 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include <QDebug>
+#include <QUdpSocket>
+#include <QMutexLocker>
+
+#include "udpfanout.h"
+
+#if defined(Q_OS_LINUX)
+#include <netinet/in.h>
+#include <errno.h>
+#endif
+
+UDPFanOut::UDPFanOut(QObject *parent) :
+    m_packetCount(0),
+    m_byteCount(0),
+    m_errorCount(0),
+    m_ratePacketCount(0),
+    m_rateByteCount(0)
+{
+    m_socket = new QUdpSocket(parent);
+
+    // bind now so that the descriptor can be used directly
+    if (!m_socket->bind(QHostAddress::Any, 0)) {
+        qWarning("UDPFanOut::UDPFanOut: cannot bind socket: %s", qPrintable(m_socket->errorString()));
+    }
+
+#if defined(Q_OS_LINUX)
+    m_ipv6Socket = m_socket->localAddress().protocol() == QAbstractSocket::IPv6Protocol;
+    memset(m_msgs, 0, sizeof(m_msgs));
+#endif
+    m_rateTimer.start();
+}
+
+UDPFanOut::~UDPFanOut()
+{
+    m_socket->deleteLater(); // this thread may not be the owner thread (was moved)
+}
+
+void UDPFanOut::moveToThread(QThread *thread)
+{
+    m_socket->moveToThread(thread);
+}
+
+void UDPFanOut::setDestination(const QString& address, uint16_t port)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_destinations.clear();
+    mutexLocker.unlock();
+    addDestination(address, port);
+}
+
+void UDPFanOut::addDestination(const QString& address, uint16_t port)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    Destination destination;
+    destination.m_address.setAddress(address);
+    destination.m_port = port;
+
+    for (std::vector<Destination>::const_iterator it = m_destinations.begin(); it != m_destinations.end(); ++it)
+    {
+        if ((it->m_address == destination.m_address) && (it->m_port == port)) {
+            return;
+        }
+    }
+
+#if defined(Q_OS_LINUX)
+    if (!setSockaddr(destination)) {
+        qDebug("UDPFanOut::addDestination: %s:%d will not be batched", qPrintable(address), port);
+    }
+#endif
+
+    m_destinations.push_back(destination);
+}
+
+void UDPFanOut::deleteDestination(const QString& address, uint16_t port)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    QHostAddress hostAddress(address);
+
+    for (std::vector<Destination>::iterator it = m_destinations.begin(); it != m_destinations.end(); ++it)
+    {
+        if ((it->m_address == hostAddress) && (it->m_port == port))
+        {
+            m_destinations.erase(it);
+            return;
+        }
+    }
+}
+
+void UDPFanOut::clearDestinations()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_destinations.clear();
+}
+
+int UDPFanOut::getNbDestinations()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_destinations.size();
+}
+
+void UDPFanOut::setMulticastTTL(int ttl)
+{
+    m_socket->setSocketOption(QAbstractSocket::MulticastTtlOption, ttl);
+#if defined(Q_OS_LINUX)
+    int fd = m_socket->socketDescriptor();
+
+    if (m_ipv6Socket && (fd >= 0)) { // IPv4 groups are reached through mapped addresses that use the IPv4 option
+        setsockopt(fd, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+    }
+#endif
+}
+
+void UDPFanOut::send(const char *data, int datagramSize, int nbDatagrams)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_destinations.size() == 0) {
+        return;
+    }
+
+#if defined(Q_OS_LINUX)
+    int fd = m_socket->socketDescriptor();
+    int nbMsgs = 0;
+#endif
+
+    for (int i = 0; i < nbDatagrams; i++)
+    {
+        const char *datagram = &data[i*datagramSize];
+
+        for (std::vector<Destination>::iterator it = m_destinations.begin(); it != m_destinations.end(); ++it)
+        {
+#if defined(Q_OS_LINUX)
+            if ((fd >= 0) && (it->m_sockaddrLen > 0))
+            {
+                m_iovecs[nbMsgs].iov_base = (void *) datagram;
+                m_iovecs[nbMsgs].iov_len = datagramSize;
+                m_msgs[nbMsgs].msg_hdr.msg_name = &it->m_sockaddr;
+                m_msgs[nbMsgs].msg_hdr.msg_namelen = it->m_sockaddrLen;
+                m_msgs[nbMsgs].msg_hdr.msg_iov = &m_iovecs[nbMsgs];
+                m_msgs[nbMsgs].msg_hdr.msg_iovlen = 1;
+                nbMsgs++;
+
+                if (nbMsgs == m_maxBatch)
+                {
+                    flushBatch(fd, nbMsgs);
+                    nbMsgs = 0;
+                }
+
+                continue;
+            }
+#endif
+            if (m_socket->writeDatagram(datagram, (qint64) datagramSize, it->m_address, it->m_port) == datagramSize)
+            {
+                m_packetCount++;
+                m_byteCount += datagramSize;
+            }
+            else
+            {
+                m_errorCount++;
+            }
+        }
+    }
+
+#if defined(Q_OS_LINUX)
+    if (nbMsgs > 0) {
+        flushBatch(fd, nbMsgs);
+    }
+#endif
+}
+
+void UDPFanOut::getRates(float& packetRate, float& byteRate)
+{
+    qint64 ns = m_rateTimer.nsecsElapsed();
+    m_rateTimer.restart();
+    quint64 packetCount = m_packetCount;
+    quint64 byteCount = m_byteCount;
+
+    if (ns > 0)
+    {
+        packetRate = ((packetCount - m_ratePacketCount) * 1e9) / ns;
+        byteRate = ((byteCount - m_rateByteCount) * 1e9) / ns;
+    }
+    else
+    {
+        packetRate = 0.0f;
+        byteRate = 0.0f;
+    }
+
+    m_ratePacketCount = packetCount;
+    m_rateByteCount = byteCount;
+}
+
+#if defined(Q_OS_LINUX)
+bool UDPFanOut::setSockaddr(Destination& destination)
+{
+    bool isIPv4;
+    quint32 ipv4 = destination.m_address.toIPv4Address(&isIPv4);
+    memset(&destination.m_sockaddr, 0, sizeof(destination.m_sockaddr));
+    destination.m_sockaddrLen = 0;
+
+    if (m_ipv6Socket)
+    {
+        struct sockaddr_in6 *sin6 = (struct sockaddr_in6 *) &destination.m_sockaddr;
+        sin6->sin6_family = AF_INET6;
+        sin6->sin6_port = htons(destination.m_port);
+
+        if (isIPv4) // IPv4 mapped address ::ffff:a.b.c.d
+        {
+            sin6->sin6_addr.s6_addr[10] = 0xff;
+            sin6->sin6_addr.s6_addr[11] = 0xff;
+            uint32_t nipv4 = htonl(ipv4);
+            memcpy(&sin6->sin6_addr.s6_addr[12], &nipv4, 4);
+        }
+        else if (destination.m_address.protocol() == QAbstractSocket::IPv6Protocol)
+        {
+            Q_IPV6ADDR ipv6 = destination.m_address.toIPv6Address();
+            memcpy(sin6->sin6_addr.s6_addr, &ipv6, 16);
+        }
+        else
+        {
+            return false;
+        }
+
+        destination.m_sockaddrLen = sizeof(struct sockaddr_in6);
+    }
+    else if (isIPv4)
+    {
+        struct sockaddr_in *sin = (struct sockaddr_in *) &destination.m_sockaddr;
+        sin->sin_family = AF_INET;
+        sin->sin_port = htons(destination.m_port);
+        sin->sin_addr.s_addr = htonl(ipv4);
+        destination.m_sockaddrLen = sizeof(struct sockaddr_in);
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void UDPFanOut::flushBatch(int fd, int nbMsgs)
+{
+    int sent = 0;
+
+    while (sent < nbMsgs)
+    {
+        int res = ::sendmmsg(fd, &m_msgs[sent], nbMsgs - sent, 0);
+
+        if (res < 0)
+        {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) // socket buffer is full: drop the rest
+            {
+                m_errorCount += nbMsgs - sent;
+                return;
+            }
+
+            m_errorCount++; // this destination failed: skip it
+            sent++;
+            continue;
+        }
+
+        for (int i = sent; i < sent + res; i++) {
+            m_byteCount += m_msgs[i].msg_len;
+        }
+
+        m_packetCount += res;
+        sent += res;
+    }
+}
+#endif
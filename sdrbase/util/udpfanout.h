@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// UDP datagrams fan-out                                                         //
+//                                                                               //
+// The caller formats each datagram once and it is sent as is to every           //
+// destination of the list (unicast or IP multicast group). On Linux a block of  //
+// datagrams times the destinations is sent with as few sendmmsg calls as        //
+// possible. Packets and bytes sent on the wire are counted.                     //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_UTIL_UDPFANOUT_H_
+#define SDRBASE_UTIL_UDPFANOUT_H_
+
+#include <stdint.h>
+#include <vector>
+
+#include <QString>
+#include <QHostAddress>
+#include <QMutex>
+#include <QElapsedTimer>
+
+#if defined(Q_OS_LINUX)
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif
+
+#include "export.h"
+
+class QObject;
+class QThread;
+class QUdpSocket;
+
+class SDRBASE_API UDPFanOut
+{
+public:
+    UDPFanOut(QObject *parent);
+    ~UDPFanOut();
+
+    QUdpSocket *getSocket() { return m_socket; } //!< for protocols built on top (RTP)
+    void moveToThread(QThread *thread);
+
+    void setDestination(const QString& address, uint16_t port); //!< replaces all destinations by this one
+    void addDestination(const QString& address, uint16_t port);
+    void deleteDestination(const QString& address, uint16_t port);
+    void clearDestinations();
+    int getNbDestinations();
+    void setMulticastTTL(int ttl); //!< for multicast destinations. Default is 1 (local network)
+
+    /** Send one datagram to all destinations */
+    void send(const char *data, int size) { send(data, size, 1); }
+    /** Send nbDatagrams consecutive datagrams of datagramSize bytes each to all destinations */
+    void send(const char *data, int datagramSize, int nbDatagrams);
+
+    quint64 getPacketCount() const { return m_packetCount; }
+    quint64 getByteCount() const { return m_byteCount; }
+    quint64 getErrorCount() const { return m_errorCount; } //!< datagrams dropped by the socket
+    /** Packets and bytes per second sent since the previous call */
+    void getRates(float& packetRate, float& byteRate);
+
+    static const int m_maxBatch = 64; //!< datagrams per sendmmsg call
+
+private:
+    struct Destination
+    {
+        QHostAddress m_address;
+        uint16_t m_port;
+#if defined(Q_OS_LINUX)
+        struct sockaddr_storage m_sockaddr;
+        socklen_t m_sockaddrLen;
+#endif
+    };
+
+    QUdpSocket *m_socket;
+    QMutex m_mutex; //!< destinations may change while sending
+    std::vector<Destination> m_destinations;
+    volatile quint64 m_packetCount;
+    volatile quint64 m_byteCount;
+    volatile quint64 m_errorCount;
+    quint64 m_ratePacketCount;
+    quint64 m_rateByteCount;
+    QElapsedTimer m_rateTimer;
+#if defined(Q_OS_LINUX)
+    struct mmsghdr m_msgs[m_maxBatch];
+    struct iovec m_iovecs[m_maxBatch];
+    bool m_ipv6Socket; //!< dual stack socket: IPv4 destinations are mapped
+
+    bool setSockaddr(Destination& destination);
+    void flushBatch(int fd, int nbMsgs);
+#endif
+};
+
+#endif /* SDRBASE_UTIL_UDPFANOUT_H_ */
@@ -19,12 +19,19 @@
 #define INCLUDE_UTIL_UDPSINK_H_
 
 #include <stdint.h>
+#include <string.h>
 #include <QObject>
 #include <QUdpSocket>
 #include <QHostAddress>
 
 #include <cassert>
 
+#include "util/udpfanout.h"
+
+/**
+ * Accumulates samples in datagrams of udpSize bytes sent to all destinations.
+ * Complete datagrams of a block write are sent straight from the input.
+ */
 template<typename T>
 class UDPSinkUtil
 {
@@ -34,11 +41,12 @@ public:
 		m_udpSamples(udpSize/sizeof(T)),
 		m_address(QHostAddress::LocalHost),
 		m_port(9999),
+		m_fanOut(parent),
 		m_sampleBufferIndex(0)
 	{
         assert(m_udpSamples > 0);
 		m_sampleBuffer = new T[m_udpSamples];
-		m_socket = new QUdpSocket(parent);
+		m_fanOut.setDestination(m_address.toString(), m_port);
 	}
 
     UDPSinkUtil(QObject *parent, unsigned int udpSize, unsigned int port) :
@@ -46,11 +54,12 @@ public:
         m_udpSamples(udpSize/sizeof(T)),
         m_address(QHostAddress::LocalHost),
         m_port(port),
+        m_fanOut(parent),
         m_sampleBufferIndex(0)
     {
         assert(m_udpSamples > 0);
         m_sampleBuffer = new T[m_udpSamples];
-        m_socket = new QUdpSocket(parent);
+        m_fanOut.setDestination(m_address.toString(), m_port);
     }
 
 	UDPSinkUtil (QObject *parent, unsigned int udpSize, QHostAddress& address, unsigned int port) :
@@ -58,33 +67,48 @@ public:
         m_udpSamples(udpSize/sizeof(T)),
 		m_address(address),
 		m_port(port),
+		m_fanOut(parent),
 		m_sampleBufferIndex(0)
 	{
 		assert(m_udpSamples > 0);
 		m_sampleBuffer = new T[m_udpSamples];
-		m_socket = new QUdpSocket(parent);
+		m_fanOut.setDestination(m_address.toString(), m_port);
 	}
 
 	~UDPSinkUtil()
 	{
 		delete[] m_sampleBuffer;
-		delete m_socket;
 	}
 
 	void moveToThread(QThread *thread)
 	{
-	    m_socket->moveToThread(thread);
+	    m_fanOut.moveToThread(thread);
 	}
 
-	void setAddress(QString& address) { m_address.setAddress(address); }
-	void setPort(unsigned int port) { m_port = port; }
+	void setAddress(QString& address)
+	{
+	    m_address.setAddress(address);
+	    m_fanOut.setDestination(m_address.toString(), m_port);
+	}
+
+	void setPort(unsigned int port)
+	{
+	    m_port = port;
+	    m_fanOut.setDestination(m_address.toString(), m_port);
+	}
 
 	void setDestination(const QString& address, int port)
 	{
 	    m_address.setAddress(const_cast<QString&>(address));
 	    m_port = port;
+	    m_fanOut.setDestination(m_address.toString(), m_port);
 	}
 
+	/** Extra destinations (unicast or multicast) receiving the same datagrams */
+	void addDestination(const QString& address, int port) { m_fanOut.addDestination(address, port); }
+	void deleteDestination(const QString& address, int port) { m_fanOut.deleteDestination(address, port); }
+	UDPFanOut& getFanOut() { return m_fanOut; } //!< counters and multicast options
+
 	/**
 	 * Write one sample
 	 */
@@ -97,7 +121,7 @@ public:
 		}
 		else
 		{
-			m_socket->writeDatagram((const char*)&m_sampleBuffer[0], (qint64 ) m_udpSize, m_address, m_port);
+			m_fanOut.send((const char*)&m_sampleBuffer[0], m_udpSamples*sizeof(T));
 			m_sampleBuffer[0] = sample;
 			m_sampleBufferIndex = 1;
 		}
@@ -106,27 +130,31 @@ public:
 	/**
 	 * Write a bunch of samples
 	 */
-	void write(T *samples, int nbSamples)
+	void write(const T *samples, int nbSamples)
 	{
 	    int samplesIndex = 0;
 
 	    if (m_sampleBufferIndex + nbSamples > m_udpSamples) // fill remainder of buffer and send it
 	    {
-	        memcpy(&m_sampleBuffer[m_sampleBufferIndex], &samples[samplesIndex], (m_udpSamples - m_sampleBufferIndex)*sizeof(T)); // fill remainder of buffer
-	        m_socket->writeDatagram((const char*)&m_sampleBuffer[0], (qint64 ) m_udpSize, m_address, m_port); // send buffer
-            samplesIndex += (m_udpSamples - m_sampleBufferIndex);
-            nbSamples -= (m_udpSamples - m_sampleBufferIndex);
+	        int fill = m_udpSamples - m_sampleBufferIndex;
+	        memcpy(&m_sampleBuffer[m_sampleBufferIndex], &samples[samplesIndex], fill*sizeof(T)); // fill remainder of buffer
+	        m_fanOut.send((const char*)&m_sampleBuffer[0], m_udpSamples*sizeof(T)); // send buffer
+            samplesIndex += fill;
+            nbSamples -= fill;
 	        m_sampleBufferIndex = 0;
-	    }
 
-	    while (nbSamples > m_udpSamples) // send directly from input without buffering
-	    {
-	        m_socket->writeDatagram((const char*)&samples[samplesIndex], (qint64 ) m_udpSize, m_address, m_port);
-	        samplesIndex += m_udpSamples;
-	        nbSamples -= m_udpSamples;
+	        int nbDatagrams = (nbSamples - 1) / m_udpSamples; // keep at least one sample for the buffer as in single sample write
+
+	        if (nbDatagrams > 0) // send directly from input without buffering
+	        {
+	            m_fanOut.send((const char*)&samples[samplesIndex], m_udpSamples*sizeof(T), nbDatagrams);
+	            samplesIndex += nbDatagrams*m_udpSamples;
+	            nbSamples -= nbDatagrams*m_udpSamples;
+	        }
 	    }
 
 	    memcpy(&m_sampleBuffer[m_sampleBufferIndex], &samples[samplesIndex], nbSamples*sizeof(T)); // copy remainder of input to buffer
+	    m_sampleBufferIndex += nbSamples;
 	}
 
 private:
@@ -134,8 +162,8 @@ private:
     int m_udpSamples;
 	QHostAddress m_address;
 	unsigned int m_port;
-	QUdpSocket *m_socket;
-	T *m_sampleBuffer;;
+	UDPFanOut m_fanOut;
+	T *m_sampleBuffer;
 	int m_sampleBufferIndex;
 };
 
@@ -20,7 +20,7 @@
 #define SDRBASE_WEBAPI_WEBAPIADAPTERINTERFACE_H_
 
 #include <QString>
-#include <regex>
+#include <QSharedPointer>
 
 #include "SWGErrorResponse.h"
 
@@ -54,6 +54,10 @@ namespace SWGSDRangel
     class SWGSuccessResponse;
 }
 
+class SpectrumArchive;
+class SpectrumScanner;
+class ActivityMonitor;
+
 class SDRBASE_API WebAPIAdapterInterface
 {
 public:
@@ -611,6 +615,80 @@ public:
         return 501;
     }
 
+    /**
+     * Spectrum history archive of a device set used by /sdrangel/deviceset/{devicesetIndex}/spectrum/archive and .../archive/data
+     * The archive is shared so that it outlives a device set removed while the request is served
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumArchive(
+            int deviceSetIndex,
+            QSharedPointer<SpectrumArchive>& archive,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        archive.clear();
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Spectrum scanner of a device set used by /sdrangel/deviceset/{devicesetIndex}/spectrum/scanner and .../scanner/data
+     * The scanner is shared so that it outlives a device set removed while the request is served
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetSpectrumScanner(
+            int deviceSetIndex,
+            QSharedPointer<SpectrumScanner>& scanner,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        scanner.clear();
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Channel activity monitor of a device set used by /sdrangel/deviceset/{devicesetIndex}/activity and below
+     * The monitor is shared so that it outlives a device set removed while the request is served
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetActivityMonitor(
+            int deviceSetIndex,
+            QSharedPointer<ActivityMonitor>& monitor,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        monitor.clear();
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Defers (hold true) or applies (hold false) the channelizer reconfigurations of a device set. Used by /sdrangel/batch
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetChannelizersHold(
+            int deviceSetIndex,
+            bool hold,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) hold;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Processes the messages queued to the main window or main core by the previous handlers.
+     * Used by /sdrangel/batch so that an operation sees the effect of the previous ones. Must run in the main thread
+     */
+    virtual void instanceProcessMessages()
+    { }
+
     /**
      * Handler of /sdrangel/deviceset/{devicesetIndex}/channels/report (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
      * returns the Http status code (default 501: not implemented)
@@ -739,17 +817,7 @@ public:
     static QString instancePresetFileURL;
     static QString instanceDeviceSetsURL;
     static QString instanceDeviceSetURL;
-    static std::regex devicesetURLRe;
-    static std::regex devicesetFocusURLRe;
-    static std::regex devicesetDeviceURLRe;
-    static std::regex devicesetDeviceSettingsURLRe;
-    static std::regex devicesetDeviceRunURLRe;
-    static std::regex devicesetDeviceReportURLRe;
-    static std::regex devicesetChannelURLRe;
-    static std::regex devicesetChannelIndexURLRe;
-    static std::regex devicesetChannelSettingsURLRe;
-    static std::regex devicesetChannelReportURLRe;
-    static std::regex devicesetChannelsReportURLRe;
+    static QString instanceBatchURL;
 };
 
 
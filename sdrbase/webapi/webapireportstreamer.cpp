@@ -0,0 +1,558 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// Push device and channel reports to WebSocket subscribers                      //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QHostAddress>
+#include <QCryptographicHash>
+#include <QUrl>
+#include <QUrlQuery>
+#include <QDateTime>
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QDebug>
+
+#include <algorithm>
+
+#include "SWGDeviceReport.h"
+#include "SWGChannelsDetail.h"
+#include "SWGErrorResponse.h"
+
+#include "util/cborencoder.h"
+#include "webapiadapterinterface.h"
+#include "webapirequestmapper.h"
+#include "webapireportstreamer.h"
+
+const int WebAPIReportStreamer::m_minPeriodMs = 20;
+const int WebAPIReportStreamer::m_maxPeriodMs = 1000;
+const qint64 WebAPIReportStreamer::m_maxPendingBytes = 1<<20;
+
+WebAPIReportStreamer::WebAPIReportStreamer(const QString& host, uint16_t port, WebAPIAdapterInterface *adapter, QObject *parent) :
+    QObject(parent),
+    m_host(host),
+    m_port(port),
+    m_adapter(adapter),
+    m_server(0)
+{
+    connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+    m_clock.start();
+}
+
+WebAPIReportStreamer::~WebAPIReportStreamer()
+{
+    stop();
+}
+
+void WebAPIReportStreamer::start()
+{
+    if (m_server) {
+        return;
+    }
+
+    m_server = new QTcpServer(this);
+    connect(m_server, SIGNAL(newConnection()), this, SLOT(handleNewConnection()));
+
+    if (m_server->listen(QHostAddress(m_host), m_port))
+    {
+        qInfo("WebAPIReportStreamer::start: streaming reports at ws://%s:%d/sdrangel/reports", qPrintable(m_host), m_port);
+    }
+    else
+    {
+        qWarning("WebAPIReportStreamer::start: cannot listen on %s:%d: %s",
+            qPrintable(m_host), m_port, qPrintable(m_server->errorString()));
+        delete m_server;
+        m_server = 0;
+    }
+}
+
+void WebAPIReportStreamer::stop()
+{
+    m_timer.stop();
+
+    for (QHash<QTcpSocket*, Subscriber*>::iterator it = m_subscribers.begin(); it != m_subscribers.end(); ++it)
+    {
+        it.key()->disconnect(this);
+        it.key()->abort();
+        it.key()->deleteLater();
+        delete it.value();
+    }
+
+    m_subscribers.clear();
+
+    if (m_server)
+    {
+        m_server->close();
+        delete m_server;
+        m_server = 0;
+        qInfo("WebAPIReportStreamer::stop: stopped streaming reports at ws://%s:%d", qPrintable(m_host), m_port);
+    }
+}
+
+void WebAPIReportStreamer::handleNewConnection()
+{
+    while (m_server->hasPendingConnections())
+    {
+        QTcpSocket *socket = m_server->nextPendingConnection();
+        m_subscribers.insert(socket, new Subscriber(socket));
+        connect(socket, SIGNAL(readyRead()), this, SLOT(handleReadyRead()));
+        connect(socket, SIGNAL(disconnected()), this, SLOT(handleDisconnected()));
+    }
+}
+
+void WebAPIReportStreamer::handleDisconnected()
+{
+    QTcpSocket *socket = (QTcpSocket*) sender();
+    QHash<QTcpSocket*, Subscriber*>::iterator it = m_subscribers.find(socket);
+
+    if (it != m_subscribers.end())
+    {
+        delete it.value();
+        m_subscribers.erase(it);
+    }
+
+    socket->deleteLater();
+    updateTimer();
+}
+
+void WebAPIReportStreamer::handleReadyRead()
+{
+    QTcpSocket *socket = (QTcpSocket*) sender();
+    QHash<QTcpSocket*, Subscriber*>::iterator it = m_subscribers.find(socket);
+
+    if (it == m_subscribers.end()) {
+        return;
+    }
+
+    Subscriber *subscriber = it.value();
+    subscriber->m_readBuffer.append(socket->readAll());
+
+    if (!subscriber->m_upgraded)
+    {
+        if (!handleHandshake(subscriber)) {
+            return;
+        }
+    }
+
+    handleFrames(subscriber);
+}
+
+bool WebAPIReportStreamer::handleHandshake(Subscriber *subscriber)
+{
+    int headerEnd = subscriber->m_readBuffer.indexOf("\r\n\r\n");
+
+    if (headerEnd < 0)
+    {
+        if (subscriber->m_readBuffer.size() > 8192) { // not a reasonable request
+            subscriber->m_socket->abort();
+        }
+
+        return false;
+    }
+
+    QList<QByteArray> lines = subscriber->m_readBuffer.left(headerEnd).split('\n');
+    subscriber->m_readBuffer.remove(0, headerEnd + 4);
+    QList<QByteArray> requestLine = lines.takeFirst().trimmed().split(' ');
+    QByteArray key;
+    bool upgrade = false;
+
+    for (QList<QByteArray>::const_iterator it = lines.begin(); it != lines.end(); ++it)
+    {
+        int colon = it->indexOf(':');
+
+        if (colon < 0) {
+            continue;
+        }
+
+        QByteArray name = it->left(colon).trimmed().toLower();
+        QByteArray value = it->mid(colon + 1).trimmed();
+
+        if (name == "upgrade") {
+            upgrade = value.toLower() == "websocket";
+        } else if (name == "sec-websocket-key") {
+            key = value;
+        }
+    }
+
+    QUrl url(requestLine.size() > 1 ? QString(requestLine[1]) : QString());
+
+    if ((requestLine.size() < 3) || (requestLine[0] != "GET") || !upgrade || key.isEmpty())
+    {
+        subscriber->m_socket->write("HTTP/1.1 400 Bad Request\r\nConnection: close\r\n\r\n");
+        subscriber->m_socket->disconnectFromHost();
+        return false;
+    }
+
+    if (url.path() != "/sdrangel/reports")
+    {
+        subscriber->m_socket->write("HTTP/1.1 404 Not Found\r\nConnection: close\r\n\r\n");
+        subscriber->m_socket->disconnectFromHost();
+        return false;
+    }
+
+    QByteArray accept = QCryptographicHash::hash(key + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11", QCryptographicHash::Sha1).toBase64();
+    subscriber->m_socket->write(
+        "HTTP/1.1 101 Switching Protocols\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        "Sec-WebSocket-Accept: " + accept + "\r\n\r\n");
+    subscriber->m_upgraded = true;
+
+    QUrlQuery query(url);
+    setSubscription(subscriber,
+        query.queryItemValue("devicesets"),
+        query.queryItemValue("rate"),
+        query.queryItemValue("format"));
+
+    qDebug() << "WebAPIReportStreamer::handleHandshake: new subscriber from" << subscriber->m_socket->peerAddress().toString()
+        << "period:" << subscriber->m_periodMs << "ms format:" << subscriber->m_format;
+
+    return true;
+}
+
+void WebAPIReportStreamer::handleFrames(Subscriber *subscriber)
+{
+    QByteArray& buffer = subscriber->m_readBuffer;
+
+    while (buffer.size() >= 2)
+    {
+        quint8 opcode = buffer[0] & 0x0f;
+        bool masked = buffer[1] & 0x80;
+        quint64 length = buffer[1] & 0x7f;
+        int pos = 2;
+
+        if (length == 126)
+        {
+            if (buffer.size() < 4) {
+                return;
+            }
+
+            length = ((quint8) buffer[2] << 8) | (quint8) buffer[3];
+            pos = 4;
+        }
+        else if (length == 127)
+        {
+            if (buffer.size() < 10) {
+                return;
+            }
+
+            length = 0;
+
+            for (int i = 2; i < 10; i++) {
+                length = (length << 8) | (quint8) buffer[i];
+            }
+
+            pos = 10;
+        }
+
+        if (length > 65536) // clients only send small control or subscription messages
+        {
+            subscriber->m_socket->abort();
+            return;
+        }
+
+        QByteArray mask = masked ? buffer.mid(pos, 4) : QByteArray();
+        pos += masked ? 4 : 0;
+
+        if ((quint64) buffer.size() < pos + length) {
+            return;
+        }
+
+        QByteArray payload = buffer.mid(pos, length);
+        buffer.remove(0, pos + length);
+
+        if (masked)
+        {
+            for (int i = 0; i < payload.size(); i++) {
+                payload[i] = payload[i] ^ mask[i % 4];
+            }
+        }
+
+        if (opcode == 0x8) // close
+        {
+            sendFrame(subscriber->m_socket, 0x8, QByteArray());
+            subscriber->m_socket->disconnectFromHost();
+            return;
+        }
+        else if (opcode == 0x9) // ping
+        {
+            sendFrame(subscriber->m_socket, 0xA, payload);
+        }
+        else if (opcode == 0x1) // subscription change
+        {
+            QJsonObject object = QJsonDocument::fromJson(payload).object();
+            QJsonValue deviceSets = object.value("devicesets");
+            QStringList deviceSetList;
+
+            if (deviceSets.isArray())
+            {
+                QJsonArray array = deviceSets.toArray();
+
+                for (QJsonArray::const_iterator it = array.begin(); it != array.end(); ++it) {
+                    deviceSetList.append(QString::number(it->toInt()));
+                }
+            }
+            else
+            {
+                deviceSetList.append(deviceSets.toVariant().toString());
+            }
+
+            setSubscription(subscriber,
+                deviceSetList.join(","),
+                object.value("rate").toVariant().toString(),
+                object.value("format").toString());
+            subscriber->m_sent.clear(); // next update is a full one
+        }
+    }
+}
+
+void WebAPIReportStreamer::setSubscription(Subscriber *subscriber, const QString& deviceSets, const QString& rate, const QString& format)
+{
+    subscriber->m_deviceSets.clear();
+    QStringList deviceSetList = deviceSets.split(',', QString::SkipEmptyParts);
+
+    for (QStringList::const_iterator it = deviceSetList.begin(); it != deviceSetList.end(); ++it)
+    {
+        bool ok;
+        int deviceSetIndex = it->toInt(&ok);
+
+        if (ok && (deviceSetIndex >= 0)) {
+            subscriber->m_deviceSets.insert(deviceSetIndex);
+        }
+    }
+
+    bool ok;
+    int ratePerSecond = rate.toInt(&ok);
+
+    if (ok && (ratePerSecond > 0)) {
+        subscriber->m_periodMs = std::max(m_minPeriodMs, std::min(m_maxPeriodMs, 1000 / ratePerSecond));
+    }
+
+    subscriber->m_format = format.toLower() == "cbor" ? FormatCBOR : FormatJSON;
+    subscriber->m_nextUpdate = m_clock.elapsed();
+    updateTimer();
+}
+
+void WebAPIReportStreamer::updateTimer()
+{
+    int periodMs = 0;
+
+    for (QHash<QTcpSocket*, Subscriber*>::const_iterator it = m_subscribers.begin(); it != m_subscribers.end(); ++it)
+    {
+        if (it.value()->m_upgraded && ((periodMs == 0) || (it.value()->m_periodMs < periodMs))) {
+            periodMs = it.value()->m_periodMs;
+        }
+    }
+
+    if (periodMs == 0) {
+        m_timer.stop();
+    } else if (!m_timer.isActive() || (m_timer.interval() != periodMs)) {
+        m_timer.start(periodMs);
+    }
+}
+
+void WebAPIReportStreamer::tick()
+{
+    qint64 now = m_clock.elapsed();
+    QList<Subscriber*> due;
+
+    for (QHash<QTcpSocket*, Subscriber*>::const_iterator it = m_subscribers.begin(); it != m_subscribers.end(); ++it)
+    {
+        Subscriber *subscriber = it.value();
+
+        // timer granularity: accept updates a little early rather than skipping a period
+        if (subscriber->m_upgraded && (subscriber->m_nextUpdate <= now + m_minPeriodMs/2)) {
+            due.append(subscriber);
+        }
+    }
+
+    if (due.isEmpty()) {
+        return;
+    }
+
+    // collect each needed device set once for all subscribers due at this tick
+    QMap<int, FlatReport> reports;
+    bool allCollected = false;
+
+    for (QList<Subscriber*>::const_iterator it = due.begin(); it != due.end(); ++it)
+    {
+        if ((*it)->m_deviceSets.isEmpty())
+        {
+            if (!allCollected)
+            {
+                for (int deviceSetIndex = 0; ; deviceSetIndex++)
+                {
+                    if (!reports.contains(deviceSetIndex) && !collectDeviceSet(deviceSetIndex, reports[deviceSetIndex]))
+                    {
+                        reports.remove(deviceSetIndex);
+                        break;
+                    }
+                }
+
+                allCollected = true;
+            }
+        }
+        else
+        {
+            for (QSet<int>::const_iterator dit = (*it)->m_deviceSets.begin(); dit != (*it)->m_deviceSets.end(); ++dit)
+            {
+                if (!reports.contains(*dit) && !collectDeviceSet(*dit, reports[*dit])) {
+                    reports[*dit].clear(); // no such device set: empty
+                }
+            }
+        }
+    }
+
+    for (QList<Subscriber*>::const_iterator it = due.begin(); it != due.end(); ++it)
+    {
+        sendUpdate(*it, reports);
+        (*it)->m_nextUpdate = now + (*it)->m_periodMs;
+    }
+}
+
+bool WebAPIReportStreamer::collectDeviceSet(int deviceSetIndex, FlatReport& report)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    SWGSDRangel::SWGChannelsDetail channelsDetail;
+
+    if (m_adapter->devicesetChannelsReportGet(deviceSetIndex, channelsDetail, errorResponse) / 100 != 2) {
+        return false;
+    }
+
+    QString prefix = QString("/%1").arg(deviceSetIndex);
+    QJsonObject *channelsObject = channelsDetail.asJsonObject();
+    flatten(prefix + "/channels", *channelsObject, report);
+    delete channelsObject;
+
+    SWGSDRangel::SWGDeviceReport deviceReport;
+    WebAPIRequestMapper::resetDeviceReport(deviceReport);
+
+    if (m_adapter->devicesetDeviceReportGet(deviceSetIndex, deviceReport, errorResponse) / 100 == 2)
+    {
+        QJsonObject *deviceObject = deviceReport.asJsonObject();
+        flatten(prefix + "/device", *deviceObject, report);
+        delete deviceObject;
+    }
+
+    return true;
+}
+
+void WebAPIReportStreamer::flatten(const QString& path, const QJsonValue& value, FlatReport& report)
+{
+    if (value.isObject())
+    {
+        QJsonObject object = value.toObject();
+
+        for (QJsonObject::const_iterator it = object.begin(); it != object.end(); ++it) {
+            flatten(path + "/" + it.key(), it.value(), report);
+        }
+    }
+    else if (value.isArray())
+    {
+        QJsonArray array = value.toArray();
+
+        for (int i = 0; i < array.size(); i++) {
+            flatten(path + "/" + QString::number(i), array.at(i), report);
+        }
+    }
+    else
+    {
+        report.insert(path, value);
+    }
+}
+
+void WebAPIReportStreamer::sendUpdate(Subscriber *subscriber, const QMap<int, FlatReport>& reports)
+{
+    if (subscriber->m_socket->bytesToWrite() > m_maxPendingBytes) {
+        return; // slow client: skip this update. The next delta will catch up.
+    }
+
+    bool full = subscriber->m_sent.isEmpty();
+    QJsonObject set;
+    QJsonArray unset;
+    FlatReport current;
+
+    for (QMap<int, FlatReport>::const_iterator it = reports.begin(); it != reports.end(); ++it)
+    {
+        if (!subscriber->m_deviceSets.isEmpty() && !subscriber->m_deviceSets.contains(it.key())) {
+            continue;
+        }
+
+        for (FlatReport::const_iterator vit = it.value().begin(); vit != it.value().end(); ++vit)
+        {
+            current.insert(vit.key(), vit.value());
+            FlatReport::const_iterator sit = subscriber->m_sent.find(vit.key());
+
+            if ((sit == subscriber->m_sent.end()) || (sit.value() != vit.value())) {
+                set.insert(vit.key(), vit.value());
+            }
+        }
+    }
+
+    for (FlatReport::const_iterator sit = subscriber->m_sent.begin(); sit != subscriber->m_sent.end(); ++sit)
+    {
+        if (!current.contains(sit.key())) {
+            unset.append(sit.key());
+        }
+    }
+
+    if (!full && set.isEmpty() && unset.isEmpty()) {
+        return;
+    }
+
+    QJsonObject message;
+    message.insert("time", (double) QDateTime::currentMSecsSinceEpoch());
+    message.insert("full", full);
+    message.insert("set", set);
+    message.insert("unset", unset);
+    subscriber->m_sent.swap(current);
+
+    if (subscriber->m_format == FormatCBOR) {
+        sendFrame(subscriber->m_socket, 0x2, CBOREncoder::encode(message));
+    } else {
+        sendFrame(subscriber->m_socket, 0x1, QJsonDocument(message).toJson(QJsonDocument::Compact));
+    }
+}
+
+void WebAPIReportStreamer::sendFrame(QTcpSocket *socket, quint8 opcode, const QByteArray& payload)
+{
+    QByteArray header;
+    header.append((char) (0x80 | opcode)); // FIN, not masked
+
+    if (payload.size() < 126)
+    {
+        header.append((char) payload.size());
+    }
+    else if (payload.size() < 65536)
+    {
+        header.append((char) 126);
+        header.append((char) (payload.size() >> 8));
+        header.append((char) payload.size());
+    }
+    else
+    {
+        header.append((char) 127);
+        quint64 length = payload.size();
+
+        for (int i = 7; i >= 0; i--) {
+            header.append((char) (length >> (8*i)));
+        }
+    }
+
+    socket->write(header);
+    socket->write(payload);
+}
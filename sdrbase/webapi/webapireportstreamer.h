@@ -0,0 +1,121 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// Push device and channel reports to WebSocket subscribers                      //
+//                                                                               //
+// Clients connect to ws://host:port/sdrangel/reports with optional query:       //
+// - devicesets: comma separated device set indexes (default all)                //
+// - rate: number of updates per second (1 to 50, default 10)                    //
+// - format: json (text frames) or cbor (binary frames). Default json.           //
+// The same keys can be sent later in a JSON text message to change the          //
+// subscription.                                                                 //
+//                                                                               //
+// Reports are collected once per tick for each device set needed by at least    //
+// one subscriber and are flattened to "/<deviceset>/device/..." and             //
+// "/<deviceset>/channels/..." paths. Each subscriber receives the full set of   //
+// values first then only the values that changed since its last update as:      //
+// {"time": ms, "full": bool, "set": {path: value, ...}, "unset": [path, ...]}   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_WEBAPI_WEBAPIREPORTSTREAMER_H_
+#define SDRBASE_WEBAPI_WEBAPIREPORTSTREAMER_H_
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMap>
+#include <QSet>
+#include <QJsonValue>
+#include <QJsonObject>
+
+#include "export.h"
+
+class QTcpServer;
+class QTcpSocket;
+class WebAPIAdapterInterface;
+
+class SDRBASE_API WebAPIReportStreamer : public QObject
+{
+    Q_OBJECT
+
+public:
+    WebAPIReportStreamer(const QString& host, uint16_t port, WebAPIAdapterInterface *adapter, QObject *parent = 0);
+    ~WebAPIReportStreamer();
+
+    void start();
+    void stop();
+
+    const QString& getHost() const { return m_host; }
+    int getPort() const { return m_port; }
+
+private:
+    typedef QHash<QString, QJsonValue> FlatReport;
+
+    enum Format
+    {
+        FormatJSON,
+        FormatCBOR
+    };
+
+    struct Subscriber
+    {
+        QTcpSocket *m_socket;
+        bool m_upgraded;
+        QByteArray m_readBuffer;
+        QSet<int> m_deviceSets; //!< empty for all device sets
+        int m_periodMs;
+        Format m_format;
+        qint64 m_nextUpdate;    //!< clock time (ms) of next update
+        FlatReport m_sent;      //!< values as last sent to the client
+
+        Subscriber(QTcpSocket *socket) :
+            m_socket(socket),
+            m_upgraded(false),
+            m_periodMs(100),
+            m_format(FormatJSON),
+            m_nextUpdate(0)
+        {}
+    };
+
+    QString m_host;
+    uint16_t m_port;
+    WebAPIAdapterInterface *m_adapter;
+    QTcpServer *m_server;
+    QHash<QTcpSocket*, Subscriber*> m_subscribers;
+    QTimer m_timer;
+    QElapsedTimer m_clock;
+
+    static const int m_minPeriodMs;
+    static const int m_maxPeriodMs;
+    static const qint64 m_maxPendingBytes;
+
+    bool handleHandshake(Subscriber *subscriber);
+    void handleFrames(Subscriber *subscriber);
+    void setSubscription(Subscriber *subscriber, const QString& deviceSets, const QString& rate, const QString& format);
+    void sendFrame(QTcpSocket *socket, quint8 opcode, const QByteArray& payload);
+    void sendUpdate(Subscriber *subscriber, const QMap<int, FlatReport>& reports);
+    bool collectDeviceSet(int deviceSetIndex, FlatReport& report);
+    void updateTimer();
+    static void flatten(const QString& path, const QJsonValue& value, FlatReport& report);
+
+private slots:
+    void handleNewConnection();
+    void handleReadyRead();
+    void handleDisconnected();
+    void tick();
+};
+
+#endif /* SDRBASE_WEBAPI_WEBAPIREPORTSTREAMER_H_ */
@@ -19,11 +19,17 @@
 #include <QDirIterator>
 #include <QJsonDocument>
 #include <QJsonArray>
+#include <QDateTime>
+#include <QThread>
 
+#include <set>
 #include <boost/lexical_cast.hpp>
 
 #include "httpdocrootsettings.h"
 #include "webapirequestmapper.h"
+#include "dsp/spectrumarchive.h"
+#include "dsp/spectrumscanner.h"
+#include "dsp/activitymonitor.h"
 #include "SWGInstanceSummaryResponse.h"
 #include "SWGInstanceDevicesResponse.h"
 #include "SWGInstanceChannelsResponse.h"
@@ -42,6 +48,13 @@
 #include "SWGChannelSettings.h"
 #include "SWGChannelReport.h"
 #include "SWGSuccessResponse.h"
+#include "SWGSpectrumArchiveSettings.h"
+#include "SWGSpectrumArchiveStatus.h"
+#include "SWGSpectrumArchiveData.h"
+#include "SWGSpectrumScannerSettings.h"
+#include "SWGSpectrumScannerStatus.h"
+#include "SWGSpectrumScannerSweepReport.h"
+#include "SWGSpectrumScannerData.h"
 #include "SWGErrorResponse.h"
 
 WebAPIRequestMapper::WebAPIRequestMapper(QObject* parent) :
@@ -51,6 +64,42 @@ WebAPIRequestMapper::WebAPIRequestMapper(QObject* parent) :
     qtwebapp::HttpDocrootSettings docrootSettings;
     docrootSettings.path = ":/webapi";
     m_staticFileController = new qtwebapp::StaticFileController(docrootSettings, parent);
+
+    m_routes.add(WebAPIAdapterInterface::instanceSummaryURL.toLatin1(), RouteInstanceSummary);
+    m_routes.add(WebAPIAdapterInterface::instanceDevicesURL.toLatin1(), RouteInstanceDevices);
+    m_routes.add(WebAPIAdapterInterface::instanceChannelsURL.toLatin1(), RouteInstanceChannels);
+    m_routes.add(WebAPIAdapterInterface::instanceLoggingURL.toLatin1(), RouteInstanceLogging);
+    m_routes.add(WebAPIAdapterInterface::instanceAudioURL.toLatin1(), RouteInstanceAudio);
+    m_routes.add(WebAPIAdapterInterface::instanceAudioInputParametersURL.toLatin1(), RouteInstanceAudioInputParameters);
+    m_routes.add(WebAPIAdapterInterface::instanceAudioOutputParametersURL.toLatin1(), RouteInstanceAudioOutputParameters);
+    m_routes.add(WebAPIAdapterInterface::instanceAudioInputCleanupURL.toLatin1(), RouteInstanceAudioInputCleanup);
+    m_routes.add(WebAPIAdapterInterface::instanceAudioOutputCleanupURL.toLatin1(), RouteInstanceAudioOutputCleanup);
+    m_routes.add(WebAPIAdapterInterface::instanceLocationURL.toLatin1(), RouteInstanceLocation);
+    m_routes.add(WebAPIAdapterInterface::instanceDVSerialURL.toLatin1(), RouteInstanceDVSerial);
+    m_routes.add(WebAPIAdapterInterface::instancePresetsURL.toLatin1(), RouteInstancePresets);
+    m_routes.add(WebAPIAdapterInterface::instancePresetURL.toLatin1(), RouteInstancePreset);
+    m_routes.add(WebAPIAdapterInterface::instancePresetFileURL.toLatin1(), RouteInstancePresetFile);
+    m_routes.add(WebAPIAdapterInterface::instanceDeviceSetsURL.toLatin1(), RouteInstanceDeviceSets);
+    m_routes.add(WebAPIAdapterInterface::instanceDeviceSetURL.toLatin1(), RouteInstanceDeviceSet);
+    m_routes.add(WebAPIAdapterInterface::instanceBatchURL.toLatin1(), RouteInstanceBatch);
+    m_routes.add("/sdrangel/deviceset/{index}", RouteDeviceset);
+    m_routes.add("/sdrangel/deviceset/{index}/focus", RouteDevicesetFocus);
+    m_routes.add("/sdrangel/deviceset/{index}/device", RouteDevicesetDevice);
+    m_routes.add("/sdrangel/deviceset/{index}/device/settings", RouteDevicesetDeviceSettings);
+    m_routes.add("/sdrangel/deviceset/{index}/device/run", RouteDevicesetDeviceRun);
+    m_routes.add("/sdrangel/deviceset/{index}/device/report", RouteDevicesetDeviceReport);
+    m_routes.add("/sdrangel/deviceset/{index}/channels/report", RouteDevicesetChannelsReport);
+    m_routes.add("/sdrangel/deviceset/{index}/channel", RouteDevicesetChannel);
+    m_routes.add("/sdrangel/deviceset/{index}/channel/{index}", RouteDevicesetChannelIndex);
+    m_routes.add("/sdrangel/deviceset/{index}/channel/{index}/settings", RouteDevicesetChannelSettings);
+    m_routes.add("/sdrangel/deviceset/{index}/channel/{index}/report", RouteDevicesetChannelReport);
+    m_routes.add("/sdrangel/deviceset/{index}/spectrum/archive", RouteDevicesetSpectrumArchive);
+    m_routes.add("/sdrangel/deviceset/{index}/spectrum/archive/data", RouteDevicesetSpectrumArchiveData);
+    m_routes.add("/sdrangel/deviceset/{index}/spectrum/scanner", RouteDevicesetSpectrumScanner);
+    m_routes.add("/sdrangel/deviceset/{index}/spectrum/scanner/data", RouteDevicesetSpectrumScannerData);
+    m_routes.add("/sdrangel/deviceset/{index}/activity", RouteDevicesetActivity);
+    m_routes.add("/sdrangel/deviceset/{index}/activity/channels", RouteDevicesetActivityChannels);
+    m_routes.add("/sdrangel/deviceset/{index}/activity/events", RouteDevicesetActivityEvents);
 }
 
 WebAPIRequestMapper::~WebAPIRequestMapper()
@@ -96,77 +145,118 @@ void WebAPIRequestMapper::service(qtwebapp::HttpRequest& request, qtwebapp::Http
             return;
         }
 
-        if (path == WebAPIAdapterInterface::instanceSummaryURL) {
+        std::string indexes[WebAPIRouteTrie::m_maxIndexes];
+
+        switch (m_routes.match(path, indexes))
+        {
+        case RouteInstanceSummary:
             instanceSummaryService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceDevicesURL) {
+            break;
+        case RouteInstanceDevices:
             instanceDevicesService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceChannelsURL) {
+            break;
+        case RouteInstanceChannels:
             instanceChannelsService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLoggingURL) {
+            break;
+        case RouteInstanceLogging:
             instanceLoggingService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioURL) {
+            break;
+        case RouteInstanceAudio:
             instanceAudioService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioInputParametersURL) {
+            break;
+        case RouteInstanceAudioInputParameters:
             instanceAudioInputParametersService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioOutputParametersURL) {
+            break;
+        case RouteInstanceAudioOutputParameters:
             instanceAudioOutputParametersService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioInputCleanupURL) {
+            break;
+        case RouteInstanceAudioInputCleanup:
             instanceAudioInputCleanupService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioOutputCleanupURL) {
+            break;
+        case RouteInstanceAudioOutputCleanup:
             instanceAudioOutputCleanupService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLocationURL) {
+            break;
+        case RouteInstanceLocation:
             instanceLocationService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceDVSerialURL) {
+            break;
+        case RouteInstanceDVSerial:
             instanceDVSerialService(request, response);
-        } else if (path == WebAPIAdapterInterface::instancePresetsURL) {
+            break;
+        case RouteInstancePresets:
             instancePresetsService(request, response);
-        } else if (path == WebAPIAdapterInterface::instancePresetURL) {
+            break;
+        case RouteInstancePreset:
             instancePresetService(request, response);
-        } else if (path == WebAPIAdapterInterface::instancePresetFileURL) {
+            break;
+        case RouteInstancePresetFile:
             instancePresetFileService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceDeviceSetsURL) {
+            break;
+        case RouteInstanceDeviceSets:
             instanceDeviceSetsService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceDeviceSetURL) {
+            break;
+        case RouteInstanceDeviceSet:
             instanceDeviceSetService(request, response);
-        }
-        else
-        {
-            std::smatch desc_match;
-            std::string pathStr(path.constData(), path.length());
-
-            if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetURLRe)) {
-                devicesetService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceURLRe)) {
-                devicesetDeviceService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetFocusURLRe)) {
-                devicesetFocusService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceSettingsURLRe)) {
-                devicesetDeviceSettingsService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceRunURLRe)) {
-                devicesetDeviceRunService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceReportURLRe)) {
-                devicesetDeviceReportService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelsReportURLRe)) {
-                devicesetChannelsReportService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelURLRe)) {
-                devicesetChannelService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelIndexURLRe)) {
-                devicesetChannelIndexService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelSettingsURLRe)) {
-                devicesetChannelSettingsService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelReportURLRe)) {
-                devicesetChannelReportService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            }
-            else // serve static documentation pages
-            {
-                m_staticFileController->service(request, response);
-            }
-
-//            QDirIterator it(":", QDirIterator::Subdirectories);
-//            while (it.hasNext()) {
-//                qDebug() << "WebAPIRequestMapper::service: " << it.next();
-//            }
-
+            break;
+        case RouteInstanceBatch:
+            instanceBatchService(request, response);
+            break;
+        case RouteDeviceset:
+            devicesetService(indexes[0], request, response);
+            break;
+        case RouteDevicesetFocus:
+            devicesetFocusService(indexes[0], request, response);
+            break;
+        case RouteDevicesetDevice:
+            devicesetDeviceService(indexes[0], request, response);
+            break;
+        case RouteDevicesetDeviceSettings:
+            devicesetDeviceSettingsService(indexes[0], request, response);
+            break;
+        case RouteDevicesetDeviceRun:
+            devicesetDeviceRunService(indexes[0], request, response);
+            break;
+        case RouteDevicesetDeviceReport:
+            devicesetDeviceReportService(indexes[0], request, response);
+            break;
+        case RouteDevicesetChannelsReport:
+            devicesetChannelsReportService(indexes[0], request, response);
+            break;
+        case RouteDevicesetChannel:
+            devicesetChannelService(indexes[0], request, response);
+            break;
+        case RouteDevicesetChannelIndex:
+            devicesetChannelIndexService(indexes[0], indexes[1], request, response);
+            break;
+        case RouteDevicesetChannelSettings:
+            devicesetChannelSettingsService(indexes[0], indexes[1], request, response);
+            break;
+        case RouteDevicesetChannelReport:
+            devicesetChannelReportService(indexes[0], indexes[1], request, response);
+            break;
+        case RouteDevicesetSpectrumArchive:
+            devicesetSpectrumArchiveService(indexes[0], request, response);
+            break;
+        case RouteDevicesetSpectrumArchiveData:
+            devicesetSpectrumArchiveDataService(indexes[0], request, response);
+            break;
+        case RouteDevicesetSpectrumScanner:
+            devicesetSpectrumScannerService(indexes[0], request, response);
+            break;
+        case RouteDevicesetSpectrumScannerData:
+            devicesetSpectrumScannerDataService(indexes[0], request, response);
+            break;
+        case RouteDevicesetActivity:
+            devicesetActivityService(indexes[0], request, response);
+            break;
+        case RouteDevicesetActivityChannels:
+            devicesetActivityChannelsService(indexes[0], request, response);
+            break;
+        case RouteDevicesetActivityEvents:
+            devicesetActivityEventsService(indexes[0], request, response);
+            break;
+        default: // serve static documentation pages
+            m_staticFileController->service(request, response);
+            break;
         }
     }
 }
@@ -1008,6 +1098,318 @@ void WebAPIRequestMapper::instanceDeviceSetService(qtwebapp::HttpRequest& reques
     }
 }
 
+void WebAPIRequestMapper::instanceBatchService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    if (request.getMethod() == "POST")
+    {
+        QByteArray body = request.getBody();
+        QByteArray result;
+
+        // The whole batch runs in the main thread so that messages queued by an operation
+        // can be processed before the next operation and no other request interleaves
+        if (QThread::currentThread() == thread())
+        {
+            result = processBatch(body);
+        }
+        else
+        {
+            QMetaObject::invokeMethod(this, "processBatch", Qt::BlockingQueuedConnection,
+                    Q_RETURN_ARG(QByteArray, result),
+                    Q_ARG(QByteArray, body));
+        }
+
+        QJsonObject resultObject = QJsonDocument::fromJson(result).object();
+        response.setStatus(resultObject["status"].toInt(500));
+        response.write(result);
+    }
+    else
+    {
+        response.setStatus(405,"Invalid HTTP method");
+        errorResponse.init();
+        *errorResponse.getMessage() = "Invalid HTTP method";
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+QByteArray WebAPIRequestMapper::processBatch(const QByteArray& body)
+{
+    QJsonObject batchResult;
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(body, &error);
+
+    if (error.error != QJsonParseError::NoError)
+    {
+        batchError(400, QString("Input JSON error: ") + error.errorString() + QString(" at offset ") + QString::number(error.offset), batchResult);
+        return QJsonDocument(batchResult).toJson(QJsonDocument::Compact);
+    }
+
+    QJsonObject jsonObject = doc.object();
+
+    if (!jsonObject.contains("operations") || !jsonObject["operations"].isArray())
+    {
+        batchError(400, "Invalid JSON request: missing operations array", batchResult);
+        return QJsonDocument(batchResult).toJson(QJsonDocument::Compact);
+    }
+
+    QJsonArray operations = jsonObject["operations"].toArray();
+    bool stopOnError = jsonObject["stopOnError"].toBool(true);
+    QJsonArray results;
+    int batchStatus = 200;
+
+    qDebug("WebAPIRequestMapper::processBatch: %d operations", operations.size());
+
+    // channelizers of the device sets targeted by the batch are reconfigured once at the end of the batch
+    std::set<int> heldDeviceSets;
+
+    for (int i = 0; i < operations.size(); i++)
+    {
+        QJsonObject operation = operations[i].toObject();
+        QString method = operation["method"].toString().toUpper();
+        QString path = operation["path"].toString();
+        int deviceSetIndex = batchDeviceSetIndex(path);
+
+        if ((deviceSetIndex >= 0) && (heldDeviceSets.find(deviceSetIndex) == heldDeviceSets.end()))
+        {
+            SWGSDRangel::SWGErrorResponse errorResponse;
+
+            if (m_adapter->devicesetChannelizersHold(deviceSetIndex, true, errorResponse) == 200) {
+                heldDeviceSets.insert(deviceSetIndex);
+            }
+        }
+
+        QJsonObject result;
+        int status = batchOperation(method, path, operation["query"].toObject(), operation["body"].toObject(), result);
+        result["method"] = method;
+        result["path"] = path;
+        results.append(result);
+
+        if (status == 202) {
+            // handle the messages just queued to main window or main core so that next operations see their effect
+            m_adapter->instanceProcessMessages();
+        }
+
+        if (status/100 != 2)
+        {
+            if (batchStatus/100 == 2) {
+                batchStatus = status;
+            }
+
+            if (stopOnError) {
+                break;
+            }
+        }
+    }
+
+    for (std::set<int>::const_iterator it = heldDeviceSets.begin(); it != heldDeviceSets.end(); ++it)
+    {
+        SWGSDRangel::SWGErrorResponse errorResponse;
+        m_adapter->devicesetChannelizersHold(*it, false, errorResponse);
+    }
+
+    batchResult["status"] = batchStatus;
+    batchResult["results"] = results;
+    return QJsonDocument(batchResult).toJson(QJsonDocument::Compact);
+}
+
+int WebAPIRequestMapper::batchDeviceSetIndex(const QString& path) const
+{
+    std::string indexes[WebAPIRouteTrie::m_maxIndexes];
+    int route = m_routes.match(path.toLatin1(), indexes);
+
+    if (route < RouteDeviceset) { // instance routes or no match
+        return -1;
+    }
+
+    try
+    {
+        return boost::lexical_cast<int>(indexes[0]);
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        return -1;
+    }
+}
+
+int WebAPIRequestMapper::batchOperation(
+        const QString& method,
+        const QString& path,
+        const QJsonObject& query,
+        const QJsonObject& body,
+        QJsonObject& result)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    QJsonObject jsonObject(body);
+    std::string indexes[WebAPIRouteTrie::m_maxIndexes];
+    int route = m_routes.match(path.toLatin1(), indexes);
+
+    try
+    {
+        if (route == RouteInstanceDeviceSet)
+        {
+            SWGSDRangel::SWGSuccessResponse normalResponse;
+
+            if (method == "POST")
+            {
+                bool tx = query.contains("tx") && (query["tx"].toVariant().toInt() != 0);
+                int status = m_adapter->instanceDeviceSetPost(tx, normalResponse, errorResponse);
+                return batchResponse(status, normalResponse, errorResponse, result);
+            }
+            else if (method == "DELETE")
+            {
+                int status = m_adapter->instanceDeviceSetDelete(normalResponse, errorResponse);
+                return batchResponse(status, normalResponse, errorResponse, result);
+            }
+        }
+        else if (route == RouteDevicesetDevice)
+        {
+            int deviceSetIndex = boost::lexical_cast<int>(indexes[0]);
+
+            if (method == "PUT")
+            {
+                SWGSDRangel::SWGDeviceListItem deviceListItem;
+                SWGSDRangel::SWGDeviceListItem normalResponse;
+
+                if (!validateDeviceListItem(deviceListItem, jsonObject)) {
+                    return batchError(400, "Missing device identification", result);
+                }
+
+                int status = m_adapter->devicesetDevicePut(deviceSetIndex, deviceListItem, normalResponse, errorResponse);
+                return batchResponse(status, normalResponse, errorResponse, result);
+            }
+        }
+        else if (route == RouteDevicesetDeviceSettings)
+        {
+            int deviceSetIndex = boost::lexical_cast<int>(indexes[0]);
+
+            if ((method == "PUT") || (method == "PATCH"))
+            {
+                SWGSDRangel::SWGDeviceSettings normalResponse;
+                resetDeviceSettings(normalResponse);
+                QStringList deviceSettingsKeys;
+
+                if (!validateDeviceSettings(normalResponse, jsonObject, deviceSettingsKeys)) {
+                    return batchError(400, "Invalid JSON request", result);
+                }
+
+                int status = m_adapter->devicesetDeviceSettingsPutPatch(
+                        deviceSetIndex,
+                        (method == "PUT"), // force settings on PUT
+                        deviceSettingsKeys,
+                        normalResponse,
+                        errorResponse);
+                return batchResponse(status, normalResponse, errorResponse, result);
+            }
+        }
+        else if (route == RouteDevicesetDeviceRun)
+        {
+            int deviceSetIndex = boost::lexical_cast<int>(indexes[0]);
+            SWGSDRangel::SWGDeviceState normalResponse;
+
+            if (method == "POST")
+            {
+                int status = m_adapter->devicesetDeviceRunPost(deviceSetIndex, normalResponse, errorResponse);
+                return batchResponse(status, normalResponse, errorResponse, result);
+            }
+            else if (method == "DELETE")
+            {
+                int status = m_adapter->devicesetDeviceRunDelete(deviceSetIndex, normalResponse, errorResponse);
+                return batchResponse(status, normalResponse, errorResponse, result);
+            }
+        }
+        else if (route == RouteDevicesetChannel)
+        {
+            int deviceSetIndex = boost::lexical_cast<int>(indexes[0]);
+
+            if (method == "POST")
+            {
+                SWGSDRangel::SWGChannelSettings channelQuery;
+                SWGSDRangel::SWGSuccessResponse normalResponse;
+                resetChannelSettings(channelQuery);
+                channelQuery.setTx(jsonObject.contains("tx") ? jsonObject["tx"].toInt() : 0); // assume Rx
+
+                if (!jsonObject.contains("channelType") || !jsonObject["channelType"].isString()) {
+                    return batchError(400, "Invalid JSON request", result);
+                }
+
+                channelQuery.setChannelType(new QString(jsonObject["channelType"].toString()));
+                int status = m_adapter->devicesetChannelPost(deviceSetIndex, channelQuery, normalResponse, errorResponse);
+                return batchResponse(status, normalResponse, errorResponse, result);
+            }
+        }
+        else if (route == RouteDevicesetChannelIndex)
+        {
+            int deviceSetIndex = boost::lexical_cast<int>(indexes[0]);
+            int channelIndex = boost::lexical_cast<int>(indexes[1]);
+
+            if (method == "DELETE")
+            {
+                SWGSDRangel::SWGSuccessResponse normalResponse;
+                int status = m_adapter->devicesetChannelDelete(deviceSetIndex, channelIndex, normalResponse, errorResponse);
+                return batchResponse(status, normalResponse, errorResponse, result);
+            }
+        }
+        else if (route == RouteDevicesetChannelSettings)
+        {
+            int deviceSetIndex = boost::lexical_cast<int>(indexes[0]);
+            int channelIndex = boost::lexical_cast<int>(indexes[1]);
+
+            if ((method == "PUT") || (method == "PATCH"))
+            {
+                SWGSDRangel::SWGChannelSettings normalResponse;
+                resetChannelSettings(normalResponse);
+                QStringList channelSettingsKeys;
+
+                if (!validateChannelSettings(normalResponse, jsonObject, channelSettingsKeys)) {
+                    return batchError(400, "Invalid JSON request", result);
+                }
+
+                int status = m_adapter->devicesetChannelSettingsPutPatch(
+                        deviceSetIndex,
+                        channelIndex,
+                        (method == "PUT"), // force settings on PUT
+                        channelSettingsKeys,
+                        normalResponse,
+                        errorResponse);
+                return batchResponse(status, normalResponse, errorResponse, result);
+            }
+        }
+        else
+        {
+            return batchError(400, "Operation not supported in batch", result);
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        return batchError(400, "Wrong integer conversion on index", result);
+    }
+
+    return batchError(405, "Invalid HTTP method", result);
+}
+
+int WebAPIRequestMapper::batchResponse(
+        int status,
+        SWGSDRangel::SWGObject& normalResponse,
+        SWGSDRangel::SWGErrorResponse& errorResponse,
+        QJsonObject& result)
+{
+    QString json = (status/100 == 2) ? normalResponse.asJson() : errorResponse.asJson();
+    result["status"] = status;
+    result["response"] = QJsonDocument::fromJson(json.toUtf8()).object();
+    return status;
+}
+
+int WebAPIRequestMapper::batchError(int status, const QString& message, QJsonObject& result)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    errorResponse.init();
+    *errorResponse.getMessage() = message;
+    return batchResponse(status, errorResponse, errorResponse, result);
+}
+
 void WebAPIRequestMapper::devicesetService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
 {
     SWGSDRangel::SWGErrorResponse errorResponse;
@@ -1625,61 +2027,762 @@ void WebAPIRequestMapper::devicesetChannelReportService(
     }
 }
 
-bool WebAPIRequestMapper::parseJsonBody(QString& jsonStr, QJsonObject& jsonObject, qtwebapp::HttpResponse& response)
+void WebAPIRequestMapper::devicesetSpectrumArchiveService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
 {
     SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
 
     try
     {
-        QByteArray jsonBytes(jsonStr.toStdString().c_str());
-        QJsonParseError error;
-        QJsonDocument doc = QJsonDocument::fromJson(jsonBytes, &error);
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+        QSharedPointer<SpectrumArchive> archive;
+        int status = m_adapter->devicesetSpectrumArchive(deviceSetIndex, archive, errorResponse);
 
-        if (error.error == QJsonParseError::NoError)
+        if (status/100 != 2)
         {
-            jsonObject = doc.object();
+            response.setStatus(status);
+            response.write(errorResponse.asJson().toUtf8());
+            return;
+        }
+
+        if (request.getMethod() == "GET")
+        {
+            SWGSDRangel::SWGSpectrumArchiveStatus normalResponse;
+            spectrumArchiveStatus(*archive, normalResponse);
+            response.setStatus(200);
+            response.write(normalResponse.asJson().toUtf8());
+        }
+        else if (request.getMethod() == "POST") // start recording
+        {
+            QString jsonStr = request.getBody();
+            QJsonObject jsonObject;
+
+            if (parseJsonBody(jsonStr, jsonObject, response))
+            {
+                SWGSDRangel::SWGSpectrumArchiveSettings query;
+                query.init();
+                query.fromJsonObject(jsonObject);
+                int rowPeriod = jsonObject.contains("rowPeriod") ? query.getRowPeriod() : 500;
+
+                if ((query.getDirectory() == 0) || query.getDirectory()->isEmpty())
+                {
+                    response.setStatus(400,"Invalid JSON format");
+                    errorResponse.init();
+                    *errorResponse.getMessage() = "Invalid JSON format: missing directory";
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+                else if (archive->open(*query.getDirectory(), rowPeriod))
+                {
+                    SWGSDRangel::SWGSpectrumArchiveStatus normalResponse;
+                    spectrumArchiveStatus(*archive, normalResponse);
+                    response.setStatus(200);
+                    response.write(normalResponse.asJson().toUtf8());
+                }
+                else
+                {
+                    response.setStatus(500,"Cannot open archive");
+                    errorResponse.init();
+                    *errorResponse.getMessage() = QString("Cannot open archive in %1").arg(*query.getDirectory());
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+            }
+        }
+        else if (request.getMethod() == "DELETE") // stop recording
+        {
+            archive->close();
+            SWGSDRangel::SWGSpectrumArchiveStatus normalResponse;
+            spectrumArchiveStatus(*archive, normalResponse);
+            response.setStatus(200);
+            response.write(normalResponse.asJson().toUtf8());
         }
         else
         {
-            QString errorMsg = QString("Input JSON error: ") + error.errorString() + QString(" at offset ") + QString::number(error.offset);
+            response.setStatus(405,"Invalid HTTP method");
             errorResponse.init();
-            *errorResponse.getMessage() = errorMsg;
-            response.setStatus(400, errorMsg.toUtf8());
+            *errorResponse.getMessage() = "Invalid HTTP method";
             response.write(errorResponse.asJson().toUtf8());
         }
-
-        return (error.error == QJsonParseError::NoError);
     }
-    catch (const std::exception& ex)
+    catch (const boost::bad_lexical_cast &e)
     {
-        QString errorMsg = QString("Error parsing request: ") + ex.what();
         errorResponse.init();
-        *errorResponse.getMessage() = errorMsg;
-        response.setStatus(500, errorMsg.toUtf8());
+        *errorResponse.getMessage() = "Wrong integer conversion on device set index";
+        response.setStatus(400,"Invalid data");
         response.write(errorResponse.asJson().toUtf8());
-
-        return false;
     }
 }
 
-bool WebAPIRequestMapper::validatePresetTransfer(SWGSDRangel::SWGPresetTransfer& presetTransfer)
+void WebAPIRequestMapper::devicesetSpectrumArchiveDataService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
 {
-    SWGSDRangel::SWGPresetIdentifier *presetIdentifier = presetTransfer.getPreset();
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
 
-    if (presetIdentifier == 0) {
-        return false;
+    if (request.getMethod() != "GET")
+    {
+        response.setStatus(405,"Invalid HTTP method");
+        errorResponse.init();
+        *errorResponse.getMessage() = "Invalid HTTP method";
+        response.write(errorResponse.asJson().toUtf8());
+        return;
     }
 
-    return validatePresetIdentifer(*presetIdentifier);
-}
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+        QSharedPointer<SpectrumArchive> archive;
+        int status = m_adapter->devicesetSpectrumArchive(deviceSetIndex, archive, errorResponse);
 
-bool WebAPIRequestMapper::validatePresetIdentifer(SWGSDRangel::SWGPresetIdentifier& presetIdentifier)
-{
-    return (presetIdentifier.getGroupName() && presetIdentifier.getName() && presetIdentifier.getType());
-}
+        if (status/100 != 2)
+        {
+            response.setStatus(status);
+            response.write(errorResponse.asJson().toUtf8());
+            return;
+        }
 
-bool WebAPIRequestMapper::validatePresetExport(SWGSDRangel::SWGPresetExport& presetExport)
-{
+        qint64 archiveStart, archiveEnd;
+        quint64 nbRows, dataSize;
+        archive->getExtent(archiveStart, archiveEnd, nbRows, dataSize);
+
+        if (nbRows == 0)
+        {
+            response.setStatus(404,"Not found");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Spectrum archive is empty";
+            response.write(errorResponse.asJson().toUtf8());
+            return;
+        }
+
+        // defaults: the last hour of the archive over its whole frequency range
+        QByteArray param;
+        SpectrumArchive::Window window;
+        window.m_endTime = (param = request.getParameter("endTime")).isEmpty() ? archiveEnd : boost::lexical_cast<qint64>(param.toStdString());
+        window.m_startTime = (param = request.getParameter("startTime")).isEmpty() ? window.m_endTime - 3600000 : boost::lexical_cast<qint64>(param.toStdString());
+        window.m_startFrequency = (param = request.getParameter("startFrequency")).isEmpty() ? 0 : boost::lexical_cast<qint64>(param.toStdString());
+        window.m_endFrequency = (param = request.getParameter("endFrequency")).isEmpty() ? 0 : boost::lexical_cast<qint64>(param.toStdString());
+        window.m_nbRows = (param = request.getParameter("rows")).isEmpty() ? 256 : boost::lexical_cast<int>(param.toStdString());
+        window.m_nbColumns = (param = request.getParameter("columns")).isEmpty() ? 512 : boost::lexical_cast<int>(param.toStdString());
+
+        if ((window.m_nbRows < 1) || (window.m_nbRows > 4096) || (window.m_nbColumns < 1) || (window.m_nbColumns > 4096)
+            || (window.m_endTime <= window.m_startTime) || (window.m_endFrequency < window.m_startFrequency))
+        {
+            response.setStatus(400,"Invalid data");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid window: rows and columns are 1 to 4096 and ranges cannot be empty";
+            response.write(errorResponse.asJson().toUtf8());
+            return;
+        }
+
+        if (!archive->query(window))
+        {
+            response.setStatus(404,"Not found");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Spectrum archive is empty";
+            response.write(errorResponse.asJson().toUtf8());
+            return;
+        }
+
+        SWGSDRangel::SWGSpectrumArchiveData normalResponse;
+        normalResponse.init();
+        normalResponse.setStartTime(window.m_startTime);
+        normalResponse.setEndTime(window.m_endTime);
+        normalResponse.setStartFrequency(window.m_startFrequency);
+        normalResponse.setEndFrequency(window.m_endFrequency);
+        normalResponse.setNbRows(window.m_nbRows);
+        normalResponse.setNbColumns(window.m_nbColumns);
+        normalResponse.setNbArchiveRows(window.m_nbArchiveRows);
+        normalResponse.setDbMax(window.m_dbMax);
+        normalResponse.setDbStep(SpectrumArchive::m_dbStep);
+        normalResponse.setNoData(SpectrumArchive::m_noData);
+        *normalResponse.getData() = QString(QByteArray((const char *) window.m_values.data(), window.m_values.size()).toBase64());
+        response.setStatus(200);
+        response.write(normalResponse.asJson().toUtf8());
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on index or query parameter";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::spectrumArchiveStatus(SpectrumArchive& archive, SWGSDRangel::SWGSpectrumArchiveStatus& status)
+{
+    qint64 startTime, endTime;
+    quint64 nbRows, dataSize;
+    archive.getExtent(startTime, endTime, nbRows, dataSize);
+
+    status.init();
+    status.setRecording(archive.isOpen() ? 1 : 0);
+    *status.getDirectory() = archive.getDirectory();
+    status.setRowPeriod(archive.getRowPeriod());
+    status.setStartTime(startTime);
+    status.setEndTime(endTime);
+    status.setNbRows(nbRows);
+    status.setDataSize(dataSize);
+}
+
+void WebAPIRequestMapper::devicesetSpectrumScannerService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+        QSharedPointer<SpectrumScanner> scanner;
+        int status = m_adapter->devicesetSpectrumScanner(deviceSetIndex, scanner, errorResponse);
+
+        if (status/100 != 2)
+        {
+            response.setStatus(status);
+            response.write(errorResponse.asJson().toUtf8());
+            return;
+        }
+
+        if (request.getMethod() == "GET")
+        {
+            SWGSDRangel::SWGSpectrumScannerStatus normalResponse;
+            spectrumScannerStatus(*scanner, normalResponse);
+            response.setStatus(200);
+            response.write(normalResponse.asJson().toUtf8());
+        }
+        else if (request.getMethod() == "POST") // start scanning
+        {
+            QString jsonStr = request.getBody();
+            QJsonObject jsonObject;
+
+            if (parseJsonBody(jsonStr, jsonObject, response))
+            {
+                SWGSDRangel::SWGSpectrumScannerSettings query;
+                query.fromJsonObject(jsonObject);
+                // the fields that are not in the request keep their defaults
+                SpectrumScanner::Settings settings;
+                settings.m_startFrequency = query.getStartFrequency();
+                settings.m_endFrequency = query.getEndFrequency();
+
+                if (jsonObject.contains("fftSize")) {
+                    settings.m_fftSize = query.getFftSize();
+                }
+                if (jsonObject.contains("averages")) {
+                    settings.m_nbAverages = query.getAverages();
+                }
+                if (jsonObject.contains("usableBandwidth")) {
+                    settings.m_usableBandwidth = query.getUsableBandwidth();
+                }
+                if (jsonObject.contains("overlap")) {
+                    settings.m_overlap = query.getOverlap();
+                }
+                if (jsonObject.contains("settlingTime")) {
+                    settings.m_settlingTime = query.getSettlingTime();
+                }
+                if (jsonObject.contains("retuneTimeout")) {
+                    settings.m_retuneTimeout = query.getRetuneTimeout();
+                }
+                if (jsonObject.contains("window"))
+                {
+                    int window = query.getWindow();
+                    settings.m_window = (FFTWindow::Function) (window < 0 ? 0 : window > (int) FFTWindow::Rectangle ? (int) FFTWindow::Rectangle : window);
+                }
+                if (jsonObject.contains("workers")) {
+                    settings.m_nbWorkers = query.getWorkers();
+                }
+
+                settings.m_continuous = query.getContinuous() != 0;
+
+                if (scanner->startScan(settings))
+                {
+                    SWGSDRangel::SWGSpectrumScannerStatus normalResponse;
+                    spectrumScannerStatus(*scanner, normalResponse);
+                    response.setStatus(200);
+                    response.write(normalResponse.asJson().toUtf8());
+                }
+                else
+                {
+                    response.setStatus(400,"Invalid JSON request");
+                    errorResponse.init();
+                    *errorResponse.getMessage() = "Invalid scan: check the frequency range and FFT size or start the device";
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+            }
+        }
+        else if (request.getMethod() == "DELETE") // stop scanning
+        {
+            scanner->stopScan();
+            SWGSDRangel::SWGSpectrumScannerStatus normalResponse;
+            spectrumScannerStatus(*scanner, normalResponse);
+            response.setStatus(200);
+            response.write(normalResponse.asJson().toUtf8());
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on device set index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::devicesetSpectrumScannerDataService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    if (request.getMethod() != "GET")
+    {
+        response.setStatus(405,"Invalid HTTP method");
+        errorResponse.init();
+        *errorResponse.getMessage() = "Invalid HTTP method";
+        response.write(errorResponse.asJson().toUtf8());
+        return;
+    }
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+        QSharedPointer<SpectrumScanner> scanner;
+        int status = m_adapter->devicesetSpectrumScanner(deviceSetIndex, scanner, errorResponse);
+
+        if (status/100 != 2)
+        {
+            response.setStatus(status);
+            response.write(errorResponse.asJson().toUtf8());
+            return;
+        }
+
+        QByteArray param = request.getParameter("bins");
+        int maxBins = param.isEmpty() ? 4096 : boost::lexical_cast<int>(param.toStdString());
+
+        if ((maxBins < 1) || (maxBins > 65536))
+        {
+            response.setStatus(400,"Invalid data");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid number of bins: 1 to 65536";
+            response.write(errorResponse.asJson().toUtf8());
+            return;
+        }
+
+        std::vector<Real> spectrum;
+        qint64 startFrequency;
+        double binWidth;
+        SpectrumScanner::Report report;
+
+        if (!scanner->getSpectrum(spectrum, startFrequency, binWidth, report))
+        {
+            response.setStatus(404,"Not found");
+            errorResponse.init();
+            *errorResponse.getMessage() = "No sweep completed yet";
+            response.write(errorResponse.asJson().toUtf8());
+            return;
+        }
+
+        // max hold decimation down to the requested number of bins
+        int decimation = (spectrum.size() + maxBins - 1) / maxBins;
+        SWGSDRangel::SWGSpectrumScannerData normalResponse;
+        normalResponse.init();
+        QList<float> *power = normalResponse.getPower();
+
+        for (unsigned int i = 0; i < spectrum.size(); i += decimation)
+        {
+            Real max = spectrum[i];
+
+            for (unsigned int j = i + 1; (j < i + decimation) && (j < spectrum.size()); j++) {
+                max = spectrum[j] > max ? spectrum[j] : max;
+            }
+
+            power->append(qRound(max * 10.0f) / 10.0f);
+        }
+
+        normalResponse.setSweepCount(scanner->getSweepCount());
+        normalResponse.setStartFrequency(startFrequency);
+        normalResponse.setBinWidth(binWidth * decimation);
+        normalResponse.setNbBins(power->size());
+        normalResponse.setNoData(SpectrumScanner::m_noData);
+        response.setStatus(200);
+        response.write(normalResponse.asJson().toUtf8());
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on index or query parameter";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::spectrumScannerStatus(SpectrumScanner& scanner, SWGSDRangel::SWGSpectrumScannerStatus& status)
+{
+    SpectrumScanner::Settings settings = scanner.getSettings();
+    SpectrumScanner::Report report;
+    bool swept = scanner.getReport(report);
+
+    status.init();
+    status.setScanning(scanner.isScanning() ? 1 : 0);
+    status.setSweepCount(scanner.getSweepCount());
+    status.setStartFrequency(settings.m_startFrequency);
+    status.setEndFrequency(settings.m_endFrequency);
+    status.setFftSize(settings.m_fftSize);
+    status.setAverages(settings.m_nbAverages);
+    status.setUsableBandwidth(settings.m_usableBandwidth);
+    status.setOverlap(settings.m_overlap);
+    status.setSettlingTime(settings.m_settlingTime);
+    status.setRetuneTimeout(settings.m_retuneTimeout);
+    status.setWindow((int) settings.m_window);
+    status.setWorkers(settings.m_nbWorkers);
+    status.setContinuous(settings.m_continuous ? 1 : 0);
+
+    if (swept) // last sweep. Left unset and out of the JSON until there is one
+    {
+        SWGSDRangel::SWGSpectrumScannerSweepReport *lastSweep = status.getLastSweep();
+        lastSweep->setNbSteps(report.m_nbSteps);
+        lastSweep->setSweepTime(report.m_sweepTime);
+        lastSweep->setStepsPerSecond(report.m_stepsPerSecond);
+        lastSweep->setRetuneTime(report.m_retuneTime);
+        lastSweep->setFftTime(report.m_fftTime);
+        lastSweep->setAcquiredSamples(report.m_acquiredSamples);
+        lastSweep->setDiscardedSamples(report.m_discardedSamples);
+        lastSweep->setNbTimeouts(report.m_nbTimeouts);
+        lastSweep->setMaxPendingJobs(report.m_maxPendingJobs);
+    }
+}
+
+void WebAPIRequestMapper::devicesetActivityService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+        QSharedPointer<ActivityMonitor> monitor;
+        int status = m_adapter->devicesetActivityMonitor(deviceSetIndex, monitor, errorResponse);
+
+        if (status/100 != 2)
+        {
+            response.setStatus(status);
+            response.write(errorResponse.asJson().toUtf8());
+            return;
+        }
+
+        if (request.getMethod() == "GET")
+        {
+            response.setStatus(200);
+            response.write(QJsonDocument(activityMonitorStatus(*monitor)).toJson());
+        }
+        else if (request.getMethod() == "POST") // start monitoring
+        {
+            QString jsonStr = request.getBody();
+            QJsonObject jsonObject;
+
+            if (parseJsonBody(jsonStr, jsonObject, response))
+            {
+                ActivityMonitor::Settings settings;
+                settings.m_rasterOrigin = (qint64) jsonObject["rasterOrigin"].toDouble(settings.m_rasterOrigin);
+                settings.m_channelSpacing = jsonObject["channelSpacing"].toInt(settings.m_channelSpacing);
+                settings.m_channelBandwidth = jsonObject["channelBandwidth"].toInt(settings.m_channelBandwidth);
+                settings.m_nbChannels = jsonObject["nbChannels"].toInt(settings.m_nbChannels);
+                settings.m_usableBandwidth = jsonObject["usableBandwidth"].toDouble(settings.m_usableBandwidth);
+                settings.m_fftSize = jsonObject["fftSize"].toInt(settings.m_fftSize);
+                settings.m_nbAverages = jsonObject["averages"].toInt(settings.m_nbAverages);
+                settings.m_threshold = jsonObject["threshold"].toDouble(settings.m_threshold);
+                settings.m_hysteresis = jsonObject["hysteresis"].toDouble(settings.m_hysteresis);
+                settings.m_attackTime = jsonObject["attackTime"].toInt(settings.m_attackTime);
+                settings.m_holdTime = jsonObject["holdTime"].toInt(settings.m_holdTime);
+                int window = jsonObject["window"].toInt((int) settings.m_window);
+                settings.m_window = (FFTWindow::Function) (window < 0 ? 0 : window > (int) FFTWindow::Rectangle ? (int) FFTWindow::Rectangle : window);
+
+                if (monitor->startMonitor(settings))
+                {
+                    response.setStatus(200);
+                    response.write(QJsonDocument(activityMonitorStatus(*monitor)).toJson());
+                }
+                else
+                {
+                    response.setStatus(400,"Invalid JSON request");
+                    errorResponse.init();
+                    *errorResponse.getMessage() = "Invalid activity monitor settings";
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+            }
+        }
+        else if (request.getMethod() == "DELETE") // stop monitoring
+        {
+            monitor->stopMonitor();
+            response.setStatus(200);
+            response.write(QJsonDocument(activityMonitorStatus(*monitor)).toJson());
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on device set index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::devicesetActivityChannelsService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    if (request.getMethod() != "GET")
+    {
+        response.setStatus(405,"Invalid HTTP method");
+        errorResponse.init();
+        *errorResponse.getMessage() = "Invalid HTTP method";
+        response.write(errorResponse.asJson().toUtf8());
+        return;
+    }
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+        QSharedPointer<ActivityMonitor> monitor;
+        int status = m_adapter->devicesetActivityMonitor(deviceSetIndex, monitor, errorResponse);
+
+        if (status/100 != 2)
+        {
+            response.setStatus(status);
+            response.write(errorResponse.asJson().toUtf8());
+            return;
+        }
+
+        QByteArray param = request.getParameter("active");
+        bool activeOnly = param.isEmpty() ? false : boost::lexical_cast<int>(param.toStdString()) != 0;
+        std::vector<ActivityMonitor::Slot> slots;
+        monitor->getSlots(slots);
+        QJsonArray channels;
+
+        for (std::vector<ActivityMonitor::Slot>::const_iterator it = slots.begin(); it != slots.end(); ++it)
+        {
+            if (activeOnly && !it->m_active) {
+                continue;
+            }
+
+            QJsonObject channel;
+            channel["channel"] = it->m_channel;
+            channel["frequency"] = it->m_frequency;
+            channel["active"] = it->m_active ? 1 : 0;
+            channel["power"] = qRound(it->m_power * 10.0f) / 10.0;
+
+            if (it->m_active) {
+                channel["since"] = it->m_startTime;
+            }
+
+            channels.append(channel);
+        }
+
+        QJsonObject result;
+        result["nbChannels"] = channels.size();
+        result["channels"] = channels;
+        response.setStatus(200);
+        response.write(QJsonDocument(result).toJson(QJsonDocument::Compact));
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on index or query parameter";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::devicesetActivityEventsService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    if (request.getMethod() != "GET")
+    {
+        response.setStatus(405,"Invalid HTTP method");
+        errorResponse.init();
+        *errorResponse.getMessage() = "Invalid HTTP method";
+        response.write(errorResponse.asJson().toUtf8());
+        return;
+    }
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+        QSharedPointer<ActivityMonitor> monitor;
+        int status = m_adapter->devicesetActivityMonitor(deviceSetIndex, monitor, errorResponse);
+
+        if (status/100 != 2)
+        {
+            response.setStatus(status);
+            response.write(errorResponse.asJson().toUtf8());
+            return;
+        }
+
+        QByteArray param = request.getParameter("since");
+        quint64 since = param.isEmpty() ? 0 : boost::lexical_cast<quint64>(param.toStdString());
+        param = request.getParameter("max");
+        int maxEvents = param.isEmpty() ? 256 : boost::lexical_cast<int>(param.toStdString());
+
+        if ((maxEvents < 1) || (maxEvents > 4096))
+        {
+            response.setStatus(400,"Invalid data");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid query: max is 1 to 4096";
+            response.write(errorResponse.asJson().toUtf8());
+            return;
+        }
+
+        std::vector<ActivityMonitor::Event> events;
+        quint64 sequence = monitor->getEvents(since, events, maxEvents);
+        QJsonArray eventsArray;
+
+        for (std::vector<ActivityMonitor::Event>::const_iterator it = events.begin(); it != events.end(); ++it)
+        {
+            QJsonObject event;
+            event["sequence"] = (qint64) it->m_sequence;
+            event["type"] = it->m_start ? "start" : "stop";
+            event["timestamp"] = it->m_timestamp;
+            event["channel"] = it->m_channel;
+            event["frequency"] = it->m_frequency;
+            event["power"] = qRound(it->m_power * 10.0f) / 10.0;
+            event["noiseFloor"] = qRound(it->m_noiseFloor * 10.0f) / 10.0;
+
+            if (!it->m_start) {
+                event["duration"] = it->m_duration;
+            }
+
+            eventsArray.append(event);
+        }
+
+        // never waits: the client polls again from the next cursor
+        quint64 next = events.size() == 0 ? sequence : events.back().m_sequence;
+        QJsonObject result;
+        result["since"] = (qint64) since;
+        result["next"] = (qint64) next;
+        result["pending"] = next < sequence ? 1 : 0;
+        result["lost"] = (events.size() != 0) && (events.front().m_sequence > since + 1) ? 1 : 0;
+        result["events"] = eventsArray;
+        response.setStatus(200);
+        response.write(QJsonDocument(result).toJson(QJsonDocument::Compact));
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on index or query parameter";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+QJsonObject WebAPIRequestMapper::activityMonitorStatus(ActivityMonitor& monitor)
+{
+    ActivityMonitor::Settings settings = monitor.getSettings();
+    ActivityMonitor::Report report;
+    monitor.getReport(report);
+
+    QJsonObject status;
+    status["monitoring"] = monitor.isMonitoring() ? 1 : 0;
+    status["rasterOrigin"] = settings.m_rasterOrigin;
+    status["channelSpacing"] = settings.m_channelSpacing;
+    status["channelBandwidth"] = settings.m_channelBandwidth;
+    status["nbChannels"] = settings.m_nbChannels;
+    status["usableBandwidth"] = settings.m_usableBandwidth;
+    status["fftSize"] = settings.m_fftSize;
+    status["averages"] = settings.m_nbAverages;
+    status["threshold"] = settings.m_threshold;
+    status["hysteresis"] = settings.m_hysteresis;
+    status["attackTime"] = settings.m_attackTime;
+    status["holdTime"] = settings.m_holdTime;
+    status["window"] = (int) settings.m_window;
+
+    QJsonObject reportObject;
+    reportObject["sampleRate"] = report.m_sampleRate;
+    reportObject["centerFrequency"] = report.m_centerFrequency;
+    reportObject["nbSlots"] = (int) report.m_nbSlots;
+    reportObject["nbActive"] = (int) report.m_nbActive;
+    reportObject["noiseFloor"] = qRound(report.m_noiseFloor * 10.0f) / 10.0;
+    reportObject["nbDetections"] = (qint64) report.m_nbDetections;
+    reportObject["detectionTime"] = report.m_detectionTime;
+    reportObject["load"] = report.m_load;
+    status["report"] = reportObject;
+
+    return status;
+}
+
+bool WebAPIRequestMapper::parseJsonBody(QString& jsonStr, QJsonObject& jsonObject, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+
+    try
+    {
+        QByteArray jsonBytes(jsonStr.toStdString().c_str());
+        QJsonParseError error;
+        QJsonDocument doc = QJsonDocument::fromJson(jsonBytes, &error);
+
+        if (error.error == QJsonParseError::NoError)
+        {
+            jsonObject = doc.object();
+        }
+        else
+        {
+            QString errorMsg = QString("Input JSON error: ") + error.errorString() + QString(" at offset ") + QString::number(error.offset);
+            errorResponse.init();
+            *errorResponse.getMessage() = errorMsg;
+            response.setStatus(400, errorMsg.toUtf8());
+            response.write(errorResponse.asJson().toUtf8());
+        }
+
+        return (error.error == QJsonParseError::NoError);
+    }
+    catch (const std::exception& ex)
+    {
+        QString errorMsg = QString("Error parsing request: ") + ex.what();
+        errorResponse.init();
+        *errorResponse.getMessage() = errorMsg;
+        response.setStatus(500, errorMsg.toUtf8());
+        response.write(errorResponse.asJson().toUtf8());
+
+        return false;
+    }
+}
+
+bool WebAPIRequestMapper::validatePresetTransfer(SWGSDRangel::SWGPresetTransfer& presetTransfer)
+{
+    SWGSDRangel::SWGPresetIdentifier *presetIdentifier = presetTransfer.getPreset();
+
+    if (presetIdentifier == 0) {
+        return false;
+    }
+
+    return validatePresetIdentifer(*presetIdentifier);
+}
+
+bool WebAPIRequestMapper::validatePresetIdentifer(SWGSDRangel::SWGPresetIdentifier& presetIdentifier)
+{
+    return (presetIdentifier.getGroupName() && presetIdentifier.getName() && presetIdentifier.getType());
+}
+
+bool WebAPIRequestMapper::validatePresetExport(SWGSDRangel::SWGPresetExport& presetExport)
+{
     if (presetExport.getFilePath() == 0) {
         return false;
     }
@@ -2447,6 +3550,11 @@ bool WebAPIRequestMapper::validateAudioOutputDevice(
         audioOutputDevice.setUdpPort(jsonObject["udpPort"].toInt());
         audioOutputDeviceKeys.append("udpPort");
     }
+    if (jsonObject.contains("latency"))
+    {
+        audioOutputDevice.setLatency(jsonObject["latency"].toInt());
+        audioOutputDeviceKeys.append("latency");
+    }
     return true;
 }
 
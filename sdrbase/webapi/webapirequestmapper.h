@@ -26,13 +26,17 @@
 #include "httpresponse.h"
 #include "staticfilecontroller.h"
 #include "webapiadapterinterface.h"
+#include "webapiroutetrie.h"
 
 #include "export.h"
 
 namespace SWGSDRangel
 {
+    class SWGObject;
     class SWGPresetTransfer;
     class SWGPresetIdentifier;
+    class SWGSpectrumArchiveStatus;
+    class SWGSpectrumScannerStatus;
 }
 
 class SDRBASE_API WebAPIRequestMapper : public qtwebapp::HttpRequestHandler {
@@ -43,9 +47,54 @@ public:
     void service(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void setAdapter(WebAPIAdapterInterface *adapter) { m_adapter = adapter; }
 
+    static void resetDeviceReport(SWGSDRangel::SWGDeviceReport& deviceReport);
+
+    /** Apply a batch of operations in sequence and return the aggregated result as JSON. Must run in the main thread. */
+    Q_INVOKABLE QByteArray processBatch(const QByteArray& body);
+
 private:
+    enum Route
+    {
+        RouteInstanceSummary,
+        RouteInstanceDevices,
+        RouteInstanceChannels,
+        RouteInstanceLogging,
+        RouteInstanceAudio,
+        RouteInstanceAudioInputParameters,
+        RouteInstanceAudioOutputParameters,
+        RouteInstanceAudioInputCleanup,
+        RouteInstanceAudioOutputCleanup,
+        RouteInstanceLocation,
+        RouteInstanceDVSerial,
+        RouteInstancePresets,
+        RouteInstancePreset,
+        RouteInstancePresetFile,
+        RouteInstanceDeviceSets,
+        RouteInstanceDeviceSet,
+        RouteInstanceBatch,
+        RouteDeviceset,
+        RouteDevicesetFocus,
+        RouteDevicesetDevice,
+        RouteDevicesetDeviceSettings,
+        RouteDevicesetDeviceRun,
+        RouteDevicesetDeviceReport,
+        RouteDevicesetChannelsReport,
+        RouteDevicesetChannel,
+        RouteDevicesetChannelIndex,
+        RouteDevicesetChannelSettings,
+        RouteDevicesetChannelReport,
+        RouteDevicesetSpectrumArchive,
+        RouteDevicesetSpectrumArchiveData,
+        RouteDevicesetSpectrumScanner,
+        RouteDevicesetSpectrumScannerData,
+        RouteDevicesetActivity,
+        RouteDevicesetActivityChannels,
+        RouteDevicesetActivityEvents
+    };
+
     WebAPIAdapterInterface *m_adapter;
     qtwebapp::StaticFileController *m_staticFileController;
+    WebAPIRouteTrie m_routes;
 
     void instanceSummaryService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceDevicesService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
@@ -63,6 +112,7 @@ private:
     void instancePresetFileService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceDeviceSetsService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceDeviceSetService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void instanceBatchService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
 
     void devicesetService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void devicesetFocusService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
@@ -75,6 +125,21 @@ private:
     void devicesetChannelIndexService(const std::string& deviceSetIndexStr, const std::string& channelIndexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void devicesetChannelSettingsService(const std::string& deviceSetIndexStr, const std::string& channelIndexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void devicesetChannelReportService(const std::string& deviceSetIndexStr, const std::string& channelIndexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void devicesetSpectrumArchiveService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void devicesetSpectrumArchiveDataService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    static void spectrumArchiveStatus(SpectrumArchive& archive, SWGSDRangel::SWGSpectrumArchiveStatus& status);
+    void devicesetSpectrumScannerService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void devicesetSpectrumScannerDataService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    static void spectrumScannerStatus(SpectrumScanner& scanner, SWGSDRangel::SWGSpectrumScannerStatus& status);
+    void devicesetActivityService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void devicesetActivityChannelsService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void devicesetActivityEventsService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    static QJsonObject activityMonitorStatus(ActivityMonitor& monitor);
+
+    int batchDeviceSetIndex(const QString& path) const;
+    int batchOperation(const QString& method, const QString& path, const QJsonObject& query, const QJsonObject& body, QJsonObject& result);
+    static int batchResponse(int status, SWGSDRangel::SWGObject& normalResponse, SWGSDRangel::SWGErrorResponse& errorResponse, QJsonObject& result);
+    static int batchError(int status, const QString& message, QJsonObject& result);
 
     bool validatePresetTransfer(SWGSDRangel::SWGPresetTransfer& presetTransfer);
     bool validatePresetIdentifer(SWGSDRangel::SWGPresetIdentifier& presetIdentifier);
@@ -94,7 +159,6 @@ private:
     bool parseJsonBody(QString& jsonStr, QJsonObject& jsonObject, qtwebapp::HttpResponse& response);
 
     void resetDeviceSettings(SWGSDRangel::SWGDeviceSettings& deviceSettings);
-    void resetDeviceReport(SWGSDRangel::SWGDeviceReport& deviceReport);
     void resetChannelSettings(SWGSDRangel::SWGChannelSettings& deviceSettings);
     void resetChannelReport(SWGSDRangel::SWGChannelReport& deviceSettings);
     void resetAudioInputDevice(SWGSDRangel::SWGAudioInputDevice& audioInputDevice);
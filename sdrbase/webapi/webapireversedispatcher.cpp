@@ -0,0 +1,445 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QCoreApplication>
+#include <QThread>
+#include <QNetworkAccessManager>
+#include <QNetworkRequest>
+#include <QNetworkReply>
+#include <QBuffer>
+#include <QUrl>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QMutexLocker>
+#include <QDebug>
+
+#include "webapireversedispatcher.h"
+
+Q_GLOBAL_STATIC(WebAPIReverseDispatcher, webAPIReverseDispatcher)
+WebAPIReverseDispatcher *WebAPIReverseDispatcher::instance()
+{
+    return webAPIReverseDispatcher;
+}
+
+WebAPIReverseDispatcher::WebAPIReverseDispatcher() :
+    m_timer(this),
+    m_flushScheduled(false),
+    m_windowMs(50),
+    m_batch(false),
+    m_inFlight(0),
+    m_posted(0),
+    m_coalesced(0),
+    m_sent(0),
+    m_failures(0)
+{
+    m_networkManager = new QNetworkAccessManager(this);
+    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
+    m_timer.setSingleShot(true);
+    connect(&m_timer, SIGNAL(timeout()), this, SLOT(flush()));
+
+    // requests are posted from device and channel threads but sent from the main thread
+    if (QCoreApplication::instance() && (thread() != QCoreApplication::instance()->thread())) {
+        moveToThread(QCoreApplication::instance()->thread());
+    }
+}
+
+WebAPIReverseDispatcher::~WebAPIReverseDispatcher()
+{
+    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
+}
+
+void WebAPIReverseDispatcher::setWindowMs(int windowMs)
+{
+    m_windowMs = windowMs < 0 ? 0 : windowMs;
+}
+
+void WebAPIReverseDispatcher::sendPatch(const QString& address, uint16_t port, const QString& path, const QString& jsonBody)
+{
+    Operation operation;
+    operation.m_method = "PATCH";
+    operation.m_path = path;
+    operation.m_body = jsonBody.toUtf8();
+    operation.m_hasBody = true;
+    post(address, port, operation);
+}
+
+void WebAPIReverseDispatcher::send(const QString& address, uint16_t port, const QString& method, const QString& path)
+{
+    Operation operation;
+    operation.m_method = method;
+    operation.m_path = path;
+    operation.m_hasBody = false;
+    post(address, port, operation);
+}
+
+int WebAPIReverseDispatcher::getQueueDepth()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    int depth = 0;
+
+    for (QMap<Target, QList<Operation> >::const_iterator it = m_pending.begin(); it != m_pending.end(); ++it) {
+        depth += it->size();
+    }
+
+    return depth;
+}
+
+int WebAPIReverseDispatcher::getInFlight()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_inFlight;
+}
+
+quint64 WebAPIReverseDispatcher::getPosted()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_posted;
+}
+
+quint64 WebAPIReverseDispatcher::getCoalesced()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_coalesced;
+}
+
+quint64 WebAPIReverseDispatcher::getSent()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_sent;
+}
+
+quint64 WebAPIReverseDispatcher::getFailures()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_failures;
+}
+
+void WebAPIReverseDispatcher::post(const QString& address, uint16_t port, const Operation& operation)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    QList<Operation>& operations = m_pending[Target(address, port)];
+    m_posted++;
+
+    // only the last pending request can absorb the new one so that the sequence is kept
+    // e.g. a PATCH is not moved across a run POST or DELETE and a DELETE then POST restart is sent as is
+    if (!operations.isEmpty()
+     && (operations.last().m_path == operation.m_path)
+     && (operations.last().m_method == operation.m_method))
+    {
+        if (operation.m_method == "PATCH") {
+            operations.last().m_body = merge(operations.last().m_body, operation.m_body);
+        } else {
+            operations.last() = operation; // repeated request
+        }
+
+        m_coalesced++;
+        return;
+    }
+
+    operations.append(operation);
+
+    if (!m_flushScheduled)
+    {
+        m_flushScheduled = true;
+        QMetaObject::invokeMethod(this, "scheduleFlush", Qt::QueuedConnection);
+    }
+}
+
+void WebAPIReverseDispatcher::scheduleFlush()
+{
+    if (!m_timer.isActive()) {
+        m_timer.start(m_windowMs);
+    }
+}
+
+void WebAPIReverseDispatcher::flush()
+{
+    QMap<Target, QList<Operation> > pending;
+
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        pending.swap(m_pending);
+        m_flushScheduled = false;
+    }
+
+    for (QMap<Target, QList<Operation> >::const_iterator it = pending.begin(); it != pending.end(); ++it)
+    {
+        if (m_batch && (it->size() > 1))
+        {
+            sendBatch(it.key(), *it);
+        }
+        else
+        {
+            for (QList<Operation>::const_iterator opIt = it->begin(); opIt != it->end(); ++opIt) {
+                sendOperation(it.key(), *opIt);
+            }
+        }
+    }
+}
+
+void WebAPIReverseDispatcher::sendOperation(const Target& target, const Operation& operation)
+{
+    QNetworkRequest request(QUrl(QString("http://%1:%2%3").arg(target.first).arg(target.second).arg(operation.m_path)));
+    QNetworkReply *reply;
+
+    if (operation.m_hasBody)
+    {
+        request.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+        QBuffer *buffer = new QBuffer();
+        buffer->setData(operation.m_body);
+        buffer->open(QBuffer::ReadOnly);
+        reply = m_networkManager->sendCustomRequest(request, operation.m_method.toLatin1(), buffer);
+        buffer->setParent(reply);
+    }
+    else
+    {
+        reply = m_networkManager->sendCustomRequest(request, operation.m_method.toLatin1());
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+    m_inFlight++;
+    m_sent++;
+}
+
+void WebAPIReverseDispatcher::sendBatch(const Target& target, const QList<Operation>& operations)
+{
+    // the bodies are inserted verbatim so that the order of their fields is kept
+    QByteArray batch("{\"stopOnError\":false,\"operations\":[");
+
+    for (QList<Operation>::const_iterator it = operations.begin(); it != operations.end(); ++it)
+    {
+        if (it != operations.begin()) {
+            batch.append(',');
+        }
+
+        batch.append("{\"method\":").append(quote(it->m_method));
+        batch.append(",\"path\":").append(quote(it->m_path));
+
+        if (it->m_hasBody) {
+            batch.append(",\"body\":").append(it->m_body);
+        }
+
+        batch.append('}');
+    }
+
+    batch.append("]}");
+
+    Operation operation;
+    operation.m_method = "POST";
+    operation.m_path = "/sdrangel/batch";
+    operation.m_body = batch;
+    operation.m_hasBody = true;
+    sendOperation(target, operation);
+}
+
+QByteArray WebAPIReverseDispatcher::merge(const QByteArray& into, const QByteArray& from)
+{
+    Members intoMembers, fromMembers;
+
+    if (!members(into, intoMembers) || !members(from, fromMembers)) {
+        return from; // not objects: last write wins
+    }
+
+    // fields already present keep their place and new fields are appended
+    for (Members::const_iterator it = fromMembers.begin(); it != fromMembers.end(); ++it)
+    {
+        Members::iterator intoIt = intoMembers.begin();
+
+        for (; intoIt != intoMembers.end(); ++intoIt)
+        {
+            if (intoIt->first == it->first) {
+                break;
+            }
+        }
+
+        if (intoIt == intoMembers.end()) {
+            intoMembers.append(*it);
+        } else if (intoIt->second.startsWith('{') && it->second.startsWith('{')) {
+            intoIt->second = merge(intoIt->second, it->second);
+        } else {
+            intoIt->second = it->second;
+        }
+    }
+
+    QByteArray merged("{");
+
+    for (Members::const_iterator it = intoMembers.begin(); it != intoMembers.end(); ++it)
+    {
+        if (it != intoMembers.begin()) {
+            merged.append(',');
+        }
+
+        merged.append(it->first).append(':').append(it->second);
+    }
+
+    merged.append('}');
+    return merged;
+}
+
+bool WebAPIReverseDispatcher::members(const QByteArray& json, Members& members)
+{
+    int pos = skipSpaces(json, 0);
+
+    if ((pos >= json.size()) || (json[pos] != '{')) {
+        return false;
+    }
+
+    pos = skipSpaces(json, pos + 1);
+
+    while ((pos < json.size()) && (json[pos] != '}'))
+    {
+        int keyEnd = skipValue(json, pos);
+
+        if ((keyEnd < 0) || (json[pos] != '"')) {
+            return false;
+        }
+
+        int valuePos = skipSpaces(json, keyEnd);
+
+        if ((valuePos >= json.size()) || (json[valuePos] != ':')) {
+            return false;
+        }
+
+        valuePos = skipSpaces(json, valuePos + 1);
+        int valueEnd = skipValue(json, valuePos);
+
+        if (valueEnd < 0) {
+            return false;
+        }
+
+        members.append(QPair<QByteArray, QByteArray>(json.mid(pos, keyEnd - pos), json.mid(valuePos, valueEnd - valuePos)));
+        pos = skipSpaces(json, valueEnd);
+
+        if ((pos < json.size()) && (json[pos] == ',')) {
+            pos = skipSpaces(json, pos + 1);
+        }
+    }
+
+    return pos < json.size();
+}
+
+/** Returns the position after the string, object, array or literal at pos or -1 if it is not terminated */
+int WebAPIReverseDispatcher::skipValue(const QByteArray& json, int pos)
+{
+    int depth = 0;
+    bool inString = false;
+
+    for (; pos < json.size(); pos++)
+    {
+        char c = json[pos];
+
+        if (inString)
+        {
+            if (c == '\\') {
+                pos++;
+            } else if (c == '"') {
+                inString = false;
+                if (depth == 0) {
+                    return pos + 1;
+                }
+            }
+        }
+        else if (c == '"')
+        {
+            inString = true;
+        }
+        else if ((c == '{') || (c == '['))
+        {
+            depth++;
+        }
+        else if ((c == '}') || (c == ']'))
+        {
+            if (depth == 0) {
+                return pos; // end of a literal in the enclosing object or array
+            } else if (--depth == 0) {
+                return pos + 1;
+            }
+        }
+        else if ((depth == 0) && ((c == ',') || (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n')))
+        {
+            return pos;
+        }
+    }
+
+    return depth == 0 && !inString ? pos : -1;
+}
+
+int WebAPIReverseDispatcher::skipSpaces(const QByteArray& json, int pos)
+{
+    while ((pos < json.size()) && ((json[pos] == ' ') || (json[pos] == '\t') || (json[pos] == '\r') || (json[pos] == '\n'))) {
+        pos++;
+    }
+
+    return pos;
+}
+
+QByteArray WebAPIReverseDispatcher::quote(const QString& string)
+{
+    QByteArray array = QJsonDocument(QJsonArray() << string).toJson(QJsonDocument::Compact);
+    return array.mid(1, array.size() - 2); // strip the brackets
+}
+
+void WebAPIReverseDispatcher::networkManagerFinished(QNetworkReply *reply)
+{
+    QNetworkReply::NetworkError replyError = reply->error();
+
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        m_inFlight--;
+
+        if (replyError) {
+            m_failures++;
+        }
+    }
+
+    if (replyError)
+    {
+        qWarning() << "WebAPIReverseDispatcher::networkManagerFinished:"
+                << reply->url().toString()
+                << " error(" << (int) replyError
+                << "): " << replyError
+                << ": " << reply->errorString();
+        reply->deleteLater();
+        return;
+    }
+
+    QByteArray answer = reply->readAll();
+
+    if (reply->url().path() == "/sdrangel/batch")
+    {
+        QJsonArray results = QJsonDocument::fromJson(answer).object()["results"].toArray();
+
+        for (QJsonArray::const_iterator it = results.begin(); it != results.end(); ++it)
+        {
+            QJsonObject result = (*it).toObject();
+
+            if (result["status"].toInt() / 100 != 2)
+            {
+                m_mutex.lock();
+                m_failures++;
+                m_mutex.unlock();
+                qWarning("WebAPIReverseDispatcher::networkManagerFinished: %s %s failed with status %d",
+                        qPrintable(result["method"].toString()),
+                        qPrintable(result["path"].toString()),
+                        result["status"].toInt());
+            }
+        }
+    }
+
+    qDebug("WebAPIReverseDispatcher::networkManagerFinished: reply:\n%s", answer.constData());
+    reply->deleteLater();
+}
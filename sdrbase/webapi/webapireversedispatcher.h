@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// Shared dispatcher of reverse API requests                                     //
+//                                                                               //
+// Devices and channels post their reverse API requests here instead of using    //
+// their own network access manager. Requests are held for a short window and    //
+// coalesced per target (address and port) with the last request pending for     //
+// that target only, so that the requests are sent in the order posted:          //
+// - a PATCH request on the same path is merged key by key (last write wins).    //
+//   Only the fields present are touched and the order of the fields is kept.    //
+// - the same request without body on the same path replaces the pending one     //
+// When the window expires the pending requests of each target are sent on a     //
+// single network access manager that keeps connections alive. Optionally all    //
+// the requests pending for a target are sent as one /sdrangel/batch request.    //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_WEBAPI_WEBAPIREVERSEDISPATCHER_H_
+#define SDRBASE_WEBAPI_WEBAPIREVERSEDISPATCHER_H_
+
+#include <QObject>
+#include <QTimer>
+#include <QMutex>
+#include <QList>
+#include <QMap>
+#include <QPair>
+#include <QByteArray>
+#include <stdint.h>
+
+#include "export.h"
+
+class QNetworkAccessManager;
+class QNetworkReply;
+
+class SDRBASE_API WebAPIReverseDispatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    WebAPIReverseDispatcher();
+    ~WebAPIReverseDispatcher();
+
+    static WebAPIReverseDispatcher *instance();
+
+    /** Coalescing window in milliseconds. Requests posted within the window are sent together. */
+    void setWindowMs(int windowMs);
+    int getWindowMs() const { return m_windowMs; }
+    /** Send all the requests pending for a target in one /sdrangel/batch request (the target must be a SDRangel instance) */
+    void setBatch(bool batch) { m_batch = batch; }
+    bool getBatch() const { return m_batch; }
+
+    /** Post a PATCH request with a JSON body. Can be called from any thread. */
+    void sendPatch(const QString& address, uint16_t port, const QString& path, const QString& jsonBody);
+    /** Post a request without body e.g. POST or DELETE on a run path. Can be called from any thread. */
+    void send(const QString& address, uint16_t port, const QString& method, const QString& path);
+
+    int getQueueDepth();   //!< requests waiting for the window to expire
+    int getInFlight();     //!< network requests waiting for a reply
+    quint64 getPosted();   //!< requests posted by devices and channels
+    quint64 getCoalesced(); //!< posted requests merged in a pending one
+    quint64 getSent();     //!< network requests sent
+    quint64 getFailures(); //!< network requests or batch operations that failed
+
+private:
+    struct Operation
+    {
+        QString m_method;
+        QString m_path;
+        QByteArray m_body; //!< compact JSON object as posted so that the order of the fields is kept
+        bool m_hasBody;
+    };
+
+    typedef QList<QPair<QByteArray, QByteArray> > Members; //!< raw quoted key and raw value of a JSON object
+
+    typedef QPair<QString, uint16_t> Target;
+
+    QNetworkAccessManager *m_networkManager;
+    QTimer m_timer;
+    QMutex m_mutex;
+    QMap<Target, QList<Operation> > m_pending; //!< guarded by m_mutex
+    bool m_flushScheduled;                     //!< guarded by m_mutex
+    int m_windowMs;
+    bool m_batch;
+    // statistics. Guarded by m_mutex
+    int m_inFlight;
+    quint64 m_posted;
+    quint64 m_coalesced;
+    quint64 m_sent;
+    quint64 m_failures;
+
+    void post(const QString& address, uint16_t port, const Operation& operation);
+    void sendOperation(const Target& target, const Operation& operation);
+    void sendBatch(const Target& target, const QList<Operation>& operations);
+    static QByteArray merge(const QByteArray& into, const QByteArray& from);
+    static bool members(const QByteArray& json, Members& members);
+    static int skipValue(const QByteArray& json, int pos);
+    static int skipSpaces(const QByteArray& json, int pos);
+    static QByteArray quote(const QString& string);
+
+private slots:
+    void scheduleFlush();
+    void flush();
+    void networkManagerFinished(QNetworkReply *reply);
+};
+
+#endif /* SDRBASE_WEBAPI_WEBAPIREVERSEDISPATCHER_H_ */
@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include "webapiroutetrie.h"
+
+WebAPIRouteTrie::Node::~Node()
+{
+    for (std::vector<std::pair<QByteArray, Node*> >::iterator it = m_children.begin(); it != m_children.end(); ++it) {
+        delete it->second;
+    }
+
+    delete m_indexChild;
+}
+
+WebAPIRouteTrie::WebAPIRouteTrie()
+{}
+
+WebAPIRouteTrie::~WebAPIRouteTrie()
+{}
+
+void WebAPIRouteTrie::add(const QByteArray& pattern, int routeId)
+{
+    QList<QByteArray> segments = pattern.split('/');
+    Node *node = &m_root;
+
+    for (int i = 1; i < segments.size(); i++) // first segment is empty as the pattern starts with '/'
+    {
+        if (segments[i] == "{index}")
+        {
+            if (!node->m_indexChild) {
+                node->m_indexChild = new Node();
+            }
+
+            node = node->m_indexChild;
+            continue;
+        }
+
+        Node *next = 0;
+
+        for (std::vector<std::pair<QByteArray, Node*> >::iterator it = node->m_children.begin(); it != node->m_children.end(); ++it)
+        {
+            if (it->first == segments[i])
+            {
+                next = it->second;
+                break;
+            }
+        }
+
+        if (!next)
+        {
+            next = new Node();
+            node->m_children.push_back(std::pair<QByteArray, Node*>(segments[i], next));
+        }
+
+        node = next;
+    }
+
+    node->m_routeId = routeId;
+}
+
+int WebAPIRouteTrie::match(const QByteArray& path, std::string indexes[m_maxIndexes]) const
+{
+    const char *p = path.constData();
+    const char *end = p + path.size();
+    const Node *node = &m_root;
+    int nbIndexes = 0;
+
+    if ((p == end) || (*p != '/')) {
+        return -1;
+    }
+
+    while (p < end)
+    {
+        p++; // skip '/'
+        const char *q = (const char *) memchr(p, '/', end - p);
+
+        if (!q) {
+            q = end;
+        }
+
+        int length = q - p;
+        const Node *next = 0;
+
+        for (std::vector<std::pair<QByteArray, Node*> >::const_iterator it = node->m_children.begin(); it != node->m_children.end(); ++it)
+        {
+            if ((it->first.size() == length) && (memcmp(it->first.constData(), p, length) == 0))
+            {
+                next = it->second;
+                break;
+            }
+        }
+
+        if (!next && node->m_indexChild && (nbIndexes < m_maxIndexes) && isIndex(p, length))
+        {
+            indexes[nbIndexes++].assign(p, length);
+            next = node->m_indexChild;
+        }
+
+        if (!next) {
+            return -1;
+        }
+
+        node = next;
+        p = q;
+    }
+
+    return node->m_routeId;
+}
+
+bool WebAPIRouteTrie::isIndex(const char *segment, int length)
+{
+    if ((length < 1) || (length > 2)) {
+        return false;
+    }
+
+    for (int i = 0; i < length; i++)
+    {
+        if ((segment[i] < '0') || (segment[i] > '9')) {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,65 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// Route table of the web API as a trie of path segments. Routes are compiled    //
+// once and a request path is matched in a single pass over its segments         //
+// without regular expressions nor allocations.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_WEBAPI_WEBAPIROUTETRIE_H_
+#define SDRBASE_WEBAPI_WEBAPIROUTETRIE_H_
+
+#include <QByteArray>
+#include <string>
+#include <vector>
+
+#include "export.h"
+
+class SDRBASE_API WebAPIRouteTrie
+{
+public:
+    static const int m_maxIndexes = 2;
+
+    WebAPIRouteTrie();
+    ~WebAPIRouteTrie();
+
+    /**
+     * Add a route. Pattern is an absolute path where a segment "{index}" matches
+     * a decimal index of 1 or 2 digits.
+     */
+    void add(const QByteArray& pattern, int routeId);
+    /**
+     * Match a path. Returns the route identifier or -1 if the path does not match any route.
+     * Indexes matched by "{index}" segments are copied in order to indexes.
+     */
+    int match(const QByteArray& path, std::string indexes[m_maxIndexes]) const;
+
+private:
+    struct Node
+    {
+        std::vector<std::pair<QByteArray, Node*> > m_children;
+        Node *m_indexChild;
+        int m_routeId;
+
+        Node() : m_indexChild(0), m_routeId(-1) {}
+        ~Node();
+    };
+
+    Node m_root;
+
+    static bool isIndex(const char *segment, int length);
+};
+
+#endif /* SDRBASE_WEBAPI_WEBAPIROUTETRIE_H_ */
@@ -40,7 +40,8 @@ void WebAPIServer::start()
     if (!m_listener)
     {
         m_listener = new qtwebapp::HttpListener(m_settings, m_requestMapper, qApp);
-        qInfo("WebAPIServer::start: starting web API server at http://%s:%d", qPrintable(m_settings.host), m_settings.port);
+        qInfo("WebAPIServer::start: starting web API server at http://%s:%d with %s", qPrintable(m_settings.host), m_settings.port,
+            m_settings.eventThreads > 0 ? qPrintable(QString("%1 event driven threads").arg(m_settings.eventThreads)) : "one thread per connection");
     }
 }
 
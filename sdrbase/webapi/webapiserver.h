@@ -39,6 +39,8 @@ public:
     void stop();
 
     void setHostAndPort(const QString& host, uint16_t port);
+    /** Serve connections from this number of event driven threads. 0 for one thread per connection. Takes effect on start. */
+    void setEventThreads(int eventThreads) { m_settings.eventThreads = eventThreads; }
     const QString& getHost() const { return m_settings.host; }
     int getPort() const { return m_settings.port; }
 
@@ -18,7 +18,34 @@
 
 #include <QDebug>
 #include <QElapsedTimer>
+#include <QCoreApplication>
+#include <QTcpSocket>
+#include <QUrl>
+#include <thread>
+#include <algorithm>
 
+#include "httplistener.h"
+#include "httprequesthandler.h"
+
+#include "dsp/samplesinkfifo.h"
+#include "dsp/chirpdemod.h"
+#include "dsp/udpsinkpipeline.h"
+#include "dsp/spectrumscanner.h"
+#include "dsp/activitymonitor.h"
+#include "dsp/devicesamplesource.h"
+#include "dsp/dspdevicesourceengine.h"
+#include "dsp/dspcommands.h"
+#include "dsp/interpolator.h"
+#include "rdsdemod.h"
+#include "rdsdecoder.h"
+#ifdef BENCH_GUI
+#include <QOffscreenSurface>
+#include <QOpenGLContext>
+#include <QOpenGLFunctions>
+#include <QOpenGLFramebufferObject>
+#include <QMatrix4x4>
+#include "gui/glshaderspectrogram.h"
+#endif
 #include "mainbench.h"
 
 MainBench *MainBench::m_instance = 0;
@@ -28,7 +55,8 @@ MainBench::MainBench(qtwebapp::LoggerWithFile *logger, const ParserBench& parser
     m_logger(logger),
     m_parser(parser),
     m_uniform_distribution_f(-1.0, 1.0),
-    m_uniform_distribution_s16(-2048, 2047)
+    m_uniform_distribution_s16(-2048, 2047),
+    m_uniform_distribution_u8(0, 255)
 {
     qDebug() << "MainBench::MainBench: start";
     m_instance = this;
@@ -59,6 +87,24 @@ void MainBench::run()
         testDecimateFI();
     } else if (m_parser.getTestType() == ParserBench::TestDecimatorsFF) {
         testDecimateFF();
+    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsU) {
+        testDecimateU();
+    } else if (m_parser.getTestType() == ParserBench::TestDecimatorsFifoII) {
+        testDecimateFifoII();
+    } else if (m_parser.getTestType() == ParserBench::TestLoRa) {
+        testLoRa();
+    } else if (m_parser.getTestType() == ParserBench::TestHttp) {
+        testHttp();
+    } else if (m_parser.getTestType() == ParserBench::TestSpectrum) {
+        testSpectrum();
+    } else if (m_parser.getTestType() == ParserBench::TestUDPSink) {
+        testUDPSink();
+    } else if (m_parser.getTestType() == ParserBench::TestScanner) {
+        testScanner();
+    } else if (m_parser.getTestType() == ParserBench::TestActivity) {
+        testActivity();
+    } else if (m_parser.getTestType() == ParserBench::TestRDS) {
+        testRDS();
     } else {
         qDebug() << "MainBench::run: unknown test type: " << m_parser.getTestType();
     }
@@ -190,32 +236,431 @@ void MainBench::testDecimateFF()
     delete[] buf;
 }
 
+void MainBench::testDecimateU()
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+
+    qDebug() << "MainBench::testDecimateU: create test data";
+
+    quint8 *buf = new quint8[m_parser.getNbSamples()*2];
+    m_convertBuffer.resize(m_parser.getNbSamples()/(1<<m_parser.getLog2Factor()));
+    auto my_rand = std::bind(m_uniform_distribution_u8, m_generator);
+    std::generate(buf, buf + m_parser.getNbSamples()*2 - 1, my_rand);
+
+    qDebug() << "MainBench::testDecimateU: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+        decimateU(buf, m_parser.getNbSamples()*2);
+        nsecs += timer.nsecsElapsed();
+    }
+
+    printResults("MainBench::testDecimateU", nsecs);
+
+    qDebug() << "MainBench::testDecimateU: cleanup test data";
+    delete[] buf;
+}
+
+/**
+ * Decimate device sized blocks straight into a sample FIFO like the device threads do.
+ * The FIFO is drained after each block so that it never overflows.
+ */
+void MainBench::testDecimateFifoII()
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+    const int blockSize = 16384; // I/Q pairs per device block
+    int nbBlocks = m_parser.getNbSamples() / blockSize;
+
+    qDebug() << "MainBench::testDecimateFifoII: create test data";
+
+    qint16 *buf = new qint16[m_parser.getNbSamples()*2];
+    m_convertBuffer.resize(blockSize);
+    SampleSinkFifo sampleFifo(4*blockSize);
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+    std::generate(buf, buf + m_parser.getNbSamples()*2 - 1, my_rand);
+
+    qDebug() << "MainBench::testDecimateFifoII: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        for (int j = 0; j < nbBlocks; j++)
+        {
+            timer.start();
+            SampleVector::iterator it;
+            unsigned int nbOut = (blockSize >> m_parser.getLog2Factor()) + 1;
+            bool inPlace = sampleFifo.writeBegin(nbOut, &it) == nbOut;
+            SampleVector::iterator begin = inPlace ? it : m_convertBuffer.begin();
+            it = begin;
+            decimateII(&it, &buf[2*j*blockSize], 2*blockSize);
+
+            if (inPlace) {
+                sampleFifo.writeCommit(it - begin);
+            } else {
+                sampleFifo.write(begin, it);
+            }
+
+            nsecs += timer.nsecsElapsed();
+            sampleFifo.readCommit(sampleFifo.fill());
+        }
+    }
+
+    printResults("MainBench::testDecimateFifoII", nsecs);
+
+    qDebug() << "MainBench::testDecimateFifoII: cleanup test data";
+    delete[] buf;
+}
+
+/**
+ * Demodulate synthetic LoRa frames in noise for each spread factor. The signal is at one sample
+ * per chip and about the requested number of samples long. Reports the symbol rate and errors.
+ */
+void MainBench::testLoRa()
+{
+    QElapsedTimer timer;
+    const unsigned int nbFrameSymbols = 64;
+    std::normal_distribution<float> noise(0.0f, 1.0f); // -3 dB SNR per sample
+
+    for (unsigned int spreadFactor = ChirpDemod::m_minSpreadFactor; spreadFactor <= ChirpDemod::m_maxSpreadFactor; spreadFactor++)
+    {
+        qDebug() << "MainBench::testLoRa: create test data for SF" << spreadFactor;
+
+        std::vector<Complex> samples;
+        std::vector<unsigned short> symbols;
+
+        do {
+            generateLoRaFrame(spreadFactor, nbFrameSymbols, samples, symbols);
+        } while (samples.size() < m_parser.getNbSamples());
+
+        for (std::vector<Complex>::iterator it = samples.begin(); it != samples.end(); ++it) {
+            *it += Complex(noise(m_generator), noise(m_generator));
+        }
+
+        qDebug() << "MainBench::testLoRa: run test for SF" << spreadFactor;
+
+        ChirpDemod chirpDemod(spreadFactor);
+        std::vector<ChirpDemod::Frame> frames;
+        const unsigned int blockSize = 4096; // typical channel sink block
+        unsigned int nbSymbols = 0, nbErrors = 0, nbFrames = 0;
+        qint64 nsecs = 0;
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            unsigned int k = 0;
+            chirpDemod.reset();
+
+            for (unsigned int j = 0; j < samples.size(); j += blockSize)
+            {
+                timer.start();
+                chirpDemod.process(&samples[j], std::min(blockSize, (unsigned int) samples.size() - j));
+                nsecs += timer.nsecsElapsed();
+                chirpDemod.takeFrames(frames);
+
+                for (std::vector<ChirpDemod::Frame>::const_iterator fit = frames.begin(); fit != frames.end(); ++fit, k += nbFrameSymbols)
+                {
+                    nbFrames++;
+
+                    for (unsigned int s = 0; s < nbFrameSymbols; s++)
+                    {
+                        nbSymbols++;
+                        nbErrors += (s >= fit->size()) || (k + s >= symbols.size()) || ((*fit)[s] != symbols[k + s]) ? 1 : 0;
+                    }
+                }
+            }
+        }
+
+        double symbolRate = (chirpDemod.getNbSymbols() / (double) nsecs) * 1e9;
+        QDebug info = qInfo();
+        info.noquote();
+        info << tr("MainBench::testLoRa: SF%1: ran test in %L2 ns - %3 S/s - %4 symbols/s - frames: %5/%6 symbols: %7 errors: %8")
+            .arg(spreadFactor)
+            .arg(nsecs)
+            .arg((samples.size()*m_parser.getRepetition() / (double) nsecs) * 1e9)
+            .arg(symbolRate)
+            .arg(nbFrames)
+            .arg((symbols.size() / nbFrameSymbols) * m_parser.getRepetition())
+            .arg(nbSymbols)
+            .arg(nbErrors);
+    }
+}
+
+/** Append a gap, 8 preamble up chirps, 2.25 down chirps (SFD) and random data symbols */
+void MainBench::generateLoRaFrame(unsigned int spreadFactor, unsigned int nbSymbols, std::vector<Complex>& samples, std::vector<unsigned short>& symbols)
+{
+    unsigned int nbSymbolSamples = 1 << spreadFactor;
+    std::uniform_int_distribution<unsigned int> symbolDistribution(0, nbSymbolSamples - 1);
+    std::vector<Complex> chirp;
+
+    samples.resize(samples.size() + 2*nbSymbolSamples + symbolDistribution(m_generator), Complex{0.0f, 0.0f});
+    ChirpDemod::modulate(spreadFactor, 0, false, chirp);
+
+    for (int i = 0; i < 8; i++) {
+        samples.insert(samples.end(), chirp.begin(), chirp.end());
+    }
+
+    ChirpDemod::modulate(spreadFactor, 0, true, chirp);
+    samples.insert(samples.end(), chirp.begin(), chirp.end());
+    samples.insert(samples.end(), chirp.begin(), chirp.end());
+    samples.insert(samples.end(), chirp.begin(), chirp.begin() + nbSymbolSamples/4);
+
+    for (unsigned int i = 0; i < nbSymbols; i++)
+    {
+        unsigned short symbol = symbolDistribution(m_generator);
+        symbols.push_back(symbol);
+        ChirpDemod::modulate(spreadFactor, symbol, false, chirp);
+        samples.insert(samples.end(), chirp.begin(), chirp.end());
+    }
+
+    samples.resize(samples.size() + 2*nbSymbolSamples, Complex{0.0f, 0.0f});
+}
+
+namespace {
+
+/** Minimal request handler so that the HTTP test measures the server core only */
+class BenchRequestHandler : public qtwebapp::HttpRequestHandler
+{
+public:
+    void service(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+    {
+        (void) request;
+        response.setHeader("Content-Type", "application/json");
+        response.write("{\"message\":\"OK\"}", true);
+    }
+};
+
+}
+
+/**
+ * HTTP load test. Concurrent persistent connections send nb-samples requests in total.
+ * Without URL compares thread per connection with event driven servers in process.
+ */
+void MainBench::testHttp()
+{
+    if (m_parser.getUrl().isEmpty())
+    {
+        BenchRequestHandler requestHandler;
+        int eventThreads[] = {0, 1, 2, 4};
+
+        for (unsigned int i = 0; i < sizeof(eventThreads)/sizeof(int); i++)
+        {
+            qtwebapp::HttpListenerSettings settings;
+            settings.host = "127.0.0.1";
+            settings.port = 0; // any free port
+            settings.maxThreads = m_parser.getConnections() + 1;
+            settings.eventThreads = eventThreads[i];
+            settings.maxConnections = m_parser.getConnections() + 1;
+            qtwebapp::HttpListener listener(settings, &requestHandler);
+            QString label = eventThreads[i] == 0 ?
+                QString("thread per connection") :
+                QString("%1 event threads").arg(eventThreads[i]);
+            runHttpLoad(label, settings.host, listener.serverPort(), "/sdrangel");
+        }
+    }
+    else
+    {
+        QUrl url(m_parser.getUrl());
+        QByteArray path = url.path(QUrl::FullyEncoded).toLatin1();
+        runHttpLoad(m_parser.getUrl(), url.host(), url.port(8091), path.isEmpty() ? QByteArray("/") : path);
+    }
+}
+
+void MainBench::runHttpLoad(const QString& label, const QString& host, quint16 port, const QByteArray& path)
+{
+    int nbConnections = m_parser.getConnections();
+    int nbRequests = m_parser.getNbSamples() / nbConnections; // per connection
+    std::vector<std::vector<qint64> > latencies(nbConnections);
+    std::vector<int> errors(nbConnections, 0);
+    std::vector<std::thread> clients;
+    QAtomicInt running(nbConnections);
+    QElapsedTimer timer;
+
+    qDebug() << "MainBench::runHttpLoad:" << label << "run test";
+    timer.start();
+
+    for (int i = 0; i < nbConnections; i++) {
+        clients.push_back(std::thread(&MainBench::httpClient, host, port, path, nbRequests, std::ref(latencies[i]), std::ref(errors[i]), std::ref(running)));
+    }
+
+    // in process listeners accept connections in this thread
+    while (running.load() > 0) {
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+    }
+
+    qint64 nsecs = timer.nsecsElapsed();
+    std::vector<qint64> allLatencies;
+    int nbErrors = 0;
+
+    for (int i = 0; i < nbConnections; i++)
+    {
+        clients[i].join();
+        allLatencies.insert(allLatencies.end(), latencies[i].begin(), latencies[i].end());
+        nbErrors += errors[i];
+    }
+
+    if (allLatencies.size() == 0)
+    {
+        qWarning() << "MainBench::runHttpLoad:" << label << "no response from" << host << port;
+        return;
+    }
+
+    std::sort(allLatencies.begin(), allLatencies.end());
+    qint64 p50 = allLatencies[allLatencies.size()/2];
+    qint64 p99 = allLatencies[(allLatencies.size()*99)/100];
+    QDebug info = qInfo();
+    info.noquote();
+    info << tr("MainBench::runHttpLoad: %1: %2 connections - %3 requests in %L4 ns - %5 req/s - latency p50: %6 us p99: %7 us max: %8 us - errors: %9")
+        .arg(label)
+        .arg(nbConnections)
+        .arg(allLatencies.size())
+        .arg(nsecs)
+        .arg((allLatencies.size() / (double) nsecs) * 1e9)
+        .arg(p50 / 1000.0)
+        .arg(p99 / 1000.0)
+        .arg(allLatencies.back() / 1000.0)
+        .arg(nbErrors);
+}
+
+/** One persistent connection sending requests one after the other. Runs in its own thread with blocking socket calls. */
+void MainBench::httpClient(const QString& host, quint16 port, const QByteArray& path, int nbRequests, std::vector<qint64>& latencies, int& errors, QAtomicInt& running)
+{
+    QTcpSocket socket;
+    QByteArray request = "GET " + path + " HTTP/1.1\r\nHost: " + host.toLatin1() + "\r\n\r\n";
+    QByteArray buffer;
+    QElapsedTimer timer;
+    latencies.reserve(nbRequests);
+    socket.connectToHost(host, port);
+
+    if (socket.waitForConnected(5000))
+    {
+        for (int i = 0; i < nbRequests; i++)
+        {
+            timer.start();
+            socket.write(request);
+            int status = readHttpResponse(socket, buffer, 5000);
+
+            if (status < 0) // connection lost
+            {
+                errors += nbRequests - i;
+                break;
+            }
+
+            latencies.push_back(timer.nsecsElapsed());
+            errors += status/100 == 2 ? 0 : 1;
+        }
+
+        socket.disconnectFromHost();
+    }
+    else
+    {
+        errors = nbRequests;
+    }
+
+    running.deref();
+}
+
+/** Read one response with a Content-Length header. Returns the HTTP status or -1 on error. */
+int MainBench::readHttpResponse(QTcpSocket& socket, QByteArray& buffer, int timeoutMs)
+{
+    int headerEnd;
+
+    while ((headerEnd = buffer.indexOf("\r\n\r\n")) < 0)
+    {
+        if (!socket.waitForReadyRead(timeoutMs)) {
+            return -1;
+        }
+
+        buffer.append(socket.readAll());
+    }
+
+    int contentLength = 0;
+    int pos = buffer.indexOf("Content-Length:");
+
+    if ((pos >= 0) && (pos < headerEnd))
+    {
+        int lineEnd = buffer.indexOf("\r\n", pos);
+        contentLength = buffer.mid(pos + 15, lineEnd - pos - 15).trimmed().toInt();
+    }
+
+    int responseSize = headerEnd + 4 + contentLength;
+
+    while (buffer.size() < responseSize)
+    {
+        if (!socket.waitForReadyRead(timeoutMs)) {
+            return -1;
+        }
+
+        buffer.append(socket.readAll());
+    }
+
+    int status = buffer.mid(9, 3).toInt(); // HTTP/1.1 200 OK
+    buffer.remove(0, responseSize);
+    return status;
+}
+
 void MainBench::decimateII(const qint16* buf, int len)
 {
     SampleVector::iterator it = m_convertBuffer.begin();
+    decimateII(&it, buf, len);
+}
 
+void MainBench::decimateII(SampleVector::iterator* it, const qint16* buf, int len)
+{
     switch (m_parser.getLog2Factor())
     {
     case 0:
-        m_decimatorsII.decimate1(&it, buf, len);
+        m_decimatorsII.decimate1(it, buf, len);
+        break;
+    case 1:
+        m_decimatorsII.decimate2_cen(it, buf, len);
+        break;
+    case 2:
+        m_decimatorsII.decimate4_cen(it, buf, len);
+        break;
+    case 3:
+        m_decimatorsII.decimate8_cen(it, buf, len);
+        break;
+    case 4:
+        m_decimatorsII.decimate16_cen(it, buf, len);
+        break;
+    case 5:
+        m_decimatorsII.decimate32_cen(it, buf, len);
+        break;
+    case 6:
+        m_decimatorsII.decimate64_cen(it, buf, len);
+        break;
+    default:
+        break;
+    }
+}
+
+void MainBench::decimateU(const quint8* buf, int len)
+{
+    SampleVector::iterator it = m_convertBuffer.begin();
+
+    switch (m_parser.getLog2Factor())
+    {
+    case 0:
+        m_decimatorsU.decimate1(&it, buf, len);
         break;
     case 1:
-        m_decimatorsII.decimate2_cen(&it, buf, len);
+        m_decimatorsU.decimate2_cen(&it, buf, len);
         break;
     case 2:
-        m_decimatorsII.decimate4_cen(&it, buf, len);
+        m_decimatorsU.decimate4_cen(&it, buf, len);
         break;
     case 3:
-        m_decimatorsII.decimate8_cen(&it, buf, len);
+        m_decimatorsU.decimate8_cen(&it, buf, len);
         break;
     case 4:
-        m_decimatorsII.decimate16_cen(&it, buf, len);
+        m_decimatorsU.decimate16_cen(&it, buf, len);
         break;
     case 5:
-        m_decimatorsII.decimate32_cen(&it, buf, len);
+        m_decimatorsU.decimate32_cen(&it, buf, len);
         break;
     case 6:
-        m_decimatorsII.decimate64_cen(&it, buf, len);
+        m_decimatorsU.decimate64_cen(&it, buf, len);
         break;
     default:
         break;
@@ -389,3 +834,647 @@ void MainBench::printResults(const QString& prefix, qint64 nsecs)
     info.noquote();
     info << tr("%1: ran test in %L2 ns - sample rate: %3 kS/s").arg(prefix).arg(nsecs).arg(ratekSs);
 }
+
+/** Renders the waterfall and histogram of a spectrum display in an offscreen framebuffer (one new line per frame) with the CPU and the GPU */
+void MainBench::testSpectrum()
+{
+#ifdef BENCH_GUI
+    QOffscreenSurface surface;
+    surface.create();
+    QOpenGLContext context;
+
+    if (!context.create() || !context.makeCurrent(&surface))
+    {
+        qWarning("MainBench::testSpectrum: cannot create an OpenGL context");
+        return;
+    }
+
+    QOpenGLFunctions *f = context.functions();
+    qInfo("MainBench::testSpectrum: OpenGL %d.%d%s renderer: %s",
+        context.format().majorVersion(),
+        context.format().minorVersion(),
+        context.isOpenGLES() ? " ES" : "",
+        (const char *) f->glGetString(GL_RENDERER));
+
+    const int width = 1024;
+    const int height = 768;
+    const int waterfallHeight = (height * 2) / 3;
+    int fftSize = m_parser.getNbSamples() < 64 ? 64 : m_parser.getNbSamples() > 32768 ? 32768 : m_parser.getNbSamples();
+    int nbFrames = 300 * m_parser.getRepetition();
+    QOpenGLFramebufferObject fbo(width, height);
+    fbo.bind();
+    f->glViewport(0, 0, width, height);
+    f->glEnable(GL_BLEND);
+    f->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    QMatrix4x4 waterfallMatrix; // top two thirds
+    waterfallMatrix.translate(-1.0f, -1.0f/3.0f);
+    waterfallMatrix.scale(2.0f, 4.0f/3.0f);
+    QMatrix4x4 histogramMatrix; // bottom third
+    histogramMatrix.translate(-1.0f, -1.0f);
+    histogramMatrix.scale(2.0f, 2.0f/3.0f);
+
+    std::vector<std::vector<Real> > lines(16, std::vector<Real>(fftSize));
+
+    for (unsigned int i = 0; i < lines.size(); i++) {
+        for (int j = 0; j < fftSize; j++) {
+            lines[i][j] = -70.0f + 30.0f * m_uniform_distribution_f(m_generator); // -100..-40 dB
+        }
+    }
+
+    std::vector<Real> maxHold(fftSize);
+
+    for (int gpu = 0; gpu < 2; gpu++)
+    {
+        GLShaderSpectrogram spectrogram;
+        spectrogram.setGPU(gpu == 1);
+        spectrogram.initializeGL();
+
+        if ((gpu == 1) && !spectrogram.isGPU())
+        {
+            qWarning("MainBench::testSpectrum: GPU rendering is not available with this OpenGL context");
+            spectrogram.cleanup();
+            break;
+        }
+
+        spectrogram.resize(fftSize, waterfallHeight);
+        QElapsedTimer timer;
+        qint64 lineNsecs = 0;
+        qint64 paintNsecs = 0;
+
+        for (int i = 0; i < nbFrames; i++)
+        {
+            timer.start();
+            spectrogram.newLine(lines[i % lines.size()], 0.0f, 100.0f, 1, 30, true);
+            lineNsecs += timer.nsecsElapsed();
+
+            timer.start();
+            f->glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+            f->glClear(GL_COLOR_BUFFER_BIT);
+            spectrogram.uploadLines();
+            spectrogram.drawWaterfall(waterfallMatrix, false, 0.0f, 100.0f);
+            spectrogram.drawHistogram(histogramMatrix);
+            spectrogram.getMaxHold(maxHold, 0.0f, 100.0f);
+            f->glFinish();
+            paintNsecs += timer.nsecsElapsed();
+        }
+
+        spectrogram.cleanup();
+        QDebug info = qInfo();
+        info.noquote();
+        info << tr("MainBench::testSpectrum: %1: FFT size %2: %3 frames in %L4 ns - %5 frames/s - new line: %6 us - paint: %7 us")
+            .arg(gpu == 1 ? "GPU" : "CPU")
+            .arg(fftSize)
+            .arg(nbFrames)
+            .arg(lineNsecs + paintNsecs)
+            .arg((nbFrames / (double) (lineNsecs + paintNsecs)) * 1e9)
+            .arg(lineNsecs / (nbFrames * 1000.0))
+            .arg(paintNsecs / (nbFrames * 1000.0));
+    }
+
+    fbo.release();
+    context.doneCurrent();
+#else
+    qWarning("MainBench::testSpectrum: the benchmarks were built without the GUI library");
+#endif
+}
+
+/** Runs the UDP sink channel processing of each output format on noisy 384 kS/s baseband blocks resampled to 48 kS/s */
+void MainBench::testUDPSink()
+{
+    static const char *formatNames[] = {
+        "I/Q 16", "I/Q 24", "NFM", "NFM mono", "LSB", "USB", "LSB mono", "USB mono", "AM mono", "AM no DC mono", "AM BPF mono"
+    };
+
+    const unsigned int blockSize = 4096; // typical channel sink block
+    SampleVector samples(m_parser.getNbSamples());
+
+    for (SampleVector::iterator it = samples.begin(); it != samples.end(); ++it) {
+        *it = Sample(m_uniform_distribution_s16(m_generator), m_uniform_distribution_s16(m_generator));
+    }
+
+    for (int format = 0; format < (int) UDPSinkPipeline::FormatNone; format++)
+    {
+        UDPSinkPipeline pipeline;
+        pipeline.setInput(384000, 10000);
+        pipeline.setFormat((UDPSinkPipeline::Format) format, 48000.0f, 12500.0f, 2500, 5);
+        pipeline.setSquelch(true, -60.0f);
+        pipeline.setAGC((format != UDPSinkPipeline::FormatIQ16) &&
+            (format != UDPSinkPipeline::FormatIQ24) &&
+            (format != UDPSinkPipeline::FormatNFM) &&
+            (format != UDPSinkPipeline::FormatNFMMono));
+        QElapsedTimer timer;
+        qint64 nsecs = 0;
+        qint64 nbOutputSamples = 0;
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            for (unsigned int j = 0; j < samples.size(); j += blockSize)
+            {
+                SampleVector::const_iterator begin = samples.begin() + j;
+                SampleVector::const_iterator end = samples.begin() + std::min(j + blockSize, (unsigned int) samples.size());
+                timer.start();
+                pipeline.process(begin, end);
+                nsecs += timer.nsecsElapsed();
+                nbOutputSamples += pipeline.getNbOutputSamples();
+            }
+        }
+
+        printResults(tr("MainBench::testUDPSink: %1 (%2 output samples)").arg(formatNames[format]).arg(nbOutputSamples), nsecs);
+    }
+}
+
+namespace {
+
+/** Source of the scanner test. Retunes are applied by the test after a latency like a real device */
+class BenchScanSource : public DeviceSampleSource
+{
+public:
+    BenchScanSource(int sampleRate, qint64 centerFrequency, bool tunable) :
+        m_description("BenchScanSource"),
+        m_sampleRate(sampleRate),
+        m_centerFrequency(centerFrequency),
+        m_pendingFrequency(centerFrequency),
+        m_tunable(tunable)
+    {}
+
+    virtual void destroy() {}
+    virtual void init() {}
+    virtual bool start() { return true; }
+    virtual void stop() {}
+    virtual QByteArray serialize() const { return QByteArray(); }
+    virtual bool deserialize(const QByteArray& data) { (void) data; return false; }
+    virtual const QString& getDeviceDescription() const { return m_description; }
+    virtual int getSampleRate() const { return m_sampleRate; }
+    virtual quint64 getCenterFrequency() const { return m_centerFrequency; }
+    virtual bool handleMessage(const Message& message) { (void) message; return false; }
+    virtual void setMessageQueueToGUI(MessageQueue *queue) { m_guiMessageQueue = queue; }
+
+    virtual void setCenterFrequency(qint64 centerFrequency)
+    {
+        if (m_tunable) {
+            m_pendingFrequency = centerFrequency;
+        }
+    }
+
+    bool isRetunePending() const { return m_pendingFrequency != m_centerFrequency; }
+    void applyRetune() { m_centerFrequency = m_pendingFrequency; }
+
+private:
+    QString m_description;
+    int m_sampleRate;
+    qint64 m_centerFrequency;
+    qint64 m_pendingFrequency;
+    bool m_tunable;
+};
+
+}
+
+/**
+ * Sweeps 100 MHz at 2.4 MS/s with a synthetic source carrying a few carriers in noise.
+ * The FFTs of each step are averaged 2^log2 times and each configuration runs repeat sweeps
+ * after a warm up sweep. Reports the sweep rate, the retune overhead and the carrier errors.
+ */
+void MainBench::testScanner()
+{
+    struct Carrier
+    {
+        qint64 m_frequency;
+        double m_level; //!< dB relative to full scale
+    };
+
+    static const Carrier carriers[] = {
+        {403250000LL, -30.0}, {427800000LL, -50.0}, {446006250LL, -40.0}, {468100000LL, -60.0}, {496500000LL, -20.0}
+    };
+    static const int nbCarriers = sizeof(carriers) / sizeof(carriers[0]);
+
+    const int sampleRate = 2400000;
+    const qint64 startFrequency = 400000000LL;
+    const qint64 endFrequency = 500000000LL;
+    const unsigned int blockSize = 16384;   // typical device block
+    const int retuneLatency = 2;            // blocks between the retune request and the new frequency
+    const unsigned int noiseSize = 1<<16;
+
+    std::vector<Complex> noise(noiseSize);
+    std::normal_distribution<float> normal(0.0f, 1e-4f); // about -80 dBFS per sample
+
+    for (unsigned int i = 0; i < noiseSize; i++) {
+        noise[i] = Complex(normal(m_generator), normal(m_generator));
+    }
+
+    std::vector<int> workerCounts;
+    workerCounts.push_back(1);
+
+    for (int nbWorkers = 2; nbWorkers <= std::max(QThread::idealThreadCount(), 2); nbWorkers *= 2) {
+        workerCounts.push_back(nbWorkers);
+    }
+
+    workerCounts.push_back(0); // source that cannot retune
+
+    SampleVector samples(blockSize);
+    std::vector<Complex> phases(nbCarriers);
+    std::vector<Complex> steps(nbCarriers);
+    std::vector<float> amplitudes(nbCarriers);
+
+    for (unsigned int config = 0; config < workerCounts.size(); config++)
+    {
+        bool tunable = config < workerCounts.size() - 1;
+        BenchScanSource source(sampleRate, startFrequency, tunable);
+        DSPDeviceSourceEngine engine(0); // the scanner retunes the source through it
+        engine.start();
+        engine.setSource(&source);
+        SpectrumScanner scanner;
+        scanner.setEngine(&engine);
+        SpectrumScanner::Settings settings;
+        settings.m_startFrequency = startFrequency;
+        settings.m_endFrequency = endFrequency;
+        settings.m_fftSize = 1024;
+        settings.m_nbAverages = 1<<m_parser.getLog2Factor();
+        settings.m_nbWorkers = tunable ? workerCounts[config] : 1;
+        settings.m_retuneTimeout = tunable ? 500 : 5;
+
+        qint64 carriersFrequency = -1;
+        unsigned int noiseIndex = 0;
+        int latency = 0;
+        qint64 feedNsecs = 0;
+        qint64 nbFedSamples = 0;
+        SpectrumScanner::Report total;
+        double maxFrequencyError = 0.0;
+        double maxLevelError = 0.0;
+        QElapsedTimer timer;
+
+        scanner.handleMessage(DSPSignalNotification(sampleRate, source.getCenterFrequency()));
+
+        for (uint32_t i = 0; i <= m_parser.getRepetition(); i++) // first sweep is the warm up
+        {
+            unsigned int sweepCount = scanner.getSweepCount();
+
+            if (!scanner.startScan(settings))
+            {
+                qWarning("MainBench::testScanner: cannot start scan");
+                return;
+            }
+
+            while (scanner.isScanning())
+            {
+                if (source.isRetunePending() && (++latency > retuneLatency))
+                {
+                    source.applyRetune();
+                    scanner.handleMessage(DSPSignalNotification(sampleRate, source.getCenterFrequency()));
+                    latency = 0;
+                }
+
+                if ((qint64) source.getCenterFrequency() != carriersFrequency)
+                {
+                    carriersFrequency = source.getCenterFrequency();
+
+                    for (int c = 0; c < nbCarriers; c++)
+                    {
+                        double shift = (double) (carriers[c].m_frequency - carriersFrequency) / sampleRate;
+                        double amplitude = std::abs(shift) < 0.5 ? std::pow(10.0, carriers[c].m_level / 20.0) : 0.0;
+                        amplitudes[c] = amplitude;
+                        phases[c] = Complex(amplitude, 0.0f);
+                        steps[c] = Complex(std::cos(2.0*M_PI*shift), std::sin(2.0*M_PI*shift));
+                    }
+                }
+
+                for (unsigned int j = 0; j < blockSize; j++)
+                {
+                    Complex s = noise[noiseIndex];
+                    noiseIndex = (noiseIndex + 1) & (noiseSize - 1);
+
+                    for (int c = 0; c < nbCarriers; c++)
+                    {
+                        s += phases[c];
+                        phases[c] *= steps[c];
+                    }
+
+                    samples[j].setReal((FixReal) (s.real() * SDR_RX_SCALEF));
+                    samples[j].setImag((FixReal) (s.imag() * SDR_RX_SCALEF));
+                }
+
+                for (int c = 0; c < nbCarriers; c++) // rotator amplitude drift
+                {
+                    if (amplitudes[c] != 0.0f) {
+                        phases[c] *= amplitudes[c] / std::abs(phases[c]);
+                    }
+                }
+
+                timer.start();
+                scanner.feed(samples.begin(), samples.end(), false);
+                feedNsecs += i == 0 ? 0 : timer.nsecsElapsed();
+                nbFedSamples += i == 0 ? 0 : blockSize;
+            }
+
+            if (!scanner.waitSweep(sweepCount, 10000))
+            {
+                qWarning("MainBench::testScanner: sweep timeout");
+                return;
+            }
+
+            if (source.isRetunePending()) // back to the initial frequency
+            {
+                source.applyRetune();
+                scanner.handleMessage(DSPSignalNotification(sampleRate, source.getCenterFrequency()));
+                latency = 0;
+            }
+
+            std::vector<Real> spectrum;
+            qint64 spectrumStartFrequency;
+            double binWidth;
+            SpectrumScanner::Report report;
+
+            if ((i == 0) || !scanner.getSpectrum(spectrum, spectrumStartFrequency, binWidth, report)) {
+                continue;
+            }
+
+            total.m_nbSteps += report.m_nbSteps;
+            total.m_sweepTime += report.m_sweepTime;
+            total.m_retuneTime += report.m_retuneTime * report.m_nbSteps;
+            total.m_fftTime += report.m_fftTime * report.m_nbSteps;
+            total.m_acquiredSamples += report.m_acquiredSamples;
+            total.m_discardedSamples += report.m_discardedSamples;
+            total.m_nbTimeouts += report.m_nbTimeouts;
+            total.m_maxPendingJobs = std::max(total.m_maxPendingJobs, report.m_maxPendingJobs);
+
+            if (!tunable) {
+                continue; // every step sees the same signal
+            }
+
+            for (int c = 0; c < nbCarriers; c++)
+            {
+                int bin = (int) ((carriers[c].m_frequency - spectrumStartFrequency) / binWidth);
+                int peakBin = -1;
+
+                for (int k = std::max(0, bin - 3); k < std::min((int) spectrum.size(), bin + 4); k++)
+                {
+                    if ((peakBin < 0) || (spectrum[k] > spectrum[peakBin])) {
+                        peakBin = k;
+                    }
+                }
+
+                if (peakBin < 0) {
+                    continue;
+                }
+
+                double peakFrequency = spectrumStartFrequency + (peakBin + 0.5) * binWidth;
+                maxFrequencyError = std::max(maxFrequencyError, std::abs(peakFrequency - (double) carriers[c].m_frequency));
+                maxLevelError = std::max(maxLevelError, (double) std::abs(spectrum[peakBin] - carriers[c].m_level));
+            }
+        }
+
+        if (total.m_nbSteps == 0) {
+            continue;
+        }
+
+        quint64 nbSamples = total.m_acquiredSamples + total.m_discardedSamples;
+        QString carriersStr = tunable ?
+            tr("carriers max error %1 Hz %2 dB").arg(maxFrequencyError, 0, 'f', 0).arg(maxLevelError, 0, 'f', 2) :
+            tr("no retune");
+
+        QDebug info = qInfo();
+        info.noquote();
+        info << tr("MainBench::testScanner: %1 workers: %2 steps/s retune %3 ms/step (%4% samples discarded, %5 timeouts) FFT %6 ms/step max %7 pending jobs feed %8 ns/sample %9")
+            .arg(settings.m_nbWorkers)
+            .arg(total.m_sweepTime == 0.0 ? 0.0 : (total.m_nbSteps * 1000.0) / total.m_sweepTime, 0, 'f', 1)
+            .arg(total.m_retuneTime / total.m_nbSteps, 0, 'f', 3)
+            .arg(nbSamples == 0 ? 0.0 : (total.m_discardedSamples * 100.0) / nbSamples, 0, 'f', 1)
+            .arg(total.m_nbTimeouts)
+            .arg(total.m_fftTime / total.m_nbSteps, 0, 'f', 3)
+            .arg(total.m_maxPendingJobs)
+            .arg(nbFedSamples == 0 ? 0.0 : (double) feedNsecs / nbFedSamples, 0, 'f', 1)
+            .arg(carriersStr);
+    }
+}
+
+/**
+ * Runs the channel activity monitor on a 2.4 MS/s baseband with carriers keyed on and off in noise
+ * for channel rasters from 200 kHz to 1 kHz. The processing cost should not depend on the number of channels.
+ */
+void MainBench::testActivity()
+{
+    static const int spacings[] = {200000, 25000, 12500, 6250, 1000};
+    const int sampleRate = 2400000;
+    const qint64 centerFrequency = 446000000LL;
+    const unsigned int blockSize = 16384; // typical device block
+    const int nbCarriers = 16;
+    SampleVector samples(m_parser.getNbSamples());
+    std::normal_distribution<float> noise(0.0f, 1e-4f * SDR_RX_SCALEF);
+    std::vector<Complex> phases(nbCarriers);
+    std::vector<Complex> steps(nbCarriers);
+
+    for (int c = 0; c < nbCarriers; c++) // on the 12.5 kHz raster, -60 dBFS
+    {
+        double shift = ((c - nbCarriers/2) * 75000.0) / sampleRate;
+        phases[c] = Complex(1e-3f * SDR_RX_SCALEF, 0.0f);
+        steps[c] = Complex(std::cos(2.0*M_PI*shift), std::sin(2.0*M_PI*shift));
+    }
+
+    for (unsigned int i = 0; i < samples.size(); i++)
+    {
+        Complex s(noise(m_generator), noise(m_generator));
+
+        for (int c = 0; c < nbCarriers; c++)
+        {
+            phases[c] *= steps[c];
+
+            if (((i / (sampleRate / 10)) + c) % 3 == 0) { // keyed for 100 ms every 300 ms
+                s += phases[c];
+            }
+        }
+
+        samples[i].setReal((FixReal) s.real());
+        samples[i].setImag((FixReal) s.imag());
+    }
+
+    for (unsigned int s = 0; s < sizeof(spacings) / sizeof(spacings[0]); s++)
+    {
+        ActivityMonitor monitor;
+        ActivityMonitor::Settings settings;
+        settings.m_channelSpacing = spacings[s];
+        settings.m_channelBandwidth = std::min(spacings[s], 10000);
+        monitor.handleMessage(DSPSignalNotification(sampleRate, centerFrequency));
+        monitor.startMonitor(settings);
+        QElapsedTimer timer;
+        qint64 nsecs = 0;
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            for (unsigned int j = 0; j < samples.size(); j += blockSize)
+            {
+                SampleVector::const_iterator begin = samples.begin() + j;
+                SampleVector::const_iterator end = samples.begin() + std::min(j + blockSize, (unsigned int) samples.size());
+                timer.start();
+                monitor.feed(begin, end, false);
+                nsecs += timer.nsecsElapsed();
+            }
+        }
+
+        ActivityMonitor::Report report;
+        std::vector<ActivityMonitor::Event> events;
+        monitor.getReport(report);
+        quint64 nbEvents = monitor.getEvents(0, events, 1);
+        printResults(tr("MainBench::testActivity: %1 Hz raster: %2 channels %3 events %4 us/detection")
+            .arg(spacings[s])
+            .arg(report.m_nbSlots)
+            .arg(nbEvents)
+            .arg(report.m_detectionTime, 0, 'f', 1), nsecs);
+    }
+}
+
+/**
+ * Decodes RDS groups from a MPX signal at the usual BFM channel rate with the RDS chain of the BFM demodulator:
+ * 57 kHz mix down, decimation to the RDS demodulator rate, biphase demodulation and group synchronization.
+ * The MPX signal has strong mono and stereo audio tones and the 19 kHz pilot besides RDS so that the test fails
+ * if the decimator lets them fold into the RDS band. Only the groups sent while the decoder synchronizes may be lost.
+ */
+void MainBench::testRDS()
+{
+    const int sampleRate = 250000;
+    const int rdsSampleRate = 31250;
+    const unsigned int nbGroups = 256; // about 22 s
+    const unsigned int blockSize = 4096; // typical channel sink block
+    std::uniform_int_distribution<unsigned int> wordDistribution(0, 0xffff);
+    std::vector<unsigned int> groups;
+    std::vector<Real> mpx;
+
+    qDebug() << "MainBench::testRDS: create test data";
+
+    for (unsigned int i = 0; i < nbGroups; i++)
+    {
+        groups.push_back(0xF201); // PI code
+        groups.push_back(wordDistribution(m_generator));
+        groups.push_back(wordDistribution(m_generator));
+        groups.push_back(wordDistribution(m_generator));
+    }
+
+    generateMPX(sampleRate, groups, mpx);
+
+    qDebug() << "MainBench::testRDS: run test";
+
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+    unsigned int nbDecoded = 0, nbErrors = 0;
+
+    for (uint32_t r = 0; r < m_parser.getRepetition(); r++)
+    {
+        Interpolator decimator;
+        Real distance = (Real) sampleRate / rdsSampleRate;
+        Real distanceRemain = distance;
+        RDSDemod rdsDemod;
+        RDSDecoder rdsDecoder;
+        std::vector<Real> rdsBuffer;
+        unsigned int expected = 0;
+        Complex cr;
+
+        RDSDemod::createDecimator(decimator, sampleRate, rdsSampleRate);
+        rdsDemod.setSampleRate(rdsSampleRate);
+
+        for (unsigned int j = 0; j < mpx.size(); j += blockSize)
+        {
+            unsigned int end = std::min(j + blockSize, (unsigned int) mpx.size());
+            timer.start();
+
+            for (unsigned int k = j; k < end; k++) // the subcarrier is coherent with the pilot as recovered by the pilot PLL
+            {
+                Real phase = (2.0 * M_PI * 57000.0 * (k % sampleRate)) / sampleRate;
+                rdsBuffer.push_back(mpx[k] * 2.0 * std::cos(phase));
+            }
+
+            for (std::vector<Real>::const_iterator it = rdsBuffer.begin(); it != rdsBuffer.end(); ++it)
+            {
+                if (decimator.decimate(&distanceRemain, Complex(*it, 0.0), &cr))
+                {
+                    bool bit;
+
+                    if (rdsDemod.process(cr.real(), bit) && rdsDecoder.frameSync(bit))
+                    {
+                        unsigned int *group = rdsDecoder.getGroup();
+                        unsigned int g = expected;
+
+                        for (; g < nbGroups; g++)
+                        {
+                            if ((group[0] == groups[4*g]) && (group[1] == groups[4*g+1]) && (group[2] == groups[4*g+2]) && (group[3] == groups[4*g+3])) {
+                                break;
+                            }
+                        }
+
+                        if (g < nbGroups) {
+                            nbDecoded++;
+                            expected = g + 1;
+                        } else {
+                            nbErrors++;
+                        }
+                    }
+
+                    distanceRemain += distance;
+                }
+            }
+
+            rdsBuffer.clear();
+            nsecs += timer.nsecsElapsed();
+        }
+    }
+
+    unsigned int nbSent = nbGroups * m_parser.getRepetition();
+    QDebug info = qInfo();
+    info.noquote();
+    info << tr("MainBench::testRDS: ran test in %L1 ns - %2 kS/s - groups: %3/%4 decoded %5 wrong")
+        .arg(nsecs)
+        .arg((mpx.size()*m_parser.getRepetition() / (double) nsecs) * 1e6)
+        .arg(nbDecoded)
+        .arg(nbSent)
+        .arg(nbErrors);
+
+    if ((nbErrors > 0) || (nbDecoded < (nbSent * 9) / 10)) {
+        qWarning("MainBench::testRDS: FAILED");
+    }
+}
+
+/** Modulate the RDS groups (4 information words each) on a MPX signal with mono and stereo audio tones, pilot and noise */
+void MainBench::generateMPX(int sampleRate, const std::vector<unsigned int>& groups, std::vector<Real>& mpx)
+{
+    static const unsigned int offsetWords[4] = {0x0FC, 0x198, 0x168, 0x1B4}; // A, B, C, D
+    static const unsigned int poly = 0x5B9; // x^10 + x^8 + x^7 + x^5 + x^4 + x^3 + 1
+    const double bitRate = 1187.5;
+    std::normal_distribution<float> noise(0.0f, 0.005f);
+    std::vector<bool> bits;
+    bool dbit = false;
+
+    for (unsigned int i = 0; i < groups.size(); i++)
+    {
+        unsigned int reg = groups[i] << 10;
+
+        for (int b = 25; b >= 10; b--)
+        {
+            if (reg & (1 << b)) {
+                reg ^= poly << (b - 10);
+            }
+        }
+
+        unsigned int block = (groups[i] << 10) | ((reg & 0x3FF) ^ offsetWords[i % 4]);
+
+        for (int b = 25; b >= 0; b--) // differential coding
+        {
+            dbit = dbit ^ (((block >> b) & 1) != 0);
+            bits.push_back(dbit);
+        }
+    }
+
+    unsigned int nbSamples = (unsigned int) ((bits.size() * sampleRate) / bitRate);
+    mpx.resize(nbSamples);
+
+    for (unsigned int i = 0; i < nbSamples; i++)
+    {
+        double t = (double) i / sampleRate;
+        double bitPhase = t * bitRate;
+        unsigned int bitIndex = (unsigned int) bitPhase;
+        Real symbol = (bits[bitIndex] ? 1.0 : -1.0) * ((bitPhase - bitIndex) < 0.5 ? 1.0 : -1.0); // biphase
+        Real pilotPhase = (2.0 * M_PI * 19000.0 * (i % sampleRate)) / sampleRate;
+        mpx[i] = 0.40 * std::sin(2.0 * M_PI * 1000.0 * t)                           // L+R
+            + 0.20 * std::sin(2.0 * M_PI * 12200.0 * t) * std::sin(2.0 * pilotPhase) // L-R with a sideband that folds into RDS when decimated unfiltered
+            + 0.09 * std::sin(pilotPhase)                                           // pilot
+            + 0.05 * symbol * std::cos(3.0 * pilotPhase)                            // RDS
+            + noise(m_generator);
+    }
+}
@@ -20,10 +20,12 @@
 #define SDRBENCH_MAINBENCH_H_
 
 #include <QObject>
+#include <QAtomicInt>
 #include <random>
 #include <functional>
 
 #include "dsp/decimators.h"
+#include "dsp/decimatorsu.h"
 #include "dsp/decimatorsif.h"
 #include "dsp/decimatorsfi.h"
 #include "dsp/decimatorsff.h"
@@ -33,6 +35,8 @@ namespace qtwebapp {
     class LoggerWithFile;
 }
 
+class QTcpSocket;
+
 class MainBench: public QObject {
     Q_OBJECT
 
@@ -51,13 +55,29 @@ private:
     void testDecimateIF();
     void testDecimateFI();
     void testDecimateFF();
+    void testDecimateU();
+    void testDecimateFifoII();
+    void testLoRa();
+    void testHttp();
+    void testSpectrum();
+    void testUDPSink();
+    void testScanner();
+    void testActivity();
+    void testRDS();
     void decimateII(const qint16 *buf, int len);
+    void decimateII(SampleVector::iterator* it, const qint16 *buf, int len);
     void decimateInfII(const qint16 *buf, int len);
     void decimateSupII(const qint16 *buf, int len);
     void decimateIF(const qint16 *buf, int len);
     void decimateFI(const float *buf, int len);
     void decimateFF(const float *buf, int len);
+    void decimateU(const quint8 *buf, int len);
     void printResults(const QString& prefix, qint64 nsecs);
+    void runHttpLoad(const QString& label, const QString& host, quint16 port, const QByteArray& path);
+    static void httpClient(const QString& host, quint16 port, const QByteArray& path, int nbRequests, std::vector<qint64>& latencies, int& errors, QAtomicInt& running);
+    static int readHttpResponse(QTcpSocket& socket, QByteArray& buffer, int timeoutMs);
+    void generateLoRaFrame(unsigned int spreadFactor, unsigned int nbSymbols, std::vector<Complex>& samples, std::vector<unsigned short>& symbols);
+    void generateMPX(int sampleRate, const std::vector<unsigned int>& groups, std::vector<Real>& mpx);
 
     static MainBench *m_instance;
     qtwebapp::LoggerWithFile *m_logger;
@@ -65,11 +85,13 @@ private:
     std::mt19937 m_generator;
     std::uniform_real_distribution<float> m_uniform_distribution_f;
     std::uniform_int_distribution<qint16> m_uniform_distribution_s16;
+    std::uniform_int_distribution<int> m_uniform_distribution_u8;
 
 	Decimators<qint32, qint16, SDR_RX_SAMP_SZ, 12> m_decimatorsII;
 	DecimatorsIF<qint16, 12> m_decimatorsIF;
 	DecimatorsFI m_decimatorsFI;
     DecimatorsFF m_decimatorsFF;
+	DecimatorsU<qint32, quint8, SDR_RX_SAMP_SZ, 8, 127> m_decimatorsU;
 
     SampleVector m_convertBuffer;
     FSampleVector m_convertBufferF;
@@ -17,6 +17,7 @@
 
 #include <QCommandLineOption>
 #include <QRegExpValidator>
+#include <QUrl>
 #include <QDebug>
 
 #include "parserbench.h"
@@ -37,12 +38,21 @@ ParserBench::ParserBench() :
     m_log2FactorOption(QStringList() << "l" << "log2-factor",
         "Log2 factor for rate conversion.",
         "log2",
-        "2")
+        "2"),
+    m_connectionsOption(QStringList() << "c" << "connections",
+        "Number of concurrent connections for HTTP tests.",
+        "connections",
+        "16"),
+    m_urlOption(QStringList() << "u" << "url",
+        "URL requested by HTTP tests e.g. http://127.0.0.1:8091/sdrangel. Default tests in process servers.",
+        "url",
+        "")
 {
     m_testStr = "decimateii";
     m_nbSamples = 1048576;
     m_repetition = 1;
     m_log2Factor = 4;
+    m_connections = 16;
 
     m_parser.setApplicationDescription("Software Defined Radio application benchmarks");
     m_parser.addHelpOption();
@@ -52,6 +62,8 @@ ParserBench::ParserBench() :
     m_parser.addOption(m_nbSamplesOption);
     m_parser.addOption(m_repetitionOption);
     m_parser.addOption(m_log2FactorOption);
+    m_parser.addOption(m_connectionsOption);
+    m_parser.addOption(m_urlOption);
 }
 
 ParserBench::~ParserBench()
@@ -110,6 +122,27 @@ void ParserBench::parse(const QCoreApplication& app)
     } else {
         qWarning() << "ParserBench::parse: repetilog2 factortion invalid. Defaulting to " << m_log2Factor;
     }
+
+    // connections
+
+    QString connectionsStr = m_parser.value(m_connectionsOption);
+    int connections = connectionsStr.toInt(&ok);
+
+    if (ok && (connections > 0) && (connections <= 1000)) {
+        m_connections = connections;
+    } else {
+        qWarning() << "ParserBench::parse: connections invalid. Defaulting to " << m_connections;
+    }
+
+    // URL
+
+    QString url = m_parser.value(m_urlOption);
+
+    if (url.isEmpty() || QUrl(url, QUrl::StrictMode).isValid()) {
+        m_url = url;
+    } else {
+        qWarning() << "ParserBench::parse: URL invalid. Defaulting to in process servers";
+    }
 }
 
 ParserBench::TestType ParserBench::getTestType() const
@@ -124,6 +157,24 @@ ParserBench::TestType ParserBench::getTestType() const
         return TestDecimatorsInfII;
     } else if (m_testStr == "decimatesupii") {
         return TestDecimatorsSupII;
+    } else if (m_testStr == "decimateu") {
+        return TestDecimatorsU;
+    } else if (m_testStr == "decimatefifoii") {
+        return TestDecimatorsFifoII;
+    } else if (m_testStr == "lora") {
+        return TestLoRa;
+    } else if (m_testStr == "http") {
+        return TestHttp;
+    } else if (m_testStr == "spectrum") {
+        return TestSpectrum;
+    } else if (m_testStr == "udpsink") {
+        return TestUDPSink;
+    } else if (m_testStr == "scan") {
+        return TestScanner;
+    } else if (m_testStr == "activity") {
+        return TestActivity;
+    } else if (m_testStr == "rds") {
+        return TestRDS;
     } else {
         return TestDecimatorsII;
     }
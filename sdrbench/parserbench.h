@@ -31,7 +31,16 @@ public:
         TestDecimatorsFI,
         TestDecimatorsFF,
         TestDecimatorsInfII,
-        TestDecimatorsSupII
+        TestDecimatorsSupII,
+        TestDecimatorsU,
+        TestDecimatorsFifoII,
+        TestLoRa,
+        TestHttp,
+        TestSpectrum,
+        TestUDPSink,
+        TestScanner,
+        TestActivity,
+        TestRDS
     } TestType;
 
     ParserBench();
@@ -44,18 +53,24 @@ public:
     uint32_t getNbSamples() const { return m_nbSamples; }
     uint32_t getRepetition() const { return m_repetition; }
     uint32_t getLog2Factor() const { return m_log2Factor; }
+    uint32_t getConnections() const { return m_connections; }
+    const QString& getUrl() const { return m_url; } //!< empty for in process servers
 
 private:
     QString  m_testStr;
     uint32_t m_nbSamples;
     uint32_t m_repetition;
     uint32_t m_log2Factor;
+    uint32_t m_connections;
+    QString  m_url;
 
     QCommandLineParser m_parser;
     QCommandLineOption m_testOption;
     QCommandLineOption m_nbSamplesOption;
     QCommandLineOption m_repetitionOption;
     QCommandLineOption m_log2FactorOption;
+    QCommandLineOption m_connectionsOption;
+    QCommandLineOption m_urlOption;
 };
 
 
@@ -15,9 +15,12 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <QFont>
+#include <QVector>
 
 #include "gui/glspectrum.h"
 #include "dsp/spectrumvis.h"
+#include "dsp/spectrumscanner.h"
+#include "dsp/activitymonitor.h"
 #include "gui/glspectrumgui.h"
 #include "gui/channelwindow.h"
 #include "gui/samplingdevicecontrol.h"
@@ -37,6 +40,8 @@ DeviceUISet::DeviceUISet(int tabIndex, bool rxElseTx, QTimer& timer)
     m_spectrum = new GLSpectrum;
     if (rxElseTx) {
         m_spectrumVis = new SpectrumVis(SDR_RX_SCALEF, m_spectrum);
+        m_spectrumScanner = QSharedPointer<SpectrumScanner>(new SpectrumScanner());
+        m_activityMonitor = QSharedPointer<ActivityMonitor>(new ActivityMonitor());
     } else {
         m_spectrumVis = new SpectrumVis(SDR_TX_SCALEF, m_spectrum);
     }
@@ -174,22 +179,72 @@ void DeviceUISet::loadRxChannelSettings(const Preset *preset, PluginAPI *pluginA
         ChannelInstanceRegistrations openChannels = m_rxChannelInstanceRegistrations;
         m_rxChannelInstanceRegistrations.clear();
 
-        for(int i = 0; i < openChannels.count(); i++)
+        qDebug("DeviceUISet::loadRxChannelSettings: %d channel(s) in preset", preset->getChannelCount());
+
+        // match preset channels with open channels: identical configurations first then same channel type
+        QList<QByteArray> openConfigs;
+        QVector<int> openIndexes(preset->getChannelCount(), -1);
+        QVector<bool> openUsed(openChannels.count(), false);
+        int nbKept = 0, nbReconfigured = 0, nbCreated = 0;
+
+        for (int j = 0; j < openChannels.count(); j++) {
+            openConfigs.append(openChannels[j].m_gui->serialize());
+        }
+
+        for (int pass = 0; pass < 2; pass++)
         {
-            qDebug("DeviceUISet::loadRxChannelSettings: destroying old channel [%s]", qPrintable(openChannels[i].m_channelName));
-            openChannels[i].m_gui->destroy(); // FIXME: stop channel before
+            for (int i = 0; i < preset->getChannelCount(); i++)
+            {
+                const Preset::ChannelConfig& channelConfig = preset->getChannelConfig(i);
+
+                for (int j = 0; (openIndexes[i] < 0) && (j < openChannels.count()); j++)
+                {
+                    if (!openUsed[j]
+                     && compareRxChannelURIs(openChannels[j].m_channelName, channelConfig.m_channelIdURI)
+                     && ((pass == 1) || (openConfigs[j] == channelConfig.m_config)))
+                    {
+                        openIndexes[i] = j;
+                        openUsed[j] = true;
+                    }
+                }
+            }
         }
 
-        qDebug("DeviceUISet::loadRxChannelSettings: %d channel(s) in preset", preset->getChannelCount());
+        // destroy channels that are not reused before creating the new ones
+        for (int j = 0; j < openChannels.count(); j++)
+        {
+            if (!openUsed[j])
+            {
+                qDebug("DeviceUISet::loadRxChannelSettings: destroying old channel [%s]", qPrintable(openChannels[j].m_channelName));
+                openChannels[j].m_gui->destroy(); // FIXME: stop channel before
+            }
+        }
 
         for (int i = 0; i < preset->getChannelCount(); i++)
         {
             const Preset::ChannelConfig& channelConfig = preset->getChannelConfig(i);
             ChannelInstanceRegistration reg;
 
-            // create channel instance
+            // reuse the matched open channel if any. The channel GUI registers itself when created.
+
+            if (openIndexes[i] >= 0)
+            {
+                reg = openChannels[openIndexes[i]];
+                m_rxChannelInstanceRegistrations.append(reg);
+
+                if (openConfigs[openIndexes[i]] == channelConfig.m_config)
+                {
+                    qDebug("DeviceUISet::loadRxChannelSettings: channel [%s] unchanged", qPrintable(reg.m_channelName));
+                    nbKept++;
+                    continue;
+                }
+
+                nbReconfigured++;
+            }
+
+            // otherwise create channel instance
 
-            for(int i = 0; i < channelRegistrations->count(); i++)
+            for(int i = 0; (reg.m_gui == 0) && (i < channelRegistrations->count()); i++)
             {
                 //if((*channelRegistrations)[i].m_channelIdURI == channelConfig.m_channelIdURI)
                 if (compareRxChannelURIs((*channelRegistrations)[i].m_channelIdURI, channelConfig.m_channelIdURI))
@@ -202,6 +257,7 @@ void DeviceUISet::loadRxChannelSettings(const Preset *preset, PluginAPI *pluginA
                     PluginInstanceGUI *rxChannelGUI =
                             (*channelRegistrations)[i].m_plugin->createRxChannelGUI(this, rxChannel);
                     reg = ChannelInstanceRegistration(channelConfig.m_channelIdURI, rxChannelGUI);
+                    nbCreated++;
                     break;
                 }
             }
@@ -213,6 +269,8 @@ void DeviceUISet::loadRxChannelSettings(const Preset *preset, PluginAPI *pluginA
             }
         }
 
+        qDebug("DeviceUISet::loadRxChannelSettings: %d kept %d reconfigured %d created %d destroyed",
+                nbKept, nbReconfigured, nbCreated, openUsed.count(false));
         renameRxChannelInstances();
     }
     else
@@ -256,22 +314,72 @@ void DeviceUISet::loadTxChannelSettings(const Preset *preset, PluginAPI *pluginA
         ChannelInstanceRegistrations openChannels = m_txChannelInstanceRegistrations;
         m_txChannelInstanceRegistrations.clear();
 
-        for(int i = 0; i < openChannels.count(); i++)
+        qDebug("DeviceUISet::loadTxChannelSettings: %d channel(s) in preset", preset->getChannelCount());
+
+        // match preset channels with open channels: identical configurations first then same channel type
+        QList<QByteArray> openConfigs;
+        QVector<int> openIndexes(preset->getChannelCount(), -1);
+        QVector<bool> openUsed(openChannels.count(), false);
+        int nbKept = 0, nbReconfigured = 0, nbCreated = 0;
+
+        for (int j = 0; j < openChannels.count(); j++) {
+            openConfigs.append(openChannels[j].m_gui->serialize());
+        }
+
+        for (int pass = 0; pass < 2; pass++)
         {
-            qDebug("DeviceUISet::loadTxChannelSettings: destroying old channel [%s]", qPrintable(openChannels[i].m_channelName));
-            openChannels[i].m_gui->destroy();
+            for (int i = 0; i < preset->getChannelCount(); i++)
+            {
+                const Preset::ChannelConfig& channelConfig = preset->getChannelConfig(i);
+
+                for (int j = 0; (openIndexes[i] < 0) && (j < openChannels.count()); j++)
+                {
+                    if (!openUsed[j]
+                     && (openChannels[j].m_channelName == channelConfig.m_channelIdURI)
+                     && ((pass == 1) || (openConfigs[j] == channelConfig.m_config)))
+                    {
+                        openIndexes[i] = j;
+                        openUsed[j] = true;
+                    }
+                }
+            }
         }
 
-        qDebug("DeviceUISet::loadTxChannelSettings: %d channel(s) in preset", preset->getChannelCount());
+        // destroy channels that are not reused before creating the new ones
+        for (int j = 0; j < openChannels.count(); j++)
+        {
+            if (!openUsed[j])
+            {
+                qDebug("DeviceUISet::loadTxChannelSettings: destroying old channel [%s]", qPrintable(openChannels[j].m_channelName));
+                openChannels[j].m_gui->destroy();
+            }
+        }
 
         for(int i = 0; i < preset->getChannelCount(); i++)
         {
             const Preset::ChannelConfig& channelConfig = preset->getChannelConfig(i);
             ChannelInstanceRegistration reg;
 
-            // create channel instance
+            // reuse the matched open channel if any. The channel GUI registers itself when created.
+
+            if (openIndexes[i] >= 0)
+            {
+                reg = openChannels[openIndexes[i]];
+                m_txChannelInstanceRegistrations.append(reg);
+
+                if (openConfigs[openIndexes[i]] == channelConfig.m_config)
+                {
+                    qDebug("DeviceUISet::loadTxChannelSettings: channel [%s] unchanged", qPrintable(reg.m_channelName));
+                    nbKept++;
+                    continue;
+                }
+
+                nbReconfigured++;
+            }
+
+            // otherwise create channel instance
 
-            for(int i = 0; i < channelRegistrations->count(); i++)
+            for(int i = 0; (reg.m_gui == 0) && (i < channelRegistrations->count()); i++)
             {
                 if ((*channelRegistrations)[i].m_channelIdURI == channelConfig.m_channelIdURI)
                 {
@@ -283,6 +391,7 @@ void DeviceUISet::loadTxChannelSettings(const Preset *preset, PluginAPI *pluginA
                     PluginInstanceGUI *txChannelGUI =
                             (*channelRegistrations)[i].m_plugin->createTxChannelGUI(this, txChannel);
                     reg = ChannelInstanceRegistration(channelConfig.m_channelIdURI, txChannelGUI);
+                    nbCreated++;
                     break;
                 }
             }
@@ -294,6 +403,8 @@ void DeviceUISet::loadTxChannelSettings(const Preset *preset, PluginAPI *pluginA
             }
         }
 
+        qDebug("DeviceUISet::loadTxChannelSettings: %d kept %d reconfigured %d created %d destroyed",
+                nbKept, nbReconfigured, nbCreated, openUsed.count(false));
         renameTxChannelInstances();
     }
 }
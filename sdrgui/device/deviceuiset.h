@@ -19,10 +19,13 @@
 
 #include <QTimer>
 #include <QByteArray>
+#include <QSharedPointer>
 
 #include "export.h"
 
 class SpectrumVis;
+class SpectrumScanner;
+class ActivityMonitor;
 class GLSpectrum;
 class GLSpectrumGUI;
 class ChannelWindow;
@@ -38,6 +41,8 @@ class SDRGUI_API DeviceUISet
 {
 public:
     SpectrumVis *m_spectrumVis;
+    QSharedPointer<SpectrumScanner> m_spectrumScanner; //!< sink of the source engine (Rx only). Shared with the web API requests in progress
+    QSharedPointer<ActivityMonitor> m_activityMonitor; //!< sink of the source engine (Rx only). Shared with the web API requests in progress
     GLSpectrum *m_spectrum;
     GLSpectrumGUI *m_spectrumGUI;
     ChannelWindow *m_channelWindow;
@@ -18,6 +18,10 @@
 #include <QDebug>
 #include <QMutexLocker>
 
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+#include <emmintrin.h>
+#endif
+
 #include "scopevis.h"
 #include "dsp/dspcommands.h"
 #include "gui/glscope.h"
@@ -37,6 +41,7 @@ MESSAGE_CLASS_DEFINITION(ScopeVis::MsgScopeVisNGOneShot, Message)
 MESSAGE_CLASS_DEFINITION(ScopeVis::MsgScopeVisNGMemoryTrace, Message)
 
 const uint ScopeVis::m_traceChunkSize = 4800;
+const uint ScopeVis::m_projectionBlockSize = 1024;
 
 
 ScopeVis::ScopeVis(GLScope* glScope) :
@@ -66,9 +71,6 @@ ScopeVis::ScopeVis(GLScope* glScope) :
     setObjectName("ScopeVis");
     m_traceDiscreteMemory.resize(m_traceChunkSize); // arbitrary
     m_glScope->setTraces(&m_traces.m_tracesData, &m_traces.m_traces[0]);
-    for (int i = 0; i < (int) Projector::nbProjectionTypes; i++) {
-        m_projectorCache[i] = 0.0;
-    }
 }
 
 ScopeVis::~ScopeVis()
@@ -322,6 +324,8 @@ void ScopeVis::processTrace(const SampleVector::const_iterator& cbegin, const Sa
     else if ((m_triggerState == TriggerUntriggered) || (m_triggerState == TriggerDelay)) // look for trigger or past trigger in delay mode
     {
         TriggerCondition* triggerCondition = m_triggerConditions[m_currentTriggerIndex]; // current trigger condition
+        SampleVector::const_iterator projectedBegin = begin; // first sample of the projected block
+        int nbProjected = 0;
 
         while (begin < end)
         {
@@ -354,30 +358,49 @@ void ScopeVis::processTrace(const SampleVector::const_iterator& cbegin, const Sa
                 }
             }
 
-            if (m_triggerComparator.triggered(*begin, *triggerCondition)) // matched the current trigger
+            Projector::ProjectionType projectionType = triggerCondition->m_projector.getProjectionType();
+
+            if ((begin < projectedBegin) || (begin >= projectedBegin + nbProjected)) // project the next block of samples
             {
-                if (triggerCondition->m_triggerData.m_triggerDelay > 0)
-                {
-                    triggerCondition->m_triggerDelayCount = triggerCondition->m_triggerData.m_triggerDelay; // initialize delayed samples counter
-                    m_triggerState = TriggerDelay;
-                    ++begin;
-                    continue;
-                }
+                projectedBegin = begin;
+                nbProjected = std::min((int) (end - begin), (int) m_projectionBlockSize);
+                m_triggerProjector.clearProjections();
+                m_triggerProjector.addProjection(projectionType);
+                m_triggerProjector.run(&(*begin), nbProjected);
+            }
 
-                if (nextTrigger()) // move to next trigger and keep going
-                {
-                    m_triggerComparator.reset();
-                    m_triggerState = TriggerUntriggered;
-                }
-                else // this was the last trigger then start trace
-                {
-                    m_traceStart = true; // start of trace processing
-                    m_nbSamples = m_traceSize + m_maxTraceDelay;
-                    m_triggerComparator.reset();
-                    m_triggerState = TriggerTriggered;
-                    triggerPointToEnd = end - begin;
-                    break;
-                }
+            int offset = begin - projectedBegin;
+            int index = m_triggerComparator.search(m_triggerProjector.getProjection(projectionType) + offset, nbProjected - offset, *triggerCondition);
+
+            if (index < 0) // no trigger in the rest of the block
+            {
+                begin += nbProjected - offset;
+                continue;
+            }
+
+            begin += index; // matched the current trigger
+
+            if (triggerCondition->m_triggerData.m_triggerDelay > 0)
+            {
+                triggerCondition->m_triggerDelayCount = triggerCondition->m_triggerData.m_triggerDelay; // initialize delayed samples counter
+                m_triggerState = TriggerDelay;
+                ++begin;
+                continue;
+            }
+
+            if (nextTrigger()) // move to next trigger and keep going
+            {
+                m_triggerComparator.reset();
+                m_triggerState = TriggerUntriggered;
+            }
+            else // this was the last trigger then start trace
+            {
+                m_traceStart = true; // start of trace processing
+                m_nbSamples = m_traceSize + m_maxTraceDelay;
+                m_triggerComparator.reset();
+                m_triggerState = TriggerTriggered;
+                triggerPointToEnd = end - begin;
+                break;
             }
 
             ++begin;
@@ -491,121 +514,42 @@ int ScopeVis::processTraces(const SampleVector::const_iterator& cbegin, const Sa
     uint32_t shift = (m_timeOfsProMill / 1000.0) * m_traceSize;
     uint32_t length = m_traceSize / m_timeBase;
 
+    m_traceProjector.clearProjections();
+
+    for (std::vector<TraceData>::const_iterator itData = m_traces.m_tracesData.begin(); itData != m_traces.m_tracesData.end(); ++itData) {
+        m_traceProjector.addProjection(itData->m_projectionType);
+    }
+
     while ((begin < end) && (m_nbSamples > 0))
     {
+        int nbSamples = std::min((int) (end - begin), m_nbSamples);
+        nbSamples = std::min(nbSamples, (int) m_projectionBlockSize);
+        m_traceProjector.run(&(*begin), nbSamples);
+
         std::vector<TraceControl*>::iterator itCtl = m_traces.m_tracesControl.begin();
         std::vector<TraceData>::iterator itData = m_traces.m_tracesData.begin();
         std::vector<float *>::iterator itTrace = m_traces.m_traces[m_traces.currentBufferIndex()].begin();
 
         for (; itCtl != m_traces.m_tracesControl.end(); ++itCtl, ++itData, ++itTrace)
         {
-            if (traceBack && ((end - begin) > itData->m_traceDelay)) { // before start of trace
-                continue;
+            int start = 0;
+
+            if (traceBack) { // skip samples before start of trace
+                start = std::max(0, (int) (end - begin) - itData->m_traceDelay);
             }
 
-            Projector::ProjectionType projectionType = itData->m_projectionType;
+            uint32_t traceCount = (*itCtl)->m_traceCount[m_traces.currentBufferIndex()];
+            int count = std::min(nbSamples - start, (int) (m_traceSize - traceCount));
 
-            if ((*itCtl)->m_traceCount[m_traces.currentBufferIndex()] < m_traceSize)
+            if ((traceCount < m_traceSize) && (count > 0))
             {
-                uint32_t& traceCount = (*itCtl)->m_traceCount[m_traces.currentBufferIndex()]; // reference for code clarity
-                float v;
-
-                if (projectionType == Projector::ProjectionMagLin)
-                {
-                    v = ((*itCtl)->m_projector.run(*begin) - itData->m_ofs)*itData->m_amp - 1.0f;
-                }
-                else if (projectionType == Projector::ProjectionMagSq)
-                {
-                    Real magsq = (*itCtl)->m_projector.run(*begin);
-                    v = (magsq - itData->m_ofs)*itData->m_amp - 1.0f;
-
-                    if ((traceCount >= shift) && (traceCount < shift+length)) // power display overlay values construction
-                    {
-                        if (traceCount == shift)
-                        {
-                            (*itCtl)->m_maxPow = 0.0f;
-                            (*itCtl)->m_sumPow = 0.0f;
-                            (*itCtl)->m_nbPow = 1;
-                        }
-
-                        if (magsq > 0.0f)
-                        {
-                            if (magsq > (*itCtl)->m_maxPow)
-                            {
-                                (*itCtl)->m_maxPow = magsq;
-                            }
-
-                            (*itCtl)->m_sumPow += magsq;
-                            (*itCtl)->m_nbPow++;
-                        }
-                    }
-
-                    if ((m_nbSamples == 1) && ((*itCtl)->m_nbPow > 0)) // on last sample create power display overlay
-                    {
-                        double avgPow = (*itCtl)->m_sumPow / (*itCtl)->m_nbPow;
-                        itData->m_textOverlay = QString("%1  %2").arg((*itCtl)->m_maxPow, 0, 'e', 2).arg(avgPow, 0, 'e', 2);
-                        (*itCtl)->m_nbPow = 0;
-                    }
-                }
-                else if (projectionType == Projector::ProjectionMagDB)
-                {
-                    Real re = begin->m_real / SDR_RX_SCALEF;
-                    Real im = begin->m_imag / SDR_RX_SCALEF;
-                    double magsq = re*re + im*im;
-                    float pdB = log10f(magsq) * 10.0f;
-                    float p = pdB - (100.0f * itData->m_ofs);
-                    v = ((p/50.0f) + 2.0f)*itData->m_amp - 1.0f;
-
-                    if ((traceCount >= shift) && (traceCount < shift+length)) // power display overlay values construction
-                    {
-                        if (traceCount == shift)
-                        {
-                            (*itCtl)->m_maxPow = 0.0f;
-                            (*itCtl)->m_sumPow = 0.0f;
-                            (*itCtl)->m_nbPow = 1;
-                        }
-
-                        if (magsq > 0.0f)
-                        {
-                            if (magsq > (*itCtl)->m_maxPow)
-                            {
-                                (*itCtl)->m_maxPow = magsq;
-                            }
-
-                            (*itCtl)->m_sumPow += magsq;
-                            (*itCtl)->m_nbPow++;
-                        }
-                    }
-
-                    if ((m_nbSamples == 1) && ((*itCtl)->m_nbPow > 0)) // on last sample create power display overlay
-                    {
-                        double avgPow = log10f((*itCtl)->m_sumPow / (*itCtl)->m_nbPow)*10.0;
-                        double peakPow = log10f((*itCtl)->m_maxPow)*10.0;
-                        double peakToAvgPow = peakPow - avgPow;
-                        itData->m_textOverlay = QString("%1  %2  %3").arg(peakPow, 0, 'f', 1).arg(avgPow, 0, 'f', 1).arg(peakToAvgPow, 4, 'f', 1, ' ');
-                        (*itCtl)->m_nbPow = 0;
-                    }
-                }
-                else
-                {
-                    v = ((*itCtl)->m_projector.run(*begin) - itData->m_ofs) * itData->m_amp;
-                }
-
-                if(v > 1.0f) {
-                    v = 1.0f;
-                } else if (v < -1.0f) {
-                    v = -1.0f;
-                }
-
-                (*itTrace)[2*traceCount]
-                           = traceCount - shift;   // display x
-                (*itTrace)[2*traceCount + 1] = v;  // display y
-                traceCount++;
+                bool lastSample = (m_nbSamples == nbSamples) && (start + count == nbSamples);
+                processTraceBlock(*itCtl, *itData, *itTrace, start, count, shift, length, lastSample);
             }
         }
 
-        ++begin;
-        m_nbSamples--;
+        begin += nbSamples;
+        m_nbSamples -= nbSamples;
     }
 
     float traceTime = ((float) m_traceSize) / m_sampleRate;
@@ -637,6 +581,89 @@ int ScopeVis::processTraces(const SampleVector::const_iterator& cbegin, const Sa
     }
 }
 
+void ScopeVis::processTraceBlock(TraceControl *traceControl, TraceData& traceData, float *trace, int start, int count, uint32_t shift, uint32_t length, bool lastSample)
+{
+    Projector::ProjectionType projectionType = traceData.m_projectionType;
+    const Real *projection = m_traceProjector.getProjection(projectionType) + start;
+    uint32_t& traceCount = traceControl->m_traceCount[m_traces.currentBufferIndex()]; // reference for code clarity
+    float amp, ofs, bias; // v = (projection - ofs)*amp + bias
+
+    if (projectionType == Projector::ProjectionMagDB) // v = (((p - 100*ofs)/50) + 2)*amp - 1
+    {
+        amp = traceData.m_amp / 50.0f;
+        ofs = 100.0f * traceData.m_ofs;
+        bias = 2.0f*traceData.m_amp - 1.0f;
+    }
+    else if ((projectionType == Projector::ProjectionMagLin) || (projectionType == Projector::ProjectionMagSq))
+    {
+        amp = traceData.m_amp;
+        ofs = traceData.m_ofs;
+        bias = -1.0f;
+    }
+    else
+    {
+        amp = traceData.m_amp;
+        ofs = traceData.m_ofs;
+        bias = 0.0f;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        float v = (projection[i] - ofs)*amp + bias;
+        trace[2*(traceCount+i)] = traceCount + i - shift;                  // display x
+        trace[2*(traceCount+i) + 1] = std::max(-1.0f, std::min(1.0f, v));   // display y
+    }
+
+    if ((projectionType == Projector::ProjectionMagSq) || (projectionType == Projector::ProjectionMagDB))
+    {
+        const Real *magsq = m_traceProjector.getProjection(Projector::ProjectionMagSq) + start;
+
+        for (int i = 0; i < count; i++)
+        {
+            if ((traceCount + i >= shift) && (traceCount + i < shift+length)) // power display overlay values construction
+            {
+                if (traceCount + i == shift)
+                {
+                    traceControl->m_maxPow = 0.0f;
+                    traceControl->m_sumPow = 0.0f;
+                    traceControl->m_nbPow = 1;
+                }
+
+                if (magsq[i] > 0.0f)
+                {
+                    if (magsq[i] > traceControl->m_maxPow)
+                    {
+                        traceControl->m_maxPow = magsq[i];
+                    }
+
+                    traceControl->m_sumPow += magsq[i];
+                    traceControl->m_nbPow++;
+                }
+            }
+        }
+
+        if (lastSample && (traceControl->m_nbPow > 0)) // on last sample create power display overlay
+        {
+            if (projectionType == Projector::ProjectionMagSq)
+            {
+                double avgPow = traceControl->m_sumPow / traceControl->m_nbPow;
+                traceData.m_textOverlay = QString("%1  %2").arg(traceControl->m_maxPow, 0, 'e', 2).arg(avgPow, 0, 'e', 2);
+            }
+            else
+            {
+                double avgPow = log10f(traceControl->m_sumPow / traceControl->m_nbPow)*10.0;
+                double peakPow = log10f(traceControl->m_maxPow)*10.0;
+                double peakToAvgPow = peakPow - avgPow;
+                traceData.m_textOverlay = QString("%1  %2  %3").arg(peakPow, 0, 'f', 1).arg(avgPow, 0, 'f', 1).arg(peakToAvgPow, 4, 'f', 1, ' ');
+            }
+
+            traceControl->m_nbPow = 0;
+        }
+    }
+
+    traceCount += count;
+}
+
 void ScopeVis::start()
 {
 }
@@ -910,13 +937,9 @@ bool ScopeVis::handleMessage(const Message& message)
 void ScopeVis::updateMaxTraceDelay()
 {
     int maxTraceDelay = 0;
-    bool allocateCache = false;
-    uint32_t projectorCounts[(int) Projector::nbProjectionTypes];
-    memset(projectorCounts, 0, ((int) Projector::nbProjectionTypes)*sizeof(uint32_t));
     std::vector<TraceData>::iterator itData = m_traces.m_tracesData.begin();
-    std::vector<TraceControl*>::iterator itCtrl = m_traces.m_tracesControl.begin();
 
-    for (; itData != m_traces.m_tracesData.end(); ++itData, ++itCtrl)
+    for (; itData != m_traces.m_tracesData.end(); ++itData)
     {
         if (itData->m_traceDelay > maxTraceDelay)
         {
@@ -926,29 +949,6 @@ void ScopeVis::updateMaxTraceDelay()
         if (itData->m_projectionType < 0) {
             itData->m_projectionType = Projector::ProjectionReal;
         }
-
-        if (projectorCounts[(int) itData->m_projectionType] > 0)
-        {
-            allocateCache = true;
-            (*itCtrl)->m_projector.setCacheMaster(false);
-        }
-        else
-        {
-            (*itCtrl)->m_projector.setCacheMaster(true);
-        }
-
-        projectorCounts[(int) itData->m_projectionType]++;
-    }
-
-    itCtrl = m_traces.m_tracesControl.begin();
-
-    for (; itCtrl != m_traces.m_tracesControl.end(); ++itCtrl)
-    {
-        if (allocateCache) {
-            (*itCtrl)->m_projector.setCache(m_projectorCache);
-        } else {
-            (*itCtrl)->m_projector.setCache(0);
-        }
     }
 
     m_maxTraceDelay = maxTraceDelay;
@@ -1024,3 +1024,65 @@ void ScopeVis::updateGLScopeDisplay()
         m_glScope->updateDisplay();
     }
 }
+
+int ScopeVis::TriggerComparator::search(const Real *values, int nbValues, TriggerCondition& triggerCondition)
+{
+    int i = 0;
+#if defined(USE_SSE2) && !defined(NO_DSP_SIMD)
+    // without holdoff the only state carried from one sample to the next is the previous condition
+    if (!m_reset && (triggerCondition.m_triggerData.m_triggerHoldoff == 0))
+    {
+        updateLevels(triggerCondition);
+        __m128 level = _mm_set1_ps(getLevel(triggerCondition.m_projector.getProjectionType()));
+        int trues = 0, falses = 0;
+
+        for (; i < nbValues - 3; i += 4)
+        {
+            int conditions = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(&values[i]), level)); // bit k is the condition of sample i+k
+            int prevConditions = ((conditions << 1) | (triggerCondition.m_prevCondition ? 1 : 0)) & 0xF;
+            int edges;
+
+            if (triggerCondition.m_triggerData.m_triggerBothEdges) {
+                edges = conditions ^ prevConditions;
+            } else if (triggerCondition.m_triggerData.m_triggerPositiveEdge) {
+                edges = conditions & ~prevConditions;
+            } else {
+                edges = ~conditions & prevConditions & 0xF;
+            }
+
+            if (edges)
+            {
+                int k = 0;
+
+                while ((edges & (1<<k)) == 0) {
+                    k++;
+                }
+
+                triggerCondition.m_prevCondition = (conditions >> k) & 1;
+                triggerCondition.m_trues = 0;
+                triggerCondition.m_falses = 0;
+                return i + k;
+            }
+
+            trues |= conditions;
+            falses |= ~conditions & 0xF;
+            triggerCondition.m_prevCondition = (conditions >> 3) & 1;
+        }
+
+        if (trues) {
+            triggerCondition.m_falses = 0;
+        }
+        if (falses) {
+            triggerCondition.m_trues = 0;
+        }
+    }
+#endif
+    for (; i < nbValues; i++)
+    {
+        if (triggered(values[i], triggerCondition)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
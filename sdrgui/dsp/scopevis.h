@@ -32,6 +32,7 @@
 #include "dsp/dsptypes.h"
 #include "dsp/basebandsamplesink.h"
 #include "dsp/projector.h"
+#include "dsp/blockprojector.h"
 #include "export.h"
 #include "util/message.h"
 #include "util/doublebuffer.h"
@@ -147,6 +148,7 @@ public:
     };
 
     static const uint32_t m_traceChunkSize;
+    static const uint32_t m_projectionBlockSize;   //!< Maximum number of samples projected at once
     static const uint32_t m_maxNbTriggers = 10;
     static const uint32_t m_maxNbTraces = 10;
     static const uint32_t m_nbTraceMemories = 50;
@@ -1035,23 +1037,14 @@ private:
             computeLevels();
         }
 
-        bool triggered(const Sample& s, TriggerCondition& triggerCondition)
+        /**
+         * Process the projected value of one sample and return true if the trigger fires
+         */
+        bool triggered(Real value, TriggerCondition& triggerCondition)
         {
-            if (triggerCondition.m_triggerData.m_triggerLevel != m_level)
-            {
-                m_level = triggerCondition.m_triggerData.m_triggerLevel;
-                computeLevels();
-            }
-
-            bool condition, trigger;
-
-            if (triggerCondition.m_projector.getProjectionType() == Projector::ProjectionMagDB) {
-                condition = triggerCondition.m_projector.run(s) > m_levelPowerDB;
-            } else if (triggerCondition.m_projector.getProjectionType() == Projector::ProjectionMagLin) {
-                condition = triggerCondition.m_projector.run(s) > m_levelPowerLin;
-            } else {
-                condition = triggerCondition.m_projector.run(s) > m_level;
-            }
+            updateLevels(triggerCondition);
+            bool condition = value > getLevel(triggerCondition.m_projector.getProjectionType());
+            bool trigger;
 
             if (condition)
             {
@@ -1091,7 +1084,7 @@ private:
 //                qDebug("ScopeVis::triggered: %s/%s %f/%f",
 //                        triggerCondition.m_prevCondition ? "T" : "F",
 //                        condition ? "T" : "F",
-//                        triggerCondition.m_projector->run(s),
+//                        value,
 //                        triggerCondition.m_triggerData.m_triggerLevel);
 //            }
 
@@ -1099,12 +1092,39 @@ private:
             return trigger;
         }
 
+        /**
+         * Process the projected values of a block of samples
+         * - returns the index of the first sample that fires the trigger with the state left past it
+         * - returns -1 if the trigger does not fire in the block
+         */
+        int search(const Real *values, int nbValues, TriggerCondition& triggerCondition);
+
         void reset()
         {
             m_reset = true;
         }
 
     private:
+        void updateLevels(const TriggerCondition& triggerCondition)
+        {
+            if (triggerCondition.m_triggerData.m_triggerLevel != m_level)
+            {
+                m_level = triggerCondition.m_triggerData.m_triggerLevel;
+                computeLevels();
+            }
+        }
+
+        Real getLevel(Projector::ProjectionType projectionType) const
+        {
+            if (projectionType == Projector::ProjectionMagDB) {
+                return m_levelPowerDB;
+            } else if (projectionType == Projector::ProjectionMagLin) {
+                return m_levelPowerLin;
+            } else {
+                return m_level;
+            }
+        }
+
         void computeLevels()
         {
             m_levelPowerLin = m_level + 1.0f;
@@ -1141,7 +1161,8 @@ private:
     int m_maxTraceDelay;                           //!< Maximum trace delay
     TriggerComparator m_triggerComparator;         //!< Compares sample level to trigger level
     QMutex m_mutex;
-    Real m_projectorCache[(int) Projector::nbProjectionTypes];
+    BlockProjector m_traceProjector;               //!< Projections of a block of samples for all traces
+    BlockProjector m_triggerProjector;             //!< Projection of a block of samples for the current trigger
     bool m_triggerOneShot;                         //!< True when one shot mode is active
     bool m_triggerWaitForReset;                    //!< In one shot mode suspended until reset by UI
     uint32_t m_currentTraceMemoryIndex;            //!< The current index of trace in memory (0: current)
@@ -1170,6 +1191,12 @@ private:
      */
     int processTraces(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool traceBack = false);
 
+    /**
+     * Convert count projected samples from start in the current block of m_traceProjector to display points of a trace
+     * - lastSample is true if the last of these samples is the last sample of the trace
+     */
+    void processTraceBlock(TraceControl *traceControl, TraceData& traceData, float *trace, int start, int count, uint32_t shift, uint32_t length, bool lastSample);
+
     /**
      * Get maximum trace delay
      */
@@ -30,7 +30,8 @@ SpectrumVis::SpectrumVis(Real scalef, GLSpectrum* glSpectrum) :
 	m_linear(false),
 	m_ofs(0),
     m_powFFTDiv(1.0),
-	m_mutex(QMutex::Recursive)
+	m_mutex(QMutex::Recursive),
+	m_archive(new SpectrumArchive())
 {
 	setObjectName("SpectrumVis");
 	handleConfigure(1024, 0, 0, AvgModeNone, FFTWindow::BlackmanHarris, false);
@@ -38,6 +39,7 @@ SpectrumVis::SpectrumVis(Real scalef, GLSpectrum* glSpectrum) :
 
 SpectrumVis::~SpectrumVis()
 {
+	m_archive->close(); // recording stops with the device set even if a request still holds the archive
 	delete m_fft;
 }
 
@@ -145,7 +147,7 @@ void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleV
                 }
 
                 // send new data to visualisation
-                m_glSpectrum->newSpectrum(m_powerSpectrum, m_fftSize);
+                publishSpectrum();
 			}
 			else if (m_avgMode == AvgModeMovingAvg)
 			{
@@ -180,7 +182,7 @@ void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleV
 	            }
 
 	            // send new data to visualisation
-	            m_glSpectrum->newSpectrum(m_powerSpectrum, m_fftSize);
+	            publishSpectrum();
 	            m_movingAverage.nextAverage();
 			}
 			else if (m_avgMode == AvgModeFixedAvg)
@@ -227,7 +229,7 @@ void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleV
                 }
 
                 if (m_fixedAverage.nextAverage()) { // result available
-                    m_glSpectrum->newSpectrum(m_powerSpectrum, m_fftSize); // send new data to visualisation
+                    publishSpectrum(); // send new data to visualisation
                 }
 			}
 			else if (m_avgMode == AvgModeMax)
@@ -274,7 +276,7 @@ void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleV
                 }
 
                 if (m_max.nextMax()) { // result available
-                    m_glSpectrum->newSpectrum(m_powerSpectrum, m_fftSize); // send new data to visualisation
+                    publishSpectrum(); // send new data to visualisation
                 }
 			}
 
@@ -301,6 +303,12 @@ void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleV
 	 m_mutex.unlock();
 }
 
+void SpectrumVis::publishSpectrum()
+{
+	m_glSpectrum->newSpectrum(m_powerSpectrum, m_fftSize);
+	m_archive->write(m_powerSpectrum, m_fftSize, m_linear);
+}
+
 void SpectrumVis::start()
 {
 }
@@ -322,6 +330,12 @@ bool SpectrumVis::handleMessage(const Message& message)
 		        conf.getLinear());
 		return true;
 	}
+	else if (DSPSignalNotification::match(message))
+	{
+		DSPSignalNotification& notif = (DSPSignalNotification&) message;
+		m_archive->setSignal(notif.getCenterFrequency(), notif.getSampleRate());
+		return true;
+	}
 	else
 	{
 		return false;
@@ -3,8 +3,10 @@
 
 #include <dsp/basebandsamplesink.h>
 #include <QMutex>
+#include <QSharedPointer>
 #include "dsp/fftengine.h"
 #include "dsp/fftwindow.h"
+#include "dsp/spectrumarchive.h"
 #include "export.h"
 #include "util/message.h"
 #include "util/movingaverage2d.h"
@@ -79,6 +81,8 @@ public:
 	virtual void stop();
 	virtual bool handleMessage(const Message& message);
 
+	QSharedPointer<SpectrumArchive> getArchive() { return m_archive; } //!< spectrum history. Shared with the web API requests in progress
+
 private:
 	FFTEngine* m_fft;
 	FFTWindow m_window;
@@ -107,6 +111,9 @@ private:
 	static const Real m_mult;
 
 	QMutex m_mutex;
+	QSharedPointer<SpectrumArchive> m_archive;
+
+	void publishSpectrum(); //!< to the display and the archive
 
 	void handleConfigure(int fftSize,
 	        int overlapPercent,
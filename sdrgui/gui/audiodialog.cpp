@@ -214,20 +214,26 @@ void AudioDialogX::on_outputCleanup_clicked(bool checked)
 void AudioDialogX::updateOutputDisplay()
 {
     ui->outputSampleRate->setValue(m_outputDeviceInfo.sampleRate);
+    ui->outputLatency->setValue(m_outputDeviceInfo.latency);
     ui->outputUDPAddress->setText(m_outputDeviceInfo.udpAddress);
     ui->outputUDPPort->setText(tr("%1").arg(m_outputDeviceInfo.udpPort));
     ui->outputUDPCopy->setChecked(m_outputDeviceInfo.copyToUDP);
     ui->outputUDPUseRTP->setChecked(m_outputDeviceInfo.udpUseRTP);
     ui->outputUDPChannelMode->setCurrentIndex((int) m_outputDeviceInfo.udpChannelMode);
+    ui->outputUDPCodec->setCurrentIndex((int) m_outputDeviceInfo.udpCodec);
+    ui->outputUDPDTX->setChecked(m_outputDeviceInfo.udpDTX);
 }
 
 void AudioDialogX::updateOutputDeviceInfo()
 {
     m_outputDeviceInfo.sampleRate = ui->outputSampleRate->value();
+    m_outputDeviceInfo.latency = ui->outputLatency->value();
     m_outputDeviceInfo.udpAddress = ui->outputUDPAddress->text();
     m_outputDeviceInfo.udpPort = m_outputUDPPort;
     m_outputDeviceInfo.copyToUDP = ui->outputUDPCopy->isChecked();
     m_outputDeviceInfo.udpUseRTP = ui->outputUDPUseRTP->isChecked();
     m_outputDeviceInfo.udpChannelMode = (AudioOutput::UDPChannelMode) ui->outputUDPChannelMode->currentIndex();
+    m_outputDeviceInfo.udpCodec = (AudioCodec::Codec) ui->outputUDPCodec->currentIndex();
+    m_outputDeviceInfo.udpDTX = ui->outputUDPDTX->isChecked();
 }
 
@@ -347,7 +347,9 @@ void GLScope::paintGL()
                 mat.setToIdentity();
                 mat.translate(-1.0f + 2.0f * rectX, 1.0f - 2.0f * rectY);
                 mat.scale(2.0f * rectW, -2.0f * rectH);
-                m_glShaderSimple.drawPolyline(mat, color, (GLfloat *) &trace[2*start], end - start);
+                int nbPoints = end - start;
+                const GLfloat *points = decimateTrace(&trace[2*start], nbPoints, m_glScopeRect1.width() * width());
+                m_glShaderSimple.drawPolyline(mat, color, (GLfloat *) points, nbPoints);
 
                 // Paint trigger level if any
                 if ((traceData.m_triggerDisplayLevel > -1.0f) && (traceData.m_triggerDisplayLevel < 1.0f))
@@ -526,7 +528,9 @@ void GLScope::paintGL()
                 mat.setToIdentity();
                 mat.translate(-1.0f + 2.0f * rectX, 1.0f - 2.0f * rectY);
                 mat.scale(2.0f * rectW, -2.0f * rectH);
-                m_glShaderSimple.drawPolyline(mat, color, (GLfloat *) &trace[2*start], end - start);
+                int nbPoints = end - start;
+                const GLfloat *points = decimateTrace(&trace[2*start], nbPoints, m_glScopeRect2.width() * width());
+                m_glShaderSimple.drawPolyline(mat, color, (GLfloat *) points, nbPoints);
 
                 // Paint trigger level if any
                 if ((traceData.m_triggerDisplayLevel > -1.0f) && (traceData.m_triggerDisplayLevel < 1.0f))
@@ -752,7 +756,9 @@ void GLScope::paintGL()
                 mat.setToIdentity();
                 mat.translate(-1.0f + 2.0f * rectX, 1.0f - 2.0f * rectY);
                 mat.scale(2.0f * rectW, -2.0f * rectH);
-                m_glShaderSimple.drawPolyline(mat, color, (GLfloat *) &trace[2*start], end - start);
+                int nbPoints = end - start;
+                const GLfloat *points = decimateTrace(&trace[2*start], nbPoints, m_glScopeRect1.width() * width());
+                m_glShaderSimple.drawPolyline(mat, color, (GLfloat *) points, nbPoints);
 
                 // Paint trigger level if any
                 if ((traceData.m_triggerDisplayLevel > -1.0f) && (traceData.m_triggerDisplayLevel < 1.0f))
@@ -1939,6 +1945,52 @@ void GLScope::setYScale(ScaleEngine& scale, uint32_t highlightedTraceIndex)
     }
 }
 
+const GLfloat *GLScope::decimateTrace(const float *trace, int& nbPoints, int nbColumns)
+{
+    if ((nbColumns <= 0) || (nbPoints <= 4*nbColumns)) {
+        return trace;
+    }
+
+    m_q3DecimatedTrace.allocate(4*nbColumns);
+    GLfloat *q3 = m_q3DecimatedTrace.m_array;
+    int n = 0;
+
+    for (int column = 0; column < nbColumns; column++)
+    {
+        int first = (((qint64) column) * nbPoints) / nbColumns;
+        int last = (((qint64) column + 1) * nbPoints) / nbColumns;
+        int iMin = first;
+        int iMax = first;
+
+        for (int i = first + 1; i < last; i++)
+        {
+            if (trace[2*i + 1] < trace[2*iMin + 1]) {
+                iMin = i;
+            }
+            if (trace[2*i + 1] > trace[2*iMax + 1]) {
+                iMax = i;
+            }
+        }
+
+        // keep the extremes in time order
+        int i0 = std::min(iMin, iMax);
+        int i1 = std::max(iMin, iMax);
+        q3[2*n] = trace[2*i0];
+        q3[2*n + 1] = trace[2*i0 + 1];
+        n++;
+
+        if (i1 != i0)
+        {
+            q3[2*n] = trace[2*i1];
+            q3[2*n + 1] = trace[2*i1 + 1];
+            n++;
+        }
+    }
+
+    nbPoints = n;
+    return q3;
+}
+
 void GLScope::drawChannelOverlay(
         const QString& text,
         const QColor& color,
@@ -146,6 +146,7 @@ private:
     IncrementalArray<GLfloat> m_q3TickY2;
     IncrementalArray<GLfloat> m_q3TickX1;
     IncrementalArray<GLfloat> m_q3TickX2;
+    IncrementalArray<GLfloat> m_q3DecimatedTrace;
 
     static const int m_topMargin = 5;
     static const int m_botMargin = 20;
@@ -163,6 +164,12 @@ private:
     void setHorizontalDisplays(); //!< Arrange displays when X and Y are stacked horizontally
     void setPolarDisplays();      //!< Arrange displays when X and Y are stacked over on the left and polar display is on the right
 
+    /**
+     * Reduce a trace to its minimum and maximum points in each pixel column when it has many more points than columns.
+     * Returns the points to draw and updates their number.
+     */
+    const GLfloat *decimateTrace(const float *trace, int& nbPoints, int nbColumns);
+
     void drawChannelOverlay(      //!< Draws a text overlay
             const QString& text,
             const QColor& color,
@@ -0,0 +1,797 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <algorithm>
+
+#include <QOpenGLShaderProgram>
+#include <QOpenGLFunctions>
+#include <QOpenGLContext>
+#include <QOpenGLTexture>
+#include <QOpenGLFramebufferObject>
+#include <QImage>
+#include <QColor>
+#include <QMatrix4x4>
+#include <QDebug>
+
+#include "gui/glshaderspectrogram.h"
+
+#ifndef GL_RED
+#define GL_RED 0x1903
+#endif
+#ifndef GL_RGBA8
+#define GL_RGBA8 0x8058
+#endif
+#ifndef GL_FRAMEBUFFER
+#define GL_FRAMEBUFFER 0x8D40
+#endif
+#ifndef GL_FRAMEBUFFER_BINDING
+#define GL_FRAMEBUFFER_BINDING 0x8CA6
+#endif
+
+#define GLSHADERSPECTROGRAM_NODATA -1.0e30f  //!< waterfall texture lines without data are painted black
+#define GLSHADERSPECTROGRAM_MAXLINES 128     //!< maximum number of lines waiting for upload
+
+bool GLShaderSpectrogram::m_defaultGPU = true;
+
+GLShaderSpectrogram::GLShaderSpectrogram() :
+	m_allowGPU(m_defaultGPU),
+	m_gpu(false),
+	m_fftSize(0),
+	m_waterfallHeight(0),
+	m_waterfallTexturePos(0),
+	m_nbLines(0),
+	m_waterfallBuffer(0),
+	m_histogramBuffer(0),
+	m_histogram(0),
+	m_linesReferenceLevel(0),
+	m_linesPowerRange(100),
+	m_clearHistogram(false),
+	m_programWaterfall(0),
+	m_programHistogramUpdate(0),
+	m_programHistogram(0),
+	m_programMaxHold(0),
+	m_waterfallTexture(0),
+	m_waterfallPaletteTexture(0),
+	m_histogramPaletteTexture(0),
+	m_histogramIndex(0),
+	m_maxHoldFbo(0)
+{
+	m_histogramFbo[0] = 0;
+	m_histogramFbo[1] = 0;
+
+	for(int i = 0; i <= 239; i++) {
+		 QColor c;
+		 c.setHsv(239 - i, 255, 15 + i);
+		 ((quint8*)&m_waterfallPalette[i])[0] = c.red();
+		 ((quint8*)&m_waterfallPalette[i])[1] = c.green();
+		 ((quint8*)&m_waterfallPalette[i])[2] = c.blue();
+		 ((quint8*)&m_waterfallPalette[i])[3] = c.alpha();
+	}
+	m_waterfallPalette[239] = 0xffffffff;
+
+	m_histogramPalette[0] = 0;
+
+	for (int i = 1; i < 240; i++)
+	{
+	    QColor c;
+	    int light = i < 60 ? 128 + (60-i) : 128;
+	    int sat   = i < 60 ? 140 + i : i < 180 ? 200 : 200 - (i-180);
+	    c.setHsl(239 - i, sat, light);
+        ((quint8*)&m_histogramPalette[i])[0] = c.red();
+        ((quint8*)&m_histogramPalette[i])[1] = c.green();
+        ((quint8*)&m_histogramPalette[i])[2] = c.blue();
+        ((quint8*)&m_histogramPalette[i])[3] = c.alpha();
+	}
+}
+
+GLShaderSpectrogram::~GLShaderSpectrogram()
+{
+	cleanup();
+
+	if (m_waterfallBuffer) {
+		delete m_waterfallBuffer;
+	}
+	if (m_histogramBuffer) {
+		delete m_histogramBuffer;
+	}
+	if (m_histogram) {
+		delete[] m_histogram;
+	}
+}
+
+void GLShaderSpectrogram::initializeGL()
+{
+	QOpenGLContext *context = QOpenGLContext::currentContext();
+	cleanupGPU();
+	m_gpu = false;
+
+	// single channel float textures and framebuffer objects are needed
+	if (m_allowGPU && context && !context->isOpenGLES()
+		&& ((context->format().majorVersion() >= 3)
+			|| (context->hasExtension("GL_ARB_texture_float") && context->hasExtension("GL_ARB_texture_rg")))
+		&& QOpenGLFramebufferObject::hasOpenGLFramebufferObjects())
+	{
+		m_programWaterfall = createProgram(m_fragmentShaderSourceWaterfall);
+		m_programHistogramUpdate = createProgram(m_fragmentShaderSourceHistogramUpdate);
+		m_programHistogram = createProgram(m_fragmentShaderSourceHistogram);
+		m_programMaxHold = createProgram(m_fragmentShaderSourceMaxHold);
+		m_gpu = m_programWaterfall && m_programHistogramUpdate && m_programHistogram && m_programMaxHold;
+
+		if (m_gpu)
+		{
+			m_waterfallPaletteTexture = createPaletteTexture(m_waterfallPalette);
+			m_histogramPaletteTexture = createPaletteTexture(m_histogramPalette);
+		}
+		else
+		{
+			cleanupGPU();
+		}
+	}
+
+	m_glShaderWaterfall.initializeGL();
+	m_glShaderHistogram.initializeGL();
+	m_fftSize = 0; // textures are created at next resize
+	qDebug("GLShaderSpectrogram::initializeGL: %s rendering", m_gpu ? "GPU" : "CPU");
+}
+
+void GLShaderSpectrogram::resize(int fftSize, int waterfallHeight)
+{
+	waterfallHeight = waterfallHeight < 1 ? 1 : waterfallHeight;
+
+	if ((fftSize == m_fftSize) && (waterfallHeight == m_waterfallHeight)) {
+		return;
+	}
+
+	bool fftSizeChanged = fftSize != m_fftSize;
+	m_fftSize = fftSize;
+	m_waterfallHeight = waterfallHeight;
+	m_waterfallTexturePos = 0;
+	m_nbLines = 0;
+
+	if (m_gpu)
+	{
+		resizeGPU();
+		return;
+	}
+
+	if (m_waterfallBuffer) {
+		delete m_waterfallBuffer;
+	}
+
+	m_waterfallBuffer = new QImage(m_fftSize, m_waterfallHeight, QImage::Format_ARGB32);
+	m_waterfallBuffer->fill(qRgb(0x00, 0x00, 0x00));
+	m_glShaderWaterfall.initTexture(*m_waterfallBuffer);
+
+	if (fftSizeChanged || !m_histogram)
+	{
+		if (m_histogramBuffer) {
+			delete m_histogramBuffer;
+		}
+		if (m_histogram) {
+			delete[] m_histogram;
+		}
+
+		m_histogramBuffer = new QImage(m_fftSize, 100, QImage::Format_RGB32);
+		m_histogramBuffer->fill(qRgb(0x00, 0x00, 0x00));
+		m_glShaderHistogram.initTexture(*m_histogramBuffer, QOpenGLTexture::ClampToEdge);
+
+		m_histogram = new quint8[100 * m_fftSize];
+		memset(m_histogram, 0x00, 100 * m_fftSize);
+	}
+}
+
+void GLShaderSpectrogram::resizeGPU()
+{
+	QOpenGLFunctions *f = QOpenGLContext::currentContext()->functions();
+
+	if (m_waterfallTexture) {
+		delete m_waterfallTexture;
+	}
+
+	m_waterfallTexture = new QOpenGLTexture(QOpenGLTexture::Target2D);
+	m_waterfallTexture->setFormat(QOpenGLTexture::R32F);
+	m_waterfallTexture->setSize(m_fftSize, m_waterfallHeight);
+	m_waterfallTexture->allocateStorage(QOpenGLTexture::Red, QOpenGLTexture::Float32);
+	m_waterfallTexture->setMinificationFilter(QOpenGLTexture::Linear);
+	m_waterfallTexture->setMagnificationFilter(QOpenGLTexture::Linear);
+	m_waterfallTexture->setWrapMode(QOpenGLTexture::Repeat);
+
+	m_lines.assign(m_fftSize * std::min(m_waterfallHeight, GLSHADERSPECTROGRAM_MAXLINES), GLSHADERSPECTROGRAM_NODATA);
+	m_linesDecay.assign(std::min(m_waterfallHeight, GLSHADERSPECTROGRAM_MAXLINES), 0);
+	m_linesStroke.assign(std::min(m_waterfallHeight, GLSHADERSPECTROGRAM_MAXLINES), 0);
+
+	m_waterfallTexture->bind();
+	f->glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+	for (int y = 0; y < m_waterfallHeight; y += m_linesDecay.size()) {
+		f->glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, m_fftSize, std::min((int) m_linesDecay.size(), m_waterfallHeight - y), GL_RED, GL_FLOAT, m_lines.data());
+	}
+
+	if (!m_histogramFbo[0] || (m_histogramFbo[0]->width() != m_fftSize))
+	{
+		for (int i = 0; i < 2; i++)
+		{
+			if (m_histogramFbo[i]) {
+				delete m_histogramFbo[i];
+			}
+
+			m_histogramFbo[i] = new QOpenGLFramebufferObject(m_fftSize, 100, QOpenGLFramebufferObject::NoAttachment, GL_TEXTURE_2D, GL_RGBA8);
+		}
+
+		if (m_maxHoldFbo) {
+			delete m_maxHoldFbo;
+		}
+
+		m_maxHoldFbo = new QOpenGLFramebufferObject(m_fftSize, 1, QOpenGLFramebufferObject::NoAttachment, GL_TEXTURE_2D, GL_RGBA8);
+		m_maxHoldPixels.resize(4 * m_fftSize);
+		m_histogramIndex = 0;
+		m_clearHistogram = true;
+	}
+}
+
+void GLShaderSpectrogram::newLine(const std::vector<Real>& spectrum, Real referenceLevel, Real powerRange, int decay, int stroke, bool histogram)
+{
+	if ((m_fftSize <= 0) || ((int) spectrum.size() < m_fftSize)) {
+		return;
+	}
+
+	if (!m_gpu)
+	{
+		newLineCPU(spectrum, referenceLevel, powerRange, decay, stroke);
+		return;
+	}
+
+	if (m_nbLines < (int) m_linesDecay.size()) // else the line is dropped like with the CPU waterfall buffer
+	{
+		std::copy(spectrum.begin(), spectrum.begin() + m_fftSize, m_lines.begin() + m_nbLines * m_fftSize);
+		m_linesDecay[m_nbLines] = histogram ? decay : 0;
+		m_linesStroke[m_nbLines] = histogram ? stroke : 0;
+		m_nbLines++;
+	}
+
+	m_linesReferenceLevel = referenceLevel;
+	m_linesPowerRange = powerRange;
+}
+
+void GLShaderSpectrogram::newLineCPU(const std::vector<Real>& spectrum, Real referenceLevel, Real powerRange, int decay, int stroke)
+{
+	if (m_nbLines < m_waterfallBuffer->height())
+	{
+		quint32* pix = (quint32*) m_waterfallBuffer->scanLine(m_nbLines);
+
+		for (int i = 0; i < m_fftSize; i++)
+		{
+			int v = (int)((spectrum[i] - referenceLevel) * 2.4 * 100.0 / powerRange + 240.0);
+
+			if (v > 239) {
+				v = 239;
+			} else if (v < 0) {
+				v = 0;
+			}
+
+			*pix++ = m_waterfallPalette[v];
+		}
+
+		m_nbLines++;
+	}
+
+	quint8* b = m_histogram;
+
+	if (decay != 0)
+	{
+		int fftMulSize = 100 * m_fftSize;
+
+		for (int i = 0; i < fftMulSize; i++)
+		{
+			if (*b > decay) {
+				*b = *b - decay;
+			} else {
+				*b = 0;
+			}
+
+			b++;
+		}
+	}
+
+	for (int i = 0; i < m_fftSize; i++)
+	{
+		int v = (int)((spectrum[i] - referenceLevel) * 100.0 / powerRange + 100.0);
+
+		if ((v >= 0) && (v <= 99))
+		{
+			b = m_histogram + i * 100 + v;
+
+			// capping to 239 as palette values are [0..239]
+			if (*b + stroke <= 239) {
+				*b += stroke;
+			} else {
+				*b = 239;
+			}
+		}
+	}
+}
+
+void GLShaderSpectrogram::clearHistogram()
+{
+	if (m_gpu) {
+		m_clearHistogram = true;
+	} else if (m_histogram) {
+		memset(m_histogram, 0x00, 100 * m_fftSize);
+	}
+}
+
+void GLShaderSpectrogram::uploadLines()
+{
+	if (m_fftSize <= 0) {
+		return;
+	}
+
+	if (m_gpu) {
+		uploadLinesGPU();
+	} else {
+		uploadLinesCPU();
+	}
+}
+
+void GLShaderSpectrogram::uploadLinesCPU()
+{
+	if (m_nbLines == 0) {
+		return;
+	}
+
+	if (m_waterfallTexturePos + m_nbLines < m_waterfallHeight)
+	{
+		m_glShaderWaterfall.subTexture(0, m_waterfallTexturePos, m_fftSize, m_nbLines, m_waterfallBuffer->scanLine(0));
+		m_waterfallTexturePos += m_nbLines;
+	}
+	else
+	{
+		int breakLine = m_waterfallHeight - m_waterfallTexturePos;
+		int linesLeft = m_waterfallTexturePos + m_nbLines - m_waterfallHeight;
+		m_glShaderWaterfall.subTexture(0, m_waterfallTexturePos, m_fftSize, breakLine, m_waterfallBuffer->scanLine(0));
+		m_glShaderWaterfall.subTexture(0, 0, m_fftSize, linesLeft, m_waterfallBuffer->scanLine(breakLine));
+		m_waterfallTexturePos = linesLeft;
+	}
+
+	m_nbLines = 0;
+}
+
+void GLShaderSpectrogram::uploadLinesGPU()
+{
+	QOpenGLFunctions *f = QOpenGLContext::currentContext()->functions();
+	GLint framebuffer; // the one of the widget is not always the default one
+	f->glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+
+	if (m_clearHistogram)
+	{
+		for (int i = 0; i < 2; i++)
+		{
+			m_histogramFbo[i]->bind();
+			f->glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+			f->glClear(GL_COLOR_BUFFER_BIT);
+		}
+
+		f->glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		m_clearHistogram = false;
+	}
+
+	if (m_nbLines == 0) {
+		return;
+	}
+
+	// one upload of the raw lines in the ring
+	int firstLines = std::min(m_nbLines, m_waterfallHeight - m_waterfallTexturePos);
+	m_waterfallTexture->bind();
+	f->glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	f->glTexSubImage2D(GL_TEXTURE_2D, 0, 0, m_waterfallTexturePos, m_fftSize, firstLines, GL_RED, GL_FLOAT, m_lines.data());
+
+	if (firstLines < m_nbLines) {
+		f->glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_fftSize, m_nbLines - firstLines, GL_RED, GL_FLOAT, &m_lines[firstLines * m_fftSize]);
+	}
+
+	// histogram decay and strokes of each line rendered from one framebuffer to the other
+	GLint viewport[4];
+	f->glGetIntegerv(GL_VIEWPORT, viewport);
+	bool blend = f->glIsEnabled(GL_BLEND);
+	f->glDisable(GL_BLEND);
+	f->glViewport(0, 0, m_fftSize, 100);
+
+	QMatrix4x4 matrix; // [0..1] to clip coordinates
+	matrix.translate(-1.0f, -1.0f);
+	matrix.scale(2.0f, 2.0f);
+	GLfloat vtx[] = {0, 0, 1, 0, 1, 1, 0, 1};
+	GLfloat tex[] = {0, 0, 1, 0, 1, 1, 0, 1};
+
+	m_programHistogramUpdate->bind();
+	m_programHistogramUpdate->setUniformValue("uHistogram", 0);
+	m_programHistogramUpdate->setUniformValue("uWaterfall", 1);
+	m_programHistogramUpdate->setUniformValue("uReferenceLevel", (GLfloat) m_linesReferenceLevel);
+	m_programHistogramUpdate->setUniformValue("uPowerRange", (GLfloat) m_linesPowerRange);
+	f->glActiveTexture(GL_TEXTURE1);
+	m_waterfallTexture->bind();
+	f->glActiveTexture(GL_TEXTURE0);
+
+	for (int i = 0; i < m_nbLines; i++)
+	{
+		if ((m_linesDecay[i] == 0) && (m_linesStroke[i] == 0)) {
+			continue;
+		}
+
+		int row = (m_waterfallTexturePos + i) % m_waterfallHeight;
+		m_histogramFbo[1 - m_histogramIndex]->bind();
+		f->glBindTexture(GL_TEXTURE_2D, m_histogramFbo[m_histogramIndex]->texture());
+		m_programHistogramUpdate->setUniformValue("uRow", (GLfloat) ((row + 0.5f) / m_waterfallHeight));
+		m_programHistogramUpdate->setUniformValue("uDecay", (GLfloat) (m_linesDecay[i] / 255.0f));
+		m_programHistogramUpdate->setUniformValue("uStroke", (GLfloat) (m_linesStroke[i] / 255.0f));
+		drawQuad(f, m_programHistogramUpdate, matrix, tex, vtx);
+		m_histogramIndex = 1 - m_histogramIndex;
+	}
+
+	m_programHistogramUpdate->release();
+	f->glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	f->glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+	if (blend) {
+		f->glEnable(GL_BLEND);
+	}
+
+	m_waterfallTexturePos = (m_waterfallTexturePos + m_nbLines) % m_waterfallHeight;
+	m_nbLines = 0;
+}
+
+void GLShaderSpectrogram::getWaterfallCoordinates(int texturePos, int textureHeight, bool inverted, GLfloat *textureCoords, GLfloat *vertices)
+{
+	GLfloat vtx1[] = {
+			0, inverted ? 0.0f : 1.0f,
+			1, inverted ? 0.0f : 1.0f,
+			1, inverted ? 1.0f : 0.0f,
+			0, inverted ? 1.0f : 0.0f
+	};
+
+	float prop_y = texturePos / (textureHeight - 1.0);
+	float off = 1.0 / (textureHeight - 1.0);
+
+	GLfloat tex1[] = {
+			0, prop_y + 1 - off,
+			1, prop_y + 1 - off,
+			1, prop_y,
+			0, prop_y
+	};
+
+	memcpy(vertices, vtx1, sizeof(vtx1));
+	memcpy(textureCoords, tex1, sizeof(tex1));
+}
+
+void GLShaderSpectrogram::drawWaterfall(const QMatrix4x4& transformMatrix, bool inverted, Real referenceLevel, Real powerRange)
+{
+	if (m_fftSize <= 0) {
+		return;
+	}
+
+	GLfloat vtx[8];
+	GLfloat tex[8];
+	getWaterfallCoordinates(m_waterfallTexturePos, m_waterfallHeight, inverted, tex, vtx);
+
+	if (!m_gpu)
+	{
+		m_glShaderWaterfall.drawSurface(transformMatrix, tex, vtx, 4);
+		return;
+	}
+
+	// palette is applied to the current levels so the whole waterfall follows the scale changes
+	QOpenGLFunctions *f = QOpenGLContext::currentContext()->functions();
+	m_programWaterfall->bind();
+	m_programWaterfall->setUniformValue("uTexture", 0);
+	m_programWaterfall->setUniformValue("uPalette", 1);
+	m_programWaterfall->setUniformValue("uReferenceLevel", (GLfloat) referenceLevel);
+	m_programWaterfall->setUniformValue("uPowerRange", (GLfloat) powerRange);
+	f->glActiveTexture(GL_TEXTURE1);
+	m_waterfallPaletteTexture->bind();
+	f->glActiveTexture(GL_TEXTURE0);
+	m_waterfallTexture->bind();
+	drawQuad(f, m_programWaterfall, transformMatrix, tex, vtx);
+	m_programWaterfall->release();
+}
+
+void GLShaderSpectrogram::drawHistogram(const QMatrix4x4& transformMatrix)
+{
+	if (m_fftSize <= 0) {
+		return;
+	}
+
+	GLfloat vtx1[] = {
+			0, 0,
+			1, 0,
+			1, 1,
+			0, 1
+	};
+	GLfloat tex1[] = {
+			0, 0,
+			1, 0,
+			1, 1,
+			0, 1
+	};
+
+	if (!m_gpu)
+	{
+		// import new lines into the texture
+		quint32* pix;
+		quint8* bs = m_histogram;
+
+		for (int y = 0; y < 100; y++)
+		{
+			quint8* b = bs;
+			pix = (quint32*) m_histogramBuffer->scanLine(99 - y);
+
+			for (int x = 0; x < m_fftSize; x++)
+			{
+				*pix = m_histogramPalette[*b];
+				pix++;
+				b += 100;
+			}
+
+			bs++;
+		}
+
+		m_glShaderHistogram.subTexture(0, 0, m_fftSize, 100, m_histogramBuffer->scanLine(0));
+		m_glShaderHistogram.drawSurface(transformMatrix, tex1, vtx1, 4);
+		return;
+	}
+
+	QOpenGLFunctions *f = QOpenGLContext::currentContext()->functions();
+	m_programHistogram->bind();
+	m_programHistogram->setUniformValue("uHistogram", 0);
+	m_programHistogram->setUniformValue("uPalette", 1);
+	f->glActiveTexture(GL_TEXTURE1);
+	m_histogramPaletteTexture->bind();
+	f->glActiveTexture(GL_TEXTURE0);
+	f->glBindTexture(GL_TEXTURE_2D, m_histogramFbo[m_histogramIndex]->texture());
+	drawQuad(f, m_programHistogram, transformMatrix, tex1, vtx1);
+	m_programHistogram->release();
+}
+
+void GLShaderSpectrogram::getMaxHold(std::vector<Real>& maxHold, Real referenceLevel, Real powerRange)
+{
+	if (m_fftSize <= 0) {
+		return;
+	}
+
+	if (maxHold.size() < (unsigned int) m_fftSize) {
+		maxHold.resize(m_fftSize);
+	}
+
+	if (!m_gpu)
+	{
+		for (int i = 0; i < m_fftSize; i++)
+		{
+			int j;
+			quint8* bs = m_histogram + i * 100;
+
+			for (j = 99; j >= 0; j--)
+			{
+				if (bs[j] > 0) {
+					break;
+				}
+			}
+
+			// m_referenceLevel : top
+			// m_referenceLevel - m_powerRange : bottom
+			maxHold[i] = ((j - 99) * powerRange) / 99.0 + referenceLevel;
+		}
+
+		return;
+	}
+
+	// the highest non empty cell of each column is found by the GPU and only this line is read back
+	QOpenGLFunctions *f = QOpenGLContext::currentContext()->functions();
+	GLint framebuffer;
+	f->glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+	GLint viewport[4];
+	f->glGetIntegerv(GL_VIEWPORT, viewport);
+	bool blend = f->glIsEnabled(GL_BLEND);
+	f->glDisable(GL_BLEND);
+	f->glViewport(0, 0, m_fftSize, 1);
+
+	QMatrix4x4 matrix;
+	matrix.translate(-1.0f, -1.0f);
+	matrix.scale(2.0f, 2.0f);
+	GLfloat vtx[] = {0, 0, 1, 0, 1, 1, 0, 1};
+	GLfloat tex[] = {0, 0, 1, 0, 1, 1, 0, 1};
+
+	m_maxHoldFbo->bind();
+	m_programMaxHold->bind();
+	m_programMaxHold->setUniformValue("uHistogram", 0);
+	f->glActiveTexture(GL_TEXTURE0);
+	f->glBindTexture(GL_TEXTURE_2D, m_histogramFbo[m_histogramIndex]->texture());
+	drawQuad(f, m_programMaxHold, matrix, tex, vtx);
+	m_programMaxHold->release();
+	f->glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	f->glReadPixels(0, 0, m_fftSize, 1, GL_RGBA, GL_UNSIGNED_BYTE, m_maxHoldPixels.data());
+	f->glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	f->glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+	if (blend) {
+		f->glEnable(GL_BLEND);
+	}
+
+	for (int i = 0; i < m_fftSize; i++)
+	{
+		int j = m_maxHoldPixels[4*i] - 1; // -1 for an empty column
+		maxHold[i] = ((j - 99) * powerRange) / 99.0 + referenceLevel;
+	}
+}
+
+void GLShaderSpectrogram::drawQuad(QOpenGLFunctions *f, QOpenGLShaderProgram *program, const QMatrix4x4& transformMatrix, GLfloat *textureCoords, GLfloat *vertices)
+{
+	program->setUniformValue("uMatrix", transformMatrix);
+	f->glEnableVertexAttribArray(0); // vertex
+	f->glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, vertices);
+	f->glEnableVertexAttribArray(1); // texture coordinates
+	f->glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, textureCoords);
+	f->glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+	f->glDisableVertexAttribArray(1);
+	f->glDisableVertexAttribArray(0);
+}
+
+QOpenGLShaderProgram *GLShaderSpectrogram::createProgram(const QString& fragmentShaderSource)
+{
+	QOpenGLShaderProgram *program = new QOpenGLShaderProgram;
+
+	if (!program->addShaderFromSourceCode(QOpenGLShader::Vertex, m_vertexShaderSource)
+		|| !program->addShaderFromSourceCode(QOpenGLShader::Fragment, fragmentShaderSource))
+	{
+		qDebug() << "GLShaderSpectrogram::createProgram: error in shader: " << program->log();
+		delete program;
+		return 0;
+	}
+
+	program->bindAttributeLocation("vertex", 0);
+	program->bindAttributeLocation("texCoord", 1);
+
+	if (!program->link())
+	{
+		qDebug() << "GLShaderSpectrogram::createProgram: error linking shader: " << program->log();
+		delete program;
+		return 0;
+	}
+
+	return program;
+}
+
+QOpenGLTexture *GLShaderSpectrogram::createPaletteTexture(const QRgb *palette)
+{
+	// 256 entries so that texture coordinates are exact. The last entries repeat the last color
+	QImage image(256, 1, QImage::Format_RGBA8888);
+	QRgb *line = (QRgb *) image.scanLine(0);
+
+	for (int i = 0; i < 256; i++) {
+		line[i] = palette[i < 240 ? i : 239];
+	}
+
+	QOpenGLTexture *texture = new QOpenGLTexture(image, QOpenGLTexture::DontGenerateMipMaps);
+	texture->setMinificationFilter(QOpenGLTexture::Nearest);
+	texture->setMagnificationFilter(QOpenGLTexture::Nearest);
+	texture->setWrapMode(QOpenGLTexture::ClampToEdge);
+	return texture;
+}
+
+void GLShaderSpectrogram::cleanup()
+{
+	m_glShaderWaterfall.cleanup();
+	m_glShaderHistogram.cleanup();
+	cleanupGPU();
+	m_fftSize = 0;
+}
+
+void GLShaderSpectrogram::cleanupGPU()
+{
+	delete m_programWaterfall;
+	m_programWaterfall = 0;
+	delete m_programHistogramUpdate;
+	m_programHistogramUpdate = 0;
+	delete m_programHistogram;
+	m_programHistogram = 0;
+	delete m_programMaxHold;
+	m_programMaxHold = 0;
+	delete m_waterfallTexture;
+	m_waterfallTexture = 0;
+	delete m_waterfallPaletteTexture;
+	m_waterfallPaletteTexture = 0;
+	delete m_histogramPaletteTexture;
+	m_histogramPaletteTexture = 0;
+	delete m_histogramFbo[0];
+	m_histogramFbo[0] = 0;
+	delete m_histogramFbo[1];
+	m_histogramFbo[1] = 0;
+	delete m_maxHoldFbo;
+	m_maxHoldFbo = 0;
+}
+
+const QString GLShaderSpectrogram::m_vertexShaderSource = QString(
+		"uniform highp mat4 uMatrix;\n"
+		"attribute highp vec4 vertex;\n"
+		"attribute highp vec2 texCoord;\n"
+		"varying highp vec2 texCoordVar;\n"
+		"void main() {\n"
+		"    gl_Position = uMatrix * vertex;\n"
+		"    texCoordVar = texCoord;\n"
+		"}\n"
+		);
+
+const QString GLShaderSpectrogram::m_fragmentShaderSourceWaterfall = QString(
+		"uniform highp sampler2D uTexture;\n"
+		"uniform lowp sampler2D uPalette;\n"
+		"uniform highp float uReferenceLevel;\n"
+		"uniform highp float uPowerRange;\n"
+		"varying highp vec2 texCoordVar;\n"
+		"void main() {\n"
+		"    highp float power = texture2D(uTexture, texCoordVar).r;\n"
+		"    if (power < -1.0e29) {\n"
+		"        gl_FragColor = vec4(0.0, 0.0, 0.0, 1.0);\n"
+		"    } else {\n"
+		"        highp float index = clamp(floor((power - uReferenceLevel) * 240.0 / uPowerRange + 240.0), 0.0, 239.0);\n"
+		"        gl_FragColor = texture2D(uPalette, vec2((index + 0.5) / 256.0, 0.5));\n"
+		"    }\n"
+		"}\n"
+		);
+
+const QString GLShaderSpectrogram::m_fragmentShaderSourceHistogramUpdate = QString(
+		"uniform lowp sampler2D uHistogram;\n"
+		"uniform highp sampler2D uWaterfall;\n"
+		"uniform highp float uRow;\n"
+		"uniform highp float uReferenceLevel;\n"
+		"uniform highp float uPowerRange;\n"
+		"uniform highp float uDecay;\n"
+		"uniform highp float uStroke;\n"
+		"varying highp vec2 texCoordVar;\n"
+		"void main() {\n"
+		"    highp float h = max(texture2D(uHistogram, texCoordVar).r - uDecay, 0.0);\n"
+		"    highp float x = (texture2D(uWaterfall, vec2(texCoordVar.x, uRow)).r - uReferenceLevel) * 100.0 / uPowerRange + 100.0;\n"
+		"    highp float level = x < 0.0 ? ceil(x) : floor(x);\n" // truncation like the CPU
+		"    highp float cell = 99.0 - floor(texCoordVar.y * 100.0);\n"
+		"    if (level == cell) {\n"
+		"        h = min(h + uStroke, 239.0 / 255.0);\n"
+		"    }\n"
+		"    gl_FragColor = vec4(h, 0.0, 0.0, 1.0);\n"
+		"}\n"
+		);
+
+const QString GLShaderSpectrogram::m_fragmentShaderSourceHistogram = QString(
+		"uniform lowp sampler2D uHistogram;\n"
+		"uniform lowp sampler2D uPalette;\n"
+		"varying highp vec2 texCoordVar;\n"
+		"void main() {\n"
+		"    highp float index = floor(texture2D(uHistogram, texCoordVar).r * 255.0 + 0.5);\n"
+		"    gl_FragColor = texture2D(uPalette, vec2((index + 0.5) / 256.0, 0.5));\n"
+		"}\n"
+		);
+
+const QString GLShaderSpectrogram::m_fragmentShaderSourceMaxHold = QString(
+		"uniform lowp sampler2D uHistogram;\n"
+		"varying highp vec2 texCoordVar;\n"
+		"void main() {\n"
+		"    highp float top = 0.0;\n"
+		"    for (int y = 0; y < 100; y++) {\n"
+		"        if (texture2D(uHistogram, vec2(texCoordVar.x, (float(y) + 0.5) / 100.0)).r > 0.0) {\n"
+		"            top = float(100 - y);\n"
+		"            break;\n"
+		"        }\n"
+		"    }\n"
+		"    gl_FragColor = vec4(top / 255.0, 0.0, 0.0, 1.0);\n"
+		"}\n"
+		);
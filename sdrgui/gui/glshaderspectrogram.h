@@ -0,0 +1,126 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2018 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Waterfall and persistence histogram of the spectrum display                   //
+//                                                                               //
+// With OpenGL 3 (or float textures) the raw power lines in dB are uploaded once //
+// in a ring texture. Palette mapping, scrolling and the histogram decay and     //
+// strokes are done by shaders (the histogram lives in two framebuffers used in  //
+// turn). Otherwise the lines are colored and the histogram is updated on the    //
+// CPU then uploaded as images.                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_GUI_GLSHADERSPECTROGRAM_H_
+#define INCLUDE_GUI_GLSHADERSPECTROGRAM_H_
+
+#include <vector>
+#include <QRgb>
+#include <QOpenGLFunctions>
+
+#include "dsp/dsptypes.h"
+#include "gui/glshadertextured.h"
+#include "export.h"
+
+class QOpenGLShaderProgram;
+class QOpenGLTexture;
+class QOpenGLFramebufferObject;
+class QMatrix4x4;
+class QImage;
+
+class SDRGUI_API GLShaderSpectrogram
+{
+public:
+	GLShaderSpectrogram();
+	~GLShaderSpectrogram();
+
+	static void setDefaultGPU(bool gpu) { m_defaultGPU = gpu; } //!< false to always render on the CPU
+	void setGPU(bool gpu) { m_allowGPU = gpu; } //!< applied at next initializeGL
+	bool isGPU() const { return m_gpu; }
+	int getFFTSize() const { return m_fftSize; }
+
+	// OpenGL thread
+	void initializeGL(); //!< checks if the GPU rendering is possible
+	void resize(int fftSize, int waterfallHeight);
+	void uploadLines(); //!< uploads the new lines in the waterfall texture and updates the histogram with them
+	void drawWaterfall(const QMatrix4x4& transformMatrix, bool inverted, Real referenceLevel, Real powerRange);
+	void drawHistogram(const QMatrix4x4& transformMatrix);
+	void getMaxHold(std::vector<Real>& maxHold, Real referenceLevel, Real powerRange); //!< highest level of the histogram for each bin
+	void cleanup();
+
+	// spectrum thread. Calls are serialized with the OpenGL thread ones by the caller
+	/**
+	 * Add a spectrum line of resize() FFT size. decay is the histogram decay applied before this line (0 for none).
+	 * The histogram is not updated on the GPU if histogram is false.
+	 */
+	void newLine(const std::vector<Real>& spectrum, Real referenceLevel, Real powerRange, int decay, int stroke, bool histogram);
+	void clearHistogram();
+
+private:
+	static bool m_defaultGPU;
+	bool m_allowGPU;
+	bool m_gpu;
+	int m_fftSize;
+	int m_waterfallHeight;  //!< number of lines of the waterfall texture
+	int m_waterfallTexturePos;
+	int m_nbLines;          //!< new lines not uploaded yet
+
+	QRgb m_waterfallPalette[240];
+	QRgb m_histogramPalette[240];
+
+	// CPU rendering
+	QImage* m_waterfallBuffer;
+	QImage* m_histogramBuffer;
+	quint8* m_histogram; //!< Spectrum phosphor matrix of FFT width and PSD height scaled to 100. values [0..239]
+	GLShaderTextured m_glShaderWaterfall;
+	GLShaderTextured m_glShaderHistogram;
+
+	// GPU rendering
+	std::vector<Real> m_lines;          //!< raw lines not uploaded yet
+	std::vector<quint8> m_linesDecay;
+	std::vector<quint8> m_linesStroke;  //!< 0 when the histogram is not updated
+	std::vector<quint8> m_maxHoldPixels;
+	Real m_linesReferenceLevel;         //!< for the histogram update
+	Real m_linesPowerRange;
+	bool m_clearHistogram;
+	QOpenGLShaderProgram *m_programWaterfall;
+	QOpenGLShaderProgram *m_programHistogramUpdate;
+	QOpenGLShaderProgram *m_programHistogram;
+	QOpenGLShaderProgram *m_programMaxHold;
+	QOpenGLTexture *m_waterfallTexture;  //!< ring of raw lines (single float channel)
+	QOpenGLTexture *m_waterfallPaletteTexture;
+	QOpenGLTexture *m_histogramPaletteTexture;
+	QOpenGLFramebufferObject *m_histogramFbo[2];
+	int m_histogramIndex;                //!< framebuffer holding the current histogram
+	QOpenGLFramebufferObject *m_maxHoldFbo;
+
+	void newLineCPU(const std::vector<Real>& spectrum, Real referenceLevel, Real powerRange, int decay, int stroke);
+	void uploadLinesCPU();
+	void uploadLinesGPU();
+	void resizeGPU();
+	void cleanupGPU();
+	void drawQuad(QOpenGLFunctions *f, QOpenGLShaderProgram *program, const QMatrix4x4& transformMatrix, GLfloat *textureCoords, GLfloat *vertices);
+	QOpenGLShaderProgram *createProgram(const QString& fragmentShaderSource);
+	QOpenGLTexture *createPaletteTexture(const QRgb *palette);
+	static void getWaterfallCoordinates(int texturePos, int textureHeight, bool inverted, GLfloat *textureCoords, GLfloat *vertices);
+
+	static const QString m_vertexShaderSource;
+	static const QString m_fragmentShaderSourceWaterfall;
+	static const QString m_fragmentShaderSourceHistogramUpdate;
+	static const QString m_fragmentShaderSourceHistogram;
+	static const QString m_fragmentShaderSourceMaxHold;
+};
+
+#endif /* INCLUDE_GUI_GLSHADERSPECTROGRAM_H_ */
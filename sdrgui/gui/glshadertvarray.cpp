@@ -17,6 +17,13 @@
 
 #include <gui/glshadertvarray.h>
 
+#ifndef GL_RED
+#define GL_RED 0x1903
+#endif
+#ifndef GL_LUMINANCE
+#define GL_LUMINANCE 0x1909
+#endif
+
 const QString GLShaderTVArray::m_strVertexShaderSourceArray = QString(
         "uniform highp mat4 uMatrix;\n"
                 "attribute highp vec4 vertex;\n"
@@ -34,6 +41,30 @@ const QString GLShaderTVArray::m_strFragmentShaderSourceColored = QString(
                 "    gl_FragColor = texture2D(uTexture, texCoordVar);\n"
                 "}\n");
 
+// Grey levels from the single channel texture. A GL_LUMINANCE texture has the value in r, g and b so .r reads both formats
+const QString GLShaderTVArray::m_strFragmentShaderSourceGrey = QString(
+        "uniform lowp sampler2D uTexture;\n"
+                "varying mediump vec2 texCoordVar;\n"
+                "void main() {\n"
+                "    lowp float y = texture2D(uTexture, texCoordVar).r;\n"
+                "    gl_FragColor = vec4(y, y, y, 1.0);\n"
+                "}\n");
+
+// BT.601 limited range to RGB. Planes are uploaded with their line stride so x is scaled to the visible width.
+const QString GLShaderTVArray::m_strFragmentShaderSourceYUV = QString(
+        "uniform lowp sampler2D uTextureY;\n"
+                "uniform lowp sampler2D uTextureU;\n"
+                "uniform lowp sampler2D uTextureV;\n"
+                "uniform mediump vec2 uScale;\n"
+                "varying mediump vec2 texCoordVar;\n"
+                "void main() {\n"
+                "    mediump float y = texture2D(uTextureY, vec2(texCoordVar.x * uScale.x, texCoordVar.y)).r;\n"
+                "    mediump float u = texture2D(uTextureU, vec2(texCoordVar.x * uScale.y, texCoordVar.y)).r - 0.5;\n"
+                "    mediump float v = texture2D(uTextureV, vec2(texCoordVar.x * uScale.y, texCoordVar.y)).r - 0.5;\n"
+                "    y = 1.164 * (y - 0.0625);\n"
+                "    gl_FragColor = vec4(y + 1.596 * v, y - 0.392 * u - 0.813 * v, y + 2.017 * u, 1.0);\n"
+                "}\n");
+
 GLShaderTVArray::GLShaderTVArray(bool blnColor) : m_blnColor(blnColor)
 {
 	m_blnAlphaBlend = false;
@@ -48,6 +79,22 @@ GLShaderTVArray::GLShaderTVArray(bool blnColor) : m_blnColor(blnColor)
 
     m_objTextureLoc = 0;
     m_objMatrixLoc = 0;
+
+    m_objProgramYUV = 0;
+    m_objMatrixLocYUV = 0;
+    m_objScaleLocYUV = 0;
+
+    for (int i = 0; i < 3; i++)
+    {
+        m_objTexturesYUV[i] = 0;
+        m_intLinesizesYUV[i] = 0;
+    }
+
+    m_objProgramGrey = 0;
+    m_objMatrixLocGrey = 0;
+    m_objTextureGrey = 0;
+    m_blnTextureGreyAllocated = false;
+    m_singleChannelFormat = GL_RED;
 }
 
 GLShaderTVArray::~GLShaderTVArray()
@@ -66,6 +113,26 @@ void GLShaderTVArray::InitializeGL(int intCols, int intRows)
 
     m_objCurrentRow = 0;
 
+    for (int i = 0; i < 3; i++) {
+        m_intLinesizesYUV[i] = 0; // YUV textures are reallocated on next upload
+    }
+
+    m_blnTextureGreyAllocated = false; // grey texture too
+
+    // single channel GL_RED textures need OpenGL 3.0 or GL_ARB_texture_rg. Fall back to GL_LUMINANCE
+    // on OpenGL ES and older desktop contexts
+    QOpenGLContext *context = QOpenGLContext::currentContext();
+
+    if (context && !context->isOpenGLES()
+        && ((context->format().majorVersion() >= 3) || context->hasExtension("GL_ARB_texture_rg")))
+    {
+        m_singleChannelFormat = GL_RED;
+    }
+    else
+    {
+        m_singleChannelFormat = GL_LUMINANCE;
+    }
+
     if (m_objProgram == 0)
     {
         m_objProgram = new QOpenGLShaderProgram();
@@ -247,6 +314,231 @@ void GLShaderTVArray::RenderPixels(unsigned char *chrData)
     m_objProgram->release();
 }
 
+/**
+ * Grey levels frame of m_intCols x m_intRows bytes uploaded as is in a single channel texture
+ * and expanded to grey by the shader. Null data draws the last uploaded frame.
+ */
+void GLShaderTVArray::RenderPixelsGrey(const unsigned char *chrData)
+{
+    QOpenGLFunctions *ptrF;
+    int intNbVertices = 6;
+    QMatrix4x4 objQMatrix;
+
+    GLfloat arrVertices[] =
+    { -1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, -1.0f, -1.0f, -1.0f };
+
+    GLfloat arrTextureCoords[] =
+    { 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f };
+
+    if (!m_blnInitialized)
+    {
+        return;
+    }
+
+    ptrF = QOpenGLContext::currentContext()->functions();
+
+    if (m_objProgramGrey == 0)
+    {
+        m_objProgramGrey = new QOpenGLShaderProgram();
+
+        if (!m_objProgramGrey->addShaderFromSourceCode(QOpenGLShader::Vertex,
+                m_strVertexShaderSourceArray))
+        {
+            qDebug() << "GLShaderArray::RenderPixelsGrey: error in vertex shader: "
+                    << m_objProgramGrey->log();
+        }
+
+        if (!m_objProgramGrey->addShaderFromSourceCode(QOpenGLShader::Fragment,
+                m_strFragmentShaderSourceGrey))
+        {
+            qDebug() << "GLShaderArray::RenderPixelsGrey: error in fragment shader: "
+                    << m_objProgramGrey->log();
+        }
+
+        m_objProgramGrey->bindAttributeLocation("vertex", 0);
+        m_objProgramGrey->bindAttributeLocation("texCoord", 1);
+
+        if (!m_objProgramGrey->link())
+        {
+            qDebug() << "GLShaderArray::RenderPixelsGrey: error linking shader: "
+                    << m_objProgramGrey->log();
+        }
+
+        m_objMatrixLocGrey = m_objProgramGrey->uniformLocation("uMatrix");
+        m_objProgramGrey->bind();
+        m_objProgramGrey->setUniformValue("uTexture", 0);
+        m_objProgramGrey->release();
+
+        ptrF->glGenTextures(1, &m_objTextureGrey);
+    }
+
+    ptrF->glBindTexture(GL_TEXTURE_2D, m_objTextureGrey);
+
+    if (chrData != 0)
+    {
+        ptrF->glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        if (!m_blnTextureGreyAllocated) // (re)allocate texture storage once per geometry change
+        {
+            ptrF->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            ptrF->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            ptrF->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            ptrF->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            ptrF->glTexImage2D(GL_TEXTURE_2D, 0, m_singleChannelFormat, m_intCols, m_intRows, 0,
+                    m_singleChannelFormat, GL_UNSIGNED_BYTE, chrData);
+            m_blnTextureGreyAllocated = true;
+        }
+        else
+        {
+            ptrF->glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, m_intCols, m_intRows,
+                    m_singleChannelFormat, GL_UNSIGNED_BYTE, chrData);
+        }
+
+        ptrF->glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+
+    if (!m_blnTextureGreyAllocated) // nothing uploaded yet
+    {
+        ptrF->glBindTexture(GL_TEXTURE_2D, 0);
+        return;
+    }
+
+    m_objProgramGrey->bind();
+    m_objProgramGrey->setUniformValue(m_objMatrixLocGrey, objQMatrix);
+
+    ptrF->glDisable(GL_BLEND);
+
+    ptrF->glEnableVertexAttribArray(0); // vertex
+    ptrF->glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, arrVertices);
+
+    ptrF->glEnableVertexAttribArray(1); // texture coordinates
+    ptrF->glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, arrTextureCoords);
+
+    ptrF->glDrawArrays(GL_TRIANGLES, 0, intNbVertices);
+
+    //cleanup
+    ptrF->glDisableVertexAttribArray(0);
+    ptrF->glDisableVertexAttribArray(1);
+
+    ptrF->glBindTexture(GL_TEXTURE_2D, 0);
+    m_objProgramGrey->release();
+}
+
+void GLShaderTVArray::RenderPixelsYUV(unsigned char *planes[3], int linesizes[3])
+{
+    QOpenGLFunctions *ptrF;
+    int intNbVertices = 6;
+    QMatrix4x4 objQMatrix;
+
+    GLfloat arrVertices[] =
+    { -1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, -1.0f, -1.0f, -1.0f };
+
+    GLfloat arrTextureCoords[] =
+    { 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f };
+
+    if (!m_blnInitialized)
+    {
+        return;
+    }
+
+    ptrF = QOpenGLContext::currentContext()->functions();
+
+    if (m_objProgramYUV == 0)
+    {
+        m_objProgramYUV = new QOpenGLShaderProgram();
+
+        if (!m_objProgramYUV->addShaderFromSourceCode(QOpenGLShader::Vertex,
+                m_strVertexShaderSourceArray))
+        {
+            qDebug() << "GLShaderArray::RenderPixelsYUV: error in vertex shader: "
+                    << m_objProgramYUV->log();
+        }
+
+        if (!m_objProgramYUV->addShaderFromSourceCode(QOpenGLShader::Fragment,
+                m_strFragmentShaderSourceYUV))
+        {
+            qDebug() << "GLShaderArray::RenderPixelsYUV: error in fragment shader: "
+                    << m_objProgramYUV->log();
+        }
+
+        m_objProgramYUV->bindAttributeLocation("vertex", 0);
+        m_objProgramYUV->bindAttributeLocation("texCoord", 1);
+
+        if (!m_objProgramYUV->link())
+        {
+            qDebug() << "GLShaderArray::RenderPixelsYUV: error linking shader: "
+                    << m_objProgramYUV->log();
+        }
+
+        m_objMatrixLocYUV = m_objProgramYUV->uniformLocation("uMatrix");
+        m_objScaleLocYUV = m_objProgramYUV->uniformLocation("uScale");
+        m_objProgramYUV->bind();
+        m_objProgramYUV->setUniformValue("uTextureY", 0);
+        m_objProgramYUV->setUniformValue("uTextureU", 1);
+        m_objProgramYUV->setUniformValue("uTextureV", 2);
+        m_objProgramYUV->release();
+
+        ptrF->glGenTextures(3, m_objTexturesYUV);
+    }
+
+    ptrF->glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    for (int i = 0; i < 3; i++)
+    {
+        int intPlaneRows = i == 0 ? m_intRows : (m_intRows + 1) / 2;
+        ptrF->glActiveTexture(GL_TEXTURE0 + i);
+        ptrF->glBindTexture(GL_TEXTURE_2D, m_objTexturesYUV[i]);
+
+        if (planes != 0)
+        {
+            if (linesizes[i] != m_intLinesizesYUV[i]) // (re)allocate texture storage once per geometry change
+            {
+                ptrF->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+                ptrF->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+                ptrF->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+                ptrF->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+                ptrF->glTexImage2D(GL_TEXTURE_2D, 0, m_singleChannelFormat, linesizes[i], intPlaneRows, 0,
+                        m_singleChannelFormat, GL_UNSIGNED_BYTE, planes[i]);
+                m_intLinesizesYUV[i] = linesizes[i];
+            }
+            else
+            {
+                ptrF->glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, linesizes[i], intPlaneRows,
+                        m_singleChannelFormat, GL_UNSIGNED_BYTE, planes[i]);
+            }
+        }
+    }
+
+    if ((m_intLinesizesYUV[0] == 0) || (m_intLinesizesYUV[1] == 0)) // nothing uploaded yet
+    {
+        ptrF->glActiveTexture(GL_TEXTURE0);
+        return;
+    }
+
+    m_objProgramYUV->bind();
+    m_objProgramYUV->setUniformValue(m_objMatrixLocYUV, objQMatrix);
+    m_objProgramYUV->setUniformValue(m_objScaleLocYUV,
+            (GLfloat) m_intCols / m_intLinesizesYUV[0],
+            (GLfloat) ((m_intCols + 1) / 2) / m_intLinesizesYUV[1]);
+
+    ptrF->glDisable(GL_BLEND);
+
+    ptrF->glEnableVertexAttribArray(0); // vertex
+    ptrF->glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, arrVertices);
+
+    ptrF->glEnableVertexAttribArray(1); // texture coordinates
+    ptrF->glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, arrTextureCoords);
+
+    ptrF->glDrawArrays(GL_TRIANGLES, 0, intNbVertices);
+
+    //cleanup
+    ptrF->glDisableVertexAttribArray(0);
+    ptrF->glDisableVertexAttribArray(1);
+
+    ptrF->glActiveTexture(GL_TEXTURE0);
+    m_objProgramYUV->release();
+}
+
 void GLShaderTVArray::ResetPixels()
 {
     if (m_objImage != 0)
@@ -278,6 +570,34 @@ void GLShaderTVArray::Cleanup()
         m_objProgram = 0;
     }
 
+    if (m_objProgramYUV)
+    {
+        if (QOpenGLContext::currentContext()) {
+            QOpenGLContext::currentContext()->functions()->glDeleteTextures(3, m_objTexturesYUV);
+        }
+
+        delete m_objProgramYUV;
+        m_objProgramYUV = 0;
+
+        for (int i = 0; i < 3; i++)
+        {
+            m_objTexturesYUV[i] = 0;
+            m_intLinesizesYUV[i] = 0;
+        }
+    }
+
+    if (m_objProgramGrey)
+    {
+        if (QOpenGLContext::currentContext()) {
+            QOpenGLContext::currentContext()->functions()->glDeleteTextures(1, &m_objTextureGrey);
+        }
+
+        delete m_objProgramGrey;
+        m_objProgramGrey = 0;
+        m_objTextureGrey = 0;
+        m_blnTextureGreyAllocated = false;
+    }
+
     if (m_objTexture != 0)
     {
         delete m_objTexture;
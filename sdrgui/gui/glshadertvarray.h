@@ -49,6 +49,8 @@ public:
     void Cleanup();
     QRgb *GetRowBuffer(int intRow);
     void RenderPixels(unsigned char *chrData);
+    void RenderPixelsYUV(unsigned char *planes[3], int linesizes[3]);
+    void RenderPixelsGrey(const unsigned char *chrData);
     void ResetPixels();
     void ResetPixels(int alpha);
 
@@ -64,6 +66,23 @@ protected:
     //int m_objColorLoc;
     static const QString m_strVertexShaderSourceArray;
     static const QString m_strFragmentShaderSourceColored;
+    static const QString m_strFragmentShaderSourceYUV;
+    static const QString m_strFragmentShaderSourceGrey;
+
+    // Planar YUV 4:2:0 direct rendering: one single channel texture per plane, colour conversion in the shader
+    QOpenGLShaderProgram *m_objProgramYUV;
+    int m_objMatrixLocYUV;
+    int m_objScaleLocYUV;
+    GLuint m_objTexturesYUV[3];
+    int m_intLinesizesYUV[3];
+
+    // Grey levels frames: one byte per pixel in a single channel texture
+    QOpenGLShaderProgram *m_objProgramGrey;
+    int m_objMatrixLocGrey;
+    GLuint m_objTextureGrey;
+    bool m_blnTextureGreyAllocated;
+
+    GLenum m_singleChannelFormat; //!< of the YUV and grey textures: GL_RED or GL_LUMINANCE where there is no GL_RED
 
     QImage *m_objImage=NULL;
     QOpenGLTexture *m_objTexture=NULL;
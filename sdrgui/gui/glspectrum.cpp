@@ -51,15 +51,9 @@ GLSpectrum::GLSpectrum(QWidget* parent) :
 	m_displayMaxHold(false),
 	m_currentSpectrum(0),
 	m_displayCurrent(false),
-	m_waterfallBuffer(0),
-	m_waterfallBufferPos(0),
-    m_waterfallTextureHeight(-1),
-    m_waterfallTexturePos(0),
     m_displayWaterfall(true),
     m_ssbSpectrum(false),
     m_lsbDisplay(false),
-    m_histogramBuffer(0),
-    m_histogram(0),
     m_displayHistogram(true),
     m_displayChanged(false),
     m_matrixLoc(0),
@@ -75,61 +69,6 @@ GLSpectrum::GLSpectrum(QWidget* parent) :
 
 	m_waterfallShare = 0.66;
 
-	for(int i = 0; i <= 239; i++) {
-		 QColor c;
-		 c.setHsv(239 - i, 255, 15 + i);
-		 ((quint8*)&m_waterfallPalette[i])[0] = c.red();
-		 ((quint8*)&m_waterfallPalette[i])[1] = c.green();
-		 ((quint8*)&m_waterfallPalette[i])[2] = c.blue();
-		 ((quint8*)&m_waterfallPalette[i])[3] = c.alpha();
-	}
-	m_waterfallPalette[239] = 0xffffffff;
-
-	m_histogramPalette[0] = 0;
-
-	for (int i = 1; i < 240; i++)
-	{
-	    QColor c;
-	    int light = i < 60 ? 128 + (60-i) : 128;
-	    int sat   = i < 60 ? 140 + i : i < 180 ? 200 : 200 - (i-180);
-	    c.setHsl(239 - i, sat, light);
-        ((quint8*)&m_histogramPalette[i])[0] = c.red();
-        ((quint8*)&m_histogramPalette[i])[1] = c.green();
-        ((quint8*)&m_histogramPalette[i])[2] = c.blue();
-        ((quint8*)&m_histogramPalette[i])[3] = c.alpha();
-	}
-
-	// 4.2.3 palette
-//    for (int i = 1; i < 240; i++)
-//    {
-//        QColor c;
-//        int val = i < 60 ? 255 : 200;
-//        int sat = i < 60 ? 128 : i < 180 ? 255 : 180;
-//        c.setHsv(239 - i, sat, val);
-//        ((quint8*)&m_histogramPalette[i])[0] = c.red();
-//        ((quint8*)&m_histogramPalette[i])[1] = c.green();
-//        ((quint8*)&m_histogramPalette[i])[2] = c.blue();
-//        ((quint8*)&m_histogramPalette[i])[3] = c.alpha();
-//    }
-
-    // Original palette:
-//	for(int i = 16; i < 240; i++) {
-//		 QColor c;
-//		 c.setHsv(239 - i, 255 - ((i < 200) ? 0 : (i - 200) * 3), 150 + ((i < 100) ? i : 100));
-//		 ((quint8*)&m_histogramPalette[i])[0] = c.red();
-//		 ((quint8*)&m_histogramPalette[i])[1] = c.green();
-//		 ((quint8*)&m_histogramPalette[i])[2] = c.blue();
-//		 ((quint8*)&m_histogramPalette[i])[3] = c.alpha();
-//	}
-//	for(int i = 1; i < 16; i++) {
-//		QColor c;
-//		c.setHsv(255, 128, 48 + i * 4);
-//		((quint8*)&m_histogramPalette[i])[0] = c.red();
-//		((quint8*)&m_histogramPalette[i])[1] = c.green();
-//		((quint8*)&m_histogramPalette[i])[2] = c.blue();
-//		((quint8*)&m_histogramPalette[i])[3] = c.alpha();
-//	}
-
 	m_decayDivisor = 1;
 	m_decayDivisorCount = m_decayDivisor;
 	m_histogramStroke = 30;
@@ -153,19 +92,6 @@ GLSpectrum::~GLSpectrum()
 	QMutexLocker mutexLocker(&m_mutex);
 
 	m_changesPending = true;
-
-	if(m_waterfallBuffer != NULL) {
-		delete m_waterfallBuffer;
-		m_waterfallBuffer = NULL;
-	}
-	if(m_histogramBuffer != NULL) {
-		delete m_histogramBuffer;
-		m_histogramBuffer = NULL;
-	}
-	if(m_histogram != NULL) {
-		delete[] m_histogram;
-		m_histogram = NULL;
-	}
 }
 
 void GLSpectrum::setCenterFrequency(qint64 frequency)
@@ -353,33 +279,12 @@ void GLSpectrum::newSpectrum(const std::vector<Real>& spectrum, int fftSize)
 		return;
 	}
 
-	updateWaterfall(spectrum);
-	updateHistogram(spectrum);
+	updateSpectrogram(spectrum);
 }
 
-void GLSpectrum::updateWaterfall(const std::vector<Real>& spectrum)
+void GLSpectrum::updateSpectrogram(const std::vector<Real>& spectrum)
 {
-	if(m_waterfallBufferPos < m_waterfallBuffer->height()) {
-		quint32* pix = (quint32*)m_waterfallBuffer->scanLine(m_waterfallBufferPos);
-
-		for(int i = 0; i < m_fftSize; i++) {
-			int v = (int)((spectrum[i] - m_referenceLevel) * 2.4 * 100.0 / m_powerRange + 240.0);
-			if(v > 239)
-				v = 239;
-			else if(v < 0)
-				v = 0;
-
-			*pix++ = m_waterfallPalette[(int)v];
-		}
-
-		m_waterfallBufferPos++;
-	}
-}
-
-void GLSpectrum::updateHistogram(const std::vector<Real>& spectrum)
-{
-	quint8* b = m_histogram;
-	int fftMulSize = 100 * m_fftSize;
+	int decay = 0;
 
 	if ((m_displayHistogram || m_displayMaxHold) && (m_decay != 0))
 	{
@@ -387,106 +292,13 @@ void GLSpectrum::updateHistogram(const std::vector<Real>& spectrum)
 
 		if ((m_decay > 1) || (m_decayDivisorCount <= 0))
 		{
-			for (int i = 0; i < fftMulSize; i++)
-			{
-				if (*b > m_decay) {
-					*b = *b - m_decay;
-				} else {
-				    *b = 0;
-				}
-
-				b++;
-			}
-
+			decay = m_decay;
 			m_decayDivisorCount = m_decayDivisor;
 		}
 	}
 
 	m_currentSpectrum = &spectrum; // Store spectrum for current spectrum line display
-
-#if 0 //def USE_SSE2
-    if(m_decay >= 0) { // normal
-        const __m128 refl = {m_referenceLevel, m_referenceLevel, m_referenceLevel, m_referenceLevel};
-        const __m128 power = {m_powerRange, m_powerRange, m_powerRange, m_powerRange};
-        const __m128 mul = {100.0f, 100.0f, 100.0f, 100.0f};
-
-        for(int i = 0; i < m_fftSize; i += 4) {
-            __m128 abc = _mm_loadu_ps (&spectrum[i]);
-            abc = _mm_sub_ps(abc, refl);
-            abc = _mm_mul_ps(abc, mul);
-            abc = _mm_div_ps(abc, power);
-            abc =  _mm_add_ps(abc, mul);
-            __m128i result = _mm_cvtps_epi32(abc);
-
-            for(int j = 0; j < 4; j++) {
-                int v = ((int*)&result)[j];
-                if((v >= 0) && (v <= 99)) {
-                    b = m_histogram + (i + j) * 100 + v;
-                    if(*b < 220)
-                        *b += m_histogramStroke; // was 4
-                    else if(*b < 239)
-                        *b += 1;
-                }
-            }
-        }
-    } else { // draw double pixels
-        int add = -m_decay * 4;
-        const __m128 refl = {m_referenceLevel, m_referenceLevel, m_referenceLevel, m_referenceLevel};
-        const __m128 power = {m_powerRange, m_powerRange, m_powerRange, m_powerRange};
-        const __m128 mul = {100.0f, 100.0f, 100.0f, 100.0f};
-
-        for(int i = 0; i < m_fftSize; i += 4) {
-            __m128 abc = _mm_loadu_ps (&spectrum[i]);
-            abc = _mm_sub_ps(abc, refl);
-            abc = _mm_mul_ps(abc, mul);
-            abc = _mm_div_ps(abc, power);
-            abc =  _mm_add_ps(abc, mul);
-            __m128i result = _mm_cvtps_epi32(abc);
-
-            for(int j = 0; j < 4; j++) {
-                int v = ((int*)&result)[j];
-                if((v >= 1) && (v <= 98)) {
-                    b = m_histogram + (i + j) * 100 + v;
-                    if(b[-1] < 220)
-                        b[-1] += add;
-                    else if(b[-1] < 239)
-                        b[-1] += 1;
-                    if(b[0] < 220)
-                        b[0] += add;
-                    else if(b[0] < 239)
-                        b[0] += 1;
-                    if(b[1] < 220)
-                        b[1] += add;
-                    else if(b[1] < 239)
-                        b[1] += 1;
-                } else if((v >= 0) && (v <= 99)) {
-                    b = m_histogram + (i + j) * 100 + v;
-                    if(*b < 220)
-                        *b += add;
-                    else if(*b < 239)
-                        *b += 1;
-                }
-            }
-        }
-    }
-#else
-    for (int i = 0; i < m_fftSize; i++)
-    {
-        int v = (int)((spectrum[i] - m_referenceLevel) * 100.0 / m_powerRange + 100.0);
-
-        if ((v >= 0) && (v <= 99))
-        {
-            b = m_histogram + i * 100 + v;
-
-            // capping to 239 as palette values are [0..239]
-            if (*b + m_histogramStroke <= 239) {
-                *b += m_histogramStroke; // was 4
-            } else {
-                *b = 239;
-            }
-        }
-    }
-#endif
+	m_glShaderSpectrogram.newLine(spectrum, m_referenceLevel, m_powerRange, decay, m_histogramStroke, m_displayHistogram || m_displayMaxHold);
 }
 
 void GLSpectrum::initializeGL()
@@ -517,8 +329,7 @@ void GLSpectrum::initializeGL()
 	m_glShaderSimple.initializeGL();
 	m_glShaderLeftScale.initializeGL();
 	m_glShaderFrequencyScale.initializeGL();
-	m_glShaderWaterfall.initializeGL();
-	m_glShaderHistogram.initializeGL();
+	m_glShaderSpectrogram.initializeGL();
 }
 
 void GLSpectrum::resizeGL(int width, int height)
@@ -533,7 +344,7 @@ void GLSpectrum::clearSpectrumHistogram()
 	if(!m_mutex.tryLock(2))
 		return;
 
-	memset(m_histogram, 0x00, 100 * m_fftSize);
+	m_glShaderSpectrogram.clearHistogram();
 
 	m_mutex.unlock();
 	update();
@@ -556,46 +367,13 @@ void GLSpectrum::paintGL()
 	glFunctions->glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
 	glFunctions->glClear(GL_COLOR_BUFFER_BIT);
 
+	// new lines in the waterfall and histogram
+	m_glShaderSpectrogram.uploadLines();
+
 	// paint waterfall
 	if (m_displayWaterfall)
 	{
-		{
-			GLfloat vtx1[] = {
-					0, m_invertedWaterfall ? 0.0f : 1.0f,
-		    		1, m_invertedWaterfall ? 0.0f : 1.0f,
-		    		1, m_invertedWaterfall ? 1.0f : 0.0f,
-		    		0, m_invertedWaterfall ? 1.0f : 0.0f
-		    };
-
-
-			if (m_waterfallTexturePos + m_waterfallBufferPos < m_waterfallTextureHeight)
-			{
-				m_glShaderWaterfall.subTexture(0, m_waterfallTexturePos, m_fftSize, m_waterfallBufferPos,  m_waterfallBuffer->scanLine(0));
-				m_waterfallTexturePos += m_waterfallBufferPos;
-			}
-			else
-			{
-				int breakLine = m_waterfallTextureHeight - m_waterfallTexturePos;
-				int linesLeft = m_waterfallTexturePos + m_waterfallBufferPos - m_waterfallTextureHeight;
-				m_glShaderWaterfall.subTexture(0, m_waterfallTexturePos, m_fftSize, breakLine,  m_waterfallBuffer->scanLine(0));
-				m_glShaderWaterfall.subTexture(0, 0, m_fftSize, linesLeft,  m_waterfallBuffer->scanLine(breakLine));
-				m_waterfallTexturePos = linesLeft;
-			}
-
-			m_waterfallBufferPos = 0;
-
-			float prop_y = m_waterfallTexturePos / (m_waterfallTextureHeight - 1.0);
-			float off = 1.0 / (m_waterfallTextureHeight - 1.0);
-
-			GLfloat tex1[] = {
-		    		0, prop_y + 1 - off,
-					1, prop_y + 1 - off,
-					1, prop_y,
-					0, prop_y
-		    };
-
-			m_glShaderWaterfall.drawSurface(m_glWaterfallBoxMatrix, tex1, vtx1, 4);
-		}
+		m_glShaderSpectrogram.drawWaterfall(m_glWaterfallBoxMatrix, m_invertedWaterfall, m_referenceLevel, m_powerRange);
 
 		// paint channels
 		if (m_mouseInside)
@@ -645,42 +423,7 @@ void GLSpectrum::paintGL()
 	{
 		if(m_displayHistogram)
 		{
-			{
-				// import new lines into the texture
-				quint32* pix;
-				quint8* bs = m_histogram;
-
-				for (int y = 0; y < 100; y++)
-				{
-					quint8* b = bs;
-					pix = (quint32*)m_histogramBuffer->scanLine(99 - y);
-
-					for (int x = 0; x < m_fftSize; x++)
-					{
-						*pix = m_histogramPalette[*b];
-						pix++;
-						b += 100;
-					}
-
-					bs++;
-				}
-
-				GLfloat vtx1[] = {
-						0, 0,
-			    		1, 0,
-			    		1, 1,
-			    		0, 1
-			    };
-				GLfloat tex1[] = {
-						0, 0,
-			    		1, 0,
-			    		1, 1,
-			    		0, 1
-			    };
-
-				m_glShaderHistogram.subTexture(0, 0, m_fftSize, 100,  m_histogramBuffer->scanLine(0));
-				m_glShaderHistogram.drawSurface(m_glHistogramBoxMatrix, tex1, vtx1, 4);
-			}
+			m_glShaderSpectrogram.drawHistogram(m_glHistogramBoxMatrix);
 		}
 
 
@@ -811,26 +554,7 @@ void GLSpectrum::paintGL()
 	// paint max hold lines on top of histogram
 	if (m_displayMaxHold)
 	{
-		if (m_maxHold.size() < (uint) m_fftSize) {
-		    m_maxHold.resize(m_fftSize);
-		}
-
-		for (int i = 0; i < m_fftSize; i++)
-		{
-			int j;
-			quint8* bs = m_histogram + i * 100;
-
-			for (j = 99; j >= 0; j--)
-			{
-				if (bs[j] > 0) {
-				    break;
-				}
-			}
-
-			// m_referenceLevel : top
-			// m_referenceLevel - m_powerRange : bottom
-			m_maxHold[i] = ((j - 99) * m_powerRange) / 99.0 + m_referenceLevel;
-		}
+		m_glShaderSpectrogram.getMaxHold(m_maxHold, m_referenceLevel, m_powerRange);
 		{
 		    GLfloat *q3 = m_q3FFT.m_array;
 
@@ -1545,55 +1269,13 @@ void GLSpectrum::applyChanges()
 		m_glShaderFrequencyScale.initTexture(m_frequencyPixmap.toImage());
 	}
 
-	bool fftSizeChanged = true;
-
-	if(m_waterfallBuffer != NULL) {
-		fftSizeChanged = m_waterfallBuffer->width() != m_fftSize;
-	}
-
-	bool windowSizeChanged = m_waterfallTextureHeight != waterfallHeight;
-
-	if (fftSizeChanged || windowSizeChanged)
-	{
-		if(m_waterfallBuffer != 0) {
-			delete m_waterfallBuffer;
-		}
-
-		m_waterfallBuffer = new QImage(m_fftSize, waterfallHeight, QImage::Format_ARGB32);
-
-        m_waterfallBuffer->fill(qRgb(0x00, 0x00, 0x00));
-        m_glShaderWaterfall.initTexture(*m_waterfallBuffer);
-        m_waterfallBufferPos = 0;
-	}
-
-	if(fftSizeChanged)
-	{
-		if(m_histogramBuffer != NULL) {
-			delete m_histogramBuffer;
-			m_histogramBuffer = NULL;
-		}
-		if(m_histogram != NULL) {
-			delete[] m_histogram;
-			m_histogram = NULL;
-		}
-
-		m_histogramBuffer = new QImage(m_fftSize, 100, QImage::Format_RGB32);
-
-        m_histogramBuffer->fill(qRgb(0x00, 0x00, 0x00));
-        m_glShaderHistogram.initTexture(*m_histogramBuffer, QOpenGLTexture::ClampToEdge);
-
-		m_histogram = new quint8[100 * m_fftSize];
-		memset(m_histogram, 0x00, 100 * m_fftSize);
+	bool fftSizeChanged = m_glShaderSpectrogram.getFFTSize() != m_fftSize;
+	m_glShaderSpectrogram.resize(m_fftSize, waterfallHeight);
 
+	if(fftSizeChanged) {
 		m_q3FFT.allocate(2*m_fftSize);
 	}
 
-	if(fftSizeChanged || windowSizeChanged)
-	{
-		m_waterfallTextureHeight = waterfallHeight;
-		m_waterfallTexturePos = 0;
-	}
-
 	m_q3TickTime.allocate(4*m_timeScale.getTickList().count());
     m_q3TickFrequency.allocate(4*m_frequencyScale.getTickList().count());
     m_q3TickPower.allocate(4*m_powerScale.getTickList().count());
@@ -1799,8 +1481,7 @@ void GLSpectrum::cleanup()
 	//makeCurrent();
 	m_glShaderSimple.cleanup();
 	m_glShaderFrequencyScale.cleanup();
-	m_glShaderHistogram.cleanup();
+	m_glShaderSpectrogram.cleanup();
 	m_glShaderLeftScale.cleanup();
-	m_glShaderWaterfall.cleanup();
     //doneCurrent();
 }
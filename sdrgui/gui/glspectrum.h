@@ -31,6 +31,7 @@
 #include "gui/scaleengine.h"
 #include "gui/glshadersimple.h"
 #include "gui/glshadertextured.h"
+#include "gui/glshaderspectrogram.h"
 #include "dsp/channelmarker.h"
 #include "export.h"
 #include "util/incrementalarray.h"
@@ -159,19 +160,11 @@ private:
 	QMatrix4x4 m_glFrequencyScaleBoxMatrix;
 	QMatrix4x4 m_glLeftScaleBoxMatrix;
 
-	QRgb m_waterfallPalette[240];
-	QImage* m_waterfallBuffer;
-	int m_waterfallBufferPos;
-	int m_waterfallTextureHeight;
-	int m_waterfallTexturePos;
 	QMatrix4x4 m_glWaterfallBoxMatrix;
 	bool m_displayWaterfall;
 	bool m_ssbSpectrum;
 	bool m_lsbDisplay;
 
-	QRgb m_histogramPalette[240];
-	QImage* m_histogramBuffer;
-	quint8* m_histogram; //!< Spectrum phosphor matrix of FFT width and PSD height scaled to 100. values [0..239]
 	int m_decayDivisor;
 	int m_decayDivisorCount;
 	int m_histogramStroke;
@@ -184,8 +177,7 @@ private:
 	GLShaderSimple m_glShaderSimple;
 	GLShaderTextured m_glShaderLeftScale;
 	GLShaderTextured m_glShaderFrequencyScale;
-	GLShaderTextured m_glShaderWaterfall;
-	GLShaderTextured m_glShaderHistogram;
+	GLShaderSpectrogram m_glShaderSpectrogram;
 	int m_matrixLoc;
 	int m_colorLoc;
 	IncrementalArray<GLfloat> m_q3TickTime;
@@ -197,8 +189,7 @@ private:
 
 	static const int m_waterfallBufferHeight = 256;
 
-	void updateWaterfall(const std::vector<Real>& spectrum);
-	void updateHistogram(const std::vector<Real>& spectrum);
+	void updateSpectrogram(const std::vector<Real>& spectrum);
 
 	void initializeGL();
 	void resizeGL(int width, int height);
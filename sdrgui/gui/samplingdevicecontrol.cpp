@@ -27,10 +27,13 @@ SamplingDeviceControl::SamplingDeviceControl(int tabIndex, bool rxElseTx, QWidge
     m_pluginManager(0),
     m_deviceTabIndex(tabIndex),
     m_rxElseTx(rxElseTx),
-    m_selectedDeviceIndex(-1)
+    m_selectedDeviceIndex(-1),
+    m_selectedDeviceSequence(0),
+    m_selectedDeviceItemIndex(-1)
 {
     ui->setupUi(this);
     ui->deviceSelectedText->setText("None");
+    connect(DeviceEnumerator::instance(), SIGNAL(devicesChanged()), this, SLOT(devicesChanged()));
 }
 
 SamplingDeviceControl::~SamplingDeviceControl()
@@ -58,6 +61,25 @@ void SamplingDeviceControl::on_deviceReload_clicked()
     }
 }
 
+void SamplingDeviceControl::devicesChanged()
+{
+    if (m_selectedDeviceIndex < 0) {
+        return;
+    }
+
+    // The claim follows the device in the new enumeration, only its index may have changed
+    if (m_rxElseTx) {
+        m_selectedDeviceIndex = DeviceEnumerator::instance()->getRxSamplingDeviceIndex(
+                m_selectedDeviceId, m_selectedDeviceSerial, m_selectedDeviceSequence, m_selectedDeviceItemIndex);
+    } else {
+        m_selectedDeviceIndex = DeviceEnumerator::instance()->getTxSamplingDeviceIndex(
+                m_selectedDeviceId, m_selectedDeviceSerial, m_selectedDeviceSequence, m_selectedDeviceItemIndex);
+    }
+
+    qDebug("SamplingDeviceControl::devicesChanged: tab %d: %s device now at index %d",
+            m_deviceTabIndex, qPrintable(m_selectedDeviceId), m_selectedDeviceIndex);
+}
+
 void SamplingDeviceControl::setSelectedDeviceIndex(int index)
 {
     if (m_rxElseTx)
@@ -65,17 +87,27 @@ void SamplingDeviceControl::setSelectedDeviceIndex(int index)
         PluginInterface::SamplingDevice samplingDevice = DeviceEnumerator::instance()->getRxSamplingDevice(index);
         DeviceEnumerator::instance()->changeRxSelection(m_deviceTabIndex, index);
         ui->deviceSelectedText->setText(samplingDevice.displayedName);
+        setSelectedDevice(samplingDevice);
     }
     else
     {
         PluginInterface::SamplingDevice samplingDevice = DeviceEnumerator::instance()->getTxSamplingDevice(index);
         DeviceEnumerator::instance()->changeTxSelection(m_deviceTabIndex, index);
         ui->deviceSelectedText->setText(samplingDevice.displayedName);
+        setSelectedDevice(samplingDevice);
     }
 
     m_selectedDeviceIndex = index;
 }
 
+void SamplingDeviceControl::setSelectedDevice(const PluginInterface::SamplingDevice& samplingDevice)
+{
+    m_selectedDeviceId = samplingDevice.id;
+    m_selectedDeviceSerial = samplingDevice.serial;
+    m_selectedDeviceSequence = samplingDevice.sequence;
+    m_selectedDeviceItemIndex = samplingDevice.deviceItemIndex;
+}
+
 void SamplingDeviceControl::removeSelectedDeviceIndex()
 {
     if (m_rxElseTx)
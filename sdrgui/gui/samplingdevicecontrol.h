@@ -22,6 +22,7 @@
 #include <QComboBox>
 #include <QPushButton>
 
+#include "plugin/plugininterface.h"
 #include "export.h"
 
 namespace Ui {
@@ -51,6 +52,7 @@ public:
 private slots:
     void on_deviceChange_clicked();
     void on_deviceReload_clicked();
+    void devicesChanged();
 
 private:
     Ui::SamplingDeviceControl* ui;
@@ -58,6 +60,12 @@ private:
     int m_deviceTabIndex;
     bool m_rxElseTx;
     int m_selectedDeviceIndex;
+    QString m_selectedDeviceId;     //!< Identity of the selected device to find it again when devices are enumerated again
+    QString m_selectedDeviceSerial;
+    int m_selectedDeviceSequence;
+    int m_selectedDeviceItemIndex;
+
+    void setSelectedDevice(const PluginInterface::SamplingDevice& samplingDevice);
 
 signals:
     void changed();
@@ -31,8 +31,20 @@ SamplingDeviceDialog::SamplingDeviceDialog(bool rxElseTx, int deviceTabIndex, QW
     m_selectedDeviceIndex(-1)
 {
     ui->setupUi(this);
+    displayDevices();
+    connect(DeviceEnumerator::instance(), SIGNAL(devicesChanged()), this, SLOT(devicesChanged()));
+}
+
+SamplingDeviceDialog::~SamplingDeviceDialog()
+{
+    delete ui;
+}
 
+void SamplingDeviceDialog::displayDevices()
+{
     QList<QString> deviceDisplayNames;
+    m_deviceIndexes.clear();
+    ui->deviceSelect->clear();
 
     if (m_rxElseTx) {
         DeviceEnumerator::instance()->listRxDeviceNames(deviceDisplayNames, m_deviceIndexes);
@@ -44,9 +56,16 @@ SamplingDeviceDialog::SamplingDeviceDialog(bool rxElseTx, int deviceTabIndex, QW
     ui->deviceSelect->addItems(devicesNamesList);
 }
 
-SamplingDeviceDialog::~SamplingDeviceDialog()
+void SamplingDeviceDialog::devicesChanged()
 {
-    delete ui;
+    // indexes of the list are those of the previous enumeration
+    QString selectedName = ui->deviceSelect->currentText();
+    displayDevices();
+    int index = ui->deviceSelect->findText(selectedName);
+
+    if (index >= 0) {
+        ui->deviceSelect->setCurrentIndex(index);
+    }
 }
 
 void SamplingDeviceDialog::accept()
@@ -45,8 +45,11 @@ private:
     int m_selectedDeviceIndex;
     std::vector<int> m_deviceIndexes;
 
+    void displayDevices();
+
 private slots:
     void accept();
+    void devicesChanged();
 };
 
 #endif /* SDRGUI_GUI_SAMPLINGDEVICEDIALOG_H_ */
@@ -35,6 +35,12 @@ TVScreen::TVScreen(bool blnColor, QWidget* parent) :
     m_objTimer.start(40); // capped at 25 FPS
 
     m_chrLastData = NULL;
+    m_blnYUV = false;
+    m_blnGrey = false;
+    m_yuvPlanes[0] = m_yuvPlanes[1] = m_yuvPlanes[2] = NULL;
+    m_yuvLinesizes[0] = m_yuvLinesizes[1] = m_yuvLinesizes[2] = 0;
+    m_droppedFrames = 0;
+    m_renderLatencyUs = 0;
     m_blnConfigChanged = false;
     m_blnDataChanged = false;
     m_blnGLContextInitialized = false;
@@ -68,7 +74,67 @@ QRgb* TVScreen::getRowBuffer(int intRow)
 
 void TVScreen::renderImage(unsigned char * objData)
 {
+    QMutexLocker mutexLocker(&m_objMutex);
     m_chrLastData = objData;
+    m_blnYUV = false;
+    m_blnGrey = false;
+    m_blnDataChanged = true;
+}
+
+/**
+ * Hand over a grey levels frame of one byte per pixel. It is copied so the caller can write
+ * the next frame in the same buffer as soon as this returns. Frames that do not match the
+ * current screen size are dropped.
+ */
+void TVScreen::renderGreyImage(const unsigned char *data, int intCols, int intRows)
+{
+    QMutexLocker mutexLocker(&m_objMutex);
+
+    if ((intCols != m_cols) || (intRows != m_rows)) {
+        return;
+    }
+
+    if (m_blnDataChanged) {
+        m_droppedFrames++;
+    }
+
+    m_greyFrame.assign(data, data + intCols * intRows);
+    m_blnYUV = false;
+    m_blnGrey = true;
+    m_handoverTimer.start();
+    m_blnDataChanged = true;
+}
+
+/**
+ * Hand over planar YUV 4:2:0 data that is uploaded as is and converted to RGB by the shader.
+ * Data is not copied. The mutex guarantees that once this returns the previous planes are
+ * no longer in use so the caller can recycle them. Null planes release the last ones.
+ */
+void TVScreen::renderYUVImage(unsigned char *planes[3], int linesizes[3])
+{
+    QMutexLocker mutexLocker(&m_objMutex);
+
+    if (planes[0] == NULL)
+    {
+        m_blnYUV = false;
+        m_chrLastData = NULL;
+        return;
+    }
+
+    m_blnGrey = false;
+
+    if (m_blnDataChanged) {
+        m_droppedFrames++;
+    }
+
+    for (int i = 0; i < 3; i++)
+    {
+        m_yuvPlanes[i] = planes[i];
+        m_yuvLinesizes[i] = linesizes[i];
+    }
+
+    m_blnYUV = true;
+    m_handoverTimer.start();
     m_blnDataChanged = true;
 }
 
@@ -85,6 +151,7 @@ void TVScreen::resetImage(int alpha)
 void TVScreen::resizeTVScreen(int intCols, int intRows)
 {
     qDebug("TVScreen::resizeTVScreen: cols: %d, rows: %d", intCols, intRows);
+    QMutexLocker mutexLocker(&m_objMutex);
     m_intAskedCols = intCols;
     m_intAskedRows = intRows;
     m_cols = intCols;
@@ -120,6 +187,7 @@ void TVScreen::initializeGL()
     else
     {
         qCritical() << "TVScreen::initializeGL: no current context";
+        m_objMutex.unlock();
         return;
     }
 
@@ -128,6 +196,7 @@ void TVScreen::initializeGL()
     if (objSurface == NULL)
     {
         qCritical() << "TVScreen::initializeGL: no surface attached";
+        m_objMutex.unlock();
         return;
     }
     else
@@ -137,6 +206,7 @@ void TVScreen::initializeGL()
             qCritical() << "TVScreen::initializeGL: surface is not an OpenGLSurface: "
                     << objSurface->surfaceType()
                     << " cannot use an OpenGL context";
+            m_objMutex.unlock();
             return;
         }
         else
@@ -166,6 +236,7 @@ void TVScreen::paintGL()
     if (!m_objMutex.tryLock(2))
         return;
 
+    bool blnDataChanged = m_blnDataChanged;
     m_blnDataChanged = false;
 
     if ((m_intAskedCols != 0) && (m_intAskedRows != 0))
@@ -175,7 +246,28 @@ void TVScreen::paintGL()
         m_intAskedRows = 0;
     }
 
-    m_objGLShaderArray.RenderPixels(m_chrLastData);
+    if (m_blnYUV)
+    {
+        m_objGLShaderArray.RenderPixelsYUV(blnDataChanged ? m_yuvPlanes : NULL, m_yuvLinesizes);
+
+        if (blnDataChanged) {
+            m_renderLatencyUs = m_handoverTimer.nsecsElapsed() / 1000;
+        }
+    }
+    else if (m_blnGrey)
+    {
+        // a frame handed over before a resize is not uploaded
+        bool blnUpload = blnDataChanged && (m_greyFrame.size() == (unsigned int) (m_cols * m_rows));
+        m_objGLShaderArray.RenderPixelsGrey(blnUpload ? m_greyFrame.data() : NULL);
+
+        if (blnDataChanged) {
+            m_renderLatencyUs = m_handoverTimer.nsecsElapsed() / 1000;
+        }
+    }
+    else
+    {
+        m_objGLShaderArray.RenderPixels(m_chrLastData);
+    }
 
     m_objMutex.unlock();
 }
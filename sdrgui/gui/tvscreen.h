@@ -25,8 +25,10 @@
 #include <QPen>
 #include <QTimer>
 #include <QMutex>
+#include <QElapsedTimer>
 #include <QFont>
 #include <QMatrix4x4>
+#include <vector>
 #include "dsp/dsptypes.h"
 #include "glshadertextured.h"
 #include "glshadertvarray.h"
@@ -48,6 +50,8 @@ public:
     void resizeTVScreen(int intCols, int intRows);
     void getSize(int& intCols, int& intRows) const;
     void renderImage(unsigned char * objData);
+    void renderYUVImage(unsigned char *planes[3], int linesizes[3]);
+    void renderGreyImage(const unsigned char *data, int intCols, int intRows);
     QRgb* getRowBuffer(int intRow);
     void resetImage();
     void resetImage(int alpha);
@@ -60,6 +64,9 @@ public:
 
     void connectTimer(const QTimer& timer);
 
+    quint32 getDroppedFrames() const { return m_droppedFrames; }
+    qint64 getRenderLatencyUs() const { return m_renderLatencyUs; }
+
     //Valeurs par défaut
     static const int TV_COLS=256;
     static const int TV_ROWS=256;
@@ -93,6 +100,15 @@ private:
 
 	unsigned char *m_chrLastData;
 
+	bool m_blnYUV;                  //!< last image was handed over as YUV 4:2:0 planes
+	unsigned char *m_yuvPlanes[3];  //!< valid until next renderYUVImage call returns
+	int m_yuvLinesizes[3];
+	bool m_blnGrey;                 //!< last image was handed over as a grey levels frame
+	std::vector<unsigned char> m_greyFrame; //!< copy of the last grey levels frame
+	QElapsedTimer m_handoverTimer;  //!< time since last image hand over
+	quint32 m_droppedFrames;        //!< images replaced before they could be painted
+	qint64 m_renderLatencyUs;       //!< hand over to upload completion of last painted image
+
 protected slots:
 	void cleanup();
 	void tick();
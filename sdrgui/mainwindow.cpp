@@ -51,15 +51,21 @@
 #include "gui/mypositiondialog.h"
 #include "dsp/dspengine.h"
 #include "dsp/spectrumvis.h"
+#include "dsp/spectrumscanner.h"
+#include "dsp/activitymonitor.h"
 #include "dsp/dspcommands.h"
 #include "dsp/devicesamplesource.h"
 #include "dsp/devicesamplesink.h"
+#include "dsp/filerecordwriter.h"
 #include "plugin/pluginapi.h"
 #include "gui/glspectrum.h"
+#include "gui/glshaderspectrogram.h"
 #include "gui/glspectrumgui.h"
 #include "loggerwithfile.h"
 #include "webapi/webapirequestmapper.h"
 #include "webapi/webapiserver.h"
+#include "webapi/webapireportstreamer.h"
+#include "webapi/webapireversedispatcher.h"
 #include "webapi/webapiadaptergui.h"
 #include "commands/command.h"
 
@@ -170,7 +176,18 @@ MainWindow::MainWindow(qtwebapp::LoggerWithFile *logger, const MainParser& parse
 
     qDebug() << "MainWindow::MainWindow: load plugins...";
 
+    if (!parser.getLogFilter().isEmpty()) {
+        m_logger->setFilterRules(parser.getLogFilter());
+    }
+
+    WebAPIReverseDispatcher::instance()->setWindowMs(parser.getReverseAPIWindow());
+    WebAPIReverseDispatcher::instance()->setBatch(parser.getReverseAPIBatch());
+    FileRecordWriter::setDefaults(!parser.getRecordBufferedIO(), parser.getRecordRotateSize() * 1048576ULL, parser.getRecordRotateTime());
+    GLShaderSpectrogram::setDefaultGPU(!parser.getSpectrumCPU());
+
     m_pluginManager = new PluginManager(this);
+    m_pluginManager->setAllowList(parser.getPlugins());
+    m_pluginManager->setUseDeviceCache(parser.getDeviceCache());
     m_pluginManager->loadPlugins(QString("plugins"));
 
     qDebug() << "MainWindow::MainWindow: select SampleSource from settings or default (file source) ...";
@@ -207,8 +224,19 @@ MainWindow::MainWindow(qtwebapp::LoggerWithFile *logger, const MainParser& parse
 	m_apiHost = parser.getServerAddress();
 	m_apiPort = parser.getServerPort();
 	m_apiServer = new WebAPIServer(m_apiHost, m_apiPort, m_requestMapper);
+	m_apiServer->setEventThreads(parser.getAPIThreads());
 	m_apiServer->start();
 
+	if (parser.getStreamPort() != 0)
+	{
+		m_reportStreamer = new WebAPIReportStreamer(m_apiHost, parser.getStreamPort(), m_apiAdapter);
+		m_reportStreamer->start();
+	}
+	else
+	{
+		m_reportStreamer = 0;
+	}
+
 	connect(qApp, SIGNAL(focusChanged(QWidget *, QWidget *)), this, SLOT(focusHasChanged(QWidget *, QWidget *)));
 	m_commandKeyReceiver = new CommandKeyReceiver();
 	m_commandKeyReceiver->setRelease(true);
@@ -219,6 +247,7 @@ MainWindow::MainWindow(qtwebapp::LoggerWithFile *logger, const MainParser& parse
 
 MainWindow::~MainWindow()
 {
+    delete m_reportStreamer;
     m_apiServer->stop();
     delete m_apiServer;
     delete m_requestMapper;
@@ -263,6 +292,9 @@ void MainWindow::addSourceDevice(int deviceIndex)
     connect(m_deviceUIs.back()->m_samplingDeviceControl->getAddChannelButton(), SIGNAL(clicked(bool)), this, SLOT(channelAddClicked(bool)));
 
     dspDeviceSourceEngine->addSink(m_deviceUIs.back()->m_spectrumVis);
+    m_deviceUIs.back()->m_spectrumScanner->setEngine(dspDeviceSourceEngine);
+    dspDeviceSourceEngine->addSink(m_deviceUIs.back()->m_spectrumScanner.data());
+    dspDeviceSourceEngine->addSink(m_deviceUIs.back()->m_activityMonitor.data());
     ui->tabSpectra->addTab(m_deviceUIs.back()->m_spectrum, tabNameCStr);
     ui->tabSpectraGUI->addTab(m_deviceUIs.back()->m_spectrumGUI, tabNameCStr);
     ui->tabChannels->addTab(m_deviceUIs.back()->m_channelWindow, tabNameCStr);
@@ -385,7 +417,10 @@ void MainWindow::removeLastDevice()
 	{
 	    DSPDeviceSourceEngine *lastDeviceEngine = m_deviceUIs.back()->m_deviceSourceEngine;
 	    lastDeviceEngine->stopAcquistion();
+	    m_deviceUIs.back()->m_spectrumScanner->setEngine(0); // the scanner may outlive the engine
 	    lastDeviceEngine->removeSink(m_deviceUIs.back()->m_spectrumVis);
+	    lastDeviceEngine->removeSink(m_deviceUIs.back()->m_spectrumScanner.data());
+	    lastDeviceEngine->removeSink(m_deviceUIs.back()->m_activityMonitor.data());
 
 	    ui->tabSpectraGUI->removeTab(ui->tabSpectraGUI->count() - 1);
 	    ui->tabSpectra->removeTab(ui->tabSpectra->count() - 1);
@@ -1496,14 +1531,16 @@ void MainWindow::sampleSourceChanged()
         DeviceUISet *deviceUI = m_deviceUIs[currentSourceTabIndex];
         deviceUI->m_deviceSourceAPI->saveSourceSettings(m_settings.getWorkingPreset()); // save old API settings
         deviceUI->m_deviceSourceAPI->stopAcquisition();
+        deviceUI->m_spectrumScanner->stopScan(false); // the source is deleted
 
         // deletes old UI and input object
-        deviceUI->m_deviceSourceAPI->getSampleSource()->setMessageQueueToGUI(0); // have source stop sending messages to the GUI
+        DeviceSampleSource *oldSource = deviceUI->m_deviceSourceAPI->getSampleSource();
+        oldSource->setMessageQueueToGUI(0); // have source stop sending messages to the GUI
         deviceUI->m_deviceSourceAPI->getPluginInterface()->deleteSampleSourcePluginInstanceGUI(
                 deviceUI->m_deviceSourceAPI->getSampleSourcePluginInstanceGUI());
         deviceUI->m_deviceSourceAPI->resetSampleSourceId();
-        deviceUI->m_deviceSourceAPI->getPluginInterface()->deleteSampleSourcePluginInstanceInput(
-                deviceUI->m_deviceSourceAPI->getSampleSource());
+        deviceUI->m_deviceSourceAPI->setSampleSource(0); // the engine no longer retunes it for the scanner
+        deviceUI->m_deviceSourceAPI->getPluginInterface()->deleteSampleSourcePluginInstanceInput(oldSource);
         deviceUI->m_deviceSourceAPI->clearBuddiesLists(); // clear old API buddies lists
 
         PluginInterface::SamplingDevice samplingDevice = DeviceEnumerator::instance()->getRxSamplingDevice(deviceUI->m_samplingDeviceControl->getSelectedDeviceIndex());
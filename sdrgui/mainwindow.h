@@ -52,6 +52,7 @@ class PluginInterface;
 class QWidget;
 class WebAPIRequestMapper;
 class WebAPIServer;
+class WebAPIReportStreamer;
 class WebAPIAdapterGUI;
 class Preset;
 class Command;
@@ -328,6 +329,7 @@ private:
 
 	WebAPIRequestMapper *m_requestMapper;
 	WebAPIServer *m_apiServer;
+	WebAPIReportStreamer *m_reportStreamer;
 	WebAPIAdapterGUI *m_apiAdapter;
 	QString m_apiHost;
 	int m_apiPort;
@@ -65,6 +65,7 @@ SOURCES += mainwindow.cpp\
         gui/glscope.cpp\
         gui/glscopegui.cpp\
         gui/glshadersimple.cpp\
+        gui/glshaderspectrogram.cpp\
         gui/glshadertextured.cpp\
         gui/glshadertvarray.cpp\
         gui/glspectrum.cpp\
@@ -125,6 +126,7 @@ HEADERS  += mainwindow.h\
         gui/glscope.h\
         gui/glscopegui.h\
         gui/glshadersimple.h\
+        gui/glshaderspectrogram.h\
         gui/glshadertextured.h\
         gui/glshadertvarray.h\
         gui/glspectrum.h\
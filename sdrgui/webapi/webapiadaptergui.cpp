@@ -30,6 +30,9 @@
 #include "dsp/devicesamplesource.h"
 #include "dsp/devicesamplesink.h"
 #include "dsp/dspengine.h"
+#include "dsp/spectrumvis.h"
+#include "dsp/spectrumscanner.h"
+#include "dsp/activitymonitor.h"
 #include "plugin/pluginapi.h"
 #include "plugin/pluginmanager.h"
 #include "channel/channelsinkapi.h"
@@ -285,6 +288,7 @@ int WebAPIAdapterGUI::instanceAudioGet(
     outputDevices->back()->setUdpChannelMode((int) outputDeviceInfo.udpChannelMode);
     *outputDevices->back()->getUdpAddress() = outputDeviceInfo.udpAddress;
     outputDevices->back()->setUdpPort(outputDeviceInfo.udpPort);
+    outputDevices->back()->setLatency(outputDeviceInfo.latency);
 
     // real output devices
     for (int i = 0; i < nbOutputDevices; i++)
@@ -303,6 +307,7 @@ int WebAPIAdapterGUI::instanceAudioGet(
         outputDevices->back()->setUdpChannelMode((int) outputDeviceInfo.udpChannelMode);
         *outputDevices->back()->getUdpAddress() = outputDeviceInfo.udpAddress;
         outputDevices->back()->setUdpPort(outputDeviceInfo.udpPort);
+        outputDevices->back()->setLatency(outputDeviceInfo.latency);
     }
 
     return 200;
@@ -379,6 +384,9 @@ int WebAPIAdapterGUI::instanceAudioOutputPatch(
     if (audioOutputKeys.contains("udpPort")) {
         outputDeviceInfo.udpPort = response.getUdpPort() % (1<<16);
     }
+    if (audioOutputKeys.contains("latency")) {
+        outputDeviceInfo.latency = response.getLatency() < 0 ? 0 : response.getLatency();
+    }
 
     m_mainWindow.m_dspEngine->getAudioDeviceManager()->setOutputDeviceInfo(deviceIndex, outputDeviceInfo);
     m_mainWindow.m_dspEngine->getAudioDeviceManager()->getOutputDeviceInfo(deviceName, outputDeviceInfo);
@@ -395,6 +403,7 @@ int WebAPIAdapterGUI::instanceAudioOutputPatch(
     }
 
     response.setUdpPort(outputDeviceInfo.udpPort % (1<<16));
+    response.setLatency(outputDeviceInfo.latency);
 
     return 200;
 }
@@ -453,6 +462,7 @@ int WebAPIAdapterGUI::instanceAudioOutputDelete(
     }
 
     response.setUdpPort(outputDeviceInfo.udpPort % (1<<16));
+    response.setLatency(outputDeviceInfo.latency);
 
     return 200;
 }
@@ -1245,6 +1255,120 @@ int WebAPIAdapterGUI::devicesetDeviceReportGet(
     }
 }
 
+int WebAPIAdapterGUI::devicesetSpectrumArchive(
+        int deviceSetIndex,
+        QSharedPointer<SpectrumArchive>& archive,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+    archive.clear();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        archive = m_mainWindow.m_deviceUIs[deviceSetIndex]->m_spectrumVis->getArchive();
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetSpectrumScanner(
+        int deviceSetIndex,
+        QSharedPointer<SpectrumScanner>& scanner,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+    scanner.clear();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine) // Rx
+        {
+            scanner = deviceSet->m_spectrumScanner;
+            return 200;
+        }
+        else
+        {
+            *error.getMessage() = QString("Device set at %1 is not a receive device set").arg(deviceSetIndex);
+            return 400;
+        }
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetActivityMonitor(
+        int deviceSetIndex,
+        QSharedPointer<ActivityMonitor>& monitor,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+    monitor.clear();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine) // Rx
+        {
+            monitor = deviceSet->m_activityMonitor;
+            return 200;
+        }
+        else
+        {
+            *error.getMessage() = QString("Device set at %1 is not a receive device set").arg(deviceSetIndex);
+            return 400;
+        }
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetChannelizersHold(
+        int deviceSetIndex,
+        bool hold,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine) // Rx
+        {
+            deviceSet->m_deviceSourceEngine->holdChannelizers(hold);
+            return 200;
+        }
+        else
+        {
+            *error.getMessage() = QString("Device set at %1 is not a receive device set").arg(deviceSetIndex);
+            return 400;
+        }
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+void WebAPIAdapterGUI::instanceProcessMessages()
+{
+    m_mainWindow.handleMessages();
+}
+
 int WebAPIAdapterGUI::devicesetChannelsReportGet(
         int deviceSetIndex,
         SWGSDRangel::SWGChannelsDetail& response,
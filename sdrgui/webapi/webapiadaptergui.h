@@ -190,6 +190,28 @@ public:
             SWGSDRangel::SWGDeviceReport& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int devicesetSpectrumArchive(
+            int deviceSetIndex,
+            QSharedPointer<SpectrumArchive>& archive,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetSpectrumScanner(
+            int deviceSetIndex,
+            QSharedPointer<SpectrumScanner>& scanner,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetActivityMonitor(
+            int deviceSetIndex,
+            QSharedPointer<ActivityMonitor>& monitor,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetChannelizersHold(
+            int deviceSetIndex,
+            bool hold,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual void instanceProcessMessages();
+
     virtual int devicesetChannelsReportGet(
             int deviceSetIndex,
             SWGSDRangel::SWGChannelsDetail& response,
@@ -16,6 +16,8 @@
 
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
+#include "dsp/spectrumscanner.h"
+#include "dsp/activitymonitor.h"
 #include "device/devicesourceapi.h"
 #include "device/devicesinkapi.h"
 #include "plugin/pluginapi.h"
@@ -25,6 +27,8 @@
 #include "channel/channelsourceapi.h"
 #include "settings/preset.h"
 
+#include <QVector>
+
 #include "deviceset.h"
 
 
@@ -152,6 +156,45 @@ void DeviceSet::loadRxChannelSettings(const Preset *preset, PluginAPI *pluginAPI
 
         qDebug("DeviceSet::loadChannelSettings: %d channel(s) in preset", preset->getChannelCount());
 
+        // match preset channels with open channels: identical configurations first then same channel type
+        QList<QByteArray> openConfigs;
+        QVector<int> openIndexes(preset->getChannelCount(), -1);
+        QVector<bool> openUsed(openChannels.count(), false);
+        int nbKept = 0, nbReconfigured = 0, nbCreated = 0;
+
+        for (int j = 0; j < openChannels.count(); j++) {
+            openConfigs.append(openChannels[j].m_channelSinkAPI->serialize());
+        }
+
+        for (int pass = 0; pass < 2; pass++)
+        {
+            for (int i = 0; i < preset->getChannelCount(); i++)
+            {
+                const Preset::ChannelConfig& channelConfig = preset->getChannelConfig(i);
+
+                for (int j = 0; (openIndexes[i] < 0) && (j < openChannels.count()); j++)
+                {
+                    if (!openUsed[j]
+                     && compareRxChannelURIs(openChannels[j].m_channelName, channelConfig.m_channelIdURI)
+                     && ((pass == 1) || (openConfigs[j] == channelConfig.m_config)))
+                    {
+                        openIndexes[i] = j;
+                        openUsed[j] = true;
+                    }
+                }
+            }
+        }
+
+        // everything, that is still "available" is not needed anymore
+        for (int j = 0; j < openChannels.count(); j++)
+        {
+            if (!openUsed[j])
+            {
+                qDebug("DeviceSet::loadChannelSettings: destroying spare channel [%s]", qPrintable(openChannels[j].m_channelName));
+                openChannels[j].m_channelSinkAPI->destroy();
+            }
+        }
+
         for (int i = 0; i < preset->getChannelCount(); i++)
         {
             const Preset::ChannelConfig& channelConfig = preset->getChannelConfig(i);
@@ -159,18 +202,19 @@ void DeviceSet::loadRxChannelSettings(const Preset *preset, PluginAPI *pluginAPI
 
             // if we have one instance available already, use it
 
-            for (int i = 0; i < openChannels.count(); i++)
+            if (openIndexes[i] >= 0)
             {
-                qDebug("DeviceSet::loadChannelSettings: channels compare [%s] vs [%s]", qPrintable(openChannels[i].m_channelName), qPrintable(channelConfig.m_channelIdURI));
+                reg = openChannels[openIndexes[i]];
+                m_rxChannelInstanceRegistrations.append(reg);
 
-                //if(openChannels[i].m_channelName == channelConfig.m_channelIdURI)
-                if (compareRxChannelURIs(openChannels[i].m_channelName, channelConfig.m_channelIdURI))
+                if (openConfigs[openIndexes[i]] == channelConfig.m_config)
                 {
-                    qDebug("DeviceSet::loadChannelSettings: channel [%s] found", qPrintable(openChannels[i].m_channelName));
-                    reg = openChannels.takeAt(i);
-                    m_rxChannelInstanceRegistrations.append(reg);
-                    break;
+                    qDebug("DeviceSet::loadChannelSettings: channel [%s] unchanged", qPrintable(reg.m_channelName));
+                    nbKept++;
+                    continue;
                 }
+
+                nbReconfigured++;
             }
 
             // if we haven't one already, create one
@@ -188,6 +232,7 @@ void DeviceSet::loadRxChannelSettings(const Preset *preset, PluginAPI *pluginAPI
                         ChannelSinkAPI *rxChannel = (*channelRegistrations)[i].m_plugin->createRxChannelCS(m_deviceSourceAPI);
                         reg = ChannelInstanceRegistration(channelConfig.m_channelIdURI, rxChannel);
                         m_rxChannelInstanceRegistrations.append(reg);
+                        nbCreated++;
                         break;
                     }
                 }
@@ -200,13 +245,8 @@ void DeviceSet::loadRxChannelSettings(const Preset *preset, PluginAPI *pluginAPI
             }
         }
 
-        // everything, that is still "available" is not needed anymore
-        for (int i = 0; i < openChannels.count(); i++)
-        {
-            qDebug("DeviceSet::loadChannelSettings: destroying spare channel [%s]", qPrintable(openChannels[i].m_channelName));
-            openChannels[i].m_channelSinkAPI->destroy();
-        }
-
+        qDebug("DeviceSet::loadChannelSettings: %d kept %d reconfigured %d created %d destroyed",
+                nbKept, nbReconfigured, nbCreated, openUsed.count(false));
         renameRxChannelInstances();
     }
     else
@@ -252,57 +292,94 @@ void DeviceSet::loadTxChannelSettings(const Preset *preset, PluginAPI *pluginAPI
 
         qDebug("DeviceSet::loadChannelSettings: %d channel(s) in preset", preset->getChannelCount());
 
-        for(int i = 0; i < preset->getChannelCount(); i++)
+        // match preset channels with open channels: identical configurations first then same channel type
+        QList<QByteArray> openConfigs;
+        QVector<int> openIndexes(preset->getChannelCount(), -1);
+        QVector<bool> openUsed(openChannels.count(), false);
+        int nbKept = 0, nbReconfigured = 0, nbCreated = 0;
+
+        for (int j = 0; j < openChannels.count(); j++) {
+            openConfigs.append(openChannels[j].m_channelSourceAPI->serialize());
+        }
+
+        for (int pass = 0; pass < 2; pass++)
+        {
+            for (int i = 0; i < preset->getChannelCount(); i++)
+            {
+                const Preset::ChannelConfig& channelConfig = preset->getChannelConfig(i);
+
+                for (int j = 0; (openIndexes[i] < 0) && (j < openChannels.count()); j++)
+                {
+                    if (!openUsed[j]
+                     && (openChannels[j].m_channelName == channelConfig.m_channelIdURI)
+                     && ((pass == 1) || (openConfigs[j] == channelConfig.m_config)))
+                    {
+                        openIndexes[i] = j;
+                        openUsed[j] = true;
+                    }
+                }
+            }
+        }
+
+        // everything, that is still "available" is not needed anymore
+        for (int j = 0; j < openChannels.count(); j++)
+        {
+            if (!openUsed[j])
+            {
+                qDebug("DeviceSet::loadChannelSettings: destroying spare channel [%s]", qPrintable(openChannels[j].m_channelName));
+                openChannels[j].m_channelSourceAPI->destroy();
+            }
+        }
+
+        for (int i = 0; i < preset->getChannelCount(); i++)
         {
             const Preset::ChannelConfig& channelConfig = preset->getChannelConfig(i);
             ChannelInstanceRegistration reg;
 
             // if we have one instance available already, use it
 
-            for(int i = 0; i < openChannels.count(); i++)
+            if (openIndexes[i] >= 0)
             {
-                qDebug("DeviceSet::loadChannelSettings: channels compare [%s] vs [%s]", qPrintable(openChannels[i].m_channelName), qPrintable(channelConfig.m_channelIdURI));
+                reg = openChannels[openIndexes[i]];
+                m_txChannelInstanceRegistrations.append(reg);
 
-                if(openChannels[i].m_channelName == channelConfig.m_channelIdURI)
+                if (openConfigs[openIndexes[i]] == channelConfig.m_config)
                 {
-                    qDebug("DeviceSet::loadChannelSettings: channel [%s] found", qPrintable(openChannels[i].m_channelName));
-                    reg = openChannels.takeAt(i);
-                    m_txChannelInstanceRegistrations.append(reg);
-                    break;
+                    qDebug("DeviceSet::loadChannelSettings: channel [%s] unchanged", qPrintable(reg.m_channelName));
+                    nbKept++;
+                    continue;
                 }
+
+                nbReconfigured++;
             }
 
             // if we haven't one already, create one
 
-            if(reg.m_channelSourceAPI == 0)
+            if (reg.m_channelSourceAPI == 0)
             {
-                for(int i = 0; i < channelRegistrations->count(); i++)
+                for (int i = 0; i < channelRegistrations->count(); i++)
                 {
-                    if((*channelRegistrations)[i].m_channelIdURI == channelConfig.m_channelIdURI)
+                    if ((*channelRegistrations)[i].m_channelIdURI == channelConfig.m_channelIdURI)
                     {
                         qDebug("DeviceSet::loadChannelSettings: creating new channel [%s]", qPrintable(channelConfig.m_channelIdURI));
                         ChannelSourceAPI *txChannel = (*channelRegistrations)[i].m_plugin->createTxChannelCS(m_deviceSinkAPI);
                         reg = ChannelInstanceRegistration(channelConfig.m_channelIdURI, txChannel);
                         m_txChannelInstanceRegistrations.append(reg);
+                        nbCreated++;
                         break;
                     }
                 }
             }
 
-            if(reg.m_channelSourceAPI != 0)
+            if (reg.m_channelSourceAPI != 0)
             {
                 qDebug("DeviceSet::loadChannelSettings: deserializing channel [%s]", qPrintable(channelConfig.m_channelIdURI));
                 reg.m_channelSourceAPI->deserialize(channelConfig.m_config);
             }
         }
 
-        // everything, that is still "available" is not needed anymore
-        for(int i = 0; i < openChannels.count(); i++)
-        {
-            qDebug("DeviceSet::loadChannelSettings: destroying spare channel [%s]", qPrintable(openChannels[i].m_channelName));
-            openChannels[i].m_channelSourceAPI->destroy();
-        }
-
+        qDebug("DeviceSet::loadChannelSettings: %d kept %d reconfigured %d created %d destroyed",
+                nbKept, nbReconfigured, nbCreated, openUsed.count(false));
         renameTxChannelInstances();
     }
 }
@@ -18,8 +18,11 @@
 #define SDRSRV_DEVICE_DEVICESET_H_
 
 #include <QTimer>
+#include <QSharedPointer>
 
 class DSPDeviceSourceEngine;
+class SpectrumScanner;
+class ActivityMonitor;
 class DeviceSourceAPI;
 class DSPDeviceSinkEngine;
 class DeviceSinkAPI;
@@ -35,6 +38,8 @@ public:
     DeviceSourceAPI *m_deviceSourceAPI;
     DSPDeviceSinkEngine *m_deviceSinkEngine;
     DeviceSinkAPI *m_deviceSinkAPI;
+    QSharedPointer<SpectrumScanner> m_spectrumScanner; //!< sink of the source engine (Rx only). Shared with the web API requests in progress
+    QSharedPointer<ActivityMonitor> m_activityMonitor; //!< sink of the source engine (Rx only). Shared with the web API requests in progress
 
     DeviceSet(int tabIndex);
     ~DeviceSet();
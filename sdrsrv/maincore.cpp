@@ -25,6 +25,9 @@
 #include "dsp/dspengine.h"
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
+#include "dsp/spectrumscanner.h"
+#include "dsp/activitymonitor.h"
+#include "dsp/filerecordwriter.h"
 #include "device/devicesourceapi.h"
 #include "device/devicesinkapi.h"
 #include "device/deviceset.h"
@@ -33,6 +36,8 @@
 #include "loggerwithfile.h"
 #include "webapi/webapirequestmapper.h"
 #include "webapi/webapiserver.h"
+#include "webapi/webapireportstreamer.h"
+#include "webapi/webapireversedispatcher.h"
 #include "webapi/webapiadaptersrv.h"
 
 #include "maincore.h"
@@ -62,7 +67,17 @@ MainCore::MainCore(qtwebapp::LoggerWithFile *logger, const MainParser& parser, Q
     m_instance = this;
     m_settings.setAudioDeviceManager(m_dspEngine->getAudioDeviceManager());
 
+    if (!parser.getLogFilter().isEmpty()) {
+        m_logger->setFilterRules(parser.getLogFilter());
+    }
+
+    WebAPIReverseDispatcher::instance()->setWindowMs(parser.getReverseAPIWindow());
+    WebAPIReverseDispatcher::instance()->setBatch(parser.getReverseAPIBatch());
+    FileRecordWriter::setDefaults(!parser.getRecordBufferedIO(), parser.getRecordRotateSize() * 1048576ULL, parser.getRecordRotateTime());
+
     m_pluginManager = new PluginManager(this);
+    m_pluginManager->setAllowList(parser.getPlugins());
+    m_pluginManager->setUseDeviceCache(parser.getDeviceCache());
     m_pluginManager->loadPlugins(QString("pluginssrv"));
 
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleMessages()), Qt::QueuedConnection);
@@ -82,13 +97,26 @@ MainCore::MainCore(qtwebapp::LoggerWithFile *logger, const MainParser& parser, Q
     m_requestMapper = new WebAPIRequestMapper(this);
     m_requestMapper->setAdapter(m_apiAdapter);
     m_apiServer = new WebAPIServer(parser.getServerAddress(), parser.getServerPort(), m_requestMapper);
+    m_apiServer->setEventThreads(parser.getAPIThreads());
     m_apiServer->start();
 
+    if (parser.getStreamPort() != 0)
+    {
+        m_reportStreamer = new WebAPIReportStreamer(parser.getServerAddress(), parser.getStreamPort(), m_apiAdapter);
+        m_reportStreamer->start();
+    }
+    else
+    {
+        m_reportStreamer = 0;
+    }
+
     qDebug() << "MainCore::MainCore: end";
 }
 
 MainCore::~MainCore()
 {
+    delete m_reportStreamer;
+
     while (m_deviceSets.size() > 0) {
         removeLastDevice();
     }
@@ -314,6 +342,11 @@ void MainCore::addSourceDevice()
     int deviceTabIndex = m_deviceSets.size();
     m_deviceSets.push_back(new DeviceSet(deviceTabIndex));
     m_deviceSets.back()->m_deviceSourceEngine = dspDeviceSourceEngine;
+    m_deviceSets.back()->m_spectrumScanner = QSharedPointer<SpectrumScanner>(new SpectrumScanner());
+    m_deviceSets.back()->m_spectrumScanner->setEngine(dspDeviceSourceEngine);
+    dspDeviceSourceEngine->addSink(m_deviceSets.back()->m_spectrumScanner.data());
+    m_deviceSets.back()->m_activityMonitor = QSharedPointer<ActivityMonitor>(new ActivityMonitor());
+    dspDeviceSourceEngine->addSink(m_deviceSets.back()->m_activityMonitor.data());
 
     char tabNameCStr[16];
     sprintf(tabNameCStr, "R%d", deviceTabIndex);
@@ -345,6 +378,9 @@ void MainCore::removeLastDevice()
     {
         DSPDeviceSourceEngine *lastDeviceEngine = m_deviceSets.back()->m_deviceSourceEngine;
         lastDeviceEngine->stopAcquistion();
+        m_deviceSets.back()->m_spectrumScanner->setEngine(0); // the scanner may outlive the engine
+        lastDeviceEngine->removeSink(m_deviceSets.back()->m_spectrumScanner.data());
+        lastDeviceEngine->removeSink(m_deviceSets.back()->m_activityMonitor.data());
 
         // deletes old UI and input object
         m_deviceSets.back()->freeRxChannels();      // destroys the channel instances
@@ -393,11 +429,13 @@ void MainCore::changeSampleSource(int deviceSetIndex, int selectedDeviceIndex)
         DeviceSet *deviceSet = m_deviceSets[deviceSetIndex];
         deviceSet->m_deviceSourceAPI->saveSourceSettings(m_settings.getWorkingPreset()); // save old API settings
         deviceSet->m_deviceSourceAPI->stopAcquisition();
+        deviceSet->m_spectrumScanner->stopScan(false); // the source is deleted
 
         // deletes old UI and input object
+        DeviceSampleSource *oldSource = deviceSet->m_deviceSourceAPI->getSampleSource();
         deviceSet->m_deviceSourceAPI->resetSampleSourceId();
-        deviceSet->m_deviceSourceAPI->getPluginInterface()->deleteSampleSourcePluginInstanceInput(
-                deviceSet->m_deviceSourceAPI->getSampleSource());
+        deviceSet->m_deviceSourceAPI->setSampleSource(0); // the engine no longer retunes it for the scanner
+        deviceSet->m_deviceSourceAPI->getPluginInterface()->deleteSampleSourcePluginInstanceInput(oldSource);
         deviceSet->m_deviceSourceAPI->clearBuddiesLists(); // clear old API buddies lists
 
         PluginInterface::SamplingDevice samplingDevice = DeviceEnumerator::instance()->getRxSamplingDevice(selectedDeviceIndex);
@@ -40,6 +40,7 @@ class ChannelMarker;
 class DeviceSet;
 class WebAPIRequestMapper;
 class WebAPIServer;
+class WebAPIReportStreamer;
 class WebAPIAdapterSrv;
 
 namespace qtwebapp {
@@ -284,6 +285,7 @@ private:
 
     WebAPIRequestMapper *m_requestMapper;
     WebAPIServer *m_apiServer;
+    WebAPIReportStreamer *m_reportStreamer;
     WebAPIAdapterSrv *m_apiAdapter;
 
 	void loadSettings();
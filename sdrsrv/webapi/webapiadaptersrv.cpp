@@ -52,6 +52,8 @@
 #include "dsp/devicesamplesink.h"
 #include "dsp/devicesamplesource.h"
 #include "dsp/dspengine.h"
+#include "dsp/spectrumscanner.h"
+#include "dsp/activitymonitor.h"
 #include "channel/channelsourceapi.h"
 #include "channel/channelsinkapi.h"
 #include "plugin/pluginapi.h"
@@ -281,6 +283,7 @@ int WebAPIAdapterSrv::instanceAudioGet(
     outputDevices->back()->setUdpChannelMode((int) outputDeviceInfo.udpChannelMode);
     *outputDevices->back()->getUdpAddress() = outputDeviceInfo.udpAddress;
     outputDevices->back()->setUdpPort(outputDeviceInfo.udpPort);
+    outputDevices->back()->setLatency(outputDeviceInfo.latency);
 
     // real output devices
     for (int i = 0; i < nbOutputDevices; i++)
@@ -299,6 +302,7 @@ int WebAPIAdapterSrv::instanceAudioGet(
         outputDevices->back()->setUdpChannelMode((int) outputDeviceInfo.udpChannelMode);
         *outputDevices->back()->getUdpAddress() = outputDeviceInfo.udpAddress;
         outputDevices->back()->setUdpPort(outputDeviceInfo.udpPort);
+        outputDevices->back()->setLatency(outputDeviceInfo.latency);
     }
 
     return 200;
@@ -375,6 +379,9 @@ int WebAPIAdapterSrv::instanceAudioOutputPatch(
     if (audioOutputKeys.contains("udpPort")) {
         outputDeviceInfo.udpPort = response.getUdpPort() % (1<<16);
     }
+    if (audioOutputKeys.contains("latency")) {
+        outputDeviceInfo.latency = response.getLatency() < 0 ? 0 : response.getLatency();
+    }
 
     m_mainCore.m_dspEngine->getAudioDeviceManager()->setOutputDeviceInfo(deviceIndex, outputDeviceInfo);
     m_mainCore.m_dspEngine->getAudioDeviceManager()->getOutputDeviceInfo(deviceName, outputDeviceInfo);
@@ -391,6 +398,7 @@ int WebAPIAdapterSrv::instanceAudioOutputPatch(
     }
 
     response.setUdpPort(outputDeviceInfo.udpPort % (1<<16));
+    response.setLatency(outputDeviceInfo.latency);
 
     return 200;
 }
@@ -449,6 +457,7 @@ int WebAPIAdapterSrv::instanceAudioOutputDelete(
     }
 
     response.setUdpPort(outputDeviceInfo.udpPort % (1<<16));
+    response.setLatency(outputDeviceInfo.latency);
 
     return 200;
 }
@@ -1336,6 +1345,100 @@ int WebAPIAdapterSrv::devicesetDeviceReportGet(
     }
 }
 
+int WebAPIAdapterSrv::devicesetSpectrumScanner(
+        int deviceSetIndex,
+        QSharedPointer<SpectrumScanner>& scanner,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+    scanner.clear();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine) // Rx
+        {
+            scanner = deviceSet->m_spectrumScanner;
+            return 200;
+        }
+        else
+        {
+            *error.getMessage() = QString("Device set at %1 is not a receive device set").arg(deviceSetIndex);
+            return 400;
+        }
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetActivityMonitor(
+        int deviceSetIndex,
+        QSharedPointer<ActivityMonitor>& monitor,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+    monitor.clear();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine) // Rx
+        {
+            monitor = deviceSet->m_activityMonitor;
+            return 200;
+        }
+        else
+        {
+            *error.getMessage() = QString("Device set at %1 is not a receive device set").arg(deviceSetIndex);
+            return 400;
+        }
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetChannelizersHold(
+        int deviceSetIndex,
+        bool hold,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine) // Rx
+        {
+            deviceSet->m_deviceSourceEngine->holdChannelizers(hold);
+            return 200;
+        }
+        else
+        {
+            *error.getMessage() = QString("Device set at %1 is not a receive device set").arg(deviceSetIndex);
+            return 400;
+        }
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+void WebAPIAdapterSrv::instanceProcessMessages()
+{
+    m_mainCore.handleMessages();
+}
+
 int WebAPIAdapterSrv::devicesetChannelsReportGet(
         int deviceSetIndex,
         SWGSDRangel::SWGChannelsDetail& response,
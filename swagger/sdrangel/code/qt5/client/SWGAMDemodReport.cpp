@@ -36,6 +36,8 @@ SWGAMDemodReport::SWGAMDemodReport() {
     m_audio_sample_rate_isSet = false;
     channel_sample_rate = 0;
     m_channel_sample_rate_isSet = false;
+    audio_latency = 0.0f;
+    m_audio_latency_isSet = false;
 }
 
 SWGAMDemodReport::~SWGAMDemodReport() {
@@ -52,6 +54,8 @@ SWGAMDemodReport::init() {
     m_audio_sample_rate_isSet = false;
     channel_sample_rate = 0;
     m_channel_sample_rate_isSet = false;
+    audio_latency = 0.0f;
+    m_audio_latency_isSet = false;
 }
 
 void
@@ -60,6 +64,7 @@ SWGAMDemodReport::cleanup() {
 
 
 
+
 }
 
 SWGAMDemodReport*
@@ -81,6 +86,8 @@ SWGAMDemodReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&channel_sample_rate, pJson["channelSampleRate"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&audio_latency, pJson["audioLatency"], "float", "");
+    
 }
 
 QString
@@ -109,6 +116,9 @@ SWGAMDemodReport::asJsonObject() {
     if(m_channel_sample_rate_isSet){
         obj->insert("channelSampleRate", QJsonValue(channel_sample_rate));
     }
+    if(m_audio_latency_isSet){
+        obj->insert("audioLatency", QJsonValue(audio_latency));
+    }
 
     return obj;
 }
@@ -153,6 +163,16 @@ SWGAMDemodReport::setChannelSampleRate(qint32 channel_sample_rate) {
     this->m_channel_sample_rate_isSet = true;
 }
 
+float
+SWGAMDemodReport::getAudioLatency() {
+    return audio_latency;
+}
+void
+SWGAMDemodReport::setAudioLatency(float audio_latency) {
+    this->audio_latency = audio_latency;
+    this->m_audio_latency_isSet = true;
+}
+
 
 bool
 SWGAMDemodReport::isSet(){
@@ -162,6 +182,7 @@ SWGAMDemodReport::isSet(){
         if(m_squelch_isSet){ isObjectUpdated = true; break;}
         if(m_audio_sample_rate_isSet){ isObjectUpdated = true; break;}
         if(m_channel_sample_rate_isSet){ isObjectUpdated = true; break;}
+        if(m_audio_latency_isSet){ isObjectUpdated = true; break;}
     }while(false);
     return isObjectUpdated;
 }
@@ -0,0 +1,190 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGActivityChannel.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGActivityChannel::SWGActivityChannel(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGActivityChannel::SWGActivityChannel() {
+    channel = 0;
+    m_channel_isSet = false;
+    frequency = 0L;
+    m_frequency_isSet = false;
+    active = 0;
+    m_active_isSet = false;
+    power = 0.0f;
+    m_power_isSet = false;
+    since = 0L;
+    m_since_isSet = false;
+}
+
+SWGActivityChannel::~SWGActivityChannel() {
+    this->cleanup();
+}
+
+void
+SWGActivityChannel::init() {
+    channel = 0;
+    m_channel_isSet = false;
+    frequency = 0L;
+    m_frequency_isSet = false;
+    active = 0;
+    m_active_isSet = false;
+    power = 0.0f;
+    m_power_isSet = false;
+    since = 0L;
+    m_since_isSet = false;
+}
+
+void
+SWGActivityChannel::cleanup() {
+
+
+
+
+
+}
+
+SWGActivityChannel*
+SWGActivityChannel::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGActivityChannel::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&channel, pJson["channel"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&frequency, pJson["frequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&active, pJson["active"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&power, pJson["power"], "float", "");
+    
+    ::SWGSDRangel::setValue(&since, pJson["since"], "qint64", "");
+    
+}
+
+QString
+SWGActivityChannel::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGActivityChannel::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_channel_isSet){
+        obj->insert("channel", QJsonValue(channel));
+    }
+    if(m_frequency_isSet){
+        obj->insert("frequency", QJsonValue(frequency));
+    }
+    if(m_active_isSet){
+        obj->insert("active", QJsonValue(active));
+    }
+    if(m_power_isSet){
+        obj->insert("power", QJsonValue(power));
+    }
+    if(m_since_isSet){
+        obj->insert("since", QJsonValue(since));
+    }
+
+    return obj;
+}
+
+qint32
+SWGActivityChannel::getChannel() {
+    return channel;
+}
+void
+SWGActivityChannel::setChannel(qint32 channel) {
+    this->channel = channel;
+    this->m_channel_isSet = true;
+}
+
+qint64
+SWGActivityChannel::getFrequency() {
+    return frequency;
+}
+void
+SWGActivityChannel::setFrequency(qint64 frequency) {
+    this->frequency = frequency;
+    this->m_frequency_isSet = true;
+}
+
+qint32
+SWGActivityChannel::getActive() {
+    return active;
+}
+void
+SWGActivityChannel::setActive(qint32 active) {
+    this->active = active;
+    this->m_active_isSet = true;
+}
+
+float
+SWGActivityChannel::getPower() {
+    return power;
+}
+void
+SWGActivityChannel::setPower(float power) {
+    this->power = power;
+    this->m_power_isSet = true;
+}
+
+qint64
+SWGActivityChannel::getSince() {
+    return since;
+}
+void
+SWGActivityChannel::setSince(qint64 since) {
+    this->since = since;
+    this->m_since_isSet = true;
+}
+
+
+bool
+SWGActivityChannel::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_channel_isSet){ isObjectUpdated = true; break;}
+        if(m_frequency_isSet){ isObjectUpdated = true; break;}
+        if(m_active_isSet){ isObjectUpdated = true; break;}
+        if(m_power_isSet){ isObjectUpdated = true; break;}
+        if(m_since_isSet){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
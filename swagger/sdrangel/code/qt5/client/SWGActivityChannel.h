@@ -0,0 +1,82 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGActivityChannel.h
+ *
+ * State of a monitored channel
+ */
+
+#ifndef SWGActivityChannel_H_
+#define SWGActivityChannel_H_
+
+#include <QJsonObject>
+
+
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGActivityChannel: public SWGObject {
+public:
+    SWGActivityChannel();
+    SWGActivityChannel(QString* json);
+    virtual ~SWGActivityChannel();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGActivityChannel* fromJson(QString &jsonString) override;
+
+    qint32 getChannel();
+    void setChannel(qint32 channel);
+
+    qint64 getFrequency();
+    void setFrequency(qint64 frequency);
+
+    qint32 getActive();
+    void setActive(qint32 active);
+
+    float getPower();
+    void setPower(float power);
+
+    qint64 getSince();
+    void setSince(qint64 since);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 channel;
+    bool m_channel_isSet;
+
+    qint64 frequency;
+    bool m_frequency_isSet;
+
+    qint32 active;
+    bool m_active_isSet;
+
+    float power;
+    bool m_power_isSet;
+
+    qint64 since;
+    bool m_since_isSet;
+
+};
+
+}
+
+#endif /* SWGActivityChannel_H_ */
@@ -0,0 +1,133 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGActivityChannels.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGActivityChannels::SWGActivityChannels(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGActivityChannels::SWGActivityChannels() {
+    nb_channels = 0;
+    m_nb_channels_isSet = false;
+    channels = nullptr;
+    m_channels_isSet = false;
+}
+
+SWGActivityChannels::~SWGActivityChannels() {
+    this->cleanup();
+}
+
+void
+SWGActivityChannels::init() {
+    nb_channels = 0;
+    m_nb_channels_isSet = false;
+    channels = new QList<SWGActivityChannel*>();
+    m_channels_isSet = false;
+}
+
+void
+SWGActivityChannels::cleanup() {
+
+    if(channels != nullptr) { 
+        auto arr = channels;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete channels;
+    }
+}
+
+SWGActivityChannels*
+SWGActivityChannels::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGActivityChannels::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&nb_channels, pJson["nbChannels"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&channels, pJson["channels"], "QList", "SWGActivityChannel");
+}
+
+QString
+SWGActivityChannels::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGActivityChannels::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_nb_channels_isSet){
+        obj->insert("nbChannels", QJsonValue(nb_channels));
+    }
+    if(channels->size() > 0){
+        toJsonArray((QList<void*>*)channels, obj, "channels", "SWGActivityChannel");
+    }
+
+    return obj;
+}
+
+qint32
+SWGActivityChannels::getNbChannels() {
+    return nb_channels;
+}
+void
+SWGActivityChannels::setNbChannels(qint32 nb_channels) {
+    this->nb_channels = nb_channels;
+    this->m_nb_channels_isSet = true;
+}
+
+QList<SWGActivityChannel*>*
+SWGActivityChannels::getChannels() {
+    return channels;
+}
+void
+SWGActivityChannels::setChannels(QList<SWGActivityChannel*>* channels) {
+    this->channels = channels;
+    this->m_channels_isSet = true;
+}
+
+
+bool
+SWGActivityChannels::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_nb_channels_isSet){ isObjectUpdated = true; break;}
+        if(channels->size() > 0){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
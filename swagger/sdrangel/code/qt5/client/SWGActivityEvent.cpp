@@ -0,0 +1,255 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGActivityEvent.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGActivityEvent::SWGActivityEvent(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGActivityEvent::SWGActivityEvent() {
+    sequence = 0L;
+    m_sequence_isSet = false;
+    type = nullptr;
+    m_type_isSet = false;
+    timestamp = 0L;
+    m_timestamp_isSet = false;
+    channel = 0;
+    m_channel_isSet = false;
+    frequency = 0L;
+    m_frequency_isSet = false;
+    power = 0.0f;
+    m_power_isSet = false;
+    noise_floor = 0.0f;
+    m_noise_floor_isSet = false;
+    duration = 0L;
+    m_duration_isSet = false;
+}
+
+SWGActivityEvent::~SWGActivityEvent() {
+    this->cleanup();
+}
+
+void
+SWGActivityEvent::init() {
+    sequence = 0L;
+    m_sequence_isSet = false;
+    type = new QString("");
+    m_type_isSet = false;
+    timestamp = 0L;
+    m_timestamp_isSet = false;
+    channel = 0;
+    m_channel_isSet = false;
+    frequency = 0L;
+    m_frequency_isSet = false;
+    power = 0.0f;
+    m_power_isSet = false;
+    noise_floor = 0.0f;
+    m_noise_floor_isSet = false;
+    duration = 0L;
+    m_duration_isSet = false;
+}
+
+void
+SWGActivityEvent::cleanup() {
+
+    if(type != nullptr) { 
+        delete type;
+    }
+
+
+
+
+
+
+}
+
+SWGActivityEvent*
+SWGActivityEvent::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGActivityEvent::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&sequence, pJson["sequence"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&type, pJson["type"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&timestamp, pJson["timestamp"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&channel, pJson["channel"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&frequency, pJson["frequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&power, pJson["power"], "float", "");
+    
+    ::SWGSDRangel::setValue(&noise_floor, pJson["noiseFloor"], "float", "");
+    
+    ::SWGSDRangel::setValue(&duration, pJson["duration"], "qint64", "");
+    
+}
+
+QString
+SWGActivityEvent::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGActivityEvent::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_sequence_isSet){
+        obj->insert("sequence", QJsonValue(sequence));
+    }
+    if(type != nullptr && *type != QString("")){
+        toJsonValue(QString("type"), type, obj, QString("QString"));
+    }
+    if(m_timestamp_isSet){
+        obj->insert("timestamp", QJsonValue(timestamp));
+    }
+    if(m_channel_isSet){
+        obj->insert("channel", QJsonValue(channel));
+    }
+    if(m_frequency_isSet){
+        obj->insert("frequency", QJsonValue(frequency));
+    }
+    if(m_power_isSet){
+        obj->insert("power", QJsonValue(power));
+    }
+    if(m_noise_floor_isSet){
+        obj->insert("noiseFloor", QJsonValue(noise_floor));
+    }
+    if(m_duration_isSet){
+        obj->insert("duration", QJsonValue(duration));
+    }
+
+    return obj;
+}
+
+qint64
+SWGActivityEvent::getSequence() {
+    return sequence;
+}
+void
+SWGActivityEvent::setSequence(qint64 sequence) {
+    this->sequence = sequence;
+    this->m_sequence_isSet = true;
+}
+
+QString*
+SWGActivityEvent::getType() {
+    return type;
+}
+void
+SWGActivityEvent::setType(QString* type) {
+    this->type = type;
+    this->m_type_isSet = true;
+}
+
+qint64
+SWGActivityEvent::getTimestamp() {
+    return timestamp;
+}
+void
+SWGActivityEvent::setTimestamp(qint64 timestamp) {
+    this->timestamp = timestamp;
+    this->m_timestamp_isSet = true;
+}
+
+qint32
+SWGActivityEvent::getChannel() {
+    return channel;
+}
+void
+SWGActivityEvent::setChannel(qint32 channel) {
+    this->channel = channel;
+    this->m_channel_isSet = true;
+}
+
+qint64
+SWGActivityEvent::getFrequency() {
+    return frequency;
+}
+void
+SWGActivityEvent::setFrequency(qint64 frequency) {
+    this->frequency = frequency;
+    this->m_frequency_isSet = true;
+}
+
+float
+SWGActivityEvent::getPower() {
+    return power;
+}
+void
+SWGActivityEvent::setPower(float power) {
+    this->power = power;
+    this->m_power_isSet = true;
+}
+
+float
+SWGActivityEvent::getNoiseFloor() {
+    return noise_floor;
+}
+void
+SWGActivityEvent::setNoiseFloor(float noise_floor) {
+    this->noise_floor = noise_floor;
+    this->m_noise_floor_isSet = true;
+}
+
+qint64
+SWGActivityEvent::getDuration() {
+    return duration;
+}
+void
+SWGActivityEvent::setDuration(qint64 duration) {
+    this->duration = duration;
+    this->m_duration_isSet = true;
+}
+
+
+bool
+SWGActivityEvent::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_sequence_isSet){ isObjectUpdated = true; break;}
+        if(type != nullptr && *type != QString("")){ isObjectUpdated = true; break;}
+        if(m_timestamp_isSet){ isObjectUpdated = true; break;}
+        if(m_channel_isSet){ isObjectUpdated = true; break;}
+        if(m_frequency_isSet){ isObjectUpdated = true; break;}
+        if(m_power_isSet){ isObjectUpdated = true; break;}
+        if(m_noise_floor_isSet){ isObjectUpdated = true; break;}
+        if(m_duration_isSet){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,101 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGActivityEvent.h
+ *
+ * Start or stop of the activity of a channel
+ */
+
+#ifndef SWGActivityEvent_H_
+#define SWGActivityEvent_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGActivityEvent: public SWGObject {
+public:
+    SWGActivityEvent();
+    SWGActivityEvent(QString* json);
+    virtual ~SWGActivityEvent();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGActivityEvent* fromJson(QString &jsonString) override;
+
+    qint64 getSequence();
+    void setSequence(qint64 sequence);
+
+    QString* getType();
+    void setType(QString* type);
+
+    qint64 getTimestamp();
+    void setTimestamp(qint64 timestamp);
+
+    qint32 getChannel();
+    void setChannel(qint32 channel);
+
+    qint64 getFrequency();
+    void setFrequency(qint64 frequency);
+
+    float getPower();
+    void setPower(float power);
+
+    float getNoiseFloor();
+    void setNoiseFloor(float noise_floor);
+
+    qint64 getDuration();
+    void setDuration(qint64 duration);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint64 sequence;
+    bool m_sequence_isSet;
+
+    QString* type;
+    bool m_type_isSet;
+
+    qint64 timestamp;
+    bool m_timestamp_isSet;
+
+    qint32 channel;
+    bool m_channel_isSet;
+
+    qint64 frequency;
+    bool m_frequency_isSet;
+
+    float power;
+    bool m_power_isSet;
+
+    float noise_floor;
+    bool m_noise_floor_isSet;
+
+    qint64 duration;
+    bool m_duration_isSet;
+
+};
+
+}
+
+#endif /* SWGActivityEvent_H_ */
@@ -0,0 +1,196 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGActivityEvents.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGActivityEvents::SWGActivityEvents(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGActivityEvents::SWGActivityEvents() {
+    since = 0L;
+    m_since_isSet = false;
+    next = 0L;
+    m_next_isSet = false;
+    pending = 0;
+    m_pending_isSet = false;
+    lost = 0;
+    m_lost_isSet = false;
+    events = nullptr;
+    m_events_isSet = false;
+}
+
+SWGActivityEvents::~SWGActivityEvents() {
+    this->cleanup();
+}
+
+void
+SWGActivityEvents::init() {
+    since = 0L;
+    m_since_isSet = false;
+    next = 0L;
+    m_next_isSet = false;
+    pending = 0;
+    m_pending_isSet = false;
+    lost = 0;
+    m_lost_isSet = false;
+    events = new QList<SWGActivityEvent*>();
+    m_events_isSet = false;
+}
+
+void
+SWGActivityEvents::cleanup() {
+
+
+
+
+    if(events != nullptr) { 
+        auto arr = events;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete events;
+    }
+}
+
+SWGActivityEvents*
+SWGActivityEvents::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGActivityEvents::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&since, pJson["since"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&next, pJson["next"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&pending, pJson["pending"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&lost, pJson["lost"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&events, pJson["events"], "QList", "SWGActivityEvent");
+}
+
+QString
+SWGActivityEvents::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGActivityEvents::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_since_isSet){
+        obj->insert("since", QJsonValue(since));
+    }
+    if(m_next_isSet){
+        obj->insert("next", QJsonValue(next));
+    }
+    if(m_pending_isSet){
+        obj->insert("pending", QJsonValue(pending));
+    }
+    if(m_lost_isSet){
+        obj->insert("lost", QJsonValue(lost));
+    }
+    if(events->size() > 0){
+        toJsonArray((QList<void*>*)events, obj, "events", "SWGActivityEvent");
+    }
+
+    return obj;
+}
+
+qint64
+SWGActivityEvents::getSince() {
+    return since;
+}
+void
+SWGActivityEvents::setSince(qint64 since) {
+    this->since = since;
+    this->m_since_isSet = true;
+}
+
+qint64
+SWGActivityEvents::getNext() {
+    return next;
+}
+void
+SWGActivityEvents::setNext(qint64 next) {
+    this->next = next;
+    this->m_next_isSet = true;
+}
+
+qint32
+SWGActivityEvents::getPending() {
+    return pending;
+}
+void
+SWGActivityEvents::setPending(qint32 pending) {
+    this->pending = pending;
+    this->m_pending_isSet = true;
+}
+
+qint32
+SWGActivityEvents::getLost() {
+    return lost;
+}
+void
+SWGActivityEvents::setLost(qint32 lost) {
+    this->lost = lost;
+    this->m_lost_isSet = true;
+}
+
+QList<SWGActivityEvent*>*
+SWGActivityEvents::getEvents() {
+    return events;
+}
+void
+SWGActivityEvents::setEvents(QList<SWGActivityEvent*>* events) {
+    this->events = events;
+    this->m_events_isSet = true;
+}
+
+
+bool
+SWGActivityEvents::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_since_isSet){ isObjectUpdated = true; break;}
+        if(m_next_isSet){ isObjectUpdated = true; break;}
+        if(m_pending_isSet){ isObjectUpdated = true; break;}
+        if(m_lost_isSet){ isObjectUpdated = true; break;}
+        if(events->size() > 0){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,253 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGActivityMonitorReport.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGActivityMonitorReport::SWGActivityMonitorReport(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGActivityMonitorReport::SWGActivityMonitorReport() {
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    center_frequency = 0L;
+    m_center_frequency_isSet = false;
+    nb_slots = 0;
+    m_nb_slots_isSet = false;
+    nb_active = 0;
+    m_nb_active_isSet = false;
+    noise_floor = 0.0f;
+    m_noise_floor_isSet = false;
+    nb_detections = 0L;
+    m_nb_detections_isSet = false;
+    detection_time = 0.0f;
+    m_detection_time_isSet = false;
+    load = 0.0f;
+    m_load_isSet = false;
+}
+
+SWGActivityMonitorReport::~SWGActivityMonitorReport() {
+    this->cleanup();
+}
+
+void
+SWGActivityMonitorReport::init() {
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    center_frequency = 0L;
+    m_center_frequency_isSet = false;
+    nb_slots = 0;
+    m_nb_slots_isSet = false;
+    nb_active = 0;
+    m_nb_active_isSet = false;
+    noise_floor = 0.0f;
+    m_noise_floor_isSet = false;
+    nb_detections = 0L;
+    m_nb_detections_isSet = false;
+    detection_time = 0.0f;
+    m_detection_time_isSet = false;
+    load = 0.0f;
+    m_load_isSet = false;
+}
+
+void
+SWGActivityMonitorReport::cleanup() {
+
+
+
+
+
+
+
+
+}
+
+SWGActivityMonitorReport*
+SWGActivityMonitorReport::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGActivityMonitorReport::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&sample_rate, pJson["sampleRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&center_frequency, pJson["centerFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&nb_slots, pJson["nbSlots"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nb_active, pJson["nbActive"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&noise_floor, pJson["noiseFloor"], "float", "");
+    
+    ::SWGSDRangel::setValue(&nb_detections, pJson["nbDetections"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&detection_time, pJson["detectionTime"], "float", "");
+    
+    ::SWGSDRangel::setValue(&load, pJson["load"], "float", "");
+    
+}
+
+QString
+SWGActivityMonitorReport::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGActivityMonitorReport::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_sample_rate_isSet){
+        obj->insert("sampleRate", QJsonValue(sample_rate));
+    }
+    if(m_center_frequency_isSet){
+        obj->insert("centerFrequency", QJsonValue(center_frequency));
+    }
+    if(m_nb_slots_isSet){
+        obj->insert("nbSlots", QJsonValue(nb_slots));
+    }
+    if(m_nb_active_isSet){
+        obj->insert("nbActive", QJsonValue(nb_active));
+    }
+    if(m_noise_floor_isSet){
+        obj->insert("noiseFloor", QJsonValue(noise_floor));
+    }
+    if(m_nb_detections_isSet){
+        obj->insert("nbDetections", QJsonValue(nb_detections));
+    }
+    if(m_detection_time_isSet){
+        obj->insert("detectionTime", QJsonValue(detection_time));
+    }
+    if(m_load_isSet){
+        obj->insert("load", QJsonValue(load));
+    }
+
+    return obj;
+}
+
+qint32
+SWGActivityMonitorReport::getSampleRate() {
+    return sample_rate;
+}
+void
+SWGActivityMonitorReport::setSampleRate(qint32 sample_rate) {
+    this->sample_rate = sample_rate;
+    this->m_sample_rate_isSet = true;
+}
+
+qint64
+SWGActivityMonitorReport::getCenterFrequency() {
+    return center_frequency;
+}
+void
+SWGActivityMonitorReport::setCenterFrequency(qint64 center_frequency) {
+    this->center_frequency = center_frequency;
+    this->m_center_frequency_isSet = true;
+}
+
+qint32
+SWGActivityMonitorReport::getNbSlots() {
+    return nb_slots;
+}
+void
+SWGActivityMonitorReport::setNbSlots(qint32 nb_slots) {
+    this->nb_slots = nb_slots;
+    this->m_nb_slots_isSet = true;
+}
+
+qint32
+SWGActivityMonitorReport::getNbActive() {
+    return nb_active;
+}
+void
+SWGActivityMonitorReport::setNbActive(qint32 nb_active) {
+    this->nb_active = nb_active;
+    this->m_nb_active_isSet = true;
+}
+
+float
+SWGActivityMonitorReport::getNoiseFloor() {
+    return noise_floor;
+}
+void
+SWGActivityMonitorReport::setNoiseFloor(float noise_floor) {
+    this->noise_floor = noise_floor;
+    this->m_noise_floor_isSet = true;
+}
+
+qint64
+SWGActivityMonitorReport::getNbDetections() {
+    return nb_detections;
+}
+void
+SWGActivityMonitorReport::setNbDetections(qint64 nb_detections) {
+    this->nb_detections = nb_detections;
+    this->m_nb_detections_isSet = true;
+}
+
+float
+SWGActivityMonitorReport::getDetectionTime() {
+    return detection_time;
+}
+void
+SWGActivityMonitorReport::setDetectionTime(float detection_time) {
+    this->detection_time = detection_time;
+    this->m_detection_time_isSet = true;
+}
+
+float
+SWGActivityMonitorReport::getLoad() {
+    return load;
+}
+void
+SWGActivityMonitorReport::setLoad(float load) {
+    this->load = load;
+    this->m_load_isSet = true;
+}
+
+
+bool
+SWGActivityMonitorReport::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_sample_rate_isSet){ isObjectUpdated = true; break;}
+        if(m_center_frequency_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_slots_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_active_isSet){ isObjectUpdated = true; break;}
+        if(m_noise_floor_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_detections_isSet){ isObjectUpdated = true; break;}
+        if(m_detection_time_isSet){ isObjectUpdated = true; break;}
+        if(m_load_isSet){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,100 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGActivityMonitorReport.h
+ *
+ * Channel activity monitor state
+ */
+
+#ifndef SWGActivityMonitorReport_H_
+#define SWGActivityMonitorReport_H_
+
+#include <QJsonObject>
+
+
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGActivityMonitorReport: public SWGObject {
+public:
+    SWGActivityMonitorReport();
+    SWGActivityMonitorReport(QString* json);
+    virtual ~SWGActivityMonitorReport();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGActivityMonitorReport* fromJson(QString &jsonString) override;
+
+    qint32 getSampleRate();
+    void setSampleRate(qint32 sample_rate);
+
+    qint64 getCenterFrequency();
+    void setCenterFrequency(qint64 center_frequency);
+
+    qint32 getNbSlots();
+    void setNbSlots(qint32 nb_slots);
+
+    qint32 getNbActive();
+    void setNbActive(qint32 nb_active);
+
+    float getNoiseFloor();
+    void setNoiseFloor(float noise_floor);
+
+    qint64 getNbDetections();
+    void setNbDetections(qint64 nb_detections);
+
+    float getDetectionTime();
+    void setDetectionTime(float detection_time);
+
+    float getLoad();
+    void setLoad(float load);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 sample_rate;
+    bool m_sample_rate_isSet;
+
+    qint64 center_frequency;
+    bool m_center_frequency_isSet;
+
+    qint32 nb_slots;
+    bool m_nb_slots_isSet;
+
+    qint32 nb_active;
+    bool m_nb_active_isSet;
+
+    float noise_floor;
+    bool m_noise_floor_isSet;
+
+    qint64 nb_detections;
+    bool m_nb_detections_isSet;
+
+    float detection_time;
+    bool m_detection_time_isSet;
+
+    float load;
+    bool m_load_isSet;
+
+};
+
+}
+
+#endif /* SWGActivityMonitorReport_H_ */
@@ -0,0 +1,124 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGActivityMonitorSettings.h
+ *
+ * Channel activity monitor settings
+ */
+
+#ifndef SWGActivityMonitorSettings_H_
+#define SWGActivityMonitorSettings_H_
+
+#include <QJsonObject>
+
+
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGActivityMonitorSettings: public SWGObject {
+public:
+    SWGActivityMonitorSettings();
+    SWGActivityMonitorSettings(QString* json);
+    virtual ~SWGActivityMonitorSettings();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGActivityMonitorSettings* fromJson(QString &jsonString) override;
+
+    qint64 getRasterOrigin();
+    void setRasterOrigin(qint64 raster_origin);
+
+    qint32 getChannelSpacing();
+    void setChannelSpacing(qint32 channel_spacing);
+
+    qint32 getChannelBandwidth();
+    void setChannelBandwidth(qint32 channel_bandwidth);
+
+    qint32 getNbChannels();
+    void setNbChannels(qint32 nb_channels);
+
+    float getUsableBandwidth();
+    void setUsableBandwidth(float usable_bandwidth);
+
+    qint32 getFftSize();
+    void setFftSize(qint32 fft_size);
+
+    qint32 getAverages();
+    void setAverages(qint32 averages);
+
+    float getThreshold();
+    void setThreshold(float threshold);
+
+    float getHysteresis();
+    void setHysteresis(float hysteresis);
+
+    qint32 getAttackTime();
+    void setAttackTime(qint32 attack_time);
+
+    qint32 getHoldTime();
+    void setHoldTime(qint32 hold_time);
+
+    qint32 getWindow();
+    void setWindow(qint32 window);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint64 raster_origin;
+    bool m_raster_origin_isSet;
+
+    qint32 channel_spacing;
+    bool m_channel_spacing_isSet;
+
+    qint32 channel_bandwidth;
+    bool m_channel_bandwidth_isSet;
+
+    qint32 nb_channels;
+    bool m_nb_channels_isSet;
+
+    float usable_bandwidth;
+    bool m_usable_bandwidth_isSet;
+
+    qint32 fft_size;
+    bool m_fft_size_isSet;
+
+    qint32 averages;
+    bool m_averages_isSet;
+
+    float threshold;
+    bool m_threshold_isSet;
+
+    float hysteresis;
+    bool m_hysteresis_isSet;
+
+    qint32 attack_time;
+    bool m_attack_time_isSet;
+
+    qint32 hold_time;
+    bool m_hold_time_isSet;
+
+    qint32 window;
+    bool m_window_isSet;
+
+};
+
+}
+
+#endif /* SWGActivityMonitorSettings_H_ */
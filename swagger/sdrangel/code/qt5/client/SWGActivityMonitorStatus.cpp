@@ -0,0 +1,381 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGActivityMonitorStatus.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGActivityMonitorStatus::SWGActivityMonitorStatus(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGActivityMonitorStatus::SWGActivityMonitorStatus() {
+    monitoring = 0;
+    m_monitoring_isSet = false;
+    raster_origin = 0L;
+    m_raster_origin_isSet = false;
+    channel_spacing = 0;
+    m_channel_spacing_isSet = false;
+    channel_bandwidth = 0;
+    m_channel_bandwidth_isSet = false;
+    nb_channels = 0;
+    m_nb_channels_isSet = false;
+    usable_bandwidth = 0.0f;
+    m_usable_bandwidth_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    averages = 0;
+    m_averages_isSet = false;
+    threshold = 0.0f;
+    m_threshold_isSet = false;
+    hysteresis = 0.0f;
+    m_hysteresis_isSet = false;
+    attack_time = 0;
+    m_attack_time_isSet = false;
+    hold_time = 0;
+    m_hold_time_isSet = false;
+    window = 0;
+    m_window_isSet = false;
+    report = nullptr;
+    m_report_isSet = false;
+}
+
+SWGActivityMonitorStatus::~SWGActivityMonitorStatus() {
+    this->cleanup();
+}
+
+void
+SWGActivityMonitorStatus::init() {
+    monitoring = 0;
+    m_monitoring_isSet = false;
+    raster_origin = 0L;
+    m_raster_origin_isSet = false;
+    channel_spacing = 0;
+    m_channel_spacing_isSet = false;
+    channel_bandwidth = 0;
+    m_channel_bandwidth_isSet = false;
+    nb_channels = 0;
+    m_nb_channels_isSet = false;
+    usable_bandwidth = 0.0f;
+    m_usable_bandwidth_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    averages = 0;
+    m_averages_isSet = false;
+    threshold = 0.0f;
+    m_threshold_isSet = false;
+    hysteresis = 0.0f;
+    m_hysteresis_isSet = false;
+    attack_time = 0;
+    m_attack_time_isSet = false;
+    hold_time = 0;
+    m_hold_time_isSet = false;
+    window = 0;
+    m_window_isSet = false;
+    report = new SWGActivityMonitorReport();
+    m_report_isSet = false;
+}
+
+void
+SWGActivityMonitorStatus::cleanup() {
+
+
+
+
+
+
+
+
+
+
+
+
+
+    if(report != nullptr) { 
+        delete report;
+    }
+}
+
+SWGActivityMonitorStatus*
+SWGActivityMonitorStatus::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGActivityMonitorStatus::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&monitoring, pJson["monitoring"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&raster_origin, pJson["rasterOrigin"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&channel_spacing, pJson["channelSpacing"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&channel_bandwidth, pJson["channelBandwidth"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nb_channels, pJson["nbChannels"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&usable_bandwidth, pJson["usableBandwidth"], "float", "");
+    
+    ::SWGSDRangel::setValue(&fft_size, pJson["fftSize"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&averages, pJson["averages"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&threshold, pJson["threshold"], "float", "");
+    
+    ::SWGSDRangel::setValue(&hysteresis, pJson["hysteresis"], "float", "");
+    
+    ::SWGSDRangel::setValue(&attack_time, pJson["attackTime"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&hold_time, pJson["holdTime"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&window, pJson["window"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&report, pJson["report"], "SWGActivityMonitorReport", "SWGActivityMonitorReport");
+    
+}
+
+QString
+SWGActivityMonitorStatus::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGActivityMonitorStatus::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_monitoring_isSet){
+        obj->insert("monitoring", QJsonValue(monitoring));
+    }
+    if(m_raster_origin_isSet){
+        obj->insert("rasterOrigin", QJsonValue(raster_origin));
+    }
+    if(m_channel_spacing_isSet){
+        obj->insert("channelSpacing", QJsonValue(channel_spacing));
+    }
+    if(m_channel_bandwidth_isSet){
+        obj->insert("channelBandwidth", QJsonValue(channel_bandwidth));
+    }
+    if(m_nb_channels_isSet){
+        obj->insert("nbChannels", QJsonValue(nb_channels));
+    }
+    if(m_usable_bandwidth_isSet){
+        obj->insert("usableBandwidth", QJsonValue(usable_bandwidth));
+    }
+    if(m_fft_size_isSet){
+        obj->insert("fftSize", QJsonValue(fft_size));
+    }
+    if(m_averages_isSet){
+        obj->insert("averages", QJsonValue(averages));
+    }
+    if(m_threshold_isSet){
+        obj->insert("threshold", QJsonValue(threshold));
+    }
+    if(m_hysteresis_isSet){
+        obj->insert("hysteresis", QJsonValue(hysteresis));
+    }
+    if(m_attack_time_isSet){
+        obj->insert("attackTime", QJsonValue(attack_time));
+    }
+    if(m_hold_time_isSet){
+        obj->insert("holdTime", QJsonValue(hold_time));
+    }
+    if(m_window_isSet){
+        obj->insert("window", QJsonValue(window));
+    }
+    if((report != nullptr) && (report->isSet())){
+        toJsonValue(QString("report"), report, obj, QString("SWGActivityMonitorReport"));
+    }
+
+    return obj;
+}
+
+qint32
+SWGActivityMonitorStatus::getMonitoring() {
+    return monitoring;
+}
+void
+SWGActivityMonitorStatus::setMonitoring(qint32 monitoring) {
+    this->monitoring = monitoring;
+    this->m_monitoring_isSet = true;
+}
+
+qint64
+SWGActivityMonitorStatus::getRasterOrigin() {
+    return raster_origin;
+}
+void
+SWGActivityMonitorStatus::setRasterOrigin(qint64 raster_origin) {
+    this->raster_origin = raster_origin;
+    this->m_raster_origin_isSet = true;
+}
+
+qint32
+SWGActivityMonitorStatus::getChannelSpacing() {
+    return channel_spacing;
+}
+void
+SWGActivityMonitorStatus::setChannelSpacing(qint32 channel_spacing) {
+    this->channel_spacing = channel_spacing;
+    this->m_channel_spacing_isSet = true;
+}
+
+qint32
+SWGActivityMonitorStatus::getChannelBandwidth() {
+    return channel_bandwidth;
+}
+void
+SWGActivityMonitorStatus::setChannelBandwidth(qint32 channel_bandwidth) {
+    this->channel_bandwidth = channel_bandwidth;
+    this->m_channel_bandwidth_isSet = true;
+}
+
+qint32
+SWGActivityMonitorStatus::getNbChannels() {
+    return nb_channels;
+}
+void
+SWGActivityMonitorStatus::setNbChannels(qint32 nb_channels) {
+    this->nb_channels = nb_channels;
+    this->m_nb_channels_isSet = true;
+}
+
+float
+SWGActivityMonitorStatus::getUsableBandwidth() {
+    return usable_bandwidth;
+}
+void
+SWGActivityMonitorStatus::setUsableBandwidth(float usable_bandwidth) {
+    this->usable_bandwidth = usable_bandwidth;
+    this->m_usable_bandwidth_isSet = true;
+}
+
+qint32
+SWGActivityMonitorStatus::getFftSize() {
+    return fft_size;
+}
+void
+SWGActivityMonitorStatus::setFftSize(qint32 fft_size) {
+    this->fft_size = fft_size;
+    this->m_fft_size_isSet = true;
+}
+
+qint32
+SWGActivityMonitorStatus::getAverages() {
+    return averages;
+}
+void
+SWGActivityMonitorStatus::setAverages(qint32 averages) {
+    this->averages = averages;
+    this->m_averages_isSet = true;
+}
+
+float
+SWGActivityMonitorStatus::getThreshold() {
+    return threshold;
+}
+void
+SWGActivityMonitorStatus::setThreshold(float threshold) {
+    this->threshold = threshold;
+    this->m_threshold_isSet = true;
+}
+
+float
+SWGActivityMonitorStatus::getHysteresis() {
+    return hysteresis;
+}
+void
+SWGActivityMonitorStatus::setHysteresis(float hysteresis) {
+    this->hysteresis = hysteresis;
+    this->m_hysteresis_isSet = true;
+}
+
+qint32
+SWGActivityMonitorStatus::getAttackTime() {
+    return attack_time;
+}
+void
+SWGActivityMonitorStatus::setAttackTime(qint32 attack_time) {
+    this->attack_time = attack_time;
+    this->m_attack_time_isSet = true;
+}
+
+qint32
+SWGActivityMonitorStatus::getHoldTime() {
+    return hold_time;
+}
+void
+SWGActivityMonitorStatus::setHoldTime(qint32 hold_time) {
+    this->hold_time = hold_time;
+    this->m_hold_time_isSet = true;
+}
+
+qint32
+SWGActivityMonitorStatus::getWindow() {
+    return window;
+}
+void
+SWGActivityMonitorStatus::setWindow(qint32 window) {
+    this->window = window;
+    this->m_window_isSet = true;
+}
+
+SWGActivityMonitorReport*
+SWGActivityMonitorStatus::getReport() {
+    return report;
+}
+void
+SWGActivityMonitorStatus::setReport(SWGActivityMonitorReport* report) {
+    this->report = report;
+    this->m_report_isSet = true;
+}
+
+
+bool
+SWGActivityMonitorStatus::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_monitoring_isSet){ isObjectUpdated = true; break;}
+        if(m_raster_origin_isSet){ isObjectUpdated = true; break;}
+        if(m_channel_spacing_isSet){ isObjectUpdated = true; break;}
+        if(m_channel_bandwidth_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_channels_isSet){ isObjectUpdated = true; break;}
+        if(m_usable_bandwidth_isSet){ isObjectUpdated = true; break;}
+        if(m_fft_size_isSet){ isObjectUpdated = true; break;}
+        if(m_averages_isSet){ isObjectUpdated = true; break;}
+        if(m_threshold_isSet){ isObjectUpdated = true; break;}
+        if(m_hysteresis_isSet){ isObjectUpdated = true; break;}
+        if(m_attack_time_isSet){ isObjectUpdated = true; break;}
+        if(m_hold_time_isSet){ isObjectUpdated = true; break;}
+        if(m_window_isSet){ isObjectUpdated = true; break;}
+        if(report != nullptr && report->isSet()){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
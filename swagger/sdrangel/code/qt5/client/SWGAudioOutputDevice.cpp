@@ -48,6 +48,8 @@ SWGAudioOutputDevice::SWGAudioOutputDevice() {
     m_udp_address_isSet = false;
     udp_port = 0;
     m_udp_port_isSet = false;
+    latency = 0;
+    m_latency_isSet = false;
 }
 
 SWGAudioOutputDevice::~SWGAudioOutputDevice() {
@@ -76,6 +78,8 @@ SWGAudioOutputDevice::init() {
     m_udp_address_isSet = false;
     udp_port = 0;
     m_udp_port_isSet = false;
+    latency = 0;
+    m_latency_isSet = false;
 }
 
 void
@@ -94,6 +98,7 @@ SWGAudioOutputDevice::cleanup() {
         delete udp_address;
     }
 
+
 }
 
 SWGAudioOutputDevice*
@@ -127,6 +132,8 @@ SWGAudioOutputDevice::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&udp_port, pJson["udpPort"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&latency, pJson["latency"], "qint32", "");
+    
 }
 
 QString
@@ -173,6 +180,9 @@ SWGAudioOutputDevice::asJsonObject() {
     if(m_udp_port_isSet){
         obj->insert("udpPort", QJsonValue(udp_port));
     }
+    if(m_latency_isSet){
+        obj->insert("latency", QJsonValue(latency));
+    }
 
     return obj;
 }
@@ -277,6 +287,16 @@ SWGAudioOutputDevice::setUdpPort(qint32 udp_port) {
     this->m_udp_port_isSet = true;
 }
 
+qint32
+SWGAudioOutputDevice::getLatency() {
+    return latency;
+}
+void
+SWGAudioOutputDevice::setLatency(qint32 latency) {
+    this->latency = latency;
+    this->m_latency_isSet = true;
+}
+
 
 bool
 SWGAudioOutputDevice::isSet(){
@@ -292,6 +312,7 @@ SWGAudioOutputDevice::isSet(){
         if(m_udp_channel_mode_isSet){ isObjectUpdated = true; break;}
         if(udp_address != nullptr && *udp_address != QString("")){ isObjectUpdated = true; break;}
         if(m_udp_port_isSet){ isObjectUpdated = true; break;}
+        if(m_latency_isSet){ isObjectUpdated = true; break;}
     }while(false);
     return isObjectUpdated;
 }
@@ -72,6 +72,9 @@ public:
     qint32 getUdpPort();
     void setUdpPort(qint32 udp_port);
 
+    qint32 getLatency();
+    void setLatency(qint32 latency);
+
 
     virtual bool isSet() override;
 
@@ -106,6 +109,9 @@ private:
     qint32 udp_port;
     bool m_udp_port_isSet;
 
+    qint32 latency;
+    bool m_latency_isSet;
+
 };
 
 }
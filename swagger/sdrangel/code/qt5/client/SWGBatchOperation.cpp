@@ -0,0 +1,177 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGBatchOperation.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGBatchOperation::SWGBatchOperation(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGBatchOperation::SWGBatchOperation() {
+    method = nullptr;
+    m_method_isSet = false;
+    path = nullptr;
+    m_path_isSet = false;
+    query = nullptr;
+    m_query_isSet = false;
+    body = nullptr;
+    m_body_isSet = false;
+}
+
+SWGBatchOperation::~SWGBatchOperation() {
+    this->cleanup();
+}
+
+void
+SWGBatchOperation::init() {
+    method = new QString("");
+    m_method_isSet = false;
+    path = new QString("");
+    m_path_isSet = false;
+    query = new SWGBatchQuery();
+    m_query_isSet = false;
+    body = new SWGObject();
+    m_body_isSet = false;
+}
+
+void
+SWGBatchOperation::cleanup() {
+    if(method != nullptr) { 
+        delete method;
+    }
+    if(path != nullptr) { 
+        delete path;
+    }
+    if(query != nullptr) { 
+        delete query;
+    }
+    if(body != nullptr) { 
+        delete body;
+    }
+}
+
+SWGBatchOperation*
+SWGBatchOperation::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGBatchOperation::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&method, pJson["method"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&path, pJson["path"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&query, pJson["query"], "SWGBatchQuery", "SWGBatchQuery");
+    
+    ::SWGSDRangel::setValue(&body, pJson["body"], "SWGObject", "SWGObject");
+    
+}
+
+QString
+SWGBatchOperation::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGBatchOperation::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(method != nullptr && *method != QString("")){
+        toJsonValue(QString("method"), method, obj, QString("QString"));
+    }
+    if(path != nullptr && *path != QString("")){
+        toJsonValue(QString("path"), path, obj, QString("QString"));
+    }
+    if((query != nullptr) && (query->isSet())){
+        toJsonValue(QString("query"), query, obj, QString("SWGBatchQuery"));
+    }
+    if((body != nullptr) && (body->isSet())){
+        toJsonValue(QString("body"), body, obj, QString("SWGObject"));
+    }
+
+    return obj;
+}
+
+QString*
+SWGBatchOperation::getMethod() {
+    return method;
+}
+void
+SWGBatchOperation::setMethod(QString* method) {
+    this->method = method;
+    this->m_method_isSet = true;
+}
+
+QString*
+SWGBatchOperation::getPath() {
+    return path;
+}
+void
+SWGBatchOperation::setPath(QString* path) {
+    this->path = path;
+    this->m_path_isSet = true;
+}
+
+SWGBatchQuery*
+SWGBatchOperation::getQuery() {
+    return query;
+}
+void
+SWGBatchOperation::setQuery(SWGBatchQuery* query) {
+    this->query = query;
+    this->m_query_isSet = true;
+}
+
+SWGObject*
+SWGBatchOperation::getBody() {
+    return body;
+}
+void
+SWGBatchOperation::setBody(SWGObject* body) {
+    this->body = body;
+    this->m_body_isSet = true;
+}
+
+
+bool
+SWGBatchOperation::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(method != nullptr && *method != QString("")){ isObjectUpdated = true; break;}
+        if(path != nullptr && *path != QString("")){ isObjectUpdated = true; break;}
+        if(query != nullptr && query->isSet()){ isObjectUpdated = true; break;}
+        if(body != nullptr && body->isSet()){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
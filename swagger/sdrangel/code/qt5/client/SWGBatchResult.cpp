@@ -0,0 +1,175 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGBatchResult.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGBatchResult::SWGBatchResult(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGBatchResult::SWGBatchResult() {
+    method = nullptr;
+    m_method_isSet = false;
+    path = nullptr;
+    m_path_isSet = false;
+    status = 0;
+    m_status_isSet = false;
+    response = nullptr;
+    m_response_isSet = false;
+}
+
+SWGBatchResult::~SWGBatchResult() {
+    this->cleanup();
+}
+
+void
+SWGBatchResult::init() {
+    method = new QString("");
+    m_method_isSet = false;
+    path = new QString("");
+    m_path_isSet = false;
+    status = 0;
+    m_status_isSet = false;
+    response = new SWGObject();
+    m_response_isSet = false;
+}
+
+void
+SWGBatchResult::cleanup() {
+    if(method != nullptr) { 
+        delete method;
+    }
+    if(path != nullptr) { 
+        delete path;
+    }
+
+    if(response != nullptr) { 
+        delete response;
+    }
+}
+
+SWGBatchResult*
+SWGBatchResult::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGBatchResult::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&method, pJson["method"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&path, pJson["path"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&status, pJson["status"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&response, pJson["response"], "SWGObject", "SWGObject");
+    
+}
+
+QString
+SWGBatchResult::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGBatchResult::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(method != nullptr && *method != QString("")){
+        toJsonValue(QString("method"), method, obj, QString("QString"));
+    }
+    if(path != nullptr && *path != QString("")){
+        toJsonValue(QString("path"), path, obj, QString("QString"));
+    }
+    if(m_status_isSet){
+        obj->insert("status", QJsonValue(status));
+    }
+    if((response != nullptr) && (response->isSet())){
+        toJsonValue(QString("response"), response, obj, QString("SWGObject"));
+    }
+
+    return obj;
+}
+
+QString*
+SWGBatchResult::getMethod() {
+    return method;
+}
+void
+SWGBatchResult::setMethod(QString* method) {
+    this->method = method;
+    this->m_method_isSet = true;
+}
+
+QString*
+SWGBatchResult::getPath() {
+    return path;
+}
+void
+SWGBatchResult::setPath(QString* path) {
+    this->path = path;
+    this->m_path_isSet = true;
+}
+
+qint32
+SWGBatchResult::getStatus() {
+    return status;
+}
+void
+SWGBatchResult::setStatus(qint32 status) {
+    this->status = status;
+    this->m_status_isSet = true;
+}
+
+SWGObject*
+SWGBatchResult::getResponse() {
+    return response;
+}
+void
+SWGBatchResult::setResponse(SWGObject* response) {
+    this->response = response;
+    this->m_response_isSet = true;
+}
+
+
+bool
+SWGBatchResult::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(method != nullptr && *method != QString("")){ isObjectUpdated = true; break;}
+        if(path != nullptr && *path != QString("")){ isObjectUpdated = true; break;}
+        if(m_status_isSet){ isObjectUpdated = true; break;}
+        if(response != nullptr && response->isSet()){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
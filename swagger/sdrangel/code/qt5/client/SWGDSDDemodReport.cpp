@@ -52,6 +52,8 @@ SWGDSDDemodReport::SWGDSDDemodReport() {
     m_zero_crossing_position_isSet = false;
     sync_rate = 0;
     m_sync_rate_isSet = false;
+    audio_latency = 0.0f;
+    m_audio_latency_isSet = false;
     status_text = nullptr;
     m_status_text_isSet = false;
 }
@@ -86,6 +88,8 @@ SWGDSDDemodReport::init() {
     m_zero_crossing_position_isSet = false;
     sync_rate = 0;
     m_sync_rate_isSet = false;
+    audio_latency = 0.0f;
+    m_audio_latency_isSet = false;
     status_text = new QString("");
     m_status_text_isSet = false;
 }
@@ -106,6 +110,7 @@ SWGDSDDemodReport::cleanup() {
 
 
 
+
     if(status_text != nullptr) { 
         delete status_text;
     }
@@ -146,6 +151,8 @@ SWGDSDDemodReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&sync_rate, pJson["syncRate"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&audio_latency, pJson["audioLatency"], "float", "");
+    
     ::SWGSDRangel::setValue(&status_text, pJson["statusText"], "QString", "QString");
     
 }
@@ -200,6 +207,9 @@ SWGDSDDemodReport::asJsonObject() {
     if(m_sync_rate_isSet){
         obj->insert("syncRate", QJsonValue(sync_rate));
     }
+    if(m_audio_latency_isSet){
+        obj->insert("audioLatency", QJsonValue(audio_latency));
+    }
     if(status_text != nullptr && *status_text != QString("")){
         toJsonValue(QString("statusText"), status_text, obj, QString("QString"));
     }
@@ -327,6 +337,16 @@ SWGDSDDemodReport::setSyncRate(qint32 sync_rate) {
     this->m_sync_rate_isSet = true;
 }
 
+float
+SWGDSDDemodReport::getAudioLatency() {
+    return audio_latency;
+}
+void
+SWGDSDDemodReport::setAudioLatency(float audio_latency) {
+    this->audio_latency = audio_latency;
+    this->m_audio_latency_isSet = true;
+}
+
 QString*
 SWGDSDDemodReport::getStatusText() {
     return status_text;
@@ -354,6 +374,7 @@ SWGDSDDemodReport::isSet(){
         if(m_carier_position_isSet){ isObjectUpdated = true; break;}
         if(m_zero_crossing_position_isSet){ isObjectUpdated = true; break;}
         if(m_sync_rate_isSet){ isObjectUpdated = true; break;}
+        if(m_audio_latency_isSet){ isObjectUpdated = true; break;}
         if(status_text != nullptr && *status_text != QString("")){ isObjectUpdated = true; break;}
     }while(false);
     return isObjectUpdated;
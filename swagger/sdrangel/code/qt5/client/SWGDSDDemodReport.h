@@ -78,6 +78,9 @@ public:
     qint32 getSyncRate();
     void setSyncRate(qint32 sync_rate);
 
+    float getAudioLatency();
+    void setAudioLatency(float audio_latency);
+
     QString* getStatusText();
     void setStatusText(QString* status_text);
 
@@ -121,6 +124,9 @@ private:
     qint32 sync_rate;
     bool m_sync_rate_isSet;
 
+    float audio_latency;
+    bool m_audio_latency_isSet;
+
     QString* status_text;
     bool m_status_text_isSet;
 
@@ -15,6 +15,10 @@
 
 #include "SWGHttpRequest.h"
 
+#include "SWGActivityChannels.h"
+#include "SWGActivityEvents.h"
+#include "SWGActivityMonitorSettings.h"
+#include "SWGActivityMonitorStatus.h"
 #include "SWGChannelReport.h"
 #include "SWGChannelSettings.h"
 #include "SWGChannelsDetail.h"
@@ -24,6 +28,12 @@
 #include "SWGDeviceSettings.h"
 #include "SWGDeviceState.h"
 #include "SWGErrorResponse.h"
+#include "SWGSpectrumArchiveData.h"
+#include "SWGSpectrumArchiveSettings.h"
+#include "SWGSpectrumArchiveStatus.h"
+#include "SWGSpectrumScannerData.h"
+#include "SWGSpectrumScannerSettings.h"
+#include "SWGSpectrumScannerStatus.h"
 #include "SWGSuccessResponse.h"
 
 #include <QObject>
@@ -42,6 +52,11 @@ public:
     QString basePath;
     QMap<QString, QString> defaultHeaders;
 
+    void devicesetActivityChannelsGet(qint32 device_set_index, qint32 active);
+    void devicesetActivityDelete(qint32 device_set_index);
+    void devicesetActivityEventsGet(qint32 device_set_index, qint64 since, qint32 max);
+    void devicesetActivityGet(qint32 device_set_index);
+    void devicesetActivityPost(qint32 device_set_index, SWGActivityMonitorSettings& body);
     void devicesetChannelDelete(qint32 device_set_index, qint32 channel_index);
     void devicesetChannelPost(qint32 device_set_index, SWGChannelSettings& body);
     void devicesetChannelReportGet(qint32 device_set_index, qint32 channel_index);
@@ -59,10 +74,23 @@ public:
     void devicesetDeviceSettingsPut(qint32 device_set_index, SWGDeviceSettings& body);
     void devicesetFocusPatch(qint32 device_set_index);
     void devicesetGet(qint32 device_set_index);
+    void devicesetSpectrumArchiveDataGet(qint32 device_set_index, qint64 start_time, qint64 end_time, qint64 start_frequency, qint64 end_frequency, qint32 rows, qint32 columns);
+    void devicesetSpectrumArchiveDelete(qint32 device_set_index);
+    void devicesetSpectrumArchiveGet(qint32 device_set_index);
+    void devicesetSpectrumArchivePost(qint32 device_set_index, SWGSpectrumArchiveSettings& body);
+    void devicesetSpectrumScannerDataGet(qint32 device_set_index, qint32 bins);
+    void devicesetSpectrumScannerDelete(qint32 device_set_index);
+    void devicesetSpectrumScannerGet(qint32 device_set_index);
+    void devicesetSpectrumScannerPost(qint32 device_set_index, SWGSpectrumScannerSettings& body);
     void instanceDeviceSetDelete();
     void instanceDeviceSetPost(qint32 tx);
     
 private:
+    void devicesetActivityChannelsGetCallback (SWGHttpRequestWorker * worker);
+    void devicesetActivityDeleteCallback (SWGHttpRequestWorker * worker);
+    void devicesetActivityEventsGetCallback (SWGHttpRequestWorker * worker);
+    void devicesetActivityGetCallback (SWGHttpRequestWorker * worker);
+    void devicesetActivityPostCallback (SWGHttpRequestWorker * worker);
     void devicesetChannelDeleteCallback (SWGHttpRequestWorker * worker);
     void devicesetChannelPostCallback (SWGHttpRequestWorker * worker);
     void devicesetChannelReportGetCallback (SWGHttpRequestWorker * worker);
@@ -80,10 +108,23 @@ private:
     void devicesetDeviceSettingsPutCallback (SWGHttpRequestWorker * worker);
     void devicesetFocusPatchCallback (SWGHttpRequestWorker * worker);
     void devicesetGetCallback (SWGHttpRequestWorker * worker);
+    void devicesetSpectrumArchiveDataGetCallback (SWGHttpRequestWorker * worker);
+    void devicesetSpectrumArchiveDeleteCallback (SWGHttpRequestWorker * worker);
+    void devicesetSpectrumArchiveGetCallback (SWGHttpRequestWorker * worker);
+    void devicesetSpectrumArchivePostCallback (SWGHttpRequestWorker * worker);
+    void devicesetSpectrumScannerDataGetCallback (SWGHttpRequestWorker * worker);
+    void devicesetSpectrumScannerDeleteCallback (SWGHttpRequestWorker * worker);
+    void devicesetSpectrumScannerGetCallback (SWGHttpRequestWorker * worker);
+    void devicesetSpectrumScannerPostCallback (SWGHttpRequestWorker * worker);
     void instanceDeviceSetDeleteCallback (SWGHttpRequestWorker * worker);
     void instanceDeviceSetPostCallback (SWGHttpRequestWorker * worker);
     
 signals:
+    void devicesetActivityChannelsGetSignal(SWGActivityChannels* summary);
+    void devicesetActivityDeleteSignal(SWGActivityMonitorStatus* summary);
+    void devicesetActivityEventsGetSignal(SWGActivityEvents* summary);
+    void devicesetActivityGetSignal(SWGActivityMonitorStatus* summary);
+    void devicesetActivityPostSignal(SWGActivityMonitorStatus* summary);
     void devicesetChannelDeleteSignal(SWGChannelSettings* summary);
     void devicesetChannelPostSignal(SWGSuccessResponse* summary);
     void devicesetChannelReportGetSignal(SWGChannelReport* summary);
@@ -101,9 +142,22 @@ signals:
     void devicesetDeviceSettingsPutSignal(SWGDeviceSettings* summary);
     void devicesetFocusPatchSignal(SWGSuccessResponse* summary);
     void devicesetGetSignal(SWGDeviceSet* summary);
+    void devicesetSpectrumArchiveDataGetSignal(SWGSpectrumArchiveData* summary);
+    void devicesetSpectrumArchiveDeleteSignal(SWGSpectrumArchiveStatus* summary);
+    void devicesetSpectrumArchiveGetSignal(SWGSpectrumArchiveStatus* summary);
+    void devicesetSpectrumArchivePostSignal(SWGSpectrumArchiveStatus* summary);
+    void devicesetSpectrumScannerDataGetSignal(SWGSpectrumScannerData* summary);
+    void devicesetSpectrumScannerDeleteSignal(SWGSpectrumScannerStatus* summary);
+    void devicesetSpectrumScannerGetSignal(SWGSpectrumScannerStatus* summary);
+    void devicesetSpectrumScannerPostSignal(SWGSpectrumScannerStatus* summary);
     void instanceDeviceSetDeleteSignal(SWGSuccessResponse* summary);
     void instanceDeviceSetPostSignal(SWGSuccessResponse* summary);
     
+    void devicesetActivityChannelsGetSignalE(SWGActivityChannels* summary, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetActivityDeleteSignalE(SWGActivityMonitorStatus* summary, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetActivityEventsGetSignalE(SWGActivityEvents* summary, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetActivityGetSignalE(SWGActivityMonitorStatus* summary, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetActivityPostSignalE(SWGActivityMonitorStatus* summary, QNetworkReply::NetworkError error_type, QString& error_str);
     void devicesetChannelDeleteSignalE(SWGChannelSettings* summary, QNetworkReply::NetworkError error_type, QString& error_str);
     void devicesetChannelPostSignalE(SWGSuccessResponse* summary, QNetworkReply::NetworkError error_type, QString& error_str);
     void devicesetChannelReportGetSignalE(SWGChannelReport* summary, QNetworkReply::NetworkError error_type, QString& error_str);
@@ -121,9 +175,22 @@ signals:
     void devicesetDeviceSettingsPutSignalE(SWGDeviceSettings* summary, QNetworkReply::NetworkError error_type, QString& error_str);
     void devicesetFocusPatchSignalE(SWGSuccessResponse* summary, QNetworkReply::NetworkError error_type, QString& error_str);
     void devicesetGetSignalE(SWGDeviceSet* summary, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumArchiveDataGetSignalE(SWGSpectrumArchiveData* summary, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumArchiveDeleteSignalE(SWGSpectrumArchiveStatus* summary, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumArchiveGetSignalE(SWGSpectrumArchiveStatus* summary, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumArchivePostSignalE(SWGSpectrumArchiveStatus* summary, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumScannerDataGetSignalE(SWGSpectrumScannerData* summary, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumScannerDeleteSignalE(SWGSpectrumScannerStatus* summary, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumScannerGetSignalE(SWGSpectrumScannerStatus* summary, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumScannerPostSignalE(SWGSpectrumScannerStatus* summary, QNetworkReply::NetworkError error_type, QString& error_str);
     void instanceDeviceSetDeleteSignalE(SWGSuccessResponse* summary, QNetworkReply::NetworkError error_type, QString& error_str);
     void instanceDeviceSetPostSignalE(SWGSuccessResponse* summary, QNetworkReply::NetworkError error_type, QString& error_str);
     
+    void devicesetActivityChannelsGetSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetActivityDeleteSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetActivityEventsGetSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetActivityGetSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetActivityPostSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
     void devicesetChannelDeleteSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
     void devicesetChannelPostSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
     void devicesetChannelReportGetSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
@@ -141,6 +208,14 @@ signals:
     void devicesetDeviceSettingsPutSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
     void devicesetFocusPatchSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
     void devicesetGetSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumArchiveDataGetSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumArchiveDeleteSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumArchiveGetSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumArchivePostSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumScannerDataGetSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumScannerDeleteSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumScannerGetSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
+    void devicesetSpectrumScannerPostSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
     void instanceDeviceSetDeleteSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
     void instanceDeviceSetPostSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
     
@@ -404,6 +404,61 @@ SWGInstanceApi::instanceAudioOutputPatchCallback(SWGHttpRequestWorker * worker)
     }
 }
 
+void
+SWGInstanceApi::instanceBatchPost(SWGBatchRequest& body) {
+    QString fullPath;
+    fullPath.append(this->host).append(this->basePath).append("/sdrangel/batch");
+
+
+
+    SWGHttpRequestWorker *worker = new SWGHttpRequestWorker();
+    SWGHttpRequestInput input(fullPath, "POST");
+
+
+    
+    QString output = body.asJson();
+    input.request_body.append(output);
+    
+
+
+    foreach(QString key, this->defaultHeaders.keys()) {
+        input.headers.insert(key, this->defaultHeaders.value(key));
+    }
+
+    connect(worker,
+            &SWGHttpRequestWorker::on_execution_finished,
+            this,
+            &SWGInstanceApi::instanceBatchPostCallback);
+
+    worker->execute(&input);
+}
+
+void
+SWGInstanceApi::instanceBatchPostCallback(SWGHttpRequestWorker * worker) {
+    QString msg;
+    QString error_str = worker->error_str;
+    QNetworkReply::NetworkError error_type = worker->error_type;
+
+    if (worker->error_type == QNetworkReply::NoError) {
+        msg = QString("Success! %1 bytes").arg(worker->response.length());
+    }
+    else {
+        msg = "Error: " + worker->error_str;
+    }
+
+
+    QString json(worker->response);
+    SWGBatchResponse* output = static_cast<SWGBatchResponse*>(create(json, QString("SWGBatchResponse")));
+    worker->deleteLater();
+
+    if (worker->error_type == QNetworkReply::NoError) {
+        emit instanceBatchPostSignal(output);
+    } else {
+        emit instanceBatchPostSignalE(output, error_type, error_str);
+        emit instanceBatchPostSignalEFull(worker, error_type, error_str);
+    }
+}
+
 void
 SWGInstanceApi::instanceChannels(qint32 tx) {
     QString fullPath;
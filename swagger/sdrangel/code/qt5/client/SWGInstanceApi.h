@@ -18,6 +18,8 @@
 #include "SWGAudioDevices.h"
 #include "SWGAudioInputDevice.h"
 #include "SWGAudioOutputDevice.h"
+#include "SWGBatchRequest.h"
+#include "SWGBatchResponse.h"
 #include "SWGDVSeralDevices.h"
 #include "SWGDeviceSetList.h"
 #include "SWGErrorResponse.h"
@@ -56,6 +58,7 @@ public:
     void instanceAudioOutputCleanupPatch();
     void instanceAudioOutputDelete(SWGAudioOutputDevice& body);
     void instanceAudioOutputPatch(SWGAudioOutputDevice& body);
+    void instanceBatchPost(SWGBatchRequest& body);
     void instanceChannels(qint32 tx);
     void instanceDVSerialGet();
     void instanceDVSerialPatch(qint32 dvserial);
@@ -83,6 +86,7 @@ private:
     void instanceAudioOutputCleanupPatchCallback (SWGHttpRequestWorker * worker);
     void instanceAudioOutputDeleteCallback (SWGHttpRequestWorker * worker);
     void instanceAudioOutputPatchCallback (SWGHttpRequestWorker * worker);
+    void instanceBatchPostCallback (SWGHttpRequestWorker * worker);
     void instanceChannelsCallback (SWGHttpRequestWorker * worker);
     void instanceDVSerialGetCallback (SWGHttpRequestWorker * worker);
     void instanceDVSerialPatchCallback (SWGHttpRequestWorker * worker);
@@ -110,6 +114,7 @@ signals:
     void instanceAudioOutputCleanupPatchSignal(SWGSuccessResponse* summary);
     void instanceAudioOutputDeleteSignal(SWGAudioOutputDevice* summary);
     void instanceAudioOutputPatchSignal(SWGAudioOutputDevice* summary);
+    void instanceBatchPostSignal(SWGBatchResponse* summary);
     void instanceChannelsSignal(SWGInstanceChannelsResponse* summary);
     void instanceDVSerialGetSignal(SWGDVSeralDevices* summary);
     void instanceDVSerialPatchSignal(SWGDVSeralDevices* summary);
@@ -136,6 +141,7 @@ signals:
     void instanceAudioOutputCleanupPatchSignalE(SWGSuccessResponse* summary, QNetworkReply::NetworkError error_type, QString& error_str);
     void instanceAudioOutputDeleteSignalE(SWGAudioOutputDevice* summary, QNetworkReply::NetworkError error_type, QString& error_str);
     void instanceAudioOutputPatchSignalE(SWGAudioOutputDevice* summary, QNetworkReply::NetworkError error_type, QString& error_str);
+    void instanceBatchPostSignalE(SWGBatchResponse* summary, QNetworkReply::NetworkError error_type, QString& error_str);
     void instanceChannelsSignalE(SWGInstanceChannelsResponse* summary, QNetworkReply::NetworkError error_type, QString& error_str);
     void instanceDVSerialGetSignalE(SWGDVSeralDevices* summary, QNetworkReply::NetworkError error_type, QString& error_str);
     void instanceDVSerialPatchSignalE(SWGDVSeralDevices* summary, QNetworkReply::NetworkError error_type, QString& error_str);
@@ -162,6 +168,7 @@ signals:
     void instanceAudioOutputCleanupPatchSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
     void instanceAudioOutputDeleteSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
     void instanceAudioOutputPatchSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
+    void instanceBatchPostSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
     void instanceChannelsSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
     void instanceDVSerialGetSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
     void instanceDVSerialPatchSignalEFull(SWGHttpRequestWorker* worker, QNetworkReply::NetworkError error_type, QString& error_str);
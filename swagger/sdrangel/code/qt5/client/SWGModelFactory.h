@@ -20,6 +20,13 @@
 #include "SWGAMModSettings.h"
 #include "SWGATVModReport.h"
 #include "SWGATVModSettings.h"
+#include "SWGActivityChannel.h"
+#include "SWGActivityChannels.h"
+#include "SWGActivityEvent.h"
+#include "SWGActivityEvents.h"
+#include "SWGActivityMonitorReport.h"
+#include "SWGActivityMonitorSettings.h"
+#include "SWGActivityMonitorStatus.h"
 #include "SWGAirspyHFReport.h"
 #include "SWGAirspyHFSettings.h"
 #include "SWGAirspyReport.h"
@@ -32,6 +39,11 @@
 #include "SWGBFMDemodReport.h"
 #include "SWGBFMDemodSettings.h"
 #include "SWGBandwidth.h"
+#include "SWGBatchOperation.h"
+#include "SWGBatchQuery.h"
+#include "SWGBatchRequest.h"
+#include "SWGBatchResponse.h"
+#include "SWGBatchResult.h"
 #include "SWGBladeRF1InputSettings.h"
 #include "SWGBladeRF1OutputSettings.h"
 #include "SWGBladeRF2InputReport.h"
@@ -119,6 +131,13 @@
 #include "SWGSoapySDRInputSettings.h"
 #include "SWGSoapySDROutputSettings.h"
 #include "SWGSoapySDRReport.h"
+#include "SWGSpectrumArchiveData.h"
+#include "SWGSpectrumArchiveSettings.h"
+#include "SWGSpectrumArchiveStatus.h"
+#include "SWGSpectrumScannerData.h"
+#include "SWGSpectrumScannerSettings.h"
+#include "SWGSpectrumScannerStatus.h"
+#include "SWGSpectrumScannerSweepReport.h"
 #include "SWGSuccessResponse.h"
 #include "SWGTestSourceSettings.h"
 #include "SWGUDPSinkReport.h"
@@ -155,6 +174,27 @@ namespace SWGSDRangel {
     if(QString("SWGATVModSettings").compare(type) == 0) {
       return new SWGATVModSettings();
     }
+    if(QString("SWGActivityChannel").compare(type) == 0) {
+      return new SWGActivityChannel();
+    }
+    if(QString("SWGActivityChannels").compare(type) == 0) {
+      return new SWGActivityChannels();
+    }
+    if(QString("SWGActivityEvent").compare(type) == 0) {
+      return new SWGActivityEvent();
+    }
+    if(QString("SWGActivityEvents").compare(type) == 0) {
+      return new SWGActivityEvents();
+    }
+    if(QString("SWGActivityMonitorReport").compare(type) == 0) {
+      return new SWGActivityMonitorReport();
+    }
+    if(QString("SWGActivityMonitorSettings").compare(type) == 0) {
+      return new SWGActivityMonitorSettings();
+    }
+    if(QString("SWGActivityMonitorStatus").compare(type) == 0) {
+      return new SWGActivityMonitorStatus();
+    }
     if(QString("SWGAirspyHFReport").compare(type) == 0) {
       return new SWGAirspyHFReport();
     }
@@ -191,6 +231,21 @@ namespace SWGSDRangel {
     if(QString("SWGBandwidth").compare(type) == 0) {
       return new SWGBandwidth();
     }
+    if(QString("SWGBatchOperation").compare(type) == 0) {
+      return new SWGBatchOperation();
+    }
+    if(QString("SWGBatchQuery").compare(type) == 0) {
+      return new SWGBatchQuery();
+    }
+    if(QString("SWGBatchRequest").compare(type) == 0) {
+      return new SWGBatchRequest();
+    }
+    if(QString("SWGBatchResponse").compare(type) == 0) {
+      return new SWGBatchResponse();
+    }
+    if(QString("SWGBatchResult").compare(type) == 0) {
+      return new SWGBatchResult();
+    }
     if(QString("SWGBladeRF1InputSettings").compare(type) == 0) {
       return new SWGBladeRF1InputSettings();
     }
@@ -452,6 +507,27 @@ namespace SWGSDRangel {
     if(QString("SWGSoapySDRReport").compare(type) == 0) {
       return new SWGSoapySDRReport();
     }
+    if(QString("SWGSpectrumArchiveData").compare(type) == 0) {
+      return new SWGSpectrumArchiveData();
+    }
+    if(QString("SWGSpectrumArchiveSettings").compare(type) == 0) {
+      return new SWGSpectrumArchiveSettings();
+    }
+    if(QString("SWGSpectrumArchiveStatus").compare(type) == 0) {
+      return new SWGSpectrumArchiveStatus();
+    }
+    if(QString("SWGSpectrumScannerData").compare(type) == 0) {
+      return new SWGSpectrumScannerData();
+    }
+    if(QString("SWGSpectrumScannerSettings").compare(type) == 0) {
+      return new SWGSpectrumScannerSettings();
+    }
+    if(QString("SWGSpectrumScannerStatus").compare(type) == 0) {
+      return new SWGSpectrumScannerStatus();
+    }
+    if(QString("SWGSpectrumScannerSweepReport").compare(type) == 0) {
+      return new SWGSpectrumScannerSweepReport();
+    }
     if(QString("SWGSuccessResponse").compare(type) == 0) {
       return new SWGSuccessResponse();
     }
@@ -38,6 +38,8 @@ SWGNFMDemodReport::SWGNFMDemodReport() {
     m_audio_sample_rate_isSet = false;
     channel_sample_rate = 0;
     m_channel_sample_rate_isSet = false;
+    audio_latency = 0.0f;
+    m_audio_latency_isSet = false;
 }
 
 SWGNFMDemodReport::~SWGNFMDemodReport() {
@@ -56,6 +58,8 @@ SWGNFMDemodReport::init() {
     m_audio_sample_rate_isSet = false;
     channel_sample_rate = 0;
     m_channel_sample_rate_isSet = false;
+    audio_latency = 0.0f;
+    m_audio_latency_isSet = false;
 }
 
 void
@@ -65,6 +69,7 @@ SWGNFMDemodReport::cleanup() {
 
 
 
+
 }
 
 SWGNFMDemodReport*
@@ -88,6 +93,8 @@ SWGNFMDemodReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&channel_sample_rate, pJson["channelSampleRate"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&audio_latency, pJson["audioLatency"], "float", "");
+    
 }
 
 QString
@@ -119,6 +126,9 @@ SWGNFMDemodReport::asJsonObject() {
     if(m_channel_sample_rate_isSet){
         obj->insert("channelSampleRate", QJsonValue(channel_sample_rate));
     }
+    if(m_audio_latency_isSet){
+        obj->insert("audioLatency", QJsonValue(audio_latency));
+    }
 
     return obj;
 }
@@ -173,6 +183,16 @@ SWGNFMDemodReport::setChannelSampleRate(qint32 channel_sample_rate) {
     this->m_channel_sample_rate_isSet = true;
 }
 
+float
+SWGNFMDemodReport::getAudioLatency() {
+    return audio_latency;
+}
+void
+SWGNFMDemodReport::setAudioLatency(float audio_latency) {
+    this->audio_latency = audio_latency;
+    this->m_audio_latency_isSet = true;
+}
+
 
 bool
 SWGNFMDemodReport::isSet(){
@@ -183,6 +203,7 @@ SWGNFMDemodReport::isSet(){
         if(m_squelch_isSet){ isObjectUpdated = true; break;}
         if(m_audio_sample_rate_isSet){ isObjectUpdated = true; break;}
         if(m_channel_sample_rate_isSet){ isObjectUpdated = true; break;}
+        if(m_audio_latency_isSet){ isObjectUpdated = true; break;}
     }while(false);
     return isObjectUpdated;
 }
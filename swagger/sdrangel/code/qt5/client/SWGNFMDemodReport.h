@@ -56,6 +56,9 @@ public:
     qint32 getChannelSampleRate();
     void setChannelSampleRate(qint32 channel_sample_rate);
 
+    float getAudioLatency();
+    void setAudioLatency(float audio_latency);
+
 
     virtual bool isSet() override;
 
@@ -75,6 +78,9 @@ private:
     qint32 channel_sample_rate;
     bool m_channel_sample_rate_isSet;
 
+    float audio_latency;
+    bool m_audio_latency_isSet;
+
 };
 
 }
@@ -40,6 +40,22 @@ SWGSDRdaemonSourceReport::SWGSDRdaemonSourceReport() {
     m_min_nb_blocks_isSet = false;
     max_nb_recovery = 0;
     m_max_nb_recovery_isSet = false;
+    buffer_latency_ms = 0.0f;
+    m_buffer_latency_ms_isSet = false;
+    target_latency_ms = 0.0f;
+    m_target_latency_ms_isSet = false;
+    jitter_ms = 0.0f;
+    m_jitter_ms_isSet = false;
+    drift_ppm = 0.0f;
+    m_drift_ppm_isSet = false;
+    late_frames = 0;
+    m_late_frames_isSet = false;
+    latency_histogram = nullptr;
+    m_latency_histogram_isSet = false;
+    jitter_histogram = nullptr;
+    m_jitter_histogram_isSet = false;
+    late_histogram = nullptr;
+    m_late_histogram_isSet = false;
 }
 
 SWGSDRdaemonSourceReport::~SWGSDRdaemonSourceReport() {
@@ -60,6 +76,22 @@ SWGSDRdaemonSourceReport::init() {
     m_min_nb_blocks_isSet = false;
     max_nb_recovery = 0;
     m_max_nb_recovery_isSet = false;
+    buffer_latency_ms = 0.0f;
+    m_buffer_latency_ms_isSet = false;
+    target_latency_ms = 0.0f;
+    m_target_latency_ms_isSet = false;
+    jitter_ms = 0.0f;
+    m_jitter_ms_isSet = false;
+    drift_ppm = 0.0f;
+    m_drift_ppm_isSet = false;
+    late_frames = 0;
+    m_late_frames_isSet = false;
+    latency_histogram = new QList<qint32>();
+    m_latency_histogram_isSet = false;
+    jitter_histogram = new QList<qint32>();
+    m_jitter_histogram_isSet = false;
+    late_histogram = new QList<qint32>();
+    m_late_histogram_isSet = false;
 }
 
 void
@@ -72,6 +104,20 @@ SWGSDRdaemonSourceReport::cleanup() {
     }
 
 
+
+
+
+
+
+    if(latency_histogram != nullptr) { 
+        delete latency_histogram;
+    }
+    if(jitter_histogram != nullptr) { 
+        delete jitter_histogram;
+    }
+    if(late_histogram != nullptr) { 
+        delete late_histogram;
+    }
 }
 
 SWGSDRdaemonSourceReport*
@@ -97,6 +143,22 @@ SWGSDRdaemonSourceReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&max_nb_recovery, pJson["maxNbRecovery"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&buffer_latency_ms, pJson["bufferLatencyMs"], "float", "");
+    
+    ::SWGSDRangel::setValue(&target_latency_ms, pJson["targetLatencyMs"], "float", "");
+    
+    ::SWGSDRangel::setValue(&jitter_ms, pJson["jitterMs"], "float", "");
+    
+    ::SWGSDRangel::setValue(&drift_ppm, pJson["driftPpm"], "float", "");
+    
+    ::SWGSDRangel::setValue(&late_frames, pJson["lateFrames"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&latency_histogram, pJson["latencyHistogram"], "QList", "qint32");
+    
+    ::SWGSDRangel::setValue(&jitter_histogram, pJson["jitterHistogram"], "QList", "qint32");
+    
+    ::SWGSDRangel::setValue(&late_histogram, pJson["lateHistogram"], "QList", "qint32");
 }
 
 QString
@@ -131,6 +193,30 @@ SWGSDRdaemonSourceReport::asJsonObject() {
     if(m_max_nb_recovery_isSet){
         obj->insert("maxNbRecovery", QJsonValue(max_nb_recovery));
     }
+    if(m_buffer_latency_ms_isSet){
+        obj->insert("bufferLatencyMs", QJsonValue(buffer_latency_ms));
+    }
+    if(m_target_latency_ms_isSet){
+        obj->insert("targetLatencyMs", QJsonValue(target_latency_ms));
+    }
+    if(m_jitter_ms_isSet){
+        obj->insert("jitterMs", QJsonValue(jitter_ms));
+    }
+    if(m_drift_ppm_isSet){
+        obj->insert("driftPpm", QJsonValue(drift_ppm));
+    }
+    if(m_late_frames_isSet){
+        obj->insert("lateFrames", QJsonValue(late_frames));
+    }
+    if(latency_histogram->size() > 0){
+        toJsonArray((QList<void*>*)latency_histogram, obj, "latencyHistogram", "qint32");
+    }
+    if(jitter_histogram->size() > 0){
+        toJsonArray((QList<void*>*)jitter_histogram, obj, "jitterHistogram", "qint32");
+    }
+    if(late_histogram->size() > 0){
+        toJsonArray((QList<void*>*)late_histogram, obj, "lateHistogram", "qint32");
+    }
 
     return obj;
 }
@@ -195,6 +281,86 @@ SWGSDRdaemonSourceReport::setMaxNbRecovery(qint32 max_nb_recovery) {
     this->m_max_nb_recovery_isSet = true;
 }
 
+float
+SWGSDRdaemonSourceReport::getBufferLatencyMs() {
+    return buffer_latency_ms;
+}
+void
+SWGSDRdaemonSourceReport::setBufferLatencyMs(float buffer_latency_ms) {
+    this->buffer_latency_ms = buffer_latency_ms;
+    this->m_buffer_latency_ms_isSet = true;
+}
+
+float
+SWGSDRdaemonSourceReport::getTargetLatencyMs() {
+    return target_latency_ms;
+}
+void
+SWGSDRdaemonSourceReport::setTargetLatencyMs(float target_latency_ms) {
+    this->target_latency_ms = target_latency_ms;
+    this->m_target_latency_ms_isSet = true;
+}
+
+float
+SWGSDRdaemonSourceReport::getJitterMs() {
+    return jitter_ms;
+}
+void
+SWGSDRdaemonSourceReport::setJitterMs(float jitter_ms) {
+    this->jitter_ms = jitter_ms;
+    this->m_jitter_ms_isSet = true;
+}
+
+float
+SWGSDRdaemonSourceReport::getDriftPpm() {
+    return drift_ppm;
+}
+void
+SWGSDRdaemonSourceReport::setDriftPpm(float drift_ppm) {
+    this->drift_ppm = drift_ppm;
+    this->m_drift_ppm_isSet = true;
+}
+
+qint32
+SWGSDRdaemonSourceReport::getLateFrames() {
+    return late_frames;
+}
+void
+SWGSDRdaemonSourceReport::setLateFrames(qint32 late_frames) {
+    this->late_frames = late_frames;
+    this->m_late_frames_isSet = true;
+}
+
+QList<qint32>*
+SWGSDRdaemonSourceReport::getLatencyHistogram() {
+    return latency_histogram;
+}
+void
+SWGSDRdaemonSourceReport::setLatencyHistogram(QList<qint32>* latency_histogram) {
+    this->latency_histogram = latency_histogram;
+    this->m_latency_histogram_isSet = true;
+}
+
+QList<qint32>*
+SWGSDRdaemonSourceReport::getJitterHistogram() {
+    return jitter_histogram;
+}
+void
+SWGSDRdaemonSourceReport::setJitterHistogram(QList<qint32>* jitter_histogram) {
+    this->jitter_histogram = jitter_histogram;
+    this->m_jitter_histogram_isSet = true;
+}
+
+QList<qint32>*
+SWGSDRdaemonSourceReport::getLateHistogram() {
+    return late_histogram;
+}
+void
+SWGSDRdaemonSourceReport::setLateHistogram(QList<qint32>* late_histogram) {
+    this->late_histogram = late_histogram;
+    this->m_late_histogram_isSet = true;
+}
+
 
 bool
 SWGSDRdaemonSourceReport::isSet(){
@@ -206,6 +372,14 @@ SWGSDRdaemonSourceReport::isSet(){
         if(daemon_timestamp != nullptr && *daemon_timestamp != QString("")){ isObjectUpdated = true; break;}
         if(m_min_nb_blocks_isSet){ isObjectUpdated = true; break;}
         if(m_max_nb_recovery_isSet){ isObjectUpdated = true; break;}
+        if(m_buffer_latency_ms_isSet){ isObjectUpdated = true; break;}
+        if(m_target_latency_ms_isSet){ isObjectUpdated = true; break;}
+        if(m_jitter_ms_isSet){ isObjectUpdated = true; break;}
+        if(m_drift_ppm_isSet){ isObjectUpdated = true; break;}
+        if(m_late_frames_isSet){ isObjectUpdated = true; break;}
+        if(latency_histogram->size() > 0){ isObjectUpdated = true; break;}
+        if(jitter_histogram->size() > 0){ isObjectUpdated = true; break;}
+        if(late_histogram->size() > 0){ isObjectUpdated = true; break;}
     }while(false);
     return isObjectUpdated;
 }
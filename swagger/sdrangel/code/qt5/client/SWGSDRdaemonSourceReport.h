@@ -22,6 +22,7 @@
 #include <QJsonObject>
 
 
+#include <QList>
 #include <QString>
 
 #include "SWGObject.h"
@@ -60,6 +61,30 @@ public:
     qint32 getMaxNbRecovery();
     void setMaxNbRecovery(qint32 max_nb_recovery);
 
+    float getBufferLatencyMs();
+    void setBufferLatencyMs(float buffer_latency_ms);
+
+    float getTargetLatencyMs();
+    void setTargetLatencyMs(float target_latency_ms);
+
+    float getJitterMs();
+    void setJitterMs(float jitter_ms);
+
+    float getDriftPpm();
+    void setDriftPpm(float drift_ppm);
+
+    qint32 getLateFrames();
+    void setLateFrames(qint32 late_frames);
+
+    QList<qint32>* getLatencyHistogram();
+    void setLatencyHistogram(QList<qint32>* latency_histogram);
+
+    QList<qint32>* getJitterHistogram();
+    void setJitterHistogram(QList<qint32>* jitter_histogram);
+
+    QList<qint32>* getLateHistogram();
+    void setLateHistogram(QList<qint32>* late_histogram);
+
 
     virtual bool isSet() override;
 
@@ -82,6 +107,30 @@ private:
     qint32 max_nb_recovery;
     bool m_max_nb_recovery_isSet;
 
+    float buffer_latency_ms;
+    bool m_buffer_latency_ms_isSet;
+
+    float target_latency_ms;
+    bool m_target_latency_ms_isSet;
+
+    float jitter_ms;
+    bool m_jitter_ms_isSet;
+
+    float drift_ppm;
+    bool m_drift_ppm_isSet;
+
+    qint32 late_frames;
+    bool m_late_frames_isSet;
+
+    QList<qint32>* latency_histogram;
+    bool m_latency_histogram_isSet;
+
+    QList<qint32>* jitter_histogram;
+    bool m_jitter_histogram_isSet;
+
+    QList<qint32>* late_histogram;
+    bool m_late_histogram_isSet;
+
 };
 
 }
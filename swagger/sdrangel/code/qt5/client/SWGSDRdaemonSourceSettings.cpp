@@ -40,6 +40,8 @@ SWGSDRdaemonSourceSettings::SWGSDRdaemonSourceSettings() {
     m_dc_block_isSet = false;
     iq_correction = 0;
     m_iq_correction_isSet = false;
+    low_latency = 0;
+    m_low_latency_isSet = false;
     file_record_name = nullptr;
     m_file_record_name_isSet = false;
     use_reverse_api = 0;
@@ -70,6 +72,8 @@ SWGSDRdaemonSourceSettings::init() {
     m_dc_block_isSet = false;
     iq_correction = 0;
     m_iq_correction_isSet = false;
+    low_latency = 0;
+    m_low_latency_isSet = false;
     file_record_name = new QString("");
     m_file_record_name_isSet = false;
     use_reverse_api = 0;
@@ -94,6 +98,7 @@ SWGSDRdaemonSourceSettings::cleanup() {
 
 
 
+
     if(file_record_name != nullptr) { 
         delete file_record_name;
     }
@@ -128,6 +133,8 @@ SWGSDRdaemonSourceSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&iq_correction, pJson["iqCorrection"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&low_latency, pJson["lowLatency"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&file_record_name, pJson["fileRecordName"], "QString", "QString");
     
     ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
@@ -172,6 +179,9 @@ SWGSDRdaemonSourceSettings::asJsonObject() {
     if(m_iq_correction_isSet){
         obj->insert("iqCorrection", QJsonValue(iq_correction));
     }
+    if(m_low_latency_isSet){
+        obj->insert("lowLatency", QJsonValue(low_latency));
+    }
     if(file_record_name != nullptr && *file_record_name != QString("")){
         toJsonValue(QString("fileRecordName"), file_record_name, obj, QString("QString"));
     }
@@ -251,6 +261,16 @@ SWGSDRdaemonSourceSettings::setIqCorrection(qint32 iq_correction) {
     this->m_iq_correction_isSet = true;
 }
 
+qint32
+SWGSDRdaemonSourceSettings::getLowLatency() {
+    return low_latency;
+}
+void
+SWGSDRdaemonSourceSettings::setLowLatency(qint32 low_latency) {
+    this->low_latency = low_latency;
+    this->m_low_latency_isSet = true;
+}
+
 QString*
 SWGSDRdaemonSourceSettings::getFileRecordName() {
     return file_record_name;
@@ -312,6 +332,7 @@ SWGSDRdaemonSourceSettings::isSet(){
         if(m_data_port_isSet){ isObjectUpdated = true; break;}
         if(m_dc_block_isSet){ isObjectUpdated = true; break;}
         if(m_iq_correction_isSet){ isObjectUpdated = true; break;}
+        if(m_low_latency_isSet){ isObjectUpdated = true; break;}
         if(file_record_name != nullptr && *file_record_name != QString("")){ isObjectUpdated = true; break;}
         if(m_use_reverse_api_isSet){ isObjectUpdated = true; break;}
         if(reverse_api_address != nullptr && *reverse_api_address != QString("")){ isObjectUpdated = true; break;}
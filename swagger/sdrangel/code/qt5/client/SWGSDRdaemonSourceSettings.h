@@ -60,6 +60,9 @@ public:
     qint32 getIqCorrection();
     void setIqCorrection(qint32 iq_correction);
 
+    qint32 getLowLatency();
+    void setLowLatency(qint32 low_latency);
+
     QString* getFileRecordName();
     void setFileRecordName(QString* file_record_name);
 
@@ -97,6 +100,9 @@ private:
     qint32 iq_correction;
     bool m_iq_correction_isSet;
 
+    qint32 low_latency;
+    bool m_low_latency_isSet;
+
     QString* file_record_name;
     bool m_file_record_name_isSet;
 
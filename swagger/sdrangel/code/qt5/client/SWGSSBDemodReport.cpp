@@ -36,6 +36,8 @@ SWGSSBDemodReport::SWGSSBDemodReport() {
     m_audio_sample_rate_isSet = false;
     channel_sample_rate = 0;
     m_channel_sample_rate_isSet = false;
+    audio_latency = 0.0f;
+    m_audio_latency_isSet = false;
 }
 
 SWGSSBDemodReport::~SWGSSBDemodReport() {
@@ -52,6 +54,8 @@ SWGSSBDemodReport::init() {
     m_audio_sample_rate_isSet = false;
     channel_sample_rate = 0;
     m_channel_sample_rate_isSet = false;
+    audio_latency = 0.0f;
+    m_audio_latency_isSet = false;
 }
 
 void
@@ -60,6 +64,7 @@ SWGSSBDemodReport::cleanup() {
 
 
 
+
 }
 
 SWGSSBDemodReport*
@@ -81,6 +86,8 @@ SWGSSBDemodReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&channel_sample_rate, pJson["channelSampleRate"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&audio_latency, pJson["audioLatency"], "float", "");
+    
 }
 
 QString
@@ -109,6 +116,9 @@ SWGSSBDemodReport::asJsonObject() {
     if(m_channel_sample_rate_isSet){
         obj->insert("channelSampleRate", QJsonValue(channel_sample_rate));
     }
+    if(m_audio_latency_isSet){
+        obj->insert("audioLatency", QJsonValue(audio_latency));
+    }
 
     return obj;
 }
@@ -153,6 +163,16 @@ SWGSSBDemodReport::setChannelSampleRate(qint32 channel_sample_rate) {
     this->m_channel_sample_rate_isSet = true;
 }
 
+float
+SWGSSBDemodReport::getAudioLatency() {
+    return audio_latency;
+}
+void
+SWGSSBDemodReport::setAudioLatency(float audio_latency) {
+    this->audio_latency = audio_latency;
+    this->m_audio_latency_isSet = true;
+}
+
 
 bool
 SWGSSBDemodReport::isSet(){
@@ -162,6 +182,7 @@ SWGSSBDemodReport::isSet(){
         if(m_squelch_isSet){ isObjectUpdated = true; break;}
         if(m_audio_sample_rate_isSet){ isObjectUpdated = true; break;}
         if(m_channel_sample_rate_isSet){ isObjectUpdated = true; break;}
+        if(m_audio_latency_isSet){ isObjectUpdated = true; break;}
     }while(false);
     return isObjectUpdated;
 }
@@ -0,0 +1,318 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGSpectrumArchiveData.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGSpectrumArchiveData::SWGSpectrumArchiveData(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGSpectrumArchiveData::SWGSpectrumArchiveData() {
+    start_time = 0L;
+    m_start_time_isSet = false;
+    end_time = 0L;
+    m_end_time_isSet = false;
+    start_frequency = 0L;
+    m_start_frequency_isSet = false;
+    end_frequency = 0L;
+    m_end_frequency_isSet = false;
+    nb_rows = 0;
+    m_nb_rows_isSet = false;
+    nb_columns = 0;
+    m_nb_columns_isSet = false;
+    nb_archive_rows = 0;
+    m_nb_archive_rows_isSet = false;
+    db_max = 0.0f;
+    m_db_max_isSet = false;
+    db_step = 0.0f;
+    m_db_step_isSet = false;
+    no_data = 0;
+    m_no_data_isSet = false;
+    data = nullptr;
+    m_data_isSet = false;
+}
+
+SWGSpectrumArchiveData::~SWGSpectrumArchiveData() {
+    this->cleanup();
+}
+
+void
+SWGSpectrumArchiveData::init() {
+    start_time = 0L;
+    m_start_time_isSet = false;
+    end_time = 0L;
+    m_end_time_isSet = false;
+    start_frequency = 0L;
+    m_start_frequency_isSet = false;
+    end_frequency = 0L;
+    m_end_frequency_isSet = false;
+    nb_rows = 0;
+    m_nb_rows_isSet = false;
+    nb_columns = 0;
+    m_nb_columns_isSet = false;
+    nb_archive_rows = 0;
+    m_nb_archive_rows_isSet = false;
+    db_max = 0.0f;
+    m_db_max_isSet = false;
+    db_step = 0.0f;
+    m_db_step_isSet = false;
+    no_data = 0;
+    m_no_data_isSet = false;
+    data = new QString("");
+    m_data_isSet = false;
+}
+
+void
+SWGSpectrumArchiveData::cleanup() {
+
+
+
+
+
+
+
+
+
+
+    if(data != nullptr) { 
+        delete data;
+    }
+}
+
+SWGSpectrumArchiveData*
+SWGSpectrumArchiveData::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGSpectrumArchiveData::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&start_time, pJson["startTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&end_time, pJson["endTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&start_frequency, pJson["startFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&end_frequency, pJson["endFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&nb_rows, pJson["nbRows"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nb_columns, pJson["nbColumns"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nb_archive_rows, pJson["nbArchiveRows"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&db_max, pJson["dbMax"], "float", "");
+    
+    ::SWGSDRangel::setValue(&db_step, pJson["dbStep"], "float", "");
+    
+    ::SWGSDRangel::setValue(&no_data, pJson["noData"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&data, pJson["data"], "QString", "QString");
+    
+}
+
+QString
+SWGSpectrumArchiveData::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGSpectrumArchiveData::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_start_time_isSet){
+        obj->insert("startTime", QJsonValue(start_time));
+    }
+    if(m_end_time_isSet){
+        obj->insert("endTime", QJsonValue(end_time));
+    }
+    if(m_start_frequency_isSet){
+        obj->insert("startFrequency", QJsonValue(start_frequency));
+    }
+    if(m_end_frequency_isSet){
+        obj->insert("endFrequency", QJsonValue(end_frequency));
+    }
+    if(m_nb_rows_isSet){
+        obj->insert("nbRows", QJsonValue(nb_rows));
+    }
+    if(m_nb_columns_isSet){
+        obj->insert("nbColumns", QJsonValue(nb_columns));
+    }
+    if(m_nb_archive_rows_isSet){
+        obj->insert("nbArchiveRows", QJsonValue(nb_archive_rows));
+    }
+    if(m_db_max_isSet){
+        obj->insert("dbMax", QJsonValue(db_max));
+    }
+    if(m_db_step_isSet){
+        obj->insert("dbStep", QJsonValue(db_step));
+    }
+    if(m_no_data_isSet){
+        obj->insert("noData", QJsonValue(no_data));
+    }
+    if(data != nullptr && *data != QString("")){
+        toJsonValue(QString("data"), data, obj, QString("QString"));
+    }
+
+    return obj;
+}
+
+qint64
+SWGSpectrumArchiveData::getStartTime() {
+    return start_time;
+}
+void
+SWGSpectrumArchiveData::setStartTime(qint64 start_time) {
+    this->start_time = start_time;
+    this->m_start_time_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveData::getEndTime() {
+    return end_time;
+}
+void
+SWGSpectrumArchiveData::setEndTime(qint64 end_time) {
+    this->end_time = end_time;
+    this->m_end_time_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveData::getStartFrequency() {
+    return start_frequency;
+}
+void
+SWGSpectrumArchiveData::setStartFrequency(qint64 start_frequency) {
+    this->start_frequency = start_frequency;
+    this->m_start_frequency_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveData::getEndFrequency() {
+    return end_frequency;
+}
+void
+SWGSpectrumArchiveData::setEndFrequency(qint64 end_frequency) {
+    this->end_frequency = end_frequency;
+    this->m_end_frequency_isSet = true;
+}
+
+qint32
+SWGSpectrumArchiveData::getNbRows() {
+    return nb_rows;
+}
+void
+SWGSpectrumArchiveData::setNbRows(qint32 nb_rows) {
+    this->nb_rows = nb_rows;
+    this->m_nb_rows_isSet = true;
+}
+
+qint32
+SWGSpectrumArchiveData::getNbColumns() {
+    return nb_columns;
+}
+void
+SWGSpectrumArchiveData::setNbColumns(qint32 nb_columns) {
+    this->nb_columns = nb_columns;
+    this->m_nb_columns_isSet = true;
+}
+
+qint32
+SWGSpectrumArchiveData::getNbArchiveRows() {
+    return nb_archive_rows;
+}
+void
+SWGSpectrumArchiveData::setNbArchiveRows(qint32 nb_archive_rows) {
+    this->nb_archive_rows = nb_archive_rows;
+    this->m_nb_archive_rows_isSet = true;
+}
+
+float
+SWGSpectrumArchiveData::getDbMax() {
+    return db_max;
+}
+void
+SWGSpectrumArchiveData::setDbMax(float db_max) {
+    this->db_max = db_max;
+    this->m_db_max_isSet = true;
+}
+
+float
+SWGSpectrumArchiveData::getDbStep() {
+    return db_step;
+}
+void
+SWGSpectrumArchiveData::setDbStep(float db_step) {
+    this->db_step = db_step;
+    this->m_db_step_isSet = true;
+}
+
+qint32
+SWGSpectrumArchiveData::getNoData() {
+    return no_data;
+}
+void
+SWGSpectrumArchiveData::setNoData(qint32 no_data) {
+    this->no_data = no_data;
+    this->m_no_data_isSet = true;
+}
+
+QString*
+SWGSpectrumArchiveData::getData() {
+    return data;
+}
+void
+SWGSpectrumArchiveData::setData(QString* data) {
+    this->data = data;
+    this->m_data_isSet = true;
+}
+
+
+bool
+SWGSpectrumArchiveData::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_start_time_isSet){ isObjectUpdated = true; break;}
+        if(m_end_time_isSet){ isObjectUpdated = true; break;}
+        if(m_start_frequency_isSet){ isObjectUpdated = true; break;}
+        if(m_end_frequency_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_rows_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_columns_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_archive_rows_isSet){ isObjectUpdated = true; break;}
+        if(m_db_max_isSet){ isObjectUpdated = true; break;}
+        if(m_db_step_isSet){ isObjectUpdated = true; break;}
+        if(m_no_data_isSet){ isObjectUpdated = true; break;}
+        if(data != nullptr && *data != QString("")){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,119 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGSpectrumArchiveData.h
+ *
+ * Time x frequency window of the spectrum history
+ */
+
+#ifndef SWGSpectrumArchiveData_H_
+#define SWGSpectrumArchiveData_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGSpectrumArchiveData: public SWGObject {
+public:
+    SWGSpectrumArchiveData();
+    SWGSpectrumArchiveData(QString* json);
+    virtual ~SWGSpectrumArchiveData();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGSpectrumArchiveData* fromJson(QString &jsonString) override;
+
+    qint64 getStartTime();
+    void setStartTime(qint64 start_time);
+
+    qint64 getEndTime();
+    void setEndTime(qint64 end_time);
+
+    qint64 getStartFrequency();
+    void setStartFrequency(qint64 start_frequency);
+
+    qint64 getEndFrequency();
+    void setEndFrequency(qint64 end_frequency);
+
+    qint32 getNbRows();
+    void setNbRows(qint32 nb_rows);
+
+    qint32 getNbColumns();
+    void setNbColumns(qint32 nb_columns);
+
+    qint32 getNbArchiveRows();
+    void setNbArchiveRows(qint32 nb_archive_rows);
+
+    float getDbMax();
+    void setDbMax(float db_max);
+
+    float getDbStep();
+    void setDbStep(float db_step);
+
+    qint32 getNoData();
+    void setNoData(qint32 no_data);
+
+    QString* getData();
+    void setData(QString* data);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint64 start_time;
+    bool m_start_time_isSet;
+
+    qint64 end_time;
+    bool m_end_time_isSet;
+
+    qint64 start_frequency;
+    bool m_start_frequency_isSet;
+
+    qint64 end_frequency;
+    bool m_end_frequency_isSet;
+
+    qint32 nb_rows;
+    bool m_nb_rows_isSet;
+
+    qint32 nb_columns;
+    bool m_nb_columns_isSet;
+
+    qint32 nb_archive_rows;
+    bool m_nb_archive_rows_isSet;
+
+    float db_max;
+    bool m_db_max_isSet;
+
+    float db_step;
+    bool m_db_step_isSet;
+
+    qint32 no_data;
+    bool m_no_data_isSet;
+
+    QString* data;
+    bool m_data_isSet;
+
+};
+
+}
+
+#endif /* SWGSpectrumArchiveData_H_ */
@@ -0,0 +1,129 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGSpectrumArchiveSettings.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGSpectrumArchiveSettings::SWGSpectrumArchiveSettings(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGSpectrumArchiveSettings::SWGSpectrumArchiveSettings() {
+    directory = nullptr;
+    m_directory_isSet = false;
+    row_period = 0;
+    m_row_period_isSet = false;
+}
+
+SWGSpectrumArchiveSettings::~SWGSpectrumArchiveSettings() {
+    this->cleanup();
+}
+
+void
+SWGSpectrumArchiveSettings::init() {
+    directory = new QString("");
+    m_directory_isSet = false;
+    row_period = 0;
+    m_row_period_isSet = false;
+}
+
+void
+SWGSpectrumArchiveSettings::cleanup() {
+    if(directory != nullptr) { 
+        delete directory;
+    }
+
+}
+
+SWGSpectrumArchiveSettings*
+SWGSpectrumArchiveSettings::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGSpectrumArchiveSettings::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&directory, pJson["directory"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&row_period, pJson["rowPeriod"], "qint32", "");
+    
+}
+
+QString
+SWGSpectrumArchiveSettings::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGSpectrumArchiveSettings::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(directory != nullptr && *directory != QString("")){
+        toJsonValue(QString("directory"), directory, obj, QString("QString"));
+    }
+    if(m_row_period_isSet){
+        obj->insert("rowPeriod", QJsonValue(row_period));
+    }
+
+    return obj;
+}
+
+QString*
+SWGSpectrumArchiveSettings::getDirectory() {
+    return directory;
+}
+void
+SWGSpectrumArchiveSettings::setDirectory(QString* directory) {
+    this->directory = directory;
+    this->m_directory_isSet = true;
+}
+
+qint32
+SWGSpectrumArchiveSettings::getRowPeriod() {
+    return row_period;
+}
+void
+SWGSpectrumArchiveSettings::setRowPeriod(qint32 row_period) {
+    this->row_period = row_period;
+    this->m_row_period_isSet = true;
+}
+
+
+bool
+SWGSpectrumArchiveSettings::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(directory != nullptr && *directory != QString("")){ isObjectUpdated = true; break;}
+        if(m_row_period_isSet){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,234 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGSpectrumArchiveStatus.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGSpectrumArchiveStatus::SWGSpectrumArchiveStatus(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGSpectrumArchiveStatus::SWGSpectrumArchiveStatus() {
+    recording = 0;
+    m_recording_isSet = false;
+    directory = nullptr;
+    m_directory_isSet = false;
+    row_period = 0;
+    m_row_period_isSet = false;
+    start_time = 0L;
+    m_start_time_isSet = false;
+    end_time = 0L;
+    m_end_time_isSet = false;
+    nb_rows = 0L;
+    m_nb_rows_isSet = false;
+    data_size = 0L;
+    m_data_size_isSet = false;
+}
+
+SWGSpectrumArchiveStatus::~SWGSpectrumArchiveStatus() {
+    this->cleanup();
+}
+
+void
+SWGSpectrumArchiveStatus::init() {
+    recording = 0;
+    m_recording_isSet = false;
+    directory = new QString("");
+    m_directory_isSet = false;
+    row_period = 0;
+    m_row_period_isSet = false;
+    start_time = 0L;
+    m_start_time_isSet = false;
+    end_time = 0L;
+    m_end_time_isSet = false;
+    nb_rows = 0L;
+    m_nb_rows_isSet = false;
+    data_size = 0L;
+    m_data_size_isSet = false;
+}
+
+void
+SWGSpectrumArchiveStatus::cleanup() {
+
+    if(directory != nullptr) { 
+        delete directory;
+    }
+
+
+
+
+
+}
+
+SWGSpectrumArchiveStatus*
+SWGSpectrumArchiveStatus::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGSpectrumArchiveStatus::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&recording, pJson["recording"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&directory, pJson["directory"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&row_period, pJson["rowPeriod"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&start_time, pJson["startTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&end_time, pJson["endTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&nb_rows, pJson["nbRows"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&data_size, pJson["dataSize"], "qint64", "");
+    
+}
+
+QString
+SWGSpectrumArchiveStatus::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGSpectrumArchiveStatus::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_recording_isSet){
+        obj->insert("recording", QJsonValue(recording));
+    }
+    if(directory != nullptr && *directory != QString("")){
+        toJsonValue(QString("directory"), directory, obj, QString("QString"));
+    }
+    if(m_row_period_isSet){
+        obj->insert("rowPeriod", QJsonValue(row_period));
+    }
+    if(m_start_time_isSet){
+        obj->insert("startTime", QJsonValue(start_time));
+    }
+    if(m_end_time_isSet){
+        obj->insert("endTime", QJsonValue(end_time));
+    }
+    if(m_nb_rows_isSet){
+        obj->insert("nbRows", QJsonValue(nb_rows));
+    }
+    if(m_data_size_isSet){
+        obj->insert("dataSize", QJsonValue(data_size));
+    }
+
+    return obj;
+}
+
+qint32
+SWGSpectrumArchiveStatus::getRecording() {
+    return recording;
+}
+void
+SWGSpectrumArchiveStatus::setRecording(qint32 recording) {
+    this->recording = recording;
+    this->m_recording_isSet = true;
+}
+
+QString*
+SWGSpectrumArchiveStatus::getDirectory() {
+    return directory;
+}
+void
+SWGSpectrumArchiveStatus::setDirectory(QString* directory) {
+    this->directory = directory;
+    this->m_directory_isSet = true;
+}
+
+qint32
+SWGSpectrumArchiveStatus::getRowPeriod() {
+    return row_period;
+}
+void
+SWGSpectrumArchiveStatus::setRowPeriod(qint32 row_period) {
+    this->row_period = row_period;
+    this->m_row_period_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveStatus::getStartTime() {
+    return start_time;
+}
+void
+SWGSpectrumArchiveStatus::setStartTime(qint64 start_time) {
+    this->start_time = start_time;
+    this->m_start_time_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveStatus::getEndTime() {
+    return end_time;
+}
+void
+SWGSpectrumArchiveStatus::setEndTime(qint64 end_time) {
+    this->end_time = end_time;
+    this->m_end_time_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveStatus::getNbRows() {
+    return nb_rows;
+}
+void
+SWGSpectrumArchiveStatus::setNbRows(qint64 nb_rows) {
+    this->nb_rows = nb_rows;
+    this->m_nb_rows_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveStatus::getDataSize() {
+    return data_size;
+}
+void
+SWGSpectrumArchiveStatus::setDataSize(qint64 data_size) {
+    this->data_size = data_size;
+    this->m_data_size_isSet = true;
+}
+
+
+bool
+SWGSpectrumArchiveStatus::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_recording_isSet){ isObjectUpdated = true; break;}
+        if(directory != nullptr && *directory != QString("")){ isObjectUpdated = true; break;}
+        if(m_row_period_isSet){ isObjectUpdated = true; break;}
+        if(m_start_time_isSet){ isObjectUpdated = true; break;}
+        if(m_end_time_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_rows_isSet){ isObjectUpdated = true; break;}
+        if(m_data_size_isSet){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
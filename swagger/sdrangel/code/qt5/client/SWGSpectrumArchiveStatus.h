@@ -0,0 +1,95 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGSpectrumArchiveStatus.h
+ *
+ * Spectrum archive recording state and extent
+ */
+
+#ifndef SWGSpectrumArchiveStatus_H_
+#define SWGSpectrumArchiveStatus_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGSpectrumArchiveStatus: public SWGObject {
+public:
+    SWGSpectrumArchiveStatus();
+    SWGSpectrumArchiveStatus(QString* json);
+    virtual ~SWGSpectrumArchiveStatus();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGSpectrumArchiveStatus* fromJson(QString &jsonString) override;
+
+    qint32 getRecording();
+    void setRecording(qint32 recording);
+
+    QString* getDirectory();
+    void setDirectory(QString* directory);
+
+    qint32 getRowPeriod();
+    void setRowPeriod(qint32 row_period);
+
+    qint64 getStartTime();
+    void setStartTime(qint64 start_time);
+
+    qint64 getEndTime();
+    void setEndTime(qint64 end_time);
+
+    qint64 getNbRows();
+    void setNbRows(qint64 nb_rows);
+
+    qint64 getDataSize();
+    void setDataSize(qint64 data_size);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 recording;
+    bool m_recording_isSet;
+
+    QString* directory;
+    bool m_directory_isSet;
+
+    qint32 row_period;
+    bool m_row_period_isSet;
+
+    qint64 start_time;
+    bool m_start_time_isSet;
+
+    qint64 end_time;
+    bool m_end_time_isSet;
+
+    qint64 nb_rows;
+    bool m_nb_rows_isSet;
+
+    qint64 data_size;
+    bool m_data_size_isSet;
+
+};
+
+}
+
+#endif /* SWGSpectrumArchiveStatus_H_ */
@@ -0,0 +1,213 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGSpectrumScannerData.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGSpectrumScannerData::SWGSpectrumScannerData(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGSpectrumScannerData::SWGSpectrumScannerData() {
+    sweep_count = 0;
+    m_sweep_count_isSet = false;
+    start_frequency = 0L;
+    m_start_frequency_isSet = false;
+    bin_width = 0.0f;
+    m_bin_width_isSet = false;
+    nb_bins = 0;
+    m_nb_bins_isSet = false;
+    no_data = 0.0f;
+    m_no_data_isSet = false;
+    power = nullptr;
+    m_power_isSet = false;
+}
+
+SWGSpectrumScannerData::~SWGSpectrumScannerData() {
+    this->cleanup();
+}
+
+void
+SWGSpectrumScannerData::init() {
+    sweep_count = 0;
+    m_sweep_count_isSet = false;
+    start_frequency = 0L;
+    m_start_frequency_isSet = false;
+    bin_width = 0.0f;
+    m_bin_width_isSet = false;
+    nb_bins = 0;
+    m_nb_bins_isSet = false;
+    no_data = 0.0f;
+    m_no_data_isSet = false;
+    power = new QList<float>();
+    m_power_isSet = false;
+}
+
+void
+SWGSpectrumScannerData::cleanup() {
+
+
+
+
+
+    if(power != nullptr) { 
+        delete power;
+    }
+}
+
+SWGSpectrumScannerData*
+SWGSpectrumScannerData::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGSpectrumScannerData::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&sweep_count, pJson["sweepCount"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&start_frequency, pJson["startFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&bin_width, pJson["binWidth"], "float", "");
+    
+    ::SWGSDRangel::setValue(&nb_bins, pJson["nbBins"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&no_data, pJson["noData"], "float", "");
+    
+    
+    ::SWGSDRangel::setValue(&power, pJson["power"], "QList", "float");
+}
+
+QString
+SWGSpectrumScannerData::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGSpectrumScannerData::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_sweep_count_isSet){
+        obj->insert("sweepCount", QJsonValue(sweep_count));
+    }
+    if(m_start_frequency_isSet){
+        obj->insert("startFrequency", QJsonValue(start_frequency));
+    }
+    if(m_bin_width_isSet){
+        obj->insert("binWidth", QJsonValue(bin_width));
+    }
+    if(m_nb_bins_isSet){
+        obj->insert("nbBins", QJsonValue(nb_bins));
+    }
+    if(m_no_data_isSet){
+        obj->insert("noData", QJsonValue(no_data));
+    }
+    if(power->size() > 0){
+        toJsonArray((QList<void*>*)power, obj, "power", "float");
+    }
+
+    return obj;
+}
+
+qint32
+SWGSpectrumScannerData::getSweepCount() {
+    return sweep_count;
+}
+void
+SWGSpectrumScannerData::setSweepCount(qint32 sweep_count) {
+    this->sweep_count = sweep_count;
+    this->m_sweep_count_isSet = true;
+}
+
+qint64
+SWGSpectrumScannerData::getStartFrequency() {
+    return start_frequency;
+}
+void
+SWGSpectrumScannerData::setStartFrequency(qint64 start_frequency) {
+    this->start_frequency = start_frequency;
+    this->m_start_frequency_isSet = true;
+}
+
+float
+SWGSpectrumScannerData::getBinWidth() {
+    return bin_width;
+}
+void
+SWGSpectrumScannerData::setBinWidth(float bin_width) {
+    this->bin_width = bin_width;
+    this->m_bin_width_isSet = true;
+}
+
+qint32
+SWGSpectrumScannerData::getNbBins() {
+    return nb_bins;
+}
+void
+SWGSpectrumScannerData::setNbBins(qint32 nb_bins) {
+    this->nb_bins = nb_bins;
+    this->m_nb_bins_isSet = true;
+}
+
+float
+SWGSpectrumScannerData::getNoData() {
+    return no_data;
+}
+void
+SWGSpectrumScannerData::setNoData(float no_data) {
+    this->no_data = no_data;
+    this->m_no_data_isSet = true;
+}
+
+QList<float>*
+SWGSpectrumScannerData::getPower() {
+    return power;
+}
+void
+SWGSpectrumScannerData::setPower(QList<float>* power) {
+    this->power = power;
+    this->m_power_isSet = true;
+}
+
+
+bool
+SWGSpectrumScannerData::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_sweep_count_isSet){ isObjectUpdated = true; break;}
+        if(m_start_frequency_isSet){ isObjectUpdated = true; break;}
+        if(m_bin_width_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_bins_isSet){ isObjectUpdated = true; break;}
+        if(m_no_data_isSet){ isObjectUpdated = true; break;}
+        if(power->size() > 0){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,89 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGSpectrumScannerData.h
+ *
+ * Power spectrum of the last complete sweep
+ */
+
+#ifndef SWGSpectrumScannerData_H_
+#define SWGSpectrumScannerData_H_
+
+#include <QJsonObject>
+
+
+#include <QList>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGSpectrumScannerData: public SWGObject {
+public:
+    SWGSpectrumScannerData();
+    SWGSpectrumScannerData(QString* json);
+    virtual ~SWGSpectrumScannerData();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGSpectrumScannerData* fromJson(QString &jsonString) override;
+
+    qint32 getSweepCount();
+    void setSweepCount(qint32 sweep_count);
+
+    qint64 getStartFrequency();
+    void setStartFrequency(qint64 start_frequency);
+
+    float getBinWidth();
+    void setBinWidth(float bin_width);
+
+    qint32 getNbBins();
+    void setNbBins(qint32 nb_bins);
+
+    float getNoData();
+    void setNoData(float no_data);
+
+    QList<float>* getPower();
+    void setPower(QList<float>* power);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 sweep_count;
+    bool m_sweep_count_isSet;
+
+    qint64 start_frequency;
+    bool m_start_frequency_isSet;
+
+    float bin_width;
+    bool m_bin_width_isSet;
+
+    qint32 nb_bins;
+    bool m_nb_bins_isSet;
+
+    float no_data;
+    bool m_no_data_isSet;
+
+    QList<float>* power;
+    bool m_power_isSet;
+
+};
+
+}
+
+#endif /* SWGSpectrumScannerData_H_ */
@@ -0,0 +1,316 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGSpectrumScannerSettings.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGSpectrumScannerSettings::SWGSpectrumScannerSettings(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGSpectrumScannerSettings::SWGSpectrumScannerSettings() {
+    start_frequency = 0L;
+    m_start_frequency_isSet = false;
+    end_frequency = 0L;
+    m_end_frequency_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    averages = 0;
+    m_averages_isSet = false;
+    usable_bandwidth = 0.0f;
+    m_usable_bandwidth_isSet = false;
+    overlap = 0.0f;
+    m_overlap_isSet = false;
+    settling_time = 0;
+    m_settling_time_isSet = false;
+    retune_timeout = 0;
+    m_retune_timeout_isSet = false;
+    window = 0;
+    m_window_isSet = false;
+    workers = 0;
+    m_workers_isSet = false;
+    continuous = 0;
+    m_continuous_isSet = false;
+}
+
+SWGSpectrumScannerSettings::~SWGSpectrumScannerSettings() {
+    this->cleanup();
+}
+
+void
+SWGSpectrumScannerSettings::init() {
+    start_frequency = 0L;
+    m_start_frequency_isSet = false;
+    end_frequency = 0L;
+    m_end_frequency_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    averages = 0;
+    m_averages_isSet = false;
+    usable_bandwidth = 0.0f;
+    m_usable_bandwidth_isSet = false;
+    overlap = 0.0f;
+    m_overlap_isSet = false;
+    settling_time = 0;
+    m_settling_time_isSet = false;
+    retune_timeout = 0;
+    m_retune_timeout_isSet = false;
+    window = 0;
+    m_window_isSet = false;
+    workers = 0;
+    m_workers_isSet = false;
+    continuous = 0;
+    m_continuous_isSet = false;
+}
+
+void
+SWGSpectrumScannerSettings::cleanup() {
+
+
+
+
+
+
+
+
+
+
+
+}
+
+SWGSpectrumScannerSettings*
+SWGSpectrumScannerSettings::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGSpectrumScannerSettings::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&start_frequency, pJson["startFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&end_frequency, pJson["endFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&fft_size, pJson["fftSize"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&averages, pJson["averages"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&usable_bandwidth, pJson["usableBandwidth"], "float", "");
+    
+    ::SWGSDRangel::setValue(&overlap, pJson["overlap"], "float", "");
+    
+    ::SWGSDRangel::setValue(&settling_time, pJson["settlingTime"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&retune_timeout, pJson["retuneTimeout"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&window, pJson["window"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&workers, pJson["workers"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&continuous, pJson["continuous"], "qint32", "");
+    
+}
+
+QString
+SWGSpectrumScannerSettings::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGSpectrumScannerSettings::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_start_frequency_isSet){
+        obj->insert("startFrequency", QJsonValue(start_frequency));
+    }
+    if(m_end_frequency_isSet){
+        obj->insert("endFrequency", QJsonValue(end_frequency));
+    }
+    if(m_fft_size_isSet){
+        obj->insert("fftSize", QJsonValue(fft_size));
+    }
+    if(m_averages_isSet){
+        obj->insert("averages", QJsonValue(averages));
+    }
+    if(m_usable_bandwidth_isSet){
+        obj->insert("usableBandwidth", QJsonValue(usable_bandwidth));
+    }
+    if(m_overlap_isSet){
+        obj->insert("overlap", QJsonValue(overlap));
+    }
+    if(m_settling_time_isSet){
+        obj->insert("settlingTime", QJsonValue(settling_time));
+    }
+    if(m_retune_timeout_isSet){
+        obj->insert("retuneTimeout", QJsonValue(retune_timeout));
+    }
+    if(m_window_isSet){
+        obj->insert("window", QJsonValue(window));
+    }
+    if(m_workers_isSet){
+        obj->insert("workers", QJsonValue(workers));
+    }
+    if(m_continuous_isSet){
+        obj->insert("continuous", QJsonValue(continuous));
+    }
+
+    return obj;
+}
+
+qint64
+SWGSpectrumScannerSettings::getStartFrequency() {
+    return start_frequency;
+}
+void
+SWGSpectrumScannerSettings::setStartFrequency(qint64 start_frequency) {
+    this->start_frequency = start_frequency;
+    this->m_start_frequency_isSet = true;
+}
+
+qint64
+SWGSpectrumScannerSettings::getEndFrequency() {
+    return end_frequency;
+}
+void
+SWGSpectrumScannerSettings::setEndFrequency(qint64 end_frequency) {
+    this->end_frequency = end_frequency;
+    this->m_end_frequency_isSet = true;
+}
+
+qint32
+SWGSpectrumScannerSettings::getFftSize() {
+    return fft_size;
+}
+void
+SWGSpectrumScannerSettings::setFftSize(qint32 fft_size) {
+    this->fft_size = fft_size;
+    this->m_fft_size_isSet = true;
+}
+
+qint32
+SWGSpectrumScannerSettings::getAverages() {
+    return averages;
+}
+void
+SWGSpectrumScannerSettings::setAverages(qint32 averages) {
+    this->averages = averages;
+    this->m_averages_isSet = true;
+}
+
+float
+SWGSpectrumScannerSettings::getUsableBandwidth() {
+    return usable_bandwidth;
+}
+void
+SWGSpectrumScannerSettings::setUsableBandwidth(float usable_bandwidth) {
+    this->usable_bandwidth = usable_bandwidth;
+    this->m_usable_bandwidth_isSet = true;
+}
+
+float
+SWGSpectrumScannerSettings::getOverlap() {
+    return overlap;
+}
+void
+SWGSpectrumScannerSettings::setOverlap(float overlap) {
+    this->overlap = overlap;
+    this->m_overlap_isSet = true;
+}
+
+qint32
+SWGSpectrumScannerSettings::getSettlingTime() {
+    return settling_time;
+}
+void
+SWGSpectrumScannerSettings::setSettlingTime(qint32 settling_time) {
+    this->settling_time = settling_time;
+    this->m_settling_time_isSet = true;
+}
+
+qint32
+SWGSpectrumScannerSettings::getRetuneTimeout() {
+    return retune_timeout;
+}
+void
+SWGSpectrumScannerSettings::setRetuneTimeout(qint32 retune_timeout) {
+    this->retune_timeout = retune_timeout;
+    this->m_retune_timeout_isSet = true;
+}
+
+qint32
+SWGSpectrumScannerSettings::getWindow() {
+    return window;
+}
+void
+SWGSpectrumScannerSettings::setWindow(qint32 window) {
+    this->window = window;
+    this->m_window_isSet = true;
+}
+
+qint32
+SWGSpectrumScannerSettings::getWorkers() {
+    return workers;
+}
+void
+SWGSpectrumScannerSettings::setWorkers(qint32 workers) {
+    this->workers = workers;
+    this->m_workers_isSet = true;
+}
+
+qint32
+SWGSpectrumScannerSettings::getContinuous() {
+    return continuous;
+}
+void
+SWGSpectrumScannerSettings::setContinuous(qint32 continuous) {
+    this->continuous = continuous;
+    this->m_continuous_isSet = true;
+}
+
+
+bool
+SWGSpectrumScannerSettings::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_start_frequency_isSet){ isObjectUpdated = true; break;}
+        if(m_end_frequency_isSet){ isObjectUpdated = true; break;}
+        if(m_fft_size_isSet){ isObjectUpdated = true; break;}
+        if(m_averages_isSet){ isObjectUpdated = true; break;}
+        if(m_usable_bandwidth_isSet){ isObjectUpdated = true; break;}
+        if(m_overlap_isSet){ isObjectUpdated = true; break;}
+        if(m_settling_time_isSet){ isObjectUpdated = true; break;}
+        if(m_retune_timeout_isSet){ isObjectUpdated = true; break;}
+        if(m_window_isSet){ isObjectUpdated = true; break;}
+        if(m_workers_isSet){ isObjectUpdated = true; break;}
+        if(m_continuous_isSet){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,118 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGSpectrumScannerSettings.h
+ *
+ * Spectrum scanner settings
+ */
+
+#ifndef SWGSpectrumScannerSettings_H_
+#define SWGSpectrumScannerSettings_H_
+
+#include <QJsonObject>
+
+
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGSpectrumScannerSettings: public SWGObject {
+public:
+    SWGSpectrumScannerSettings();
+    SWGSpectrumScannerSettings(QString* json);
+    virtual ~SWGSpectrumScannerSettings();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGSpectrumScannerSettings* fromJson(QString &jsonString) override;
+
+    qint64 getStartFrequency();
+    void setStartFrequency(qint64 start_frequency);
+
+    qint64 getEndFrequency();
+    void setEndFrequency(qint64 end_frequency);
+
+    qint32 getFftSize();
+    void setFftSize(qint32 fft_size);
+
+    qint32 getAverages();
+    void setAverages(qint32 averages);
+
+    float getUsableBandwidth();
+    void setUsableBandwidth(float usable_bandwidth);
+
+    float getOverlap();
+    void setOverlap(float overlap);
+
+    qint32 getSettlingTime();
+    void setSettlingTime(qint32 settling_time);
+
+    qint32 getRetuneTimeout();
+    void setRetuneTimeout(qint32 retune_timeout);
+
+    qint32 getWindow();
+    void setWindow(qint32 window);
+
+    qint32 getWorkers();
+    void setWorkers(qint32 workers);
+
+    qint32 getContinuous();
+    void setContinuous(qint32 continuous);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint64 start_frequency;
+    bool m_start_frequency_isSet;
+
+    qint64 end_frequency;
+    bool m_end_frequency_isSet;
+
+    qint32 fft_size;
+    bool m_fft_size_isSet;
+
+    qint32 averages;
+    bool m_averages_isSet;
+
+    float usable_bandwidth;
+    bool m_usable_bandwidth_isSet;
+
+    float overlap;
+    bool m_overlap_isSet;
+
+    qint32 settling_time;
+    bool m_settling_time_isSet;
+
+    qint32 retune_timeout;
+    bool m_retune_timeout_isSet;
+
+    qint32 window;
+    bool m_window_isSet;
+
+    qint32 workers;
+    bool m_workers_isSet;
+
+    qint32 continuous;
+    bool m_continuous_isSet;
+
+};
+
+}
+
+#endif /* SWGSpectrumScannerSettings_H_ */
@@ -0,0 +1,274 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGSpectrumScannerSweepReport.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGSpectrumScannerSweepReport::SWGSpectrumScannerSweepReport(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGSpectrumScannerSweepReport::SWGSpectrumScannerSweepReport() {
+    nb_steps = 0;
+    m_nb_steps_isSet = false;
+    sweep_time = 0.0f;
+    m_sweep_time_isSet = false;
+    steps_per_second = 0.0f;
+    m_steps_per_second_isSet = false;
+    retune_time = 0.0f;
+    m_retune_time_isSet = false;
+    fft_time = 0.0f;
+    m_fft_time_isSet = false;
+    acquired_samples = 0L;
+    m_acquired_samples_isSet = false;
+    discarded_samples = 0L;
+    m_discarded_samples_isSet = false;
+    nb_timeouts = 0;
+    m_nb_timeouts_isSet = false;
+    max_pending_jobs = 0;
+    m_max_pending_jobs_isSet = false;
+}
+
+SWGSpectrumScannerSweepReport::~SWGSpectrumScannerSweepReport() {
+    this->cleanup();
+}
+
+void
+SWGSpectrumScannerSweepReport::init() {
+    nb_steps = 0;
+    m_nb_steps_isSet = false;
+    sweep_time = 0.0f;
+    m_sweep_time_isSet = false;
+    steps_per_second = 0.0f;
+    m_steps_per_second_isSet = false;
+    retune_time = 0.0f;
+    m_retune_time_isSet = false;
+    fft_time = 0.0f;
+    m_fft_time_isSet = false;
+    acquired_samples = 0L;
+    m_acquired_samples_isSet = false;
+    discarded_samples = 0L;
+    m_discarded_samples_isSet = false;
+    nb_timeouts = 0;
+    m_nb_timeouts_isSet = false;
+    max_pending_jobs = 0;
+    m_max_pending_jobs_isSet = false;
+}
+
+void
+SWGSpectrumScannerSweepReport::cleanup() {
+
+
+
+
+
+
+
+
+
+}
+
+SWGSpectrumScannerSweepReport*
+SWGSpectrumScannerSweepReport::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGSpectrumScannerSweepReport::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&nb_steps, pJson["nbSteps"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&sweep_time, pJson["sweepTime"], "float", "");
+    
+    ::SWGSDRangel::setValue(&steps_per_second, pJson["stepsPerSecond"], "float", "");
+    
+    ::SWGSDRangel::setValue(&retune_time, pJson["retuneTime"], "float", "");
+    
+    ::SWGSDRangel::setValue(&fft_time, pJson["fftTime"], "float", "");
+    
+    ::SWGSDRangel::setValue(&acquired_samples, pJson["acquiredSamples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&discarded_samples, pJson["discardedSamples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&nb_timeouts, pJson["nbTimeouts"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&max_pending_jobs, pJson["maxPendingJobs"], "qint32", "");
+    
+}
+
+QString
+SWGSpectrumScannerSweepReport::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGSpectrumScannerSweepReport::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_nb_steps_isSet){
+        obj->insert("nbSteps", QJsonValue(nb_steps));
+    }
+    if(m_sweep_time_isSet){
+        obj->insert("sweepTime", QJsonValue(sweep_time));
+    }
+    if(m_steps_per_second_isSet){
+        obj->insert("stepsPerSecond", QJsonValue(steps_per_second));
+    }
+    if(m_retune_time_isSet){
+        obj->insert("retuneTime", QJsonValue(retune_time));
+    }
+    if(m_fft_time_isSet){
+        obj->insert("fftTime", QJsonValue(fft_time));
+    }
+    if(m_acquired_samples_isSet){
+        obj->insert("acquiredSamples", QJsonValue(acquired_samples));
+    }
+    if(m_discarded_samples_isSet){
+        obj->insert("discardedSamples", QJsonValue(discarded_samples));
+    }
+    if(m_nb_timeouts_isSet){
+        obj->insert("nbTimeouts", QJsonValue(nb_timeouts));
+    }
+    if(m_max_pending_jobs_isSet){
+        obj->insert("maxPendingJobs", QJsonValue(max_pending_jobs));
+    }
+
+    return obj;
+}
+
+qint32
+SWGSpectrumScannerSweepReport::getNbSteps() {
+    return nb_steps;
+}
+void
+SWGSpectrumScannerSweepReport::setNbSteps(qint32 nb_steps) {
+    this->nb_steps = nb_steps;
+    this->m_nb_steps_isSet = true;
+}
+
+float
+SWGSpectrumScannerSweepReport::getSweepTime() {
+    return sweep_time;
+}
+void
+SWGSpectrumScannerSweepReport::setSweepTime(float sweep_time) {
+    this->sweep_time = sweep_time;
+    this->m_sweep_time_isSet = true;
+}
+
+float
+SWGSpectrumScannerSweepReport::getStepsPerSecond() {
+    return steps_per_second;
+}
+void
+SWGSpectrumScannerSweepReport::setStepsPerSecond(float steps_per_second) {
+    this->steps_per_second = steps_per_second;
+    this->m_steps_per_second_isSet = true;
+}
+
+float
+SWGSpectrumScannerSweepReport::getRetuneTime() {
+    return retune_time;
+}
+void
+SWGSpectrumScannerSweepReport::setRetuneTime(float retune_time) {
+    this->retune_time = retune_time;
+    this->m_retune_time_isSet = true;
+}
+
+float
+SWGSpectrumScannerSweepReport::getFftTime() {
+    return fft_time;
+}
+void
+SWGSpectrumScannerSweepReport::setFftTime(float fft_time) {
+    this->fft_time = fft_time;
+    this->m_fft_time_isSet = true;
+}
+
+qint64
+SWGSpectrumScannerSweepReport::getAcquiredSamples() {
+    return acquired_samples;
+}
+void
+SWGSpectrumScannerSweepReport::setAcquiredSamples(qint64 acquired_samples) {
+    this->acquired_samples = acquired_samples;
+    this->m_acquired_samples_isSet = true;
+}
+
+qint64
+SWGSpectrumScannerSweepReport::getDiscardedSamples() {
+    return discarded_samples;
+}
+void
+SWGSpectrumScannerSweepReport::setDiscardedSamples(qint64 discarded_samples) {
+    this->discarded_samples = discarded_samples;
+    this->m_discarded_samples_isSet = true;
+}
+
+qint32
+SWGSpectrumScannerSweepReport::getNbTimeouts() {
+    return nb_timeouts;
+}
+void
+SWGSpectrumScannerSweepReport::setNbTimeouts(qint32 nb_timeouts) {
+    this->nb_timeouts = nb_timeouts;
+    this->m_nb_timeouts_isSet = true;
+}
+
+qint32
+SWGSpectrumScannerSweepReport::getMaxPendingJobs() {
+    return max_pending_jobs;
+}
+void
+SWGSpectrumScannerSweepReport::setMaxPendingJobs(qint32 max_pending_jobs) {
+    this->max_pending_jobs = max_pending_jobs;
+    this->m_max_pending_jobs_isSet = true;
+}
+
+
+bool
+SWGSpectrumScannerSweepReport::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_nb_steps_isSet){ isObjectUpdated = true; break;}
+        if(m_sweep_time_isSet){ isObjectUpdated = true; break;}
+        if(m_steps_per_second_isSet){ isObjectUpdated = true; break;}
+        if(m_retune_time_isSet){ isObjectUpdated = true; break;}
+        if(m_fft_time_isSet){ isObjectUpdated = true; break;}
+        if(m_acquired_samples_isSet){ isObjectUpdated = true; break;}
+        if(m_discarded_samples_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_timeouts_isSet){ isObjectUpdated = true; break;}
+        if(m_max_pending_jobs_isSet){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,106 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.4.1
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGSpectrumScannerSweepReport.h
+ *
+ * Statistics of the last complete sweep
+ */
+
+#ifndef SWGSpectrumScannerSweepReport_H_
+#define SWGSpectrumScannerSweepReport_H_
+
+#include <QJsonObject>
+
+
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGSpectrumScannerSweepReport: public SWGObject {
+public:
+    SWGSpectrumScannerSweepReport();
+    SWGSpectrumScannerSweepReport(QString* json);
+    virtual ~SWGSpectrumScannerSweepReport();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGSpectrumScannerSweepReport* fromJson(QString &jsonString) override;
+
+    qint32 getNbSteps();
+    void setNbSteps(qint32 nb_steps);
+
+    float getSweepTime();
+    void setSweepTime(float sweep_time);
+
+    float getStepsPerSecond();
+    void setStepsPerSecond(float steps_per_second);
+
+    float getRetuneTime();
+    void setRetuneTime(float retune_time);
+
+    float getFftTime();
+    void setFftTime(float fft_time);
+
+    qint64 getAcquiredSamples();
+    void setAcquiredSamples(qint64 acquired_samples);
+
+    qint64 getDiscardedSamples();
+    void setDiscardedSamples(qint64 discarded_samples);
+
+    qint32 getNbTimeouts();
+    void setNbTimeouts(qint32 nb_timeouts);
+
+    qint32 getMaxPendingJobs();
+    void setMaxPendingJobs(qint32 max_pending_jobs);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 nb_steps;
+    bool m_nb_steps_isSet;
+
+    float sweep_time;
+    bool m_sweep_time_isSet;
+
+    float steps_per_second;
+    bool m_steps_per_second_isSet;
+
+    float retune_time;
+    bool m_retune_time_isSet;
+
+    float fft_time;
+    bool m_fft_time_isSet;
+
+    qint64 acquired_samples;
+    bool m_acquired_samples_isSet;
+
+    qint64 discarded_samples;
+    bool m_discarded_samples_isSet;
+
+    qint32 nb_timeouts;
+    bool m_nb_timeouts_isSet;
+
+    qint32 max_pending_jobs;
+    bool m_max_pending_jobs_isSet;
+
+};
+
+}
+
+#endif /* SWGSpectrumScannerSweepReport_H_ */
@@ -54,6 +54,10 @@ SWGUDPSinkSettings::SWGUDPSinkSettings() {
     m_audio_active_isSet = false;
     audio_stereo = 0;
     m_audio_stereo_isSet = false;
+    audio_codec = 0;
+    m_audio_codec_isSet = false;
+    audio_dtx = 0;
+    m_audio_dtx_isSet = false;
     volume = 0;
     m_volume_isSet = false;
     udp_address = nullptr;
@@ -100,6 +104,10 @@ SWGUDPSinkSettings::init() {
     m_audio_active_isSet = false;
     audio_stereo = 0;
     m_audio_stereo_isSet = false;
+    audio_codec = 0;
+    m_audio_codec_isSet = false;
+    audio_dtx = 0;
+    m_audio_dtx_isSet = false;
     volume = 0;
     m_volume_isSet = false;
     udp_address = new QString("");
@@ -130,6 +138,8 @@ SWGUDPSinkSettings::cleanup() {
 
 
 
+
+
     if(udp_address != nullptr) { 
         delete udp_address;
     }
@@ -178,6 +188,10 @@ SWGUDPSinkSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&audio_stereo, pJson["audioStereo"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&audio_codec, pJson["audioCodec"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&audio_dtx, pJson["audioDTX"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&volume, pJson["volume"], "qint32", "");
     
     ::SWGSDRangel::setValue(&udp_address, pJson["udpAddress"], "QString", "QString");
@@ -245,6 +259,12 @@ SWGUDPSinkSettings::asJsonObject() {
     if(m_audio_stereo_isSet){
         obj->insert("audioStereo", QJsonValue(audio_stereo));
     }
+    if(m_audio_codec_isSet){
+        obj->insert("audioCodec", QJsonValue(audio_codec));
+    }
+    if(m_audio_dtx_isSet){
+        obj->insert("audioDTX", QJsonValue(audio_dtx));
+    }
     if(m_volume_isSet){
         obj->insert("volume", QJsonValue(volume));
     }
@@ -397,6 +417,26 @@ SWGUDPSinkSettings::setAudioStereo(qint32 audio_stereo) {
     this->m_audio_stereo_isSet = true;
 }
 
+qint32
+SWGUDPSinkSettings::getAudioCodec() {
+    return audio_codec;
+}
+void
+SWGUDPSinkSettings::setAudioCodec(qint32 audio_codec) {
+    this->audio_codec = audio_codec;
+    this->m_audio_codec_isSet = true;
+}
+
+qint32
+SWGUDPSinkSettings::getAudioDtx() {
+    return audio_dtx;
+}
+void
+SWGUDPSinkSettings::setAudioDtx(qint32 audio_dtx) {
+    this->audio_dtx = audio_dtx;
+    this->m_audio_dtx_isSet = true;
+}
+
 qint32
 SWGUDPSinkSettings::getVolume() {
     return volume;
@@ -475,6 +515,8 @@ SWGUDPSinkSettings::isSet(){
         if(m_agc_isSet){ isObjectUpdated = true; break;}
         if(m_audio_active_isSet){ isObjectUpdated = true; break;}
         if(m_audio_stereo_isSet){ isObjectUpdated = true; break;}
+        if(m_audio_codec_isSet){ isObjectUpdated = true; break;}
+        if(m_audio_dtx_isSet){ isObjectUpdated = true; break;}
         if(m_volume_isSet){ isObjectUpdated = true; break;}
         if(udp_address != nullptr && *udp_address != QString("")){ isObjectUpdated = true; break;}
         if(m_udp_port_isSet){ isObjectUpdated = true; break;}
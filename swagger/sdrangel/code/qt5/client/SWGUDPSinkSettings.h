@@ -81,6 +81,12 @@ public:
     qint32 getAudioStereo();
     void setAudioStereo(qint32 audio_stereo);
 
+    qint32 getAudioCodec();
+    void setAudioCodec(qint32 audio_codec);
+
+    qint32 getAudioDtx();
+    void setAudioDtx(qint32 audio_dtx);
+
     qint32 getVolume();
     void setVolume(qint32 volume);
 
@@ -142,6 +148,12 @@ private:
     qint32 audio_stereo;
     bool m_audio_stereo_isSet;
 
+    qint32 audio_codec;
+    bool m_audio_codec_isSet;
+
+    qint32 audio_dtx;
+    bool m_audio_dtx_isSet;
+
     qint32 volume;
     bool m_volume_isSet;
 
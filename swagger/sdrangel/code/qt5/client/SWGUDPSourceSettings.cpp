@@ -58,6 +58,8 @@ SWGUDPSourceSettings::SWGUDPSourceSettings() {
     m_auto_rw_balance_isSet = false;
     stereo_input = 0;
     m_stereo_input_isSet = false;
+    audio_codec = 0;
+    m_audio_codec_isSet = false;
     rgb_color = 0;
     m_rgb_color_isSet = false;
     udp_address = nullptr;
@@ -114,6 +116,8 @@ SWGUDPSourceSettings::init() {
     m_auto_rw_balance_isSet = false;
     stereo_input = 0;
     m_stereo_input_isSet = false;
+    audio_codec = 0;
+    m_audio_codec_isSet = false;
     rgb_color = 0;
     m_rgb_color_isSet = false;
     udp_address = new QString("");
@@ -152,6 +156,7 @@ SWGUDPSourceSettings::cleanup() {
 
 
 
+
     if(udp_address != nullptr) { 
         delete udp_address;
     }
@@ -209,6 +214,8 @@ SWGUDPSourceSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&stereo_input, pJson["stereoInput"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&audio_codec, pJson["audioCodec"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&rgb_color, pJson["rgbColor"], "qint32", "");
     
     ::SWGSDRangel::setValue(&udp_address, pJson["udpAddress"], "QString", "QString");
@@ -288,6 +295,9 @@ SWGUDPSourceSettings::asJsonObject() {
     if(m_stereo_input_isSet){
         obj->insert("stereoInput", QJsonValue(stereo_input));
     }
+    if(m_audio_codec_isSet){
+        obj->insert("audioCodec", QJsonValue(audio_codec));
+    }
     if(m_rgb_color_isSet){
         obj->insert("rgbColor", QJsonValue(rgb_color));
     }
@@ -469,6 +479,16 @@ SWGUDPSourceSettings::setStereoInput(qint32 stereo_input) {
     this->m_stereo_input_isSet = true;
 }
 
+qint32
+SWGUDPSourceSettings::getAudioCodec() {
+    return audio_codec;
+}
+void
+SWGUDPSourceSettings::setAudioCodec(qint32 audio_codec) {
+    this->audio_codec = audio_codec;
+    this->m_audio_codec_isSet = true;
+}
+
 qint32
 SWGUDPSourceSettings::getRgbColor() {
     return rgb_color;
@@ -579,6 +599,7 @@ SWGUDPSourceSettings::isSet(){
         if(m_squelch_enabled_isSet){ isObjectUpdated = true; break;}
         if(m_auto_rw_balance_isSet){ isObjectUpdated = true; break;}
         if(m_stereo_input_isSet){ isObjectUpdated = true; break;}
+        if(m_audio_codec_isSet){ isObjectUpdated = true; break;}
         if(m_rgb_color_isSet){ isObjectUpdated = true; break;}
         if(udp_address != nullptr && *udp_address != QString("")){ isObjectUpdated = true; break;}
         if(m_udp_port_isSet){ isObjectUpdated = true; break;}
@@ -87,6 +87,9 @@ public:
     qint32 getStereoInput();
     void setStereoInput(qint32 stereo_input);
 
+    qint32 getAudioCodec();
+    void setAudioCodec(qint32 audio_codec);
+
     qint32 getRgbColor();
     void setRgbColor(qint32 rgb_color);
 
@@ -163,6 +166,9 @@ private:
     qint32 stereo_input;
     bool m_stereo_input_isSet;
 
+    qint32 audio_codec;
+    bool m_audio_codec_isSet;
+
     qint32 rgb_color;
     bool m_rgb_color_isSet;
 